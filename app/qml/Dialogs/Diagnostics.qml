@@ -0,0 +1,501 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+import QtQuick
+import QtQuick.Window
+import QtQuick.Layouts
+import QtQuick.Controls
+
+Window {
+  id: root
+
+  //
+  // Window options
+  //
+  width: minimumWidth
+  height: minimumHeight
+  title: qsTr("Diagnostics")
+  minimumWidth: column.implicitWidth + 32
+  maximumWidth: column.implicitWidth + 32
+  minimumHeight: column.implicitHeight + root.titlebarHeight + 32
+  maximumHeight: column.implicitHeight + root.titlebarHeight + 32
+
+  //
+  // Make window stay on top
+  //
+  Component.onCompleted: {
+    root.flags = Qt.Dialog |
+        Qt.WindowTitleHint |
+        Qt.WindowStaysOnTopHint |
+        Qt.WindowCloseButtonHint
+  }
+
+  //
+  // Native window registration + latency sampling lifetime
+  //
+  property real titlebarHeight: 0
+  onVisibleChanged: {
+    if (visible) {
+      Cpp_NativeWindow.addWindow(root, Cpp_ThemeManager.colors["base"])
+      root.titlebarHeight = Cpp_NativeWindow.titlebarHeight(root)
+    }
+
+    else {
+      root.titlebarHeight = 0
+      Cpp_NativeWindow.removeWindow(root)
+    }
+
+    Cpp_Misc_LatencyMonitor.enabled = visible
+    Cpp_Misc_AllocationTracker.enabled = visible
+  }
+
+  //
+  // Background + window title on macOS
+  //
+  Rectangle {
+    anchors.fill: parent
+    color: Cpp_ThemeManager.colors["window"]
+
+    //
+    // Drag the window anywhere
+    //
+    DragHandler {
+      target: null
+      onActiveChanged: {
+        if (active)
+          root.startSystemMove()
+      }
+    }
+
+    //
+    // Titlebar text
+    //
+    Label {
+      text: root.title
+      visible: root.titlebarHeight > 0
+      color: Cpp_ThemeManager.colors["text"]
+      font: Cpp_Misc_CommonFonts.customUiFont(1.07, true)
+
+      anchors {
+        topMargin: 6
+        top: parent.top
+        horizontalCenter: parent.horizontalCenter
+      }
+    }
+  }
+
+  //
+  // Close shortcut
+  //
+  Shortcut {
+    sequences: [StandardKey.Close]
+    onActivated: root.close()
+  }
+
+  //
+  // Use page item to set application palette
+  //
+  Page {
+    anchors.fill: parent
+    anchors.topMargin: root.titlebarHeight
+    palette.mid: Cpp_ThemeManager.colors["mid"]
+    palette.dark: Cpp_ThemeManager.colors["dark"]
+    palette.text: Cpp_ThemeManager.colors["text"]
+    palette.base: Cpp_ThemeManager.colors["base"]
+    palette.link: Cpp_ThemeManager.colors["link"]
+    palette.light: Cpp_ThemeManager.colors["light"]
+    palette.window: Cpp_ThemeManager.colors["window"]
+    palette.shadow: Cpp_ThemeManager.colors["shadow"]
+    palette.accent: Cpp_ThemeManager.colors["accent"]
+    palette.button: Cpp_ThemeManager.colors["button"]
+    palette.midlight: Cpp_ThemeManager.colors["midlight"]
+    palette.highlight: Cpp_ThemeManager.colors["highlight"]
+    palette.windowText: Cpp_ThemeManager.colors["window_text"]
+    palette.brightText: Cpp_ThemeManager.colors["bright_text"]
+    palette.buttonText: Cpp_ThemeManager.colors["button_text"]
+    palette.toolTipBase: Cpp_ThemeManager.colors["tooltip_base"]
+    palette.toolTipText: Cpp_ThemeManager.colors["tooltip_text"]
+    palette.linkVisited: Cpp_ThemeManager.colors["link_visited"]
+    palette.alternateBase: Cpp_ThemeManager.colors["alternate_base"]
+    palette.placeholderText: Cpp_ThemeManager.colors["placeholder_text"]
+    palette.highlightedText: Cpp_ThemeManager.colors["highlighted_text"]
+
+    //
+    // Window controls
+    //
+    ColumnLayout {
+      id: column
+      spacing: 4
+      anchors.margins: 16
+      anchors.fill: parent
+
+      //
+      // Pipeline latency table
+      //
+      Label {
+        text: qsTr("Pipeline Latency")
+        font: Cpp_Misc_CommonFonts.boldUiFont
+      }
+
+      //
+      // Header row
+      //
+      RowLayout {
+        spacing: 8
+        Layout.fillWidth: true
+
+        Label {
+          text: qsTr("Stage")
+          Layout.preferredWidth: 148
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        } Label {
+          text: qsTr("p50 (ms)")
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        } Label {
+          text: qsTr("p90 (ms)")
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        } Label {
+          text: qsTr("p99 (ms)")
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        } Label {
+          text: qsTr("Max (ms)")
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        } Label {
+          text: qsTr("Samples")
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        }
+      }
+
+      //
+      // One row per pipeline stage
+      //
+      Repeater {
+        model: Cpp_Misc_LatencyMonitor.statistics
+        delegate: RowLayout {
+          spacing: 8
+          Layout.fillWidth: true
+          required property var modelData
+
+          Label {
+            text: modelData.stage
+            Layout.preferredWidth: 148
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.p50.toFixed(3)
+            Layout.preferredWidth: 72
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.p90.toFixed(3)
+            Layout.preferredWidth: 72
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.p99.toFixed(3)
+            Layout.preferredWidth: 72
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.max.toFixed(3)
+            Layout.preferredWidth: 72
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.samples
+            Layout.preferredWidth: 72
+            font: Cpp_Misc_CommonFonts.monoFont
+          }
+        }
+      }
+
+      //
+      // Spacer
+      //
+      Item {
+        implicitHeight: 8
+      }
+
+      //
+      // Heap allocation table
+      //
+      Label {
+        text: qsTr("Heap Allocations")
+        font: Cpp_Misc_CommonFonts.boldUiFont
+      }
+
+      //
+      // Header row
+      //
+      RowLayout {
+        spacing: 8
+        Layout.fillWidth: true
+
+        Label {
+          text: qsTr("Stage")
+          Layout.preferredWidth: 148
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        } Label {
+          text: qsTr("Allocs/frame")
+          Layout.preferredWidth: 96
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        } Label {
+          text: qsTr("KB/frame")
+          Layout.preferredWidth: 96
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        } Label {
+          text: qsTr("Frames")
+          Layout.preferredWidth: 72
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        }
+      }
+
+      //
+      // One row per pipeline stage
+      //
+      Repeater {
+        model: Cpp_Misc_AllocationTracker.statistics
+        delegate: RowLayout {
+          spacing: 8
+          Layout.fillWidth: true
+          required property var modelData
+
+          Label {
+            text: modelData.stage
+            Layout.preferredWidth: 148
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.allocsPerFrame.toFixed(1)
+            Layout.preferredWidth: 96
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.kbPerFrame.toFixed(2)
+            Layout.preferredWidth: 96
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.frames
+            Layout.preferredWidth: 72
+            font: Cpp_Misc_CommonFonts.monoFont
+          }
+        }
+      }
+
+      //
+      // Spacer
+      //
+      Item {
+        implicitHeight: 8
+      }
+
+      //
+      // IO throughput counters
+      //
+      Label {
+        text: qsTr("IO Throughput")
+        font: Cpp_Misc_CommonFonts.boldUiFont
+      }
+
+      GridLayout {
+        columns: 2
+        rowSpacing: 2
+        columnSpacing: 16
+
+        Label {
+          text: qsTr("Data rate")
+        } Label {
+          font: Cpp_Misc_CommonFonts.monoFont
+          text: (Cpp_IO_Manager.dataRate / 1024).toFixed(2) + " " + qsTr("KB/s")
+        }
+
+        Label {
+          text: qsTr("Frame rate")
+        } Label {
+          font: Cpp_Misc_CommonFonts.monoFont
+          text: Cpp_IO_Manager.frameRate.toFixed(0) + " " + qsTr("frames/s")
+        }
+
+        Label {
+          text: qsTr("Buffer usage")
+        } Label {
+          font: Cpp_Misc_CommonFonts.monoFont
+          text: Cpp_IO_Manager.bufferUtilization.toFixed(1) + " %"
+        }
+
+        Label {
+          text: qsTr("Checksum errors")
+        } Label {
+          font: Cpp_Misc_CommonFonts.monoFont
+          text: "" + Cpp_IO_Manager.checksumErrors
+        }
+
+        Label {
+          text: qsTr("Dropped bytes")
+        } Label {
+          font: Cpp_Misc_CommonFonts.monoFont
+          text: "" + Cpp_IO_Manager.droppedBytes
+        }
+      }
+
+      //
+      // Spacer
+      //
+      Item {
+        implicitHeight: 8
+      }
+
+      //
+      // Rejected frame post-mortem
+      //
+      RowLayout {
+        spacing: 8
+        Layout.fillWidth: true
+
+        Label {
+          text: qsTr("Rejected Frames")
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        }
+
+        Item {
+          Layout.fillWidth: true
+        }
+
+        Button {
+          text: qsTr("Dump")
+          onClicked: Cpp_IO_Manager.dumpRejectedFrames()
+        }
+      }
+
+      //
+      // Placeholder until a dump is requested
+      //
+      Label {
+        opacity: 0.8
+        visible: Cpp_IO_Manager.rejectedFrames === ""
+        text: qsTr("Press \"Dump\" to inspect frames that failed validation")
+        font: Cpp_Misc_CommonFonts.customUiFont(0.9, false)
+      }
+
+      //
+      // Rendered post-mortem report
+      //
+      Label {
+        Layout.fillWidth: true
+        wrapMode: Text.WrapAnywhere
+        visible: Cpp_IO_Manager.rejectedFrames !== ""
+        text: Cpp_IO_Manager.rejectedFrames
+        font: Cpp_Misc_CommonFonts.monoFont
+      }
+
+      //
+      // Spacer
+      //
+      Item {
+        implicitHeight: 8
+      }
+
+      //
+      // Slow frame reports
+      //
+      RowLayout {
+        spacing: 8
+        Layout.fillWidth: true
+
+        Label {
+          text: qsTr("Slow Frames")
+          font: Cpp_Misc_CommonFonts.boldUiFont
+        }
+
+        Item {
+          Layout.fillWidth: true
+        }
+
+        Button {
+          text: qsTr("Clear")
+          onClicked: Cpp_Misc_Watchdog.clearReports()
+          enabled: Cpp_Misc_Watchdog.reports.length > 0
+        }
+
+        Button {
+          text: qsTr("Export")
+          onClicked: Cpp_Misc_Watchdog.exportReports()
+          enabled: Cpp_Misc_Watchdog.reports.length > 0
+        }
+      }
+
+      //
+      // Placeholder when no stalls were recorded
+      //
+      Label {
+        opacity: 0.8
+        visible: Cpp_Misc_Watchdog.reports.length === 0
+        text: qsTr("No GUI stalls or slow scopes detected")
+        font: Cpp_Misc_CommonFonts.customUiFont(0.9, false)
+      }
+
+      //
+      // One row per report (most recent first)
+      //
+      Repeater {
+        model: Cpp_Misc_Watchdog.reports
+        delegate: RowLayout {
+          spacing: 8
+          Layout.fillWidth: true
+          required property var modelData
+
+          Label {
+            text: modelData.time
+            Layout.preferredWidth: 164
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.type
+            Layout.preferredWidth: 96
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.scope
+            Layout.fillWidth: true
+            elide: Text.ElideMiddle
+            font: Cpp_Misc_CommonFonts.monoFont
+          } Label {
+            text: modelData.duration.toFixed(1) + " ms"
+            Layout.preferredWidth: 84
+            font: Cpp_Misc_CommonFonts.monoFont
+          }
+        }
+      }
+
+      //
+      // Spacer
+      //
+      Item {
+        implicitHeight: 8
+      }
+
+      //
+      // Sampling note
+      //
+      Label {
+        opacity: 0.8
+        text: qsTr("Sampling is only active while this window is open")
+        font: Cpp_Misc_CommonFonts.customUiFont(0.9, false)
+      }
+    }
+  }
+}
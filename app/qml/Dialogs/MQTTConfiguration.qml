@@ -112,6 +112,8 @@ Window {
     //property alias clientId: _clientID.text
     property alias keepAlive: _keepAlive.text
     property alias cleanSession: _cleanSession.checked
+    property alias flushInterval: _flushInterval.text
+    property alias compression: _compression.checked
 
     property alias username: _username.text
     property alias password: _password.text
@@ -324,6 +326,30 @@ Window {
               }
             }
 
+            Label { text: qsTr("Publish Interval (ms)") + ":" }
+            TextField {
+              id: _flushInterval
+              Layout.fillWidth: true
+              inputMethodHints: Qt.ImhDigitsOnly
+              validator: IntValidator { bottom: 0; top: 65535 }
+              text: Cpp_MQTT_Client.flushInterval.toString()
+              onTextChanged: {
+                if (Cpp_MQTT_Client.flushInterval !== parseInt(text))
+                  Cpp_MQTT_Client.flushInterval = parseInt(text)
+              }
+            }
+
+            Label { text: qsTr("Compression") + ":" }
+            Switch {
+              id: _compression
+              Layout.leftMargin: -8
+              checked: Cpp_MQTT_Client.compressionEnabled
+              onCheckedChanged: {
+                if (Cpp_MQTT_Client.compressionEnabled !== checked)
+                  Cpp_MQTT_Client.compressionEnabled = checked
+              }
+            }
+
             Label { text: qsTr("Clean Session") + ":" }
             Switch {
               id: _cleanSession
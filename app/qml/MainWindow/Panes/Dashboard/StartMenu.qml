@@ -320,6 +320,14 @@ Popup {
       icon.source: "qrc:/rcc/icons/start/adjust.svg"
     }
 
+    Widgets.MenuButton {
+      expandable: false
+      Layout.fillWidth: true
+      text: qsTr("Diagnostics")
+      onClicked: app.showDiagnostics()
+      icon.source: "qrc:/rcc/icons/start/console.svg"
+    }
+
     Widgets.MenuButton {
       expandable: false
       text: qsTr("Help")
@@ -357,10 +365,11 @@ Popup {
       expandable: false
       Layout.fillWidth: true
       text: qsTr("Disconnect")
+      enabled: Cpp_IO_Manager.isConnected
       icon.source: "qrc:/rcc/icons/start/disconnect.svg"
       onClicked: {
         root.close()
-        Cpp_IO_Manager.disconnectDevice()
+        Cpp_IO_Manager.toggleConnection()
       }
     }
   }
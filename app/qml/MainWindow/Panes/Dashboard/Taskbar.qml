@@ -165,6 +165,72 @@ Item {
               function onActiveWindowChanged() { button.updateState() }
               function onWindowStatesChanged() { button.updateState() }
             }
+
+            //
+            // Window thumbnail preview
+            //
+            // The preview shows a cached texture grabbed from the scene graph
+            // at most once per second instead of mirroring live widget
+            // content, so hovering the taskbar stays cheap while data is
+            // being ingested at high rates. Minimized windows keep the last
+            // thumbnail that was grabbed while they were visible.
+            //
+            property var thumbnailGrab: null
+            property double thumbnailTimestamp: 0
+
+            function updateThumbnail() {
+              const window = taskBar.windowData(model.windowId)
+              if (window === null)
+                return
+
+              if (taskBar.windowState(window) !== SS_Ui.TaskbarModel.WindowNormal)
+                return
+
+              const now = Date.now()
+              if (now - button.thumbnailTimestamp < 1000)
+                return
+
+              button.thumbnailTimestamp = now
+              window.grabToImage(function(result) {
+                button.thumbnailGrab = result
+                thumbnail.source = result.url
+              }, Qt.size(192, 128))
+            }
+
+            onHoveredChanged: {
+              if (button.hovered)
+                button.updateThumbnail()
+            }
+
+            Popup {
+              id: thumbnailPopup
+              padding: 4
+              contentWidth: 192
+              contentHeight: 128
+              y: -implicitHeight - 6
+              x: (button.width - implicitWidth) / 2
+              closePolicy: Popup.NoAutoClose
+              visible: button.hovered && thumbnail.status === Image.Ready
+
+              background: Rectangle {
+                border.width: 1
+                color: Cpp_ThemeManager.colors["widget_base"]
+                border.color: Cpp_ThemeManager.colors["window_border"]
+              }
+
+              contentItem: Image {
+                id: thumbnail
+                cache: false
+                fillMode: Image.PreserveAspectFit
+              }
+
+              Timer {
+                repeat: true
+                interval: 1000
+                running: thumbnailPopup.visible
+                onTriggered: button.updateThumbnail()
+              }
+            }
           }
         }
 
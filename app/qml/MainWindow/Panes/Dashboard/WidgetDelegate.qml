@@ -127,6 +127,11 @@ Widgets.MiniWindow {
   //
   // Render a widget inside the pane
   //
+  // The widget view is compiled and incubated asynchronously, so opening a
+  // project with dozens of widgets paints the window chrome immediately and
+  // fills in the widget bodies progressively instead of blocking the GUI
+  // thread until every delegate has been instantiated.
+  //
   DashboardWidget {
     id: widget
     widgetIndex: root.widgetIndex
@@ -137,39 +142,71 @@ Widgets.MiniWindow {
     anchors.fill: parent
     anchors.topMargin: root.captionHeight
 
+    property var incubator: null
     property var widgetInstance: null
 
-    Component.onCompleted: {
-      const component = Qt.createComponent(widget.widgetQmlPath)
-      if (component.status === Component.Ready) {
-        if (widgetInstance)
-          widgetInstance.destroy()
-
-        widgetInstance = component.createObject(loader, {
-                                                  model: widget.widgetModel,
-                                                  windowRoot: root,
-                                                  color: widget.widgetColor
-                                                })
-
-        if (!widgetInstance) {
-          console.error("Failed to create widget from", widget.widgetQmlPath)
-          return
-        }
+    function finishCreation(object) {
+      if (widgetInstance)
+        widgetInstance.destroy()
+
+      widgetInstance = object
+      if (!widgetInstance) {
+        console.error("Failed to create widget from", widget.widgetQmlPath)
+        return
+      }
 
-        if (widgetInstance.hasToolbar !== undefined) {
-          root.hasToolbar = widgetInstance.hasToolbar
-          if (widgetInstance.hasToolbarChanged !== undefined) {
-            widgetInstance.hasToolbarChanged.connect(function () {
-              root.hasToolbar = widgetInstance.hasToolbar
-            })
-          }
+      if (widgetInstance.hasToolbar !== undefined) {
+        root.hasToolbar = widgetInstance.hasToolbar
+        if (widgetInstance.hasToolbarChanged !== undefined) {
+          widgetInstance.hasToolbarChanged.connect(function () {
+            root.hasToolbar = widgetInstance.hasToolbar
+          })
         }
+      }
+
+      if (widgetInstance.usesWindowRefresh !== undefined)
+        root.refreshRateControlVisible = true
+
+      widgetInstance.anchors.fill = loader
+    }
+
+    function incubateWidget(component) {
+      incubator = component.incubateObject(loader, {
+                                             model: widget.widgetModel,
+                                             windowRoot: root,
+                                             color: widget.widgetColor
+                                           })
 
-        widgetInstance.anchors.fill = loader
+      if (incubator.status === Component.Ready)
+        finishCreation(incubator.object)
+
+      else {
+        incubator.onStatusChanged = function (status) {
+          if (status === Component.Ready)
+            loader.finishCreation(loader.incubator.object)
+          else if (status === Component.Error)
+            console.error("Widget incubation error for", widget.widgetQmlPath)
+        }
       }
+    }
+
+    Component.onCompleted: {
+      const component = Qt.createComponent(widget.widgetQmlPath,
+                                           Component.Asynchronous)
+      if (component.status === Component.Ready)
+        incubateWidget(component)
 
       else if (component.status === Component.Error)
         console.error("Component load error:", component.errorString())
+
+      else {
+        component.statusChanged.connect(function () {
+          if (component.status === Component.Ready)
+            loader.incubateWidget(component)
+          else if (component.status === Component.Error)
+            console.error("Component load error:", component.errorString())
+        })
+      }
     }
 
     Connections {
@@ -181,4 +218,43 @@ Widgets.MiniWindow {
       }
     }
   }
+
+  //
+  // Cost attribution overlay (heat tint + ms/s label)
+  //
+  // Tints the window with the widget's share of the most expensive widget's
+  // update cost, so the offender on a slow dashboard glows red while cheap
+  // widgets stay untinted. Only rendered while profiling is enabled.
+  //
+  Rectangle {
+    id: heatOverlay
+    clip: true
+    radius: root.radius
+    anchors.fill: parent
+    visible: Cpp_UI_WidgetProfiler.enabled
+    anchors.topMargin: root.captionHeight + (root.hasToolbar ? 48 : 0) - 1
+    color: Qt.rgba(1, 0.25, 0, 0.35 * heat)
+
+    property real heat: 0
+
+    Connections {
+      target: Cpp_UI_WidgetProfiler
+
+      function onCostsChanged() {
+        heatOverlay.heat = Cpp_UI_WidgetProfiler.heatOf(widget.widgetModel)
+      }
+    }
+
+    Label {
+      opacity: 0.8
+      font: Cpp_Misc_CommonFonts.monoFont
+      color: Cpp_ThemeManager.colors["text"]
+      text: (heatOverlay.heat * 100).toFixed(0) + "%"
+      anchors {
+        margins: 4
+        top: parent.top
+        right: parent.right
+      }
+    }
+  }
 }
@@ -68,6 +68,7 @@ Widgets.Pane {
     category: "SetupPanel"
     property alias csvExport: csvLogging.checked
     property alias consoleExport: consoleLogging.checked
+    property alias compressedLog: compressedLogging.checked
     property alias selectedDriver: driverCombo.currentIndex
   }
 
@@ -210,6 +211,44 @@ Widgets.Pane {
         }
       }
 
+      //
+      // Binary recording format
+      //
+      CheckBox {
+        id: binaryRecording
+        Layout.leftMargin: -6
+        Layout.maximumHeight: 18
+        Layout.alignment: Qt.AlignLeft
+        enabled: csvLogging.checked
+        text: qsTr("Compact Binary Format")
+        checked: Cpp_CSV_Export.binaryFormat
+        Layout.maximumWidth: root.maxItemWidth
+
+        onCheckedChanged:  {
+          if (Cpp_CSV_Export.binaryFormat !== checked)
+            Cpp_CSV_Export.binaryFormat = checked
+        }
+      }
+
+      //
+      // Per-group CSV sharding
+      //
+      CheckBox {
+        id: groupSharding
+        Layout.leftMargin: -6
+        Layout.maximumHeight: 18
+        Layout.alignment: Qt.AlignLeft
+        text: qsTr("One CSV File per Group")
+        checked: Cpp_CSV_Export.shardByGroup
+        Layout.maximumWidth: root.maxItemWidth
+        enabled: csvLogging.checked && !binaryRecording.checked
+
+        onCheckedChanged:  {
+          if (Cpp_CSV_Export.shardByGroup !== checked)
+            Cpp_CSV_Export.shardByGroup = checked
+        }
+      }
+
       //
       // Console data export
       //
@@ -228,6 +267,42 @@ Widgets.Pane {
         }
       }
 
+      //
+      // Compressed rotating console log
+      //
+      CheckBox {
+        id: compressedLogging
+        Layout.leftMargin: -6
+        Layout.maximumHeight: 18
+        Layout.alignment: Qt.AlignLeft
+        text: qsTr("Compressed Console Log")
+        Layout.maximumWidth: root.maxItemWidth
+        checked: Cpp_IO_ConsoleLogger.loggingEnabled
+
+        onCheckedChanged:  {
+          if (Cpp_IO_ConsoleLogger.loggingEnabled !== checked)
+            Cpp_IO_ConsoleLogger.loggingEnabled = checked
+        }
+      }
+
+      //
+      // Raw capture recorder
+      //
+      CheckBox {
+        id: captureRecording
+        Layout.leftMargin: -6
+        Layout.maximumHeight: 18
+        Layout.alignment: Qt.AlignLeft
+        text: qsTr("Record Raw Capture")
+        Layout.maximumWidth: root.maxItemWidth
+        checked: Cpp_IO_CaptureRecorder.captureEnabled
+
+        onCheckedChanged:  {
+          if (Cpp_IO_CaptureRecorder.captureEnabled !== checked)
+            Cpp_IO_CaptureRecorder.captureEnabled = checked
+        }
+      }
+
       //
       // Spacer
       //
@@ -0,0 +1,136 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+import QtCore
+import QtQuick
+import QtQuick.Layouts
+import QtQuick.Controls
+
+Item {
+  id: root
+  implicitHeight: layout.implicitHeight
+
+  //
+  // Save settings
+  //
+  Settings {
+    category: "FileReplayDriver"
+    property alias baseRate: _baseRate.text
+    property alias speed: _speedCombo.currentIndex
+  }
+
+  //
+  // Layout
+  //
+  ColumnLayout {
+    id: layout
+    anchors.margins: 0
+    anchors.fill: parent
+
+    GridLayout {
+      columns: 2
+      rowSpacing: 4
+      columnSpacing: 4
+      Layout.fillWidth: true
+
+      //
+      // Capture file
+      //
+      Label {
+        opacity: enabled ? 1 : 0.5
+        text: qsTr("Capture File") + ":"
+        enabled: !Cpp_IO_Manager.isConnected
+      } RowLayout {
+        spacing: 4
+        Layout.fillWidth: true
+
+        TextField {
+          readOnly: true
+          Layout.fillWidth: true
+          opacity: enabled ? 1 : 0.5
+          text: Cpp_IO_FileReplay.filePath
+          enabled: !Cpp_IO_Manager.isConnected
+          placeholderText: qsTr("No file selected")
+        }
+
+        Button {
+          text: qsTr("Browse")
+          opacity: enabled ? 1 : 0.5
+          enabled: !Cpp_IO_Manager.isConnected
+          onClicked: Cpp_IO_FileReplay.selectFile()
+        }
+      }
+
+      //
+      // Base rate
+      //
+      Label {
+        opacity: enabled ? 1 : 0.5
+        text: qsTr("Base Rate (bytes/s)") + ":"
+        enabled: !Cpp_IO_Manager.isConnected
+      } TextField {
+        id: _baseRate
+        Layout.fillWidth: true
+        opacity: enabled ? 1 : 0.5
+        enabled: !Cpp_IO_Manager.isConnected
+        validator: IntValidator { bottom: 1 }
+        Component.onCompleted: text = Cpp_IO_FileReplay.baseRate
+        onTextChanged: {
+          if (text.length > 0 && Cpp_IO_FileReplay.baseRate !== parseInt(text))
+            Cpp_IO_FileReplay.baseRate = parseInt(text)
+        }
+      }
+
+      //
+      // Replay speed
+      //
+      Label {
+        text: qsTr("Replay Speed") + ":"
+      } ComboBox {
+        id: _speedCombo
+        Layout.fillWidth: true
+        model: [ "1x", "10x", qsTr("Unthrottled") ]
+
+        readonly property var multipliers: [ 1, 10, 0 ]
+
+        onCurrentIndexChanged: {
+          const multiplier = multipliers[currentIndex]
+          if (Cpp_IO_FileReplay.speedMultiplier !== multiplier)
+            Cpp_IO_FileReplay.speedMultiplier = multiplier
+        }
+      }
+
+      //
+      // Replay progress
+      //
+      Label {
+        text: qsTr("Progress") + ":"
+        visible: Cpp_IO_Manager.isConnected
+      } ProgressBar {
+        from: 0
+        to: 1
+        Layout.fillWidth: true
+        visible: Cpp_IO_Manager.isConnected
+        value: Cpp_IO_FileReplay.progress
+      }
+    }
+  }
+}
@@ -83,6 +83,12 @@ Widgets.SmartWindow {
   } Shortcut {
     sequences: [StandardKey.Save]
     onActivated: Cpp_JSON_ProjectModel.saveJsonFile()
+  } Shortcut {
+    sequences: [StandardKey.Undo]
+    onActivated: Cpp_JSON_ProjectModel.undo()
+  } Shortcut {
+    sequences: [StandardKey.Redo]
+    onActivated: Cpp_JSON_ProjectModel.redo()
   }
 
   //
@@ -44,89 +44,91 @@ Item {
   readonly property bool unitsVisible: root.height >= 120
 
   //
-  // Create scrollable grid view with LED states
+  // Create virtualized grid view, only visible rows are materialized & the
+  // row model emits per-cell notifications for values that actually changed
   //
-  Flickable {
-    contentWidth: width
+  GridView {
+    id: grid
+    clip: true
+    reuseItems: true
     anchors.fill: parent
     anchors.topMargin: 8
     anchors.leftMargin: 8
     anchors.bottomMargin: 8
+    model: root.model.rows
+    cellHeight: 32 + 4
+    cellWidth: (width - 8) / 2
     interactive: windowRoot.focused
     opacity: windowRoot.focused ? 1 : 0.8
-    contentHeight: Math.max(grid.implicitHeight, height)
 
     ScrollBar.vertical: ScrollBar {
       id: scroll
     }
 
-    GridLayout {
-      id: grid
-      columns: 2
-      rowSpacing: 4
-      columnSpacing: 4
-      width: parent.width - 8
-      anchors.centerIn: parent
-      anchors.horizontalCenterOffset: -4
-
-      Repeater {
-        model: root.model.count
-        delegate: Rectangle {
-          border.width: 1
-          Layout.fillWidth: true
-          Layout.minimumHeight: 32
-          Layout.maximumHeight: 32
-          color: Cpp_ThemeManager.colors["widget_base"]
-          border.color: Cpp_ThemeManager.colors["widget_border"]
-
-          RowLayout {
-            id: layout
-            spacing: 0
-            anchors.margins: 8
-            anchors.left: parent.left
-            anchors.right: parent.right
-            anchors.verticalCenter: parent.verticalCenter
-
-            Label {
-              elide: Qt.ElideRight
-              Layout.fillWidth: true
-              Layout.alignment: Qt.AlignVCenter
-              font: Cpp_Misc_CommonFonts.monoFont
-              horizontalAlignment: Label.AlignLeft
-              visible: text !== "" && root.unitsVisible
-              color: root.model.alarms[index] ? Cpp_ThemeManager.colors["alarm"] :
-                                                root.model.colors[index]
-
-              text: {
-                const title = root.model.titles[index]
-                const units = root.model.units[index]
-
-                let str = title
-                if (units.length > 0)
-                  str += " (" + units + ")"
-
-                return str + ":"
-              }
-
-              Behavior on color {ColorAnimation{}}
+    delegate: Item {
+      id: cell
+
+      required property string title
+      required property string units
+      required property string value
+      required property bool alarm
+      required property string datasetColor
+
+      width: grid.cellWidth
+      height: grid.cellHeight
+
+      Rectangle {
+        border.width: 1
+        anchors.fill: parent
+        anchors.rightMargin: 4
+        anchors.bottomMargin: 4
+        color: Cpp_ThemeManager.colors["widget_base"]
+        border.color: Cpp_ThemeManager.colors["widget_border"]
+
+        RowLayout {
+          id: layout
+          spacing: 0
+          anchors.margins: 8
+          anchors.left: parent.left
+          anchors.right: parent.right
+          anchors.verticalCenter: parent.verticalCenter
+
+          Label {
+            elide: Qt.ElideRight
+            Layout.fillWidth: true
+            Layout.alignment: Qt.AlignVCenter
+            font: Cpp_Misc_CommonFonts.monoFont
+            horizontalAlignment: Label.AlignLeft
+            visible: text !== "" && root.unitsVisible
+            color: cell.alarm ? Cpp_ThemeManager.colors["alarm"] :
+                                cell.datasetColor
+
+            text: {
+              let str = cell.title
+              if (cell.units.length > 0)
+                str += " (" + cell.units + ")"
+
+              return str + ":"
             }
 
+            Behavior on color {ColorAnimation{}}
+          }
 
-            Item {
-              Layout.fillWidth: true
-              implicitWidth: 4
-            }
 
-            Label {
-              elide: Qt.ElideRight
-              text: root.model.values[index]
-              Layout.alignment: Qt.AlignVCenter
-              font: Cpp_Misc_CommonFonts.monoFont
-              Layout.maximumWidth: layout.width - 8
-              horizontalAlignment: Label.AlignRight
-              color: root.unitsVisible ? Cpp_ThemeManager.colors["widget_text"] :
-                                         root.model.colors[index]
-            }
+          Item {
+            Layout.fillWidth: true
+            implicitWidth: 4
+          }
+
+          Label {
+            elide: Qt.ElideRight
+            text: cell.value
+            Layout.alignment: Qt.AlignVCenter
+            font: Cpp_Misc_CommonFonts.monoFont
+            Layout.maximumWidth: layout.width - 8
+            horizontalAlignment: Label.AlignRight
+            color: root.unitsVisible ? Cpp_ThemeManager.colors["widget_text"] :
+                                       cell.datasetColor
           }
         }
       }
@@ -42,6 +42,7 @@ Item {
   // Window flags
   //
   property bool hasToolbar: true
+  property bool usesWindowRefresh: true
 
   //
   // Custom properties
@@ -61,12 +62,12 @@ Item {
   }
 
   //
-  // Update curve at 24 Hz
+  // Update curve at the window's refresh rate
   //
   Connections {
-    target: Cpp_Misc_TimerEvents
+    target: root.windowRoot
 
-    function onTimeout24Hz() {
+    function onRefreshTick() {
       if (root.visible && root.model && root.running) {
         root.model.draw(upperSeries)
         lowerSeries.clear()
@@ -183,17 +183,59 @@ Item {
             name: "osm.mapping.providersrepository.address"
             value: Cpp_JSON_ProjectModel.osmAddress
           }
+
+          //
+          // Persistent LRU tile cache, survives application restarts so
+          // revisited areas pan & zoom from local storage
+          //
+          PluginParameter {
+            name: "osm.mapping.cache.directory"
+            value: Cpp_JSON_ProjectModel.osmCachePath
+          }
+
+          PluginParameter {
+            name: "osm.mapping.cache.disk.size"
+            value: 536870912
+          }
+
+          PluginParameter {
+            name: "osm.mapping.cache.memory.size"
+            value: 67108864
+          }
+
+          //
+          // Speculatively fetch the tile layers around the current view so
+          // zooming in/out hits the cache instead of the network
+          //
+          PluginParameter {
+            name: "osm.mapping.prefetching_style"
+            value: "TwoNeighbourLayers"
+          }
+        }
+
+        //
+        // Breadcrumb trail, mirrored incrementally from the model's online
+        // simplifier: straight legs slide the last vertex in place, only
+        // actual turns commit new vertices
+        //
+        MapPolyline {
+          id: trail
+          opacity: 0.6
+          line.width: 3
+          line.color: root.color
         }
 
         //
-        // Position indicator
+        // Position indicator, moved imperatively by the damage-gating
+        // connection below instead of through a per-fix binding
         //
         MapQuickItem {
           id: positionIndicator
           width: sourceItem.width
           height: sourceItem.height
           anchorPoint: Qt.point(sourceItem.width / 2, sourceItem.height/ 2)
-          coordinate: QtPositioning.coordinate(root.latitude, root.longitude)
+          coordinate: QtPositioning.coordinate(0, 0)
+          Component.onCompleted: coordinate = QtPositioning.coordinate(root.latitude, root.longitude)
           sourceItem: Button {
             flat: true
             width: 128
@@ -223,6 +265,46 @@ Item {
           }
         }
 
+        //
+        // Damage-gated marker updates: the marker only moves when the fix
+        // traveled at least one pixel at the current zoom level, so a 10 Hz
+        // feed jittering inside a pixel does not invalidate the overlay
+        // every frame. Altitude-only updates use a separate notification
+        // and never reach this handler.
+        //
+        // The trail is driven by the model's corridor simplifier instead:
+        // while the track stays straight the last vertex is slid forward in
+        // place, and only turns sharper than the tolerance commit a new
+        // vertex, so the polyline stays small over long missions.
+        //
+        Connections {
+          target: root.model
+
+          function onPositionChanged() {
+            const coord = QtPositioning.coordinate(root.model.latitude,
+                                                   root.model.longitude)
+            const oldPt = map.fromCoordinate(positionIndicator.coordinate, false)
+            const newPt = map.fromCoordinate(coord, false)
+            const dx = newPt.x - oldPt.x
+            const dy = newPt.y - oldPt.y
+            if (dx * dx + dy * dy < 1)
+              return
+
+            positionIndicator.coordinate = coord
+          }
+
+          function onTrailPointAdded(latitude, longitude) {
+            trail.addCoordinate(QtPositioning.coordinate(latitude, longitude))
+            if (trail.pathLength() > 1000)
+              trail.removeCoordinate(trail.path[0])
+          }
+
+          function onTrailPointReplaced(latitude, longitude) {
+            trail.replaceCoordinate(trail.pathLength() - 1,
+                                    QtPositioning.coordinate(latitude, longitude))
+          }
+        }
+
         //
         // Pinch handler
         //
@@ -0,0 +1,247 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+import QtQuick
+import QtGraphs
+import QtQuick.Layouts
+import QtQuick.Controls
+
+import SerialStudio
+
+import "../"
+
+Item {
+  id: root
+
+  //
+  // Widget data inputs
+  //
+  required property color color
+  required property HistogramModel model
+  required property MiniWindow windowRoot
+
+  //
+  // Window flags
+  //
+  property bool hasToolbar: true
+  property bool usesWindowRefresh: true
+
+  //
+  // Custom properties
+  //
+  property bool running: true
+  property bool showPercentiles: true
+
+  //
+  // Enable/disable features depending on window size
+  //
+  onWidthChanged: updateWidgetOptions()
+  onHeightChanged: updateWidgetOptions()
+  function updateWidgetOptions() {
+    plot.yLabelVisible = (root.width >= 196)
+    plot.xLabelVisible = (root.height >= (196 * 2/3))
+    root.hasToolbar = (root.width >= toolbar.implicitWidth) && (root.height >= 220)
+  }
+
+  //
+  // Update distribution at the window's refresh rate
+  //
+  Connections {
+    target: root.windowRoot
+
+    function onRefreshTick() {
+      if (root.visible && root.model && root.running) {
+        root.model.draw(upperSeries)
+        lowerSeries.clear()
+        lowerSeries.append(root.model.minX, root.model.minY)
+        lowerSeries.append(root.model.maxX, root.model.minY)
+      }
+    }
+  }
+
+  //
+  // Add toolbar
+  //
+  RowLayout {
+    id: toolbar
+
+    spacing: 4
+    visible: root.hasToolbar
+    height: root.hasToolbar ? 48 : 0
+
+    anchors {
+      leftMargin: 8
+      top: parent.top
+      left: parent.left
+      right: parent.right
+    }
+
+    ToolButton {
+      width: 24
+      height: 24
+      icon.width: 18
+      icon.height: 18
+      icon.color: "transparent"
+      checked: root.showPercentiles
+      icon.source: "qrc:/rcc/icons/dashboard-buttons/crosshair.svg"
+      onClicked: root.showPercentiles = !root.showPercentiles
+    }
+
+    Rectangle {
+      implicitWidth: 1
+      implicitHeight: 24
+      color: Cpp_ThemeManager.colors["widget_border"]
+    }
+
+    ToolButton {
+      width: 24
+      height: 24
+      icon.width: 18
+      icon.height: 18
+      icon.color: "transparent"
+      checked: plot.xLabelVisible
+      onClicked: plot.xLabelVisible = !plot.xLabelVisible
+      icon.source: "qrc:/rcc/icons/dashboard-buttons/x.svg"
+    }
+
+    ToolButton {
+      width: 24
+      height: 24
+      icon.width: 18
+      icon.height: 18
+      icon.color: "transparent"
+      checked: plot.yLabelVisible
+      onClicked: plot.yLabelVisible = !plot.yLabelVisible
+      icon.source: "qrc:/rcc/icons/dashboard-buttons/y.svg"
+    }
+
+    Rectangle {
+      implicitWidth: 1
+      implicitHeight: 24
+      color: Cpp_ThemeManager.colors["widget_border"]
+    }
+
+    ToolButton {
+      width: 24
+      height: 24
+      icon.width: 18
+      icon.height: 18
+      checked: !root.running
+      icon.color: "transparent"
+      onClicked: root.running = !root.running
+      icon.source: root.running?
+                     "qrc:/rcc/icons/dashboard-buttons/pause.svg" :
+                     "qrc:/rcc/icons/dashboard-buttons/resume.svg"
+    }
+
+    Item {
+      Layout.fillWidth: true
+    }
+  }
+
+  //
+  // Plot widget
+  //
+  PlotWidget {
+    id: plot
+
+    anchors {
+      margins: 8
+      left: parent.left
+      right: parent.right
+      top: toolbar.bottom
+      bottom: parent.bottom
+    }
+
+    xMin: root.model.minX
+    xMax: root.model.maxX
+    yMin: root.model.minY
+    yMax: root.model.maxY
+    curveColors: [root.color]
+    yLabel: qsTr("Samples")
+    xLabel: root.model.xLabel
+    xAxis.tickInterval: root.model.xTickInterval
+    yAxis.tickInterval: root.model.yTickInterval
+
+    Component.onCompleted: {
+      graph.addSeries(areaSeries)
+      graph.addSeries(upperSeries)
+      graph.addSeries(lowerSeries)
+    }
+
+    LineSeries {
+      id: upperSeries
+      width: 2
+    }
+
+    LineSeries {
+      id: lowerSeries
+      width: 0
+      visible: false
+    }
+
+    AreaSeries {
+      id: areaSeries
+      upperSeries: upperSeries
+      lowerSeries: lowerSeries
+      borderColor: "transparent"
+      color: Qt.rgba(root.color.r, root.color.g, root.color.b, 0.2)
+    }
+  }
+
+  //
+  // Percentile readout
+  //
+  ColumnLayout {
+    spacing: 2
+    visible: root.showPercentiles
+
+    anchors {
+      margins: 16
+      top: plot.top
+      right: plot.right
+    }
+
+    Label {
+      text: qsTr("p50: %1").arg(root.model.p50.toFixed(3))
+      font: Cpp_Misc_CommonFonts.monoFont
+      color: Cpp_ThemeManager.colors["widget_text"]
+    }
+
+    Label {
+      text: qsTr("p90: %1").arg(root.model.p90.toFixed(3))
+      font: Cpp_Misc_CommonFonts.monoFont
+      color: Cpp_ThemeManager.colors["widget_text"]
+    }
+
+    Label {
+      text: qsTr("p99: %1").arg(root.model.p99.toFixed(3))
+      font: Cpp_Misc_CommonFonts.monoFont
+      color: Cpp_ThemeManager.colors["widget_text"]
+    }
+
+    Label {
+      text: qsTr("n: %1").arg(root.model.sampleCount)
+      font: Cpp_Misc_CommonFonts.monoFont
+      color: Cpp_ThemeManager.colors["widget_text"]
+    }
+  }
+}
@@ -0,0 +1,83 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+import QtQuick
+import QtQuick.Layouts
+import QtQuick.Controls
+
+import SerialStudio
+
+import "../"
+
+Item {
+  id: root
+
+  //
+  // Widget data inputs
+  //
+  required property color color
+  required property ImageFeedModel model
+  required property MiniWindow windowRoot
+
+  //
+  // Frame display
+  //
+  // Frames arrive pre-decoded from the C++ image provider, so this element
+  // never decompresses anything on the GUI thread; the cache is disabled
+  // because every frame uses a fresh provider URL.
+  //
+  Image {
+    cache: false
+    asynchronous: false
+    anchors.fill: parent
+    anchors.margins: 8
+    source: root.model.source
+    visible: root.model.hasFrame
+    fillMode: Image.PreserveAspectFit
+  }
+
+  //
+  // Placeholder shown until the first frame arrives
+  //
+  Label {
+    anchors.centerIn: parent
+    visible: !root.model.hasFrame
+    text: qsTr("Waiting for first frame…")
+    font: Cpp_Misc_CommonFonts.customUiFont(1.2, true)
+    color: Cpp_ThemeManager.colors["widget_text"]
+  }
+
+  //
+  // Dropped frame counter, only visible when frames were dropped
+  //
+  Label {
+    anchors {
+      margins: 16
+      top: parent.top
+      right: parent.right
+    }
+
+    visible: root.model.droppedFrames > 0
+    font: Cpp_Misc_CommonFonts.monoFont
+    color: Cpp_ThemeManager.colors["widget_text"]
+    text: qsTr("%1 dropped").arg(root.model.droppedFrames)
+  }
+}
@@ -39,119 +39,123 @@ Item {
   required property MiniWindow windowRoot
 
   //
-  // Create scrollable grid view with LED states
+  // Create virtualized grid view with LED states, only visible rows are
+  // materialized & the row model notifies the LEDs that actually flipped
   //
-  Flickable {
-    contentWidth: width
+  GridView {
+    id: grid
+    clip: true
+    reuseItems: true
     anchors.fill: parent
     anchors.topMargin: 8
     anchors.leftMargin: 8
     anchors.bottomMargin: 8
-    contentHeight: Math.max(grid.implicitHeight, height)
+    model: root.model.rows
+    cellHeight: 32 + 4
+    cellWidth: (width - 8) / 2
 
     ScrollBar.vertical: ScrollBar {
       id: scroll
     }
 
-    GridLayout {
-      id: grid
-      columns: 2
-      rowSpacing: 4
-      columnSpacing: 4
-      width: parent.width - 8
-      anchors.centerIn: parent
-      anchors.horizontalCenterOffset: -4
-
-      Repeater {
-        model: root.model.count
-        delegate: Rectangle {
-          border.width: 1
-          Layout.fillWidth: true
-          Layout.minimumHeight: 32
-          Layout.maximumHeight: 32
-          color: Cpp_ThemeManager.colors["widget_base"]
-          border.color: Cpp_ThemeManager.colors["widget_border"]
-
-          RowLayout {
-            id: layout
-            spacing: 0
-            anchors.margins: 4
-            anchors.left: parent.left
-            anchors.right: parent.right
-            anchors.verticalCenter: parent.verticalCenter
-
-            Item {
-              Layout.fillWidth: true
-            }
-
-            Rectangle {
-              id: led
-              readonly property color ledColor: root.model.alarms[index] ? Cpp_ThemeManager.colors["alarm"] :
-                                                                           root.model.colors[index]
-
-              border.width: 1
-              implicitWidth: 18
-              implicitHeight: 18
-              radius: implicitWidth / 2
-              Layout.alignment: Qt.AlignVCenter
-              border.color: Cpp_ThemeManager.colors["widget_border"]
-              color: root.model.states[index] ? ledColor : Qt.darker(ledColor)
-
-              Behavior on color {ColorAnimation{}}
-            }
-
-            Item {
-              Layout.fillWidth: true
-              Layout.minimumWidth: 4
-            }
-
-            Label {
-              elide: Qt.ElideRight
-              text: root.model.titles[index]
-              Layout.alignment: Qt.AlignVCenter
-              font: Cpp_Misc_CommonFonts.monoFont
-              horizontalAlignment: Label.AlignLeft
-              Layout.maximumWidth: layout.width - 4 - 24
-              color: root.model.alarms[index] ? Cpp_ThemeManager.colors["alarm"] :
-                                                Cpp_ThemeManager.colors["widget_text"]
-
-              Behavior on color {ColorAnimation{}}
-            }
-
-            Item {
-              Layout.fillWidth: true
-              Layout.minimumWidth: 4
-            }
+    delegate: Item {
+      id: cell
+
+      required property string title
+      required property bool state
+      required property bool alarm
+      required property string ledColor
+
+      width: grid.cellWidth
+      height: grid.cellHeight
+
+      Rectangle {
+        border.width: 1
+        anchors.fill: parent
+        anchors.rightMargin: 4
+        anchors.bottomMargin: 4
+        color: Cpp_ThemeManager.colors["widget_base"]
+        border.color: Cpp_ThemeManager.colors["widget_border"]
+
+        RowLayout {
+          id: layout
+          spacing: 0
+          anchors.margins: 4
+          anchors.left: parent.left
+          anchors.right: parent.right
+          anchors.verticalCenter: parent.verticalCenter
+
+          Item {
+            Layout.fillWidth: true
           }
 
-          MultiEffect {
-            source: led
-            width: led.width
-            height: led.height
-            x: layout.x + led.x
-            y: layout.y + led.y
-
-            blurEnabled: true
-            blur: root.model.states[index] ? 1 : 0
-            blurMax: root.model.states[index] ? 64 : 0
-            brightness: root.model.states[index] ? 0.4 : 0
-            saturation: root.model.states[index] ? 0.2 : 0
+          Rectangle {
+            id: led
+            readonly property color activeColor: cell.alarm ? Cpp_ThemeManager.colors["alarm"] :
+                                                              cell.ledColor
+
+            border.width: 1
+            implicitWidth: 18
+            implicitHeight: 18
+            radius: implicitWidth / 2
+            Layout.alignment: Qt.AlignVCenter
+            border.color: Cpp_ThemeManager.colors["widget_border"]
+            color: cell.state ? activeColor : Qt.darker(activeColor)
+
+            Behavior on color {ColorAnimation{}}
+          }
+
+          Item {
+            Layout.fillWidth: true
+            Layout.minimumWidth: 4
+          }
+
+          Label {
+            elide: Qt.ElideRight
+            text: cell.title
+            Layout.alignment: Qt.AlignVCenter
+            font: Cpp_Misc_CommonFonts.monoFont
+            horizontalAlignment: Label.AlignLeft
+            Layout.maximumWidth: layout.width - 4 - 24
+            color: cell.alarm ? Cpp_ThemeManager.colors["alarm"] :
+                                Cpp_ThemeManager.colors["widget_text"]
+
+            Behavior on color {ColorAnimation{}}
           }
 
-          MultiEffect {
-            source: led
-            width: led.width
-            height: led.height
-            x: layout.x + led.x
-            y: layout.y + led.y
-
-            blurEnabled: true
-            blur: root.model.states[index] ? 0.3 : 0
-            blurMax: root.model.states[index] ? 64 : 0
-            brightness: root.model.states[index] ? 0.4 : 0
-            saturation: root.model.states[index] ? 0.2 : 0
+          Item {
+            Layout.fillWidth: true
+            Layout.minimumWidth: 4
           }
         }
+
+        MultiEffect {
+          source: led
+          width: led.width
+          height: led.height
+          x: layout.x + led.x
+          y: layout.y + led.y
+
+          blurEnabled: true
+          blur: cell.state ? 1 : 0
+          blurMax: cell.state ? 64 : 0
+          brightness: cell.state ? 0.4 : 0
+          saturation: cell.state ? 0.2 : 0
+        }
+
+        MultiEffect {
+          source: led
+          width: led.width
+          height: led.height
+          x: layout.x + led.x
+          y: layout.y + led.y
+
+          blurEnabled: true
+          blur: cell.state ? 0.3 : 0
+          blurMax: cell.state ? 64 : 0
+          brightness: cell.state ? 0.4 : 0
+          saturation: cell.state ? 0.2 : 0
+        }
       }
     }
   }
@@ -41,6 +41,7 @@ Item {
   // Window flags
   //
   property bool hasToolbar: true
+  property bool usesWindowRefresh: true
 
   //
   // Custom properties
@@ -62,12 +63,12 @@ Item {
   }
 
   //
-  // Update widget at 24 Hz
+  // Update widget at the window's refresh rate
   //
   Connections {
-    target: Cpp_Misc_TimerEvents
+    target: root.windowRoot
 
-    function onTimeout24Hz() {
+    function onRefreshTick() {
       if (root.visible && root.running) {
         const count = plot.graph.seriesList.length
         for (let i = 0; i < count; ++i)
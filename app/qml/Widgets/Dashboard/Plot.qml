@@ -43,6 +43,7 @@ Item {
   // Window flags
   //
   property bool hasToolbar: true
+  property bool usesWindowRefresh: true
 
   //
   // Custom properties
@@ -63,24 +64,50 @@ Item {
   }
 
   //
-  // Update curve at 24 Hz
+  // Re-uploads the series geometry
+  //
+  function refreshSeries() {
+    if (!root.visible || !root.model)
+      return
+
+    if (root.interpolate) {
+      root.model.draw(upperSeries)
+
+      lowerSeries.clear()
+      lowerSeries.append(root.model.minX, root.model.minY)
+      lowerSeries.append(root.model.maxX, root.model.minY)
+    }
+
+    else
+      root.model.draw(scatterSeries)
+  }
+
+  //
+  // Update curve at the window's refresh rate
   //
   Connections {
-    target: Cpp_Misc_TimerEvents
+    target: root.windowRoot
+
+    function onRefreshTick() {
+      if (root.running)
+        root.refreshSeries()
+    }
+  }
 
-    function onTimeout24Hz() {
-      if (root.visible && root.model && root.running) {
-        if (root.interpolate) {
-          root.model.draw(upperSeries)
+  //
+  // Re-resolve the visible range when the user pans or zooms
+  //
+  Connections {
+    target: plot.xAxis
 
-          lowerSeries.clear()
-          lowerSeries.append(root.model.minX, root.model.minY)
-          lowerSeries.append(root.model.maxX, root.model.minY)
-        }
+    function onZoomChanged() {
+      root.model.setViewWindow(plot.xAxis.zoom, plot.xAxis.pan)
+      root.refreshSeries()
+    }
 
-        else
-          root.model.draw(scatterSeries)
-      }
+    function onPanChanged() {
+      root.model.setViewWindow(plot.xAxis.zoom, plot.xAxis.pan)
+      root.refreshSeries()
     }
   }
 
@@ -131,6 +158,17 @@ Item {
       onClicked: root.showAreaUnderPlot = !root.showAreaUnderPlot
     }
 
+    ToolButton {
+      width: 24
+      height: 24
+      icon.width: 18
+      icon.height: 18
+      icon.color: "transparent"
+      checked: root.model.envelope
+      icon.source: "qrc:/rcc/icons/dashboard-buttons/envelope.svg"
+      onClicked: root.model.envelope = !root.model.envelope
+    }
+
     Rectangle {
       implicitWidth: 1
       implicitHeight: 24
@@ -0,0 +1,116 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+import QtQuick
+import QtQuick.Layouts
+import QtQuick.Controls
+
+import SerialStudio
+
+import "../"
+
+Item {
+  id: root
+  clip: true
+
+  //
+  // Widget data inputs
+  //
+  required property color color
+  required property ScatterModel model
+  required property MiniWindow windowRoot
+
+  //
+  // Enable/disable features depending on window size
+  //
+  onWidthChanged: updateWidgetOptions()
+  onHeightChanged: updateWidgetOptions()
+  function updateWidgetOptions() {
+    plot.yLabelVisible = (root.width >= 196)
+    plot.xLabelVisible = (root.height >= (196 * 2/3))
+  }
+
+  //
+  // The density image is painted by the C++ model; reparent it over the
+  // plot area so the axes, ranges & grid come from the shared plot widget
+  //
+  onModelChanged: {
+    if (model) {
+      model.visible = true
+      model.parent = plot
+      model.x = Qt.binding(() => plot.graph.x + plot.graph.plotArea.x)
+      model.y = Qt.binding(() => plot.graph.y + plot.graph.plotArea.y)
+      model.width = Qt.binding(() => plot.graph.plotArea.width)
+      model.height = Qt.binding(() => plot.graph.plotArea.height)
+    }
+  }
+
+  //
+  // Plot widget
+  //
+  PlotWidget {
+    id: plot
+
+    anchors {
+      margins: 8
+      fill: parent
+    }
+
+    mouseAreaEnabled: false
+    xMin: root.model.minX
+    xMax: root.model.maxX
+    yMin: root.model.minY
+    yMax: root.model.maxY
+    curveColors: [root.color]
+    yLabel: root.model.yLabel
+    xLabel: root.model.xLabel
+    xAxis.tickInterval: root.model.xTickInterval
+    yAxis.tickInterval: root.model.yTickInterval
+  }
+
+  //
+  // Accumulated sample counter
+  //
+  Label {
+    anchors {
+      margins: 16
+      top: parent.top
+      right: parent.right
+    }
+
+    opacity: 0.8
+    visible: root.model.sampleCount > 0
+    font: Cpp_Misc_CommonFonts.monoFont
+    color: Cpp_ThemeManager.colors["widget_text"]
+    text: qsTr("%1 samples").arg(root.model.sampleCount)
+  }
+
+  //
+  // Placeholder shown until an X-axis source produces data
+  //
+  Label {
+    anchors.centerIn: parent
+    visible: root.model.sampleCount === 0
+    text: qsTr("Waiting for paired samples…")
+    font: Cpp_Misc_CommonFonts.customUiFont(1.2, true)
+    color: Cpp_ThemeManager.colors["widget_text"]
+  }
+}
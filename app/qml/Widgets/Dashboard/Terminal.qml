@@ -110,6 +110,15 @@ Item {
     terminal.selectAll()
   }
 
+  //
+  // Opens the scrollback search bar
+  //
+  function find() {
+    searchBar.visible = true
+    searchField.forceActiveFocus()
+    searchField.selectAll()
+  }
+
   //
   // Shortcuts
   //
@@ -119,6 +128,9 @@ Item {
   } Shortcut {
     onActivated: root.copy()
     sequences: [StandardKey.Copy]
+  } Shortcut {
+    onActivated: root.find()
+    sequences: [StandardKey.Find]
   }
 
   //
@@ -217,6 +229,101 @@ Item {
                      }
                    }
       }
+
+      //
+      // Scrollback search bar
+      //
+      Rectangle {
+        id: searchBar
+        visible: false
+        border.width: 1
+        anchors.margins: 8
+        anchors.top: parent.top
+        anchors.right: parent.right
+        width: searchLayout.implicitWidth + 16
+        height: searchLayout.implicitHeight + 12
+        color: Cpp_ThemeManager.colors["console_base"]
+        border.color: Cpp_ThemeManager.colors["console_border"]
+
+        function close() {
+          searchBar.visible = false
+          searchField.clear()
+          terminal.searchText = ""
+          terminal.forceActiveFocus()
+        }
+
+        RowLayout {
+          id: searchLayout
+          spacing: 4
+          anchors.centerIn: parent
+
+          TextField {
+            id: searchField
+            implicitWidth: 164
+            implicitHeight: 24
+            font: terminal.font
+            placeholderText: qsTr("Find") + "..."
+            palette.base: Cpp_ThemeManager.colors["console_base"]
+            palette.text: Cpp_ThemeManager.colors["console_text"]
+            palette.highlight: Cpp_ThemeManager.colors["console_highlight"]
+            palette.highlightedText: Cpp_ThemeManager.colors["console_text"]
+            palette.placeholderText: Cpp_ThemeManager.colors["placeholder_text"]
+
+            onTextChanged: terminal.searchText = text
+            Keys.onReturnPressed: terminal.findNext()
+            Keys.onEscapePressed: searchBar.close()
+
+            background: Rectangle {
+              border.width: 1
+              color: Cpp_ThemeManager.colors["console_base"]
+              border.color: Cpp_ThemeManager.colors["console_border"]
+            }
+          }
+
+          Label {
+            opacity: 0.7
+            visible: searchField.text.length > 0
+            color: Cpp_ThemeManager.colors["console_text"]
+            text: terminal.searchResultCount > 0
+                  ? qsTr("%1 of %2").arg(terminal.currentSearchResult + 1).arg(terminal.searchResultCount)
+                  : qsTr("No results")
+          }
+
+          Button {
+            icon.width: 18
+            icon.height: 18
+            implicitHeight: 24
+            Layout.maximumWidth: 24
+            opacity: enabled ? 1 : 0.5
+            onClicked: terminal.findPrevious()
+            enabled: terminal.searchResultCount > 0
+            icon.source: "qrc:/rcc/icons/buttons/backward.svg"
+            icon.color: Cpp_ThemeManager.colors["button_text"]
+          }
+
+          Button {
+            icon.width: 18
+            icon.height: 18
+            implicitHeight: 24
+            Layout.maximumWidth: 24
+            opacity: enabled ? 1 : 0.5
+            onClicked: terminal.findNext()
+            enabled: terminal.searchResultCount > 0
+            icon.source: "qrc:/rcc/icons/buttons/forward.svg"
+            icon.color: Cpp_ThemeManager.colors["button_text"]
+          }
+
+          Button {
+            icon.width: 18
+            icon.height: 18
+            implicitHeight: 24
+            Layout.maximumWidth: 24
+            onClicked: searchBar.close()
+            icon.source: "qrc:/rcc/icons/buttons/close.svg"
+            icon.color: Cpp_ThemeManager.colors["button_text"]
+          }
+        }
+      }
     }
 
     //
@@ -41,7 +41,8 @@ Item {
   // Properties used by the C++ window manager to detect where to drag window
   //
   readonly property int captionHeight: root.headerVisible ? 28 : 0
-  readonly property int windowControlsWidth: minBtMa.width + maxBtMa.width + closeBtMa.width
+  readonly property int windowControlsWidth: (rateBt.visible ? rateBtMa.width : 0)
+                                             + minBtMa.width + maxBtMa.width + closeBtMa.width
 
   //
   // Custom properties...to be set by the items that subclass this object
@@ -63,6 +64,34 @@ Item {
   //
   property bool focused: false
 
+  //
+  // Per-window refresh scheduling
+  //
+  // Timer-driven widgets subscribe to refreshTick() instead of the global
+  // 24 Hz clock, so each window only pays for its own refresh rate. The tick
+  // is divided down from the shared 24 Hz timer and stops entirely while the
+  // window is minimized or closed.
+  //
+  property int refreshRate: 24
+  property int refreshTickCount: 0
+  property bool refreshRateControlVisible: false
+  signal refreshTick()
+  onRefreshRateChanged: refreshTickCount = 0
+
+  Connections {
+    target: Cpp_Misc_TimerEvents
+
+    function onTimeout24Hz() {
+      if (!root.enabled || !root.visible)
+        return
+
+      root.refreshTickCount += 1
+      const divisor = Math.max(1, Math.round(24 / Math.max(1, root.refreshRate)))
+      if (root.refreshTickCount % divisor === 0)
+        root.refreshTick()
+    }
+  }
+
   //
   // Caption button signals
   //
@@ -392,6 +421,65 @@ Item {
           implicitWidth: root.captionHeight / 8
         }
 
+        Controls.ToolButton {
+          id: rateBt
+          flat: true
+          background: Item {}
+          icon.color: _title.color
+          onClicked: rateMenu.popup()
+          Layout.alignment: Qt.AlignVCenter
+          icon.width: root.captionHeight / 2
+          icon.height: root.captionHeight / 2
+          visible: root.refreshRateControlVisible
+          icon.source: "qrc:/rcc/icons/miniwindow/refresh-rate.svg"
+
+          Controls.Menu {
+            id: rateMenu
+
+            Controls.ActionGroup {
+              id: rateGroup
+            }
+
+            Controls.Action {
+              checkable: true
+              text: qsTr("24 Hz")
+              Controls.ActionGroup.group: rateGroup
+              checked: root.refreshRate === 24
+              onTriggered: root.refreshRate = 24
+            }
+
+            Controls.Action {
+              checkable: true
+              text: qsTr("12 Hz")
+              Controls.ActionGroup.group: rateGroup
+              checked: root.refreshRate === 12
+              onTriggered: root.refreshRate = 12
+            }
+
+            Controls.Action {
+              checkable: true
+              text: qsTr("6 Hz")
+              Controls.ActionGroup.group: rateGroup
+              checked: root.refreshRate === 6
+              onTriggered: root.refreshRate = 6
+            }
+
+            Controls.Action {
+              checkable: true
+              text: qsTr("1 Hz")
+              Controls.ActionGroup.group: rateGroup
+              checked: root.refreshRate === 1
+              onTriggered: root.refreshRate = 1
+            }
+          }
+
+          MouseArea {
+            id: rateBtMa
+            anchors.fill: parent
+            onClicked: rateMenu.popup()
+          }
+        }
+
         Controls.ToolButton {
           flat: true
           background: Item {}
@@ -49,6 +49,7 @@ Item {
   property bool open: true
   property bool focused: false
   property bool minimized: false
+  readonly property bool hovered: _mouseArea.containsMouse
 
   //
   // Control flags
@@ -99,6 +99,11 @@ Item {
       source: "qrc:/serial-studio.com/gui/qml/Dialogs/FileTransmission.qml"
     }
 
+    DialogLoader {
+      id: diagnosticsDialog
+      source: "qrc:/serial-studio.com/gui/qml/Dialogs/Diagnostics.qml"
+    }
+
     DialogLoader {
       id: licenseDialog
       source: "qrc:/serial-studio.com/gui/qml/Dialogs/LicenseManagement.qml"
@@ -128,6 +133,7 @@ Item {
   function showSettingsDialog()    { settingsDialog.showNormal() }
   function showProjectEditor()     { projectEditor.displayWindow() }
   function showAcknowledgements()  { acknowledgementsDialog.activate() }
+  function showDiagnostics()       { diagnosticsDialog.activate() }
   function showFileTransmission()  { fileTransmissionDialog.activate() }
 
   //
@@ -0,0 +1,246 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QtGlobal>
+
+#include <new>
+#include <mutex>
+#include <vector>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @class AlignedBuffer
+ * @brief 64-byte-aligned, pool-backed storage for numeric series data.
+ *
+ * QVector places its payload at whatever alignment the allocator returns, so
+ * the SIMD kernels run unaligned loads over plot series and every change of
+ * the configured point count reallocates each series from the heap. This
+ * buffer allocates cache-line-aligned blocks instead, and recycles released
+ * blocks through a size-keyed pool: rebuilding the dashboard series (which
+ * happens on every frame-structure change) becomes a pool swap rather than
+ * one heap round trip per series.
+ *
+ * Elements are value-initialized on resize(), matching the QVector behavior
+ * the series setup code relies on. Only trivially copyable element types are
+ * supported, which is all the series storage needs (qreal samples).
+ */
+template<typename T>
+class AlignedBuffer
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "AlignedBuffer only supports trivially copyable types");
+
+public:
+  AlignedBuffer()
+    : m_data(nullptr)
+    , m_size(0)
+  {
+  }
+
+  /**
+   * @brief Deep-copies the elements of another buffer.
+   */
+  AlignedBuffer(const AlignedBuffer &other)
+    : m_data(nullptr)
+    , m_size(0)
+  {
+    resize(other.m_size);
+    if (m_size > 0)
+      std::memcpy(m_data, other.m_data,
+                  static_cast<size_t>(m_size) * sizeof(T));
+  }
+
+  /**
+   * @brief Takes over the storage of another buffer.
+   */
+  AlignedBuffer(AlignedBuffer &&other) noexcept
+    : m_data(other.m_data)
+    , m_size(other.m_size)
+  {
+    other.m_data = nullptr;
+    other.m_size = 0;
+  }
+
+  AlignedBuffer &operator=(const AlignedBuffer &other)
+  {
+    if (this != &other)
+    {
+      resize(other.m_size);
+      if (m_size > 0)
+        std::memcpy(m_data, other.m_data,
+                    static_cast<size_t>(m_size) * sizeof(T));
+    }
+
+    return *this;
+  }
+
+  AlignedBuffer &operator=(AlignedBuffer &&other) noexcept
+  {
+    if (this != &other)
+    {
+      clear();
+      m_data = other.m_data;
+      m_size = other.m_size;
+      other.m_data = nullptr;
+      other.m_size = 0;
+    }
+
+    return *this;
+  }
+
+  ~AlignedBuffer() { clear(); }
+
+  /**
+   * @brief Releases the storage back to the pool.
+   */
+  void clear()
+  {
+    if (m_data)
+      releaseBlock(m_data, static_cast<size_t>(m_size) * sizeof(T));
+
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  /**
+   * @brief No-op, allocations always match the requested size exactly.
+   */
+  void squeeze() {}
+
+  /**
+   * @brief Re-allocates the buffer to the given element count, leaving the
+   *        elements value-initialized.
+   *
+   * Served from the block pool when a block of the requested size was
+   * released earlier (e.g. by a sibling series during a dashboard rebuild).
+   */
+  void resize(const qsizetype count)
+  {
+    if (count == m_size)
+    {
+      if (m_size > 0)
+        std::memset(m_data, 0, static_cast<size_t>(m_size) * sizeof(T));
+
+      return;
+    }
+
+    clear();
+    if (count > 0)
+    {
+      m_data = static_cast<T *>(
+          acquireBlock(static_cast<size_t>(count) * sizeof(T)));
+      m_size = count;
+      std::memset(m_data, 0, static_cast<size_t>(m_size) * sizeof(T));
+    }
+  }
+
+  /**
+   * @brief Returns the number of elements in the buffer.
+   */
+  [[nodiscard]] qsizetype count() const { return m_size; }
+
+  /**
+   * @brief Returns true when the buffer holds no elements.
+   */
+  [[nodiscard]] bool isEmpty() const { return m_size == 0; }
+
+  /**
+   * @brief Provides raw access to the aligned storage.
+   */
+  [[nodiscard]] T *data() { return m_data; }
+
+  /**
+   * @brief Provides read-only access to the aligned storage.
+   */
+  [[nodiscard]] const T *data() const { return m_data; }
+
+  /**
+   * @brief Provides read-only access to the aligned storage.
+   */
+  [[nodiscard]] const T *constData() const { return m_data; }
+
+  T &operator[](const qsizetype index) { return m_data[index]; }
+  const T &operator[](const qsizetype index) const { return m_data[index]; }
+
+private:
+  /**
+   * @brief Obtains a 64-byte-aligned block of the given size.
+   *
+   * Reuses a parked block of exactly the requested size when one is
+   * available, and only falls back to the heap otherwise.
+   */
+  static void *acquireBlock(const size_t bytes)
+  {
+    {
+      std::lock_guard<std::mutex> lock(poolMutex());
+      auto &blocks = pool();
+      for (size_t i = 0; i < blocks.size(); ++i)
+      {
+        if (blocks[i].second == bytes)
+        {
+          void *block = blocks[i].first;
+          blocks.erase(blocks.begin() + i);
+          return block;
+        }
+      }
+    }
+
+    return ::operator new(bytes, std::align_val_t(64));
+  }
+
+  /**
+   * @brief Parks a block in the pool for later reuse.
+   *
+   * The pool is bounded; when it is full the oldest parked block is freed,
+   * which also evicts blocks of stale sizes after the point count changes.
+   */
+  static void releaseBlock(void *block, const size_t bytes)
+  {
+    std::lock_guard<std::mutex> lock(poolMutex());
+    auto &blocks = pool();
+    if (blocks.size() >= 64)
+    {
+      ::operator delete(blocks.front().first, std::align_val_t(64));
+      blocks.erase(blocks.begin());
+    }
+
+    blocks.push_back(std::make_pair(block, bytes));
+  }
+
+  static std::mutex &poolMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  static std::vector<std::pair<void *, size_t>> &pool()
+  {
+    static std::vector<std::pair<void *, size_t>> blocks;
+    return blocks;
+  }
+
+private:
+  T *m_data;
+  qsizetype m_size;
+};
@@ -21,13 +21,23 @@
 
 #include "Export.h"
 
+#include <atomic>
+
 #include <QDir>
 #include <QUrl>
 #include <QFileInfo>
+#include <QDataStream>
 #include <QApplication>
+#include <QDirIterator>
 #include <QStandardPaths>
 #include <QDesktopServices>
 
+#ifdef Q_OS_WIN
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
 #include "AppInfo.h"
 #include "IO/Manager.h"
 #include "CSV/Player.h"
@@ -39,135 +49,328 @@
 #  include "MQTT/Client.h"
 #endif
 
+//------------------------------------------------------------------------------
+// Durability helpers
+//------------------------------------------------------------------------------
+
 /**
- * Constructor function, configures the path in which Serial Studio shall
- * automatically write generated CSV files.
+ * @brief Suffix of the sidecar marker created next to every output file.
+ *
+ * The marker exists exactly while the file can still receive data: it is
+ * created right after the file opens and removed only after the final bytes
+ * reached the platter. A marker found at startup therefore identifies a file
+ * from a crashed session whose tail may be torn, see recoverInterruptedFiles().
  */
-CSV::Export::Export()
-  : m_exportEnabled(true)
+static const QString IncompleteSuffix = QStringLiteral(".incomplete");
+
+/**
+ * @brief Pushes buffered file data all the way to the storage device.
+ *
+ * QFile::flush() only hands the data to the operating system; a power loss
+ * can still discard the OS cache. This helper adds the platform fence
+ * (fsync/_commit) so each batch that was reported as written survives a hard
+ * crash, bounding data loss to the frames buffered since the last flush
+ * interval.
+ */
+static void commitToDisk(QFile &file)
 {
-  m_csvPath = QStringLiteral("%1/%2/CSV")
-                  .arg(QStandardPaths::writableLocation(
-                           QStandardPaths::DocumentsLocation),
-                       APP_NAME);
+  file.flush();
+#ifdef Q_OS_WIN
+  _commit(file.handle());
+#else
+  fsync(file.handle());
+#endif
 }
 
 /**
- * Close file & finnish write-operations before destroying the class.
+ * @brief Truncates a CSV file left by a crashed session to its last full row.
+ *
+ * A crash can interrupt a batch write mid-row; chopping the file after the
+ * last newline leaves a well-formed CSV file, so the capture opens cleanly in
+ * any spreadsheet or in the replay module. The file is scanned backwards in
+ * blocks, only the torn tail is ever read.
  */
-CSV::Export::~Export()
+static void repairCsvFile(const QString &path)
 {
-  closeFile();
+  QFile file(path);
+  if (!file.open(QIODevice::ReadWrite))
+    return;
+
+  // Find the last newline by scanning backwards in blocks
+  constexpr qint64 BlockSize = 4096;
+  qint64 end = file.size();
+  while (end > 0)
+  {
+    const qint64 start = qMax<qint64>(0, end - BlockSize);
+    file.seek(start);
+    const auto block = file.read(end - start);
+    const auto newline = block.lastIndexOf('\n');
+    if (newline >= 0)
+    {
+      file.resize(start + newline + 1);
+      break;
+    }
+
+    end = start;
+  }
+
+  commitToDisk(file);
 }
 
 /**
- * Returns a pointer to the only instance of this class.
+ * @brief Truncates a binary recording (SSB) left by a crashed session to its
+ *        last complete chunk.
+ *
+ * Chunks are self-delimiting (row count plus a length-prefixed compressed
+ * payload), so the repair walks the chunk framing from the header and resizes
+ * the file to the end of the last chunk that deserializes cleanly. A torn
+ * header is left untouched: the file holds no recoverable data and the replay
+ * module rejects it at open time.
  */
-CSV::Export &CSV::Export::instance()
+static void repairBinaryFile(const QString &path)
 {
-  static Export singleton;
-  return singleton;
+  QFile file(path);
+  if (!file.open(QIODevice::ReadWrite))
+    return;
+
+  // Walk the recording header, see ExportWorker::createBinaryFile()
+  QDataStream in(&file);
+  in.setVersion(QDataStream::Qt_6_0);
+  quint32 magic = 0;
+  QString title;
+  quint64 fingerprint = 0;
+  quint32 columnCount = 0;
+  in >> magic;
+  if (magic != 0x53534232)
+    return;
+
+  in >> title >> fingerprint >> columnCount;
+  for (quint32 i = 0; i < columnCount && in.status() == QDataStream::Ok; ++i)
+  {
+    qint32 index;
+    QString columnTitle;
+    in >> index >> columnTitle;
+  }
+
+  // Torn header, nothing to salvage
+  if (in.status() != QDataStream::Ok)
+    return;
+
+  // Walk the chunk framing & remember the end of the last complete chunk
+  qint64 lastCompleteChunk = file.pos();
+  while (!in.atEnd())
+  {
+    quint32 rows;
+    QByteArray chunk;
+    in >> rows >> chunk;
+    if (in.status() != QDataStream::Ok)
+      break;
+
+    lastCompleteChunk = file.pos();
+  }
+
+  file.resize(lastCompleteChunk);
+  commitToDisk(file);
 }
 
+//------------------------------------------------------------------------------
+// CSV::ExportWorker implementation
+//------------------------------------------------------------------------------
+
 /**
- * Returns @c true if the CSV output file is open.
+ * Constructor function, configures the path in which Serial Studio shall
+ * automatically write generated CSV files.
  */
-bool CSV::Export::isOpen() const
+CSV::ExportWorker::ExportWorker()
+  : m_binaryFormat(false)
+  , m_shardByGroup(false)
+  , m_batchQueue(nullptr)
 {
-  return m_csvFile.isOpen();
+  m_csvPath = QStringLiteral("%1/%2/CSV")
+                  .arg(QStandardPaths::writableLocation(
+                           QStandardPaths::DocumentsLocation),
+                       APP_NAME);
 }
 
 /**
- * Returns @c true if CSV export is enabled.
+ * Selects between CSV text output and the columnar binary recording format.
+ * The format of an already open file never changes, @c Export closes the file
+ * before requesting a format switch.
  */
-bool CSV::Export::exportEnabled() const
+void CSV::ExportWorker::setBinaryFormat(bool binary)
 {
-  return m_exportEnabled;
+  m_binaryFormat = binary;
 }
 
 /**
- * Configures the signal/slot connections with the rest of the modules of the
- * application.
+ * Selects between a single CSV file and one file per frame group. Sharding
+ * only applies to CSV text output, the columnar binary recording always uses
+ * a single file. @c Export closes any open output before requesting a mode
+ * switch.
  */
-void CSV::Export::setupExternalConnections()
+void CSV::ExportWorker::setShardByGroup(bool shard)
 {
-  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
-          &Export::closeFile);
-  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged,
-          this, &Export::registerFrame, Qt::QueuedConnection);
-  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
-          &Export::writeValues);
-  connect(&IO::Manager::instance(), &IO::Manager::pausedChanged, this, [=] {
-    if (IO::Manager::instance().paused())
-      closeFile();
-  });
+  m_shardByGroup = shard;
 }
 
 /**
- * Enables or disables data export.
+ * Flushes any buffered row data & closes the CSV file.
  */
-void CSV::Export::setExportEnabled(const bool enabled)
+void CSV::ExportWorker::closeFile()
 {
-  m_exportEnabled = enabled;
-  Q_EMIT enabledChanged();
+  bool wasOpen = false;
 
-  if (!exportEnabled() && isOpen())
+  // Flush & close the single output file, then retire its crash marker:
+  // once the marker is gone the file is known to be complete
+  if (m_csvFile.isOpen())
   {
-    m_frames.clear();
-    m_frames.squeeze();
-    closeFile();
+    if (!m_writeBuffer.isEmpty())
+    {
+      m_csvFile.write(m_writeBuffer);
+      m_writeBuffer.clear();
+    }
+
+    commitToDisk(m_csvFile);
+    m_csvFile.close();
+    QFile::remove(m_csvFile.fileName() + IncompleteSuffix);
+    wasOpen = true;
   }
+
+  // Flush & close every per-group shard file
+  for (const auto &shard : m_shards)
+  {
+    if (shard->file.isOpen())
+    {
+      if (!shard->buffer.isEmpty())
+        shard->file.write(shard->buffer);
+
+      commitToDisk(shard->file);
+      shard->file.close();
+      QFile::remove(shard->file.fileName() + IncompleteSuffix);
+      wasOpen = true;
+    }
+  }
+  m_shards.clear();
+
+  if (wasOpen)
+    Q_EMIT openChanged(false);
 }
 
 /**
- * Write all remaining JSON frames & close the CSV file.
+ * @brief Repairs output files left behind by a crashed session.
+ *
+ * Scans the export directory for the sidecar markers that identify files
+ * which were still open when the application died and completes each one:
+ * CSV text files are truncated to their last full row, binary recordings to
+ * their last complete chunk. Runs once on the writer thread right after it
+ * starts, so a capture directory on a slow disk never delays application
+ * startup.
  */
-void CSV::Export::closeFile()
+void CSV::ExportWorker::recoverInterruptedFiles()
 {
-  if (isOpen())
+  const auto pattern = QStringLiteral("*") + IncompleteSuffix;
+  QDirIterator it(m_csvPath, QStringList() << pattern, QDir::Files,
+                  QDirIterator::Subdirectories);
+  while (it.hasNext())
   {
-    while (!m_frames.isEmpty())
-      writeValues();
+    // Resolve the output file the marker refers to
+    const auto marker = it.next();
+    const auto target = marker.chopped(IncompleteSuffix.length());
 
-    m_csvFile.close();
-    m_textStream.setDevice(nullptr);
+    // Complete the partial file, the torn tail is discarded
+    if (QFile::exists(target))
+    {
+      if (target.endsWith(QStringLiteral(".ssb"), Qt::CaseInsensitive))
+        repairBinaryFile(target);
+      else
+        repairCsvFile(target);
+    }
 
-    Q_EMIT openChanged();
+    // Retire the marker, the file is complete now
+    QFile::remove(marker);
   }
 }
 
 /**
- * @brief Writes frame data to the current CSV file.
+ * @brief Wires the worker to the bounded batch queue owned by Export.
  *
- * This function writes the data from all stored frames (`m_frames`) to the
- * currently open CSV file. It ensures that values in each row are written
- * in the same order as the headers, based on dataset indexes.
+ * Must be called before the worker is moved to its thread.
+ */
+void CSV::ExportWorker::setBatchQueue(
+    Misc::BoundedQueue<QVector<CSV::TimestampFrame>> *queue)
+{
+  m_batchQueue = queue;
+}
+
+/**
+ * @brief Writes every batch queued by Export since the previous wake-up.
+ *
+ * Draining the bounded queue (instead of receiving batches as signal
+ * payloads) keeps the amount of data in flight to this thread bounded: when
+ * the disk blocks long enough for the queue to fill up, the producer blocks
+ * at the next flush instead of growing the event queue without bound.
+ */
+void CSV::ExportWorker::writeQueued()
+{
+  if (!m_batchQueue)
+    return;
+
+  const auto batches = m_batchQueue->popAll();
+  for (const auto &batch : batches)
+    writeFrames(batch);
+}
+
+/**
+ * @brief Writes a batch of frames to the current CSV file.
+ *
+ * This function formats the data from all frames in the batch into a reusable
+ * byte buffer, ensuring that values in each row are written in the same order
+ * as the headers, based on dataset indexes. The whole batch is then written to
+ * the file with a single call, so sustained high frame rates cost one write
+ * operation per flush interval instead of one per row.
  *
  * If the file is not open, it creates the CSV file using the first frame and
  * sets up the headers before writing data. Missing dataset values are replaced
  * with empty strings.
  *
- * After writing, the stream is flushed to ensure the data is saved, and
- * the frame buffer (`m_frames`) is cleared.
+ * @param frames The batch of frames to write.
  */
-void CSV::Export::writeValues()
+void CSV::ExportWorker::writeFrames(const QVector<CSV::TimestampFrame> &frames)
 {
-  // Initialize a list of pairs between indexes & headers
-  static QVector<QPair<int, QString>> indexHeaderPairs;
+  // Nothing to write
+  if (frames.isEmpty())
+    return;
+
+  // Write a columnar chunk instead when binary recording is selected
+  if (m_binaryFormat)
+  {
+    writeBinaryChunk(frames);
+    return;
+  }
+
+  // Write one file per frame group when sharded output is selected
+  if (m_shardByGroup)
+  {
+    writeShardedFrames(frames);
+    return;
+  }
+
+  // Re-use the row buffer allocation from the previous batch
+  m_writeBuffer.clear();
 
   // Write each frame
-  for (auto i = m_frames.begin(); i != m_frames.end(); ++i)
+  for (auto i = frames.begin(); i != frames.end(); ++i)
   {
     // File not open, create it & add cell titles
-    if (!isOpen() && exportEnabled())
+    if (!m_csvFile.isOpen())
     {
-      indexHeaderPairs.clear();
-      indexHeaderPairs.squeeze();
-      indexHeaderPairs = createCsvFile(*i);
+      m_indexHeaderPairs.clear();
+      m_indexHeaderPairs.squeeze();
+      m_indexHeaderPairs = createCsvFile(*i);
     }
 
     // Continue if index/header pairs is not empty
-    if (indexHeaderPairs.isEmpty())
+    if (m_indexHeaderPairs.isEmpty())
       return;
 
     // Obtain frame data
@@ -176,7 +379,8 @@ void CSV::Export::writeValues()
 
     // Write RX date/time
     const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
-    m_textStream << rxTime.toString(format) << QStringLiteral(",");
+    m_writeBuffer.append(rxTime.toString(format).toUtf8());
+    m_writeBuffer.append(',');
 
     // Write frame data in the order of sorted fields
     const auto &groups = data.groups();
@@ -191,26 +395,355 @@ void CSV::Export::writeValues()
     }
 
     // Write data according to the sorted field order
-    for (int j = 0; j < indexHeaderPairs.count(); ++j)
+    for (int j = 0; j < m_indexHeaderPairs.count(); ++j)
     {
       // Print value for current pair
-      const auto fieldIndex = indexHeaderPairs[j].first;
-      m_textStream << fieldValues.value(fieldIndex, QLatin1String(""));
+      const auto fieldIndex = m_indexHeaderPairs[j].first;
+      m_writeBuffer.append(fieldValues.value(fieldIndex, QString()).toUtf8());
 
       // Add comma or newline based on the position in the row
-      if (j < indexHeaderPairs.count() - 1)
-        m_textStream << QStringLiteral(",");
+      if (j < m_indexHeaderPairs.count() - 1)
+        m_writeBuffer.append(',');
       else
-        m_textStream << QStringLiteral("\n");
+        m_writeBuffer.append('\n');
+    }
+  }
+
+  // Write the whole batch with a single call & fence it to the hard disk,
+  // bounding crash data loss to the frames buffered since the last batch
+  if (!m_writeBuffer.isEmpty() && m_csvFile.isOpen())
+  {
+    m_csvFile.write(m_writeBuffer);
+    commitToDisk(m_csvFile);
+    m_writeBuffer.clear();
+  }
+}
+
+/**
+ * @brief Appends a batch of frames to the binary recording as one chunk.
+ *
+ * Transposes the batch into per-dataset columns: chunk data consists of the
+ * frame timestamps followed by one value array per dataset. Columns in which
+ * every value parses as a number are stored as typed double arrays, other
+ * columns fall back to string lists so no data is lost. The serialized chunk
+ * is compressed and written to the file with a single call, so a 48-hour
+ * capture costs a fraction of the disk throughput of the equivalent CSV text.
+ *
+ * @param frames The batch of frames to record.
+ */
+void CSV::ExportWorker::writeBinaryChunk(
+    const QVector<CSV::TimestampFrame> &frames)
+{
+  // Create the recording file from the first frame of the batch
+  if (!m_csvFile.isOpen() && !frames.isEmpty())
+  {
+    m_indexHeaderPairs.clear();
+    m_indexHeaderPairs.squeeze();
+    m_indexHeaderPairs = createBinaryFile(frames.first());
+  }
+
+  // Validate file & column layout
+  if (!m_csvFile.isOpen() || m_indexHeaderPairs.isEmpty())
+    return;
+
+  // Transpose the batch into timestamps & per-dataset columns
+  const int rows = frames.count();
+  QVector<qint64> timestamps;
+  timestamps.reserve(rows);
+  QVector<QStringList> columns(m_indexHeaderPairs.count());
+  for (auto &column : columns)
+    column.reserve(rows);
+
+  // Collect field values for each frame
+  for (auto i = frames.begin(); i != frames.end(); ++i)
+  {
+    timestamps.append(i->rxDateTime.toMSecsSinceEpoch());
+
+    // Iterate through groups and datasets to collect field values
+    QMap<int, QString> fieldValues;
+    const auto &groups = i->data.groups();
+    for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
+    {
+      const auto &datasets = g->datasets();
+      for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+        fieldValues[d->index()] = d->value().simplified();
+    }
+
+    // Store values according to the sorted field order
+    for (int j = 0; j < m_indexHeaderPairs.count(); ++j)
+      columns[j].append(fieldValues.value(m_indexHeaderPairs[j].first,
+                                          QString()));
+  }
+
+  // Serialize the chunk in columnar order
+  QByteArray chunk;
+  QDataStream out(&chunk, QIODevice::WriteOnly);
+  out.setVersion(QDataStream::Qt_6_0);
+  out << timestamps;
+  for (const auto &column : columns)
+  {
+    // Store the column as a typed double array when every value is numeric
+    bool numeric = !column.isEmpty();
+    QVector<double> values;
+    values.reserve(column.count());
+    for (const auto &value : column)
+    {
+      bool ok;
+      values.append(value.toDouble(&ok));
+      if (!ok)
+      {
+        numeric = false;
+        break;
+      }
     }
+
+    // Write column type tag & data
+    if (numeric)
+      out << quint8(0) << values;
+    else
+      out << quint8(1) << column;
+  }
+
+  // Compress the chunk & write it to disk with a single call
+  QByteArray record;
+  QDataStream framing(&record, QIODevice::WriteOnly);
+  framing.setVersion(QDataStream::Qt_6_0);
+  framing << quint32(rows) << qCompress(chunk);
+  m_csvFile.write(record);
+  commitToDisk(m_csvFile);
+}
+
+/**
+ * @brief Writes a batch of frames as one CSV file per frame group.
+ *
+ * Each shard owns its file, header layout and row buffer, so the batch is
+ * distributed over a small thread pool with one task per shard: every task
+ * formats the rows of its group and writes them with a single call, letting
+ * an NVMe disk absorb the shard writes in parallel instead of serializing a
+ * 300-column row through one file. The timestamp column is rendered once and
+ * shared read-only by every task.
+ *
+ * @param frames The batch of frames to write.
+ */
+void CSV::ExportWorker::writeShardedFrames(
+    const QVector<CSV::TimestampFrame> &frames)
+{
+  // Create the per-group files from the first frame of the batch
+  if (m_shards.empty() && !frames.isEmpty())
+  {
+    if (!createShardFiles(frames.first()))
+      return;
   }
 
-  // Flush the stream to writte it to the hard disk
-  m_textStream.flush();
+  // Validate shard layout
+  if (m_shards.empty())
+    return;
+
+  // Render the timestamp column once, all shards repeat the same cells
+  QVector<QByteArray> timestamps;
+  timestamps.reserve(frames.count());
+  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
+  for (auto i = frames.begin(); i != frames.end(); ++i)
+    timestamps.append(i->rxDateTime.toString(format).toUtf8());
+
+  // Formats & writes the batch rows of a single shard
+  auto writeShard = [&frames, &timestamps](GroupShard &shard) {
+    for (int f = 0; f < frames.count(); ++f)
+    {
+      // Group no longer present in the frame, skip the row
+      const auto &groups = frames[f].data.groups();
+      if (shard.groupIndex >= groups.count())
+        continue;
 
-  // Clear frames
-  m_frames.clear();
-  m_frames.squeeze();
+      // Collect the field values of this shard's group
+      QMap<int, QString> fieldValues;
+      const auto &datasets = groups[shard.groupIndex].datasets();
+      for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+        fieldValues[d->index()] = d->value().simplified();
+
+      // Write RX date/time
+      shard.buffer.append(timestamps[f]);
+      shard.buffer.append(',');
+
+      // Write data according to the sorted field order
+      for (int j = 0; j < shard.indexHeaderPairs.count(); ++j)
+      {
+        const auto fieldIndex = shard.indexHeaderPairs[j].first;
+        shard.buffer.append(fieldValues.value(fieldIndex, QString()).toUtf8());
+        if (j < shard.indexHeaderPairs.count() - 1)
+          shard.buffer.append(',');
+        else
+          shard.buffer.append('\n');
+      }
+    }
+
+    // Write the shard's batch with a single call & fence it to the disk
+    if (!shard.buffer.isEmpty() && shard.file.isOpen())
+    {
+      shard.file.write(shard.buffer);
+      commitToDisk(shard.file);
+      shard.buffer.clear();
+    }
+  };
+
+  // Distribute the shard tasks over a small thread pool, each task touches
+  // only its own shard so no synchronization beyond the claim cursor is
+  // needed; this thread participates so one extra thread per claimed core
+  const auto shardCount = static_cast<int>(m_shards.size());
+  const int threads = qMin(shardCount, QThread::idealThreadCount());
+  std::atomic<int> cursor(0);
+  auto work = [&] {
+    while (true)
+    {
+      const int i = cursor.fetch_add(1, std::memory_order_relaxed);
+      if (i >= shardCount)
+        break;
+
+      writeShard(*m_shards[i]);
+    }
+  };
+
+  // Run serially when the pool would not help
+  if (threads < 2)
+    work();
+
+  // Spawn the helper threads & contribute to the work loop
+  else
+  {
+    QVector<QThread *> pool;
+    pool.reserve(threads - 1);
+    for (int i = 0; i < threads - 1; ++i)
+    {
+      auto *thread = QThread::create(work);
+      thread->start();
+      pool.append(thread);
+    }
+
+    work();
+    for (auto *thread : pool)
+    {
+      thread->wait();
+      delete thread;
+    }
+  }
+}
+
+/**
+ * @brief Creates and initializes the per-group CSV files for sharded output.
+ *
+ * Mirrors createCsvFile(): every group of the first frame gets its own file
+ * in the same project-specific directory, named after the capture timestamp
+ * plus the group number and title, with the dataset headers of that group
+ * sorted by index. Groups without datasets are skipped.
+ *
+ * @param frame The frame containing data and timestamp information.
+ * @return True when at least one shard file was created.
+ */
+bool CSV::ExportWorker::createShardFiles(const CSV::TimestampFrame &frame)
+{
+  // Obtain frame data
+  const auto &data = frame.data;
+  const auto &rxTime = frame.rxDateTime;
+
+  // Get base file name
+  const auto baseName = rxTime.toString(QStringLiteral("yyyy_MMM_dd HH_mm_ss"));
+
+  // Get path
+  const QString path = QStringLiteral("%1/%2/").arg(m_csvPath, data.title());
+
+  // Generate file path if required
+  QDir dir(path);
+  if (!dir.exists())
+    dir.mkpath(QStringLiteral("."));
+
+  // Create one shard per group
+  const auto &groups = data.groups();
+  for (int g = 0; g < groups.count(); ++g)
+  {
+    // Collect the group's headers, skipping duplicated dataset indexes
+    QVector<QString> headers;
+    QVector<int> datasetIndexes;
+    const auto &datasets = groups[g].datasets();
+    for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+    {
+      if (!datasetIndexes.contains(d->index()))
+      {
+        datasetIndexes.append(d->index());
+        headers.append(d->title().simplified());
+      }
+    }
+
+    // Skip groups without datasets
+    if (datasetIndexes.isEmpty())
+      continue;
+
+    // Combine fields and headers into pairs for sorting
+    QVector<QPair<int, QString>> fieldHeaderPairs;
+    for (int i = 0; i < datasetIndexes.count(); ++i)
+      fieldHeaderPairs.append(qMakePair(datasetIndexes[i], headers[i]));
+
+    // Sort the pairs based on the field values (first element of the pair)
+    std::sort(fieldHeaderPairs.begin(), fieldHeaderPairs.end(),
+              [](const QPair<int, QString> &a, const QPair<int, QString> &b) {
+                return a.first < b.first;
+              });
+
+    // Sanitize the group title for use in a file name
+    QString title = groups[g].title().simplified();
+    for (const char c : {'/', '\\', ':', '*', '?', '"', '<', '>', '|'})
+      title.replace(QLatin1Char(c), QLatin1Char('_'));
+    if (title.isEmpty())
+      title = tr("Group");
+
+    // Open the shard file, the group number keeps the names unique
+    auto shard = std::make_unique<GroupShard>();
+    shard->groupIndex = g;
+    shard->indexHeaderPairs = fieldHeaderPairs;
+    const auto fileName = QStringLiteral("%1 - %2 %3.csv")
+                              .arg(baseName)
+                              .arg(g + 1, 2, 10, QChar('0'))
+                              .arg(title);
+    shard->file.setFileName(dir.filePath(fileName));
+    if (!shard->file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+      QMetaObject::invokeMethod(qApp, [] {
+        Misc::Utilities::showMessageBox(tr("CSV File Error"),
+                                        tr("Cannot open CSV file for writing!"),
+                                        QMessageBox::Critical);
+      });
+
+      closeFile();
+      return false;
+    }
+
+    // Mark the shard as in-progress until it is closed cleanly
+    QFile marker(shard->file.fileName() + IncompleteSuffix);
+    if (marker.open(QIODevice::WriteOnly))
+      marker.close();
+
+    // Add UTF-8 byte order mark & CSV header from sorted pairs
+    shard->buffer.append("\xEF\xBB\xBF");
+    shard->buffer.append(QStringLiteral("RX Date/Time,").toUtf8());
+    for (int i = 0; i < fieldHeaderPairs.count(); ++i)
+    {
+      shard->buffer.append(fieldHeaderPairs[i].second.toUtf8());
+      if (i < fieldHeaderPairs.count() - 1)
+        shard->buffer.append(',');
+      else
+        shard->buffer.append('\n');
+    }
+
+    // Register the shard
+    m_shards.push_back(std::move(shard));
+  }
+
+  // No group produced a shard, nothing to write
+  if (m_shards.empty())
+    return false;
+
+  // Update UI
+  Q_EMIT openChanged(true);
+  return true;
 }
 
 /**
@@ -227,7 +760,7 @@ void CSV::Export::writeValues()
  * corresponding header string, sorted by the dataset index.
  */
 QVector<QPair<int, QString>>
-CSV::Export::createCsvFile(const CSV::TimestampFrame &frame)
+CSV::ExportWorker::createCsvFile(const CSV::TimestampFrame &frame)
 {
   // Obtain frame data
   const auto &data = frame.data;
@@ -249,22 +782,16 @@ CSV::Export::createCsvFile(const CSV::TimestampFrame &frame)
   m_csvFile.setFileName(dir.filePath(fileName));
   if (!m_csvFile.open(QIODevice::WriteOnly | QIODevice::Text))
   {
-    Misc::Utilities::showMessageBox(tr("CSV File Error"),
-                                    tr("Cannot open CSV file for writing!"),
-                                    QMessageBox::Critical);
+    QMetaObject::invokeMethod(qApp, [] {
+      Misc::Utilities::showMessageBox(tr("CSV File Error"),
+                                      tr("Cannot open CSV file for writing!"),
+                                      QMessageBox::Critical);
+    });
+
     closeFile();
     return QVector<QPair<int, QString>>();
   }
 
-  // Add cell titles & force UTF-8 codec
-  m_textStream.setDevice(&m_csvFile);
-  m_textStream.setGenerateByteOrderMark(true);
-#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-  m_textStream.setCodec("UTF-8");
-#else
-  m_textStream.setEncoding(QStringConverter::Utf8);
-#endif
-
   // Get number of fields by counting datasets with non-duplicated indexes
   QVector<QString> headers;
   QVector<int> datasetIndexes;
@@ -294,29 +821,316 @@ CSV::Export::createCsvFile(const CSV::TimestampFrame &frame)
               return a.first < b.first;
             });
 
-  // Add CSV header directly from sorted pairs
-  m_textStream << QStringLiteral("RX Date/Time,");
+  // Mark the file as in-progress until it is closed cleanly
+  QFile marker(m_csvFile.fileName() + IncompleteSuffix);
+  if (marker.open(QIODevice::WriteOnly))
+    marker.close();
+
+  // Add UTF-8 byte order mark & CSV header from sorted pairs
+  m_writeBuffer.append("\xEF\xBB\xBF");
+  m_writeBuffer.append(QStringLiteral("RX Date/Time,").toUtf8());
   for (int i = 0; i < fieldHeaderPairs.count(); ++i)
   {
-    m_textStream << fieldHeaderPairs[i].second;
+    m_writeBuffer.append(fieldHeaderPairs[i].second.toUtf8());
     if (i < fieldHeaderPairs.count() - 1)
-      m_textStream << QStringLiteral(",");
+      m_writeBuffer.append(',');
     else
-      m_textStream << QStringLiteral("\n");
+      m_writeBuffer.append('\n');
+  }
+
+  // Update UI
+  Q_EMIT openChanged(true);
+  return fieldHeaderPairs;
+}
+
+/**
+ * @brief Creates and initializes a new binary recording file (SSB).
+ *
+ * Mirrors createCsvFile(): the file is placed in the same project-specific
+ * directory with a ".ssb" extension, and the header stores the frame title
+ * plus the dataset indexes and column headers sorted by index. Chunks of
+ * column data are appended by writeBinaryChunk() as batches arrive.
+ *
+ * @param frame The frame containing data and timestamp information.
+ * @return A vector of pairs, each containing a dataset index and its
+ * corresponding header string, sorted by the dataset index.
+ */
+QVector<QPair<int, QString>>
+CSV::ExportWorker::createBinaryFile(const CSV::TimestampFrame &frame)
+{
+  // Obtain frame data
+  const auto &data = frame.data;
+  const auto &rxTime = frame.rxDateTime;
+
+  // Get file name
+  const auto fileName = rxTime.toString(QStringLiteral("yyyy_MMM_dd HH_mm_ss"))
+                        + QStringLiteral(".ssb");
+
+  // Get path
+  const QString path = QStringLiteral("%1/%2/").arg(m_csvPath, data.title());
+
+  // Generate file path if required
+  QDir dir(path);
+  if (!dir.exists())
+    dir.mkpath(QStringLiteral("."));
+
+  // Open file
+  m_csvFile.setFileName(dir.filePath(fileName));
+  if (!m_csvFile.open(QIODevice::WriteOnly))
+  {
+    QMetaObject::invokeMethod(qApp, [] {
+      Misc::Utilities::showMessageBox(
+          tr("CSV File Error"), tr("Cannot open file for writing!"),
+          QMessageBox::Critical);
+    });
+
+    closeFile();
+    return QVector<QPair<int, QString>>();
   }
 
+  // Mark the recording as in-progress until it is closed cleanly
+  QFile marker(m_csvFile.fileName() + IncompleteSuffix);
+  if (marker.open(QIODevice::WriteOnly))
+    marker.close();
+
+  // Describe the dataset layout with the shared schema helper, so the
+  // recording and the replay remap layer agree on the column identities
+  const auto fieldHeaderPairs = SerialStudio::fieldHeaderPairs(data.groups());
+
+  // Write the recording header (magic, title, schema fingerprint & sorted
+  // column headers); the fingerprint lets replays detect at open time that
+  // the project evolved since the capture and build a column remap instead
+  // of silently misassigning datasets
+  QByteArray header;
+  QDataStream out(&header, QIODevice::WriteOnly);
+  out.setVersion(QDataStream::Qt_6_0);
+  out << quint32(0x53534232);
+  out << data.title();
+  out << SerialStudio::schemaFingerprint(data.groups());
+  out << quint32(fieldHeaderPairs.count());
+  for (const auto &pair : fieldHeaderPairs)
+    out << qint32(pair.first) << pair.second;
+  m_csvFile.write(header);
+
   // Update UI
-  Q_EMIT openChanged();
+  Q_EMIT openChanged(true);
   return fieldHeaderPairs;
 }
 
+//------------------------------------------------------------------------------
+// CSV::Export implementation
+//------------------------------------------------------------------------------
+
+/**
+ * Constructor function, starts the dedicated writer thread that consumes the
+ * frame batches produced by this class.
+ */
+CSV::Export::Export()
+  : m_fileOpen(false)
+  , m_binaryFormat(false)
+  , m_shardByGroup(false)
+  , m_exportEnabled(true)
+  , m_batchQueue(8, Misc::BoundedQueue<QVector<TimestampFrame>>::Policy::Block)
+{
+  // Start the dedicated CSV writer thread
+  qRegisterMetaType<QVector<CSV::TimestampFrame>>();
+  m_worker = new ExportWorker();
+  m_worker->setBatchQueue(&m_batchQueue);
+  m_worker->moveToThread(&m_workerThread);
+  m_workerThread.start();
+
+  // Complete any output file left torn by a crashed session
+  QMetaObject::invokeMethod(m_worker, &ExportWorker::recoverInterruptedFiles,
+                            Qt::QueuedConnection);
+
+  // Hand frame batches & close requests to the writer thread
+  connect(this, &Export::writeRequested, m_worker, &ExportWorker::writeQueued,
+          Qt::QueuedConnection);
+  connect(this, &Export::closeRequested, m_worker, &ExportWorker::closeFile,
+          Qt::QueuedConnection);
+  connect(this, &Export::formatRequested, m_worker,
+          &ExportWorker::setBinaryFormat, Qt::QueuedConnection);
+  connect(this, &Export::shardingRequested, m_worker,
+          &ExportWorker::setShardByGroup, Qt::QueuedConnection);
+
+  // Mirror the file state of the writer thread
+  connect(
+      m_worker, &ExportWorker::openChanged, this,
+      [=](bool open) {
+        m_fileOpen = open;
+        Q_EMIT openChanged();
+      },
+      Qt::QueuedConnection);
+}
+
+/**
+ * Close file & finnish write-operations before destroying the class.
+ */
+CSV::Export::~Export()
+{
+  // Hand the last batch to the writer & wait until the file is closed, the
+  // blocking call is queued after the pending batch and therefore processed
+  // once every row has been written
+  writeValues();
+  QMetaObject::invokeMethod(m_worker, &ExportWorker::closeFile,
+                            Qt::BlockingQueuedConnection);
+
+  m_workerThread.quit();
+  m_workerThread.wait();
+
+  delete m_worker;
+  m_worker = nullptr;
+}
+
+/**
+ * Returns a pointer to the only instance of this class.
+ */
+CSV::Export &CSV::Export::instance()
+{
+  static Export singleton;
+  return singleton;
+}
+
+/**
+ * Returns @c true if the CSV output file is open.
+ */
+bool CSV::Export::isOpen() const
+{
+  return m_fileOpen;
+}
+
+/**
+ * Returns @c true if frames are recorded in the columnar binary format (SSB)
+ * instead of CSV text.
+ */
+bool CSV::Export::binaryFormat() const
+{
+  return m_binaryFormat;
+}
+
+/**
+ * Returns @c true if CSV text output is split into one file per frame group.
+ */
+bool CSV::Export::shardByGroup() const
+{
+  return m_shardByGroup;
+}
+
+/**
+ * Returns @c true if CSV export is enabled.
+ */
+bool CSV::Export::exportEnabled() const
+{
+  return m_exportEnabled;
+}
+
+/**
+ * Configures the signal/slot connections with the rest of the modules of the
+ * application.
+ */
+void CSV::Export::setupExternalConnections()
+{
+  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
+          &Export::closeFile);
+  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged,
+          this, &Export::registerFrame, Qt::QueuedConnection);
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &Export::writeValues);
+  connect(&IO::Manager::instance(), &IO::Manager::pausedChanged, this, [=] {
+    if (IO::Manager::instance().paused())
+      closeFile();
+  });
+}
+
+/**
+ * Selects between CSV text output and the columnar binary recording format.
+ * Any open file is flushed & closed first, so a recording never mixes the
+ * two formats.
+ */
+void CSV::Export::setBinaryFormat(const bool binary)
+{
+  if (m_binaryFormat != binary)
+  {
+    closeFile();
+    m_binaryFormat = binary;
+    Q_EMIT formatRequested(binary);
+    Q_EMIT formatChanged();
+  }
+}
+
+/**
+ * Selects between a single CSV file and one file per frame group. Any open
+ * output is flushed & closed first, so a recording never mixes the two
+ * layouts. Sharding only affects CSV text output, the columnar binary
+ * recording always uses a single file.
+ */
+void CSV::Export::setShardByGroup(const bool shard)
+{
+  if (m_shardByGroup != shard)
+  {
+    closeFile();
+    m_shardByGroup = shard;
+    Q_EMIT shardingRequested(shard);
+    Q_EMIT shardingChanged();
+  }
+}
+
+/**
+ * Enables or disables data export.
+ */
+void CSV::Export::setExportEnabled(const bool enabled)
+{
+  m_exportEnabled = enabled;
+  Q_EMIT enabledChanged();
+
+  if (!exportEnabled())
+  {
+    m_frames.clear();
+    m_frames.squeeze();
+    closeFile();
+  }
+}
+
+/**
+ * Hand any remaining frames to the writer thread & ask it to close the CSV
+ * file. The queued requests are processed in order, so the pending batch is
+ * always written before the file is closed.
+ */
+void CSV::Export::closeFile()
+{
+  writeValues();
+  Q_EMIT closeRequested();
+}
+
+/**
+ * @brief Hands the buffered frames to the writer thread.
+ *
+ * Swaps the frame buffer filled by registerFrame() with an empty one and
+ * pushes the batch into the bounded handoff queue consumed by the writer
+ * thread. In steady state the push is a constant-time operation, so a
+ * briefly blocking disk never stalls frame ingestion on this thread. Export
+ * is a lossless consumer, so when the writer falls behind long enough to
+ * fill the queue, this thread deliberately blocks until a slot frees up —
+ * bounding the data in flight instead of dropping rows.
+ */
+void CSV::Export::writeValues()
+{
+  if (m_frames.isEmpty())
+    return;
+
+  QVector<TimestampFrame> batch;
+  batch.swap(m_frames);
+  m_batchQueue.push(std::move(batch));
+  Q_EMIT writeRequested();
+}
+
 /**
  * Appends the latest frame from the device to the output buffer.
  */
-void CSV::Export::registerFrame(const JSON::Frame &frame)
+void CSV::Export::registerFrame(const std::shared_ptr<JSON::Frame> &frame)
 {
   // Ignore if CSV export is disabled
-  if (!exportEnabled())
+  if (!exportEnabled() || !frame)
     return;
 
   // Don't generate a CSV file when we are playing a CSV file
@@ -324,7 +1138,7 @@ void CSV::Export::registerFrame(const JSON::Frame &frame)
     return;
 
   // Ignore if frame is invalid
-  if (!frame.isValid())
+  if (!frame->isValid())
     return;
 
   // Don't save CSV data when the device/service is not connected
@@ -338,9 +1152,13 @@ void CSV::Export::registerFrame(const JSON::Frame &frame)
     return;
 #endif
 
-  // Register raw frame to list
+  // Register raw frame to list, preferring the capture timestamp recorded
+  // at the driver boundary over the (queue-delayed) registration time
   TimestampFrame tframe;
-  tframe.data = frame;
-  tframe.rxDateTime = QDateTime::currentDateTime();
+  tframe.data = *frame;
+  if (frame->rxTimestamp() != 0)
+    tframe.rxDateTime = QDateTime::fromMSecsSinceEpoch(frame->rxTimestamp());
+  else
+    tframe.rxDateTime = QDateTime::currentDateTime();
   m_frames.append(tframe);
 }
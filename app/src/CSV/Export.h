@@ -21,15 +21,19 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include <QFile>
 #include <QVector>
 #include <QObject>
+#include <QThread>
 #include <QVariant>
 #include <QDateTime>
-#include <QTextStream>
 #include <QJsonObject>
 
 #include "JSON/Frame.h"
+#include "Misc/BoundedQueue.h"
 
 namespace CSV
 {
@@ -39,10 +43,11 @@ namespace CSV
  * The CSV export class receives data from the @c IO::Manager class and
  * exports the received frames into a CSV file selected by the user.
  *
- * CSV-data is generated periodically each time the @c Misc::TimerEvents
- * low-frequency timer expires (e.g. every 1 second). The idea behind this
- * is to allow exporting data, but avoid freezing the application when serial
- * data is received continuously.
+ * Incoming frames are buffered on the GUI thread and handed to a dedicated
+ * writer thread in batches each time the @c Misc::TimerEvents low-frequency
+ * timer expires (e.g. every 1 second). The idea behind this is to allow
+ * exporting data, but avoid freezing the application when serial data is
+ * received continuously or when the disk is slow to respond.
  */
 typedef struct
 {
@@ -50,6 +55,75 @@ typedef struct
   QDateTime rxDateTime;
 } TimestampFrame;
 
+/**
+ * @brief Background CSV writer for the Export module.
+ *
+ * Lives in a dedicated thread and owns the output file: it receives frame
+ * batches from @c Export, formats every row into a reusable byte buffer and
+ * writes the whole batch with a single call to the file. A network filesystem
+ * that blocks for seconds therefore stalls this thread only, while the GUI
+ * thread keeps buffering frames for the next batch.
+ *
+ * Besides CSV text, the worker can write a compact columnar recording (SSB):
+ * each batch becomes a compressed chunk holding the timestamps and one value
+ * array per dataset, with numeric columns stored as typed double arrays.
+ */
+class ExportWorker : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void openChanged(bool open);
+
+public:
+  explicit ExportWorker();
+
+public:
+  void setBatchQueue(Misc::BoundedQueue<QVector<CSV::TimestampFrame>> *queue);
+
+public slots:
+  void closeFile();
+  void writeQueued();
+  void setBinaryFormat(bool binary);
+  void setShardByGroup(bool shard);
+  void recoverInterruptedFiles();
+  void writeFrames(const QVector<CSV::TimestampFrame> &frames);
+
+private:
+  /**
+   * @brief Per-group writer context used by the sharded CSV output mode.
+   *
+   * Each shard owns its file, header layout and a reusable row buffer, so a
+   * batch can be formatted & written by several threads without sharing any
+   * mutable state between groups.
+   */
+  struct GroupShard
+  {
+    int groupIndex;
+    QFile file;
+    QByteArray buffer;
+    QVector<QPair<int, QString>> indexHeaderPairs;
+  };
+
+private:
+  void writeBinaryChunk(const QVector<CSV::TimestampFrame> &frames);
+  void writeShardedFrames(const QVector<CSV::TimestampFrame> &frames);
+  bool createShardFiles(const CSV::TimestampFrame &frame);
+  QVector<QPair<int, QString>> createCsvFile(const CSV::TimestampFrame &frame);
+  QVector<QPair<int, QString>>
+  createBinaryFile(const CSV::TimestampFrame &frame);
+
+private:
+  QFile m_csvFile;
+  QString m_csvPath;
+  bool m_binaryFormat;
+  bool m_shardByGroup;
+  QByteArray m_writeBuffer;
+  QVector<QPair<int, QString>> m_indexHeaderPairs;
+  std::vector<std::unique_ptr<GroupShard>> m_shards;
+  Misc::BoundedQueue<QVector<CSV::TimestampFrame>> *m_batchQueue;
+};
+
 class Export : public QObject
 {
   // clang-format off
@@ -61,11 +135,25 @@ class Export : public QObject
              READ exportEnabled
              WRITE setExportEnabled
              NOTIFY enabledChanged)
+  Q_PROPERTY(bool binaryFormat
+             READ binaryFormat
+             WRITE setBinaryFormat
+             NOTIFY formatChanged)
+  Q_PROPERTY(bool shardByGroup
+             READ shardByGroup
+             WRITE setShardByGroup
+             NOTIFY shardingChanged)
   // clang-format on
 
 signals:
   void openChanged();
+  void formatChanged();
   void enabledChanged();
+  void closeRequested();
+  void shardingChanged();
+  void formatRequested(bool binary);
+  void shardingRequested(bool shard);
+  void writeRequested();
 
 private:
   explicit Export();
@@ -80,25 +168,32 @@ public:
   static Export &instance();
 
   [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] bool binaryFormat() const;
+  [[nodiscard]] bool shardByGroup() const;
   [[nodiscard]] bool exportEnabled() const;
 
 public slots:
   void closeFile();
   void setupExternalConnections();
+  void setBinaryFormat(const bool binary);
+  void setShardByGroup(const bool shard);
   void setExportEnabled(const bool enabled);
 
 private slots:
   void writeValues();
-  void registerFrame(const JSON::Frame &frame);
-
-private:
-  QVector<QPair<int, QString>> createCsvFile(const CSV::TimestampFrame &frame);
+  void registerFrame(const std::shared_ptr<JSON::Frame> &frame);
 
 private:
-  QFile m_csvFile;
-  QString m_csvPath;
+  bool m_fileOpen;
+  bool m_binaryFormat;
+  bool m_shardByGroup;
   bool m_exportEnabled;
-  QTextStream m_textStream;
+
+  QThread m_workerThread;
+  ExportWorker *m_worker;
   QVector<TimestampFrame> m_frames;
+  Misc::BoundedQueue<QVector<TimestampFrame>> m_batchQueue;
 };
 } // namespace CSV
+
+Q_DECLARE_METATYPE(CSV::TimestampFrame)
@@ -21,8 +21,12 @@
 
 #include "Player.h"
 
+#include <memory>
+#include <cstring>
+
 #include <QtMath>
 #include <QTimer>
+#include <QDataStream>
 #include <QFileDialog>
 #include <QInputDialog>
 #include <QApplication>
@@ -30,8 +34,25 @@
 
 #include "AppInfo.h"
 #include "IO/Manager.h"
+#include "SIMD/SIMD.h"
 #include "UI/Dashboard.h"
 #include "Misc/Utilities.h"
+#include "JSON/FrameBuilder.h"
+
+/**
+ * @brief Interval of the coarse playback tick in milliseconds.
+ *
+ * Every tick dispatches all frames whose timestamp became due since the
+ * previous tick, so the tick rate only bounds display latency - not the
+ * replay rate. Scheduling one timer per frame instead would make timer
+ * jitter the bottleneck for recordings with millisecond frame spacing.
+ */
+static constexpr int PlaybackTickMs = 16;
+
+/**
+ * @brief Number of rows the read-ahead pass parses per batch.
+ */
+static constexpr int ReadAheadRows = 256;
 
 /**
  * Constructor function
@@ -40,10 +61,25 @@ CSV::Player::Player()
   : m_framePos(0)
   , m_playing(false)
   , m_timestamp("")
+  , m_mapData(nullptr)
+  , m_mapSize(0)
+  , m_cachedRow(-1)
+  , m_cacheReady(false)
+  , m_cacheThread(nullptr)
+  , m_cacheAbort(false)
+  , m_playbackOrigin(0)
+  , m_readAheadStart(-1)
+  , m_readAheadThread(nullptr)
 {
   qApp->installEventFilter(this);
   connect(this, &CSV::Player::playerStateChanged, this,
           &CSV::Player::updateData);
+
+  // Configure the coarse playback tick (see onPlaybackTick)
+  m_playbackTimer.setInterval(PlaybackTickMs);
+  m_playbackTimer.setTimerType(Qt::PreciseTimer);
+  connect(&m_playbackTimer, &QTimer::timeout, this,
+          &CSV::Player::onPlaybackTick);
 }
 
 /**
@@ -87,6 +123,9 @@ bool CSV::Player::isPlaying() const
  */
 int CSV::Player::frameCount() const
 {
+  if (usingMappedFile())
+    return m_rowOffsets.count();
+
   return m_csvData.count();
 }
 
@@ -149,6 +188,16 @@ void CSV::Player::play()
   if (m_framePos >= frameCount() - 1)
     m_framePos = 0;
 
+  // Anchor the CSV timeline to the wall clock & start the coarse tick
+  const auto current = getDateTime(m_framePos);
+  if (current.isValid())
+  {
+    m_playbackOrigin = current.toMSecsSinceEpoch();
+    m_playbackClock.restart();
+    m_playbackTimer.start();
+    scheduleReadAhead();
+  }
+
   m_playing = true;
   Q_EMIT playerStateChanged();
 }
@@ -160,6 +209,7 @@ void CSV::Player::play()
 void CSV::Player::pause()
 {
   m_playing = false;
+  m_playbackTimer.stop();
   Q_EMIT playerStateChanged();
 }
 
@@ -182,7 +232,8 @@ void CSV::Player::openFile()
   // Get file name
   auto file = QFileDialog::getOpenFileName(
       nullptr, tr("Select CSV file"), csvFilesPath(),
-      tr("CSV files") + QStringLiteral(" (*.csv)"));
+      tr("CSV files") + QStringLiteral(" (*.csv)") + QStringLiteral(";;")
+          + tr("Serial Studio recordings") + QStringLiteral(" (*.ssb)"));
 
   // Open CSV file
   if (!file.isEmpty())
@@ -195,6 +246,52 @@ void CSV::Player::openFile()
  */
 void CSV::Player::closeFile()
 {
+  // Stop the playback tick
+  m_playbackTimer.stop();
+
+  // Stop the background cache pass before releasing the mapping it reads
+  if (m_cacheThread)
+  {
+    m_cacheAbort = true;
+    m_cacheThread->wait();
+    m_cacheThread->deleteLater();
+    m_cacheThread = nullptr;
+  }
+
+  // Stop the read-ahead pass before releasing the mapping it reads
+  if (m_readAheadThread)
+  {
+    m_cacheAbort = true;
+    m_readAheadThread->wait();
+    m_readAheadThread->deleteLater();
+    m_readAheadThread = nullptr;
+  }
+
+  // Discard the pre-parsed payload window
+  m_readAheadStart = -1;
+  m_readAhead.clear();
+  m_readAhead.squeeze();
+
+  // Discard the typed row cache
+  m_cacheReady = false;
+  m_cleanRows.clear();
+  m_cleanRows.squeeze();
+  m_timeCache.clear();
+  m_timeCache.squeeze();
+
+  // Release the file mapping & row index
+  if (m_mapData)
+  {
+    m_csvFile.unmap(m_mapData);
+    m_mapData = nullptr;
+  }
+
+  m_mapSize = 0;
+  m_cachedRow = -1;
+  m_rowOffsets.clear();
+  m_rowOffsets.squeeze();
+  m_cachedRowData.clear();
+
   m_framePos = 0;
   m_csvFile.close();
   m_csvData.clear();
@@ -308,34 +405,42 @@ void CSV::Player::openFile(const QString &filePath)
   m_csvFile.setFileName(filePath);
   if (m_csvFile.open(QIODevice::ReadOnly))
   {
-    // Read CSV file into string matrix
-    QTextStream in(&m_csvFile);
-    while (!in.atEnd())
+    // Decode binary recordings (SSB) into the same string matrix
+    if (filePath.endsWith(QStringLiteral(".ssb"), Qt::CaseInsensitive))
     {
-      // Read a line and split it into a list of items
-      QStringList row = in.readLine().split(',');
-
-      // Remove surrounding quotes and trim whitespace from each item
-      for (auto &item : row)
+      if (!readBinaryRecording())
       {
-        item = item.simplified();
-        item.remove(QStringLiteral("\""));
+        Misc::Utilities::showMessageBox(
+            tr("Cannot read recording file"),
+            tr("The file is not a valid Serial Studio recording"),
+            QMessageBox::Critical);
+        closeFile();
+        return;
       }
-
-      // Filter out rows that are empty or contain only empty items
-      bool isRowValid
-          = !row.isEmpty()
-            && std::any_of(row.cbegin(), row.cend(),
-                           [](const QString &item) { return !item.isEmpty(); });
-
-      // Only register valid rows
-      if (isRowValid)
-        m_csvData.append(row);
     }
 
+    // Memory-map the CSV file & build the row index, falling back to an
+    // in-memory load when mapping is not possible
+    else if (!mapCsvFile())
+      loadCsvRows();
+
     // Validate the cell at (1,1) for date/time format
     if (!getDateTime(1).isValid())
     {
+      // Generating or converting date/time data rewrites every row, so we
+      // must load the file into memory before prompting the user
+      if (usingMappedFile())
+      {
+        m_csvFile.unmap(m_mapData);
+        m_mapData = nullptr;
+        m_mapSize = 0;
+        m_cachedRow = -1;
+        m_rowOffsets.clear();
+        m_rowOffsets.squeeze();
+        m_cachedRowData.clear();
+        loadCsvRows();
+      }
+
       // Ask user to select date/time column or set interval manually
       if (!promptUserForDateTimeOrInterval())
       {
@@ -346,10 +451,17 @@ void CSV::Player::openFile(const QString &filePath)
 
     // Remove the header row from the data
     m_framePos = 0;
-    m_csvData.removeFirst();
+    if (usingMappedFile())
+      m_rowOffsets.removeFirst();
+    else
+      m_csvData.removeFirst();
+
+    // Pre-parse timestamps & payload layout in the background
+    if (usingMappedFile())
+      buildRowCache();
 
     // Begin reading data
-    if (m_csvData.count() >= 2)
+    if (frameCount() >= 2)
     {
       updateData();
       Q_EMIT openChanged();
@@ -377,6 +489,472 @@ void CSV::Player::openFile(const QString &filePath)
   }
 }
 
+/**
+ * @brief Memory-maps the open CSV file & builds the row-offset index.
+ *
+ * Maps the whole file into the address space and records the byte offset of
+ * every non-empty line with a sequential newline scan. Rows are parsed lazily
+ * on demand by rowData(), so opening a multi-gigabyte capture costs one pass
+ * over the mapping instead of materializing a string matrix, and memory usage
+ * stays constant during playback.
+ *
+ * @return @c true if the file was mapped and contains at least one row.
+ */
+bool CSV::Player::mapCsvFile()
+{
+  // Try to map the whole file
+  m_mapSize = m_csvFile.size();
+  if (m_mapSize <= 0)
+    return false;
+
+  m_mapData = m_csvFile.map(0, m_mapSize);
+  if (!m_mapData)
+    return false;
+
+  // Size the index with a vectorized newline count
+  const auto *data = reinterpret_cast<const char *>(m_mapData);
+  m_rowOffsets.reserve(SIMD::countByte(data, m_mapSize, '\n') + 1);
+
+  // Record the start offset of every non-empty line
+  qint64 pos = 0;
+  while (pos < m_mapSize)
+  {
+    const auto *nl = static_cast<const char *>(
+        std::memchr(data + pos, '\n', m_mapSize - pos));
+    const qint64 end = nl ? (nl - data) : m_mapSize;
+
+    qint64 length = end - pos;
+    if (length > 0 && data[end - 1] == '\r')
+      --length;
+    if (length > 0)
+      m_rowOffsets.append(pos);
+
+    pos = end + 1;
+  }
+
+  // Release the mapping when the file holds no usable rows
+  if (m_rowOffsets.isEmpty())
+  {
+    m_csvFile.unmap(m_mapData);
+    m_mapData = nullptr;
+    m_mapSize = 0;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Reads the open CSV file into the in-memory string matrix.
+ *
+ * Fallback path for files that cannot be memory-mapped and for workflows
+ * that rewrite rows (e.g. generating date/time data), which require the
+ * mutable matrix.
+ */
+void CSV::Player::loadCsvRows()
+{
+  // Read CSV file into string matrix
+  m_csvFile.seek(0);
+  QTextStream in(&m_csvFile);
+  while (!in.atEnd())
+  {
+    // Read a line and split it into a list of items
+    QStringList row = in.readLine().split(',');
+
+    // Remove surrounding quotes and trim whitespace from each item
+    for (auto &item : row)
+    {
+      item = item.simplified();
+      item.remove(QStringLiteral("\""));
+    }
+
+    // Filter out rows that are empty or contain only empty items
+    bool isRowValid
+        = !row.isEmpty()
+          && std::any_of(row.cbegin(), row.cend(),
+                         [](const QString &item) { return !item.isEmpty(); });
+
+    // Only register valid rows
+    if (isRowValid)
+      m_csvData.append(row);
+  }
+}
+
+/**
+ * @brief Pre-parses the mapped rows into a typed cache on background threads.
+ *
+ * Splits the row index into contiguous chunks, one per processor core, and
+ * parses each chunk on its own thread: the date/time cell of every row is
+ * converted once into milliseconds since the epoch, and rows whose payload
+ * needs no sanitizing (no quotes or whitespace) are flagged so getFrame()
+ * can slice them straight out of the mapping. Once every chunk is done the
+ * results are swapped in on this thread, and playback switches from string
+ * parsing to cache lookups; until then the row-parsing path keeps working.
+ *
+ * Worker threads only read the mapping and the row index, and closeFile()
+ * waits for them before releasing either, so the pass can be safely
+ * abandoned when the user closes the file early.
+ */
+void CSV::Player::buildRowCache()
+{
+  // Allocate the shared result buffers
+  const int rows = m_rowOffsets.count();
+  auto times = std::make_shared<QVector<qint64>>(rows, -1);
+  auto clean = std::make_shared<QVector<bool>>(rows, false);
+
+  // Capture read-only views of the mapping & row index
+  const qint64 mapSize = m_mapSize;
+  const auto offsets = m_rowOffsets;
+  const auto *data = reinterpret_cast<const char *>(m_mapData);
+
+  // Reset cache state
+  m_cacheReady = false;
+  m_cacheAbort = false;
+
+  // Parse chunks of rows on one thread per processor core
+  m_cacheThread = QThread::create([=] {
+    // Parses the rows in the range [begin, end)
+    const auto parseRange = [=](int begin, int end) {
+      for (int r = begin; r < end && !m_cacheAbort; ++r)
+      {
+        // Locate the row in the mapping
+        const qint64 start = offsets[r];
+        const auto *nl = static_cast<const char *>(
+            std::memchr(data + start, '\n', mapSize - start));
+        qint64 length = (nl ? (nl - data) : mapSize) - start;
+        if (length > 0 && data[start + length - 1] == '\r')
+          --length;
+
+        // Parse the date/time cell into milliseconds since the epoch
+        const auto *comma = static_cast<const char *>(
+            std::memchr(data + start, ',', length));
+        const qint64 cellLen = comma ? (comma - (data + start)) : length;
+        const auto dateTime
+            = getDateTime(QString::fromUtf8(data + start, cellLen));
+        if (dateTime.isValid())
+          (*times)[r] = dateTime.toMSecsSinceEpoch();
+
+        // Flag payloads that can be sliced without sanitizing
+        if (comma)
+        {
+          const auto *payload = comma + 1;
+          const qint64 payloadLen = length - cellLen - 1;
+          (*clean)[r] = !std::memchr(payload, '"', payloadLen)
+                        && !std::memchr(payload, ' ', payloadLen)
+                        && !std::memchr(payload, '\t', payloadLen);
+        }
+      }
+    };
+
+    // Split the rows into one contiguous chunk per core
+    const int threads = qBound(1, QThread::idealThreadCount(), rows);
+    const int chunk = (rows + threads - 1) / threads;
+    QVector<QThread *> workers;
+    workers.reserve(threads);
+    for (int t = 0; t < threads; ++t)
+    {
+      const int begin = t * chunk;
+      const int end = qMin(rows, begin + chunk);
+      workers.append(QThread::create([=] { parseRange(begin, end); }));
+      workers.last()->start();
+    }
+
+    // Wait for every chunk to finish
+    for (auto *worker : workers)
+    {
+      worker->wait();
+      delete worker;
+    }
+  });
+
+  // Swap the finished cache in on this thread
+  auto *thread = m_cacheThread;
+  connect(thread, &QThread::finished, this, [=] {
+    if (thread != m_cacheThread)
+      return;
+
+    m_cacheThread->deleteLater();
+    m_cacheThread = nullptr;
+
+    if (!m_cacheAbort)
+    {
+      m_timeCache = *times;
+      m_cleanRows = *clean;
+      m_cacheReady = true;
+    }
+  });
+
+  // Begin the background pass
+  m_cacheThread->start();
+}
+
+/**
+ * Returns @c true when playback reads rows lazily from the mapped file
+ * instead of the in-memory string matrix.
+ */
+bool CSV::Player::usingMappedFile() const
+{
+  return m_mapData != nullptr;
+}
+
+/**
+ * @brief Returns the parsed cells of the given @a row.
+ *
+ * In mapped mode the row is located through the offset index and parsed on
+ * demand; the most recently parsed row is cached, because the playback logic
+ * reads the same row several times (timestamp, frame data, seek interval)
+ * before moving on. Otherwise the row comes straight from the string matrix.
+ *
+ * @param row The index of the row to retrieve.
+ * @return The parsed row, or an empty list when the index is out of range.
+ */
+const QStringList &CSV::Player::rowData(const int row) const
+{
+  static const QStringList empty;
+
+  // In-memory mode, return the stored row
+  if (!usingMappedFile())
+  {
+    if (row >= 0 && row < m_csvData.count())
+      return m_csvData[row];
+
+    return empty;
+  }
+
+  // Validate row index
+  if (row < 0 || row >= m_rowOffsets.count())
+    return empty;
+
+  // Re-use the previously parsed row when possible
+  if (row == m_cachedRow)
+    return m_cachedRowData;
+
+  // Locate the row in the mapping
+  const auto *data = reinterpret_cast<const char *>(m_mapData);
+  const qint64 start = m_rowOffsets[row];
+  const auto *nl = static_cast<const char *>(
+      std::memchr(data + start, '\n', m_mapSize - start));
+  qint64 length = (nl ? (nl - data) : m_mapSize) - start;
+  if (length > 0 && data[start + length - 1] == '\r')
+    --length;
+
+  // Parse & sanitize the row like the in-memory loader does
+  QStringList cells
+      = QString::fromUtf8(data + start, length).split(QLatin1Char(','));
+  for (auto &item : cells)
+  {
+    item = item.simplified();
+    item.remove(QStringLiteral("\""));
+  }
+
+  // Cache the parsed row
+  m_cachedRow = row;
+  m_cachedRowData = cells;
+  return m_cachedRowData;
+}
+
+/**
+ * @brief Decodes a columnar binary recording (SSB) into the string matrix.
+ *
+ * Reads the recording header written by @c CSV::ExportWorker and expands
+ * every compressed column chunk back into rows: timestamps become the
+ * "RX Date/Time" column using the standard date/time format, typed double
+ * columns are converted back to strings and text columns are copied as-is.
+ * The resulting matrix is identical in shape to a parsed CSV file, so the
+ * rest of the playback logic works unchanged.
+ *
+ * Recordings outlive project edits, so the capture schema is compared
+ * against the loaded project at open time: when the embedded fingerprint
+ * (or, for older recordings, the column layout itself) no longer matches, a
+ * column translation table is built once and every decoded row is reordered
+ * into the field order the current project expects. Columns are matched by
+ * group/dataset header first and by dataset index second; fields without a
+ * counterpart in the capture replay as empty values instead of silently
+ * receiving another dataset's data.
+ *
+ * @return @c true if the whole file was decoded successfully.
+ */
+bool CSV::Player::readBinaryRecording()
+{
+  // Configure the input stream
+  QDataStream in(&m_csvFile);
+  in.setVersion(QDataStream::Qt_6_0);
+
+  // Validate the file magic (version 2 embeds a schema fingerprint)
+  quint32 magic = 0;
+  in >> magic;
+  if (magic != 0x53534231 && magic != 0x53534232)
+    return false;
+
+  // Read frame title, schema fingerprint & column headers
+  QString title;
+  quint64 fingerprint = 0;
+  quint32 columnCount = 0;
+  in >> title;
+  if (magic == 0x53534232)
+    in >> fingerprint;
+  in >> columnCount;
+  QStringList captureHeaders;
+  QVector<qint32> captureIndexes;
+  for (quint32 i = 0; i < columnCount; ++i)
+  {
+    qint32 index;
+    QString columnTitle;
+    in >> index >> columnTitle;
+    captureIndexes.append(index);
+    captureHeaders.append(columnTitle);
+  }
+
+  // Validate header
+  if (in.status() != QDataStream::Ok || columnCount == 0)
+    return false;
+
+  // Compare the capture schema against the loaded project and build the
+  // column translation table once when they diverged; an empty table means
+  // the capture layout can be replayed as-is
+  QVector<int> sourceColumn;
+  QStringList header;
+  header.append(QStringLiteral("RX Date/Time"));
+  const auto &builder = JSON::FrameBuilder::instance();
+  if (builder.operationMode() == SerialStudio::ProjectFile)
+  {
+    const auto &groups = builder.frame().groups();
+    const auto current = SerialStudio::fieldHeaderPairs(groups);
+
+    // Fast path: matching fingerprints guarantee an identical layout
+    bool identical
+        = magic == 0x53534232
+          && fingerprint == SerialStudio::schemaFingerprint(groups);
+
+    // Older recordings (or a stale fingerprint) compare structurally
+    if (!identical && current.count() == static_cast<int>(columnCount))
+    {
+      identical = true;
+      for (int i = 0; i < current.count() && identical; ++i)
+        identical = current[i].first == captureIndexes[i]
+                    && current[i].second == captureHeaders[i];
+    }
+
+    // Resolve each current field to a capture column, by header title
+    // first (survives channel renumbering) and dataset index second
+    // (survives renames)
+    if (!identical && !current.isEmpty())
+    {
+      sourceColumn.resize(current.count());
+      for (int i = 0; i < current.count(); ++i)
+      {
+        int match = captureHeaders.indexOf(current[i].second);
+        if (match < 0)
+          match = captureIndexes.indexOf(current[i].first);
+
+        sourceColumn[i] = match;
+      }
+
+      for (const auto &pair : current)
+        header.append(pair.second);
+    }
+  }
+
+  // No remap required, replay the capture's own column layout
+  if (sourceColumn.isEmpty())
+    header.append(captureHeaders);
+
+  // Register the header as the first row
+  m_csvData.append(header);
+
+  // Expand every column chunk back into rows
+  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
+  while (!in.atEnd())
+  {
+    // Read chunk framing & decompress the column data
+    quint32 rows = 0;
+    QByteArray packed;
+    in >> rows >> packed;
+    const auto chunk = qUncompress(packed);
+    if (in.status() != QDataStream::Ok || chunk.isEmpty() || rows == 0)
+      return false;
+
+    // Start each row with the formatted timestamp
+    QDataStream columns(chunk);
+    columns.setVersion(QDataStream::Qt_6_0);
+    QVector<qint64> timestamps;
+    columns >> timestamps;
+    if (timestamps.count() != static_cast<int>(rows))
+      return false;
+
+    const int rowWidth
+        = sourceColumn.isEmpty() ? columnCount : sourceColumn.count();
+    QList<QStringList> matrix;
+    matrix.reserve(rows);
+    for (quint32 r = 0; r < rows; ++r)
+    {
+      QStringList row;
+      row.reserve(rowWidth + 1);
+      row.append(QDateTime::fromMSecsSinceEpoch(timestamps[r]).toString(format));
+      matrix.append(row);
+    }
+
+    // Decode each capture column into a string list
+    QVector<QStringList> decoded(columnCount);
+    for (quint32 c = 0; c < columnCount; ++c)
+    {
+      quint8 type = 0;
+      columns >> type;
+
+      // Typed double array
+      if (type == 0)
+      {
+        QVector<double> values;
+        columns >> values;
+        if (values.count() != static_cast<int>(rows))
+          return false;
+
+        decoded[c].reserve(rows);
+        for (quint32 r = 0; r < rows; ++r)
+          decoded[c].append(QString::number(values[r], 'g', 12));
+      }
+
+      // Text column
+      else
+      {
+        columns >> decoded[c];
+        if (decoded[c].count() != static_cast<int>(rows))
+          return false;
+      }
+    }
+
+    // Append the column values in the capture's own order
+    if (sourceColumn.isEmpty())
+    {
+      for (quint32 r = 0; r < rows; ++r)
+        for (quint32 c = 0; c < columnCount; ++c)
+          matrix[r].append(decoded[c][r]);
+    }
+
+    // Reorder the columns through the translation table, fields without a
+    // counterpart in the capture replay as empty values
+    else
+    {
+      for (quint32 r = 0; r < rows; ++r)
+      {
+        for (int i = 0; i < sourceColumn.count(); ++i)
+        {
+          const int c = sourceColumn[i];
+          matrix[r].append(c >= 0 ? decoded[c][r] : QString());
+        }
+      }
+    }
+
+    // Validate chunk & register the decoded rows
+    if (columns.status() != QDataStream::Ok)
+      return false;
+
+    m_csvData.append(matrix);
+  }
+
+  return true;
+}
+
 /**
  * @brief Adjusts the playback position in the CSV data based on a normalized
  *        progress value.
@@ -449,9 +1027,8 @@ void CSV::Player::setProgress(const qreal progress)
  * Generates a JSON data frame by combining the values of the current CSV
  * row & the structure of the JSON map file loaded in the @c JsonParser class.
  *
- * If playback is enabled, this function calculates the difference in
- * milliseconds between the current row and the next row & schedules a re-call
- * of this function using a timer.
+ * During playback the frame pacing is handled by onPlaybackTick(), this
+ * function only refreshes the displayed frame & timestamp.
  */
 void CSV::Player::updateData()
 {
@@ -468,47 +1045,171 @@ void CSV::Player::updateData()
     IO::Manager::instance().processPayload(getFrame(framePosition()));
     Q_EMIT timestampChanged();
   }
+}
+
+/**
+ * @brief Dispatches every frame that became due since the previous tick.
+ *
+ * Instead of scheduling one single-shot timer per frame - where timer jitter
+ * dominates recordings with millisecond frame spacing - playback wakes at a
+ * coarse fixed interval, maps the elapsed wall-clock time onto the CSV
+ * timeline and pushes all frames due in that window through the frame
+ * builder at once. The timestamp display updates once per tick rather than
+ * once per frame, and the read-ahead pass is topped up so the next window's
+ * payloads are already parsed when their tick arrives.
+ */
+void CSV::Player::onPlaybackTick()
+{
+  // Playback stopped, halt the tick
+  if (!isOpen() || !isPlaying())
+  {
+    m_playbackTimer.stop();
+    return;
+  }
 
-  // If the user wants to 'play' the CSV, get time difference between this
-  // frame and the next frame & schedule an automated update
-  if (!error && isPlaying())
+  // Map the elapsed wall-clock time onto the CSV timeline
+  const qint64 target = m_playbackOrigin + m_playbackClock.elapsed();
+
+  // Dispatch every frame due in this window
+  bool dispatched = false;
+  while (framePosition() < frameCount() - 1)
   {
-    // Get first frame
-    if (framePosition() < frameCount() - 1)
+    const auto next = getDateTime(framePosition() + 1);
+    if (!next.isValid())
     {
-      // Obtain time for current & next frame
-      auto currTime = getDateTime(framePosition());
-      auto nextTime = getDateTime(framePosition() + 1);
+      pause();
+      qWarning() << "Error getting timestamp for row" << framePosition() + 1;
+      return;
+    }
+
+    if (next.toMSecsSinceEpoch() > target)
+      break;
+
+    ++m_framePos;
+    IO::Manager::instance().processPayload(getFrame(framePosition()));
+    dispatched = true;
+  }
+
+  // Refresh the timestamp display once per tick & top up the read-ahead
+  if (dispatched)
+  {
+    bool error = true;
+    const auto timestamp = getCellValue(framePosition(), 0, error);
+    if (!error)
+    {
+      m_timestamp = timestamp;
+      Q_EMIT timestampChanged();
+    }
+
+    scheduleReadAhead();
+  }
+
+  // Pause at end of CSV
+  if (framePosition() >= frameCount() - 1)
+    pause();
+}
+
+/**
+ * @brief Pre-parses the payloads of the upcoming rows on a helper thread.
+ *
+ * Rows in the next playback window are converted into ready-to-dispatch
+ * payload buffers off-thread, using the same slicing & sanitizing rules as
+ * getFrame(), and swapped in on this thread once the batch is complete. The
+ * pass only runs in mapped mode (the in-memory matrix is already parsed) and
+ * is topped up whenever less than half a batch of pre-parsed rows remains.
+ */
+void CSV::Player::scheduleReadAhead()
+{
+  // Previous pass still running, or nothing to read ahead from
+  if (m_readAheadThread || !usingMappedFile())
+    return;
 
-      // No error, calculate difference & schedule update
-      if (currTime.isValid() && nextTime.isValid())
+  // Enough pre-parsed rows remain for the upcoming ticks
+  const int start = framePosition() + 1;
+  const int cachedEnd
+      = m_readAheadStart < 0 ? -1 : m_readAheadStart + m_readAhead.count();
+  if (cachedEnd - start > ReadAheadRows / 2)
+    return;
+
+  // Clamp the window to the end of the recording
+  const int end = qMin(frameCount(), start + ReadAheadRows);
+  if (start >= end)
+    return;
+
+  // Capture read-only views of the mapping, row index & clean-row flags
+  const qint64 mapSize = m_mapSize;
+  const auto offsets = m_rowOffsets;
+  const auto clean = m_cacheReady ? m_cleanRows : QVector<bool>();
+  const auto *data = reinterpret_cast<const char *>(m_mapData);
+
+  // Parse the window on a helper thread
+  auto rows = std::make_shared<QVector<QByteArray>>();
+  rows->reserve(end - start);
+  m_readAheadThread = QThread::create([=] {
+    for (int r = start; r < end && !m_cacheAbort; ++r)
+    {
+      // Locate the row in the mapping
+      const qint64 rowStart = offsets[r];
+      const auto *nl = static_cast<const char *>(
+          std::memchr(data + rowStart, '\n', mapSize - rowStart));
+      qint64 length = (nl ? (nl - data) : mapSize) - rowStart;
+      if (length > 0 && data[rowStart + length - 1] == '\r')
+        --length;
+
+      // Clean payloads are sliced straight out of the mapping
+      QByteArray frame;
+      const auto *comma = static_cast<const char *>(
+          std::memchr(data + rowStart, ',', length));
+      if (comma && r < clean.count() && clean[r])
       {
-        // Obtain millis between the two frames
-        const auto msecsToNextF = abs(currTime.msecsTo(nextTime));
-
-        // Jump to next frame
-        QTimer::singleShot(msecsToNextF, Qt::PreciseTimer, this, [=] {
-          if (isOpen() && isPlaying() && framePosition() < frameCount())
-          {
-            ++m_framePos;
-            updateData();
-          }
-        });
+        const auto *payload = comma + 1;
+        frame = QByteArray(payload, length - (payload - (data + rowStart)));
+        frame.append('\n');
       }
 
-      // Error - pause playback
+      // Everything else goes through the same sanitizing as rowData()
       else
       {
-        pause();
-        qWarning() << "Error getting timestamp difference" << currTime
-                   << nextTime;
+        QStringList cells = QString::fromUtf8(data + rowStart, length)
+                                .split(QLatin1Char(','));
+        for (auto &item : cells)
+        {
+          item = item.simplified();
+          item.remove(QStringLiteral("\""));
+        }
+
+        for (int i = 1; i < cells.count(); ++i)
+        {
+          frame.append(cells[i].toUtf8());
+          if (i < cells.count() - 1)
+            frame.append(',');
+          else
+            frame.append('\n');
+        }
       }
+
+      rows->append(frame);
     }
+  });
 
-    // Pause at end of CSV
-    else
-      pause();
-  }
+  // Swap the finished window in on this thread
+  auto *thread = m_readAheadThread;
+  connect(thread, &QThread::finished, this, [=] {
+    if (thread != m_readAheadThread)
+      return;
+
+    m_readAheadThread->deleteLater();
+    m_readAheadThread = nullptr;
+
+    if (!m_cacheAbort && rows->count() == end - start)
+    {
+      m_readAhead = *rows;
+      m_readAheadStart = start;
+    }
+  });
+
+  // Begin the background pass
+  m_readAheadThread->start();
 }
 
 /**
@@ -663,6 +1364,16 @@ void CSV::Player::convertColumnToDateTime(int columnIndex)
  */
 QDateTime CSV::Player::getDateTime(const int row)
 {
+  // Serve pre-parsed timestamps from the typed cache
+  if (usingMappedFile() && m_cacheReady && row >= 0
+      && row < m_timeCache.count())
+  {
+    if (m_timeCache[row] >= 0)
+      return QDateTime::fromMSecsSinceEpoch(m_timeCache[row]);
+
+    return QDateTime();
+  }
+
   bool error;
   auto value = getCellValue(row, 0, error);
 
@@ -723,19 +1434,45 @@ QByteArray CSV::Player::getFrame(const int row)
 {
   QByteArray frame;
 
-  if (m_csvData.count() > row)
+  // Serve payloads pre-parsed by the read-ahead pass
+  if (m_readAheadStart >= 0 && row >= m_readAheadStart
+      && row < m_readAheadStart + m_readAhead.count())
+    return m_readAhead.at(row - m_readAheadStart);
+
+  // Slice clean payloads straight out of the mapping, skipping the
+  // string-parsing round trip entirely
+  if (usingMappedFile() && m_cacheReady && row >= 0
+      && row < m_cleanRows.count() && m_cleanRows[row])
   {
-    const auto &list = m_csvData[row];
-    for (int i = 1; i < list.count(); ++i)
+    const auto *data = reinterpret_cast<const char *>(m_mapData);
+    const qint64 start = m_rowOffsets[row];
+    const auto *nl = static_cast<const char *>(
+        std::memchr(data + start, '\n', m_mapSize - start));
+    qint64 length = (nl ? (nl - data) : m_mapSize) - start;
+    if (length > 0 && data[start + length - 1] == '\r')
+      --length;
+
+    const auto *comma = static_cast<const char *>(
+        std::memchr(data + start, ',', length));
+    if (comma)
     {
-      frame.append(list[i].toUtf8());
-      if (i < list.count() - 1)
-        frame.append(',');
-      else
-        frame.append('\n');
+      const auto *payload = comma + 1;
+      frame = QByteArray(payload, length - (payload - (data + start)));
+      frame.append('\n');
+      return frame;
     }
   }
 
+  const auto &list = rowData(row);
+  for (int i = 1; i < list.count(); ++i)
+  {
+    frame.append(list[i].toUtf8());
+    if (i < list.count() - 1)
+      frame.append(',');
+    else
+      frame.append('\n');
+  }
+
   return frame;
 }
 
@@ -749,14 +1486,11 @@ const QString CSV::Player::getCellValue(const int row, const int column,
 {
   static auto defaultValue = QLatin1String("");
 
-  if (m_csvData.count() > row)
+  const auto &list = rowData(row);
+  if (list.count() > column)
   {
-    const auto &list = m_csvData[row];
-    if (list.count() > column)
-    {
-      error = false;
-      return list[column];
-    }
+    error = false;
+    return list[column];
   }
 
   error = true;
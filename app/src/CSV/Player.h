@@ -21,10 +21,15 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <QFile>
+#include <QTimer>
 #include <QObject>
+#include <QThread>
 #include <QVector>
 #include <QKeyEvent>
+#include <QElapsedTimer>
 
 namespace CSV
 {
@@ -96,8 +101,16 @@ public slots:
 
 private slots:
   void updateData();
+  void onPlaybackTick();
+
+private:
+  void scheduleReadAhead();
 
 private:
+  bool mapCsvFile();
+  void loadCsvRows();
+  void buildRowCache();
+  bool readBinaryRecording();
   bool promptUserForDateTimeOrInterval();
   void generateDateTimeForRows(int interval);
   void convertColumnToDateTime(int columnIndex);
@@ -107,6 +120,9 @@ private:
 
   QByteArray getFrame(const int row);
 
+  [[nodiscard]] bool usingMappedFile() const;
+  const QStringList &rowData(const int row) const;
+
   const QString getCellValue(const int row, const int column, bool &error);
 
 protected:
@@ -119,5 +135,26 @@ private:
   QFile m_csvFile;
   QString m_timestamp;
   QList<QStringList> m_csvData;
+
+  uchar *m_mapData;
+  qint64 m_mapSize;
+  QVector<qint64> m_rowOffsets;
+
+  mutable int m_cachedRow;
+  mutable QStringList m_cachedRowData;
+
+  bool m_cacheReady;
+  QThread *m_cacheThread;
+  QVector<bool> m_cleanRows;
+  QVector<qint64> m_timeCache;
+  std::atomic_bool m_cacheAbort;
+
+  QTimer m_playbackTimer;
+  qint64 m_playbackOrigin;
+  QElapsedTimer m_playbackClock;
+
+  int m_readAheadStart;
+  QThread *m_readAheadThread;
+  QVector<QByteArray> m_readAhead;
 };
 } // namespace CSV
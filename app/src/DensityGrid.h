@@ -0,0 +1,218 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @class DensityGrid
+ * @brief Streaming 2D density histogram with bounded memory.
+ *
+ * Correlated (x, y) sample pairs are folded into a fixed-resolution grid of
+ * hit counters covering the observed value range, so any number of samples
+ * can be summarized as a density image whose rendering cost depends only on
+ * the grid resolution, never on the run length.
+ *
+ * The covered range grows with the data: when a sample lands outside the
+ * current bounds, the violated sides are extended past the sample and the
+ * accumulated counters are remapped into the enlarged grid by bin center.
+ * Each expansion overshoots by a fraction of the new span, so the number of
+ * remaps stays logarithmic in the total dynamic range of the stream and
+ * both insertion and memory remain O(1) with respect to the sample count.
+ */
+class DensityGrid
+{
+public:
+  /**
+   * @brief Number of bins along each axis of the grid.
+   */
+  static constexpr int GridSize = 128;
+
+  /**
+   * @brief Constructs an empty grid.
+   */
+  DensityGrid() { clear(); }
+
+  /**
+   * @brief Discards every accumulated sample.
+   */
+  void clear()
+  {
+    m_count = 0;
+    m_maxBin = 0;
+    m_minX = 0;
+    m_maxX = 0;
+    m_minY = 0;
+    m_maxY = 0;
+    m_bins.clear();
+  }
+
+  /**
+   * @brief Returns the total number of inserted sample pairs.
+   */
+  [[nodiscard]] quint64 count() const { return m_count; }
+
+  /**
+   * @brief Returns the hit count of the most populated bin.
+   */
+  [[nodiscard]] quint32 maxBinCount() const { return m_maxBin; }
+
+  /**
+   * @brief Returns the lower X bound of the covered range (0 when empty).
+   */
+  [[nodiscard]] double minX() const { return m_minX; }
+
+  /**
+   * @brief Returns the upper X bound of the covered range (0 when empty).
+   */
+  [[nodiscard]] double maxX() const { return m_maxX; }
+
+  /**
+   * @brief Returns the lower Y bound of the covered range (0 when empty).
+   */
+  [[nodiscard]] double minY() const { return m_minY; }
+
+  /**
+   * @brief Returns the upper Y bound of the covered range (0 when empty).
+   */
+  [[nodiscard]] double maxY() const { return m_maxY; }
+
+  /**
+   * @brief Returns the bin counters in row-major order (y * GridSize + x),
+   *        with row 0 holding the lowest Y values. Empty until the first
+   *        sample arrives.
+   */
+  [[nodiscard]] const QVector<quint32> &bins() const { return m_bins; }
+
+  /**
+   * @brief Folds one correlated sample pair into the grid.
+   * @param x Sample value along the horizontal axis.
+   * @param y Sample value along the vertical axis.
+   */
+  void insert(const double x, const double y)
+  {
+    if (std::isnan(x) || std::isinf(x) || std::isnan(y) || std::isinf(y))
+      return;
+
+    // Allocate the counters lazily on the first sample
+    if (m_bins.isEmpty())
+    {
+      m_bins.resize(GridSize * GridSize);
+      m_minX = x;
+      m_maxX = x;
+      m_minY = y;
+      m_maxY = y;
+    }
+
+    // Enlarge the covered range (remapping the counters) when the sample
+    // falls outside of it
+    else if (x < m_minX || x > m_maxX || y < m_minY || y > m_maxY)
+      expand(x, y);
+
+    // Increment the bin under the sample
+    auto &bin = m_bins[binIndex(m_minY, m_maxY, y) * GridSize
+                       + binIndex(m_minX, m_maxX, x)];
+    ++bin;
+    ++m_count;
+    m_maxBin = std::max(m_maxBin, bin);
+  }
+
+private:
+  /**
+   * @brief Maps a value to its bin along one axis of the current range.
+   */
+  [[nodiscard]] static int binIndex(const double lo, const double hi,
+                                    const double value)
+  {
+    if (hi <= lo)
+      return 0;
+
+    const auto bin = static_cast<int>((value - lo) / (hi - lo) * GridSize);
+    return std::clamp(bin, 0, GridSize - 1);
+  }
+
+  /**
+   * @brief Grows the covered range past the given sample & remaps the
+   *        accumulated counters into the enlarged grid by bin center.
+   */
+  void expand(const double x, const double y)
+  {
+    // Extend every violated side past the sample by a quarter of the new
+    // span, so a slowly drifting stream cannot force a remap per sample
+    double minX = std::min(m_minX, x);
+    double maxX = std::max(m_maxX, x);
+    double minY = std::min(m_minY, y);
+    double maxY = std::max(m_maxY, y);
+    const double padX = std::max((maxX - minX) * 0.25, 1e-12);
+    const double padY = std::max((maxY - minY) * 0.25, 1e-12);
+    if (x < m_minX)
+      minX -= padX;
+    if (x > m_maxX)
+      maxX += padX;
+    if (y < m_minY)
+      minY -= padY;
+    if (y > m_maxY)
+      maxY += padY;
+
+    // Re-accumulate the populated bins into the enlarged grid
+    QVector<quint32> bins(GridSize * GridSize);
+    quint32 maxBin = 0;
+    for (int row = 0; row < GridSize; ++row)
+    {
+      for (int col = 0; col < GridSize; ++col)
+      {
+        const auto count = m_bins[row * GridSize + col];
+        if (count == 0)
+          continue;
+
+        const double cx = m_minX + (m_maxX - m_minX) * (col + 0.5) / GridSize;
+        const double cy = m_minY + (m_maxY - m_minY) * (row + 0.5) / GridSize;
+        auto &bin = bins[binIndex(minY, maxY, cy) * GridSize
+                         + binIndex(minX, maxX, cx)];
+        bin += count;
+        maxBin = std::max(maxBin, bin);
+      }
+    }
+
+    m_bins = bins;
+    m_maxBin = maxBin;
+    m_minX = minX;
+    m_maxX = maxX;
+    m_minY = minY;
+    m_maxY = maxY;
+  }
+
+private:
+  quint64 m_count;
+  quint32 m_maxBin;
+
+  double m_minX;
+  double m_maxX;
+  double m_minY;
+  double m_maxY;
+
+  QVector<quint32> m_bins;
+};
@@ -0,0 +1,183 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QtCore>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace IO
+{
+/**
+ * @brief Pool of fixed-size receive blocks shared across driver reads.
+ *
+ * Drivers allocate a fresh QByteArray for every read, which causes allocator
+ * contention between the I/O worker and the GUI thread during steady-state
+ * ingest. This pool hands out preallocated blocks and recycles them once the
+ * downstream consumers (frame reader, console, plugins) have dropped their
+ * implicit-sharing references.
+ *
+ * A released block may still be referenced by a queued signal payload, so
+ * blocks are parked in the pool and only handed out again once
+ * QByteArray::isDetached() reports that the block is unique. In steady state
+ * the consumers drain faster than the producers read, so reads are served
+ * from recycled blocks and the heap is never touched.
+ *
+ * Hit/miss counters are kept so the pool effectiveness can be inspected at
+ * runtime.
+ */
+class BufferPool
+{
+public:
+  /**
+   * @brief Constructs a BufferPool object.
+   *
+   * @param blockSize The size of each receive block in bytes.
+   * @param maxBlocks The maximum number of blocks parked in the pool.
+   */
+  explicit BufferPool(qsizetype blockSize = 64 * 1024, int maxBlocks = 64)
+    : m_blockSize(blockSize)
+    , m_maxBlocks(maxBlocks)
+    , m_hits(0)
+    , m_misses(0)
+  {
+    m_blocks.reserve(maxBlocks);
+  }
+
+  /**
+   * @brief Returns the size (in bytes) of the blocks managed by the pool.
+   */
+  [[nodiscard]] qsizetype blockSize() const { return m_blockSize; }
+
+  /**
+   * @brief Obtains a receive block of blockSize() bytes.
+   *
+   * Reuses a parked block when one is no longer referenced by downstream
+   * consumers, and only falls back to a heap allocation when every parked
+   * block is still in flight.
+   *
+   * @return A QByteArray of exactly blockSize() bytes.
+   */
+  [[nodiscard]] QByteArray acquire()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for (size_t i = 0; i < m_blocks.size(); ++i)
+      {
+        if (m_blocks[i].isDetached())
+        {
+          QByteArray block = std::move(m_blocks[i]);
+          m_blocks.erase(m_blocks.begin() + i);
+          m_hits.fetch_add(1, std::memory_order_relaxed);
+          block.resize(m_blockSize);
+          return block;
+        }
+      }
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return QByteArray(m_blockSize, Qt::Uninitialized);
+  }
+
+  /**
+   * @brief Returns a block to the pool for later reuse.
+   *
+   * The block may still be referenced by queued signal payloads, it is only
+   * handed out again once all other references have been dropped. Blocks are
+   * discarded when the pool is full or the block lost its capacity.
+   *
+   * @param block The block to recycle.
+   */
+  void release(QByteArray &&block)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (static_cast<int>(m_blocks.size()) < m_maxBlocks
+        && block.capacity() >= m_blockSize)
+      m_blocks.push_back(std::move(block));
+  }
+
+  /**
+   * @brief Releases every parked block that is no longer referenced.
+   *
+   * Called from the idle-time compaction pass: while the link is quiet the
+   * parked blocks are pure slack, and the pool refills on demand once
+   * traffic resumes. Blocks still referenced by in-flight signal payloads
+   * are left alone.
+   *
+   * @return The number of bytes returned to the heap.
+   */
+  qsizetype trim()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    qsizetype freed = 0;
+    for (size_t i = m_blocks.size(); i-- > 0;)
+    {
+      if (m_blocks[i].isDetached())
+      {
+        freed += m_blocks[i].capacity();
+        m_blocks.erase(m_blocks.begin() + i);
+      }
+    }
+
+    return freed;
+  }
+
+  /**
+   * @brief Number of acquisitions served from recycled blocks.
+   */
+  [[nodiscard]] quint64 poolHits() const
+  {
+    return m_hits.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Number of acquisitions that fell back to a heap allocation.
+   */
+  [[nodiscard]] quint64 poolMisses() const
+  {
+    return m_misses.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Fraction of acquisitions served from the pool, in [0, 1].
+   */
+  [[nodiscard]] double hitRate() const
+  {
+    const quint64 hits = poolHits();
+    const quint64 total = hits + poolMisses();
+    return total > 0 ? static_cast<double>(hits) / total : 0.0;
+  }
+
+private:
+  qsizetype m_blockSize;
+  int m_maxBlocks;
+  std::vector<QByteArray> m_blocks;
+
+  std::atomic<quint64> m_hits;
+  std::atomic<quint64> m_misses;
+
+  mutable std::mutex m_mutex;
+};
+} // namespace IO
@@ -0,0 +1,297 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/CaptureRecorder.h"
+
+#include <cstring>
+
+#include <QDir>
+#include <QDateTime>
+#include <QApplication>
+#include <QStandardPaths>
+
+#include "AppInfo.h"
+#include "IO/Manager.h"
+#include "Misc/Utilities.h"
+
+/**
+ * @brief Size by which the mapped window of a segment grows.
+ *
+ * Each growth step resizes the file and remaps it, which is the only
+ * operation that touches file metadata; appends in between are plain
+ * memcpy() calls into the mapping.
+ */
+static constexpr qsizetype CaptureChunkSize = 16 * 1024 * 1024;
+
+/**
+ * @brief Size at which a capture segment rotates into a new file.
+ */
+static constexpr qsizetype CaptureSegmentSize = 256 * 1024 * 1024;
+
+/**
+ * Constructor function, configures the path in which Serial Studio shall
+ * write the raw capture files.
+ */
+IO::CaptureRecorder::CaptureRecorder()
+  : m_mapped(nullptr)
+  , m_offset(0)
+  , m_mappedSize(0)
+  , m_segmentIndex(0)
+  , m_captureEnabled(false)
+{
+  m_basePath = QStringLiteral("%1/%2/Captures")
+                   .arg(QStandardPaths::writableLocation(
+                            QStandardPaths::DocumentsLocation),
+                        APP_NAME);
+}
+
+/**
+ * Destructor function, closes the capture file before the application quits.
+ */
+IO::CaptureRecorder::~CaptureRecorder()
+{
+  closeFile();
+}
+
+/**
+ * Returns a pointer to the only instance of this class.
+ */
+IO::CaptureRecorder &IO::CaptureRecorder::instance()
+{
+  static CaptureRecorder singleton;
+  return singleton;
+}
+
+/**
+ * Returns @c true if a capture segment is currently open.
+ */
+bool IO::CaptureRecorder::isOpen() const
+{
+  return m_file.isOpen();
+}
+
+/**
+ * Returns @c true if raw capture recording is enabled for this session.
+ */
+bool IO::CaptureRecorder::captureEnabled() const
+{
+  return m_captureEnabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Appends raw bytes to the capture file.
+ *
+ * Called by drivers straight after the device read, on whichever thread the
+ * device lives in. The bytes are copied exactly once into the memory-mapped
+ * segment window; the window is grown (and the segment rotated) as needed.
+ * When recording is disabled the call is a single relaxed atomic load.
+ *
+ * @param data Pointer to the bytes to record.
+ * @param len The number of bytes to record.
+ */
+void IO::CaptureRecorder::write(const char *data, qsizetype len)
+{
+  // Recording disabled or nothing to store
+  if (!captureEnabled() || len <= 0)
+    return;
+
+  QMutexLocker locker(&m_mutex);
+
+  // Rotate the segment once it reaches the size limit
+  if (m_file.isOpen() && m_offset >= CaptureSegmentSize)
+    closeSegment();
+
+  // Open a segment lazily on the first write of the session
+  if (!m_file.isOpen())
+  {
+    openSegment();
+    if (!m_file.isOpen())
+      return;
+  }
+
+  // Grow the mapped window until the payload fits
+  if (m_offset + len > m_mappedSize && !growMapping(m_offset + len))
+    return;
+
+  // Append the bytes to the mapping
+  std::memcpy(m_mapped + m_offset, data, len);
+  m_offset += len;
+}
+
+/**
+ * @brief Closes the current capture segment & ends the capture session.
+ *
+ * The open segment is truncated to the bytes actually written, so the file
+ * can be replayed through the file replay driver without trailing zeros.
+ * The next session starts over with a fresh timestamped file set.
+ */
+void IO::CaptureRecorder::closeFile()
+{
+  QMutexLocker locker(&m_mutex);
+
+  const bool wasOpen = m_file.isOpen();
+  closeSegment();
+  m_segmentIndex = 0;
+  m_sessionName.clear();
+
+  if (wasOpen)
+  {
+    QMetaObject::invokeMethod(this, &CaptureRecorder::openChanged,
+                              Qt::QueuedConnection);
+  }
+}
+
+/**
+ * Configures the signal/slot connections with the rest of the modules of the
+ * application.
+ */
+void IO::CaptureRecorder::setupExternalConnections()
+{
+  // Close the capture file when the device is disconnected
+  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
+          &CaptureRecorder::closeFile);
+}
+
+/**
+ * Enables or disables raw capture recording. Disabling closes the current
+ * file set, so a session's capture is complete as soon as the option is
+ * turned off.
+ */
+void IO::CaptureRecorder::setCaptureEnabled(const bool enabled)
+{
+  m_captureEnabled.store(enabled, std::memory_order_relaxed);
+  Q_EMIT enabledChanged();
+
+  if (!enabled)
+    closeFile();
+}
+
+/**
+ * @brief Opens the next capture segment & maps its initial window.
+ *
+ * The first segment of a session fixes the timestamped session name shared
+ * by every segment that follows.
+ */
+void IO::CaptureRecorder::openSegment()
+{
+  // Fix the session name on the first segment
+  if (m_sessionName.isEmpty())
+  {
+    m_sessionName = QDateTime::currentDateTime().toString(
+        QStringLiteral("yyyy_MMM_dd HH_mm_ss"));
+  }
+
+  // Generate file path if required
+  QDir dir(m_basePath);
+  if (!dir.exists())
+    dir.mkpath(QStringLiteral("."));
+
+  // Open the segment file
+  const auto fileName = QStringLiteral("%1 - %2.bin")
+                            .arg(m_sessionName)
+                            .arg(m_segmentIndex + 1, 3, 10, QChar('0'));
+  m_file.setFileName(dir.filePath(fileName));
+  if (!m_file.open(QIODevice::ReadWrite))
+  {
+    QMetaObject::invokeMethod(qApp, [] {
+      Misc::Utilities::showMessageBox(
+          tr("Capture File Error"),
+          tr("Cannot open capture file for writing!"), QMessageBox::Critical);
+    });
+
+    m_captureEnabled.store(false, std::memory_order_relaxed);
+    return;
+  }
+
+  // Map the initial window
+  m_offset = 0;
+  m_mappedSize = 0;
+  ++m_segmentIndex;
+  if (!growMapping(CaptureChunkSize))
+  {
+    m_file.close();
+    m_file.remove();
+    return;
+  }
+
+  // Update UI
+  QMetaObject::invokeMethod(this, &CaptureRecorder::openChanged,
+                            Qt::QueuedConnection);
+}
+
+/**
+ * @brief Unmaps & closes the current segment, truncating it to the bytes
+ *        actually written.
+ */
+void IO::CaptureRecorder::closeSegment()
+{
+  if (!m_file.isOpen())
+    return;
+
+  if (m_mapped)
+  {
+    m_file.unmap(m_mapped);
+    m_mapped = nullptr;
+  }
+
+  m_file.resize(m_offset);
+  m_file.close();
+  m_offset = 0;
+  m_mappedSize = 0;
+}
+
+/**
+ * @brief Extends the file & remaps it until @a required bytes fit.
+ *
+ * @param required The number of bytes the mapping must accommodate.
+ * @return True when the mapping covers the requested size.
+ */
+bool IO::CaptureRecorder::growMapping(qsizetype required)
+{
+  // Grow in whole chunks to keep metadata updates rare
+  qsizetype size = m_mappedSize;
+  while (size < required)
+    size += CaptureChunkSize;
+
+  // Release the current window before resizing the file
+  if (m_mapped)
+  {
+    m_file.unmap(m_mapped);
+    m_mapped = nullptr;
+  }
+
+  // Extend the file & map the new window
+  if (!m_file.resize(size))
+  {
+    closeSegment();
+    return false;
+  }
+
+  m_mapped = m_file.map(0, size);
+  if (!m_mapped)
+  {
+    closeSegment();
+    return false;
+  }
+
+  m_mappedSize = size;
+  return true;
+}
@@ -0,0 +1,108 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QFile>
+#include <QMutex>
+#include <QObject>
+
+namespace IO
+{
+/**
+ * @class IO::CaptureRecorder
+ * @brief Raw wire capture tap with memory-mapped, size-rotated output.
+ *
+ * Records the exact bytes delivered by the active driver into a capture file
+ * before any framing or parsing happens, so a session can later be replayed
+ * bit-for-bit through the file replay driver.
+ *
+ * Unlike the console export, the recorder does not route data through the
+ * GUI thread or an intermediate buffer: drivers call write() straight after
+ * the device read (on whichever thread the device lives in), and the bytes
+ * are copied exactly once into a memory-mapped window of the capture file.
+ * The file grows in pre-sized chunks so appends never block on metadata
+ * updates, and the OS writes the dirty pages back on its own schedule, which
+ * keeps a sustained multi-MB/s capture at near-zero CPU cost.
+ *
+ * Segments rotate once they reach a fixed size, keeping individual files
+ * convenient to copy and replay; on close each segment is truncated to the
+ * bytes actually written.
+ */
+class CaptureRecorder : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool isOpen
+             READ isOpen
+             NOTIFY openChanged)
+  Q_PROPERTY(bool captureEnabled
+             READ captureEnabled
+             WRITE setCaptureEnabled
+             NOTIFY enabledChanged)
+  // clang-format on
+
+signals:
+  void openChanged();
+  void enabledChanged();
+
+private:
+  explicit CaptureRecorder();
+  CaptureRecorder(CaptureRecorder &&) = delete;
+  CaptureRecorder(const CaptureRecorder &) = delete;
+  CaptureRecorder &operator=(CaptureRecorder &&) = delete;
+  CaptureRecorder &operator=(const CaptureRecorder &) = delete;
+
+  ~CaptureRecorder();
+
+public:
+  static CaptureRecorder &instance();
+
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] bool captureEnabled() const;
+
+  void write(const char *data, qsizetype len);
+
+public slots:
+  void closeFile();
+  void setupExternalConnections();
+  void setCaptureEnabled(const bool enabled);
+
+private:
+  void openSegment();
+  void closeSegment();
+  bool growMapping(qsizetype required);
+
+private:
+  QFile m_file;
+  uchar *m_mapped;
+  qsizetype m_offset;
+  qsizetype m_mappedSize;
+  int m_segmentIndex;
+  QString m_basePath;
+  QString m_sessionName;
+
+  QMutex m_mutex;
+  std::atomic<bool> m_captureEnabled;
+};
+} // namespace IO
@@ -21,10 +21,91 @@
 
 #include "IO/Checksum.h"
 
+#include <array>
+#include <cstring>
+
+/**
+ * @brief Lookup table for the CRC-8 engine (polynomial 0x31, init 0xFF).
+ *
+ * Each entry holds the result of dividing a single input byte by the
+ * polynomial, so the per-byte update reduces to one table lookup instead of
+ * eight conditional shift/xor rounds.
+ */
+static const std::array<uint8_t, 256> CRC8_TABLE = [] {
+  std::array<uint8_t, 256> table{};
+  for (int i = 0; i < 256; ++i)
+  {
+    uint8_t crc = static_cast<uint8_t>(i);
+    for (int j = 0; j < 8; ++j)
+    {
+      if ((crc & 0x80) != 0)
+        crc = static_cast<uint8_t>((crc << 1) ^ 0x31);
+      else
+        crc <<= 1;
+    }
+
+    table[i] = crc;
+  }
+
+  return table;
+}();
+
+/**
+ * @brief Lookup table for the CRC-16 engine (CCITT polynomial 0x1021).
+ */
+static const std::array<uint16_t, 256> CRC16_TABLE = [] {
+  std::array<uint16_t, 256> table{};
+  for (int i = 0; i < 256; ++i)
+  {
+    uint16_t crc = static_cast<uint16_t>(i << 8);
+    for (int j = 0; j < 8; ++j)
+    {
+      if ((crc & 0x8000) != 0)
+        crc = static_cast<uint16_t>((crc << 1) ^ 0x1021);
+      else
+        crc <<= 1;
+    }
+
+    table[i] = crc;
+  }
+
+  return table;
+}();
+
+/**
+ * @brief Slicing-by-8 lookup tables for the CRC-32 engine (polynomial
+ *        0xEDB88320, reflected).
+ *
+ * Table 0 is the classic per-byte table; tables 1..7 extend it so eight input
+ * bytes can be folded into the running CRC with eight independent lookups,
+ * removing the per-bit loop and most of the per-byte dependency chain.
+ */
+static const std::array<std::array<uint32_t, 256>, 8> CRC32_TABLES = [] {
+  std::array<std::array<uint32_t, 256>, 8> tables{};
+  for (int i = 0; i < 256; ++i)
+  {
+    uint32_t crc = static_cast<uint32_t>(i);
+    for (int j = 0; j < 8; ++j)
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+
+    tables[0][i] = crc;
+  }
+
+  for (int k = 1; k < 8; ++k)
+  {
+    for (int i = 0; i < 256; ++i)
+      tables[k][i]
+          = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+  }
+
+  return tables;
+}();
+
 /**
  * @brief Computes an 8-bit CRC (Cyclic Redundancy Check) for the given data.
  *
- * This function calculates the CRC-8 checksum using the polynomial 0x31.
+ * This function calculates the CRC-8 checksum using the polynomial 0x31,
+ * processing one byte per table lookup.
  *
  * @param data Pointer to the input data array.
  * @param length Length of the input data array.
@@ -33,17 +114,8 @@
 uint8_t IO::crc8(const char *data, const int length)
 {
   uint8_t crc = 0xff;
-  for (int i = 0; i < length; i++)
-  {
-    crc ^= data[i];
-    for (int j = 0; j < 8; j++)
-    {
-      if ((crc & 0x80) != 0)
-        crc = (uint8_t)((crc << 1) ^ 0x31);
-      else
-        crc <<= 1;
-    }
-  }
+  for (int i = 0; i < length; ++i)
+    crc = CRC8_TABLE[crc ^ static_cast<uint8_t>(data[i])];
 
   return crc;
 }
@@ -51,7 +123,8 @@ uint8_t IO::crc8(const char *data, const int length)
 /**
  * @brief Computes a 16-bit CRC (Cyclic Redundancy Check) for the given data.
  *
- * This function calculates the CRC-16 checksum using a bitwise algorithm.
+ * This function calculates the CRC-16 checksum using the CCITT polynomial,
+ * processing one byte per table lookup.
  *
  * @param data Pointer to the input data array.
  * @param length Length of the input data array.
@@ -59,16 +132,11 @@ uint8_t IO::crc8(const char *data, const int length)
  */
 uint16_t IO::crc16(const char *data, const int length)
 {
-  uint8_t x;
   uint16_t crc = 0xFFFF;
-
   for (int i = 0; i < length; ++i)
-  {
-    x = crc >> 8 ^ data[i];
-    x ^= x >> 4;
-    crc = (crc << 8) ^ ((uint16_t)(x << 12)) ^ ((uint16_t)(x << 5))
-          ^ ((uint16_t)x);
-  }
+    crc = static_cast<uint16_t>(
+        (crc << 8) ^ CRC16_TABLE[((crc >> 8) ^ static_cast<uint8_t>(data[i]))
+                                 & 0xFF]);
 
   return crc;
 }
@@ -76,7 +144,10 @@ uint16_t IO::crc16(const char *data, const int length)
 /**
  * @brief Computes a 32-bit CRC (Cyclic Redundancy Check) for the given data.
  *
- * This function calculates the CRC-32 checksum using the polynomial 0xEDB88320.
+ * This function calculates the standard reflected CRC-32 checksum (polynomial
+ * 0xEDB88320) using slicing-by-8: eight input bytes are folded into the
+ * running CRC with eight independent table lookups per iteration, with a
+ * per-byte tail loop for the remainder.
  *
  * @param data Pointer to the input data array.
  * @param length Length of the input data array.
@@ -84,17 +155,29 @@ uint16_t IO::crc16(const char *data, const int length)
  */
 uint32_t IO::crc32(const char *data, const int length)
 {
-  uint32_t mask;
   uint32_t crc = 0xFFFFFFFF;
-  for (int i = 0; i < length; ++i)
+
+  // Fold eight bytes per iteration using the slicing tables
+  int i = 0;
+  for (; i + 8 <= length; i += 8)
   {
-    crc = crc ^ data[i];
-    for (int j = 8; j >= 0; j--)
-    {
-      mask = 0 - (crc & 1);
-      crc = (crc >> 1) ^ (0xEDB88320 & mask);
-    }
+    uint32_t low;
+    uint32_t high;
+    std::memcpy(&low, data + i, sizeof(low));
+    std::memcpy(&high, data + i + 4, sizeof(high));
+    low ^= crc;
+
+    crc = CRC32_TABLES[7][low & 0xFF] ^ CRC32_TABLES[6][(low >> 8) & 0xFF]
+          ^ CRC32_TABLES[5][(low >> 16) & 0xFF] ^ CRC32_TABLES[4][low >> 24]
+          ^ CRC32_TABLES[3][high & 0xFF] ^ CRC32_TABLES[2][(high >> 8) & 0xFF]
+          ^ CRC32_TABLES[1][(high >> 16) & 0xFF]
+          ^ CRC32_TABLES[0][high >> 24];
   }
 
+  // Process the remaining bytes one table lookup at a time
+  for (; i < length; ++i)
+    crc = (crc >> 8) ^ CRC32_TABLES[0][(crc ^ static_cast<uint8_t>(data[i]))
+                                       & 0xFF];
+
   return ~crc;
 }
@@ -23,12 +23,140 @@
 
 #include <QtCore>
 
+#include <atomic>
 #include <mutex>
 #include <vector>
 #include <cstring>
 
+#include "SIMD/SIMD.h"
+
 namespace IO
 {
+/**
+ * @brief Lightweight, non-owning view over bytes stored in a circular buffer.
+ *
+ * Behaves like a span over the ring storage: when the requested range is
+ * contiguous in memory the view points directly into the ring and no copy is
+ * made, only falling back to an internal owned copy when the range wraps the
+ * ring boundary.
+ *
+ * A view obtained from a buffer remains valid until the bytes it covers are
+ * consumed (read) or the buffer is cleared or resized. Appends performed by a
+ * producer never touch unread bytes, so holding a view while new data arrives
+ * is safe.
+ */
+class ByteView
+{
+public:
+  ByteView()
+    : m_data(nullptr)
+    , m_size(0)
+  {
+  }
+
+  /**
+   * @brief Constructs a zero-copy view over an external byte range.
+   */
+  ByteView(const char *data, qsizetype size)
+    : m_data(data)
+    , m_size(size)
+  {
+  }
+
+  /**
+   * @brief Constructs an owning view, used when a range wraps the ring
+   *        boundary and a copy cannot be avoided.
+   */
+  explicit ByteView(QByteArray &&storage)
+    : m_storage(std::move(storage))
+  {
+    m_data = m_storage.constData();
+    m_size = m_storage.size();
+  }
+
+  [[nodiscard]] const char *data() const { return m_data; }
+  [[nodiscard]] qsizetype size() const { return m_size; }
+  [[nodiscard]] bool isEmpty() const { return m_size <= 0; }
+
+  /**
+   * @brief Returns the byte at the given position (no bounds checking).
+   */
+  [[nodiscard]] char at(qsizetype i) const { return m_data[i]; }
+
+  /**
+   * @brief Returns true when the view begins with the given byte sequence.
+   */
+  [[nodiscard]] bool startsWith(const QByteArray &prefix) const
+  {
+    return prefix.size() <= m_size
+           && std::memcmp(m_data, prefix.constData(), prefix.size()) == 0;
+  }
+
+  /**
+   * @brief Returns a sub-view over [pos, pos + len), clamped to the view.
+   *
+   * The sub-view aliases the same storage as this view, no copy is made.
+   */
+  [[nodiscard]] ByteView mid(qsizetype pos, qsizetype len = -1) const
+  {
+    pos = qBound<qsizetype>(0, pos, m_size);
+    if (len < 0 || pos + len > m_size)
+      len = m_size - pos;
+
+    ByteView view(m_data + pos, len);
+    view.m_storage = m_storage;
+    return view;
+  }
+
+  /**
+   * @brief Finds the first occurrence of @a needle at or after @a from.
+   *
+   * @return The index of the match, or -1 if the needle is not found.
+   */
+  [[nodiscard]] qsizetype indexOf(const QByteArray &needle,
+                                  qsizetype from = 0) const
+  {
+    const qsizetype n = needle.size();
+    if (n <= 0 || from < 0 || m_size - from < n)
+      return -1;
+
+    const char first = needle.at(0);
+    const char *end = m_data + m_size - n + 1;
+    for (const char *p = m_data + from; p < end; ++p)
+    {
+      p = static_cast<const char *>(std::memchr(p, first, end - p));
+      if (!p)
+        return -1;
+
+      if (std::memcmp(p, needle.constData(), n) == 0)
+        return p - m_data;
+    }
+
+    return -1;
+  }
+
+  /**
+   * @brief Returns true when the view contains the given byte sequence.
+   */
+  [[nodiscard]] bool contains(const QByteArray &needle) const
+  {
+    return indexOf(needle) != -1;
+  }
+
+  /**
+   * @brief Materializes the view into an owning QByteArray (deep copy).
+   */
+  [[nodiscard]] QByteArray toByteArray() const
+  {
+    return QByteArray(m_data, m_size);
+  }
+
+private:
+  const char *m_data;
+  qsizetype m_size;
+  QByteArray m_storage;
+};
+
 /**
  * @brief A generic circular buffer for managing data with fixed capacity.
  *
@@ -58,6 +186,7 @@ public:
 
   [[nodiscard]] T read(qsizetype size);
   [[nodiscard]] T peek(qsizetype size) const;
+  [[nodiscard]] ByteView peekView(qsizetype size) const;
 
   [[nodiscard]] int findPatternKMP(const T &pattern, const int pos = 0);
 
@@ -71,8 +200,75 @@ private:
   qsizetype m_capacity;
   std::vector<StorageType> m_buffer;
 
+  T m_kmpPattern;
+  std::vector<int> m_kmpTable;
+
   mutable std::mutex m_mutex;
 };
+
+/**
+ * @brief Lock-free single-producer/single-consumer circular buffer.
+ *
+ * Wait-free ring buffer for exactly one producer thread (e.g. a HAL driver
+ * pushing raw bytes) and one consumer thread (e.g. IO::FrameReader extracting
+ * frames). Head and tail indices are published with acquire/release atomics
+ * instead of a mutex, so high-rate streams never serialize on a lock.
+ *
+ * Unlike IO::CircularBuffer, the producer cannot safely reclaim space owned
+ * by the consumer, so appends that exceed the available free space discard
+ * the incoming excess instead of overwriting old data. The number of dropped
+ * bytes is tracked and can be queried from either thread.
+ *
+ * All read-side members (read(), peek(), findPatternKMP(), clear()) must only
+ * be called from the consumer thread, and append() only from the producer
+ * thread. setCapacity() is not thread-safe and requires both sides idle.
+ *
+ * @tparam T The type of elements exposed to the user (e.g., QByteArray).
+ * @tparam StorageType The type of elements used internally (default: uint8_t).
+ */
+template<typename T, typename StorageType = uint8_t>
+class SPSCCircularBuffer
+{
+public:
+  explicit SPSCCircularBuffer(qsizetype capacity = 1024 * 1024 * 10);
+
+  void clear();
+  bool append(const T &data);
+  void resize(const qsizetype capacity);
+  void setCapacity(const qsizetype capacity);
+
+  [[nodiscard]] qsizetype size() const;
+  [[nodiscard]] qsizetype capacity() const;
+  [[nodiscard]] qsizetype freeSpace() const;
+  [[nodiscard]] quint64 overruns() const;
+  [[nodiscard]] quint64 droppedBytes() const;
+  [[nodiscard]] quint64 consumedBytes() const;
+  [[nodiscard]] qsizetype highWaterMark() const;
+
+  [[nodiscard]] T read(qsizetype size);
+  [[nodiscard]] T peek(qsizetype size) const;
+  [[nodiscard]] ByteView peekView(qsizetype size) const;
+
+  [[nodiscard]] int findPattern(const T &pattern, const int pos = 0);
+  [[nodiscard]] int findPatternKMP(const T &pattern, const int pos = 0);
+
+private:
+  [[nodiscard]] std::vector<int> computeKMPTable(const T &p) const;
+
+private:
+  qsizetype m_capacity;
+  quint64 m_consumedBytes;
+  std::vector<StorageType> m_buffer;
+
+  T m_kmpPattern;
+  std::vector<int> m_kmpTable;
+
+  alignas(64) std::atomic<qsizetype> m_head;
+  alignas(64) std::atomic<qsizetype> m_tail;
+  alignas(64) std::atomic<quint64> m_overruns;
+  std::atomic<quint64> m_droppedBytes;
+  std::atomic<qsizetype> m_highWaterMark;
+};
 } // namespace IO
 
 /**
@@ -264,6 +460,39 @@ T IO::CircularBuffer<T, StorageType>::peek(qsizetype size) const
   return result;
 }
 
+/**
+ * @brief Obtains a zero-copy view over the next @a size bytes of the buffer.
+ *
+ * When the requested range does not wrap the ring boundary, the returned view
+ * points directly into the internal storage and no data is copied. A copy is
+ * only made when the range wraps around the end of the ring.
+ *
+ * The view is valid until the covered bytes are consumed with read(), or the
+ * buffer is cleared or resized.
+ *
+ * @param size The number of bytes to view, clamped to the buffer size.
+ * @return A ByteView over the requested data.
+ */
+template<typename T, typename StorageType>
+IO::ByteView IO::CircularBuffer<T, StorageType>::peekView(qsizetype size) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  size = std::min(size, m_size);
+
+  // Contiguous range, hand out a pointer into the ring
+  if (size <= m_capacity - m_head)
+    return ByteView(reinterpret_cast<const char *>(&m_buffer[m_head]), size);
+
+  // Range wraps the ring boundary, fall back to a copy
+  QByteArray copy;
+  copy.resize(size);
+  const qsizetype firstChunk = m_capacity - m_head;
+  std::memcpy(copy.data(), &m_buffer[m_head], firstChunk);
+  std::memcpy(copy.data() + firstChunk, &m_buffer[0], size - firstChunk);
+  return ByteView(std::move(copy));
+}
+
 /**
  * @brief Searches for a pattern in the circular buffer using the KMP algorithm.
  *
@@ -298,8 +527,15 @@ int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T &pattern,
   if (pattern.isEmpty() || m_size < pattern.size())
     return -1;
 
+  // Re-compute the failure table only when the search pattern changes
+  if (pattern != m_kmpPattern)
+  {
+    m_kmpTable = computeKMPTable(pattern);
+    m_kmpPattern = pattern;
+  }
+
   // Start search at `pos`
-  std::vector<int> lps = computeKMPTable(pattern);
+  const std::vector<int> &lps = m_kmpTable;
   qsizetype bufferIdx = (m_head + pos) % m_capacity;
   int i = pos, j = 0;
 
@@ -371,3 +607,510 @@ IO::CircularBuffer<T, StorageType>::computeKMPTable(const T &p) const
 
   return lps;
 }
+
+/**
+ * @brief Constructs a SPSCCircularBuffer object with a given capacity.
+ *
+ * Initializes the ring buffer with the specified capacity, setting up the
+ * atomic head/tail indices and the drop counter.
+ *
+ * @param capacity The maximum capacity of the buffer in bytes.
+ */
+template<typename T, typename StorageType>
+IO::SPSCCircularBuffer<T, StorageType>::SPSCCircularBuffer(qsizetype capacity)
+  : m_capacity(capacity)
+  , m_consumedBytes(0)
+  , m_head(0)
+  , m_tail(0)
+  , m_overruns(0)
+  , m_droppedBytes(0)
+  , m_highWaterMark(0)
+{
+  m_buffer.resize(capacity);
+}
+
+/**
+ * @brief Clears the circular buffer.
+ *
+ * Discards all unread data by advancing the consumer's head index up to the
+ * producer's published tail. Must only be called from the consumer thread.
+ */
+template<typename T, typename StorageType>
+void IO::SPSCCircularBuffer<T, StorageType>::clear()
+{
+  const qsizetype tail = m_tail.load(std::memory_order_acquire);
+  qsizetype used = tail - m_head.load(std::memory_order_relaxed);
+  if (used < 0)
+    used += m_capacity;
+
+  m_consumedBytes += used;
+  m_head.store(tail, std::memory_order_release);
+}
+
+/**
+ * @brief Appends data to the circular buffer (producer thread only).
+ *
+ * Copies the given data into the ring and publishes the new tail index with
+ * release semantics so the consumer observes fully-written bytes. If the data
+ * does not fit in the available free space, the excess is discarded and
+ * accounted in droppedBytes().
+ *
+ * @param data The QByteArray containing data to append.
+ * @return True when all bytes were stored, false when data was dropped.
+ */
+template<typename T, typename StorageType>
+bool IO::SPSCCircularBuffer<T, StorageType>::append(const T &data)
+{
+  // Obtain current indices, head may advance concurrently (which only
+  // increases free space, so the computed value is a safe lower bound)
+  const qsizetype head = m_head.load(std::memory_order_acquire);
+  const qsizetype tail = m_tail.load(std::memory_order_relaxed);
+
+  // Compute free space, leave one byte unused to distinguish full from empty
+  qsizetype used = tail - head;
+  if (used < 0)
+    used += m_capacity;
+  const qsizetype free = m_capacity - 1 - used;
+
+  // Clamp the write size to the available space & register dropped bytes
+  qsizetype dataSize = data.size();
+  const bool dropped = dataSize > free;
+  if (dropped)
+  {
+    m_overruns.fetch_add(1, std::memory_order_relaxed);
+    m_droppedBytes.fetch_add(dataSize - free, std::memory_order_relaxed);
+    dataSize = free;
+  }
+
+  // Track the highest observed fill level
+  if (used + dataSize > m_highWaterMark.load(std::memory_order_relaxed))
+    m_highWaterMark.store(used + dataSize, std::memory_order_relaxed);
+
+  // Copy data into the ring in up to two contiguous chunks
+  if (dataSize > 0)
+  {
+    const qsizetype firstChunk = std::min(dataSize, m_capacity - tail);
+    std::memcpy(&m_buffer[tail], data.constData(), firstChunk);
+    if (dataSize > firstChunk)
+      std::memcpy(&m_buffer[0], data.constData() + firstChunk,
+                  dataSize - firstChunk);
+
+    // Publish the new tail so the consumer can observe the bytes
+    m_tail.store((tail + dataSize) % m_capacity, std::memory_order_release);
+  }
+
+  return !dropped;
+}
+
+/**
+ * Clears the buffer and modifies it's maximum capacity.
+ *
+ * @warning Not thread-safe, both producer and consumer must be idle.
+ */
+template<typename T, typename StorageType>
+void IO::SPSCCircularBuffer<T, StorageType>::setCapacity(
+    const qsizetype capacity)
+{
+  m_head.store(0, std::memory_order_relaxed);
+  m_tail.store(0, std::memory_order_relaxed);
+  m_capacity = capacity;
+  m_buffer.resize(capacity);
+}
+
+/**
+ * @brief Changes the buffer capacity while preserving unread data.
+ *
+ * Used by the adaptive sizing logic to grow the ring when producers outrun
+ * consumers and to shrink it again once the fill level stays low. Unread
+ * bytes are relocated to the start of the new storage. Requests that would
+ * not fit the currently buffered data are ignored.
+ *
+ * @warning Must only be called from the consumer thread while the producer
+ *          is quiescent (in the frame pipeline both roles run on the frame
+ *          reader thread).
+ *
+ * @param capacity The new capacity of the buffer in bytes.
+ */
+template<typename T, typename StorageType>
+void IO::SPSCCircularBuffer<T, StorageType>::resize(const qsizetype capacity)
+{
+  // Nothing to do, or the unread data would not fit the new storage
+  const qsizetype used = size();
+  if (capacity == m_capacity || capacity - 1 < used)
+    return;
+
+  // Relocate the unread bytes to the start of the new storage
+  std::vector<StorageType> storage(capacity);
+  const qsizetype head = m_head.load(std::memory_order_relaxed);
+  const qsizetype firstChunk = std::min(used, m_capacity - head);
+  if (firstChunk > 0)
+    std::memcpy(storage.data(), &m_buffer[head],
+                firstChunk * sizeof(StorageType));
+  if (used > firstChunk)
+    std::memcpy(storage.data() + firstChunk, &m_buffer[0],
+                (used - firstChunk) * sizeof(StorageType));
+
+  // Swap in the new storage & republish the indices
+  m_buffer.swap(storage);
+  m_capacity = capacity;
+  m_head.store(0, std::memory_order_relaxed);
+  m_tail.store(used, std::memory_order_release);
+}
+
+/**
+ * @brief Returns the maximum capacity of the buffer in bytes.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::SPSCCircularBuffer<T, StorageType>::capacity() const
+{
+  return m_capacity;
+}
+
+/**
+ * @brief Returns the number of append() calls that overran the buffer.
+ */
+template<typename T, typename StorageType>
+quint64 IO::SPSCCircularBuffer<T, StorageType>::overruns() const
+{
+  return m_overruns.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the highest fill level observed since construction.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::SPSCCircularBuffer<T, StorageType>::highWaterMark() const
+{
+  return m_highWaterMark.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the current size of the buffer.
+ *
+ * @return The number of bytes currently stored in the buffer.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::SPSCCircularBuffer<T, StorageType>::size() const
+{
+  qsizetype used = m_tail.load(std::memory_order_acquire)
+                   - m_head.load(std::memory_order_acquire);
+  if (used < 0)
+    used += m_capacity;
+
+  return used;
+}
+
+/**
+ * @brief Returns the free space available in the buffer.
+ *
+ * @return The number of bytes of free space in the buffer.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::SPSCCircularBuffer<T, StorageType>::freeSpace() const
+{
+  return m_capacity - 1 - size();
+}
+
+/**
+ * @brief Returns the total number of bytes dropped by append() overflows.
+ *
+ * @return Cumulative count of bytes discarded because the ring was full.
+ */
+template<typename T, typename StorageType>
+quint64 IO::SPSCCircularBuffer<T, StorageType>::droppedBytes() const
+{
+  return m_droppedBytes.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the total number of bytes removed from the buffer so far.
+ *
+ * Counts every byte taken out through read() or discarded by clear(), which
+ * lets a consumer translate its own monotonic byte cursors into offsets
+ * within the current buffer contents.
+ *
+ * @warning Must only be called from the consumer thread.
+ */
+template<typename T, typename StorageType>
+quint64 IO::SPSCCircularBuffer<T, StorageType>::consumedBytes() const
+{
+  return m_consumedBytes;
+}
+
+/**
+ * @brief Reads data from the circular buffer (consumer thread only).
+ *
+ * Reads the specified number of bytes from the buffer. The read data is
+ * removed from the buffer by publishing the advanced head index.
+ *
+ * @param size The number of bytes to read.
+ * @return A QByteArray containing the read data.
+ * @throws std::underflow_error if there is not enough data in the buffer.
+ */
+template<typename T, typename StorageType>
+T IO::SPSCCircularBuffer<T, StorageType>::read(qsizetype size)
+{
+  if (size > this->size())
+    throw std::underflow_error("Not enough data in buffer");
+
+  const qsizetype head = m_head.load(std::memory_order_relaxed);
+
+  T result;
+  result.resize(size);
+
+  const qsizetype firstChunk = std::min(size, m_capacity - head);
+  std::memcpy(result.data(), &m_buffer[head], firstChunk);
+  if (size > firstChunk)
+    std::memcpy(result.data() + firstChunk, &m_buffer[0], size - firstChunk);
+
+  m_consumedBytes += size;
+  m_head.store((head + size) % m_capacity, std::memory_order_release);
+
+  return result;
+}
+
+/**
+ * @brief Retrieves data from the buffer without removing it (consumer thread
+ *        only).
+ *
+ * Extracts up to the specified number of bytes from the buffer, starting from
+ * the current head position, without modifying the buffer's head or tail
+ * positions.
+ *
+ * @param size The number of bytes to peek from the buffer.
+ * @return A QByteArray containing the requested data. If the buffer
+ *         contains less data than requested, the returned QByteArray
+ *         will be smaller.
+ */
+template<typename T, typename StorageType>
+T IO::SPSCCircularBuffer<T, StorageType>::peek(qsizetype size) const
+{
+  size = std::min(size, this->size());
+  const qsizetype head = m_head.load(std::memory_order_relaxed);
+
+  T result;
+  result.resize(size);
+
+  const qsizetype firstChunk = std::min(size, m_capacity - head);
+  std::memcpy(result.data(), &m_buffer[head], firstChunk);
+  if (size > firstChunk)
+    std::memcpy(result.data() + firstChunk, &m_buffer[0], size - firstChunk);
+
+  return result;
+}
+
+/**
+ * @brief Obtains a zero-copy view over the next @a size bytes of the buffer
+ *        (consumer thread only).
+ *
+ * When the requested range does not wrap the ring boundary, the returned view
+ * points directly into the internal storage and no data is copied. A copy is
+ * only made when the range wraps around the end of the ring.
+ *
+ * The view is valid until the covered bytes are consumed with read(), or the
+ * buffer is cleared or resized. Concurrent producer appends only write to
+ * free space, so they never invalidate an outstanding view.
+ *
+ * @param size The number of bytes to view, clamped to the buffer size.
+ * @return A ByteView over the requested data.
+ */
+template<typename T, typename StorageType>
+IO::ByteView
+IO::SPSCCircularBuffer<T, StorageType>::peekView(qsizetype size) const
+{
+  size = std::min(size, this->size());
+  const qsizetype head = m_head.load(std::memory_order_relaxed);
+
+  // Contiguous range, hand out a pointer into the ring
+  if (size <= m_capacity - head)
+    return ByteView(reinterpret_cast<const char *>(&m_buffer[head]), size);
+
+  // Range wraps the ring boundary, fall back to a copy
+  QByteArray copy;
+  copy.resize(size);
+  const qsizetype firstChunk = m_capacity - head;
+  std::memcpy(copy.data(), &m_buffer[head], firstChunk);
+  std::memcpy(copy.data() + firstChunk, &m_buffer[0], size - firstChunk);
+  return ByteView(std::move(copy));
+}
+
+/**
+ * @brief Searches for a pattern in the ring using SIMD comparisons (consumer
+ *        thread only).
+ *
+ * Vectorized memmem-style scan over the (up to two) contiguous segments of
+ * the ring, using SIMD::findPattern(). Matches that straddle the wrap
+ * boundary are stitched together from the segment edges and verified with a
+ * scalar pass, so results are identical to findPatternKMP() while the hot
+ * path runs at SIMD speed over contiguous memory.
+ *
+ * @param pattern The pattern to search for in the buffer.
+ * @param pos The starting position (relative to the logical start of the
+ *            buffer) for the search. Defaults to the beginning if set to 0.
+ *
+ * @return The index (relative to the logical start of the buffer) of the first
+ *         occurrence of the pattern, or -1 if the pattern is not found.
+ */
+template<typename T, typename StorageType>
+int IO::SPSCCircularBuffer<T, StorageType>::findPattern(const T &pattern,
+                                                        const int pos)
+{
+  // Validate search pattern
+  const qsizetype n = pattern.size();
+  const qsizetype bufferSize = size();
+  if (pattern.isEmpty() || pos < 0 || bufferSize - pos < n)
+    return -1;
+
+  // Obtain raw pointers into the ring storage
+  const qsizetype head = m_head.load(std::memory_order_relaxed);
+  const auto *ring = reinterpret_cast<const char *>(m_buffer.data());
+  const char *needle = pattern.constData();
+
+  // Length of the contiguous segment that starts at the head
+  const qsizetype seg1 = std::min(bufferSize, m_capacity - head);
+
+  // Scan the first contiguous segment
+  if (pos < seg1)
+  {
+    const qsizetype idx
+        = SIMD::findPattern(ring + head + pos, seg1 - pos, needle, n);
+    if (idx != -1)
+      return static_cast<int>(pos + idx);
+  }
+
+  // Check matches that straddle the wrap boundary
+  if (bufferSize > seg1 && n > 1)
+  {
+    const qsizetype tail = std::min<qsizetype>(n - 1, seg1);
+    const qsizetype lead = std::min<qsizetype>(n - 1, bufferSize - seg1);
+    std::vector<char> stitch(tail + lead);
+    std::memcpy(stitch.data(), ring + head + seg1 - tail, tail);
+    std::memcpy(stitch.data() + tail, ring, lead);
+
+    const qsizetype base = seg1 - tail;
+    const qsizetype from = std::max<qsizetype>(pos - base, 0);
+    if (from < static_cast<qsizetype>(stitch.size()))
+    {
+      const qsizetype idx = SIMD::findPattern(
+          stitch.data() + from, stitch.size() - from, needle, n);
+      if (idx != -1)
+        return static_cast<int>(base + from + idx);
+    }
+  }
+
+  // Scan the second contiguous segment (after the wrap)
+  if (bufferSize > seg1)
+  {
+    const qsizetype from = std::max<qsizetype>(pos - seg1, 0);
+    const qsizetype idx
+        = SIMD::findPattern(ring + from, (bufferSize - seg1) - from, needle, n);
+    if (idx != -1)
+      return static_cast<int>(seg1 + from + idx);
+  }
+
+  // Pattern not found
+  return -1;
+}
+
+/**
+ * @brief Searches for a pattern in the ring using the KMP algorithm (consumer
+ *        thread only).
+ *
+ * Behaves like IO::CircularBuffer::findPatternKMP(), operating on the data
+ * published by the producer at the time of the call. Bytes appended
+ * concurrently are picked up by the next search.
+ *
+ * @param pattern The pattern to search for in the buffer.
+ * @param pos The starting position (relative to the logical start of the
+ *            buffer) for the search. Defaults to the beginning if set to 0.
+ *
+ * @return The index (relative to the logical start of the buffer) of the first
+ *         occurrence of the pattern, or -1 if the pattern is not found.
+ */
+template<typename T, typename StorageType>
+int IO::SPSCCircularBuffer<T, StorageType>::findPatternKMP(const T &pattern,
+                                                           const int pos)
+{
+  // Validate search pattern
+  const qsizetype bufferSize = size();
+  if (pattern.isEmpty() || bufferSize < pattern.size())
+    return -1;
+
+  // Re-compute the failure table only when the search pattern changes
+  if (pattern != m_kmpPattern)
+  {
+    m_kmpTable = computeKMPTable(pattern);
+    m_kmpPattern = pattern;
+  }
+
+  // Start search at `pos`
+  const qsizetype head = m_head.load(std::memory_order_relaxed);
+  const std::vector<int> &lps = m_kmpTable;
+  qsizetype bufferIdx = (head + pos) % m_capacity;
+  int i = pos, j = 0;
+
+  while (i < bufferSize)
+  {
+    // Compare current buffer character with the pattern
+    if (m_buffer[bufferIdx] == pattern[j])
+    {
+      i++;
+      j++;
+      bufferIdx = (bufferIdx + 1) % m_capacity;
+
+      // If the whole pattern is matched, return the logical start index
+      if (j == pattern.size())
+        return i - j;
+    }
+
+    // Mismatch after some matches, fall back in pattern
+    else if (j != 0)
+      j = lps[j - 1];
+
+    // Mismatch at the start, move forward
+    else
+    {
+      i++;
+      bufferIdx = (bufferIdx + 1) % m_capacity;
+    }
+  }
+
+  // Pattern not found
+  return -1;
+}
+
+/**
+ * @brief Computes the KMP table for a given p.
+ *
+ * Prepares the longest prefix suffix (LPS) table used by the KMP algorithm.
+ *
+ * @param p The QByteArray representing the p.
+ * @return A vector of integers representing the LPS table.
+ */
+template<typename T, typename StorageType>
+std::vector<int>
+IO::SPSCCircularBuffer<T, StorageType>::computeKMPTable(const T &p) const
+{
+  qsizetype m = p.size();
+  std::vector<int> lps(m, 0);
+
+  qsizetype len = 0;
+  qsizetype i = 1;
+
+  while (i < m)
+  {
+    if (p[i] == p[len])
+    {
+      len++;
+      lps[i++] = len;
+    }
+
+    else if (len != 0)
+      len = lps[len - 1];
+
+    else
+      lps[i++] = 0;
+  }
+
+  return lps;
+}
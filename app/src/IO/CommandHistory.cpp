@@ -0,0 +1,275 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/CommandHistory.h"
+
+#include <algorithm>
+
+#include <QTextStream>
+
+/**
+ * @brief Number of commands stored per ring chunk.
+ *
+ * Eviction drops one chunk at a time, so this is also the granularity at
+ * which the history shrinks once the capacity is exceeded.
+ */
+static constexpr int ChunkSize = 256;
+
+/**
+ * @brief Number of leading characters hashed by the prefix index.
+ *
+ * Longer search prefixes reuse the bucket of their first characters and
+ * filter inside it, so the index stays small while lookups remain bounded
+ * by the number of commands sharing a short prefix.
+ */
+static constexpr int PrefixKeyLength = 3;
+
+/**
+ * @brief Constructs an empty history bounded to the given capacity.
+ */
+IO::CommandHistory::CommandHistory(const int capacity)
+  : m_capacity(qMax(capacity, ChunkSize))
+  , m_base(0)
+  , m_size(0)
+{
+}
+
+/**
+ * @brief Attaches the history to a log file & replays its contents.
+ *
+ * Existing lines are loaded into the ring (oldest lines beyond the capacity
+ * fall out naturally). When the file holds noticeably more lines than the
+ * ring retains, it is rewritten once with the retained commands, so the log
+ * stays bounded without any work at exit time. The file is then kept open
+ * in append mode and every subsequent append() is flushed to it directly.
+ */
+void IO::CommandHistory::loadFrom(const QString &path)
+{
+  if (m_logFile.isOpen())
+    m_logFile.close();
+
+  // Replay the persisted commands into the ring
+  quint64 persistedLines = 0;
+  m_logFile.setFileName(path);
+  if (m_logFile.open(QFile::ReadOnly | QFile::Text))
+  {
+    QTextStream in(&m_logFile);
+    while (!in.atEnd())
+    {
+      const QString line = in.readLine();
+      if (!line.isEmpty())
+      {
+        record(line);
+        ++persistedLines;
+      }
+    }
+
+    m_logFile.close();
+  }
+
+  // Compact the log once dropped entries dominate it
+  if (persistedLines > quint64(m_capacity) + quint64(m_capacity) / 2)
+  {
+    if (m_logFile.open(QFile::WriteOnly | QFile::Truncate | QFile::Text))
+    {
+      QTextStream out(&m_logFile);
+      for (int i = 0; i < count(); ++i)
+        out << at(i) << QStringLiteral("\n");
+
+      m_logFile.close();
+    }
+  }
+
+  // Keep the log open, appends are written through immediately
+  m_logFile.open(QFile::WriteOnly | QFile::Append | QFile::Text);
+}
+
+/**
+ * @brief Appends a command to the history & its attached log file.
+ *
+ * Repeats of the most recent command are skipped, matching the usual shell
+ * behaviour when the same command is sent over and over.
+ */
+void IO::CommandHistory::append(const QString &command)
+{
+  if (command.isEmpty())
+    return;
+
+  // Skip consecutive duplicates
+  if (count() > 0 && at(count() - 1) == command)
+    return;
+
+  // Register the command in the ring & the prefix index
+  record(command);
+
+  // Persist the command right away, a crash loses nothing
+  if (m_logFile.isOpen())
+  {
+    m_logFile.write(command.toUtf8());
+    m_logFile.write("\n", 1);
+    m_logFile.flush();
+  }
+}
+
+/**
+ * @brief Drops every stored command & the prefix index.
+ *
+ * The attached log file (if any) is left untouched; it is only compacted
+ * the next time the history is loaded.
+ */
+void IO::CommandHistory::clear()
+{
+  m_base = 0;
+  m_size = 0;
+  m_chunks.clear();
+  m_prefixIndex.clear();
+}
+
+/**
+ * @brief Returns the number of commands currently retained.
+ */
+int IO::CommandHistory::count() const
+{
+  return int(m_size - m_base);
+}
+
+/**
+ * @brief Returns the command at the given position, zero being the oldest
+ *        retained command.
+ */
+QString IO::CommandHistory::at(const int position) const
+{
+  if (position < 0 || position >= count())
+    return QString();
+
+  // Every chunk except the newest is full, so the mapping is direct
+  return m_chunks[position / ChunkSize][position % ChunkSize];
+}
+
+/**
+ * @brief Returns the positions of the commands starting with a prefix.
+ *
+ * Positions are ordered newest first, ready for reverse-search recall. Only
+ * the index bucket matching the prefix is walked, so the cost is bounded by
+ * the number of commands sharing its first characters — not by the size of
+ * the history. An empty prefix returns the newest commands directly.
+ *
+ * @param prefix Case-insensitive prefix to match commands against.
+ * @param limit  Maximum number of positions to return, -1 for no limit.
+ */
+QVector<int> IO::CommandHistory::prefixMatches(const QString &prefix,
+                                               const int limit) const
+{
+  QVector<int> matches;
+  const int total = count();
+
+  // Without a prefix, recall simply walks backwards from the newest entry
+  if (prefix.isEmpty())
+  {
+    for (int i = total - 1; i >= 0; --i)
+    {
+      matches.append(i);
+      if (limit >= 0 && matches.count() >= limit)
+        break;
+    }
+
+    return matches;
+  }
+
+  // Walk the bucket of the prefix newest-first, filtering the full prefix
+  const auto bucket = m_prefixIndex.constFind(indexKey(prefix));
+  if (bucket == m_prefixIndex.cend())
+    return matches;
+
+  for (auto it = bucket->crbegin(); it != bucket->crend(); ++it)
+  {
+    // Entries below the base were evicted from the ring
+    if (*it < m_base)
+      break;
+
+    const int position = int(*it - m_base);
+    if (at(position).startsWith(prefix, Qt::CaseInsensitive))
+    {
+      matches.append(position);
+      if (limit >= 0 && matches.count() >= limit)
+        break;
+    }
+  }
+
+  return matches;
+}
+
+/**
+ * @brief Stores a command in the ring & the prefix index.
+ */
+void IO::CommandHistory::record(const QString &command)
+{
+  // Open a fresh chunk when the newest one is full
+  if (m_chunks.isEmpty() || m_chunks.last().count() >= ChunkSize)
+    m_chunks.append(QStringList());
+
+  // Append the command & index its sequence number under its prefix key
+  m_chunks.last().append(command);
+  m_prefixIndex[indexKey(command)].append(m_size);
+  ++m_size;
+
+  // Trim the ring one whole chunk at a time
+  if (count() > m_capacity)
+    evictOldestChunk();
+}
+
+/**
+ * @brief Drops the oldest chunk & expires its prefix index entries.
+ *
+ * Index buckets are appended in sequence order, so the expired entries form
+ * a prefix of each touched bucket and are removed with a single block erase.
+ */
+void IO::CommandHistory::evictOldestChunk()
+{
+  if (m_chunks.isEmpty())
+    return;
+
+  const QStringList chunk = m_chunks.takeFirst();
+  m_base += chunk.count();
+
+  for (const auto &command : chunk)
+  {
+    const auto bucket = m_prefixIndex.find(indexKey(command));
+    if (bucket == m_prefixIndex.end())
+      continue;
+
+    const auto stale = std::lower_bound(bucket->cbegin(), bucket->cend(),
+                                        m_base);
+    const auto staleCount = int(stale - bucket->cbegin());
+    if (staleCount >= bucket->count())
+      m_prefixIndex.erase(bucket);
+    else if (staleCount > 0)
+      bucket->remove(0, staleCount);
+  }
+}
+
+/**
+ * @brief Returns the index key of a command or search prefix.
+ */
+QString IO::CommandHistory::indexKey(const QString &text)
+{
+  return text.left(PrefixKeyLength).toLower();
+}
@@ -0,0 +1,79 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QFile>
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <QStringList>
+
+namespace IO
+{
+/**
+ * @class IO::CommandHistory
+ * @brief Bounded, indexed & persisted store for sent console commands.
+ *
+ * Commands are stored in fixed-size chunks arranged as a ring: appending is
+ * an O(1) push into the newest chunk, and once the configured capacity is
+ * exceeded the oldest chunk is dropped whole, so trimming a long session
+ * never shifts thousands of entries the way a plain list does.
+ *
+ * Recall by prefix (reverse-search style) is served by a hash index keyed
+ * on the first characters of each command: an append touches at most a
+ * handful of buckets, and a lookup walks only the bucket of its prefix —
+ * newest entries first — instead of scanning the whole history.
+ *
+ * When a log file is attached, every appended command is written & flushed
+ * immediately, so the history survives crashes without ever rewriting the
+ * file on exit. The log is compacted on load once it outgrows the retained
+ * capacity, which bounds its size to a small multiple of the ring.
+ */
+class CommandHistory
+{
+public:
+  explicit CommandHistory(const int capacity = 10000);
+
+  void loadFrom(const QString &path);
+  void append(const QString &command);
+  void clear();
+
+  [[nodiscard]] int count() const;
+  [[nodiscard]] QString at(const int position) const;
+  [[nodiscard]] QVector<int> prefixMatches(const QString &prefix,
+                                           const int limit = -1) const;
+
+private:
+  void record(const QString &command);
+  void evictOldestChunk();
+  [[nodiscard]] static QString indexKey(const QString &text);
+
+private:
+  int m_capacity;
+  quint64 m_base;
+  quint64 m_size;
+  QVector<QStringList> m_chunks;
+
+  QFile m_logFile;
+  QHash<QString, QVector<quint64>> m_prefixIndex;
+};
+} // namespace IO
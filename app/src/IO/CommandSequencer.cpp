@@ -0,0 +1,356 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/CommandSequencer.h"
+
+#include <QUrl>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+
+#include "IO/Console.h"
+#include "IO/Manager.h"
+#include "Misc/Utilities.h"
+
+/**
+ * @brief Default per-step timeout in milliseconds.
+ */
+static constexpr int DefaultStepTimeout = 1000;
+
+/**
+ * @brief Upper bound for the accumulated response buffer of a step.
+ *
+ * A matcher that never fires against a chatty device would otherwise grow
+ * the buffer without limit; matching windows larger than this are not a
+ * realistic command response.
+ */
+static constexpr qsizetype MaxResponseBytes = 64 * 1024;
+
+/**
+ * Constructor function, configures the single-shot step timeout timer.
+ */
+IO::CommandSequencer::CommandSequencer()
+  : m_running(false)
+  , m_index(0)
+{
+  m_timer.setSingleShot(true);
+  connect(&m_timer, &QTimer::timeout, this,
+          &IO::CommandSequencer::onStepTimeout);
+}
+
+/**
+ * Returns a pointer to the only instance of this class.
+ */
+IO::CommandSequencer &IO::CommandSequencer::instance()
+{
+  static CommandSequencer singleton;
+  return singleton;
+}
+
+/**
+ * Returns @c true while a sequence is being executed.
+ */
+bool IO::CommandSequencer::running() const
+{
+  return m_running;
+}
+
+/**
+ * Returns the number of steps in the loaded sequence.
+ */
+int IO::CommandSequencer::stepCount() const
+{
+  return m_steps.count();
+}
+
+/**
+ * Returns the index of the step currently being executed.
+ */
+int IO::CommandSequencer::currentStep() const
+{
+  return m_index;
+}
+
+/**
+ * @brief Loads a command sequence from a JSON file.
+ *
+ * The file must hold an array of objects with a "command" string, an
+ * optional "expect" matcher and an optional "timeout" in milliseconds,
+ * for example:
+ *
+ * @code{.json}
+ * [
+ *   { "command": "AT",          "expect": "OK", "timeout": 500 },
+ *   { "command": "AT+CFG=115200", "expect": "/OK|ERROR/" }
+ * ]
+ * @endcode
+ *
+ * @param path A local file path or file:// URL to the sequence file.
+ * @return True when the sequence was loaded, false otherwise.
+ */
+bool IO::CommandSequencer::loadSequence(const QString &path)
+{
+  // Resolve file:// URLs from QML file dialogs
+  QString localPath = path;
+  if (path.startsWith(QStringLiteral("file:")))
+    localPath = QUrl(path).toLocalFile();
+
+  // Read the sequence file
+  QFile file(localPath);
+  if (!file.open(QIODevice::ReadOnly))
+  {
+    Misc::Utilities::showMessageBox(tr("Command Sequence Error"),
+                                    tr("Cannot open the sequence file!"),
+                                    QMessageBox::Critical);
+    return false;
+  }
+
+  // Parse & validate the document
+  QJsonParseError error;
+  const auto document = QJsonDocument::fromJson(file.readAll(), &error);
+  if (error.error != QJsonParseError::NoError || !document.isArray())
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Command Sequence Error"),
+        tr("The sequence file is not a valid JSON array!"),
+        QMessageBox::Critical);
+    return false;
+  }
+
+  // Register the steps
+  clearSteps();
+  const auto array = document.array();
+  for (const auto &value : array)
+  {
+    const auto object = value.toObject();
+    addStep(object.value(QStringLiteral("command")).toString(),
+            object.value(QStringLiteral("expect")).toString(),
+            object.value(QStringLiteral("timeout")).toInt(DefaultStepTimeout));
+  }
+
+  return !m_steps.isEmpty();
+}
+
+/**
+ * @brief Starts executing the loaded sequence.
+ *
+ * Nothing happens when no device is connected, the sequence is empty or a
+ * sequence is already running.
+ */
+void IO::CommandSequencer::start()
+{
+  if (m_running || m_steps.isEmpty() || !Manager::instance().isConnected())
+    return;
+
+  m_index = 0;
+  m_running = true;
+  Q_EMIT runningChanged();
+  Q_EMIT progressChanged();
+
+  sendCurrentStep();
+}
+
+/**
+ * @brief Aborts the running sequence.
+ */
+void IO::CommandSequencer::abort()
+{
+  if (m_running)
+    finish(false);
+}
+
+/**
+ * @brief Removes every step of the sequence.
+ */
+void IO::CommandSequencer::clearSteps()
+{
+  abort();
+  m_steps.clear();
+  Q_EMIT sequenceChanged();
+}
+
+/**
+ * Configures the signal/slot connections with the rest of the modules of the
+ * application.
+ */
+void IO::CommandSequencer::setupExternalConnections()
+{
+  // Match received data against the pending step's matcher
+  connect(&Manager::instance(), &IO::Manager::dataReceived, this,
+          &IO::CommandSequencer::onDataReceived);
+
+  // Abort the sequence when the device is disconnected
+  connect(&Manager::instance(), &IO::Manager::connectedChanged, this, [=] {
+    if (!Manager::instance().isConnected())
+      abort();
+  });
+}
+
+/**
+ * @brief Appends a step to the sequence.
+ *
+ * @param command The command to send through the console.
+ * @param expect The response matcher: a substring, a regular expression
+ *               wrapped in forward slashes, or empty to advance right after
+ *               sending the command.
+ * @param timeout The step timeout in milliseconds (<= 0 uses the default).
+ */
+void IO::CommandSequencer::addStep(const QString &command,
+                                   const QString &expect, const int timeout)
+{
+  Step step;
+  step.command = command;
+  step.expect = expect;
+  step.timeout = timeout > 0 ? timeout : DefaultStepTimeout;
+
+  // Compile "/pattern/" matchers into regular expressions
+  if (expect.length() >= 2 && expect.startsWith(QLatin1Char('/'))
+      && expect.endsWith(QLatin1Char('/')))
+  {
+    step.pattern = QRegularExpression(expect.mid(1, expect.length() - 2));
+    if (!step.pattern.isValid())
+    {
+      Misc::Utilities::showMessageBox(
+          tr("Command Sequence Error"),
+          tr("Invalid response pattern: %1").arg(expect),
+          QMessageBox::Critical);
+      return;
+    }
+  }
+
+  m_steps.append(step);
+  Q_EMIT sequenceChanged();
+}
+
+/**
+ * @brief Fails the pending step when its response did not arrive in time.
+ */
+void IO::CommandSequencer::onStepTimeout()
+{
+  if (!m_running)
+    return;
+
+  Q_EMIT stepFailed(m_index, tr("No matching response within %1 ms")
+                                 .arg(m_steps[m_index].timeout));
+  finish(false);
+}
+
+/**
+ * @brief Matches received data against the pending step.
+ *
+ * Data is accumulated, so a response split over several chunks still
+ * matches; on a match the next command is sent immediately from this
+ * handler, which keeps the sequence running at link speed.
+ *
+ * @param data The data received from the device.
+ */
+void IO::CommandSequencer::onDataReceived(const QByteArray &data)
+{
+  if (!m_running)
+    return;
+
+  // Accumulate the response, bounded so a silent mismatch cannot grow it
+  // without limit
+  m_response.append(data);
+  if (m_response.size() > MaxResponseBytes)
+    m_response = m_response.right(MaxResponseBytes);
+
+  // Match the accumulated response against the pending step
+  const auto &step = m_steps[m_index];
+  const auto response = QString::fromUtf8(m_response);
+  bool matched;
+  if (step.pattern.isValid() && !step.pattern.pattern().isEmpty())
+    matched = step.pattern.match(response).hasMatch();
+  else
+    matched = response.contains(step.expect);
+
+  // Advance to the next step
+  if (matched)
+  {
+    m_timer.stop();
+    Q_EMIT stepPassed(m_index);
+    advance();
+  }
+}
+
+/**
+ * @brief Sends the pending step's command & arms its timeout.
+ *
+ * Steps without a matcher pass as soon as the command is sent.
+ */
+void IO::CommandSequencer::sendCurrentStep()
+{
+  while (m_running)
+  {
+    const auto &step = m_steps[m_index];
+    m_response.clear();
+    Console::instance().send(step.command);
+
+    // Await the device response
+    if (!step.expect.isEmpty())
+    {
+      m_timer.start(step.timeout);
+      break;
+    }
+
+    // No matcher, the step passes right away & the loop sends the next one
+    Q_EMIT stepPassed(m_index);
+    if (m_index + 1 >= m_steps.count())
+    {
+      finish(true);
+      break;
+    }
+
+    ++m_index;
+    Q_EMIT progressChanged();
+  }
+}
+
+/**
+ * @brief Moves on to the next step or finishes the sequence.
+ */
+void IO::CommandSequencer::advance()
+{
+  if (m_index + 1 >= m_steps.count())
+  {
+    finish(true);
+    return;
+  }
+
+  ++m_index;
+  Q_EMIT progressChanged();
+  sendCurrentStep();
+}
+
+/**
+ * @brief Ends the sequence & reports the outcome.
+ *
+ * @param success True when every step passed.
+ */
+void IO::CommandSequencer::finish(const bool success)
+{
+  m_timer.stop();
+  m_running = false;
+  m_response.clear();
+  Q_EMIT runningChanged();
+  Q_EMIT finished(success);
+}
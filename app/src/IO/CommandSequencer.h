@@ -0,0 +1,128 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QTimer>
+#include <QObject>
+#include <QVector>
+#include <QByteArray>
+#include <QRegularExpression>
+
+namespace IO
+{
+/**
+ * @class IO::CommandSequencer
+ * @brief Asynchronous command/response sequencer for scripted device flows.
+ *
+ * Console::send() is fire-and-forget, so scripted interactions (send a
+ * command, await a response pattern, send the next command) previously
+ * required external tooling. The sequencer runs a list of steps - each a
+ * command, a response matcher and a timeout - entirely on signal delivery:
+ * a step's command is sent through the console (so line endings and hex
+ * mode apply as usual), received data is accumulated until the matcher
+ * fires, and the next command goes out immediately from the match handler.
+ * A 40-command provisioning flow therefore runs at link speed without ever
+ * blocking a thread or spinning an event loop.
+ *
+ * Matchers are plain substrings, or regular expressions when wrapped in
+ * forward slashes (e.g. "/OK|ERROR \\d+/"). Steps with an empty matcher
+ * advance right after the command is sent. A step that does not match
+ * within its timeout fails the sequence.
+ *
+ * Sequences are built through addStep() or loaded from a JSON file holding
+ * an array of {"command", "expect", "timeout"} objects.
+ */
+class CommandSequencer : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool running
+             READ running
+             NOTIFY runningChanged)
+  Q_PROPERTY(int stepCount
+             READ stepCount
+             NOTIFY sequenceChanged)
+  Q_PROPERTY(int currentStep
+             READ currentStep
+             NOTIFY progressChanged)
+  // clang-format on
+
+signals:
+  void runningChanged();
+  void sequenceChanged();
+  void progressChanged();
+  void stepPassed(int index);
+  void stepFailed(int index, const QString &reason);
+  void finished(bool success);
+
+private:
+  explicit CommandSequencer();
+  CommandSequencer(CommandSequencer &&) = delete;
+  CommandSequencer(const CommandSequencer &) = delete;
+  CommandSequencer &operator=(CommandSequencer &&) = delete;
+  CommandSequencer &operator=(const CommandSequencer &) = delete;
+
+public:
+  static CommandSequencer &instance();
+
+  [[nodiscard]] bool running() const;
+  [[nodiscard]] int stepCount() const;
+  [[nodiscard]] int currentStep() const;
+
+  Q_INVOKABLE bool loadSequence(const QString &path);
+
+public slots:
+  void start();
+  void abort();
+  void clearSteps();
+  void setupExternalConnections();
+  void addStep(const QString &command, const QString &expect,
+               const int timeout);
+
+private slots:
+  void onStepTimeout();
+  void onDataReceived(const QByteArray &data);
+
+private:
+  void sendCurrentStep();
+  void advance();
+  void finish(const bool success);
+
+private:
+  /**
+   * @brief A single command/response exchange of the sequence.
+   */
+  struct Step
+  {
+    QString command;
+    QString expect;
+    QRegularExpression pattern;
+    int timeout;
+  };
+
+  bool m_running;
+  int m_index;
+  QTimer m_timer;
+  QByteArray m_response;
+  QVector<Step> m_steps;
+};
+} // namespace IO
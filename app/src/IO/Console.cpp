@@ -19,13 +19,45 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <QDir>
 #include <QFile>
 #include <QDateTime>
+#include <QStandardPaths>
 
 #include "IO/Manager.h"
 #include "IO/Console.h"
+#include "SIMD/SIMD.h"
 #include "Misc/Translator.h"
 
+/**
+ * @brief Size of each chunk in the append-only console history rope.
+ *
+ * Every chunk except the last one is kept exactly this size, so locating the
+ * chunk that holds a given byte offset is pure integer arithmetic.
+ */
+static constexpr qsizetype HistoryChunkSize = 256 * 1024;
+
+/**
+ * @brief Maximum number of raw bytes retained in the console history.
+ *
+ * Once the cap is exceeded, whole chunks are dropped from the front of the
+ * rope and the line-offset index is trimmed accordingly.
+ */
+static constexpr quint64 MaxHistorySize = 16 * 1024 * 1024;
+
+/**
+ * @brief Echo governor thresholds (see Console::onDataSent()).
+ *
+ * When more than @c EchoBulkThreshold bytes are echoed within a
+ * @c EchoWindowMs window, the console stops formatting every transmitted
+ * chunk and aggregates the traffic into one summary line every
+ * @c EchoSummaryIntervalMs instead. Interactive sessions never reach the
+ * threshold and keep the classic per-write echo.
+ */
+static constexpr qint64 EchoWindowMs = 250;
+static constexpr qint64 EchoBulkThreshold = 8 * 1024;
+static constexpr int EchoSummaryIntervalMs = 500;
+
 /**
  * Constructor function
  */
@@ -39,9 +71,32 @@ IO::Console::Console()
   , m_showTimestamp(false)
   , m_isStartingLine(true)
   , m_lastCharWasCR(false)
-  , m_textBuffer(10 * 1024)
+  , m_summarizeBulkEcho(true)
+  , m_echoSummaryActive(false)
+  , m_echoSummaryWrites(0)
+  , m_echoWindowBytes(0)
+  , m_echoWindowStart(0)
+  , m_echoSummaryBytes(0)
+  , m_historySize(0)
+  , m_historyBase(0)
 {
   clear();
+
+  // Load the persisted command history & keep appending to its log file
+  const auto dataPath
+      = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+  if (!dataPath.isEmpty())
+  {
+    QDir().mkpath(dataPath);
+    m_commandHistory.loadFrom(dataPath
+                              + QStringLiteral("/command-history.txt"));
+    m_historyItem = m_commandHistory.count();
+  }
+
+  // Coalesce bulk TX echo into periodic summary lines
+  m_echoSummaryTimer.setInterval(EchoSummaryIntervalMs);
+  connect(&m_echoSummaryTimer, &QTimer::timeout, this,
+          &IO::Console::flushEchoSummary);
 }
 
 /**
@@ -70,6 +125,15 @@ bool IO::Console::showTimestamp() const
   return m_showTimestamp;
 }
 
+/**
+ * Returns @c true if bulk transmissions are echoed as periodic byte-count
+ * summaries instead of formatting every chunk.
+ */
+bool IO::Console::summarizeBulkEcho() const
+{
+  return m_summarizeBulkEcho;
+}
+
 /**
  * Returns the number of lines that terminal display widgets should limit
  * scrollback to. You can change this value by calling the setScrollback()
@@ -83,6 +147,46 @@ int IO::Console::scrollback() const
   return m_scrollback;
 }
 
+/**
+ * @brief Returns the number of display lines stored in the console history.
+ *
+ * In hexadecimal mode every 16 raw bytes form one dump row; in plain-text
+ * mode the count comes from the line-offset index maintained while data is
+ * appended, so no scan of the history is required.
+ */
+int IO::Console::historyLineCount() const
+{
+  if (displayMode() == DisplayMode::DisplayHexadecimal)
+    return static_cast<int>((m_historySize - m_historyBase + 15) / 16);
+
+  return m_lineOffsets.count();
+}
+
+/**
+ * @brief Releases container slack accumulated by the scrollback history.
+ *
+ * Long sessions trim the history from the front as the scrollback limit is
+ * enforced, which leaves the line offset table and the chunk list with
+ * capacity for lines that no longer exist. Both containers are shrunk to
+ * their live size; the chunk payloads themselves are sealed at a fixed size
+ * and carry no slack worth reclaiming. Called from the idle-time compaction
+ * pass, the containers simply regrow when traffic resumes.
+ *
+ * @return An estimate of the number of bytes returned to the heap.
+ */
+qsizetype IO::Console::compactMemory()
+{
+  qsizetype freed = (m_lineOffsets.capacity() - m_lineOffsets.count())
+                    * static_cast<qsizetype>(sizeof(quint64));
+  m_lineOffsets.squeeze();
+
+  freed += (m_historyChunks.capacity() - m_historyChunks.count())
+           * static_cast<qsizetype>(sizeof(QByteArray));
+  m_historyChunks.squeeze();
+
+  return freed;
+}
+
 /**
  * Returns the type of data that the user inputs to the console. There are two
  * possible values:
@@ -133,8 +237,8 @@ IO::Console::DisplayMode IO::Console::displayMode() const
  */
 QString IO::Console::currentHistoryString() const
 {
-  if (m_historyItem < m_historyItems.count() && m_historyItem >= 0)
-    return m_historyItems.at(m_historyItem);
+  if (m_historyItem < m_commandHistory.count() && m_historyItem >= 0)
+    return m_commandHistory.at(m_historyItem);
 
   return "";
 }
@@ -226,6 +330,65 @@ QString IO::Console::formatUserHex(const QString &text)
   return str;
 }
 
+/**
+ * @brief Formats a range of history lines for display.
+ *
+ * Only the requested lines are rendered, so scrolling through the history
+ * costs O(viewport) instead of O(history): the raw bytes for the range are
+ * located through the chunked rope and formatted on the fly with the active
+ * display mode.
+ *
+ * @param firstLine Index of the first line to render (0-based).
+ * @param count Number of lines to render.
+ * @return The formatted text for the requested range.
+ */
+QString IO::Console::historyLines(const int firstLine, const int count) const
+{
+  // Validate the requested range
+  const int lines = historyLineCount();
+  if (firstLine < 0 || count <= 0 || firstLine >= lines)
+    return QString();
+
+  const int last = qMin(firstLine + count, lines);
+
+  // Hexadecimal mode, each row covers 16 raw bytes
+  if (displayMode() == DisplayMode::DisplayHexadecimal)
+  {
+    const quint64 start = m_historyBase + static_cast<quint64>(firstLine) * 16;
+    const qsizetype length = static_cast<qsizetype>(last - firstLine) * 16;
+    return hexadecimalStr(historyBytes(start, length), start);
+  }
+
+  // Plain-text mode, resolve the byte range through the line-offset index
+  const quint64 start = m_lineOffsets.at(firstLine);
+  const quint64 end = (last < m_lineOffsets.count())
+                          ? m_lineOffsets.at(last)
+                          : m_historySize;
+  return plainTextStr(historyBytes(start, static_cast<qsizetype>(end - start)));
+}
+
+/**
+ * @brief Returns the sent commands starting with the given prefix.
+ *
+ * Reverse-search style recall over the command history: matches are ordered
+ * newest first and resolved through the history's prefix index, so the
+ * lookup cost is bounded by the number of matching commands rather than the
+ * size of the history. An empty prefix returns the most recent commands.
+ *
+ * @param prefix Case-insensitive prefix to match commands against.
+ * @param limit Maximum number of commands to return.
+ */
+QStringList IO::Console::searchHistory(const QString &prefix,
+                                       const int limit) const
+{
+  QStringList commands;
+  const auto matches = m_commandHistory.prefixMatches(prefix, limit);
+  for (const int position : matches)
+    commands.append(m_commandHistory.at(position));
+
+  return commands;
+}
+
 /**
  * Converts the given @a data in HEX format into real binary data.
  */
@@ -274,9 +437,14 @@ QByteArray IO::Console::hexToBytes(const QString &data)
  */
 void IO::Console::clear()
 {
-  m_textBuffer.clear();
+  m_historySize = 0;
+  m_historyBase = 0;
+  m_lineOffsets.clear();
+  m_historyChunks.clear();
   m_isStartingLine = true;
   m_lastCharWasCR = false;
+  m_pendingUtf8.clear();
+  Q_EMIT historyChanged();
 }
 
 /**
@@ -304,7 +472,7 @@ void IO::Console::historyUp()
  */
 void IO::Console::historyDown()
 {
-  if (m_historyItem < m_historyItems.count() - 1)
+  if (m_historyItem < m_commandHistory.count() - 1)
   {
     ++m_historyItem;
     Q_EMIT historyItemChanged();
@@ -399,6 +567,27 @@ void IO::Console::setEcho(const bool enabled)
   }
 }
 
+/**
+ * Enables/disables the echo governor for bulk transmissions. Disabling it
+ * while a bulk transfer is in progress flushes the pending summary and
+ * resumes per-write echo immediately.
+ */
+void IO::Console::setSummarizeBulkEcho(const bool enabled)
+{
+  if (summarizeBulkEcho() != enabled)
+  {
+    m_summarizeBulkEcho = enabled;
+    if (!enabled && m_echoSummaryActive)
+    {
+      flushEchoSummary();
+      m_echoSummaryActive = false;
+      m_echoSummaryTimer.stop();
+    }
+
+    Q_EMIT summarizeBulkEchoChanged();
+  }
+}
+
 /**
  * Modifies the number of lines that can be displayed by the terminal widget.
  */
@@ -507,15 +696,161 @@ void IO::Console::append(const QString &string, const bool addTimestamp)
     tokens.removeFirst();
   }
 
-  // Add data to saved text buffer
-  m_textBuffer.append(processedString.toUtf8());
-
   // Update UI
   QMetaObject::invokeMethod(
       this, [=] { Q_EMIT displayString(processedString); },
       Qt::QueuedConnection);
 }
 
+/**
+ * @brief Byte-domain display path for plain-text mode.
+ *
+ * Processes the incoming bytes directly instead of widening them to UTF-16
+ * first: printable ASCII runs are located with the SIMD scanner and copied in
+ * bulk, line endings are normalized in place, timestamps are inserted at line
+ * starts and UTF-8 sequences are validated byte-wise — valid characters pass
+ * through intact (where the legacy path replaced every non-ASCII byte with a
+ * dot), invalid bytes become '.' and an incomplete trailing sequence is held
+ * back until the next chunk completes it. The single UTF-16 conversion
+ * happens once, on the finished buffer, right before the text is handed to
+ * the terminal for glyph layout, so the display hot path touches each
+ * payload byte once instead of walking it three times as QChars.
+ */
+void IO::Console::appendBytes(const QByteArray &bytes, const bool addTimestamp)
+{
+  // Abort on empty chunks
+  if (bytes.isEmpty())
+    return;
+
+  // Prepend the incomplete UTF-8 sequence held back from the previous chunk
+  QByteArray data;
+  if (!m_pendingUtf8.isEmpty())
+  {
+    data = m_pendingUtf8 + bytes;
+    m_pendingUtf8.clear();
+  }
+  else
+    data = bytes;
+
+  // Omit leading \n if a trailing \r was already rendered from previous chunk
+  const char *src = data.constData();
+  const qsizetype len = data.size();
+  qsizetype i = 0;
+  if (m_lastCharWasCR && src[0] == '\n')
+    ++i;
+
+  // Record trailing \r
+  m_lastCharWasCR = (src[len - 1] == '\r');
+
+  // Render the timestamp into bytes once per chunk
+  QByteArray timestamp;
+  if (addTimestamp)
+  {
+    timestamp = QDateTime::currentDateTime()
+                    .toString(QStringLiteral("HH:mm:ss.zzz -> "))
+                    .toLatin1();
+  }
+
+  // Inserts the timestamp when visible content starts a new line
+  QByteArray out;
+  out.reserve(len + timestamp.size());
+  const auto beginContent = [&] {
+    if (m_isStartingLine)
+    {
+      out += timestamp;
+      m_isStartingLine = false;
+    }
+  };
+
+  // Single pass over the payload bytes
+  while (i < len)
+  {
+    // Bulk-copy printable ASCII runs located with the SIMD scanner
+    const auto run = SIMD::printableAsciiRun(src + i, len - i);
+    if (run > 0)
+    {
+      beginContent();
+      out.append(src + i, run);
+      i += run;
+      continue;
+    }
+
+    // Normalize \r\n & bare \r into \n
+    const auto byte = static_cast<unsigned char>(src[i]);
+    if (byte == '\r' || byte == '\n')
+    {
+      if (byte == '\r' && i + 1 < len && src[i + 1] == '\n')
+        ++i;
+
+      out.append('\n');
+      m_isStartingLine = true;
+      ++i;
+    }
+
+    // Keep control bytes for the terminal's escape-sequence handling
+    else if (byte < 0x80)
+    {
+      out.append(byte == '\0' ? '.' : src[i]);
+      ++i;
+    }
+
+    // Multi-byte UTF-8 sequence, validate the continuation bytes
+    else
+    {
+      // Determine the sequence length from the lead byte
+      qsizetype seqLen = 0;
+      if (byte >= 0xC2 && byte <= 0xDF)
+        seqLen = 2;
+      else if (byte >= 0xE0 && byte <= 0xEF)
+        seqLen = 3;
+      else if (byte >= 0xF0 && byte <= 0xF4)
+        seqLen = 4;
+
+      // Stray continuation or invalid lead byte
+      if (seqLen == 0)
+      {
+        out.append('.');
+        ++i;
+        continue;
+      }
+
+      // Sequence split across chunks, hold the tail for the next delivery
+      if (i + seqLen > len)
+      {
+        m_pendingUtf8 = QByteArray(src + i, len - i);
+        break;
+      }
+
+      // Copy valid characters intact, replace malformed ones with a dot
+      bool valid = true;
+      for (qsizetype j = 1; j < seqLen; ++j)
+        valid &= (static_cast<unsigned char>(src[i + j]) & 0xC0) == 0x80;
+
+      if (valid)
+      {
+        beginContent();
+        out.append(src + i, seqLen);
+        i += seqLen;
+      }
+
+      else
+      {
+        out.append('.');
+        ++i;
+      }
+    }
+  }
+
+  // Convert to UTF-16 once & hand the finished text to the terminal
+  if (out.isEmpty())
+    return;
+
+  const auto processedString = QString::fromUtf8(out);
+  QMetaObject::invokeMethod(
+      this, [=] { Q_EMIT displayString(processedString); },
+      Qt::QueuedConnection);
+}
+
 /**
  * Displays the given @a data in the console. @c QByteArray to ~@c QString
  * conversion is done by the @c dataToString() function, which displays incoming
@@ -523,30 +858,94 @@ void IO::Console::append(const QString &string, const bool addTimestamp)
  */
 void IO::Console::onDataSent(const QByteArray &data)
 {
-  if (echo())
+  if (!echo())
+    return;
+
+  // Echo governor: once the transmitted volume inside the sampling window
+  // crosses the bulk threshold (e.g. FileTransmission streaming a file),
+  // stop formatting individual chunks (and recording them into the history
+  // rope) and aggregate the traffic into the summary line flushed by
+  // flushEchoSummary(). This keeps transmit pacing independent of console
+  // rendering cost.
+  if (m_summarizeBulkEcho)
+  {
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    if (now - m_echoWindowStart >= EchoWindowMs)
+    {
+      m_echoWindowStart = now;
+      m_echoWindowBytes = 0;
+    }
+
+    m_echoWindowBytes += data.size();
+    if (m_echoSummaryActive || m_echoWindowBytes > EchoBulkThreshold)
+    {
+      m_echoSummaryActive = true;
+      m_echoSummaryBytes += data.size();
+      ++m_echoSummaryWrites;
+
+      if (!m_echoSummaryTimer.isActive())
+        m_echoSummaryTimer.start();
+
+      return;
+    }
+  }
+
+  appendToHistory(data);
+  if (displayMode() == DisplayMode::DisplayPlainText)
+    appendBytes(QByteArray(data).append('\n'), showTimestamp());
+  else
     append(dataToString(data) + QStringLiteral("\n"), showTimestamp());
 }
 
+/**
+ * Appends one summary line for the TX traffic coalesced by the echo governor
+ * since the previous flush. When an interval elapses without any traffic the
+ * burst is considered over and per-write echo resumes.
+ */
+void IO::Console::flushEchoSummary()
+{
+  if (m_echoSummaryBytes > 0)
+  {
+    append(tr("[ TX: %1 bytes in %2 writes ]")
+               .arg(m_echoSummaryBytes)
+               .arg(m_echoSummaryWrites)
+           + QStringLiteral("\n"),
+           showTimestamp());
+    m_echoSummaryBytes = 0;
+    m_echoSummaryWrites = 0;
+  }
+
+  else
+  {
+    m_echoSummaryActive = false;
+    m_echoSummaryTimer.stop();
+  }
+}
+
 /**
  * Displays the given @a data in the console
  */
 void IO::Console::onDataReceived(const QByteArray &data)
 {
-  append(dataToString(data), showTimestamp());
+  appendToHistory(data);
+  if (displayMode() == DisplayMode::DisplayPlainText)
+    appendBytes(data, showTimestamp());
+  else
+    append(dataToString(data), showTimestamp());
 }
 
 /**
  * Registers the given @a command to the list of sent commands.
+ *
+ * The history is a bounded ring with a prefix index & an append-only log
+ * file (see @c IO::CommandHistory), so registering a command is O(1) no
+ * matter how many commands a session accumulates, and the list survives
+ * application restarts.
  */
 void IO::Console::addToHistory(const QString &command)
 {
-  // Remove old commands from history
-  while (m_historyItems.count() > 100)
-    m_historyItems.removeFirst();
-
-  // Register command
-  m_historyItems.append(command);
-  m_historyItem = m_historyItems.count();
+  m_commandHistory.append(command);
+  m_historyItem = m_commandHistory.count();
   Q_EMIT historyItemChanged();
 }
 
@@ -579,7 +978,7 @@ QString IO::Console::dataToString(const QByteArray &data)
  * @param data The QByteArray to convert.
  * @return QString A human-readable string representation of the input data.
  */
-QString IO::Console::plainTextStr(const QByteArray &data)
+QString IO::Console::plainTextStr(const QByteArray &data) const
 {
   // Filter out non-printable characters, but keep line breaks
   QString filteredData;
@@ -605,18 +1004,40 @@ QString IO::Console::plainTextStr(const QByteArray &data)
 
 /**
  * Converts the given @a data into a HEX representation string.
+ *
+ * The hex pairs for the whole payload are produced in a single vectorized
+ * pass (see SIMD::hexEncode()), and each dump row is assembled in a small
+ * stack buffer that is appended to the output in one call, so no per-byte
+ * Qt string formatting is involved.
+ *
+ * @param data The bytes to render as a hex dump.
+ * @param baseOffset Offset of the first byte within the overall stream, used
+ *                   for the address column when rendering history ranges.
  */
-QString IO::Console::hexadecimalStr(const QByteArray &data)
+QString IO::Console::hexadecimalStr(const QByteArray &data,
+                                    const quint64 baseOffset) const
 {
   // Initialize parameters
   QString out;
   constexpr auto rowSize = 16;
 
+  // Encode every byte as a lowercase hex pair in one vectorized pass
+  QByteArray hexPairs(data.length() * 2, Qt::Uninitialized);
+  SIMD::hexEncode(data.constData(), data.length(), hexPairs.data());
+
+  // Reserve room for all rows up front
+  const auto rows = (data.length() + rowSize - 1) / rowSize;
+  out.reserve(rows * 80);
+
   // Print hexadecimal row by row
   for (int i = 0; i < data.length(); i += rowSize)
   {
     // Add offset to output
-    out += QStringLiteral("%1 | ").arg(i, 6, 16, QLatin1Char('0'));
+    out += QStringLiteral("%1 | ").arg(baseOffset + i, 6, 16, QLatin1Char('0'));
+
+    // Assemble the hex & ASCII columns in a stack buffer
+    char row[rowSize * 4 + 6];
+    char *p = row;
 
     // Print hexadecimal bytes
     for (int j = 0; j < rowSize; ++j)
@@ -624,43 +1045,151 @@ QString IO::Console::hexadecimalStr(const QByteArray &data)
       // Print existing data
       if (i + j < data.length())
       {
-        out += QStringLiteral("%1 ").arg(
-            static_cast<unsigned char>(data[i + j]), 2, 16, QLatin1Char('0'));
+        *p++ = hexPairs.at(2 * (i + j));
+        *p++ = hexPairs.at(2 * (i + j) + 1);
+        *p++ = ' ';
       }
 
       // Space out inexistent data
       else
-        out += QStringLiteral("   ");
+      {
+        *p++ = ' ';
+        *p++ = ' ';
+        *p++ = ' ';
+      }
 
       // Add padding in 8th byte
       if ((j + 1) == 8)
-        out += ' ';
+        *p++ = ' ';
     }
 
     // Add ASCII representation
-    out += QStringLiteral("| ");
+    *p++ = '|';
+    *p++ = ' ';
     for (int j = 0; j < rowSize; ++j)
     {
       // Add existing data
       if (i + j < data.length())
       {
         char c = data[i + j];
-        if (std::isprint(static_cast<unsigned char>(c)))
-          out += c;
-        else
-          out += '.';
+        *p++ = std::isprint(static_cast<unsigned char>(c)) ? c : '.';
       }
 
       // Add space for inexisting data
       else
-        out += ' ';
+        *p++ = ' ';
     }
 
-    // Add line break
-    out += QStringLiteral(" |\n");
+    // Add line break & append the row in one call
+    *p++ = ' ';
+    *p++ = '|';
+    *p++ = '\n';
+    out += QLatin1String(row, p - row);
   }
 
   // Add additional line break & return data
   out += "\n";
   return out;
 }
+
+/**
+ * @brief Appends raw bytes to the chunked console history rope.
+ *
+ * Data is stored unformatted: formatting into hex or plain text only happens
+ * lazily when a viewport requests lines through historyLines(). The rope
+ * keeps every chunk except the last at exactly HistoryChunkSize bytes, and a
+ * line-offset index records where each plain-text line starts. When the
+ * retained history exceeds MaxHistorySize, whole chunks are dropped from the
+ * front and the index is trimmed with them.
+ *
+ * @param data The raw bytes to record.
+ */
+void IO::Console::appendToHistory(const QByteArray &data)
+{
+  // First byte of the history starts the first line
+  if (m_lineOffsets.isEmpty() && !data.isEmpty())
+    m_lineOffsets.append(m_historySize);
+
+  // Update the line-offset index while the data is still in cache
+  for (qsizetype i = 0; i < data.size(); ++i)
+  {
+    if (data.at(i) == '\n')
+      m_lineOffsets.append(m_historySize + i + 1);
+  }
+
+  // Distribute the data over fixed-size chunks
+  qsizetype offset = 0;
+  while (offset < data.size())
+  {
+    if (m_historyChunks.isEmpty()
+        || m_historyChunks.last().size() >= HistoryChunkSize)
+    {
+      m_historyChunks.append(QByteArray());
+      m_historyChunks.last().reserve(HistoryChunkSize);
+    }
+
+    auto &chunk = m_historyChunks.last();
+    const qsizetype room = HistoryChunkSize - chunk.size();
+    const qsizetype take = qMin(room, data.size() - offset);
+    chunk.append(data.constData() + offset, take);
+    offset += take;
+  }
+
+  // Update the global history size
+  m_historySize += data.size();
+
+  // Drop whole chunks from the front once the cap is exceeded
+  while (m_historySize - m_historyBase > MaxHistorySize
+         && m_historyChunks.count() > 1)
+  {
+    m_historyBase += m_historyChunks.first().size();
+    m_historyChunks.removeFirst();
+
+    while (!m_lineOffsets.isEmpty() && m_lineOffsets.first() < m_historyBase)
+      m_lineOffsets.removeFirst();
+  }
+
+  // Notify viewport models
+  Q_EMIT historyChanged();
+}
+
+/**
+ * @brief Copies a byte range out of the chunked history rope.
+ *
+ * Locating the first chunk is integer arithmetic because every chunk except
+ * the last one is exactly HistoryChunkSize bytes, so the cost of this call is
+ * proportional to the requested length, not to the history size.
+ *
+ * @param start Global byte offset of the range (must be >= m_historyBase).
+ * @param length Number of bytes to copy.
+ * @return The requested bytes, clamped to the end of the history.
+ */
+QByteArray IO::Console::historyBytes(const quint64 start,
+                                     const qsizetype length) const
+{
+  QByteArray out;
+  if (start < m_historyBase || start >= m_historySize || length <= 0)
+    return out;
+
+  // Clamp the range to the retained history
+  const quint64 end = qMin(m_historySize, start + length);
+  out.reserve(static_cast<qsizetype>(end - start));
+
+  // Walk the chunks that cover the range
+  quint64 rel = start - m_historyBase;
+  qsizetype chunkIdx = static_cast<qsizetype>(rel / HistoryChunkSize);
+  qsizetype chunkPos = static_cast<qsizetype>(rel % HistoryChunkSize);
+  quint64 remaining = end - start;
+  while (remaining > 0 && chunkIdx < m_historyChunks.count())
+  {
+    const auto &chunk = m_historyChunks.at(chunkIdx);
+    const qsizetype take
+        = qMin<qsizetype>(chunk.size() - chunkPos, remaining);
+    out.append(chunk.constData() + chunkPos, take);
+    remaining -= take;
+    chunkPos = 0;
+    ++chunkIdx;
+  }
+
+  return out;
+}
@@ -22,7 +22,10 @@
 #pragma once
 
 #include <QObject>
-#include "IO/CircularBuffer.h"
+#include <QTimer>
+#include <QVector>
+
+#include "IO/CommandHistory.h"
 
 namespace IO
 {
@@ -44,6 +47,10 @@ class Console : public QObject
              READ echo
              WRITE setEcho
              NOTIFY echoChanged)
+  Q_PROPERTY(bool summarizeBulkEcho
+             READ summarizeBulkEcho
+             WRITE setSummarizeBulkEcho
+             NOTIFY summarizeBulkEchoChanged)
   Q_PROPERTY(bool showTimestamp
              READ showTimestamp
              WRITE setShowTimestamp
@@ -76,15 +83,20 @@ class Console : public QObject
              READ scrollback
              WRITE setScrollback
              NOTIFY scrollbackChanged)
+  Q_PROPERTY(int historyLineCount
+             READ historyLineCount
+             NOTIFY historyChanged)
   // clang-format on
 
 signals:
   void echoChanged();
   void dataModeChanged();
+  void summarizeBulkEchoChanged();
   void languageChanged();
   void scrollbackChanged();
   void lineEndingChanged();
   void displayModeChanged();
+  void historyChanged();
   void historyItemChanged();
   void textDocumentChanged();
   void showTimestampChanged();
@@ -125,6 +137,7 @@ public:
 
   [[nodiscard]] bool echo() const;
   [[nodiscard]] bool showTimestamp() const;
+  [[nodiscard]] bool summarizeBulkEcho() const;
 
   [[nodiscard]] int scrollback() const;
   [[nodiscard]] DataMode dataMode() const;
@@ -136,8 +149,15 @@ public:
   [[nodiscard]] QStringList lineEndings() const;
   [[nodiscard]] QStringList displayModes() const;
 
+  [[nodiscard]] int historyLineCount() const;
+
+  qsizetype compactMemory();
+
   Q_INVOKABLE bool validateUserHex(const QString &text);
   Q_INVOKABLE QString formatUserHex(const QString &text);
+  Q_INVOKABLE QString historyLines(const int firstLine, const int count) const;
+  Q_INVOKABLE QStringList searchHistory(const QString &prefix,
+                                        const int limit = 10) const;
 
   static QByteArray hexToBytes(const QString &data);
 
@@ -150,20 +170,27 @@ public slots:
   void setEcho(const bool enabled);
   void setScrollback(const int lines);
   void setShowTimestamp(const bool enabled);
+  void setSummarizeBulkEcho(const bool enabled);
   void setDataMode(const IO::Console::DataMode &mode);
   void setLineEnding(const IO::Console::LineEnding &mode);
   void setDisplayMode(const IO::Console::DisplayMode &mode);
   void append(const QString &str, const bool addTimestamp = false);
 
 private slots:
+  void flushEchoSummary();
   void onDataSent(const QByteArray &data);
   void addToHistory(const QString &command);
   void onDataReceived(const QByteArray &data);
 
 private:
+  void appendBytes(const QByteArray &bytes, const bool addTimestamp = false);
   QString dataToString(const QByteArray &data);
-  QString plainTextStr(const QByteArray &data);
-  QString hexadecimalStr(const QByteArray &data);
+  QString plainTextStr(const QByteArray &data) const;
+  QString hexadecimalStr(const QByteArray &data,
+                         const quint64 baseOffset = 0) const;
+
+  void appendToHistory(const QByteArray &data);
+  QByteArray historyBytes(const quint64 start, const qsizetype length) const;
 
 private:
   DataMode m_dataMode;
@@ -178,9 +205,23 @@ private:
   bool m_isStartingLine;
   bool m_lastCharWasCR;
 
-  QStringList m_historyItems;
+  // Echo governor state, see onDataSent() & flushEchoSummary()
+  bool m_summarizeBulkEcho;
+  bool m_echoSummaryActive;
+  int m_echoSummaryWrites;
+  qint64 m_echoWindowBytes;
+  qint64 m_echoWindowStart;
+  qint64 m_echoSummaryBytes;
+  QTimer m_echoSummaryTimer;
+
+  CommandHistory m_commandHistory;
 
   QString m_printFont;
-  CircularBuffer<QByteArray, char> m_textBuffer;
+  QByteArray m_pendingUtf8;
+
+  quint64 m_historySize;
+  quint64 m_historyBase;
+  QVector<quint64> m_lineOffsets;
+  QVector<QByteArray> m_historyChunks;
 };
 } // namespace IO
@@ -0,0 +1,295 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/ConsoleLogger.h"
+
+#include <QDataStream>
+#include <QStandardPaths>
+
+#include "AppInfo.h"
+#include "IO/Console.h"
+#include "IO/Manager.h"
+#include "Misc/TimerEvents.h"
+
+/**
+ * @brief Number of days a log segment is kept before it is deleted.
+ */
+static constexpr int RetentionDays = 30;
+
+//------------------------------------------------------------------------------
+// IO::ConsoleLoggerWorker implementation
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Closes the current segment & its index file.
+ */
+void IO::ConsoleLoggerWorker::closeFile()
+{
+  if (m_file.isOpen())
+  {
+    m_file.close();
+    m_indexFile.close();
+    m_segmentHour.clear();
+    Q_EMIT openChanged(false);
+  }
+}
+
+/**
+ * @brief Compresses the given chunk & appends it to the current segment.
+ *
+ * A new segment is opened lazily on the first chunk and whenever the hour
+ * changes, so every file covers at most one hour of output. The chunk offset
+ * and timestamp are appended to the sidecar index before the chunk itself,
+ * which keeps the index valid even if the process dies mid-write.
+ *
+ * @param data UTF-8 console text to record.
+ * @param timestamp Capture time of the chunk (msecs since epoch).
+ */
+void IO::ConsoleLoggerWorker::writeChunk(const QByteArray &data,
+                                         const qint64 timestamp)
+{
+  // Validate input
+  if (data.isEmpty())
+    return;
+
+  // Rotate the segment at hour boundaries
+  const auto now = QDateTime::fromMSecsSinceEpoch(timestamp);
+  const auto hour = now.toString(QStringLiteral("yyyy_MM_dd_HH"));
+  if (m_file.isOpen() && hour != m_segmentHour)
+    closeFile();
+
+  // Open a new segment when required
+  if (!m_file.isOpen())
+  {
+    openSegment(now);
+    m_segmentHour = hour;
+    if (!m_file.isOpen())
+      return;
+  }
+
+  // Register the chunk in the timestamp index
+  QDataStream index(&m_indexFile);
+  index.setVersion(QDataStream::Qt_6_0);
+  index << timestamp << qint64(m_file.pos());
+  m_indexFile.flush();
+
+  // Compress & append the chunk to the segment
+  QDataStream out(&m_file);
+  out.setVersion(QDataStream::Qt_6_0);
+  out << timestamp << qCompress(data);
+  m_file.flush();
+}
+
+/**
+ * @brief Opens a new log segment named after the given date/time.
+ *
+ * Also deletes segments that have outlived the retention window, so the log
+ * directory never grows without bound.
+ *
+ * @param now Date/time used to name the segment files.
+ */
+void IO::ConsoleLoggerWorker::openSegment(const QDateTime &now)
+{
+  // Resolve the log directory on first use
+  if (m_basePath.isEmpty())
+    m_basePath = QStringLiteral("%1/%2/Console Logs")
+                     .arg(QStandardPaths::writableLocation(
+                              QStandardPaths::DocumentsLocation),
+                          APP_NAME);
+
+  // Generate file path if required
+  QDir dir(m_basePath);
+  if (!dir.exists())
+    dir.mkpath(QStringLiteral("."));
+
+  // Enforce the retention window
+  pruneOldSegments(dir);
+
+  // Open the segment & its sidecar index
+  const auto base = now.toString(QStringLiteral("yyyy_MMM_dd HH_mm_ss"));
+  m_file.setFileName(dir.filePath(base + QStringLiteral(".sslog")));
+  m_indexFile.setFileName(dir.filePath(base + QStringLiteral(".sslog.idx")));
+  if (!m_file.open(QIODevice::WriteOnly)
+      || !m_indexFile.open(QIODevice::WriteOnly))
+  {
+    m_file.close();
+    m_indexFile.close();
+    return;
+  }
+
+  Q_EMIT openChanged(true);
+}
+
+/**
+ * @brief Deletes log segments older than the retention window.
+ *
+ * @param dir The console log directory.
+ */
+void IO::ConsoleLoggerWorker::pruneOldSegments(const QDir &dir)
+{
+  const auto cutoff = QDateTime::currentDateTime().addDays(-RetentionDays);
+  const auto entries
+      = dir.entryInfoList(QStringList{QStringLiteral("*.sslog"),
+                                      QStringLiteral("*.sslog.idx")},
+                          QDir::Files);
+  for (const auto &entry : entries)
+  {
+    if (entry.lastModified() < cutoff)
+      QFile::remove(entry.absoluteFilePath());
+  }
+}
+
+//------------------------------------------------------------------------------
+// IO::ConsoleLogger implementation
+//------------------------------------------------------------------------------
+
+/**
+ * Constructor function, starts the dedicated logger thread that compresses
+ * and writes the buffered console output.
+ */
+IO::ConsoleLogger::ConsoleLogger()
+  : m_fileOpen(false)
+  , m_loggingEnabled(false)
+{
+  // Start the dedicated logger thread
+  m_worker = new ConsoleLoggerWorker();
+  m_worker->moveToThread(&m_workerThread);
+  m_workerThread.start();
+
+  // Hand chunks & close requests to the logger thread
+  connect(this, &ConsoleLogger::writeRequested, m_worker,
+          &ConsoleLoggerWorker::writeChunk, Qt::QueuedConnection);
+  connect(this, &ConsoleLogger::closeRequested, m_worker,
+          &ConsoleLoggerWorker::closeFile, Qt::QueuedConnection);
+
+  // Mirror the file state of the logger thread
+  connect(
+      m_worker, &ConsoleLoggerWorker::openChanged, this,
+      [=](bool open) {
+        m_fileOpen = open;
+        Q_EMIT openChanged();
+      },
+      Qt::QueuedConnection);
+}
+
+/**
+ * Flush the remaining console data & stop the logger thread.
+ */
+IO::ConsoleLogger::~ConsoleLogger()
+{
+  flushBuffer();
+  QMetaObject::invokeMethod(m_worker, &ConsoleLoggerWorker::closeFile,
+                            Qt::BlockingQueuedConnection);
+
+  m_workerThread.quit();
+  m_workerThread.wait();
+
+  delete m_worker;
+  m_worker = nullptr;
+}
+
+/**
+ * Returns a pointer to the only instance of this class.
+ */
+IO::ConsoleLogger &IO::ConsoleLogger::instance()
+{
+  static ConsoleLogger singleton;
+  return singleton;
+}
+
+/**
+ * Returns @c true while a log segment is open.
+ */
+bool IO::ConsoleLogger::isOpen() const
+{
+  return m_fileOpen;
+}
+
+/**
+ * Returns @c true if compressed console logging is enabled.
+ */
+bool IO::ConsoleLogger::loggingEnabled() const
+{
+  return m_loggingEnabled;
+}
+
+/**
+ * Flushes the pending buffer & closes the current log segment.
+ */
+void IO::ConsoleLogger::closeFile()
+{
+  flushBuffer();
+  Q_EMIT closeRequested();
+}
+
+/**
+ * Configures the signal/slot connections with the modules of the application
+ * that this module depends upon.
+ */
+void IO::ConsoleLogger::setupExternalConnections()
+{
+  connect(&IO::Console::instance(), &IO::Console::displayString, this,
+          &IO::ConsoleLogger::registerData);
+  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
+          &IO::ConsoleLogger::closeFile);
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &IO::ConsoleLogger::flushBuffer);
+}
+
+/**
+ * Enables or disables the compressed console log recorder.
+ */
+void IO::ConsoleLogger::setLoggingEnabled(const bool enabled)
+{
+  m_loggingEnabled = enabled;
+  Q_EMIT enabledChanged();
+
+  if (!loggingEnabled())
+  {
+    m_buffer.clear();
+    closeFile();
+  }
+}
+
+/**
+ * Hands the buffered console text to the logger thread as one chunk.
+ *
+ * Called once per second, so a chunk covers roughly one second of output and
+ * the timestamp index resolves extraction requests to the same granularity.
+ */
+void IO::ConsoleLogger::flushBuffer()
+{
+  if (m_buffer.isEmpty())
+    return;
+
+  Q_EMIT writeRequested(m_buffer.toUtf8(),
+                        QDateTime::currentMSecsSinceEpoch());
+  m_buffer.clear();
+}
+
+/**
+ * Appends the given console data to the pending buffer.
+ */
+void IO::ConsoleLogger::registerData(const QString &data)
+{
+  if (!data.isEmpty() && loggingEnabled())
+    m_buffer.append(data);
+}
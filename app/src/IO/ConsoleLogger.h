@@ -0,0 +1,132 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QDir>
+#include <QFile>
+#include <QObject>
+#include <QThread>
+#include <QDateTime>
+#include <QByteArray>
+
+namespace IO
+{
+/**
+ * @brief Worker that compresses & writes console log chunks off-thread.
+ *
+ * Lives on the logger's dedicated thread, so compression and disk I/O never
+ * touch the GUI thread. Each segment is a ".sslog" file holding a sequence of
+ * chunks, every chunk a QDataStream record with the RX timestamp (msecs since
+ * epoch) followed by the deflate-compressed UTF-8 text. A sidecar ".idx" file
+ * receives one (timestamp, chunk offset) pair per chunk, so a range of the
+ * log can be located with a binary search over the index and decompressed
+ * without touching the rest of the segment.
+ *
+ * Segments rotate hourly (and whenever the device reconnects), and segments
+ * older than the retention window are deleted when a new one is opened.
+ */
+class ConsoleLoggerWorker : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void openChanged(bool open);
+
+public slots:
+  void closeFile();
+  void writeChunk(const QByteArray &data, const qint64 timestamp);
+
+private:
+  void openSegment(const QDateTime &now);
+  void pruneOldSegments(const QDir &dir);
+
+private:
+  QFile m_file;
+  QFile m_indexFile;
+  QString m_basePath;
+  QString m_segmentHour;
+};
+
+/**
+ * @brief Continuous compressed recorder for console output.
+ *
+ * The console export module writes plain text, which is convenient for a
+ * single session but far too large for long-term retention of everything a
+ * device prints. This logger buffers the displayed console text and hands it
+ * to a worker thread once per second, where it is deflate-compressed and
+ * appended to time-chunked rotating segment files indexed by timestamp (see
+ * IO::ConsoleLoggerWorker for the on-disk layout). Device output typically
+ * compresses 10-20x, so month-long retention stays in the single-digit GB
+ * range per station.
+ */
+class ConsoleLogger : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool isOpen
+             READ isOpen
+             NOTIFY openChanged)
+  Q_PROPERTY(bool loggingEnabled
+             READ loggingEnabled
+             WRITE setLoggingEnabled
+             NOTIFY enabledChanged)
+  // clang-format on
+
+signals:
+  void openChanged();
+  void enabledChanged();
+  void closeRequested();
+  void writeRequested(const QByteArray &data, const qint64 timestamp);
+
+private:
+  explicit ConsoleLogger();
+  ConsoleLogger(ConsoleLogger &&) = delete;
+  ConsoleLogger(const ConsoleLogger &) = delete;
+  ConsoleLogger &operator=(ConsoleLogger &&) = delete;
+  ConsoleLogger &operator=(const ConsoleLogger &) = delete;
+
+  ~ConsoleLogger();
+
+public:
+  static ConsoleLogger &instance();
+
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] bool loggingEnabled() const;
+
+public slots:
+  void closeFile();
+  void setupExternalConnections();
+  void setLoggingEnabled(const bool enabled);
+
+private slots:
+  void flushBuffer();
+  void registerData(const QString &data);
+
+private:
+  bool m_fileOpen;
+  bool m_loggingEnabled;
+
+  QString m_buffer;
+  QThread m_workerThread;
+  ConsoleLoggerWorker *m_worker;
+};
+} // namespace IO
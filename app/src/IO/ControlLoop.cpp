@@ -0,0 +1,314 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <QJSEngine>
+#include <QMutexLocker>
+
+#include "IO/Manager.h"
+#include "IO/ControlLoop.h"
+
+#include "Misc/Settings.h"
+#include "Misc/TimerEvents.h"
+#include "JSON/ScriptHelpers.h"
+#include "JSON/DatasetHistory.h"
+
+/**
+ * @brief Restores the registered script & wires the statistics heartbeat.
+ *
+ * The loop itself always starts disabled: an actuator must never fire from
+ * a script left over by the previous session before the operator re-arms
+ * it.
+ */
+IO::ControlLoop::ControlLoop()
+  : m_enabled(false)
+  , m_reloadPending(true)
+{
+  // Restore the script registered in the previous session
+  m_script = Misc::Settings::instance()
+                 .value(QStringLiteral("control_loop_script"), "")
+                 .toString();
+
+  // Publish the reaction counters at display rate instead of per frame
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz,
+          this, [this] {
+            if (m_enabled.load(std::memory_order_relaxed))
+              Q_EMIT statisticsChanged();
+          });
+}
+
+/**
+ * Returns a reference to the only instance of the class
+ */
+IO::ControlLoop &IO::ControlLoop::instance()
+{
+  static ControlLoop singleton;
+  return singleton;
+}
+
+/**
+ * @brief Returns @c true while the callback is armed.
+ */
+bool IO::ControlLoop::enabled() const
+{
+  return m_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the registered callback script.
+ */
+QString IO::ControlLoop::script() const
+{
+  QMutexLocker locker(&m_scriptLock);
+  return m_script;
+}
+
+/**
+ * @brief Returns the most recent compile or runtime error, empty when the
+ *        registered script is healthy.
+ */
+const QString &IO::ControlLoop::lastError() const
+{
+  return m_lastError;
+}
+
+/**
+ * @brief Returns the number of frames the callback reacted to.
+ */
+quint64 IO::ControlLoop::reactions() const
+{
+  return m_reactions.value();
+}
+
+/**
+ * @brief Returns the number of callback invocations that raised an error.
+ */
+quint64 IO::ControlLoop::scriptErrors() const
+{
+  return m_scriptErrors.value();
+}
+
+/**
+ * @brief Write API exposed to the callback as the global @c device object.
+ *
+ * Called from the reader's thread while the callback runs; the device
+ * objects are bound to the I/O manager's thread, so the payload crosses
+ * with a single posted event — the only scheduling on the reaction path.
+ *
+ * @param data Bytes to send, an ArrayBuffer (or string) on the script side.
+ * @return The number of bytes handed to the driver.
+ */
+qint64 IO::ControlLoop::write(const QByteArray &data)
+{
+  if (data.isEmpty())
+    return 0;
+
+  QMetaObject::invokeMethod(
+      &Manager::instance(),
+      [data] { (void)Manager::instance().writeData(data); },
+      Qt::QueuedConnection);
+
+  return data.size();
+}
+
+/**
+ * @brief Hooks the callback into the frame reader.
+ *
+ * The connection is direct on purpose: the handler runs synchronously on
+ * the reader's worker thread, at the instant a batch passes validation,
+ * while the queued copy of the same signal still feeds the parser &
+ * dashboard pipeline as usual.
+ */
+void IO::ControlLoop::setupExternalConnections()
+{
+  connect(&IO::Manager::instance().frameReader(),
+          &IO::FrameReader::framesReady, this,
+          &IO::ControlLoop::onFramesReady, Qt::DirectConnection);
+}
+
+/**
+ * @brief Arms or disarms the callback.
+ */
+void IO::ControlLoop::setEnabled(const bool enabled)
+{
+  if (m_enabled.load(std::memory_order_relaxed) == enabled)
+    return;
+
+  m_enabled.store(enabled, std::memory_order_release);
+  Q_EMIT enabledChanged();
+}
+
+/**
+ * @brief Registers new callback code.
+ *
+ * The code is persisted & handed to the reader's thread through a reload
+ * flag, so the running callback is swapped at a batch boundary instead of
+ * being recompiled mid-frame.
+ *
+ * @param code JavaScript source declaring a @c control(data, text) function.
+ */
+void IO::ControlLoop::setScript(const QString &code)
+{
+  {
+    QMutexLocker locker(&m_scriptLock);
+    if (m_script == code)
+      return;
+
+    m_script = code;
+  }
+
+  m_reloadPending.store(true, std::memory_order_release);
+  Misc::Settings::instance().setValue(QStringLiteral("control_loop_script"),
+                                      code);
+  Q_EMIT scriptChanged();
+}
+
+/**
+ * @brief Reacts to a validated frame batch, runs on the reader's thread.
+ *
+ * The enabled check is a single relaxed load, so the hook costs nothing
+ * while the loop is disarmed. The capture timestamp is unused: the whole
+ * point of this path is that the callback runs close enough to the wire
+ * that queue-depth compensation is unnecessary.
+ */
+void IO::ControlLoop::onFramesReady(const QVector<QByteArray> &frames,
+                                    const qint64 captureTimestamp)
+{
+  (void)captureTimestamp;
+
+  // Loop disarmed, stay off the hot path
+  if (!m_enabled.load(std::memory_order_acquire))
+    return;
+
+  // (Re)compile the registered script at a batch boundary
+  if (m_reloadPending.exchange(false, std::memory_order_acq_rel) || !m_engine)
+  {
+    if (!reloadScript())
+      return;
+  }
+
+  // Empty or broken script, nothing to react with
+  if (!m_callback.isCallable())
+    return;
+
+  // Invoke the callback once per validated frame
+  for (const auto &frame : frames)
+  {
+    const auto result = m_callback.call(
+        {m_engine->toScriptValue(frame), QString::fromUtf8(frame)});
+
+    if (result.isError())
+    {
+      m_scriptErrors.add(1);
+      reportError(result.toString());
+    }
+
+    else
+      m_reactions.add(1);
+  }
+}
+
+/**
+ * @brief Compiles the registered script on the reader's thread.
+ *
+ * A fresh engine is built for every reload so globals of the previous
+ * script never leak into its replacement. The engine mirrors the frame
+ * parser environment (Codec & History helpers) and additionally exposes
+ * this object as the global @c device write API.
+ *
+ * @return @c true when a callable @c control function was installed.
+ */
+bool IO::ControlLoop::reloadScript()
+{
+  // Snapshot the registered code
+  QString code;
+  {
+    QMutexLocker locker(&m_scriptLock);
+    code = m_script;
+  }
+
+  // Build a fresh engine; the callback reference into the previous engine
+  // must be dropped before that engine is destroyed
+  m_callback = QJSValue();
+  auto engine = std::make_unique<QJSEngine>();
+  engine->installExtensions(QJSEngine::AllExtensions);
+  JSON::ScriptHelpers::install(*engine);
+  JSON::DatasetHistory::install(*engine);
+
+  // Expose the write API, the garbage collector must never claim the
+  // application-owned singleton
+  QJSEngine::setObjectOwnership(this, QJSEngine::CppOwnership);
+  engine->globalObject().setProperty(QStringLiteral("device"),
+                                     engine->newQObject(this));
+  m_engine = std::move(engine);
+
+  // Nothing registered yet
+  if (code.trimmed().isEmpty())
+    return false;
+
+  // Evaluate the script & surface compile errors
+  QStringList errors;
+  m_engine->evaluate(code, "", 1, &errors);
+  if (!errors.isEmpty())
+  {
+    m_scriptErrors.add(1);
+    reportError(errors.first());
+    return false;
+  }
+
+  // Locate the control function
+  auto fun = m_engine->globalObject().property(QStringLiteral("control"));
+  if (fun.isNull() || !fun.isCallable())
+  {
+    m_scriptErrors.add(1);
+    reportError(
+        tr("The 'control' function is not declared or is not callable!"));
+    return false;
+  }
+
+  // Script healthy, install the callback & clear the reported error
+  m_callback = fun;
+  reportError(QString());
+  return true;
+}
+
+/**
+ * @brief Publishes an error message to the user interface.
+ *
+ * Runs on the reader's thread; the message only crosses to the GUI thread
+ * when it actually changes, so a script that throws on every frame does
+ * not post one event per frame.
+ *
+ * @param message Error text, empty to clear the reported error.
+ */
+void IO::ControlLoop::reportError(const QString &message)
+{
+  if (m_reportedError == message)
+    return;
+
+  m_reportedError = message;
+  QMetaObject::invokeMethod(
+      this,
+      [this, message] {
+        m_lastError = message;
+        Q_EMIT lastErrorChanged();
+      },
+      Qt::QueuedConnection);
+}
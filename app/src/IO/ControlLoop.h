@@ -0,0 +1,140 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <QJSValue>
+#include <QByteArray>
+
+#include "IO/Telemetry.h"
+
+class QJSEngine;
+
+namespace IO
+{
+/**
+ * @class IO::ControlLoop
+ * @brief Latency-bounded per-frame callback for closed-loop control.
+ *
+ * The dashboard pipeline trades latency for throughput: validated frames
+ * are batched, queued across threads, parsed and finally rendered on GUI
+ * timers, which adds tens of milliseconds of jitter between a sensor frame
+ * and any reaction computed from it. That is fine for display and useless
+ * for closing a control loop through the application.
+ *
+ * The control loop therefore hooks the frame reader directly: the
+ * registered JavaScript callback runs on the reader's worker thread the
+ * moment a frame batch is validated — before the queued hand-off to the
+ * parser & dashboard pipeline — and answers through the global @c device
+ * write API. The only scheduling left on the reaction path is the single
+ * posted event that carries the reply to the thread the device drivers are
+ * bound to; in headless operation that loop is idle, so reactions stay
+ * bounded at sub-millisecond scale while display continues on the normal
+ * path.
+ *
+ * The script declares a @c control(data, text) function, where @c data is
+ * the raw frame as an ArrayBuffer and @c text its UTF-8 decoding. The
+ * callback runs on a private engine with the usual @c Codec and @c History
+ * helpers installed; the parser worker pool is never touched.
+ */
+class ControlLoop : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool enabled
+             READ enabled
+             WRITE setEnabled
+             NOTIFY enabledChanged)
+  Q_PROPERTY(QString script
+             READ script
+             WRITE setScript
+             NOTIFY scriptChanged)
+  Q_PROPERTY(QString lastError
+             READ lastError
+             NOTIFY lastErrorChanged)
+  Q_PROPERTY(quint64 reactions
+             READ reactions
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(quint64 scriptErrors
+             READ scriptErrors
+             NOTIFY statisticsChanged)
+  // clang-format on
+
+signals:
+  void enabledChanged();
+  void scriptChanged();
+  void lastErrorChanged();
+  void statisticsChanged();
+
+private:
+  explicit ControlLoop();
+  ControlLoop(ControlLoop &&) = delete;
+  ControlLoop(const ControlLoop &) = delete;
+  ControlLoop &operator=(ControlLoop &&) = delete;
+  ControlLoop &operator=(const ControlLoop &) = delete;
+
+public:
+  static ControlLoop &instance();
+
+  [[nodiscard]] bool enabled() const;
+  [[nodiscard]] QString script() const;
+  [[nodiscard]] const QString &lastError() const;
+  [[nodiscard]] quint64 reactions() const;
+  [[nodiscard]] quint64 scriptErrors() const;
+
+  Q_INVOKABLE qint64 write(const QByteArray &data);
+
+public slots:
+  void setupExternalConnections();
+  void setEnabled(const bool enabled);
+  void setScript(const QString &code);
+
+private:
+  void onFramesReady(const QVector<QByteArray> &frames,
+                     const qint64 captureTimestamp);
+  bool reloadScript();
+  void reportError(const QString &message);
+
+private:
+  std::atomic<bool> m_enabled;
+  std::atomic<bool> m_reloadPending;
+
+  mutable QMutex m_scriptLock;
+  QString m_script;
+
+  QString m_lastError;
+
+  TelemetryCounter m_reactions;
+  TelemetryCounter m_scriptErrors;
+
+  // Engine state, only ever touched on the frame reader's thread
+  QJSValue m_callback;
+  QString m_reportedError;
+  std::unique_ptr<QJSEngine> m_engine;
+};
+} // namespace IO
@@ -21,6 +21,7 @@
 
 #include <QOperatingSystemVersion>
 
+#include "Misc/Settings.h"
 #include "Misc/Utilities.h"
 #include "IO/Drivers/BluetoothLE.h"
 
@@ -33,11 +34,19 @@
  */
 IO::Drivers::BluetoothLE::BluetoothLE()
   : m_deviceIndex(-1)
+  , m_fastResume(false)
   , m_deviceConnected(false)
+  , m_selectedCharacteristic(-1)
+  , m_coalesceWindow(5)
   , m_service(nullptr)
   , m_controller(nullptr)
   , m_discoveryAgent(nullptr)
 {
+  // Coalesce MTU-sized notifications into larger frame reader batches
+  m_rxTimer.setSingleShot(true);
+  connect(&m_rxTimer, &QTimer::timeout, this,
+          &IO::Drivers::BluetoothLE::flushRxBuffer);
+
   connect(this, &IO::Drivers::BluetoothLE::deviceIndexChanged, this,
           &IO::Drivers::BluetoothLE::configurationChanged);
 
@@ -73,9 +82,11 @@ void IO::Drivers::BluetoothLE::close()
   m_deviceConnected = false;
 
   // Restore initial conditions
+  m_fastResume = false;
   m_serviceNames.clear();
   m_characteristics.clear();
   m_characteristicNames.clear();
+  m_resumeCharacteristic.clear();
   m_selectedCharacteristic = -1;
 
   // Delete previous service
@@ -419,8 +430,12 @@ void IO::Drivers::BluetoothLE::selectService(const int index)
       connect(m_service, &QLowEnergyService::errorOccurred, this,
               &IO::Drivers::BluetoothLE::onServiceError);
 
+      // Known devices skip the slow characteristic value reads, only the
+      // structure is needed to re-subscribe to the cached characteristic
       if (m_service->state() == QLowEnergyService::RemoteService)
-        m_service->discoverDetails();
+        m_service->discoverDetails(m_fastResume
+                                       ? QLowEnergyService::SkipValueDiscovery
+                                       : QLowEnergyService::FullDiscovery);
       else
         configureCharacteristics();
     }
@@ -469,6 +484,9 @@ void IO::Drivers::BluetoothLE::setCharacteristicIndex(const int index)
     // Display current value
     if (!c.value().isEmpty())
       processData(c.value());
+
+    // Remember the selection so the next connect can resume it directly
+    storeCachedSelection();
   }
 
   // Update UI
@@ -508,6 +526,22 @@ void IO::Drivers::BluetoothLE::configureCharacteristics()
   // Update UI
   Q_EMIT characteristicsChanged();
   Q_EMIT characteristicIndexChanged();
+
+  // Fast resume: re-select the characteristic used on the last session
+  if (m_fastResume)
+  {
+    m_fastResume = false;
+    for (int i = 0; i < m_characteristics.count(); ++i)
+    {
+      if (m_characteristics.at(i).uuid().toString() == m_resumeCharacteristic)
+      {
+        setCharacteristicIndex(i + 1);
+        break;
+      }
+    }
+
+    m_resumeCharacteristic.clear();
+  }
 }
 
 /**
@@ -527,6 +561,10 @@ void IO::Drivers::BluetoothLE::onServiceDiscoveryFinished()
 
   // Update UI
   Q_EMIT servicesChanged();
+
+  // Fast-resume known devices: when the service layout matches the cached
+  // fingerprint, re-select the service & characteristic from the last session
+  restoreCachedSelection();
 }
 
 /**
@@ -630,6 +668,13 @@ void IO::Drivers::BluetoothLE::onServiceStateChanged(
 
 /**
  * Reads the transmitted data from the BLE service.
+ *
+ * Notifications are typically MTU-sized chunks (often 20 bytes), so each one
+ * is appended to a reassembly buffer instead of being forwarded straight to
+ * the frame reader. The buffer is handed to processData() once per coalesce
+ * window, so payloads split across several notifications arrive at the frame
+ * scanner as one contiguous block and the per-notification signal overhead
+ * is amortized.
  */
 void IO::Drivers::BluetoothLE::onCharacteristicChanged(
     const QLowEnergyCharacteristic &info, const QByteArray &value)
@@ -637,5 +682,162 @@ void IO::Drivers::BluetoothLE::onCharacteristicChanged(
   const bool anyCharacteristic = (m_selectedCharacteristic == -1);
   const bool current = (info == m_characteristics.at(m_selectedCharacteristic));
   if (anyCharacteristic || current)
-    processData(value);
+  {
+    // Coalescing disabled, forward the notification as-is
+    if (m_coalesceWindow <= 0)
+    {
+      processData(value);
+      return;
+    }
+
+    // Accumulate the notification & arm the flush window
+    m_rxBuffer.append(value);
+    if (!m_rxTimer.isActive())
+      m_rxTimer.start(m_coalesceWindow);
+  }
+}
+
+/**
+ * @brief Returns the notification coalescing window in milliseconds.
+ *
+ * Notifications received within this window are merged into a single buffer
+ * before being handed to the frame reader. A value of zero forwards each
+ * notification individually.
+ */
+int IO::Drivers::BluetoothLE::coalesceWindow() const
+{
+  return m_coalesceWindow;
+}
+
+/**
+ * @brief Changes the notification coalescing window.
+ *
+ * Pending data is flushed right away so a shorter window takes effect
+ * immediately.
+ *
+ * @param window The new coalescing window in milliseconds (0 disables
+ *               coalescing).
+ */
+void IO::Drivers::BluetoothLE::setCoalesceWindow(const int window)
+{
+  m_coalesceWindow = qMax(0, window);
+  flushRxBuffer();
+  Q_EMIT coalesceWindowChanged();
+}
+
+/**
+ * @brief Hands the coalesced notification data to the frame reader.
+ */
+void IO::Drivers::BluetoothLE::flushRxBuffer()
+{
+  m_rxTimer.stop();
+  if (!m_rxBuffer.isEmpty())
+  {
+    processData(m_rxBuffer);
+    m_rxBuffer.clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Service discovery cache
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Persists the current service & characteristic selection.
+ *
+ * Stores the service UUID, characteristic UUID and a fingerprint of the
+ * device's service layout under the device's cache key, so the next connect
+ * to the same device can resume streaming without waiting for the user to
+ * re-select anything.
+ */
+void IO::Drivers::BluetoothLE::storeCachedSelection()
+{
+  const auto key = deviceCacheKey();
+  if (key.isEmpty() || !m_service || m_selectedCharacteristic < 0)
+    return;
+
+  const auto group = QStringLiteral("bleCache/") + key;
+  const auto &c = m_characteristics.at(m_selectedCharacteristic);
+  auto &settings = Misc::Settings::instance();
+  settings.setValue(group + QStringLiteral("/fingerprint"),
+                    servicesFingerprint());
+  settings.setValue(group + QStringLiteral("/service"),
+                    m_service->serviceUuid().toString());
+  settings.setValue(group + QStringLiteral("/characteristic"),
+                    c.uuid().toString());
+}
+
+/**
+ * @brief Resumes the cached service & characteristic selection, if valid.
+ *
+ * The cache entry is validated cheaply against a fingerprint of the service
+ * layout reported by the fresh discovery: when it matches, the service used
+ * last time is selected with value discovery skipped and the characteristic
+ * subscription is restored as soon as the structure arrives. A mismatch
+ * (re-flashed or re-configured device) falls back to the regular manual
+ * flow and the cache entry is refreshed on the next selection.
+ */
+void IO::Drivers::BluetoothLE::restoreCachedSelection()
+{
+  const auto key = deviceCacheKey();
+  if (key.isEmpty() || !m_controller)
+    return;
+
+  // Validate the cached fingerprint against the fresh service layout
+  const auto group = QStringLiteral("bleCache/") + key;
+  auto &settings = Misc::Settings::instance();
+  const auto fingerprint
+      = settings.value(group + QStringLiteral("/fingerprint")).toString();
+  if (fingerprint.isEmpty() || fingerprint != servicesFingerprint())
+    return;
+
+  // Locate the cached service in the discovered list
+  const auto serviceUuid
+      = settings.value(group + QStringLiteral("/service")).toString();
+  const auto index
+      = m_controller->services().indexOf(QBluetoothUuid(serviceUuid));
+  if (index < 0)
+    return;
+
+  // Re-select the service, characteristic selection follows once the
+  // service structure has been discovered
+  m_fastResume = true;
+  m_resumeCharacteristic
+      = settings.value(group + QStringLiteral("/characteristic")).toString();
+  selectService(index + 1);
+}
+
+/**
+ * @brief Returns the cache key of the currently selected device.
+ *
+ * The Bluetooth address identifies the device on most platforms; Apple
+ * systems hide it, so the platform-assigned device UUID is used instead.
+ */
+QString IO::Drivers::BluetoothLE::deviceCacheKey() const
+{
+  if (m_deviceIndex < 0 || m_deviceIndex >= m_devices.count())
+    return QString();
+
+  const auto &device = m_devices.at(m_deviceIndex);
+  auto key = device.address().toString();
+  if (key.isEmpty() || key == QStringLiteral("00:00:00:00:00:00"))
+    key = device.deviceUuid().toString();
+
+  return key;
+}
+
+/**
+ * @brief Returns a fingerprint of the device's service layout.
+ */
+QString IO::Drivers::BluetoothLE::servicesFingerprint() const
+{
+  if (!m_controller)
+    return QString();
+
+  QStringList uuids;
+  for (const auto &service : m_controller->services())
+    uuids.append(service.toString());
+
+  uuids.sort();
+  return QString::number(qHash(uuids.join(QLatin1Char(','))), 16);
 }
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <QObject>
+#include <QTimer>
 #include <QLowEnergyController>
 #include <QBluetoothDeviceDiscoveryAgent>
 
@@ -69,6 +70,7 @@ class BluetoothLE : public HAL_Driver
 
 signals:
   void devicesChanged();
+  void coalesceWindowChanged();
   void servicesChanged();
   void deviceIndexChanged();
   void characteristicsChanged();
@@ -108,11 +110,19 @@ public:
 
 public slots:
   void startDiscovery();
+  void setCoalesceWindow(const int window);
   void selectDevice(const int index);
   void selectService(const int index);
   void setCharacteristicIndex(const int index);
 
+private:
+  void storeCachedSelection();
+  void restoreCachedSelection();
+  [[nodiscard]] QString deviceCacheKey() const;
+  [[nodiscard]] QString servicesFingerprint() const;
+
 private slots:
+  void flushRxBuffer();
   void configureCharacteristics();
   void onServiceDiscoveryFinished();
   void onDeviceDiscovered(const QBluetoothDeviceInfo &device);
@@ -122,10 +132,19 @@ private slots:
   void onCharacteristicChanged(const QLowEnergyCharacteristic &info,
                                const QByteArray &value);
 
+public:
+  [[nodiscard]] int coalesceWindow() const;
+
 private:
   int m_deviceIndex;
+  bool m_fastResume;
   bool m_deviceConnected;
   int m_selectedCharacteristic;
+  QString m_resumeCharacteristic;
+
+  int m_coalesceWindow;
+  QTimer m_rxTimer;
+  QByteArray m_rxBuffer;
 
   QLowEnergyService *m_service;
   QLowEnergyController *m_controller;
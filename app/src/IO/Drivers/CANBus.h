@@ -0,0 +1,21 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * This file is a placeholder for the CAN bus driver, which ships with the
+ * commercial build of Serial Studio (see LICENSE_COMMERCIAL.md). The open
+ * tree compiles it only when USE_QT_COMMERCIAL is set, and the implementation
+ * is overlaid from the commercial sources.
+ *
+ * Planned decode-pipeline notes for the commercial implementation:
+ *
+ * - Socket drain and payload decode must run as separate stages, with an
+ *   IO::SPSCCircularBuffer between them (the same lock-free ring the serial
+ *   path uses via IO::FrameReader), so draining QCanBusDevice never blocks
+ *   on JSON conversion at high busloads.
+ * - The decode stage should run on its own worker thread, registered through
+ *   IO::Manager::registerSource() so frames are merged and tagged like any
+ *   other auxiliary source.
+ * - Bus-off and RX-overrun events reported by QCanBusDevice must be counted
+ *   and surfaced next to the buffer overrun telemetry exposed by
+ *   IO::Manager (droppedBytes / bufferOverruns / bufferHighWaterMark).
+ */
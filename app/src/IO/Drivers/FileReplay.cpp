@@ -0,0 +1,304 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <QDir>
+#include <QFileInfo>
+#include <QFileDialog>
+
+#include "IO/Manager.h"
+#include "IO/Drivers/FileReplay.h"
+
+/**
+ * @brief Maximum number of bytes handed to the frame pipeline per timer tick.
+ *
+ * Unthrottled replays are still chunked so the worker thread queue and the
+ * event loop stay responsive while multi-gigabyte captures are streamed.
+ */
+static constexpr qint64 MaxChunkSize = 1024 * 1024;
+
+/**
+ * @brief Constructor function, initializes the replay pacing timer.
+ */
+IO::Drivers::FileReplay::FileReplay()
+  : m_mappedData(nullptr)
+  , m_offset(0)
+  , m_baseRate(115200)
+  , m_speedMultiplier(1.0)
+{
+  m_timer.setInterval(10);
+  m_timer.setTimerType(Qt::PreciseTimer);
+  connect(&m_timer, &QTimer::timeout, this,
+          &IO::Drivers::FileReplay::pumpData);
+}
+
+/**
+ * @brief Returns the only instance of the class.
+ */
+IO::Drivers::FileReplay &IO::Drivers::FileReplay::instance()
+{
+  static FileReplay singleton;
+  return singleton;
+}
+
+/**
+ * @brief Stops the replay, unmaps the capture file and closes it.
+ */
+void IO::Drivers::FileReplay::close()
+{
+  m_timer.stop();
+
+  if (m_mappedData)
+  {
+    m_file.unmap(m_mappedData);
+    m_mappedData = nullptr;
+  }
+
+  if (m_file.isOpen())
+    m_file.close();
+
+  m_offset = 0;
+  Q_EMIT progressChanged();
+}
+
+/**
+ * @brief Returns @c true if a capture file is currently mapped.
+ */
+bool IO::Drivers::FileReplay::isOpen() const
+{
+  return m_mappedData != nullptr;
+}
+
+/**
+ * @brief Returns @c true if a capture file is currently mapped.
+ */
+bool IO::Drivers::FileReplay::isReadable() const
+{
+  return isOpen();
+}
+
+/**
+ * @brief Returns @c false, capture replays are read-only.
+ */
+bool IO::Drivers::FileReplay::isWritable() const
+{
+  return false;
+}
+
+/**
+ * @brief Returns @c true if the selected capture file exists and is not empty.
+ */
+bool IO::Drivers::FileReplay::configurationOk() const
+{
+  const QFileInfo info(m_filePath);
+  return info.isFile() && info.size() > 0;
+}
+
+/**
+ * @brief Does nothing, capture replays are read-only.
+ */
+quint64 IO::Drivers::FileReplay::write(const QByteArray &data)
+{
+  (void)data;
+  return 0;
+}
+
+/**
+ * @brief Memory-maps the selected capture file and starts the replay.
+ *
+ * The file is mapped read-only so captures larger than available RAM can be
+ * streamed; the OS pages data in as the pacing timer walks through it.
+ *
+ * @param mode Open mode, only @c QIODevice::ReadOnly makes sense here.
+ * @return @c true on success, @c false on failure.
+ */
+bool IO::Drivers::FileReplay::open(const QIODevice::OpenMode mode)
+{
+  // Close any replay in progress
+  close();
+
+  // Validate configuration & requested mode
+  if (!configurationOk() || !(mode & QIODevice::ReadOnly))
+    return false;
+
+  // Open the capture file
+  m_file.setFileName(m_filePath);
+  if (!m_file.open(QIODevice::ReadOnly))
+    return false;
+
+  // Map the whole capture into the address space
+  m_mappedData = m_file.map(0, m_file.size());
+  if (!m_mappedData)
+  {
+    m_file.close();
+    return false;
+  }
+
+  // Start streaming from the top of the capture
+  m_offset = 0;
+  m_timer.start();
+  Q_EMIT progressChanged();
+  return true;
+}
+
+/**
+ * @brief Returns the path of the capture file to replay.
+ */
+const QString &IO::Drivers::FileReplay::filePath() const
+{
+  return m_filePath;
+}
+
+/**
+ * @brief Returns the replay speed multiplier (0 = unthrottled).
+ */
+qreal IO::Drivers::FileReplay::speedMultiplier() const
+{
+  return m_speedMultiplier;
+}
+
+/**
+ * @brief Returns the base wire rate of the replay in bytes per second.
+ */
+quint64 IO::Drivers::FileReplay::baseRate() const
+{
+  return m_baseRate;
+}
+
+/**
+ * @brief Returns the fraction of the capture streamed so far (0.0 to 1.0).
+ */
+qreal IO::Drivers::FileReplay::progress() const
+{
+  if (!isOpen() || m_file.size() <= 0)
+    return 0.0;
+
+  return static_cast<qreal>(m_offset) / static_cast<qreal>(m_file.size());
+}
+
+/**
+ * @brief Lets the user select a capture file to replay.
+ */
+void IO::Drivers::FileReplay::selectFile()
+{
+  auto path = QFileDialog::getOpenFileName(
+      Q_NULLPTR, tr("Select capture file to replay"), QDir::homePath());
+
+  if (!path.isEmpty())
+    setFilePath(path);
+}
+
+/**
+ * @brief Changes the path of the capture file to replay.
+ *
+ * Any replay in progress is stopped, since the mapped data would no longer
+ * correspond to the selected file.
+ *
+ * @param path Path of the capture file.
+ */
+void IO::Drivers::FileReplay::setFilePath(const QString &path)
+{
+  if (m_filePath != path)
+  {
+    if (isOpen())
+      Manager::instance().disconnectDevice();
+
+    m_filePath = path;
+    Q_EMIT filePathChanged();
+    Q_EMIT configurationChanged();
+  }
+}
+
+/**
+ * @brief Changes the base wire rate of the replay.
+ *
+ * @param bytesPerSecond Nominal capture rate in bytes per second, used as the
+ *                       1x reference for the speed multiplier.
+ */
+void IO::Drivers::FileReplay::setBaseRate(const quint64 bytesPerSecond)
+{
+  if (m_baseRate != bytesPerSecond && bytesPerSecond > 0)
+  {
+    m_baseRate = bytesPerSecond;
+    Q_EMIT baseRateChanged();
+  }
+}
+
+/**
+ * @brief Changes the replay speed multiplier.
+ *
+ * A multiplier of 1 streams the capture at the configured base rate, larger
+ * values replay proportionally faster, and 0 streams the capture as fast as
+ * the frame pipeline can drain it.
+ *
+ * @param multiplier Speed multiplier relative to the base rate.
+ */
+void IO::Drivers::FileReplay::setSpeedMultiplier(const qreal multiplier)
+{
+  if (!qFuzzyCompare(m_speedMultiplier, multiplier) && multiplier >= 0)
+  {
+    m_speedMultiplier = multiplier;
+    Q_EMIT speedMultiplierChanged();
+  }
+}
+
+/**
+ * @brief Streams the next paced chunk of the capture to the frame pipeline.
+ *
+ * The chunk size is derived from the base rate, the speed multiplier and the
+ * timer interval; unthrottled replays stream a full chunk every tick. When
+ * the end of the capture is reached the timer is stopped and the mapping is
+ * kept alive, so the dashboard retains the decoded data until the user
+ * disconnects.
+ */
+void IO::Drivers::FileReplay::pumpData()
+{
+  if (!isOpen())
+    return;
+
+  // Compute how many bytes this tick is allowed to stream
+  qint64 budget = MaxChunkSize;
+  if (m_speedMultiplier > 0)
+  {
+    const auto rate = static_cast<qreal>(m_baseRate) * m_speedMultiplier;
+    budget = qMin<qint64>(
+        MaxChunkSize,
+        qMax<qint64>(1, qRound64(rate * m_timer.interval() / 1000.0)));
+  }
+
+  // Hand the chunk to the frame pipeline
+  const auto remaining = m_file.size() - m_offset;
+  const auto chunk = qMin<qint64>(budget, remaining);
+  if (chunk > 0)
+  {
+    processData(QByteArray(reinterpret_cast<const char *>(m_mappedData)
+                               + m_offset,
+                           static_cast<qsizetype>(chunk)));
+    m_offset += chunk;
+    Q_EMIT progressChanged();
+  }
+
+  // Stop pacing once the whole capture has been streamed
+  if (m_offset >= m_file.size())
+  {
+    m_timer.stop();
+    Q_EMIT replayFinished();
+  }
+}
@@ -0,0 +1,119 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QFile>
+#include <QTimer>
+#include <QObject>
+#include <QString>
+
+#include "IO/HAL_Driver.h"
+
+namespace IO
+{
+namespace Drivers
+{
+/**
+ * @brief The FileReplay class
+ *
+ * Serial Studio driver class that replays raw capture files through the
+ * frame pipeline. The capture is memory-mapped and streamed to the frame
+ * reader in paced chunks, so the full parse path can be soak-tested at
+ * wire rate (or any multiple of it) without hardware attached.
+ *
+ * The replay rate is expressed as a base wire rate in bytes per second and
+ * a speed multiplier; a multiplier of zero streams the file unthrottled.
+ */
+class FileReplay : public HAL_Driver
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(QString filePath
+             READ filePath
+             WRITE setFilePath
+             NOTIFY filePathChanged)
+  Q_PROPERTY(qreal speedMultiplier
+             READ speedMultiplier
+             WRITE setSpeedMultiplier
+             NOTIFY speedMultiplierChanged)
+  Q_PROPERTY(quint64 baseRate
+             READ baseRate
+             WRITE setBaseRate
+             NOTIFY baseRateChanged)
+  Q_PROPERTY(qreal progress
+             READ progress
+             NOTIFY progressChanged)
+  // clang-format on
+
+signals:
+  void filePathChanged();
+  void baseRateChanged();
+  void progressChanged();
+  void replayFinished();
+  void speedMultiplierChanged();
+
+private:
+  explicit FileReplay();
+  FileReplay(FileReplay &&) = delete;
+  FileReplay(const FileReplay &) = delete;
+  FileReplay &operator=(FileReplay &&) = delete;
+  FileReplay &operator=(const FileReplay &) = delete;
+
+public:
+  static FileReplay &instance();
+
+  void close() override;
+
+  [[nodiscard]] bool isOpen() const override;
+  [[nodiscard]] bool isReadable() const override;
+  [[nodiscard]] bool isWritable() const override;
+  [[nodiscard]] bool configurationOk() const override;
+  [[nodiscard]] quint64 write(const QByteArray &data) override;
+  [[nodiscard]] bool open(const QIODevice::OpenMode mode) override;
+
+  [[nodiscard]] const QString &filePath() const;
+  [[nodiscard]] qreal speedMultiplier() const;
+  [[nodiscard]] quint64 baseRate() const;
+  [[nodiscard]] qreal progress() const;
+
+public slots:
+  void selectFile();
+  void setFilePath(const QString &path);
+  void setBaseRate(const quint64 bytesPerSecond);
+  void setSpeedMultiplier(const qreal multiplier);
+
+private slots:
+  void pumpData();
+
+private:
+  QFile m_file;
+  uchar *m_mappedData;
+  qint64 m_offset;
+
+  QString m_filePath;
+  quint64 m_baseRate;
+  qreal m_speedMultiplier;
+
+  QTimer m_timer;
+};
+} // namespace Drivers
+} // namespace IO
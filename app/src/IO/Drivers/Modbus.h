@@ -0,0 +1,21 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * This file is a placeholder for the Modbus driver, which ships with the
+ * commercial build of Serial Studio (see LICENSE_COMMERCIAL.md). The open
+ * tree compiles it only when USE_QT_COMMERCIAL is set, and the implementation
+ * is overlaid from the commercial sources.
+ *
+ * Planned polling-scheduler notes for the commercial implementation:
+ *
+ * - Register polls must be planned, not issued ad hoc: contiguous register
+ *   ranges within one slave should be coalesced into single read requests
+ *   (respecting the 125-register PDU limit) so a scan touches each slave a
+ *   minimal number of times.
+ * - Requests addressed to independent slave IDs carry no ordering
+ *   dependency, so the scheduler should keep one outstanding request per
+ *   slave in flight concurrently via QModbusClient instead of serializing
+ *   the whole scan on a single request/response cycle.
+ * - Completed responses should be batched into the frame pipeline through
+ *   IO::Manager::registerSource() like any other auxiliary source.
+ */
@@ -24,6 +24,14 @@
 
 #include "Misc/Utilities.h"
 
+#ifdef Q_OS_LINUX
+#  include <vector>
+#  include <cstring>
+#  include <unistd.h>
+#  include <sys/socket.h>
+#  include <netinet/in.h>
+#endif
+
 //------------------------------------------------------------------------------
 // Constructor & singleton access functions
 //------------------------------------------------------------------------------
@@ -35,6 +43,13 @@ IO::Drivers::Network::Network()
   : m_hostExists(false)
   , m_udpMulticast(false)
   , m_lookupActive(false)
+  , m_raceWhenResolved(false)
+  , m_udpQueueCount(1)
+  , m_tcpSocket(nullptr)
+  , m_nextAddress(0)
+#ifdef Q_OS_LINUX
+  , m_reusePortActive(false)
+#endif
 {
   // Set initial configuration
   setRemoteAddress("");
@@ -51,24 +66,22 @@ IO::Drivers::Network::Network()
   connect(this, &IO::Drivers::Network::portChanged, this,
           &IO::Drivers::Network::configurationChanged);
 
-  // Update open state when socket states change
-  connect(&m_tcpSocket, &QUdpSocket::stateChanged, this,
-          [=] { Q_EMIT configurationChanged(); });
+  // Create the active TCP socket & wire its state/error reporting
+  adoptTcpSocket(new QTcpSocket(this));
+
+  // Update open state when the UDP socket state changes
   connect(&m_udpSocket, &QUdpSocket::stateChanged, this,
           [=] { Q_EMIT configurationChanged(); });
 
-  // Report socket errors
-#if QT_VERSION < QT_VERSION_CHECK(5, 12, 0)
-  connect(&m_tcpSocket, SIGNAL(error(QAbstractSocket::SocketError)), this,
-          SLOT(onErrorOccurred(QAbstractSocket::SocketError)));
-  connect(&m_udpSocket, SIGNAL(error(QAbstractSocket::SocketError)), this,
-          SLOT(onErrorOccurred(QAbstractSocket::SocketError)));
-#else
-  connect(&m_tcpSocket, &QTcpSocket::errorOccurred, this,
-          &IO::Drivers::Network::onErrorOccurred);
+  // Report UDP socket errors
   connect(&m_udpSocket, &QUdpSocket::errorOccurred, this,
           &IO::Drivers::Network::onErrorOccurred);
-#endif
+
+  // Stagger the connection attempts of the happy-eyeballs race
+  m_attemptTimer.setSingleShot(true);
+  m_attemptTimer.setInterval(AttemptDelayMs);
+  connect(&m_attemptTimer, &QTimer::timeout, this,
+          &IO::Drivers::Network::startNextAttempt);
 }
 
 /**
@@ -91,14 +104,26 @@ IO::Drivers::Network &IO::Drivers::Network::instance()
 void IO::Drivers::Network::close()
 {
   // Abort network connections
-  m_tcpSocket.abort();
+  m_tcpSocket->abort();
   m_udpSocket.abort();
-  m_tcpSocket.disconnectFromHost();
+  m_tcpSocket->disconnectFromHost();
   m_udpSocket.disconnectFromHost();
 
+  // Cancel any in-flight connection race
+  m_raceWhenResolved = false;
+  abortConnectionRace();
+
+  // Retire the per-publisher frame reader contexts
+  clearMulticastSources();
+
+// Stop the auxiliary SO_REUSEPORT receive queues
+#ifdef Q_OS_LINUX
+  closeReusePortQueues();
+#endif
+
   // Disconnect signals/slots
   if (socketType() == QAbstractSocket::TcpSocket)
-    disconnect(&m_tcpSocket, &QTcpSocket::readyRead, this,
+    disconnect(m_tcpSocket, &QTcpSocket::readyRead, this,
                &IO::Drivers::Network::onReadyRead);
   else if (socketType() == QAbstractSocket::UdpSocket)
     disconnect(&m_udpSocket, &QUdpSocket::readyRead, this,
@@ -121,8 +146,8 @@ bool IO::Drivers::Network::isOpen() const
 
   else if (socketType() == QAbstractSocket::TcpSocket)
   {
-    open = m_tcpSocket.isOpen();
-    state = m_tcpSocket.state();
+    open = m_tcpSocket->isOpen();
+    state = m_tcpSocket->state();
   }
 
   return open
@@ -138,7 +163,7 @@ bool IO::Drivers::Network::isReadable() const
   if (socketType() == QAbstractSocket::UdpSocket)
     return m_udpSocket.isReadable();
   else if (socketType() == QAbstractSocket::TcpSocket)
-    return m_tcpSocket.isReadable();
+    return m_tcpSocket->isReadable();
 
   return false;
 }
@@ -151,7 +176,7 @@ bool IO::Drivers::Network::isWritable() const
   if (socketType() == QAbstractSocket::UdpSocket)
     return m_udpSocket.isWritable();
   else if (socketType() == QAbstractSocket::TcpSocket)
-    return m_tcpSocket.isWritable();
+    return m_tcpSocket->isWritable();
 
   return false;
 }
@@ -180,7 +205,7 @@ quint64 IO::Drivers::Network::write(const QByteArray &data)
     if (socketType() == QAbstractSocket::UdpSocket)
       return m_udpSocket.write(data);
     else if (socketType() == QAbstractSocket::TcpSocket)
-      return m_tcpSocket.write(data);
+      return m_tcpSocket->write(data);
   }
 
   return -1;
@@ -209,24 +234,72 @@ bool IO::Drivers::Network::open(const QIODevice::OpenMode mode)
   // Init socket pointer
   QIODevice *socket = nullptr;
 
-  // TCP connection, assign socket pointer & connect to host
+  // TCP connection, resolve & race one attempt per known address
   if (socketType() == QAbstractSocket::TcpSocket)
   {
-    socket = static_cast<QIODevice *>(&m_tcpSocket);
-    m_tcpSocket.connectToHost(hostAddr, tcpPort());
+    // Literal IP address, single candidate, connect directly
+    if (!QHostAddress(hostAddr).isNull())
+    {
+      socket = static_cast<QIODevice *>(m_tcpSocket);
+      m_tcpSocket->connectToHost(hostAddr, tcpPort());
+    }
+
+    // Host name already resolved, race the cached addresses immediately
+    else if (!m_remoteAddresses.isEmpty())
+    {
+      startConnectionRace();
+      return true;
+    }
+
+    // Host name not resolved yet, resolve asynchronously & then race
+    else
+    {
+      m_raceWhenResolved = true;
+      lookup(hostAddr);
+      return true;
+    }
   }
 
   // UDP connection, assign socket pointer & bind to host
   else if (socketType() == QAbstractSocket::UdpSocket)
   {
+    bool bound = false;
+
+// Multi-queue ingest: bind the primary socket with SO_REUSEPORT & spin up
+// the auxiliary receive queues, so the kernel fans incoming flows out
+// across them instead of funnelling everything through one socket
+#ifdef Q_OS_LINUX
+    if (!udpMulticast() && udpQueueCount() > 1)
+    {
+      const int fd = createReusePortSocket(udpLocalPort());
+      if (fd >= 0)
+      {
+        bound = m_udpSocket.setSocketDescriptor(fd,
+                                                QAbstractSocket::BoundState);
+        if (bound)
+          openReusePortQueues();
+        else
+          ::close(fd);
+      }
+    }
+#endif
+
     // Bind the UDP socket
-    m_udpSocket.bind(udpLocalPort(), QAbstractSocket::ShareAddress
-                                         | QAbstractSocket::ReuseAddressHint);
+    if (!bound)
+      m_udpSocket.bind(udpLocalPort(),
+                       QAbstractSocket::ShareAddress
+                           | QAbstractSocket::ReuseAddressHint);
 
-    // Join the multicast group (if required)
+    // Join the multicast group(s) if required; the address field accepts a
+    // comma-separated list so one driver instance can subscribe to several
+    // per-subsystem groups at once
     if (udpMulticast())
-      m_udpSocket.joinMulticastGroup(
-          QHostAddress(QHostAddress(m_address).toIPv6Address()));
+    {
+      const auto groups = m_address.split(QLatin1Char(','), Qt::SkipEmptyParts);
+      for (const auto &group : groups)
+        m_udpSocket.joinMulticastGroup(QHostAddress(
+            QHostAddress(group.trimmed()).toIPv6Address()));
+    }
 
     // Set socket pointer
     socket = static_cast<QIODevice *>(&m_udpSocket);
@@ -238,7 +311,7 @@ bool IO::Drivers::Network::open(const QIODevice::OpenMode mode)
     if (socket->open(mode))
     {
       connect(socket, &QIODevice::readyRead, this,
-              &IO::Drivers::Network::onReadyRead);
+              &IO::Drivers::Network::onReadyRead, Qt::UniqueConnection);
       return true;
     }
   }
@@ -285,6 +358,20 @@ bool IO::Drivers::Network::udpMulticast() const
   return m_udpMulticast;
 }
 
+/**
+ * @brief Returns the number of UDP receive queues used while connected.
+ *
+ * One means the classic single-socket ingest. Larger values open additional
+ * SO_REUSEPORT sockets on the same local port, each drained by a dedicated
+ * receive thread, so the kernel distributes incoming flows across cores
+ * (only honoured on platforms with SO_REUSEPORT support, and ignored for
+ * multicast subscriptions, where every queue would receive every packet).
+ */
+int IO::Drivers::Network::udpQueueCount() const
+{
+  return m_udpQueueCount;
+}
+
 /**
  * Returns @c true if we are currently performing a DNS lookup
  */
@@ -393,8 +480,21 @@ void IO::Drivers::Network::setUdpRemotePort(const quint16 port)
  */
 void IO::Drivers::Network::setRemoteAddress(const QString &address)
 {
+  // Drop the resolution cache of the previous host
+  m_remoteAddresses.clear();
+
+  // Multicast subscriptions accept a comma-separated list of group
+  // addresses, the configuration is valid when every entry is a literal
+  const auto tokens = address.split(QLatin1Char(','), Qt::SkipEmptyParts);
+  if (tokens.count() > 1)
+  {
+    m_hostExists = true;
+    for (const auto &token : tokens)
+      m_hostExists &= !QHostAddress(token.trimmed()).isNull();
+  }
+
   // Check if host name exists
-  if (QHostAddress(address).isNull())
+  else if (QHostAddress(address).isNull())
   {
     m_hostExists = false;
     lookup(address);
@@ -429,6 +529,18 @@ void IO::Drivers::Network::setUdpMulticast(const bool enabled)
   Q_EMIT udpMulticastChanged();
 }
 
+/**
+ * @brief Changes the number of UDP receive queues (see @c udpQueueCount()).
+ *
+ * The count is clamped to the number of processor cores; the new value is
+ * applied the next time the connection is opened.
+ */
+void IO::Drivers::Network::setUdpQueueCount(const int count)
+{
+  m_udpQueueCount = qBound(1, count, QThread::idealThreadCount());
+  Q_EMIT udpQueueCountChanged();
+}
+
 /**
  * Changes the current socket type given an index of the list returned by the
  * @c socketType() function.
@@ -463,24 +575,476 @@ void IO::Drivers::Network::setSocketType(const QAbstractSocket::SocketType type)
 
 /**
  * Reads incoming data from the UDP/TCP ports
+ *
+ * Data is read into recycled blocks from the manager's receive buffer pool,
+ * so steady-state ingest does not allocate on the heap.
  */
 void IO::Drivers::Network::onReadyRead()
 {
+  auto &pool = Manager::instance().receiveBufferPool();
+
   // Check if we need to use UDP socket functions
   if (socketType() == QAbstractSocket::UdpSocket)
   {
-    while (udpSocket()->hasPendingDatagrams())
+    // Drain the socket with recvmmsg() when the platform supports it
+#ifdef Q_OS_LINUX
+    if (readPendingDatagramsNative())
+      return;
+#endif
+
+    // Multicast fan-in, demux the pending datagrams by publisher so every
+    // publisher's bytes reach its own frame reader context
+    if (udpMulticast())
+    {
+      QByteArray scratch = pool.acquire();
+      while (udpSocket()->hasPendingDatagrams())
+      {
+        // Receive the datagram & identify its publisher
+        QHostAddress sender;
+        quint16 senderPort = 0;
+        const auto size = udpSocket()->pendingDatagramSize();
+        if (scratch.size() < size)
+          scratch.resize(size);
+        const auto bytes = udpSocket()->readDatagram(
+            scratch.data(), scratch.size(), &sender, &senderPort);
+        if (bytes <= 0)
+          continue;
+
+        // Append the payload to the publisher's batch
+        auto key = sender.toString().toUtf8();
+        key.append(':');
+        key.append(QByteArray::number(senderPort));
+        int index = m_senderIndex.value(key, -1);
+        if (index < 0)
+          index = registerMulticastSender(key, sender, senderPort);
+        m_multicastSources[index].batch.append(scratch.constData(), bytes);
+      }
+
+      pool.release(std::move(scratch));
+      flushMulticastBatches();
+    }
+
+    // Portable fallback, drain all pending datagrams into a single batch so
+    // the frame reader is fed once per readyRead instead of once per packet
+    else
     {
-      QByteArray datagram;
-      datagram.resize(int(udpSocket()->pendingDatagramSize()));
-      udpSocket()->readDatagram(datagram.data(), datagram.size());
-      processData(datagram);
+      QByteArray batch = pool.acquire();
+      batch.resize(0);
+      while (udpSocket()->hasPendingDatagrams())
+      {
+        const auto size = udpSocket()->pendingDatagramSize();
+        const auto offset = batch.size();
+        batch.resize(offset + size);
+        udpSocket()->readDatagram(batch.data() + offset, size);
+      }
+
+      if (!batch.isEmpty())
+        processData(batch);
+
+      pool.release(std::move(batch));
     }
   }
 
   // We are using the TCP socket...
   else if (socketType() == QAbstractSocket::TcpSocket)
-    processData(tcpSocket()->readAll());
+  {
+    while (tcpSocket()->bytesAvailable() > 0)
+    {
+      QByteArray buffer = pool.acquire();
+      const qint64 bytes = tcpSocket()->read(buffer.data(), buffer.size());
+      if (bytes <= 0)
+      {
+        pool.release(std::move(buffer));
+        break;
+      }
+
+      buffer.resize(bytes);
+      processData(buffer);
+      pool.release(std::move(buffer));
+    }
+  }
+}
+
+#ifdef Q_OS_LINUX
+/**
+ * Drains all pending UDP datagrams with a single recvmmsg() syscall pass.
+ *
+ * Up to 64 datagrams are received per syscall into a preallocated packet
+ * array, and the whole batch is handed to processData() in one call. This
+ * removes the per-datagram syscall and signal overhead that dominates when
+ * ingesting tens of thousands of small telemetry packets per second.
+ *
+ * @return True when the socket was drained natively, false when the caller
+ *         should fall back to the portable QUdpSocket read loop.
+ */
+bool IO::Drivers::Network::readPendingDatagramsNative()
+{
+  // Validate native socket descriptor
+  const int fd = static_cast<int>(udpSocket()->socketDescriptor());
+  if (fd < 0)
+    return false;
+
+  // Preallocated packet array, reused across calls. Each slot holds the
+  // biggest payload a UDP datagram can legally carry, so the kernel never
+  // has to truncate — the untouched tail of a slot costs address space,
+  // not cache, since recvmmsg() only writes the received bytes.
+  constexpr int maxPackets = 64;
+  constexpr size_t packetSize = 65535;
+  static thread_local std::vector<char> storage(maxPackets *packetSize);
+  static thread_local std::vector<struct iovec> iovecs(maxPackets);
+  static thread_local std::vector<struct mmsghdr> msgs(maxPackets);
+  static thread_local std::vector<struct sockaddr_storage> senders(maxPackets);
+
+  // Multicast fan-in demuxes the batch by publisher, see onReadyRead()
+  const bool demux = udpMulticast();
+
+  // Accumulate every received datagram into a single batch
+  auto &pool = Manager::instance().receiveBufferPool();
+  QByteArray batch;
+  if (!demux)
+  {
+    batch = pool.acquire();
+    batch.resize(0);
+  }
+
+  // Keep issuing recvmmsg() passes until the socket is empty
+  while (true)
+  {
+    // Describe the packet array for the kernel
+    for (int i = 0; i < maxPackets; ++i)
+    {
+      iovecs[i].iov_base = storage.data() + i * packetSize;
+      iovecs[i].iov_len = packetSize;
+      std::memset(&msgs[i], 0, sizeof(struct mmsghdr));
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = &senders[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+    }
+
+    // Receive up to maxPackets datagrams in one syscall
+    const int received
+        = recvmmsg(fd, msgs.data(), maxPackets, MSG_DONTWAIT, nullptr);
+    if (received <= 0)
+      break;
+
+    // Append the received datagrams to their publisher's batch; the raw
+    // kernel-reported sender address doubles as the lookup key, so the hot
+    // path never renders an address string
+    if (demux)
+    {
+      for (int i = 0; i < received; ++i)
+      {
+        // Never forward a truncated payload as a corrupt partial frame;
+        // the slots cover the maximum UDP payload, so this cannot fire
+        // for a well-formed datagram
+        if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC)
+        {
+          qWarning() << "Dropped truncated UDP datagram";
+          continue;
+        }
+
+        const QByteArray key(reinterpret_cast<const char *>(&senders[i]),
+                             msgs[i].msg_hdr.msg_namelen);
+        int index = m_senderIndex.value(key, -1);
+        if (index < 0)
+        {
+          const auto *sa
+              = reinterpret_cast<const struct sockaddr *>(&senders[i]);
+          quint16 port = 0;
+          if (sa->sa_family == AF_INET)
+            port = ntohs(
+                reinterpret_cast<const struct sockaddr_in *>(sa)->sin_port);
+          else if (sa->sa_family == AF_INET6)
+            port = ntohs(
+                reinterpret_cast<const struct sockaddr_in6 *>(sa)->sin6_port);
+
+          index = registerMulticastSender(key, QHostAddress(sa), port);
+        }
+
+        m_multicastSources[index].batch.append(storage.data() + i * packetSize,
+                                               msgs[i].msg_len);
+      }
+    }
+
+    // Single publisher pipeline, append everything to one batch
+    else
+    {
+      for (int i = 0; i < received; ++i)
+      {
+        if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC)
+        {
+          qWarning() << "Dropped truncated UDP datagram";
+          continue;
+        }
+
+        batch.append(storage.data() + i * packetSize, msgs[i].msg_len);
+      }
+    }
+
+    // Short read, the socket is drained
+    if (received < maxPackets)
+      break;
+  }
+
+  // Hand each publisher's batch to its frame reader context
+  if (demux)
+    flushMulticastBatches();
+
+  // Feed the frame reader with the whole batch at once
+  else
+  {
+    if (!batch.isEmpty())
+      processData(batch);
+
+    pool.release(std::move(batch));
+  }
+
+  return true;
+}
+
+/**
+ * @brief Creates a datagram socket bound to the local port with SO_REUSEPORT.
+ *
+ * Every socket bound this way shares the port, and the kernel hashes each
+ * incoming flow to exactly one of them — the fan-out a single socket cannot
+ * provide no matter how efficiently it is drained.
+ *
+ * @return The bound socket descriptor, or -1 on failure.
+ */
+int IO::Drivers::Network::createReusePortSocket(const quint16 port)
+{
+  const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+  if (fd < 0)
+    return -1;
+
+  int enable = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+  if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != 0)
+  {
+    ::close(fd);
+    return -1;
+  }
+
+  struct sockaddr_in addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (::bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr))
+      != 0)
+  {
+    ::close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+/**
+ * @brief Opens the auxiliary SO_REUSEPORT receive queues.
+ *
+ * Queue zero is the primary socket, drained on this thread as usual. Every
+ * additional queue owns its own SO_REUSEPORT socket, a blocking receive
+ * thread and a pass-through stream registered with the I/O manager, which
+ * gives it a dedicated FrameReader ring on its own worker thread; the
+ * extracted frames of all queues merge in the manager's shared frame
+ * stream. Ingest therefore scales with the number of queues instead of
+ * being capped by how fast one thread can drain one socket.
+ */
+void IO::Drivers::Network::openReusePortQueues()
+{
+  m_reusePortActive.store(true, std::memory_order_release);
+
+  const int queues = udpQueueCount() - 1;
+  for (int i = 0; i < queues; ++i)
+  {
+    const int fd = createReusePortSocket(udpLocalPort());
+    if (fd < 0)
+      break;
+
+    ReusePortQueue queue;
+    queue.fd = fd;
+    queue.stream = new MulticastStream();
+    queue.stream->setParent(this);
+    queue.sourceId = Manager::instance().registerSource(
+        queue.stream, QStringLiteral("queue %1").arg(i + 1));
+    queue.thread = QThread::create(
+        [this, fd, stream = queue.stream] { serviceReusePortQueue(fd, stream); });
+    queue.thread->start();
+    m_reusePortQueues.append(queue);
+  }
+}
+
+/**
+ * @brief Stops the receive threads & retires the auxiliary queues.
+ *
+ * The receive sockets carry a short timeout, so every thread notices the
+ * cleared active flag within one timeout period and exits its drain loop.
+ */
+void IO::Drivers::Network::closeReusePortQueues()
+{
+  m_reusePortActive.store(false, std::memory_order_release);
+
+  for (auto &queue : m_reusePortQueues)
+  {
+    queue.thread->wait();
+    delete queue.thread;
+    ::close(queue.fd);
+
+    Manager::instance().removeSource(queue.sourceId);
+    queue.stream->deleteLater();
+  }
+
+  m_reusePortQueues.clear();
+}
+
+/**
+ * @brief Drain loop of one auxiliary receive queue, runs on its own thread.
+ *
+ * Mirrors readPendingDatagramsNative(): datagrams are received in batches
+ * of up to 64 per recvmmsg() syscall and handed to the queue's stream as a
+ * single chunk, so per-packet overhead stays off the hot path. The socket
+ * blocks with a short timeout between batches, which doubles as the
+ * shutdown poll interval.
+ */
+void IO::Drivers::Network::serviceReusePortQueue(const int fd,
+                                                MulticastStream *stream)
+{
+  // Slots cover the maximum legal UDP payload so the kernel never has to
+  // truncate, same sizing rationale as readPendingDatagramsNative()
+  constexpr int maxPackets = 64;
+  constexpr size_t packetSize = 65535;
+  std::vector<char> storage(maxPackets * packetSize);
+  std::vector<struct iovec> iovecs(maxPackets);
+  std::vector<struct mmsghdr> msgs(maxPackets);
+
+  // Wake up periodically to poll the shutdown flag
+  struct timeval timeout;
+  timeout.tv_sec = 0;
+  timeout.tv_usec = 100 * 1000;
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  QByteArray batch;
+  while (m_reusePortActive.load(std::memory_order_acquire))
+  {
+    // Describe the packet array for the kernel
+    for (int i = 0; i < maxPackets; ++i)
+    {
+      iovecs[i].iov_base = storage.data() + i * packetSize;
+      iovecs[i].iov_len = packetSize;
+      std::memset(&msgs[i], 0, sizeof(struct mmsghdr));
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // Block until at least one datagram arrives (or the timeout expires)
+    const int received
+        = recvmmsg(fd, msgs.data(), maxPackets, MSG_WAITFORONE, nullptr);
+    if (received <= 0)
+      continue;
+
+    // Hand the whole batch to the queue's frame reader in one call,
+    // dropping (never forwarding) anything the kernel truncated
+    batch.resize(0);
+    for (int i = 0; i < received; ++i)
+    {
+      if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC)
+      {
+        qWarning() << "Dropped truncated UDP datagram";
+        continue;
+      }
+
+      batch.append(storage.data() + i * packetSize, msgs[i].msg_len);
+    }
+
+    if (!batch.isEmpty())
+      stream->ingest(batch);
+  }
+}
+#endif
+
+/**
+ * @brief Registers a newly observed multicast publisher.
+ *
+ * The first publisher keeps the driver's primary pipeline, so sessions with a
+ * single publisher behave exactly like a unicast connection. Every later
+ * publisher gets a MulticastStream registered with the I/O manager, which
+ * spawns a dedicated FrameReader context on its own worker thread and merges
+ * the extracted frames into the dashboard stream under a "address:port" tag.
+ *
+ * @param key The demux key the receive paths look the publisher up with.
+ * @param address The publisher's source address.
+ * @param port The publisher's source port.
+ * @return The index of the publisher's demux context.
+ */
+int IO::Drivers::Network::registerMulticastSender(const QByteArray &key,
+                                                  const QHostAddress &address,
+                                                  const quint16 port)
+{
+  MulticastSource source;
+  source.sourceId = -1;
+  source.stream = nullptr;
+
+  // Additional publisher, hand it a dedicated frame reader context
+  if (!m_multicastSources.isEmpty())
+  {
+    const auto tag
+        = QStringLiteral("%1:%2").arg(address.toString()).arg(port);
+    source.stream = new MulticastStream();
+    source.stream->setParent(this);
+    source.sourceId = Manager::instance().registerSource(source.stream, tag);
+  }
+
+  m_senderIndex.insert(key, m_multicastSources.count());
+  m_multicastSources.append(std::move(source));
+  return m_multicastSources.count() - 1;
+}
+
+/**
+ * @brief Hands each publisher's accumulated batch to its pipeline.
+ *
+ * Called once per socket drain pass: the primary publisher's bytes flow
+ * through the driver's regular processData() path, every other publisher's
+ * bytes are ingested by its dedicated stream. Batch buffers keep their
+ * capacity, so steady-state demuxing does not allocate.
+ */
+void IO::Drivers::Network::flushMulticastBatches()
+{
+  for (auto &source : m_multicastSources)
+  {
+    if (source.batch.isEmpty())
+      continue;
+
+    if (source.stream)
+      source.stream->ingest(source.batch);
+    else
+      processData(source.batch);
+
+    source.batch.resize(0);
+  }
+}
+
+/**
+ * @brief Retires every per-publisher frame reader context.
+ *
+ * Unregisters the auxiliary sources from the I/O manager and releases the
+ * stream drivers; called when the connection closes so the next session
+ * starts with a clean publisher table.
+ */
+void IO::Drivers::Network::clearMulticastSources()
+{
+  for (auto &source : m_multicastSources)
+  {
+    if (source.stream)
+    {
+      Manager::instance().removeSource(source.sourceId);
+      source.stream->deleteLater();
+    }
+  }
+
+  m_senderIndex.clear();
+  m_multicastSources.clear();
 }
 
 /**
@@ -498,11 +1062,29 @@ void IO::Drivers::Network::lookupFinished(const QHostInfo &info)
     if (addresses.count() >= 1)
     {
       m_hostExists = true;
+      m_remoteAddresses = addresses;
+
+      // A connection attempt was waiting on this resolution, start the race
+      if (m_raceWhenResolved)
+      {
+        m_raceWhenResolved = false;
+        startConnectionRace();
+      }
+
       Q_EMIT addressChanged();
       return;
     }
   }
 
+  // Resolution failed while a connection attempt was waiting on it
+  if (m_raceWhenResolved)
+  {
+    m_raceWhenResolved = false;
+    if (!Manager::instance().handleConnectionDropped())
+      Misc::Utilities::showMessageBox(
+          tr("Network socket error"), info.errorString(), QMessageBox::Critical);
+  }
+
   Q_EMIT lookupActiveChanged();
 }
 
@@ -515,13 +1097,183 @@ void IO::Drivers::Network::onErrorOccurred(
 {
   QString error;
   if (socketType() == QAbstractSocket::TcpSocket)
-    error = m_tcpSocket.errorString();
+    error = m_tcpSocket->errorString();
   else if (socketType() == QAbstractSocket::UdpSocket)
     error = m_udpSocket.errorString();
   else
     error = QString::number(socketError);
 
-  Manager::instance().disconnectDevice();
+  // Attempt a warm reconnect before bothering the user
+  if (Manager::instance().handleConnectionDropped())
+    return;
+
   Misc::Utilities::showMessageBox(tr("Network socket error"), error,
                                   QMessageBox::Critical);
 }
+
+//------------------------------------------------------------------------------
+// Happy-eyeballs connection racing
+//------------------------------------------------------------------------------
+
+/**
+ * Starts a connection race against every resolved address of the remote host.
+ *
+ * One candidate socket is launched per address, staggered by
+ * @c AttemptDelayMs so the preferred address still wins when it answers
+ * promptly. The first candidate to complete the TCP handshake becomes the
+ * active socket and the rest are aborted, so a dead first address costs one
+ * stagger interval instead of a full connect timeout.
+ */
+void IO::Drivers::Network::startConnectionRace()
+{
+  abortConnectionRace();
+  m_nextAddress = 0;
+  startNextAttempt();
+}
+
+/**
+ * Aborts every in-flight candidate socket and stops the stagger timer.
+ */
+void IO::Drivers::Network::abortConnectionRace()
+{
+  m_attemptTimer.stop();
+  for (auto *candidate : std::as_const(m_candidates))
+  {
+    candidate->disconnect(this);
+    candidate->abort();
+    candidate->deleteLater();
+  }
+
+  m_candidates.clear();
+}
+
+/**
+ * Launches the next candidate socket of the connection race and re-arms the
+ * stagger timer while untried addresses remain.
+ */
+void IO::Drivers::Network::startNextAttempt()
+{
+  const auto addresses = orderedRemoteAddresses();
+  if (m_nextAddress >= addresses.count())
+    return;
+
+  auto *candidate = new QTcpSocket(this);
+  m_candidates.append(candidate);
+  connect(candidate, &QTcpSocket::connected, this,
+          &IO::Drivers::Network::onCandidateConnected);
+  connect(candidate, &QTcpSocket::errorOccurred, this,
+          &IO::Drivers::Network::onCandidateError);
+  candidate->connectToHost(addresses.at(m_nextAddress++), tcpPort());
+
+  if (m_nextAddress < addresses.count())
+    m_attemptTimer.start();
+}
+
+/**
+ * Promotes the first candidate that completes its handshake to the active
+ * TCP socket and aborts the losing candidates.
+ */
+void IO::Drivers::Network::onCandidateConnected()
+{
+  auto *winner = qobject_cast<QTcpSocket *>(sender());
+  if (!winner || !m_candidates.contains(winner))
+    return;
+
+  // Cancel the losing candidates & the stagger timer
+  m_candidates.removeAll(winner);
+  abortConnectionRace();
+
+  // Promote the winner to active socket, this wires readyRead & errors
+  winner->disconnect(this);
+  adoptTcpSocket(winner);
+}
+
+/**
+ * Discards a failed candidate. The failure is only surfaced to the user when
+ * no other candidate remains and every address has been tried.
+ */
+void IO::Drivers::Network::onCandidateError()
+{
+  auto *candidate = qobject_cast<QTcpSocket *>(sender());
+  if (!candidate || !m_candidates.contains(candidate))
+    return;
+
+  const auto error = candidate->errorString();
+  m_candidates.removeAll(candidate);
+  candidate->disconnect(this);
+  candidate->abort();
+  candidate->deleteLater();
+
+  // Untried addresses remain, skip the stagger delay & try the next one now
+  if (m_nextAddress < orderedRemoteAddresses().count())
+  {
+    m_attemptTimer.stop();
+    startNextAttempt();
+  }
+
+  // Every attempt failed, hand over to the reconnect engine & only report
+  // the error to the user when no warm reconnect cycle was engaged
+  else if (m_candidates.isEmpty())
+  {
+    if (!Manager::instance().handleConnectionDropped())
+      Misc::Utilities::showMessageBox(tr("Network socket error"), error,
+                                      QMessageBox::Critical);
+  }
+}
+
+/**
+ * Replaces the active TCP socket with @a socket and wires its signals.
+ *
+ * Used both to create the initial socket and to promote the winner of a
+ * connection race, so every consumer keeps talking to tcpSocket() without
+ * caring how the connection was established.
+ */
+void IO::Drivers::Network::adoptTcpSocket(QTcpSocket *socket)
+{
+  if (m_tcpSocket)
+  {
+    m_tcpSocket->disconnect(this);
+    m_tcpSocket->abort();
+    m_tcpSocket->deleteLater();
+  }
+
+  m_tcpSocket = socket;
+  connect(m_tcpSocket, &QTcpSocket::stateChanged, this,
+          [=] { Q_EMIT configurationChanged(); });
+  connect(m_tcpSocket, &QTcpSocket::errorOccurred, this,
+          &IO::Drivers::Network::onErrorOccurred);
+  connect(m_tcpSocket, &QTcpSocket::readyRead, this,
+          &IO::Drivers::Network::onReadyRead, Qt::UniqueConnection);
+
+  Q_EMIT configurationChanged();
+}
+
+/**
+ * Returns the resolved addresses of the remote host with the IPv6 and IPv4
+ * families interleaved, so a broken network for one family does not serialize
+ * the whole race behind it.
+ */
+QList<QHostAddress> IO::Drivers::Network::orderedRemoteAddresses() const
+{
+  QList<QHostAddress> v4;
+  QList<QHostAddress> v6;
+  for (const auto &address : m_remoteAddresses)
+  {
+    if (address.protocol() == QAbstractSocket::IPv6Protocol)
+      v6.append(address);
+    else
+      v4.append(address);
+  }
+
+  QList<QHostAddress> ordered;
+  const auto count = qMax(v4.count(), v6.count());
+  for (auto i = 0; i < count; ++i)
+  {
+    if (i < v6.count())
+      ordered.append(v6.at(i));
+    if (i < v4.count())
+      ordered.append(v4.at(i));
+  }
+
+  return ordered;
+}
@@ -21,6 +21,12 @@
 
 #pragma once
 
+#include <atomic>
+
+#include <QHash>
+#include <QTimer>
+#include <QVector>
+#include <QThread>
 #include <QHostInfo>
 #include <QTcpSocket>
 #include <QUdpSocket>
@@ -34,6 +40,30 @@ namespace IO
 {
 namespace Drivers
 {
+/**
+ * @brief Pass-through driver representing one demultiplexed ingest lane.
+ *
+ * The network driver registers one of these with the I/O manager for every
+ * additional ingest lane it services — a multicast publisher observed on
+ * the joined groups, or an extra SO_REUSEPORT receive queue — which gives
+ * each lane its own FrameReader context on a dedicated worker thread (see
+ * IO::Manager::registerSource). The instance owns no socket: the network
+ * driver hands each lane's bytes over through ingest().
+ */
+class MulticastStream : public HAL_Driver
+{
+public:
+  void close() override {}
+  [[nodiscard]] bool isOpen() const override { return true; }
+  [[nodiscard]] bool isReadable() const override { return true; }
+  [[nodiscard]] bool isWritable() const override { return false; }
+  [[nodiscard]] bool configurationOk() const override { return true; }
+  [[nodiscard]] quint64 write(const QByteArray &) override { return 0; }
+  [[nodiscard]] bool open(const QIODevice::OpenMode) override { return true; }
+
+  void ingest(const QByteArray &data) { processData(data); }
+};
+
 /**
  * @brief The Network class
  *
@@ -89,6 +119,10 @@ class Network : public HAL_Driver
              READ udpMulticast
              WRITE setUdpMulticast
              NOTIFY udpMulticastChanged)
+  Q_PROPERTY(int udpQueueCount
+             READ udpQueueCount
+             WRITE setUdpQueueCount
+             NOTIFY udpQueueCountChanged)
   // clang-format on
 
 signals:
@@ -96,6 +130,7 @@ signals:
   void addressChanged();
   void socketTypeChanged();
   void udpMulticastChanged();
+  void udpQueueCountChanged();
   void lookupActiveChanged();
 
 private:
@@ -122,11 +157,12 @@ public:
   [[nodiscard]] quint16 udpRemotePort() const;
 
   [[nodiscard]] bool udpMulticast() const;
+  [[nodiscard]] int udpQueueCount() const;
   [[nodiscard]] bool lookupActive() const;
   [[nodiscard]] int socketTypeIndex() const;
   [[nodiscard]] QAbstractSocket::SocketType socketType() const;
 
-  [[nodiscard]] QTcpSocket *tcpSocket() { return &m_tcpSocket; }
+  [[nodiscard]] QTcpSocket *tcpSocket() { return m_tcpSocket; }
   [[nodiscard]] QUdpSocket *udpSocket() { return &m_udpSocket; }
 
   [[nodiscard]] const QString &remoteAddress() const;
@@ -148,6 +184,7 @@ public slots:
   void setTcpPort(const quint16 port);
   void setUdpLocalPort(const quint16 port);
   void setUdpMulticast(const bool enabled);
+  void setUdpQueueCount(const int count);
   void setSocketTypeIndex(const int index);
   void setUdpRemotePort(const quint16 port);
   void setRemoteAddress(const QString &address);
@@ -155,21 +192,94 @@ public slots:
 
 private slots:
   void onReadyRead();
+  void startNextAttempt();
+  void onCandidateError();
+  void onCandidateConnected();
+
+private:
+  void startConnectionRace();
+  void abortConnectionRace();
+  void adoptTcpSocket(QTcpSocket *socket);
+  [[nodiscard]] QList<QHostAddress> orderedRemoteAddresses() const;
+
+#ifdef Q_OS_LINUX
+  bool readPendingDatagramsNative();
+  static int createReusePortSocket(const quint16 port);
+  void openReusePortQueues();
+  void closeReusePortQueues();
+  void serviceReusePortQueue(const int fd, MulticastStream *stream);
+#endif
+
+  int registerMulticastSender(const QByteArray &key,
+                              const QHostAddress &address, const quint16 port);
+  void flushMulticastBatches();
+  void clearMulticastSources();
+
+private slots:
   void lookupFinished(const QHostInfo &info);
   void onErrorOccurred(const QAbstractSocket::SocketError socketError);
 
+private:
+  static constexpr int AttemptDelayMs = 250;
+
 private:
   QString m_address;
   quint16 m_tcpPort;
   bool m_hostExists;
   bool m_udpMulticast;
   bool m_lookupActive;
+  bool m_raceWhenResolved;
   quint16 m_udpLocalPort;
   quint16 m_udpRemotePort;
+  int m_udpQueueCount;
   QAbstractSocket::SocketType m_socketType;
 
-  QTcpSocket m_tcpSocket;
+  QTcpSocket *m_tcpSocket;
   QUdpSocket m_udpSocket;
+
+  int m_nextAddress;
+  QTimer m_attemptTimer;
+  QList<QTcpSocket *> m_candidates;
+  QList<QHostAddress> m_remoteAddresses;
+
+  /**
+   * @brief Demux context of one multicast publisher.
+   *
+   * The first publisher observed keeps the driver's primary pipeline
+   * (@c stream is null), every later one feeds a dedicated MulticastStream.
+   * The batch buffer accumulates the publisher's datagrams of one socket
+   * drain pass and keeps its capacity between passes.
+   */
+  struct MulticastSource
+  {
+    int sourceId;
+    QByteArray batch;
+    MulticastStream *stream;
+  };
+
+  QHash<QByteArray, int> m_senderIndex;
+  QVector<MulticastSource> m_multicastSources;
+
+#ifdef Q_OS_LINUX
+  /**
+   * @brief One auxiliary SO_REUSEPORT receive queue.
+   *
+   * Owns a raw datagram socket bound to the same local port as the primary
+   * socket, a blocking receive thread draining it and a pass-through stream
+   * whose FrameReader context merges the extracted frames into the shared
+   * pipeline (see IO::Manager::registerSource).
+   */
+  struct ReusePortQueue
+  {
+    int fd;
+    int sourceId;
+    QThread *thread;
+    MulticastStream *stream;
+  };
+
+  std::atomic<bool> m_reusePortActive;
+  QVector<ReusePortQueue> m_reusePortQueues;
+#endif
 };
 } // namespace Drivers
 } // namespace IO
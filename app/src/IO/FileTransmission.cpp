@@ -24,21 +24,41 @@
 #include <QApplication>
 
 #include "IO/Manager.h"
+#include "IO/Drivers/UART.h"
 #include "Misc/Translator.h"
 #include "IO/FileTransmission.h"
 
+/**
+ * @brief Number of bytes kept in flight during windowed transmission.
+ *
+ * When the line transmission interval is 0, the transfer is paced by the
+ * device instead of the timer: chunks are written until this many bytes are
+ * outstanding and the window is refilled as the port reports bytesWritten().
+ */
+static constexpr qint64 TxWindowSize = 16 * 1024;
+
+/**
+ * @brief Minimum time between transmission progress notifications (ms).
+ *
+ * Progress updates only need to be emitted at display rate; emitting them for
+ * every chunk would make the UI, not the UART, the transfer bottleneck.
+ */
+static constexpr qint64 ProgressIntervalMs = 66;
+
 /**
  * Constructor function
  */
 IO::FileTransmission::FileTransmission()
+  : m_lineInterval(100)
+  , m_bytesInFlight(0)
 {
   // Set stream object pointer to null
   m_stream = nullptr;
 
-  // Send a line to the serial device periodically
+  // Send a window of data to the serial device periodically
   m_timer.setInterval(100);
   m_timer.setTimerType(Qt::PreciseTimer);
-  connect(&m_timer, &QTimer::timeout, this, &FileTransmission::sendLine);
+  connect(&m_timer, &QTimer::timeout, this, &FileTransmission::sendWindow);
 }
 
 /**
@@ -108,7 +128,7 @@ int IO::FileTransmission::transmissionProgress() const
  */
 int IO::FileTransmission::lineTransmissionInterval() const
 {
-  return m_timer.interval();
+  return m_lineInterval;
 }
 
 /**
@@ -173,7 +193,9 @@ void IO::FileTransmission::closeFile()
 void IO::FileTransmission::stopTransmission()
 {
   m_timer.stop();
+  m_bytesInFlight = 0;
   emit activeChanged();
+  emit transmissionProgressChanged();
 }
 
 /**
@@ -194,9 +216,21 @@ void IO::FileTransmission::beginTransmission()
       emit transmissionProgressChanged();
     }
 
-    // Start timer
+    // Refill the transmission window as the serial port drains it
+    if (IO::Manager::instance().busType() == SerialStudio::BusType::UART)
+    {
+      auto *port = IO::Drivers::UART::instance().port();
+      if (port)
+        connect(port, &QSerialPort::bytesWritten, this,
+                &IO::FileTransmission::onBytesWritten, Qt::UniqueConnection);
+    }
+
+    // Start timer & pre-fill the transmission window
+    m_bytesInFlight = 0;
+    m_progressThrottle.start();
     m_timer.start();
     emit activeChanged();
+    sendWindow();
   }
 
   // Stop transmission if serial device is closed
@@ -228,19 +262,37 @@ void IO::FileTransmission::setupExternalConnections()
 /**
  * Changes the time interval to wait after sending one line from the
  * currently selected file.
+ *
+ * @note An interval of 0 enables windowed transmission, where the transfer
+ *       rate is limited by the device instead of the timer.
  */
 void IO::FileTransmission::setLineTransmissionInterval(const int msec)
 {
-  m_timer.setInterval(qMax(0, msec));
+  m_lineInterval = qMax(0, msec);
+
+  // In windowed mode the timer only acts as a refill watchdog; the real
+  // pacing comes from the port's bytesWritten() notifications
+  m_timer.setInterval(m_lineInterval > 0 ? m_lineInterval : 100);
+  emit lineTransmissionIntervalChanged();
 }
 
 /**
- * Transmits a new line from the selected file to the serial port device.
+ * Transmits the next window of data from the selected file.
+ *
+ * With a non-zero line transmission interval, one line is sent per timer tick
+ * to honor the user-configured pacing. With an interval of 0, lines are
+ * written until TxWindowSize bytes are in flight; onBytesWritten() refills
+ * the window as the port drains, so the link stays saturated without the
+ * event loop in the critical path.
+ *
+ * Lines go through IO::Manager's bulk transmit lane, so dashboard actions
+ * and console commands issued mid-transfer overtake the queued backlog at
+ * the next chunk boundary instead of waiting behind the whole window.
  *
  * @note If EOF is reached, then the transmission process is automatically
  *       stopped
  */
-void IO::FileTransmission::sendLine()
+void IO::FileTransmission::sendWindow()
 {
   // Transmission disabled, abort
   if (!active())
@@ -250,29 +302,69 @@ void IO::FileTransmission::sendLine()
   if (!IO::Manager::instance().isConnected())
     return;
 
-  // Send next line to device
-  if (m_stream && !m_stream->atEnd())
+  // No stream to read from, abort
+  if (!m_stream)
+    return;
+
+  // Send lines until the window is full (or a single line in paced mode)
+  while (!m_stream->atEnd())
+  {
+    auto line = m_stream->readLine();
+    if (!line.isEmpty())
+    {
+      if (!line.endsWith("\n"))
+        line.append("\n");
+
+      const auto data = line.toUtf8();
+      IO::Manager::instance().writeBulkData(data);
+      m_bytesInFlight += data.size();
+    }
+
+    // Paced mode, one line per timer tick
+    if (lineTransmissionInterval() > 0)
+      break;
+
+    // Windowed mode, stop refilling once enough bytes are in flight
+    if (m_bytesInFlight >= TxWindowSize)
+      break;
+  }
+
+  // Update the UI at display rate, not at chunk rate
+  emitProgressThrottled();
+
+  // Reached end of file, stop transmission once the window drains. Buses
+  // without bytesWritten() feedback stop right away, as before.
+  if (m_stream->atEnd())
   {
-    QMetaObject::invokeMethod(
-        this,
-        [=] {
-          if (m_stream)
-          {
-            auto line = m_stream->readLine();
-            if (!line.isEmpty())
-            {
-              if (!line.endsWith("\n"))
-                line.append("\n");
-
-              IO::Manager::instance().writeData(line.toUtf8());
-              emit transmissionProgressChanged();
-            }
-          }
-        },
-        Qt::QueuedConnection);
+    const bool feedback
+        = IO::Manager::instance().busType() == SerialStudio::BusType::UART;
+    if (!feedback || m_bytesInFlight <= 0)
+      stopTransmission();
   }
+}
 
-  // Reached end of file, stop transmission
-  else
-    stopTransmission();
+/**
+ * Refills the transmission window as the serial port reports written data.
+ *
+ * @param bytes Number of bytes the port has flushed to the device.
+ */
+void IO::FileTransmission::onBytesWritten(const qint64 bytes)
+{
+  m_bytesInFlight = qMax<qint64>(0, m_bytesInFlight - bytes);
+  if (active() && lineTransmissionInterval() == 0
+      && m_bytesInFlight < TxWindowSize)
+    sendWindow();
+}
+
+/**
+ * Emits transmissionProgressChanged() at most every ProgressIntervalMs.
+ */
+void IO::FileTransmission::emitProgressThrottled()
+{
+  if (!m_progressThrottle.isValid()
+      || m_progressThrottle.elapsed() >= ProgressIntervalMs)
+  {
+    m_progressThrottle.restart();
+    emit transmissionProgressChanged();
+  }
 }
@@ -25,6 +25,7 @@
 #include <QTimer>
 #include <QObject>
 #include <QTextStream>
+#include <QElapsedTimer>
 
 namespace IO
 {
@@ -82,11 +83,19 @@ public slots:
   void setLineTransmissionInterval(const int msec);
 
 private slots:
-  void sendLine();
+  void sendWindow();
+  void onBytesWritten(const qint64 bytes);
+
+private:
+  void emitProgressThrottled();
 
 private:
   QFile m_file;
   QTimer m_timer;
   QTextStream *m_stream;
+
+  int m_lineInterval;
+  qint64 m_bytesInFlight;
+  QElapsedTimer m_progressThrottle;
 };
 } // namespace IO
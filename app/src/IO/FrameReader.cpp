@@ -21,10 +21,64 @@
 
 #include "FrameReader.h"
 
+#include <QtMath>
+#include <QDateTime>
+#include <QStringList>
+
 #include "IO/Manager.h"
 #include "IO/Checksum.h"
 #include "JSON/FrameBuilder.h"
 #include "JSON/ProjectModel.h"
+#include "Misc/AllocationTracker.h"
+
+//------------------------------------------------------------------------------
+// Checksum trailer dispatch table
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Widens the CRC-8 implementation to the common dispatch signature.
+ */
+static quint32 crc8Word(const char *data, const int length)
+{
+  return IO::crc8(data, length);
+}
+
+/**
+ * @brief Widens the CRC-16 implementation to the common dispatch signature.
+ */
+static quint32 crc16Word(const char *data, const int length)
+{
+  return IO::crc16(data, length);
+}
+
+/**
+ * @brief Identity wrapper so CRC-32 matches the common dispatch signature.
+ */
+static quint32 crc32Word(const char *data, const int length)
+{
+  return IO::crc32(data, length);
+}
+
+/**
+ * @brief One probed checksum trailer algorithm.
+ *
+ * The table below is indexed by the algorithm resolved during stream
+ * detection, so the per-frame validation path is reduced to one header
+ * search plus an indirect call through @c function instead of re-probing
+ * every known trailer on each frame.
+ */
+struct ChecksumAlgorithm
+{
+  const char *header;
+  int length;
+  quint32 (*function)(const char *data, const int length);
+};
+
+static constexpr ChecksumAlgorithm ChecksumAlgorithms[] = {
+    {"crc8:", 1, &crc8Word},
+    {"crc16:", 2, &crc16Word},
+    {"crc32:", 4, &crc32Word},
+};
 
 /**
  * @brief Constructs a FrameReader object.
@@ -37,14 +91,30 @@
  */
 IO::FrameReader::FrameReader(QObject *parent)
   : QObject(parent)
+  , m_paused(false)
   , m_enableCrc(false)
+  , m_filterHasAcceptRules(false)
+  , m_checksumAlgorithm(-1)
+  , m_lowFillStreak(0)
+  , m_fruitlessScans(0)
+  , m_analysisEmitted(false)
+  , m_lastScanFill(0)
+  , m_frameLength(64)
+  , m_ingestEmitted(0)
+  , m_ingestWake(false)
+  , m_directProducer(false)
+  , m_captureTimestamp(0)
   , m_operationMode(SerialStudio::QuickPlot)
   , m_frameDetectionMode(SerialStudio::EndDelimiterOnly)
+  , m_extractFrames(nullptr)
   , m_dataBuffer(1024 * 1024)
+  , m_rejectHead(0)
+  , m_rejectCount(0)
 {
   m_quickPlotEndSequences.append(QByteArray("\n"));
   m_quickPlotEndSequences.append(QByteArray("\r"));
   m_quickPlotEndSequences.append(QByteArray("\r\n"));
+  selectFrameExtractor();
 }
 
 /**
@@ -97,6 +167,85 @@ const QByteArray &IO::FrameReader::finishSequence() const
   return m_finishSequence;
 }
 
+/**
+ * @brief Returns the number of append operations that overran the buffer.
+ */
+quint64 IO::FrameReader::bufferOverruns() const
+{
+  return m_dataBuffer.overruns();
+}
+
+/**
+ * @brief Returns the total number of bytes dropped due to buffer overruns,
+ *        plus any bytes refused by the queued path while a direct producer
+ *        owned the ring.
+ */
+quint64 IO::FrameReader::droppedBytes() const
+{
+  return m_dataBuffer.droppedBytes() + m_queuedPathDrops.value();
+}
+
+/**
+ * @brief Declares (or revokes) a driver thread as the ring's sole producer.
+ *
+ * Called by the I/O manager around the connection lifecycle: set before the
+ * direct-ingest target is installed on the driver, cleared after it is
+ * removed. While active, processData() refuses to append to or resize the
+ * SPSC ring, so events left over from the queued fallback path cannot race
+ * the driver thread during the switchover (see SPSCCircularBuffer::resize,
+ * which requires a quiescent producer).
+ */
+void IO::FrameReader::setDirectProducerActive(const bool active)
+{
+  m_directProducer.store(active, std::memory_order_release);
+}
+
+/**
+ * @brief Returns the number of frames rejected by checksum validation.
+ *
+ * The counter is updated from the worker thread and read from the UI, so it
+ * is kept in a lock-free atomic.
+ */
+quint64 IO::FrameReader::checksumErrors() const
+{
+  return m_checksumErrors.value();
+}
+
+/**
+ * @brief Returns the number of frames dropped by the pre-parse filter.
+ *
+ * The counter is updated from the worker thread and read from the UI, so it
+ * is kept in a lock-free atomic.
+ */
+quint64 IO::FrameReader::filteredFrames() const
+{
+  return m_filteredFrames.value();
+}
+
+/**
+ * @brief Returns the number of bytes currently queued in the data buffer.
+ */
+qsizetype IO::FrameReader::bufferFill() const
+{
+  return m_dataBuffer.size();
+}
+
+/**
+ * @brief Returns the current capacity of the internal data buffer.
+ */
+qsizetype IO::FrameReader::bufferCapacity() const
+{
+  return m_dataBuffer.capacity();
+}
+
+/**
+ * @brief Returns the highest buffer fill level observed so far.
+ */
+qsizetype IO::FrameReader::bufferHighWaterMark() const
+{
+  return m_dataBuffer.highWaterMark();
+}
+
 /**
  * @brief Resets the FrameReader's state.
  *
@@ -107,9 +256,246 @@ const QByteArray &IO::FrameReader::finishSequence() const
 void IO::FrameReader::reset()
 {
   m_enableCrc = false;
+  m_checksumAlgorithm = -1;
+  m_checksumDelimiter.clear();
+  m_fruitlessScans = 0;
+  m_analysisEmitted = false;
+  m_lastScanFill = 0;
   m_dataBuffer.clear();
 }
 
+/**
+ * @brief Samples the buffered stream and proposes frame-detection settings.
+ *
+ * Runs one scoring pass over (up to) the first 64 KB of buffered data:
+ * candidate delimiters are ranked by hit count, spacing regularity and
+ * sequence length, checksum trailers are detected by their headers, and the
+ * typical frame length is derived from the spacing of the winning delimiter.
+ * The findings are reported through streamAnalysisReady() as a
+ * human-readable summary.
+ *
+ * Invoked automatically (once per session) when the fruitless-scan governor
+ * in readFrames() engages, and available as a slot for manual diagnostics.
+ */
+void IO::FrameReader::analyzeStream()
+{
+  // Grab a bounded sample of the buffered stream
+  constexpr qsizetype maxSampleSize = 64 * 1024;
+  const qsizetype sampleSize = qMin(m_dataBuffer.size(), maxSampleSize);
+  if (sampleSize < 256)
+    return;
+
+  const QByteArray sample = m_dataBuffer.peekView(sampleSize).toByteArray();
+
+  // Candidate delimiters with printable names for the report
+  struct Candidate
+  {
+    QByteArray sequence;
+    const char *name;
+  };
+  static const Candidate candidates[] = {
+      {QByteArrayLiteral("\r\n"), "\\r\\n"},
+      {QByteArrayLiteral("\n"), "\\n"},
+      {QByteArrayLiteral("\r"), "\\r"},
+      {QByteArrayLiteral("*/"), "*/"},
+      {QByteArrayLiteral(";"), ";"},
+      {QByteArrayLiteral("|"), "|"},
+      {QByteArrayLiteral("\t"), "\\t"},
+  };
+
+  // Score every candidate over the sample
+  int bestCount = 0;
+  double bestScore = 0;
+  double bestMeanGap = 0;
+  const Candidate *best = nullptr;
+  for (const auto &candidate : candidates)
+  {
+    // Collect the gaps between consecutive occurrences
+    int count = 0;
+    qsizetype previous = -1;
+    double gapSum = 0, gapSqSum = 0;
+    for (qsizetype i = sample.indexOf(candidate.sequence); i != -1;
+         i = sample.indexOf(candidate.sequence, i + candidate.sequence.size()))
+    {
+      if (previous != -1)
+      {
+        const double gap = double(i - previous);
+        gapSum += gap;
+        gapSqSum += gap * gap;
+      }
+
+      previous = i;
+      ++count;
+    }
+
+    // Need a handful of hits for meaningful statistics
+    if (count < 4)
+      continue;
+
+    // Regular spacing scores higher than random occurrences, and longer
+    // sequences beat the single characters they contain ("\r\n" vs "\n")
+    const double meanGap = gapSum / (count - 1);
+    const double variance = gapSqSum / (count - 1) - meanGap * meanGap;
+    const double cv = meanGap > 0 ? qSqrt(qMax(0.0, variance)) / meanGap : 1;
+    const double score
+        = count * (2.0 - qMin(1.0, cv)) * candidate.sequence.size();
+    if (score > bestScore)
+    {
+      best = &candidate;
+      bestScore = score;
+      bestCount = count;
+      bestMeanGap = meanGap;
+    }
+  }
+
+  // Detect checksum trailers by their headers
+  QString checksum;
+  if (sample.contains(QByteArrayLiteral("crc32:")))
+    checksum = QStringLiteral("CRC-32");
+  else if (sample.contains(QByteArrayLiteral("crc16:")))
+    checksum = QStringLiteral("CRC-16");
+  else if (sample.contains(QByteArrayLiteral("crc8:")))
+    checksum = QStringLiteral("CRC-8");
+
+  // Report configured delimiters that never appear in the stream
+  QStringList report;
+  report.append(tr("Stream analysis of %1 sampled bytes:").arg(sampleSize));
+  const bool usesStart
+      = m_operationMode == SerialStudio::DeviceSendsJSON
+        || m_frameDetectionMode == SerialStudio::StartDelimiterOnly
+        || m_frameDetectionMode == SerialStudio::StartAndEndDelimiter
+        || m_frameDetectionMode == SerialStudio::FixedLength;
+  const bool usesFinish
+      = m_operationMode == SerialStudio::DeviceSendsJSON
+        || m_frameDetectionMode == SerialStudio::EndDelimiterOnly
+        || m_frameDetectionMode == SerialStudio::StartAndEndDelimiter;
+  if (usesStart && !m_startSequence.isEmpty()
+      && !sample.contains(m_startSequence))
+    report.append(tr("• The configured start delimiter was never received"));
+  if (usesFinish && !m_finishSequence.isEmpty()
+      && !sample.contains(m_finishSequence))
+    report.append(tr("• The configured end delimiter was never received"));
+
+  // Delimiter & frame length proposal
+  if (best)
+    report.append(tr("• Detected %1 frames delimited by \"%2\" "
+                     "(typical frame length: %3 bytes)")
+                      .arg(bestCount)
+                      .arg(QLatin1String(best->name))
+                      .arg(qRound(bestMeanGap)));
+
+  // No delimiter found, tell the user whether the stream is text or binary
+  else
+  {
+    qsizetype printable = 0;
+    for (const char byte : sample)
+      printable += (byte == '\n' || byte == '\r' || byte == '\t'
+                    || (byte >= 0x20 && byte < 0x7F));
+    if (printable * 10 >= sampleSize * 9)
+      report.append(tr("• No known delimiter found in the text stream"));
+    else
+      report.append(tr("• The stream appears to be binary, a plain "
+                       "delimiter is unlikely to match"));
+  }
+
+  // Checksum proposal
+  if (!checksum.isEmpty())
+    report.append(tr("• Frames appear to carry a %1 checksum").arg(checksum));
+
+  Q_EMIT streamAnalysisReady(report.join(QStringLiteral("\n")));
+}
+
+/**
+ * @brief Retains a frame that failed validation in the post-mortem ring.
+ *
+ * Copies the rejected payload (clamped to a small limit) together with the
+ * raw bytes that followed it in the buffer — the delimiter, the checksum
+ * trailer and the start of the next frame — so intermittent corruption can
+ * be inspected after the fact. Runs on the reader thread only; the ring is
+ * fixed-size and entries overwrite the oldest, so a once-a-day glitch is
+ * still there when someone looks hours later.
+ *
+ * @param frame The payload that failed validation.
+ * @param contextOffset Offset (within the unread buffer data) of the first
+ *                      byte following the payload.
+ */
+void IO::FrameReader::recordRejectedFrame(const ByteView &frame,
+                                          const qsizetype contextOffset)
+{
+  auto &entry = m_rejectRing[m_rejectHead];
+  entry.timestamp = QDateTime::currentMSecsSinceEpoch();
+  entry.frame = QByteArray(frame.data(), qMin(frame.size(), RejectFrameLimit));
+
+  // Grab the raw bytes that trail the payload in the buffer
+  entry.context.clear();
+  const auto view = m_dataBuffer.peekView(
+      qMin(m_dataBuffer.size(), contextOffset + RejectContextBytes));
+  if (view.size() > contextOffset)
+    entry.context
+        = QByteArray(view.data() + contextOffset, view.size() - contextOffset);
+
+  m_rejectHead = (m_rejectHead + 1) % RejectRingSize;
+  m_rejectCount = qMin(m_rejectCount + 1, RejectRingSize);
+}
+
+/**
+ * @brief Reports the retained rejected frames as a human-readable dump.
+ *
+ * Walks the post-mortem ring from the oldest entry to the newest and emits
+ * a report through rejectedFramesReady(): one block per rejection with the
+ * wall-clock time, the payload as text (unprintable bytes escaped) and hex,
+ * and the raw trailing context. Invoked on demand from the diagnostics
+ * page; runs on the reader thread like every other buffer access.
+ */
+void IO::FrameReader::dumpRejectedFrames()
+{
+  if (m_rejectCount == 0)
+  {
+    Q_EMIT rejectedFramesReady(
+        tr("No rejected frames have been recorded yet"));
+    return;
+  }
+
+  // Render a bounded byte string as escaped text
+  const auto printable = [](const QByteArray &data) {
+    QString text;
+    text.reserve(data.size());
+    for (const char byte : data)
+    {
+      if (byte >= 0x20 && byte < 0x7F)
+        text.append(QLatin1Char(byte));
+      else
+        text.append(QStringLiteral("\\x%1").arg(quint8(byte), 2, 16,
+                                                QLatin1Char('0')));
+    }
+
+    return text;
+  };
+
+  // Walk the ring from the oldest retained rejection to the newest
+  QStringList report;
+  report.append(tr("Last %1 rejected frame(s):").arg(m_rejectCount));
+  const int first
+      = (m_rejectHead - m_rejectCount + RejectRingSize) % RejectRingSize;
+  for (int i = 0; i < m_rejectCount; ++i)
+  {
+    const auto &entry = m_rejectRing[(first + i) % RejectRingSize];
+    const auto time = QDateTime::fromMSecsSinceEpoch(entry.timestamp);
+    report.append(QString());
+    report.append(tr("• %1, %2 byte payload:")
+                      .arg(time.toString(QStringLiteral("hh:mm:ss.zzz")))
+                      .arg(entry.frame.size()));
+    report.append(QStringLiteral("  text: %1").arg(printable(entry.frame)));
+    report.append(QStringLiteral("  hex:  %1")
+                      .arg(QString::fromLatin1(entry.frame.toHex(' '))));
+    if (!entry.context.isEmpty())
+      report.append(
+          QStringLiteral("  next: %1").arg(printable(entry.context)));
+  }
+
+  Q_EMIT rejectedFramesReady(report.join(QStringLiteral("\n")));
+}
+
 /**
  * @brief Sets up external connections for FrameReader.
  *
@@ -120,8 +506,20 @@ void IO::FrameReader::reset()
 void IO::FrameReader::setupExternalConnections()
 {
   setOperationMode(JSON::FrameBuilder::instance().operationMode());
+  setFrameFilter(JSON::ProjectModel::instance().frameFilter());
+  setFrameLength(JSON::ProjectModel::instance().frameLength());
   setFrameDetectionMode(JSON::ProjectModel::instance().frameDetection());
 
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::frameFilterChanged, this, [=] {
+            setFrameFilter(JSON::ProjectModel::instance().frameFilter());
+          });
+
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::frameLengthChanged, this, [=] {
+            setFrameLength(JSON::ProjectModel::instance().frameLength());
+          });
+
   connect(&JSON::FrameBuilder::instance(),
           &JSON::FrameBuilder::operationModeChanged, this, [=] {
             setOperationMode(JSON::FrameBuilder::instance().operationMode());
@@ -134,6 +532,48 @@ void IO::FrameReader::setupExternalConnections()
           });
 }
 
+/**
+ * @brief Pauses or resumes frame extraction without stopping data capture.
+ *
+ * While paused, incoming data keeps accumulating in the ring buffer (with the
+ * usual overrun accounting), but no frames are extracted, so the dashboard
+ * freezes on the last delivered frame. On resume, the accumulated backlog is
+ * fast-forwarded through the frame extractors in a tight catch-up loop that
+ * runs at memory speed, instead of trickling out at the UI refresh cadence.
+ *
+ * @param paused True to hold frame extraction, false to resume it.
+ */
+void IO::FrameReader::setPaused(const bool paused)
+{
+  // Nothing to do
+  if (m_paused == paused)
+    return;
+
+  // Update the pause flag
+  m_paused = paused;
+
+  // Fast-forward the backlog captured while streaming was held
+  if (!m_paused && m_dataBuffer.size() > 0)
+  {
+    // No frame boundaries, deliver the whole backlog as a single frame
+    if (m_operationMode == SerialStudio::ProjectFile
+        && m_frameDetectionMode == SerialStudio::NoDelimiters)
+      Q_EMIT framesReady({m_dataBuffer.read(m_dataBuffer.size())},
+                         m_captureTimestamp.load(std::memory_order_relaxed));
+
+    // Drain the ring until a pass stops making progress
+    else
+    {
+      qsizetype previousFill;
+      do
+      {
+        previousFill = m_dataBuffer.size();
+        readFrames();
+      } while (m_dataBuffer.size() > 0 && m_dataBuffer.size() < previousFill);
+    }
+  }
+}
+
 /**
  * @brief Processes incoming data and detects frames based on the current
  * settings.
@@ -143,6 +583,11 @@ void IO::FrameReader::setupExternalConnections()
  * processed data from the buffer and truncates it if it exceeds the maximum
  * buffer size.
  *
+ * While a direct producer owns the ring (see setDirectProducerActive()),
+ * this slot refuses to append or resize: the data is dropped and accounted
+ * instead, so a stale queued event can never turn the SPSC ring into a
+ * two-producer ring mid-session.
+ *
  * @param data The incoming data to process.
  */
 void IO::FrameReader::processData(const QByteArray &data)
@@ -151,14 +596,41 @@ void IO::FrameReader::processData(const QByteArray &data)
   if (!IO::Manager::instance().isConnected())
     return;
 
-  // Add data to circular buffer
-  m_dataBuffer.append(data);
+  // The driver thread owns the ring's producer side, appending or resizing
+  // from this thread would violate the single-producer invariant; with the
+  // direct path armed before the device opens this should never fire, so
+  // account the loss instead of risking the ring
+  if (m_directProducer.load(std::memory_order_acquire))
+  {
+    m_queuedPathDrops.add(data.size());
+    return;
+  }
+
+  // Attribute heap allocations to the extraction stage while diagnosing
+  Misc::AllocationTracker::Scope allocScope(
+      Misc::AllocationTracker::Extraction);
+
+  // Best-effort capture stamp for the queued fallback path; the direct
+  // ingest route records it at the driver boundary instead
+  m_captureTimestamp.store(QDateTime::currentMSecsSinceEpoch(),
+                           std::memory_order_relaxed);
+
+  // Add data to the SPSC ring buffer, excess bytes are dropped & accounted
+  const bool stored = m_dataBuffer.append(data);
   Q_EMIT dataReceived(data);
 
+  // Adjust the ring capacity to the observed fill level
+  adaptBufferCapacity(!stored);
+
+  // Paused; keep capturing into the ring, catch up on resume
+  if (m_paused)
+    return;
+
   // Read frames in no-delimiter mode directly
   if (m_operationMode == SerialStudio::ProjectFile
       && m_frameDetectionMode == SerialStudio::NoDelimiters)
-    Q_EMIT frameReady(m_dataBuffer.read(data.size()));
+    Q_EMIT framesReady({m_dataBuffer.read(m_dataBuffer.size())},
+                       m_captureTimestamp.load(std::memory_order_relaxed));
 
   // Schedule a frame extraction as soon as possible without blocking the thread
   else
@@ -166,6 +638,133 @@ void IO::FrameReader::processData(const QByteArray &data)
                               Qt::QueuedConnection);
 }
 
+/**
+ * @brief Accepts data directly from a driver thread, bypassing the event loop.
+ *
+ * This is the hot-path counterpart of processData(): instead of posting one
+ * queued signal per hardware read (which becomes the bottleneck at multi-Mbaud
+ * rates with small device buffers), the driver thread appends straight into
+ * the lock-free SPSC ring and only wakes the reader thread when no wake-up is
+ * already in flight. The posting rate is therefore bounded by the drain rate,
+ * not by the chunk rate, and bursts coalesce into a single drain pass.
+ *
+ * Thread-safe for exactly one producer thread; excess bytes that do not fit
+ * the ring are dropped and accounted by the buffer itself.
+ *
+ * @param data The incoming data to append to the ring buffer.
+ * @param timestamp Capture time of the chunk at the driver boundary, in
+ *                  milliseconds since the epoch. Frames extracted later carry
+ *                  this stamp so plotted timing reflects the wire instead of
+ *                  the pipeline's queue depths.
+ */
+void IO::FrameReader::ingestData(const QByteArray &data,
+                                 const qint64 timestamp)
+{
+  m_captureTimestamp.store(timestamp, std::memory_order_relaxed);
+  m_dataBuffer.append(data);
+  if (!m_ingestWake.exchange(true, std::memory_order_acq_rel))
+    QMetaObject::invokeMethod(this, &FrameReader::drainIngestBuffer,
+                              Qt::QueuedConnection);
+}
+
+/**
+ * @brief Consumes the data appended by ingestData() since the previous drain.
+ *
+ * Runs on the reader thread. Forwards the raw bytes that arrived since the
+ * last drain through dataReceived() as a single coalesced chunk (located via
+ * the ring's consumed-bytes cursor), then extracts frames exactly like
+ * processData() does.
+ *
+ * Unlike the queued path, the ring capacity is not adapted here: the producer
+ * appends concurrently from the driver thread, and resizing the ring requires
+ * both sides to be idle. Sustained overruns are still accounted through the
+ * buffer's drop counters.
+ */
+void IO::FrameReader::drainIngestBuffer()
+{
+  // Allow the producer to schedule the next wake-up
+  m_ingestWake.store(false, std::memory_order_release);
+
+  // Stop if not connected
+  if (!IO::Manager::instance().isConnected())
+    return;
+
+  // Forward the bytes that arrived since the previous drain as one chunk
+  const qsizetype fill = m_dataBuffer.size();
+  const quint64 consumed = m_dataBuffer.consumedBytes();
+  const quint64 present = consumed + static_cast<quint64>(fill);
+  if (present > m_ingestEmitted)
+  {
+    const auto offset = static_cast<qsizetype>(
+        m_ingestEmitted > consumed ? m_ingestEmitted - consumed : 0);
+    Q_EMIT dataReceived(m_dataBuffer.peekView(fill).mid(offset).toByteArray());
+    m_ingestEmitted = present;
+  }
+
+  // Paused; keep capturing into the ring, catch up on resume
+  if (m_paused)
+    return;
+
+  // Read frames in no-delimiter mode directly (only up to the bytes that
+  // were already forwarded, newer appends wait for the next drain)
+  if (m_operationMode == SerialStudio::ProjectFile
+      && m_frameDetectionMode == SerialStudio::NoDelimiters)
+    Q_EMIT framesReady({m_dataBuffer.read(fill)},
+                       m_captureTimestamp.load(std::memory_order_relaxed));
+
+  // Extract frames from the ring buffer
+  else
+    readFrames();
+}
+
+/**
+ * @brief Adjusts the ring buffer capacity based on the observed fill level.
+ *
+ * Doubles the capacity (up to a fixed ceiling) as soon as an append overruns
+ * the ring or the fill level crosses 75%, so bursts stop dropping data.
+ * Shrinking is hysteresis-guarded: the capacity is only halved after the fill
+ * level stayed below 10% for a sustained number of appends, avoiding
+ * oscillation around the threshold. Capacity changes are reported through
+ * bufferCapacityChanged().
+ *
+ * @param overrun True when the last append dropped data.
+ */
+void IO::FrameReader::adaptBufferCapacity(const bool overrun)
+{
+  static constexpr qsizetype minCapacity = 1024 * 1024;
+  static constexpr qsizetype maxCapacity = 64 * 1024 * 1024;
+  static constexpr int shrinkStreak = 1000;
+
+  const qsizetype fill = m_dataBuffer.size();
+  const qsizetype capacity = m_dataBuffer.capacity();
+
+  // Grow as soon as the producer outruns the consumer
+  if (overrun || fill * 4 >= capacity * 3)
+  {
+    m_lowFillStreak = 0;
+    if (capacity < maxCapacity)
+    {
+      m_dataBuffer.resize(std::min(capacity * 2, maxCapacity));
+      Q_EMIT bufferCapacityChanged(m_dataBuffer.capacity());
+    }
+  }
+
+  // Shrink only after the fill level stayed low for a while
+  else if (capacity > minCapacity && fill * 10 <= capacity)
+  {
+    if (++m_lowFillStreak >= shrinkStreak)
+    {
+      m_lowFillStreak = 0;
+      m_dataBuffer.resize(std::max(capacity / 2, minCapacity));
+      Q_EMIT bufferCapacityChanged(m_dataBuffer.capacity());
+    }
+  }
+
+  // Fill level in the nominal band, reset the shrink streak
+  else
+    m_lowFillStreak = 0;
+}
+
 /**
  * @brief Sets the start sequence used for frame detection.
  *
@@ -202,6 +801,105 @@ void IO::FrameReader::setFinishSequence(const QString &finish)
   }
 }
 
+/**
+ * @brief Sets the frame size used by the fixed-length extractor.
+ *
+ * Updates the number of payload bytes sliced per frame in fixed-length
+ * detection mode. Resets the FrameReader state if the length changes.
+ *
+ * @param length The new frame length in bytes.
+ */
+void IO::FrameReader::setFrameLength(const int length)
+{
+  const qsizetype size = qMax(1, length);
+  if (m_frameLength != size)
+  {
+    m_frameLength = size;
+    reset();
+  }
+}
+
+/**
+ * @brief Compiles the pre-parse frame filter from its textual rules.
+ *
+ * The rules are a comma-separated list of byte prefixes matched against the
+ * raw bytes of every extracted frame, before the frame is queued for the
+ * (much more expensive) parse stage:
+ *
+ * - A plain prefix ("$TLM") keeps only frames that start with it; when any
+ *   keep rule exists, frames matching none of them are dropped.
+ * - A prefix preceded by "!" ("!$HB") drops matching frames outright, which
+ *   takes precedence over the keep rules.
+ * - A "0x" prefix ("0x01AB") is interpreted as hexadecimal bytes, so binary
+ *   frame IDs can be expressed without printable characters.
+ *
+ * An empty rule string disables filtering entirely, which is the default.
+ *
+ * @param rules The filter rules as entered in the project editor.
+ */
+void IO::FrameReader::setFrameFilter(const QString &rules)
+{
+  m_filterRules.clear();
+  m_filterHasAcceptRules = false;
+
+  const auto tokens = rules.split(QLatin1Char(','), Qt::SkipEmptyParts);
+  for (const auto &token : tokens)
+  {
+    // Strip whitespace & the discard marker
+    auto pattern = token.trimmed();
+    const bool discard = pattern.startsWith(QLatin1Char('!'));
+    if (discard)
+      pattern = pattern.mid(1).trimmed();
+
+    // Decode the prefix bytes, hexadecimal or literal
+    QByteArray prefix;
+    if (pattern.startsWith(QStringLiteral("0x"), Qt::CaseInsensitive))
+      prefix = QByteArray::fromHex(pattern.mid(2).toLatin1());
+    else
+      prefix = pattern.toUtf8();
+
+    // Register the compiled rule
+    if (!prefix.isEmpty())
+    {
+      m_filterRules.append({discard, prefix});
+      m_filterHasAcceptRules |= !discard;
+    }
+  }
+}
+
+/**
+ * @brief Evaluates the compiled filter rules against a raw frame.
+ *
+ * Runs on the reader thread inside the frame extraction loop, before the
+ * frame is copied out of the ring buffer, so dropped frames cost one prefix
+ * comparison per rule instead of a heap copy, a cross-thread hop and a full
+ * parse.
+ *
+ * @param frame Zero-copy view over the extracted frame payload.
+ * @return True when the frame should be queued for parsing.
+ */
+bool IO::FrameReader::filterAccepts(const ByteView &frame) const
+{
+  // Fast path, no rules configured
+  if (m_filterRules.isEmpty())
+    return true;
+
+  // Discard rules win over keep rules, first match decides
+  bool kept = false;
+  for (const auto &rule : m_filterRules)
+  {
+    if (frame.startsWith(rule.prefix))
+    {
+      if (rule.discard)
+        return false;
+
+      kept = true;
+    }
+  }
+
+  return kept || !m_filterHasAcceptRules;
+}
+
 /**
  * @brief Sets the operation mode of the FrameReader.
  *
@@ -215,6 +913,7 @@ void IO::FrameReader::setOperationMode(const SerialStudio::OperationMode mode)
   if (m_operationMode != mode)
   {
     m_operationMode = mode;
+    selectFrameExtractor();
     reset();
   }
 }
@@ -235,15 +934,72 @@ void IO::FrameReader::setFrameDetectionMode(
   if (m_frameDetectionMode != mode)
   {
     m_frameDetectionMode = mode;
+    selectFrameExtractor();
     reset();
   }
 }
 
+/**
+ * @brief Resolves the frame extraction strategy for the active mode pair.
+ *
+ * Maps the current operation mode & frame detection mode to one of the
+ * extraction routines once, so readFrames() dispatches through a single
+ * member-function pointer instead of re-evaluating the mode branch chain on
+ * every pass. The end-delimited reader is instantiated per operation mode,
+ * which lets the compiler drop the QuickPlot delimiter-scan branch from the
+ * per-frame loop of the project-file instantiation (and vice versa).
+ *
+ * No-delimiter passthrough keeps a null extractor; that path never reaches
+ * readFrames() because processData() forwards the raw buffer directly.
+ */
+void IO::FrameReader::selectFrameExtractor()
+{
+  // JSON mode, read until default frame start & end sequences are found
+  if (m_operationMode == SerialStudio::DeviceSendsJSON)
+    m_extractFrames = &FrameReader::readStartEndDelimetedFrames;
+
+  // Handle quick plot data
+  else if (m_operationMode == SerialStudio::QuickPlot)
+    m_extractFrames
+        = &FrameReader::readEndDelimetedFrames<SerialStudio::QuickPlot>;
+
+  // Project mode, obtain which frame detection method to use
+  else if (m_operationMode == SerialStudio::ProjectFile)
+  {
+    switch (m_frameDetectionMode)
+    {
+      case SerialStudio::EndDelimiterOnly:
+        m_extractFrames
+            = &FrameReader::readEndDelimetedFrames<SerialStudio::ProjectFile>;
+        break;
+      case SerialStudio::StartDelimiterOnly:
+        m_extractFrames = &FrameReader::readStartDelimitedFrames;
+        break;
+      case SerialStudio::StartAndEndDelimiter:
+        m_extractFrames = &FrameReader::readStartEndDelimetedFrames;
+        break;
+      case SerialStudio::FixedLength:
+        m_extractFrames = &FrameReader::readFixedLengthFrames;
+        break;
+      case SerialStudio::NoDelimiters:
+        m_extractFrames = nullptr;
+        break;
+    }
+  }
+
+  // Unknown mode, disable frame extraction
+  else
+    m_extractFrames = nullptr;
+}
+
 /**
  * @brief IO::FrameReader::readFrames
  */
 void IO::FrameReader::readFrames()
 {
+  // Threshold of consecutive fruitless passes before backing off
+  constexpr int fruitlessThreshold = 8;
+
   // Stop parsing data when a device is disconnected
   if (!IO::Manager::instance().isConnected() && m_dataBuffer.size() > 0)
   {
@@ -251,29 +1007,53 @@ void IO::FrameReader::readFrames()
     return;
   }
 
-  // JSON mode, read until default frame start & end sequences are found
-  if (m_operationMode == SerialStudio::DeviceSendsJSON)
-    readStartEndDelimetedFrames();
-
-  // Project mode, obtain which frame detection method to use
-  else if (m_operationMode == SerialStudio::ProjectFile)
+  // Fruitless-scan governor: when several consecutive passes scanned the
+  // buffer without finding a single frame boundary (the misconfigured
+  // delimiter/checksum support case), rescanning the whole buffer on every
+  // received chunk degenerates into O(n^2) work and burns a core showing
+  // nothing. Back off by only rescanning once the buffer grew by a
+  // meaningful fraction since the last fruitless pass.
+  const qsizetype fillBefore = m_dataBuffer.size();
+  if (m_fruitlessScans >= fruitlessThreshold)
   {
-    // Read using only an end delimiter
-    if (m_frameDetectionMode == SerialStudio::EndDelimiterOnly)
-      readEndDelimetedFrames();
+    const qsizetype growth = fillBefore - m_lastScanFill;
+    if (growth >= 0 && growth < qMax<qsizetype>(4096, m_lastScanFill / 4))
+      return;
+  }
 
-    // Read using only a start delimeter
-    else if (m_frameDetectionMode == SerialStudio::StartDelimiterOnly)
-      readStartDelimitedFrames();
+  // Run the extraction strategy resolved by selectFrameExtractor()
+  if (m_extractFrames)
+    (this->*m_extractFrames)();
 
-    // Read using both a start & end delimiter
-    else if (m_frameDetectionMode == SerialStudio::StartAndEndDelimiter)
-      readStartEndDelimetedFrames();
+  // Track (lack of) progress for the governor; a pass that neither queued a
+  // frame nor consumed any bytes was pure wasted scanning. The first time
+  // the backoff engages, run the stream analysis once so the user gets a
+  // settings proposal instead of a silent, frozen dashboard.
+  if (m_frameQueue.isEmpty() && fillBefore > 0
+      && m_dataBuffer.size() == fillBefore)
+  {
+    m_lastScanFill = fillBefore;
+    if (++m_fruitlessScans == fruitlessThreshold && !m_analysisEmitted)
+    {
+      m_analysisEmitted = true;
+      analyzeStream();
+    }
   }
 
-  // Handle quick plot data
-  else if (m_operationMode == SerialStudio::QuickPlot)
-    readEndDelimetedFrames();
+  else
+  {
+    m_fruitlessScans = 0;
+    m_lastScanFill = 0;
+  }
+
+  // Deliver all extracted frames as a single cross-thread batch, amortizing
+  // the signal/slot round trip over every frame found in this pass
+  if (!m_frameQueue.isEmpty())
+  {
+    Q_EMIT framesReady(m_frameQueue,
+                       m_captureTimestamp.load(std::memory_order_relaxed));
+    m_frameQueue.clear();
+  }
 }
 
 /**
@@ -282,7 +1062,13 @@ void IO::FrameReader::readFrames()
  * Extracts frames from the circular buffer that are terminated by a specified
  * end delimiter. Emits `frameReady` for each valid frame. Handles oversized
  * frames gracefully and stops processing if data is incomplete.
+ *
+ * The routine is instantiated per operation mode: the QuickPlot instantiation
+ * scans for the candidate line terminators, while the project-file one only
+ * looks for the configured finish sequence, so neither carries the other's
+ * branch inside the per-frame loop.
  */
+template<SerialStudio::OperationMode Mode>
 void IO::FrameReader::readEndDelimetedFrames()
 {
   // Cap the number of frames that we can read in a single call
@@ -297,11 +1083,11 @@ void IO::FrameReader::readEndDelimetedFrames()
     QByteArray delimiter;
 
     // Find the earliest finish sequence in the buffer (QuickPlot mode)
-    if (m_operationMode == SerialStudio::QuickPlot)
+    if constexpr (Mode == SerialStudio::QuickPlot)
     {
       for (const QByteArray &d : m_quickPlotEndSequences)
       {
-        int index = m_dataBuffer.findPatternKMP(d);
+        int index = m_dataBuffer.findPattern(d);
         if (index != -1 && (endIndex == -1 || index < endIndex))
         {
           endIndex = index;
@@ -311,19 +1097,19 @@ void IO::FrameReader::readEndDelimetedFrames()
     }
 
     // Find the earliest finish sequence in the buffer (project mode)
-    else if (m_frameDetectionMode == SerialStudio::EndDelimiterOnly)
+    else
     {
       delimiter = m_finishSequence;
-      endIndex = m_dataBuffer.findPatternKMP(delimiter);
+      endIndex = m_dataBuffer.findPattern(delimiter);
     }
 
     // No complete frame found
     if (endIndex == -1)
       break;
 
-    // Extract the frame up to the delimiter
+    // Obtain a zero-copy view over the frame up to the delimiter
     qsizetype frameLength = endIndex;
-    QByteArray frame = m_dataBuffer.peek(frameLength);
+    ByteView frame = m_dataBuffer.peekView(frameLength);
 
     // Parse frame if not empty
     if (!frame.isEmpty())
@@ -333,7 +1119,11 @@ void IO::FrameReader::readEndDelimetedFrames()
       auto result = integrityChecks(frame, delimiter, &chop);
       if (result == ValidationStatus::FrameOk)
       {
-        Q_EMIT frameReady(frame);
+        if (filterAccepts(frame))
+          m_frameQueue.append(frame.toByteArray());
+        else
+          m_filteredFrames.add(1);
+
         qsizetype bytesToRemove = endIndex + chop;
         (void)m_dataBuffer.read(bytesToRemove);
       }
@@ -345,6 +1135,8 @@ void IO::FrameReader::readEndDelimetedFrames()
       // Invalid frame; skip past finish sequence
       else
       {
+        m_checksumErrors.add(1);
+        recordRejectedFrame(frame, endIndex);
         qsizetype bytesToRemove = endIndex + delimiter.size();
         (void)m_dataBuffer.read(bytesToRemove);
       }
@@ -362,6 +1154,69 @@ void IO::FrameReader::readEndDelimetedFrames()
   }
 }
 
+/**
+ * @brief Slices frames of a constant byte length from the buffer.
+ *
+ * Fixed-layout protocols carry no delimiters worth scanning for: the frame
+ * boundary is pure arithmetic on the buffer fill level, so extraction costs
+ * one length comparison per frame instead of a pattern scan. When a start
+ * sequence is configured it acts as the sync pattern: each frame is the
+ * fixed number of payload bytes following it, and the scan for it resolves
+ * at offset zero on an aligned stream, only walking the buffer to resync
+ * after corruption or a mid-stream attach. Without a sync pattern the
+ * stream is sliced blindly from the first received byte.
+ */
+void IO::FrameReader::readFixedLengthFrames()
+{
+  // Cap the number of frames that we can read in a single call
+  int framesRead = 0;
+  constexpr int maxFrames = 100;
+
+  // Consume the buffer until
+  while (framesRead < maxFrames)
+  {
+    // Resynchronize on the sync pattern when one is configured
+    qsizetype offset = 0;
+    if (!m_startSequence.isEmpty())
+    {
+      const qsizetype index = m_dataBuffer.findPattern(m_startSequence);
+
+      // No sync pattern in the buffer; drop everything except a possible
+      // partial match at the very end
+      if (index == -1)
+      {
+        const qsizetype stale
+            = m_dataBuffer.size() - (m_startSequence.size() - 1);
+        if (stale > 0)
+          (void)m_dataBuffer.read(stale);
+
+        break;
+      }
+
+      offset = index + m_startSequence.size();
+    }
+
+    // Not enough buffered data for a whole frame yet
+    if (m_dataBuffer.size() - offset < m_frameLength)
+      break;
+
+    // Slice the frame arithmetically & hand it to the parse stage
+    ByteView frame
+        = m_dataBuffer.peekView(offset + m_frameLength).mid(offset,
+                                                            m_frameLength);
+    if (filterAccepts(frame))
+      m_frameQueue.append(frame.toByteArray());
+    else
+      m_filteredFrames.add(1);
+
+    // Consume the frame (and any skipped garbage ahead of it)
+    (void)m_dataBuffer.read(offset + m_frameLength);
+
+    // Increment number of frames read
+    ++framesRead;
+  }
+}
+
 /**
  * @brief Reads frames delimited by a start sequence from the buffer.
  *
@@ -382,27 +1237,31 @@ void IO::FrameReader::readStartDelimitedFrames()
     int nextStartIndex = -1;
 
     // Find the first start sequence in the buffer (project mode)
-    startIndex = m_dataBuffer.findPatternKMP(m_startSequence);
+    startIndex = m_dataBuffer.findPattern(m_startSequence);
     if (startIndex == -1)
       break;
 
     // Find the next start sequence after the current one
-    nextStartIndex = m_dataBuffer.findPatternKMP(
+    nextStartIndex = m_dataBuffer.findPattern(
         m_startSequence, startIndex + m_startSequence.size());
     if (nextStartIndex == -1 || nextStartIndex == startIndex
         || nextStartIndex < startIndex)
       break;
 
-    // Extract the frame from the buffer
+    // Obtain a zero-copy view over the frame data
     qsizetype frameStart = startIndex + m_startSequence.size();
     qsizetype frameLength = nextStartIndex - frameStart;
-    QByteArray frame = m_dataBuffer.peek(frameStart + frameLength)
-                           .mid(frameStart, frameLength);
+    ByteView frame = m_dataBuffer.peekView(frameStart + frameLength)
+                         .mid(frameStart, frameLength);
 
     // Parse frame if not empty
     if (!frame.isEmpty())
     {
-      Q_EMIT frameReady(frame);
+      if (filterAccepts(frame))
+        m_frameQueue.append(frame.toByteArray());
+      else
+        m_filteredFrames.add(1);
+
       (void)m_dataBuffer.read(frameStart + frameLength);
     }
 
@@ -429,12 +1288,12 @@ void IO::FrameReader::readStartEndDelimetedFrames()
   while (true)
   {
     // Find the first end sequence
-    int finishIndex = m_dataBuffer.findPatternKMP(m_finishSequence);
+    int finishIndex = m_dataBuffer.findPattern(m_finishSequence);
     if (finishIndex == -1)
       break;
 
     // Find the first start sequence and ensure its before the end sequence
-    int startIndex = m_dataBuffer.findPatternKMP(m_startSequence);
+    int startIndex = m_dataBuffer.findPattern(m_startSequence);
     if (startIndex == -1 || startIndex >= finishIndex)
     {
       (void)m_dataBuffer.read(finishIndex + m_finishSequence.size());
@@ -445,9 +1304,9 @@ void IO::FrameReader::readStartEndDelimetedFrames()
     qsizetype frameStart = startIndex + m_startSequence.size();
     qsizetype frameLength = finishIndex - frameStart;
 
-    // Extract the frame between start and finish sequences
-    QByteArray frame = m_dataBuffer.peek(frameStart + frameLength)
-                           .mid(frameStart, frameLength);
+    // Obtain a zero-copy view over the frame between start & finish sequences
+    ByteView frame = m_dataBuffer.peekView(frameStart + frameLength)
+                         .mid(frameStart, frameLength);
 
     // Parse the frame if not empty
     if (!frame.isEmpty())
@@ -457,7 +1316,11 @@ void IO::FrameReader::readStartEndDelimetedFrames()
       auto result = integrityChecks(frame, m_finishSequence, &chop);
       if (result == ValidationStatus::FrameOk)
       {
-        Q_EMIT frameReady(frame);
+        if (filterAccepts(frame))
+          m_frameQueue.append(frame.toByteArray());
+        else
+          m_filteredFrames.add(1);
+
         qsizetype bytesToRemove = finishIndex + chop;
         (void)m_dataBuffer.read(bytesToRemove);
       }
@@ -469,6 +1332,8 @@ void IO::FrameReader::readStartEndDelimetedFrames()
       // Invalid frame; discard up to the end sequence
       else
       {
+        m_checksumErrors.add(1);
+        recordRejectedFrame(frame, finishIndex);
         qsizetype bytesToRemove = finishIndex + m_finishSequence.size();
         (void)m_dataBuffer.read(bytesToRemove);
       }
@@ -491,6 +1356,14 @@ void IO::FrameReader::readStartEndDelimetedFrames()
  * number of bytes to be removed from the buffer and returns the validation
  * status.
  *
+ * The trailer algorithm is resolved once per stream: the first frames probe
+ * the buffer for every known trailer header, and the winning entry of the
+ * dispatch table is cached. From then on each frame performs a single search
+ * for the cached header and an indirect call into the matching CRC routine,
+ * instead of rebuilding & scanning all three candidate headers per frame.
+ * The concatenated header bytes are cached per delimiter, which only changes
+ * when quick-plot streams alternate between end sequences.
+ *
  * @param frame The frame data to validate.
  * @param bytes A pointer to the number of bytes to remove from the buffer.
  * @return The validation status as a `ValidationStatus` enum:
@@ -499,89 +1372,65 @@ void IO::FrameReader::readStartEndDelimetedFrames()
  *         - `ChecksumIncomplete`: Not enough data for validation.
  */
 IO::ValidationStatus
-IO::FrameReader::integrityChecks(const QByteArray &frame,
+IO::FrameReader::integrityChecks(const ByteView &frame,
                                  const QByteArray &delimeter, qsizetype *bytes)
 {
-  // Get finish sequence as byte array
-  auto crc8Header = delimeter + "crc8:";
-  auto crc16Header = delimeter + "crc16:";
-  auto crc32Header = delimeter + "crc32:";
+  // Rebuild the cached trailer headers when the frame delimiter changes
+  if (m_checksumDelimiter != delimeter)
+  {
+    m_checksumDelimiter = delimeter;
+    for (int i = 0; i < ChecksumProbeCount; ++i)
+      m_checksumHeaders[i] = delimeter + ChecksumAlgorithms[i].header;
+  }
 
-  // Temporary buffer to peek at the required length of data
-  QByteArray cursor = m_dataBuffer.peek(m_dataBuffer.size());
+  // Zero-copy view over the unread data in the buffer
+  ByteView cursor = m_dataBuffer.peekView(m_dataBuffer.size());
 
-  // Check CRC-8
-  if (cursor.contains(crc8Header))
+  // Resolve the trailer algorithm on the first frames of the stream
+  if (!m_enableCrc)
   {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc8Header) + crc8Header.length() - 1;
-
-    // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 1)
+    for (int i = 0; i < ChecksumProbeCount; ++i)
     {
-      *bytes += crc8Header.length() + 1;
-      quint8 crc = static_cast<quint8>(cursor.at(offset + 1));
-
-      if (crc8(frame.data(), frame.length()) == crc)
-        return ValidationStatus::FrameOk;
-      else
-        return ValidationStatus::ChecksumError;
+      if (cursor.contains(m_checksumHeaders[i]))
+      {
+        m_enableCrc = true;
+        m_checksumAlgorithm = i;
+        break;
+      }
     }
-  }
 
-  // Check CRC-16
-  else if (cursor.contains(crc16Header))
-  {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc16Header) + crc16Header.length() - 1;
-
-    // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 2)
+    // Buffer does not contain CRC code
+    if (!m_enableCrc)
     {
-      *bytes += crc16Header.length() + 2;
-
-      quint8 a = static_cast<quint8>(cursor.at(offset + 1));
-      quint8 b = static_cast<quint8>(cursor.at(offset + 2));
-      quint16 crc = (a << 8) | b;
-
-      if (crc16(frame.data(), frame.length()) == crc)
-        return ValidationStatus::FrameOk;
-      else
-        return ValidationStatus::ChecksumError;
+      *bytes += delimeter.length();
+      return ValidationStatus::FrameOk;
     }
   }
 
-  // Check CRC-32
-  else if (cursor.contains(crc32Header))
+  // Verify the frame against the resolved algorithm
+  const auto &algorithm = ChecksumAlgorithms[m_checksumAlgorithm];
+  const auto &header = m_checksumHeaders[m_checksumAlgorithm];
+  const qsizetype headerIndex = cursor.indexOf(header);
+  if (headerIndex >= 0)
   {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc32Header) + crc32Header.length() - 1;
+    const qsizetype offset = headerIndex + header.length() - 1;
 
     // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 4)
+    if (cursor.size() >= offset + algorithm.length)
     {
-      *bytes += crc32Header.length() + 4;
+      *bytes += header.length() + algorithm.length;
 
-      quint8 a = static_cast<quint8>(cursor.at(offset + 1));
-      quint8 b = static_cast<quint8>(cursor.at(offset + 2));
-      quint8 c = static_cast<quint8>(cursor.at(offset + 3));
-      quint8 d = static_cast<quint8>(cursor.at(offset + 4));
-      quint32 crc = (a << 24) | (b << 16) | (c << 8) | d;
+      quint32 crc = 0;
+      for (int i = 1; i <= algorithm.length; ++i)
+        crc = (crc << 8) | static_cast<quint8>(cursor.at(offset + i));
 
-      if (crc32(frame.data(), frame.length()) == crc)
+      if (algorithm.function(frame.data(), frame.size()) == crc)
         return ValidationStatus::FrameOk;
       else
         return ValidationStatus::ChecksumError;
     }
   }
 
-  // Buffer does not contain CRC code
-  else if (!m_enableCrc)
-  {
-    *bytes += delimeter.length();
-    return ValidationStatus::FrameOk;
-  }
-
   // Checksum data incomplete
   return ValidationStatus::ChecksumIncomplete;
 }
@@ -21,9 +21,14 @@
 
 #pragma once
 
+#include <atomic>
+
+#include "IO/Telemetry.h"
+
 #include <QTimer>
 #include <QThread>
 #include <QObject>
+#include <QVector>
 #include <QByteArray>
 
 #include "SerialStudio.h"
@@ -52,8 +57,12 @@ class FrameReader : public QObject
   Q_OBJECT
 
 signals:
-  void frameReady(const QByteArray &frame);
+  void framesReady(const QVector<QByteArray> &frames,
+                   const qint64 captureTimestamp);
   void dataReceived(const QByteArray &data);
+  void bufferCapacityChanged(const qsizetype capacity);
+  void streamAnalysisReady(const QString &report);
+  void rejectedFramesReady(const QString &report);
 
 public:
   explicit FrameReader(QObject *parent = nullptr);
@@ -64,36 +73,127 @@ public:
   [[nodiscard]] const QByteArray &startSequence() const;
   [[nodiscard]] const QByteArray &finishSequence() const;
 
+  [[nodiscard]] quint64 bufferOverruns() const;
+  [[nodiscard]] quint64 droppedBytes() const;
+  [[nodiscard]] quint64 checksumErrors() const;
+  [[nodiscard]] quint64 filteredFrames() const;
+  [[nodiscard]] qsizetype bufferFill() const;
+  [[nodiscard]] qsizetype bufferCapacity() const;
+  [[nodiscard]] qsizetype bufferHighWaterMark() const;
+
+  void ingestData(const QByteArray &data, const qint64 timestamp);
+  void setDirectProducerActive(const bool active);
+
 public slots:
   void reset();
+  void analyzeStream();
+  void dumpRejectedFrames();
   void setupExternalConnections();
+  void setPaused(const bool paused);
   void processData(const QByteArray &data);
   void setStartSequence(const QString &start);
   void setFinishSequence(const QString &finish);
+  void setFrameFilter(const QString &rules);
+  void setFrameLength(const int length);
   void setOperationMode(const SerialStudio::OperationMode mode);
   void setFrameDetectionMode(const SerialStudio::FrameDetection mode);
 
 private slots:
   void readFrames();
+  void drainIngestBuffer();
 
 private:
+  void adaptBufferCapacity(const bool overrun);
+  [[nodiscard]] bool filterAccepts(const ByteView &frame) const;
+  void recordRejectedFrame(const ByteView &frame,
+                           const qsizetype contextOffset);
+  void selectFrameExtractor();
+  template<SerialStudio::OperationMode Mode>
   void readEndDelimetedFrames();
+  void readFixedLengthFrames();
   void readStartDelimitedFrames();
   void readStartEndDelimetedFrames();
-  ValidationStatus integrityChecks(const QByteArray &frame,
+  ValidationStatus integrityChecks(const ByteView &frame,
                                    const QByteArray &delimeter,
                                    qsizetype *bytes);
 
 private:
+  typedef void (FrameReader::*FrameExtractor)();
+
+  /**
+   * @brief One entry of the rejected-frame post-mortem ring.
+   *
+   * Holds the payload that failed validation plus the raw bytes that
+   * followed it in the buffer (delimiter, checksum trailer, start of the
+   * next frame), so intermittent corruption can be inspected after the
+   * fact without a wire sniffer.
+   */
+  struct RejectedFrame
+  {
+    qint64 timestamp;
+    QByteArray frame;
+    QByteArray context;
+  };
+
+  static constexpr int RejectRingSize = 16;
+  static constexpr qsizetype RejectFrameLimit = 256;
+  static constexpr qsizetype RejectContextBytes = 48;
+
+  // Number of checksum trailer algorithms probed for, see the algorithm
+  // table in FrameReader.cpp
+  static constexpr int ChecksumProbeCount = 3;
+
+  /**
+   * @brief One compiled pre-parse filter rule, see setFrameFilter().
+   *
+   * Matches a raw byte prefix against extracted frames before they are
+   * queued for parsing, so uninteresting traffic (heartbeats, other nodes'
+   * IDs) never pays the parse cost.
+   */
+  struct FilterRule
+  {
+    bool discard;
+    QByteArray prefix;
+  };
+
+  bool m_paused;
   bool m_enableCrc;
+  bool m_filterHasAcceptRules;
+  int m_checksumAlgorithm;
+  int m_lowFillStreak;
+
+  // Fruitless-scan governor state, see readFrames()
+  int m_fruitlessScans;
+  bool m_analysisEmitted;
+  qsizetype m_lastScanFill;
+
+  // Frame size used by the fixed-length extractor, in bytes
+  qsizetype m_frameLength;
+
+  quint64 m_ingestEmitted;
+  std::atomic<bool> m_ingestWake;
+  std::atomic<bool> m_directProducer;
+  std::atomic<qint64> m_captureTimestamp;
 
   SerialStudio::OperationMode m_operationMode;
   SerialStudio::FrameDetection m_frameDetectionMode;
+  FrameExtractor m_extractFrames;
+  TelemetryCounter m_checksumErrors;
+  TelemetryCounter m_filteredFrames;
+  TelemetryCounter m_queuedPathDrops;
+
+  SPSCCircularBuffer<QByteArray, char> m_dataBuffer;
 
-  CircularBuffer<QByteArray, char> m_dataBuffer;
+  int m_rejectHead;
+  int m_rejectCount;
+  RejectedFrame m_rejectRing[RejectRingSize];
 
   QByteArray m_startSequence;
   QByteArray m_finishSequence;
+  QByteArray m_checksumDelimiter;
+  QByteArray m_checksumHeaders[ChecksumProbeCount];
+  QVector<QByteArray> m_frameQueue;
+  QVector<FilterRule> m_filterRules;
   QList<QByteArray> m_quickPlotEndSequences;
 };
 } // namespace IO
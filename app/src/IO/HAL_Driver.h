@@ -21,9 +21,17 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <QObject>
+#include <QDateTime>
 #include <QIODevice>
 
+#include "IO/Telemetry.h"
+#include "IO/FrameReader.h"
+#include "IO/CaptureRecorder.h"
+#include "Misc/TimerEvents.h"
+
 namespace IO
 {
 /**
@@ -35,17 +43,43 @@ namespace IO
  * protocol-specific functionality.
  *
  * Signals are available for configuration changes, data transmission, and data
- * reception.
+ * reception. While a direct ingest target is installed, received data skips
+ * the signal path and is handed straight to the frame reader's ring buffer;
+ * the signals remain reserved for low-rate control and configuration events.
  */
 class HAL_Driver : public QObject
 {
+  // clang-format off
   Q_OBJECT
+  Q_PROPERTY(double rxByteRate
+             READ rxByteRate
+             NOTIFY ratesChanged)
+  Q_PROPERTY(double rxChunkRate
+             READ rxChunkRate
+             NOTIFY ratesChanged)
+  // clang-format on
 
 signals:
+  void ratesChanged();
   void configurationChanged();
   void dataSent(const QByteArray &data);
   void dataReceived(const QByteArray &data);
 
+protected:
+  /**
+   * @brief Publishes the smoothed receive rates once per second while the
+   *        device is open, the estimators themselves are updated inline on
+   *        the receive path without any signal traffic.
+   */
+  HAL_Driver()
+  {
+    connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz,
+            this, [this] {
+              if (isOpen())
+                Q_EMIT ratesChanged();
+            });
+  }
+
 public:
   /**
    * @brief Close the device connection.
@@ -59,12 +93,79 @@ public:
   [[nodiscard]] virtual quint64 write(const QByteArray &data) = 0;
   [[nodiscard]] virtual bool open(const QIODevice::OpenMode mode) = 0;
 
+  /**
+   * @brief Installs (or removes) the direct data handoff target.
+   *
+   * When @a reader is set, processData() appends received bytes straight into
+   * the reader's lock-free ring buffer instead of posting them through the
+   * event loop, which keeps the posting rate bounded at multi-Mbaud burst
+   * rates. Pass @c nullptr to fall back to the queued dataReceived() path.
+   *
+   * The ring buffer supports a single producer, so all processData() calls
+   * must come from one thread while a target is installed (true for every
+   * driver, each delivers data from the thread its device lives in).
+   */
+  void setDirectIngest(FrameReader *reader)
+  {
+    m_directIngest.store(reader, std::memory_order_release);
+  }
+
+  /**
+   * @brief Returns the smoothed receive rate in bytes per second.
+   */
+  [[nodiscard]] double rxByteRate() const { return m_rxByteRate.rate(); }
+
+  /**
+   * @brief Returns the smoothed delivery rate in chunks per second.
+   *
+   * A chunk is one unit of data as the device hands it over — a datagram, a
+   * BLE notification batch or a serial read —  which for message-oriented
+   * transports equals the wire frame rate.
+   */
+  [[nodiscard]] double rxChunkRate() const { return m_rxChunkRate.rate(); }
+
+  /**
+   * @brief Clears the receive-rate estimators, called by the I/O manager
+   *        when a connection opens or closes so the displayed rates never
+   *        carry over between sessions.
+   */
+  void resetRateEstimators()
+  {
+    m_rxByteRate.reset();
+    m_rxChunkRate.reset();
+    Q_EMIT ratesChanged();
+  }
+
 protected:
   void processData(const QByteArray &data)
   {
+    // Stamp the chunk at the driver boundary, before any queuing: this is
+    // the closest point to the wire the framework exposes, so downstream
+    // consumers see capture timing instead of pipeline latency
+    const qint64 timestamp = QDateTime::currentMSecsSinceEpoch();
+
+    // Fold the delivery into the receive-rate estimators, plain arithmetic
+    // on the device thread with no signal emission
+    m_rxByteRate.record(quint64(data.size()), timestamp);
+    m_rxChunkRate.record(1, timestamp);
+
+    CaptureRecorder::instance().write(data.constData(), data.size());
+
+    auto *reader = m_directIngest.load(std::memory_order_acquire);
+    if (reader)
+    {
+      reader->ingestData(data, timestamp);
+      return;
+    }
+
     QByteArray dataCopy(data);
     QMetaObject::invokeMethod(
         this, [=] { Q_EMIT dataReceived(dataCopy); }, Qt::QueuedConnection);
   }
+
+private:
+  RateEstimator m_rxByteRate;
+  RateEstimator m_rxChunkRate;
+  std::atomic<FrameReader *> m_directIngest{nullptr};
 };
 } // namespace IO
@@ -0,0 +1,143 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <QApplication>
+
+#include "IO/Manager.h"
+#include "IO/MacroRunner.h"
+
+/**
+ * @brief Constructs the runner and moves it to its dedicated thread.
+ */
+IO::MacroRunner::MacroRunner()
+  : m_cursor(0)
+{
+  // Precise single-shot timer, created before the move so it follows the
+  // runner to the worker thread
+  m_timer = new QTimer(this);
+  m_timer->setSingleShot(true);
+  m_timer->setTimerType(Qt::PreciseTimer);
+  connect(m_timer, &QTimer::timeout, this, &IO::MacroRunner::sendNextStep);
+
+  // Drop the remaining chain when the device disconnects
+  connect(&Manager::instance(), &Manager::connectedChanged, this, [this] {
+    if (!Manager::instance().isConnected())
+      abort();
+  });
+
+  // Run on a dedicated thread so inter-send delays are immune to GUI load
+  m_thread = new QThread();
+  moveToThread(m_thread);
+  m_thread->start();
+
+  // Stop the worker thread before the application quits
+  connect(qApp, &QApplication::aboutToQuit, qApp, [this] {
+    m_thread->quit();
+    if (!m_thread->wait(100))
+      m_thread->terminate();
+  });
+}
+
+/**
+ * Returns a reference to the only instance of the class
+ */
+IO::MacroRunner &IO::MacroRunner::instance()
+{
+  static MacroRunner singleton;
+  return singleton;
+}
+
+/**
+ * @brief Starts executing a macro chain.
+ *
+ * Callable from any thread; the chain is handed to the runner's thread and
+ * replaces whatever macro is currently in flight.
+ *
+ * @param steps Timed payloads to send, in order.
+ */
+void IO::MacroRunner::run(const QVector<Step> &steps)
+{
+  QMetaObject::invokeMethod(
+      this, [this, steps] { startMacro(steps); }, Qt::QueuedConnection);
+}
+
+/**
+ * @brief Cancels the macro currently in flight, if any.
+ */
+void IO::MacroRunner::abort()
+{
+  QMetaObject::invokeMethod(
+      this,
+      [this] {
+        m_timer->stop();
+        m_steps.clear();
+        m_cursor = 0;
+      },
+      Qt::QueuedConnection);
+}
+
+/**
+ * @brief Arms the timer for the first step of a new chain.
+ *
+ * Runs on the runner's thread.
+ *
+ * @param steps Timed payloads to send, in order.
+ */
+void IO::MacroRunner::startMacro(const QVector<Step> &steps)
+{
+  m_cursor = 0;
+  m_steps = steps;
+
+  if (!m_steps.isEmpty())
+    m_timer->start(m_steps.first().delayMs);
+}
+
+/**
+ * @brief Sends the payload of the current step & arms the next delay.
+ *
+ * The timer fires on the runner's thread, which provides the precise
+ * spacing; the write itself is queued onto the I/O manager's thread, since
+ * the device drivers are bound to it.
+ */
+void IO::MacroRunner::sendNextStep()
+{
+  if (m_cursor < 0 || m_cursor >= m_steps.count())
+    return;
+
+  // Hand the precompiled payload to the I/O manager
+  const auto payload = m_steps.at(m_cursor).payload;
+  QMetaObject::invokeMethod(
+      &Manager::instance(),
+      [payload] { Manager::instance().writeData(payload); },
+      Qt::QueuedConnection);
+
+  // Arm the delay towards the next step
+  ++m_cursor;
+  if (m_cursor < m_steps.count())
+    m_timer->start(m_steps.at(m_cursor).delayMs);
+
+  // Chain finished, release the buffers
+  else
+  {
+    m_steps.clear();
+    m_cursor = 0;
+  }
+}
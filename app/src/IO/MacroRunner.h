@@ -0,0 +1,87 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QTimer>
+#include <QObject>
+#include <QThread>
+#include <QVector>
+#include <QByteArray>
+
+namespace IO
+{
+/**
+ * @class IO::MacroRunner
+ * @brief Replays precompiled action payloads with precise inter-send delays.
+ *
+ * Action macros chain several dashboard actions with millisecond spacing
+ * (see JSON::Action::macroSteps()). A GUI timer is the wrong clock for that
+ * job: timer delivery on the main thread is delayed by whatever rendering
+ * or model update happens to be in flight, so inter-send gaps drift by tens
+ * of milliseconds under load. The runner therefore lives on its own thread
+ * with a Qt::PreciseTimer, and only the final write hop is queued onto the
+ * I/O manager's thread — the thread the device drivers are bound to.
+ *
+ * Payloads are the ready-to-send buffers compiled at project load, so a
+ * running macro performs no string conversions at all. Unlike the
+ * command/response driven IO::CommandSequencer, the runner is purely
+ * time-driven and never inspects received data.
+ */
+class MacroRunner : public QObject
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief One timed send of a macro chain.
+   */
+  struct Step
+  {
+    QByteArray payload;
+    int delayMs;
+  };
+
+  static MacroRunner &instance();
+
+  void run(const QVector<Step> &steps);
+  void abort();
+
+private:
+  explicit MacroRunner();
+  MacroRunner(MacroRunner &&) = delete;
+  MacroRunner(const MacroRunner &) = delete;
+  MacroRunner &operator=(MacroRunner &&) = delete;
+  MacroRunner &operator=(const MacroRunner &) = delete;
+
+private slots:
+  void sendNextStep();
+
+private:
+  void startMacro(const QVector<Step> &steps);
+
+private:
+  int m_cursor;
+  QTimer *m_timer;
+  QThread *m_thread;
+  QVector<Step> m_steps;
+};
+} // namespace IO
@@ -20,11 +20,17 @@
  */
 
 #include "IO/Manager.h"
+#include "IO/CaptureRecorder.h"
 #include "IO/Drivers/UART.h"
 #include "IO/Drivers/Network.h"
 #include "IO/Drivers/BluetoothLE.h"
+#include "IO/Drivers/FileReplay.h"
 
 #include "Misc/Translator.h"
+#include "Misc/TimerEvents.h"
+#include "Misc/Settings.h"
+#include "Misc/Utilities.h"
+#include "Misc/ThreadAffinity.h"
 
 #include <QApplication>
 
@@ -66,13 +72,36 @@ static QString ADD_ESCAPE_SEQUENCES(const QString &str)
 IO::Manager::Manager()
   : m_paused(false)
   , m_writeEnabled(true)
+  , m_reconnecting(false)
+  , m_autoReconnect(true)
+  , m_dataRate(0)
+  , m_frameRate(0)
+  , m_sampledRxBytes(0)
+  , m_sampledRxFrames(0)
   , m_driver(nullptr)
+  , m_bulkPumpScheduled(false)
+  , m_nextSourceId(1)
+  , m_reconnectDelay(ReconnectInitialMs)
+  , m_rxBytesAtConnect(0)
   , m_startSequence(QStringLiteral("/*"))
   , m_finishSequence(QStringLiteral("*/"))
 {
   // Listen for keyboard events for pausing/unpausing streaming
   qApp->installEventFilter(this);
 
+  // Restore the user's auto-reconnect preference
+  m_autoReconnect = Misc::Settings::instance()
+                        .value(QStringLiteral("io/autoReconnect"), true)
+                        .toBool();
+
+  // Drive the reconnect retry cycle with a single-shot backoff timer
+  m_reconnectTimer.setSingleShot(true);
+  connect(&m_reconnectTimer, &QTimer::timeout, this,
+          &IO::Manager::attemptReconnect);
+
+  // Start the shared timeline used to align multi-source frame streams
+  m_sharedClock.start();
+
   // Move the frame parser worker to its dedicated thread
   m_frameReader.moveToThread(&m_workerThread);
 
@@ -90,10 +119,40 @@ IO::Manager::Manager()
     m_workerThread.quit();
     if (!m_workerThread.wait(100))
       m_workerThread.terminate();
+
+    while (!m_sources.isEmpty())
+      removeSource(m_sources.first().id);
   });
 
-  // Start the worker thread
+  // Report buffer capacity adaptations performed by the frame reader
+  connect(&m_frameReader, &IO::FrameReader::bufferCapacityChanged, this,
+          &IO::Manager::maxBufferSizeChanged, Qt::QueuedConnection);
+
+  // Surface the frame reader's stream analysis when no frames are detected,
+  // so a misconfigured delimiter/checksum produces a settings proposal
+  // instead of a silent, frozen dashboard
+  connect(
+      &m_frameReader, &IO::FrameReader::streamAnalysisReady, this,
+      [](const QString &report) {
+        Misc::Utilities::showMessageBox(tr("No frames detected"), report,
+                                        QMessageBox::Warning,
+                                        tr("Frame Detection"));
+      },
+      Qt::QueuedConnection);
+
+  // Publish the rejected-frame post-mortem dumps requested from the
+  // diagnostics page
+  connect(
+      &m_frameReader, &IO::FrameReader::rejectedFramesReady, this,
+      [this](const QString &report) {
+        m_rejectedFrames = report;
+        Q_EMIT rejectedFramesChanged();
+      },
+      Qt::QueuedConnection);
+
+  // Start the worker thread & pin it when an affinity is configured
   m_workerThread.start(QThread::HighestPriority);
+  Misc::ThreadAffinity::apply(&m_workerThread, QStringLiteral("io"));
 
   // Set default data interface to serial port
   setBusType(SerialStudio::BusType::UART);
@@ -199,6 +258,245 @@ IO::HAL_Driver *IO::Manager::driver()
   return m_driver;
 }
 
+/**
+ * @brief Retrieves the pool of receive blocks shared by the HAL drivers.
+ *
+ * Drivers acquire fixed-size blocks from this pool for every read instead of
+ * allocating a fresh QByteArray, and release them back once the data has been
+ * handed to the frame reader. The pool exposes hit/miss counters so the
+ * recycling effectiveness can be inspected at runtime.
+ *
+ * @return A reference to the shared receive buffer pool.
+ */
+IO::BufferPool &IO::Manager::receiveBufferPool()
+{
+  return m_receivePool;
+}
+
+/**
+ * @brief Retrieves the frame reader of the primary data stream.
+ *
+ * The reader lives on the manager's worker thread; callers that hook its
+ * signals with a direct connection run on that thread and must confine
+ * themselves to thread-safe state (see IO::ControlLoop).
+ *
+ * @return A reference to the primary frame reader.
+ */
+IO::FrameReader &IO::Manager::frameReader()
+{
+  return m_frameReader;
+}
+
+/**
+ * @brief Returns the number of bytes dropped due to receive buffer overruns.
+ *
+ * Together with bufferOverruns() and bufferHighWaterMark(), this surfaces
+ * backpressure in the ingest pipeline so missing frames can be diagnosed at
+ * runtime instead of in post-analysis.
+ */
+quint64 IO::Manager::droppedBytes() const
+{
+  return m_frameReader.droppedBytes();
+}
+
+/**
+ * @brief Returns the number of receive buffer overrun events.
+ */
+quint64 IO::Manager::bufferOverruns() const
+{
+  return m_frameReader.bufferOverruns();
+}
+
+/**
+ * @brief Returns the highest receive buffer fill level observed so far.
+ */
+qsizetype IO::Manager::bufferHighWaterMark() const
+{
+  return m_frameReader.bufferHighWaterMark();
+}
+
+/**
+ * @brief Returns the ingest data rate in bytes per second.
+ *
+ * Sampled once per second from the lock-free byte counter, so operators can
+ * spot a degrading station while it happens instead of finding gaps in the
+ * CSV afterwards.
+ */
+double IO::Manager::dataRate() const
+{
+  return m_dataRate;
+}
+
+/**
+ * @brief Returns the frame extraction rate in frames per second.
+ */
+double IO::Manager::frameRate() const
+{
+  return m_frameRate;
+}
+
+/**
+ * @brief Returns the number of frames rejected by checksum validation,
+ *        aggregated over the primary reader and every auxiliary source.
+ */
+quint64 IO::Manager::checksumErrors() const
+{
+  quint64 errors = m_frameReader.checksumErrors();
+  for (const auto &source : m_sources)
+    errors += source.reader->checksumErrors();
+
+  return errors;
+}
+
+/**
+ * @brief Returns the number of frames dropped by the pre-parse filter,
+ *        aggregated over the primary reader and every auxiliary source.
+ */
+quint64 IO::Manager::filteredFrames() const
+{
+  quint64 frames = m_frameReader.filteredFrames();
+  for (const auto &source : m_sources)
+    frames += source.reader->filteredFrames();
+
+  return frames;
+}
+
+/**
+ * @brief Returns the receive buffer fill level as a percentage (0-100).
+ */
+double IO::Manager::bufferUtilization() const
+{
+  const qsizetype capacity = m_frameReader.bufferCapacity();
+  if (capacity <= 0)
+    return 0;
+
+  return 100.0 * static_cast<double>(m_frameReader.bufferFill())
+         / static_cast<double>(capacity);
+}
+
+/**
+ * @brief Registers an auxiliary data source for concurrent ingestion.
+ *
+ * Spawns a dedicated FrameReader on its own worker thread and wires it to the
+ * given driver, so several devices that belong to one logical system can be
+ * ingested in parallel instead of serializing on the primary worker. Frames
+ * extracted from the source are merged into the regular framesReceived()
+ * stream and additionally published with the source tag through
+ * taggedFramesReceived().
+ *
+ * Each source also runs a TimeAligner that remaps its frames onto the
+ * manager's shared clock as the batches arrive. The remapped timestamps are
+ * published through alignedFramesReceived(), so consumers that merge several
+ * devices can place samples on one timeline instead of trusting skewed
+ * per-source arrival times.
+ *
+ * The caller retains ownership of the driver instance and must keep it alive
+ * until the source is removed with removeSource().
+ *
+ * @param driver The driver that produces raw data for this source.
+ * @param tag A human-readable identifier attached to frames of this source.
+ * @return A source ID usable with removeSource(), or -1 on error.
+ */
+int IO::Manager::registerSource(HAL_Driver *driver, const QString &tag)
+{
+  // Validate arguments
+  if (!driver)
+    return -1;
+
+  // Construct the source with a dedicated reader & worker thread
+  DataSource source;
+  source.id = m_nextSourceId++;
+  source.tag = tag;
+  source.driver = driver;
+  source.thread = new QThread(this);
+  source.reader = new FrameReader();
+  source.aligner = new TimeAligner();
+  source.reader->moveToThread(source.thread);
+  source.thread->start(QThread::HighPriority);
+  Misc::ThreadAffinity::apply(source.thread, QStringLiteral("io"));
+
+  // Synchronize the reader parameters with the rest of the application
+  QMetaObject::invokeMethod(source.reader,
+                            &FrameReader::setupExternalConnections,
+                            Qt::QueuedConnection);
+
+  // Feed the reader with raw driver data
+  connect(driver, &IO::HAL_Driver::dataReceived, source.reader,
+          &FrameReader::processData, Qt::QueuedConnection);
+
+  // Merge extracted frames into the dashboard stream with a source tag and
+  // remap each batch onto the shared timeline as it arrives
+  const QString sourceTag = source.tag;
+  TimeAligner *aligner = source.aligner;
+  connect(
+      source.reader, &IO::FrameReader::framesReady, this,
+      [this, sourceTag, aligner](const QVector<QByteArray> &frames,
+                                 const qint64 captureTimestamp) {
+        if (!paused())
+        {
+          m_totalRxFrames.add(frames.count());
+          Q_EMIT framesReceived(frames);
+          Q_EMIT timedFramesReceived(captureTimestamp, frames);
+          Q_EMIT taggedFramesReceived(sourceTag, frames);
+
+          const auto timestamps = aligner->alignBatch(
+              frames.count(), m_sharedClock.nsecsElapsed());
+          Q_EMIT alignedFramesReceived(sourceTag, timestamps, frames);
+        }
+      },
+      Qt::QueuedConnection);
+
+  // Register the source & update the UI
+  m_sources.append(source);
+  Q_EMIT sourcesChanged();
+  return source.id;
+}
+
+/**
+ * @brief Returns the tags of all registered auxiliary data sources.
+ */
+QStringList IO::Manager::sourceTags() const
+{
+  QStringList tags;
+  for (const auto &source : m_sources)
+    tags.append(source.tag);
+
+  return tags;
+}
+
+/**
+ * @brief Removes an auxiliary data source registered with registerSource().
+ *
+ * Disconnects the driver from the source's FrameReader, stops the worker
+ * thread and releases the reader. The driver instance itself is left
+ * untouched, closing it remains the caller's responsibility.
+ *
+ * @param sourceId The ID returned by registerSource().
+ */
+void IO::Manager::removeSource(const int sourceId)
+{
+  for (int i = 0; i < m_sources.count(); ++i)
+  {
+    if (m_sources[i].id != sourceId)
+      continue;
+
+    auto source = m_sources.takeAt(i);
+
+    // Stop feeding the reader & tear down its worker thread
+    disconnect(source.driver, nullptr, source.reader, nullptr);
+    disconnect(source.reader);
+    source.reader->deleteLater();
+    delete source.aligner;
+    source.thread->quit();
+    if (!source.thread->wait(100))
+      source.thread->terminate();
+    source.thread->deleteLater();
+
+    Q_EMIT sourcesChanged();
+    break;
+  }
+}
+
 /**
  * @brief Retrieves the current bus type used by the Manager.
  *
@@ -237,6 +535,32 @@ const QString &IO::Manager::finishSequence() const
   return m_finishSequence;
 }
 
+/**
+ * @brief Returns the latest rejected-frame post-mortem report.
+ *
+ * Refreshed asynchronously after each dumpRejectedFrames() request.
+ */
+const QString &IO::Manager::rejectedFrames() const
+{
+  return m_rejectedFrames;
+}
+
+/**
+ * @brief Requests a dump of the frames recently rejected by validation.
+ *
+ * The frame reader retains the last few payloads that failed checksum
+ * verification (with their surrounding raw bytes) in a small ring; this
+ * asks the reader thread to render them and publishes the report through
+ * the rejectedFrames property, so intermittent wire corruption can be
+ * inspected from the diagnostics page without a sniffer attached.
+ */
+void IO::Manager::dumpRejectedFrames()
+{
+  QMetaObject::invokeMethod(&m_frameReader,
+                            &IO::FrameReader::dumpRejectedFrames,
+                            Qt::QueuedConnection);
+}
+
 /**
  * @brief Retrieves a list of available bus types.
  *
@@ -251,6 +575,7 @@ QStringList IO::Manager::availableBuses() const
   list.append(tr("UART/COM"));
   list.append(tr("Network Socket"));
   list.append(tr("Bluetooth LE"));
+  list.append(tr("File Replay"));
 #ifdef USE_QT_COMMERCIAL
   // Comment these ports for v3.0.7 release...I will add support for these
   // IO modules later, right now I need testing data to not drown in issues
@@ -262,11 +587,16 @@ QStringList IO::Manager::availableBuses() const
 }
 
 /**
- * @brief Writes data to the isConnected device.
+ * @brief Writes data to the isConnected device through the control lane.
  *
  * Sends the specified data to the isConnected device through the active driver.
  * Emits the `dataSent` signal upon successful transmission.
  *
+ * Control writes go straight to the driver and therefore overtake any bulk
+ * chunks still queued in writeBulkData()'s lane, so dashboard actions and
+ * console commands reach the wire in bounded time even while a file
+ * transmission is saturating the link.
+ *
  * @param data The data to be written.
  * @return The number of bytes written, or -1 if an error occurs or no device is
  *         isConnected.
@@ -290,6 +620,77 @@ qint64 IO::Manager::writeData(const QByteArray &data)
   return -1;
 }
 
+/**
+ * @brief Writes data to the isConnected device through the bulk lane.
+ *
+ * Bulk chunks are queued and released to the driver one per event loop turn
+ * instead of being written inline. Control writes issued through writeData()
+ * between two chunk releases therefore preempt the remaining bulk backlog at
+ * a chunk boundary: at most one bulk chunk sits ahead of them, which bounds
+ * the added latency of an operator action to a single chunk transmission.
+ *
+ * The `dataSent` signal is emitted from pumpBulkQueue() as each chunk is
+ * handed to the driver, so downstream accounting (e.g. the file transmission
+ * window) sees the same ordering as the wire.
+ *
+ * @param data The chunk to be written.
+ * @return The number of bytes accepted into the lane, or -1 if no device is
+ *         isConnected.
+ */
+qint64 IO::Manager::writeBulkData(const QByteArray &data)
+{
+  if (!isConnected())
+    return -1;
+
+  m_bulkQueue.append(data);
+  if (!m_bulkPumpScheduled)
+  {
+    m_bulkPumpScheduled = true;
+    QMetaObject::invokeMethod(this, &IO::Manager::pumpBulkQueue,
+                              Qt::QueuedConnection);
+  }
+
+  return data.size();
+}
+
+/**
+ * @brief Releases the next queued bulk chunk to the driver.
+ *
+ * Runs once per event loop turn while the bulk lane holds data, which is the
+ * chunk boundary where pending control writes slot in ahead of the backlog.
+ * The queue is dropped when the device disconnects mid-transfer.
+ */
+void IO::Manager::pumpBulkQueue()
+{
+  m_bulkPumpScheduled = false;
+
+  if (!isConnected())
+  {
+    m_bulkQueue.clear();
+    return;
+  }
+
+  if (m_bulkQueue.isEmpty())
+    return;
+
+  const auto data = m_bulkQueue.takeFirst();
+  const auto bytes = driver()->write(data);
+  if (bytes > 0)
+  {
+    auto writtenData = data;
+    writtenData.chop(data.length() - bytes);
+    Q_EMIT dataSent(writtenData);
+  }
+
+  // Keep draining, one chunk per event loop turn
+  if (!m_bulkQueue.isEmpty())
+  {
+    m_bulkPumpScheduled = true;
+    QMetaObject::invokeMethod(this, &IO::Manager::pumpBulkQueue,
+                              Qt::QueuedConnection);
+  }
+}
+
 /**
  * @brief Toggles the connection state of the Manager.
  *
@@ -299,7 +700,13 @@ qint64 IO::Manager::writeData(const QByteArray &data)
 void IO::Manager::toggleConnection()
 {
   if (isConnected())
+  {
+    // Remember that the user ended the session on purpose, so the next
+    // application start does not reconnect automatically
+    Misc::Settings::instance().setValue(QStringLiteral("session/liveConnection"), false);
     disconnectDevice();
+  }
+
   else
     connectDevice();
 }
@@ -321,29 +728,70 @@ void IO::Manager::connectDevice()
     if (m_writeEnabled)
       mode = QIODevice::ReadWrite;
 
+    // A fresh connection supersedes any pending reconnect cycle
+    m_reconnectTimer.stop();
+    m_reconnectDelay = ReconnectInitialMs;
+    if (m_reconnecting)
+    {
+      m_reconnecting = false;
+      Q_EMIT reconnectingChanged();
+    }
+
+    // Prepare the frame reader before the device can produce a single
+    // byte: reset its state, wire the consumer-side connections and arm
+    // the direct ingest path. Installing the direct target only after a
+    // successful open() left a window where early bytes travelled the
+    // queued route and raced the driver thread on the SPSC ring — a
+    // window reopened by every automatic reconnect
+    setPaused(false);
+    QMetaObject::invokeMethod(&m_frameReader, &FrameReader::reset,
+                              Qt::BlockingQueuedConnection);
+
+    connect(driver(), &IO::HAL_Driver::dataReceived, &m_frameReader,
+            &FrameReader::processData, Qt::QueuedConnection);
+    connect(
+        &m_frameReader, &IO::FrameReader::framesReady, this,
+        [this](const QVector<QByteArray> &frames,
+               const qint64 captureTimestamp) {
+          if (!paused())
+          {
+            m_totalRxFrames.add(frames.count());
+            Q_EMIT framesReceived(frames);
+            Q_EMIT timedFramesReceived(captureTimestamp, frames);
+          }
+        },
+        Qt::QueuedConnection);
+    connect(
+        &m_frameReader, &IO::FrameReader::dataReceived, this,
+        [this](const QByteArray &data) {
+          if (!paused())
+          {
+            m_totalRxBytes.add(data.size());
+            Q_EMIT dataReceived(data);
+          }
+        },
+        Qt::QueuedConnection);
+
+    // Hand received data straight to the frame reader's ring buffer; the
+    // queued dataReceived() route above stays connected as a fallback and
+    // for low-rate control events, but is refused write access to the
+    // ring while the driver thread owns the producer side
+    m_frameReader.setDirectProducerActive(true);
+    driver()->setDirectIngest(&m_frameReader);
+
     // Open device & instruct frame reader to obtain data from it
     if (driver()->open(mode))
     {
-      setPaused(false);
-      QMetaObject::invokeMethod(&m_frameReader, &FrameReader::reset,
-                                Qt::BlockingQueuedConnection);
+      // Remember that this session went live, so that a restart (clean or
+      // after a crash) can reconnect to the device right away
+      Misc::Settings::instance().setValue(QStringLiteral("session/liveConnection"), true);
 
-      connect(driver(), &IO::HAL_Driver::dataReceived, &m_frameReader,
-              &FrameReader::processData, Qt::QueuedConnection);
-      connect(
-          &m_frameReader, &IO::FrameReader::frameReady, this,
-          [this](const QByteArray &frame) {
-            if (!paused())
-              Q_EMIT frameReceived(frame);
-          },
-          Qt::QueuedConnection);
-      connect(
-          &m_frameReader, &IO::FrameReader::dataReceived, this,
-          [this](const QByteArray &data) {
-            if (!paused())
-              Q_EMIT dataReceived(data);
-          },
-          Qt::QueuedConnection);
+      // Snapshot the ingest counter so a later drop can tell whether the
+      // link was ever alive (warm reconnect) or never produced data
+      m_rxBytesAtConnect = m_totalRxBytes.value();
+
+      // Start the session's receive-rate estimate from zero
+      driver()->resetRateEstimators();
     }
 
     // Error opening the device
@@ -365,12 +813,28 @@ void IO::Manager::connectDevice()
  */
 void IO::Manager::disconnectDevice()
 {
+  // Cancel any pending reconnect cycle, this is a deliberate teardown
+  m_reconnectTimer.stop();
+  m_reconnectDelay = ReconnectInitialMs;
+  if (m_reconnecting)
+  {
+    m_reconnecting = false;
+    Q_EMIT reconnectingChanged();
+  }
+
   if (driver())
   {
-    // Close driver device
+    // Close driver device & detach the direct ingest path; the queued
+    // fallback regains ring access only once no driver thread can produce
     driver()->close();
+    driver()->setDirectIngest(nullptr);
+    m_frameReader.setDirectProducerActive(false);
+    driver()->resetRateEstimators();
     setPaused(false);
 
+    // Drop any bulk chunks still waiting for the wire
+    m_bulkQueue.clear();
+
     // Disconnect frame reader
     if (m_workerThread.isRunning())
     {
@@ -393,6 +857,134 @@ void IO::Manager::disconnectDevice()
   }
 }
 
+/**
+ * @brief Returns @c true while the manager is waiting to restore a dropped
+ *        connection.
+ */
+bool IO::Manager::reconnecting() const
+{
+  return m_reconnecting;
+}
+
+/**
+ * @brief Returns @c true when dropped connections are restored automatically.
+ */
+bool IO::Manager::autoReconnect() const
+{
+  return m_autoReconnect;
+}
+
+/**
+ * @brief Enables or disables automatic reconnection after link drops.
+ *
+ * The preference is persisted across sessions. Disabling it while a
+ * reconnect cycle is pending performs the full teardown immediately.
+ */
+void IO::Manager::setAutoReconnect(const bool enabled)
+{
+  if (m_autoReconnect == enabled)
+    return;
+
+  m_autoReconnect = enabled;
+  Misc::Settings::instance().setValue(QStringLiteral("io/autoReconnect"),
+                                      enabled);
+  if (!enabled && m_reconnecting)
+    disconnectDevice();
+
+  Q_EMIT autoReconnectChanged();
+}
+
+/**
+ * @brief Handles an unexpected link drop reported by the active driver.
+ *
+ * When auto-reconnect is enabled and the session had already produced data,
+ * the pipeline is suspended warm instead of torn down: the driver device is
+ * closed, but the frame reader keeps its buffers, its detection state and
+ * its signal wiring, and a backoff timer retries the driver open. On resume
+ * the reader continues exactly where the link died, so the data-loss window
+ * is the link-down time itself instead of a full pipeline rebuild.
+ *
+ * @return @c true when a warm reconnect cycle was engaged; @c false when the
+ *         manager performed the regular full teardown instead (the caller
+ *         should then surface the error to the user).
+ */
+bool IO::Manager::handleConnectionDropped()
+{
+  // Auto-reconnect disabled or no driver, preserve the teardown behavior
+  if (!m_autoReconnect || !driver() || !m_workerThread.isRunning())
+  {
+    disconnectDevice();
+    return false;
+  }
+
+  // Already in a reconnect cycle, back off and try again
+  if (m_reconnecting)
+  {
+    m_reconnectDelay = qMin(m_reconnectDelay * 2, ReconnectMaxMs);
+    m_reconnectTimer.start(m_reconnectDelay);
+    return true;
+  }
+
+  // The link never produced data, treat the drop as a configuration error
+  if (m_totalRxBytes.value() <= m_rxBytesAtConnect)
+  {
+    disconnectDevice();
+    return false;
+  }
+
+  // Warm suspend: close the device, keep the frame reader state intact
+  driver()->close();
+  driver()->setDirectIngest(nullptr);
+
+  // Engage the retry cycle
+  m_reconnecting = true;
+  m_reconnectDelay = ReconnectInitialMs;
+  m_reconnectTimer.start(m_reconnectDelay);
+  Q_EMIT reconnectingChanged();
+
+  // Enqueue a UI update request
+  QMetaObject::invokeMethod(
+      this, [=] { Q_EMIT connectedChanged(); }, Qt::QueuedConnection);
+
+  return true;
+}
+
+/**
+ * @brief Retries the driver open for a suspended pipeline.
+ *
+ * On success the direct ingest path is re-attached and streaming resumes
+ * with the preserved frame reader state; on failure the retry is rescheduled
+ * with exponential backoff, capped at @c ReconnectMaxMs.
+ */
+void IO::Manager::attemptReconnect()
+{
+  if (!m_reconnecting || !driver())
+    return;
+
+  // Set open flag
+  QIODevice::OpenMode mode = QIODevice::ReadOnly;
+  if (m_writeEnabled)
+    mode = QIODevice::ReadWrite;
+
+  // Link restored, re-attach the direct ingest path & resume streaming
+  if (driver()->open(mode))
+  {
+    driver()->setDirectIngest(&m_frameReader);
+    m_reconnecting = false;
+    m_reconnectDelay = ReconnectInitialMs;
+    Q_EMIT reconnectingChanged();
+    QMetaObject::invokeMethod(
+        this, [=] { Q_EMIT connectedChanged(); }, Qt::QueuedConnection);
+  }
+
+  // Still down, retry later with a longer delay
+  else
+  {
+    m_reconnectDelay = qMin(m_reconnectDelay * 2, ReconnectMaxMs);
+    m_reconnectTimer.start(m_reconnectDelay);
+  }
+}
+
 /**
  * @brief Sets up external connections for the Manager.
  *
@@ -409,16 +1001,58 @@ void IO::Manager::setupExternalConnections()
   QMetaObject::invokeMethod(&m_frameReader,
                             &FrameReader::setupExternalConnections,
                             Qt::QueuedConnection);
+
+  // Sample the ingest counters once per second
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &IO::Manager::updateStatistics);
+}
+
+/**
+ * @brief Derives the byte & frame rates from the lock-free ingest counters.
+ *
+ * Runs at a 1 Hz cadence; the counters themselves are updated inline where
+ * data and frames are delivered, so the hot path only pays for two relaxed
+ * atomic increments.
+ */
+void IO::Manager::updateStatistics()
+{
+  const quint64 rxBytes = m_totalRxBytes.value();
+  const quint64 rxFrames = m_totalRxFrames.value();
+
+  m_dataRate = static_cast<double>(rxBytes - m_sampledRxBytes);
+  m_frameRate = static_cast<double>(rxFrames - m_sampledRxFrames);
+  m_sampledRxBytes = rxBytes;
+  m_sampledRxFrames = rxFrames;
+
+  Q_EMIT statisticsChanged();
 }
 
 /**
  * @brief Enables or disables real time data streaming to other modules of
  *        the application without disconnecting the device.
+ *
+ * Pausing does not discard incoming data: the frame readers keep capturing
+ * into their ring buffers (with overrun accounting) and fast-forward the
+ * accumulated backlog in a batched catch-up pass when streaming resumes.
  */
 void IO::Manager::setPaused(const bool paused)
 {
   m_paused = paused && isConnected();
   Q_EMIT pausedChanged();
+
+  // Hold/resume frame extraction on the worker threads, resuming triggers a
+  // catch-up pass over the data captured while paused
+  const bool state = m_paused;
+  if (m_workerThread.isRunning())
+    QMetaObject::invokeMethod(
+        &m_frameReader, [=] { m_frameReader.setPaused(state); },
+        Qt::QueuedConnection);
+  for (const auto &source : std::as_const(m_sources))
+  {
+    auto *reader = source.reader;
+    QMetaObject::invokeMethod(
+        reader, [=] { reader->setPaused(state); }, Qt::QueuedConnection);
+  }
 }
 
 /**
@@ -447,10 +1081,14 @@ void IO::Manager::processPayload(const QByteArray &payload)
 {
   if (!payload.isEmpty())
   {
+    CaptureRecorder::instance().write(payload.constData(), payload.size());
+
     QByteArray copy = payload;
     QMetaObject::invokeMethod(
         this,
         [=] {
+          m_totalRxBytes.add(copy.size());
+          m_totalRxFrames.add(1);
           Q_EMIT dataReceived(copy);
           Q_EMIT frameReceived(copy);
         },
@@ -518,6 +1156,7 @@ void IO::Manager::setFinishSequence(const QString &sequence)
  * - `SerialStudio::BusType::Serial`: Serial communication.
  * - `SerialStudio::BusType::Network`: Network-based communication.
  * - `SerialStudio::BusType::BluetoothLE`: Bluetooth Low Energy communication.
+ * - `SerialStudio::BusType::FileReplay`: Raw capture file replay.
  *
  * @param driver The new bus type as a `SerialStudio::BusType` enum.
  */
@@ -551,6 +1190,10 @@ void IO::Manager::setBusType(const SerialStudio::BusType &driver)
     }
   }
 
+  // Replay a raw capture file
+  else if (busType() == SerialStudio::BusType::FileReplay)
+    setDriver(static_cast<HAL_Driver *>(&(Drivers::FileReplay::instance())));
+
   // Invalid driver
   else
     setDriver(nullptr);
@@ -21,13 +21,21 @@
 
 #pragma once
 
+#include <atomic>
+
+#include "IO/Telemetry.h"
+
+#include <QTimer>
 #include <QThread>
 #include <QObject>
 #include <QKeyEvent>
+#include <QElapsedTimer>
 
 #include "SerialStudio.h"
 #include "IO/HAL_Driver.h"
+#include "IO/BufferPool.h"
 #include "IO/FrameReader.h"
+#include "IO/TimeAligner.h"
 
 namespace IO
 {
@@ -58,6 +66,13 @@ class Manager : public QObject
              READ paused
              WRITE setPaused
              NOTIFY pausedChanged)
+  Q_PROPERTY(bool reconnecting
+             READ reconnecting
+             NOTIFY reconnectingChanged)
+  Q_PROPERTY(bool autoReconnect
+             READ autoReconnect
+             WRITE setAutoReconnect
+             NOTIFY autoReconnectChanged)
   Q_PROPERTY(SerialStudio::BusType busType
              READ busType
              WRITE setBusType
@@ -73,14 +88,38 @@ class Manager : public QObject
   Q_PROPERTY(bool configurationOk
              READ configurationOk
              NOTIFY configurationChanged)
+  Q_PROPERTY(double dataRate
+             READ dataRate
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(double frameRate
+             READ frameRate
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(double bufferUtilization
+             READ bufferUtilization
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(quint64 droppedBytes
+             READ droppedBytes
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(quint64 checksumErrors
+             READ checksumErrors
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(quint64 filteredFrames
+             READ filteredFrames
+             NOTIFY statisticsChanged)
   Q_PROPERTY(QStringList availableBuses
              READ availableBuses
              NOTIFY busListChanged)
+  Q_PROPERTY(QString rejectedFrames
+             READ rejectedFrames
+             NOTIFY rejectedFramesChanged)
   // clang-format on
 
 signals:
   void driverChanged();
+  void sourcesChanged();
   void pausedChanged();
+  void reconnectingChanged();
+  void autoReconnectChanged();
   void busTypeChanged();
   void busListChanged();
   void connectedChanged();
@@ -92,6 +131,16 @@ signals:
   void dataSent(const QByteArray &data);
   void dataReceived(const QByteArray &data);
   void frameReceived(const QByteArray &frame);
+  void framesReceived(const QVector<QByteArray> &frames);
+  void timedFramesReceived(const qint64 timestamp,
+                           const QVector<QByteArray> &frames);
+  void taggedFramesReceived(const QString &tag,
+                            const QVector<QByteArray> &frames);
+  void alignedFramesReceived(const QString &tag,
+                             const QVector<qint64> &timestamps,
+                             const QVector<QByteArray> &frames);
+  void statisticsChanged();
+  void rejectedFramesChanged();
 
 private:
   explicit Manager();
@@ -107,45 +156,119 @@ public:
   [[nodiscard]] bool readOnly();
   [[nodiscard]] bool readWrite();
   [[nodiscard]] bool isConnected();
+  [[nodiscard]] bool reconnecting() const;
+  [[nodiscard]] bool autoReconnect() const;
   [[nodiscard]] bool configurationOk();
 
+  bool handleConnectionDropped();
+
   [[nodiscard]] HAL_Driver *driver();
+  [[nodiscard]] BufferPool &receiveBufferPool();
+  [[nodiscard]] FrameReader &frameReader();
+
+  [[nodiscard]] quint64 droppedBytes() const;
+  [[nodiscard]] quint64 bufferOverruns() const;
+  [[nodiscard]] qsizetype bufferHighWaterMark() const;
+
+  [[nodiscard]] double dataRate() const;
+  [[nodiscard]] double frameRate() const;
+  [[nodiscard]] quint64 checksumErrors() const;
+  [[nodiscard]] quint64 filteredFrames() const;
+  [[nodiscard]] double bufferUtilization() const;
+
+  [[nodiscard]] int registerSource(HAL_Driver *driver, const QString &tag);
+  [[nodiscard]] QStringList sourceTags() const;
+  void removeSource(const int sourceId);
   [[nodiscard]] SerialStudio::BusType busType() const;
 
   [[nodiscard]] const QString &startSequence() const;
   [[nodiscard]] const QString &finishSequence() const;
+  [[nodiscard]] const QString &rejectedFrames() const;
 
   [[nodiscard]] QStringList availableBuses() const;
   Q_INVOKABLE qint64 writeData(const QByteArray &data);
+  qint64 writeBulkData(const QByteArray &data);
 
 public slots:
   void connectDevice();
   void toggleConnection();
   void disconnectDevice();
+  void dumpRejectedFrames();
   void setupExternalConnections();
   void setPaused(const bool paused);
   void setWriteEnabled(const bool enabled);
+  void setAutoReconnect(const bool enabled);
   void processPayload(const QByteArray &payload);
   void setStartSequence(const QString &sequence);
   void setFinishSequence(const QString &sequence);
   void setBusType(const SerialStudio::BusType &driver);
 
 private slots:
+  void pumpBulkQueue();
+  void updateStatistics();
+  void attemptReconnect();
   void setDriver(IO::HAL_Driver *driver);
 
 protected:
   bool eventFilter(QObject *obj, QEvent *event) override;
 
+private:
+  static constexpr int ReconnectInitialMs = 250;
+  static constexpr int ReconnectMaxMs = 8000;
+
 private:
   bool m_paused;
   bool m_writeEnabled;
+  bool m_reconnecting;
+  bool m_autoReconnect;
   SerialStudio::BusType m_busType;
 
+  double m_dataRate;
+  double m_frameRate;
+  quint64 m_sampledRxBytes;
+  quint64 m_sampledRxFrames;
+  TelemetryCounter m_totalRxBytes;
+  TelemetryCounter m_totalRxFrames;
+
+  /**
+   * @brief Represents an auxiliary data source running in multi-source mode.
+   *
+   * Each source owns its driver connection, a dedicated FrameReader and the
+   * worker thread the reader runs on, so several devices can be ingested
+   * concurrently across cores. The aligner remaps the source's frames onto
+   * the manager's shared clock so merged plots line up despite per-source
+   * queuing delays and clock skew.
+   */
+  struct DataSource
+  {
+    int id;
+    QString tag;
+    HAL_Driver *driver;
+    QThread *thread;
+    FrameReader *reader;
+    TimeAligner *aligner;
+  };
+
+private:
   HAL_Driver *m_driver;
   QThread m_workerThread;
   FrameReader m_frameReader;
+  BufferPool m_receivePool;
+
+  bool m_bulkPumpScheduled;
+  QList<QByteArray> m_bulkQueue;
+
+  int m_nextSourceId;
+  QVector<DataSource> m_sources;
+  QElapsedTimer m_sharedClock;
+
+  int m_reconnectDelay;
+  quint64 m_rxBytesAtConnect;
+  QTimer m_reconnectTimer;
 
   QString m_startSequence;
   QString m_finishSequence;
+  QString m_rejectedFrames;
+
 };
 } // namespace IO
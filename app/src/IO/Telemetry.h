@@ -0,0 +1,174 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QtGlobal>
+
+namespace IO
+{
+/**
+ * @class IO::TelemetryCounter
+ * @brief Sharded event counter for hot-path instrumentation.
+ *
+ * A single shared atomic counter incremented from several threads (reader
+ * workers, the GUI thread, driver callbacks) serializes those threads on one
+ * cache line. This counter instead keeps a small array of cache-line padded
+ * slots: each thread increments its own slot, so the common case is an
+ * uncontended relaxed add with no false sharing between threads or between
+ * neighbouring counters.
+ *
+ * Reads sum the slots, which makes value() O(ShardCount) and only
+ * approximately ordered with respect to concurrent increments — exactly the
+ * semantics wanted for statistics, and never for synchronization.
+ */
+class TelemetryCounter
+{
+public:
+  static constexpr int ShardCount = 8;
+
+  /**
+   * @brief Adds @a n events to the calling thread's slot.
+   */
+  void add(const quint64 n = 1)
+  {
+    m_shards[shardIndex()].value.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns the total event count across every slot.
+   */
+  [[nodiscard]] quint64 value() const
+  {
+    quint64 total = 0;
+    for (int i = 0; i < ShardCount; ++i)
+      total += m_shards[i].value.load(std::memory_order_relaxed);
+
+    return total;
+  }
+
+  /**
+   * @brief Resets every slot to zero.
+   */
+  void reset()
+  {
+    for (int i = 0; i < ShardCount; ++i)
+      m_shards[i].value.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  /**
+   * @brief Returns the slot assigned to the calling thread.
+   *
+   * Threads are assigned round-robin on first use and keep their slot for
+   * life; with more live threads than slots two threads may share one, which
+   * costs contention but never correctness.
+   */
+  static int shardIndex()
+  {
+    static std::atomic<int> next{0};
+    thread_local const int index
+        = next.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+    return index;
+  }
+
+private:
+  struct alignas(64) Shard
+  {
+    std::atomic<quint64> value{0};
+  };
+
+  Shard m_shards[ShardCount];
+};
+
+/**
+ * @class IO::RateEstimator
+ * @brief Exponentially-weighted rate estimator for hot-path accounting.
+ *
+ * Accumulates event counts on the producer thread and folds them into an
+ * exponentially-weighted moving average once enough wall time has elapsed,
+ * so the common-case cost on the hot path is an addition and a comparison.
+ * The smoothed rate is published through a relaxed atomic, making it safe
+ * to read from the GUI thread while the producer keeps recording.
+ *
+ * The fold weight scales with the length of the accumulated window, so an
+ * irregular delivery cadence (bursty datagrams, BLE notification batches)
+ * converges to the same average as a steady stream. record() is
+ * single-writer and must always be called from the same thread — true for
+ * every driver, data arrives on the thread the device lives in.
+ */
+class RateEstimator
+{
+public:
+  /**
+   * @brief Adds @a units events stamped at @a timestampMs to the estimate.
+   */
+  void record(const quint64 units, const qint64 timestampMs)
+  {
+    if (m_lastMs == 0)
+      m_lastMs = timestampMs;
+
+    m_pending += units;
+
+    // Fold the accumulated window into the average once it spans enough
+    // wall time to yield a meaningful instantaneous rate
+    const qint64 elapsed = timestampMs - m_lastMs;
+    if (elapsed >= WindowMs)
+    {
+      const double instant = double(m_pending) * 1000.0 / double(elapsed);
+      const double alpha = double(elapsed) / double(elapsed + TauMs);
+      const double rate = m_rate.load(std::memory_order_relaxed);
+      m_rate.store(rate + alpha * (instant - rate), std::memory_order_relaxed);
+
+      m_pending = 0;
+      m_lastMs = timestampMs;
+    }
+  }
+
+  /**
+   * @brief Returns the smoothed rate in events per second.
+   */
+  [[nodiscard]] double rate() const
+  {
+    return m_rate.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Clears the estimate and the accumulated window.
+   */
+  void reset()
+  {
+    m_pending = 0;
+    m_lastMs = 0;
+    m_rate.store(0.0, std::memory_order_relaxed);
+  }
+
+private:
+  static constexpr qint64 TauMs = 1000;  // Smoothing time constant
+  static constexpr qint64 WindowMs = 100; // Minimum fold interval
+
+  qint64 m_lastMs = 0;
+  quint64 m_pending = 0;
+  std::atomic<double> m_rate{0.0};
+};
+} // namespace IO
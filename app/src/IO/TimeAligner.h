@@ -0,0 +1,163 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QtGlobal>
+#include <QVector>
+
+namespace IO
+{
+/**
+ * @class IO::TimeAligner
+ * @brief Remaps one device's frame stream onto a shared monotonic timeline.
+ *
+ * When several devices feed one dashboard, the only timestamp available for
+ * most wire formats is the batch arrival time at the reader thread. Arrival
+ * times are a poor timeline: they bundle OS scheduling jitter, driver
+ * buffering and per-source queuing delays on top of the device's own pacing,
+ * so the same physical instant lands at different points of the plot
+ * depending on which serial port it came through.
+ *
+ * This class reconstructs each source's timeline from its frame counter
+ * instead. It estimates the device's inter-frame period with an exponential
+ * moving average, and anchors the reconstructed timeline to the shared clock
+ * with a decaying-minimum offset filter: the batch that experienced the least
+ * transport delay defines the offset, and the bound creeps upward slowly so
+ * genuine clock drift is tracked instead of locking onto a stale minimum.
+ * Remapped timestamps are clamped to be non-decreasing per source.
+ *
+ * Everything is updated incrementally per batch in O(frames); there is no
+ * sliding window to store and no post-process pass, so the aligner can run
+ * inline on live streams.
+ *
+ * The class is not thread-safe; each data source owns its own instance and
+ * feeds it from a single thread.
+ */
+class TimeAligner
+{
+public:
+  TimeAligner() { reset(); }
+
+  /**
+   * @brief Discards all learned state (period, offset and frame count).
+   */
+  void reset()
+  {
+    m_tick = 0;
+    m_periodNs = 0;
+    m_offsetNs = 0;
+    m_lastArrival = 0;
+    m_lastOutput = 0;
+    m_initialized = false;
+  }
+
+  /**
+   * @brief Returns the estimated inter-frame period in nanoseconds.
+   */
+  [[nodiscard]] qint64 periodNs() const
+  {
+    return static_cast<qint64>(m_periodNs);
+  }
+
+  /**
+   * @brief Aligns one batch of frames received at @a arrivalNs.
+   *
+   * Advances the source's frame counter by @a frameCount, refreshes the
+   * period and offset estimates with the new observation and returns one
+   * timestamp per frame on the shared timeline. Frames inside a batch share
+   * a single arrival time, so they are spread by the estimated period and
+   * the last frame of the batch lands on the remapped batch instant.
+   *
+   * @param frameCount Number of frames extracted from this batch.
+   * @param arrivalNs Arrival time of the batch on the shared clock.
+   * @return Shared-timeline timestamps, one per frame, in nanoseconds.
+   */
+  [[nodiscard]] QVector<qint64> alignBatch(const int frameCount,
+                                           const qint64 arrivalNs)
+  {
+    QVector<qint64> timestamps;
+    if (frameCount <= 0)
+      return timestamps;
+
+    // First observation only anchors the timeline, every frame of the batch
+    // maps straight to the arrival instant until a period estimate exists
+    const quint64 batchEndTick = m_tick + static_cast<quint64>(frameCount);
+    if (!m_initialized)
+    {
+      m_initialized = true;
+      m_offsetNs = static_cast<double>(arrivalNs);
+    }
+
+    // Refresh the period estimate with the span of this batch
+    else if (arrivalNs > m_lastArrival)
+    {
+      const auto span = static_cast<double>(arrivalNs - m_lastArrival);
+      const auto frames = static_cast<double>(batchEndTick - m_tick);
+      const double observed = span / frames;
+      if (m_periodNs <= 0)
+        m_periodNs = observed;
+      else
+        m_periodNs += PeriodGain * (observed - m_periodNs);
+    }
+
+    // Offset estimation: keep a decaying minimum of the delay between the
+    // reconstructed device timeline and the shared clock. Batches delayed by
+    // queuing only raise the candidate, so the minimum isolates transport
+    // delay; the slow upward creep lets the bound follow real clock drift.
+    const double reconstructed
+        = static_cast<double>(batchEndTick) * m_periodNs;
+    const double candidate = static_cast<double>(arrivalNs) - reconstructed;
+    if (candidate < m_offsetNs)
+      m_offsetNs = candidate;
+    else
+      m_offsetNs += OffsetCreep * (candidate - m_offsetNs);
+
+    // Remap each frame of the batch onto the shared timeline
+    timestamps.reserve(frameCount);
+    for (int i = 0; i < frameCount; ++i)
+    {
+      const auto tick = static_cast<double>(m_tick + i + 1);
+      auto stamp = static_cast<qint64>(tick * m_periodNs + m_offsetNs);
+      stamp = qMax(stamp, m_lastOutput);
+      timestamps.append(stamp);
+      m_lastOutput = stamp;
+    }
+
+    // Store the batch observation for the next period update
+    m_tick = batchEndTick;
+    m_lastArrival = arrivalNs;
+    return timestamps;
+  }
+
+private:
+  static constexpr double PeriodGain = 0.05;
+  static constexpr double OffsetCreep = 0.001;
+
+private:
+  bool m_initialized;
+  quint64 m_tick;
+  double m_periodNs;
+  double m_offsetNs;
+  qint64 m_lastArrival;
+  qint64 m_lastOutput;
+};
+} // namespace IO
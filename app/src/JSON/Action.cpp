@@ -19,6 +19,9 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <QJsonArray>
+
+#include "IO/Console.h"
 #include "JSON/Action.h"
 
 /**
@@ -123,6 +126,30 @@ const QString &JSON::Action::eolSequence() const
   return m_eolSequence;
 }
 
+/**
+ * @brief Gets the precompiled transmission payload.
+ *
+ * Hex decoding and the end-of-line sequence were already resolved when the
+ * action was read from the project file, so the returned buffer can be
+ * handed to the I/O manager as-is.
+ *
+ * @return A constant reference to the ready-to-send bytes.
+ */
+const QByteArray &JSON::Action::txBin() const
+{
+  return m_txBin;
+}
+
+/**
+ * @brief Gets the macro steps chained to this action.
+ *
+ * @return A constant reference to the step list, empty for plain actions.
+ */
+const QVector<JSON::Action::MacroStep> &JSON::Action::macroSteps() const
+{
+  return m_macroSteps;
+}
+
 /**
  * @brief Serializes the action to a QJsonObject.
  *
@@ -139,6 +166,22 @@ QJsonObject JSON::Action::serialize() const
   object.insert(QStringLiteral("eol"), m_eolSequence);
   object.insert(QStringLiteral("binary"), m_binaryData);
   object.insert(QStringLiteral("title"), m_title.simplified());
+
+  // Only hand-authored projects carry macros, keep plain actions compact
+  if (!m_macroSteps.isEmpty())
+  {
+    QJsonArray macro;
+    for (const auto &step : m_macroSteps)
+    {
+      QJsonObject entry;
+      entry.insert(QStringLiteral("actionId"), step.actionId);
+      entry.insert(QStringLiteral("delay"), step.delayMs);
+      macro.append(entry);
+    }
+
+    object.insert(QStringLiteral("macro"), macro);
+  }
+
   return object;
 }
 
@@ -164,8 +207,38 @@ bool JSON::Action::read(const QJsonObject &object)
     m_eolSequence = SAFE_READ(object, "eol", "").toString();
     m_icon = SAFE_READ(object, "icon", "").toString().simplified();
     m_title = SAFE_READ(object, "title", "").toString().simplified();
+
+    // Read the optional macro chain
+    m_macroSteps.clear();
+    const auto macro = object.value(QStringLiteral("macro")).toArray();
+    for (const auto &entry : macro)
+    {
+      const auto step = entry.toObject();
+      if (step.contains(QStringLiteral("actionId")))
+        m_macroSteps.append(
+            {step.value(QStringLiteral("actionId")).toInt(),
+             qMax(0, step.value(QStringLiteral("delay")).toInt())});
+    }
+
+    // Resolve the transmission payload into ready-to-send bytes
+    compileTxData();
     return true;
   }
 
   return false;
 }
+
+/**
+ * @brief Compiles the transmission data into a ready-to-send byte buffer.
+ *
+ * Performs the hex decoding (binary mode) or UTF-8 conversion plus EOL
+ * append once, so repeated activations — e.g. scripted test sequences
+ * firing dozens of actions per second — skip the string machinery entirely.
+ */
+void JSON::Action::compileTxData()
+{
+  if (m_binaryData)
+    m_txBin = IO::Console::hexToBytes(m_txData);
+  else
+    m_txBin = QString(m_txData + m_eolSequence).toUtf8();
+}
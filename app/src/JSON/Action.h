@@ -22,7 +22,9 @@
 #pragma once
 
 #include <QObject>
+#include <QVector>
 #include <QVariant>
+#include <QByteArray>
 #include <QJsonObject>
 
 namespace JSON
@@ -42,10 +44,29 @@ namespace JSON
  * (txData), and an end-of-line (eol) sequence. It also provides functionality
  * to serialize and deserialize the action to and from a QJsonObject, making it
  * suitable for JSON-based communication or storage.
+ *
+ * The transmission payload is compiled into ready-to-send bytes once, when
+ * the action is read from the project file: hex decoding (binary mode) and
+ * the end-of-line sequence are resolved at that point, so activating an
+ * action costs a single write instead of a per-activation conversion.
+ *
+ * An action may also carry a macro: an ordered list of steps that reference
+ * other actions by their ID, each with an inter-send delay. Activating the
+ * action then replays the whole chain with the precompiled payloads of the
+ * referenced actions (see IO::MacroRunner).
  */
 class Action
 {
 public:
+  /**
+   * @brief One step of an action macro chain.
+   */
+  struct MacroStep
+  {
+    int actionId;
+    int delayMs;
+  };
+
   Action(const int actionId = -1);
 
   [[nodiscard]] int actionId() const;
@@ -56,9 +77,15 @@ public:
   [[nodiscard]] const QString &txData() const;
   [[nodiscard]] const QString &eolSequence() const;
 
+  [[nodiscard]] const QByteArray &txBin() const;
+  [[nodiscard]] const QVector<MacroStep> &macroSteps() const;
+
   [[nodiscard]] QJsonObject serialize() const;
   [[nodiscard]] bool read(const QJsonObject &object);
 
+private:
+  void compileTxData();
+
 private:
   int m_actionId;
   bool m_binaryData;
@@ -68,6 +95,9 @@ private:
   QString m_txData;
   QString m_eolSequence;
 
+  QByteArray m_txBin;
+  QVector<MacroStep> m_macroSteps;
+
   friend class JSON::ProjectModel;
 };
 } // namespace JSON
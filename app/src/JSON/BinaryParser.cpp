@@ -0,0 +1,191 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstring>
+#include <type_traits>
+
+#include <QtEndian>
+#include <QJsonObject>
+
+#include "JSON/BinaryParser.h"
+
+/**
+ * @brief Reads one field of type @p T with the given endianness.
+ *
+ * Instantiated once per (type, endianness) pair; the schema compiler stores a
+ * pointer to the instantiation, so the type switch happens at load time
+ * instead of once per field per frame.
+ */
+template<typename T, bool BigEndian>
+static double extractField(const char *data)
+{
+  using U = std::make_unsigned_t<
+      std::conditional_t<std::is_floating_point_v<T>,
+                         std::conditional_t<sizeof(T) == 4, quint32, quint64>,
+                         T>>;
+
+  U raw;
+  std::memcpy(&raw, data, sizeof(U));
+  if constexpr (sizeof(U) > 1)
+    raw = BigEndian ? qFromBigEndian(raw) : qFromLittleEndian(raw);
+
+  if constexpr (std::is_floating_point_v<T>)
+  {
+    T value;
+    std::memcpy(&value, &raw, sizeof(T));
+    return static_cast<double>(value);
+  }
+
+  else
+    return static_cast<double>(static_cast<T>(raw));
+}
+
+/**
+ * @brief Compiles a binary layout schema into extraction routines.
+ *
+ * Each schema entry selects a type-specialized reader and records its offset
+ * and scale factor. Entries with an unknown type or a negative offset
+ * invalidate the whole schema, since a partially-applied layout would silently
+ * misalign every following field.
+ *
+ * @param schema JSON array with one object per field.
+ * @return @c true when every field compiled successfully.
+ */
+bool JSON::BinaryParser::load(const QJsonArray &schema)
+{
+  clear();
+
+  struct TypeInfo
+  {
+    QLatin1String name;
+    qsizetype size;
+    double (*little)(const char *);
+    double (*big)(const char *);
+  };
+
+  // clang-format off
+  static constexpr TypeInfo types[] = {
+    {QLatin1String("uint8"),  1, &extractField<quint8,  false>, &extractField<quint8,  true>},
+    {QLatin1String("int8"),   1, &extractField<qint8,   false>, &extractField<qint8,   true>},
+    {QLatin1String("uint16"), 2, &extractField<quint16, false>, &extractField<quint16, true>},
+    {QLatin1String("int16"),  2, &extractField<qint16,  false>, &extractField<qint16,  true>},
+    {QLatin1String("uint32"), 4, &extractField<quint32, false>, &extractField<quint32, true>},
+    {QLatin1String("int32"),  4, &extractField<qint32,  false>, &extractField<qint32,  true>},
+    {QLatin1String("uint64"), 8, &extractField<quint64, false>, &extractField<quint64, true>},
+    {QLatin1String("int64"),  8, &extractField<qint64,  false>, &extractField<qint64,  true>},
+    {QLatin1String("float"),  4, &extractField<float,   false>, &extractField<float,   true>},
+    {QLatin1String("double"), 8, &extractField<double,  false>, &extractField<double,  true>},
+  };
+  // clang-format on
+
+  m_fields.reserve(schema.count());
+  for (const auto &entry : schema)
+  {
+    const auto object = entry.toObject();
+    const auto type = object.value(QStringLiteral("type")).toString();
+    const auto offset = object.value(QStringLiteral("offset")).toInteger(-1);
+    const auto scale = object.value(QStringLiteral("scale")).toDouble(1.0);
+    const bool bigEndian = object.value(QStringLiteral("endian")).toString()
+                           == QStringLiteral("big");
+
+    // Resolve the type-specialized reader for the field
+    const TypeInfo *info = nullptr;
+    for (const auto &candidate : types)
+    {
+      if (type == candidate.name)
+      {
+        info = &candidate;
+        break;
+      }
+    }
+
+    // Reject the whole schema when a field cannot be compiled
+    if (!info || offset < 0)
+    {
+      clear();
+      return false;
+    }
+
+    // Register the compiled field & grow the required frame size
+    m_fields.push_back({offset, scale, bigEndian ? info->big : info->little});
+    m_frameSize = qMax(m_frameSize, offset + info->size);
+  }
+
+  return isValid();
+}
+
+/**
+ * @brief Discards the compiled schema.
+ */
+void JSON::BinaryParser::clear()
+{
+  m_frameSize = 0;
+  m_fields.clear();
+}
+
+/**
+ * @brief Returns @c true when a schema is loaded and compiled.
+ */
+bool JSON::BinaryParser::isValid() const
+{
+  return !m_fields.empty();
+}
+
+/**
+ * @brief Returns the number of bytes the layout requires per frame.
+ */
+qsizetype JSON::BinaryParser::frameSize() const
+{
+  return m_frameSize;
+}
+
+/**
+ * @brief Returns @c true when a frame of @p length bytes fits the layout.
+ */
+bool JSON::BinaryParser::matches(const qsizetype length) const
+{
+  return isValid() && length >= m_frameSize;
+}
+
+/**
+ * @brief Extracts the schema fields from a fixed-layout binary frame.
+ *
+ * Runs the compiled extraction routine of every field against the frame
+ * bytes, applies the scale factor and formats the result, all without
+ * touching the JavaScript engine.
+ *
+ * @param frame Raw frame bytes (must satisfy matches(frame.length())).
+ * @return One value per schema field, in schema order.
+ */
+QStringList JSON::BinaryParser::parse(const QByteArray &frame) const
+{
+  QStringList fields;
+  fields.reserve(static_cast<int>(m_fields.size()));
+
+  const char *data = frame.constData();
+  for (const auto &field : m_fields)
+  {
+    const double value = field.extract(data + field.offset) * field.scale;
+    fields.append(QString::number(value, 'g', 10));
+  }
+
+  return fields;
+}
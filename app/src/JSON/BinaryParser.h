@@ -0,0 +1,84 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <QJsonArray>
+#include <QByteArray>
+#include <QStringList>
+
+namespace JSON
+{
+/**
+ * @brief Native fast-path parser for fixed-layout binary frames.
+ *
+ * Projects can declare a binary layout schema (field offsets, types,
+ * endianness and scale factors) instead of — or alongside — a JavaScript
+ * frame parser. The schema is compiled once at project load into an array of
+ * type-specialized extraction routines, so parsing a frame is a sequence of
+ * direct memory loads with no script engine involved.
+ *
+ * Schema format (JSON array, one object per field, in dataset index order):
+ *
+ * @code
+ * "binarySchema": [
+ *   { "offset": 0, "type": "uint16", "endian": "little", "scale": 0.01 },
+ *   { "offset": 2, "type": "int32" },
+ *   { "offset": 6, "type": "float", "endian": "big" }
+ * ]
+ * @endcode
+ *
+ * Supported types: uint8, int8, uint16, int16, uint32, int32, uint64, int64,
+ * float, double. Endianness defaults to little, scale defaults to 1.
+ */
+class BinaryParser
+{
+public:
+  bool load(const QJsonArray &schema);
+  void clear();
+
+  [[nodiscard]] bool isValid() const;
+  [[nodiscard]] qsizetype frameSize() const;
+  [[nodiscard]] bool matches(const qsizetype length) const;
+
+  [[nodiscard]] QStringList parse(const QByteArray &frame) const;
+
+private:
+  /**
+   * @brief One compiled schema field.
+   *
+   * The extractor is a plain function pointer to a template instantiation
+   * specialized on the field type and endianness, so per-field dispatch is a
+   * single indirect call with no branching on type at parse time.
+   */
+  struct Field
+  {
+    qsizetype offset;
+    double scale;
+    double (*extract)(const char *data);
+  };
+
+  qsizetype m_frameSize = 0;
+  std::vector<Field> m_fields;
+};
+} // namespace JSON
@@ -61,10 +61,12 @@ JSON::Dataset::Dataset(const int groupId, const int datasetId)
   , m_index(0)
   , m_max(0)
   , m_min(0)
+  , m_numericValue(0)
   , m_alarm(0)
   , m_ledHigh(1)
   , m_fftSamples(256)
   , m_fftSamplingRate(100)
+  , m_statsWindow(0)
   , m_groupId(groupId)
   , m_xAxisId(-1)
   , m_datasetId(datasetId)
@@ -169,6 +171,43 @@ const QString &JSON::Dataset::value() const
   return m_value;
 }
 
+/**
+ * @return The value/reading of this dataset converted to a double
+ *
+ * The conversion is performed once when the value is assigned (see
+ * setValue()), so widgets and plots that consume numbers avoid re-parsing the
+ * display string on every frame. Returns 0 when the value is not numeric,
+ * matching the behavior of QString::toDouble().
+ */
+double JSON::Dataset::numericValue() const
+{
+  return m_numericValue;
+}
+
+/**
+ * @brief Updates the value/reading of this dataset.
+ *
+ * Stores the display string and caches its numeric interpretation, keeping
+ * both representations in sync for text & plot/gauge consumers.
+ */
+void JSON::Dataset::setValue(const QString &value)
+{
+  m_value = value;
+  m_numericValue = value.toDouble();
+}
+
+/**
+ * @brief Updates the value/reading of this dataset.
+ *
+ * Overload for callers that already parsed the numeric value (e.g. the SIMD
+ * tokenizer in quick plot mode), avoiding a redundant string conversion.
+ */
+void JSON::Dataset::setValue(const QString &value, const double numericValue)
+{
+  m_value = value;
+  m_numericValue = numericValue;
+}
+
 /**
  * @return The units of this dataset
  */
@@ -210,6 +249,16 @@ int JSON::Dataset::fftSamplingRate() const
   return m_fftSamplingRate;
 }
 
+/**
+ * Returns the rolling-window length (in samples) over which derived
+ * statistics (mean, standard deviation, minimum & maximum) are computed for
+ * this dataset, or 0 when no statistics were requested.
+ */
+int JSON::Dataset::statsWindow() const
+{
+  return m_statsWindow;
+}
+
 /**
  * @return The index of the group to which the dataset belongs to, used by
  *         the project model to easily identify which group/dataset to update
@@ -265,6 +314,7 @@ QJsonObject JSON::Dataset::serialize() const
   object.insert(QStringLiteral("units"), m_units.simplified());
   object.insert(QStringLiteral("widget"), m_widget.simplified());
   object.insert(QStringLiteral("fftSamplingRate"), m_fftSamplingRate);
+  object.insert(QStringLiteral("statsWindow"), m_statsWindow);
   object.insert(QStringLiteral("overviewDisplay"), m_displayInOverview);
   return object;
 }
@@ -294,10 +344,12 @@ bool JSON::Dataset::read(const QJsonObject &object)
     m_units = SAFE_READ(object, "units", "").toString().simplified();
     m_widget = SAFE_READ(object, "widget", "").toString().simplified();
     m_fftSamplingRate = SAFE_READ(object, "fftSamplingRate", 100).toInt();
+    m_statsWindow = SAFE_READ(object, "statsWindow", 0).toInt();
     m_displayInOverview = SAFE_READ(object, "overviewDisplay", false).toBool();
     if (m_value.isEmpty())
       m_value = QStringLiteral("--.--");
 
+    m_numericValue = m_value.toDouble();
     return true;
   }
 
@@ -87,12 +87,14 @@ public:
   [[nodiscard]] int xAxisId() const;
   [[nodiscard]] int fftSamples() const;
   [[nodiscard]] int fftSamplingRate() const;
+  [[nodiscard]] int statsWindow() const;
 
   [[nodiscard]] int groupId() const;
   [[nodiscard]] int datasetId() const;
 
   [[nodiscard]] const QString &title() const;
   [[nodiscard]] const QString &value() const;
+  [[nodiscard]] double numericValue() const;
   [[nodiscard]] const QString &units() const;
   [[nodiscard]] const QString &widget() const;
   [[nodiscard]] const QJsonObject &jsonData() const;
@@ -103,6 +105,8 @@ public:
   void setMin(double min) { m_min = min; }
   void setMax(double max) { m_max = max; }
   void setTitle(const QString &title) { m_title = title; }
+  void setValue(const QString &value);
+  void setValue(const QString &value, const double numericValue);
 
 private:
   bool m_fft;
@@ -120,10 +124,12 @@ private:
   int m_index;
   double m_max;
   double m_min;
+  double m_numericValue;
   double m_alarm;
   double m_ledHigh;
   int m_fftSamples;
   int m_fftSamplingRate;
+  int m_statsWindow;
 
   int m_groupId;
   int m_xAxisId;
@@ -0,0 +1,254 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstring>
+
+#include "JSON/Frame.h"
+#include "JSON/DatasetHistory.h"
+
+/**
+ * @brief Constructs the history store and allocates the ring buffers.
+ *
+ * The rings are allocated once here and never reallocated, so the reader
+ * methods can be called from any thread without guarding against the
+ * storage moving underneath them.
+ */
+JSON::DatasetHistory::DatasetHistory()
+  : m_rings(new Ring[HISTORY_MAX_DATASETS])
+  , m_frameCount(0)
+  , m_structureRevision(0)
+{
+  memset(m_stamps, 0, sizeof(m_stamps));
+}
+
+/**
+ * @brief Releases the ring buffers.
+ */
+JSON::DatasetHistory::~DatasetHistory()
+{
+  delete[] m_rings;
+}
+
+/**
+ * Returns a reference to the only instance of the class
+ */
+JSON::DatasetHistory &JSON::DatasetHistory::instance()
+{
+  static DatasetHistory singleton;
+  return singleton;
+}
+
+/**
+ * @brief Installs the history store as the global @c History object.
+ *
+ * Unlike the codec helpers, the store is stateful and shared by every
+ * engine, so ownership stays on the C++ side and each engine only receives
+ * a reference to the singleton.
+ *
+ * @param engine The JavaScript engine to extend.
+ */
+void JSON::DatasetHistory::install(QJSEngine &engine)
+{
+  auto *store = &instance();
+  QJSEngine::setObjectOwnership(store, QJSEngine::CppOwnership);
+  engine.globalObject().setProperty(QStringLiteral("History"),
+                                    engine.newQObject(store));
+}
+
+/**
+ * @brief Returns the maximum number of samples retained per dataset.
+ */
+int JSON::DatasetHistory::depth() const
+{
+  return HISTORY_DEPTH;
+}
+
+/**
+ * @brief Returns the number of samples stored for the given dataset.
+ *
+ * @param index Dataset index, as declared in the project (1-based).
+ * @return The number of available samples, or 0 for unknown datasets.
+ */
+int JSON::DatasetHistory::count(const int index) const
+{
+  if (index < 1 || index > HISTORY_MAX_DATASETS)
+    return 0;
+
+  const auto &ring = m_rings[index - 1];
+  return int(qMin(ring.count, quint32(HISTORY_DEPTH)));
+}
+
+/**
+ * @brief Returns the most recent sample of the given dataset.
+ *
+ * @param index Dataset index, as declared in the project (1-based).
+ * @return The newest stored value, or 0 when no samples are available.
+ */
+double JSON::DatasetHistory::latest(const int index) const
+{
+  if (index < 1 || index > HISTORY_MAX_DATASETS)
+    return 0;
+
+  const auto &ring = m_rings[index - 1];
+  for (int retry = 0; retry < 16; ++retry)
+  {
+    const auto before = ring.sequence.load(std::memory_order_acquire);
+    if (before & 1)
+      continue;
+
+    if (ring.count == 0)
+      return 0;
+
+    const auto slot = (ring.head + HISTORY_DEPTH - 1) % HISTORY_DEPTH;
+    const double value = ring.samples[slot];
+    if (ring.sequence.load(std::memory_order_acquire) == before)
+      return value;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Copies the most recent samples of a dataset into a native buffer.
+ *
+ * The returned QByteArray holds up to @a count doubles ordered oldest to
+ * newest and surfaces in JavaScript as an ArrayBuffer, so scripts wrap it
+ * in a Float64Array view instead of receiving one boxed number per sample.
+ *
+ * The copy is retried while a write lands mid-read; writes are O(1), so in
+ * practice a single retry suffices. Should the retry budget ever run out,
+ * the last copy is returned as a best-effort snapshot.
+ *
+ * @param index Dataset index, as declared in the project (1-based).
+ * @param count Maximum number of samples to return.
+ * @return Buffer with the raw samples, empty for unknown datasets.
+ */
+QByteArray JSON::DatasetHistory::samples(const int index, const int count) const
+{
+  if (index < 1 || index > HISTORY_MAX_DATASETS || count < 1)
+    return QByteArray();
+
+  const auto &ring = m_rings[index - 1];
+
+  QByteArray buffer;
+  for (int retry = 0; retry < 16; ++retry)
+  {
+    const auto before = ring.sequence.load(std::memory_order_acquire);
+    if (before & 1)
+      continue;
+
+    const auto stored = qMin(ring.count, quint32(HISTORY_DEPTH));
+    const auto wanted = qMin(quint32(count), stored);
+    if (wanted == 0)
+      return QByteArray();
+
+    // Copy the newest samples, unrolling the ring into linear order
+    buffer.resize(int(wanted) * int(sizeof(double)));
+    auto *out = reinterpret_cast<double *>(buffer.data());
+    auto slot = (ring.head + HISTORY_DEPTH - wanted) % HISTORY_DEPTH;
+    for (quint32 i = 0; i < wanted; ++i)
+    {
+      out[i] = ring.samples[slot];
+      slot = (slot + 1) % HISTORY_DEPTH;
+    }
+
+    if (ring.sequence.load(std::memory_order_acquire) == before)
+      break;
+  }
+
+  return buffer;
+}
+
+/**
+ * @brief Records the numeric values of a published frame.
+ *
+ * Called by the frame builder right before each frame is handed to the rest
+ * of the application, so by the time a parser script runs, the history ends
+ * at the previous frame — exactly the samples a derivative or debounce
+ * computation needs.
+ *
+ * A change in the frame's structure revision means the dataset indexes may
+ * refer to different channels, so the stored history is discarded. Datasets
+ * repeated across groups (e.g. the quick plot tree) are only sampled once
+ * per frame.
+ *
+ * @param frame The frame that is about to be published.
+ */
+void JSON::DatasetHistory::registerFrame(const JSON::Frame &frame)
+{
+  // Dataset indexes changed meaning, drop the accumulated samples
+  if (frame.structureRevision() != m_structureRevision)
+  {
+    m_structureRevision = frame.structureRevision();
+    for (int i = 0; i < HISTORY_MAX_DATASETS; ++i)
+    {
+      auto &ring = m_rings[i];
+      const auto s = ring.sequence.load(std::memory_order_relaxed);
+      ring.sequence.store(s + 1, std::memory_order_release);
+      ring.head = 0;
+      ring.count = 0;
+      ring.sequence.store(s + 2, std::memory_order_release);
+    }
+  }
+
+  // Append one sample per dataset index
+  ++m_frameCount;
+  for (const auto &group : frame.groups())
+  {
+    for (int d = 0; d < group.datasetCount(); ++d)
+    {
+      const auto &dataset = group.getDataset(d);
+      const auto index = dataset.index();
+      if (index < 1 || index > HISTORY_MAX_DATASETS)
+        continue;
+
+      // Skip datasets already sampled through another group this frame
+      if (m_stamps[index - 1] == m_frameCount)
+        continue;
+
+      m_stamps[index - 1] = m_frameCount;
+      append(index - 1, dataset.numericValue());
+    }
+  }
+}
+
+/**
+ * @brief Appends one sample to a ring buffer.
+ *
+ * The sequence counter is odd for the duration of the write, which tells
+ * concurrent readers to retry their copy.
+ *
+ * @param ring Zero-based ring index.
+ * @param value The sample to store.
+ */
+void JSON::DatasetHistory::append(const int ring, const double value)
+{
+  auto &r = m_rings[ring];
+  const auto s = r.sequence.load(std::memory_order_relaxed);
+  r.sequence.store(s + 1, std::memory_order_release);
+
+  r.samples[r.head] = value;
+  r.head = (r.head + 1) % HISTORY_DEPTH;
+  if (r.count < HISTORY_DEPTH)
+    ++r.count;
+
+  r.sequence.store(s + 2, std::memory_order_release);
+}
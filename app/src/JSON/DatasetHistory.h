@@ -0,0 +1,117 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QObject>
+#include <QJSEngine>
+#include <QByteArray>
+
+/**
+ * @brief Number of samples retained per dataset.
+ */
+#define HISTORY_DEPTH 1024
+
+/**
+ * @brief Highest dataset index tracked by the history store.
+ */
+#define HISTORY_MAX_DATASETS 256
+
+namespace JSON
+{
+class Frame;
+class FrameBuilder;
+
+/**
+ * @class JSON::DatasetHistory
+ * @brief Rolling per-dataset sample store exposed to the parser scripts.
+ *
+ * Frame parser scripts that compute derivatives, debounce noisy channels or
+ * run small filters need access to previous samples, which until now meant
+ * keeping state in script globals and rebuilding JavaScript arrays on every
+ * frame at interpreter cost. This store keeps the last @c HISTORY_DEPTH
+ * numeric values of every dataset in native ring buffers fed by the frame
+ * builder, and is installed as the global @c History property of every
+ * parser engine so scripts read the native buffers directly:
+ *
+ * @code{.js}
+ * var heading = new Float64Array(History.samples(3, 64));
+ * @endcode
+ *
+ * @c samples() returns an ArrayBuffer, so the script-side view costs one
+ * typed-array construction instead of one boxed number per sample.
+ *
+ * Concurrency: the frame builder thread is the only writer; the reader
+ * methods are called from the editor engine and from every worker of the
+ * parser pool. Each ring carries a sequence counter incremented before and
+ * after every write (odd while a write is in flight), and readers retry
+ * their copy until they observe a stable even sequence — no locks are taken
+ * on either side.
+ */
+class DatasetHistory : public QObject
+{
+  Q_OBJECT
+
+  friend class FrameBuilder;
+
+public:
+  static DatasetHistory &instance();
+  static void install(QJSEngine &engine);
+
+  Q_INVOKABLE int depth() const;
+  Q_INVOKABLE int count(const int index) const;
+  Q_INVOKABLE double latest(const int index) const;
+  Q_INVOKABLE QByteArray samples(const int index, const int count) const;
+
+private:
+  explicit DatasetHistory();
+  ~DatasetHistory() override;
+  DatasetHistory(DatasetHistory &&) = delete;
+  DatasetHistory(const DatasetHistory &) = delete;
+  DatasetHistory &operator=(DatasetHistory &&) = delete;
+  DatasetHistory &operator=(const DatasetHistory &) = delete;
+
+  void registerFrame(const JSON::Frame &frame);
+  void append(const int ring, const double value);
+
+private:
+  /**
+   * @brief Fixed-capacity ring buffer holding the samples of one dataset.
+   *
+   * The ring array is allocated once and never moves, so readers on other
+   * threads can index into it without synchronizing against reallocation.
+   */
+  struct Ring
+  {
+    std::atomic<quint32> sequence{0};
+    quint32 head{0};
+    quint32 count{0};
+    double samples[HISTORY_DEPTH];
+  };
+
+  Ring *m_rings;
+  quint64 m_frameCount;
+  quint64 m_structureRevision;
+  quint64 m_stamps[HISTORY_MAX_DATASETS];
+};
+} // namespace JSON
@@ -19,6 +19,12 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <vector>
+
+#include <QMutex>
+#include <QThread>
+#include <QJsonDocument>
+
 #include "JSON/Frame.h"
 #include "SerialStudio.h"
 
@@ -50,7 +56,9 @@ static QVariant SAFE_READ(const QJsonObject &object, const QString &key,
  * Constructor function
  */
 JSON::Frame::Frame()
-  : m_containsCommercialFeatures(false)
+  : m_structureRevision(0)
+  , m_rxTimestamp(0)
+  , m_containsCommercialFeatures(false)
 {
 }
 
@@ -75,8 +83,11 @@ void JSON::Frame::clear()
   m_title = "";
   m_frameEnd = "";
   m_frameStart = "";
+  m_structureRevision = 0;
+  m_rxTimestamp = 0;
   m_containsCommercialFeatures = false;
 
+  m_updatedIndexes.clear();
   m_groups.clear();
   m_actions.clear();
   m_groups.squeeze();
@@ -92,6 +103,51 @@ bool JSON::Frame::isValid() const
   return !title().isEmpty() && groupCount() > 0;
 }
 
+/**
+ * @brief Returns the revision of the group/dataset tree structure.
+ *
+ * The frame builder bumps the revision whenever the tree shape changes (new
+ * project loaded, channel count changed, etc.), so consumers can compare it
+ * against the last frame they processed and skip re-scanning the tree when
+ * only dataset values changed. A revision of 0 means the structure is unknown
+ * and must always be processed in full.
+ */
+quint64 JSON::Frame::structureRevision() const
+{
+  return m_structureRevision;
+}
+
+/**
+ * @brief Returns the capture timestamp of the raw frame in milliseconds since
+ *        the epoch.
+ *
+ * The timestamp is recorded at the driver boundary, when the bytes that make
+ * up the frame were handed over by the hardware, so it reflects wire timing
+ * instead of the queue depths of the processing pipeline. A value of 0 means
+ * no capture timestamp is available (e.g. frames injected by plugins or MQTT)
+ * and consumers should fall back to their own clocks.
+ */
+qint64 JSON::Frame::rxTimestamp() const
+{
+  return m_rxTimestamp;
+}
+
+/**
+ * @brief Returns the indexes of the datasets this frame carries a fresh
+ *        value for.
+ *
+ * Sparse sources (Modbus scans, CAN buses) update different datasets at
+ * different rates, so a frame does not necessarily refresh every dataset:
+ * datasets outside this set keep their previous value and their plot series
+ * do not advance, letting each series run at its native rate. An empty set
+ * means the updated datasets are unknown and every value should be treated
+ * as fresh.
+ */
+const QSet<int> &JSON::Frame::updatedIndexes() const
+{
+  return m_updatedIndexes;
+}
+
 /**
  * @brief Serializes the frame information and its data into a JSON object.
  *
@@ -115,6 +171,161 @@ QJsonObject JSON::Frame::serialize() const
   return object;
 }
 
+/**
+ * @brief Skeleton of a compact-JSON frame with the value slots cut out.
+ *
+ * The static text between value slots is stored once per frame structure;
+ * rendering a frame is then a single pass that stitches the segments back
+ * together with the current dataset values, instead of rebuilding the whole
+ * QJsonDocument tree. Slots appear in dataset document order, which matches
+ * the group/dataset iteration order of the frame.
+ */
+struct JsonTemplate
+{
+  QVector<QByteArray> segments;
+  qsizetype datasetCount = 0;
+  qsizetype payloadHint = 0;
+};
+
+/**
+ * @brief Appends @a value to @a out as a quoted & escaped JSON string.
+ */
+static void appendJsonString(QByteArray &out, const QString &value)
+{
+  out += '"';
+  const auto utf8 = value.toUtf8();
+  for (const char c : utf8)
+  {
+    switch (c)
+    {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\b':
+        out += "\\b";
+        break;
+      case '\f':
+        out += "\\f";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          out += "\\u00";
+          out += QByteArray::number(c, 16).rightJustified(2, '0');
+        }
+
+        else
+          out += c;
+        break;
+    }
+  }
+
+  out += '"';
+}
+
+/**
+ * @brief Serializes the frame into a compact JSON byte buffer.
+ *
+ * The JSON skeleton (keys, titles, widget types, array structure) only
+ * depends on the frame structure, so it is rendered once per structure
+ * revision and cached; subsequent calls stitch the cached segments together
+ * with the current dataset values in a single pass over the datasets. Frames
+ * without a structure revision (e.g. while the project is being edited) fall
+ * back to the full QJsonDocument rendering.
+ */
+QByteArray JSON::Frame::toJson() const
+{
+  static QMutex mutex;
+  static QHash<quint64, JsonTemplate> templates;
+
+  // No stable structure to cache against, render the full document
+  if (m_structureRevision == 0)
+    return QJsonDocument(serialize()).toJson(QJsonDocument::Compact);
+
+  // Count the datasets of this frame (used to validate the cached skeleton)
+  qsizetype datasetCount = 0;
+  for (const auto &group : m_groups)
+    datasetCount += group.datasetCount();
+
+  // Obtain the skeleton for this structure, building it on first use
+  JsonTemplate tpl;
+  {
+    QMutexLocker locker(&mutex);
+    const auto it = templates.constFind(m_structureRevision);
+    if (it != templates.cend() && it->datasetCount == datasetCount)
+      tpl = *it;
+
+    else
+    {
+      // Render the frame once with a marker in place of every value
+      JSON::Frame copy = *this;
+      for (auto &group : copy.m_groups)
+      {
+        for (auto &dataset : group.m_datasets)
+          dataset.setValue(QStringLiteral("@@SSVALUE@@"));
+      }
+
+      const auto document
+          = QJsonDocument(copy.serialize()).toJson(QJsonDocument::Compact);
+
+      // Split the document into the static text between value slots
+      const QByteArray marker = QByteArrayLiteral("\"@@SSVALUE@@\"");
+      qsizetype from = 0;
+      while (true)
+      {
+        const auto start = document.indexOf(marker, from);
+        if (start < 0)
+          break;
+
+        tpl.segments.append(document.mid(from, start - from));
+        from = start + marker.size();
+      }
+
+      tpl.segments.append(document.mid(from));
+      tpl.datasetCount = tpl.segments.count() - 1;
+      tpl.payloadHint = document.size();
+
+      // Cache the skeleton, dropping stale structures as projects change
+      if (templates.count() >= 8)
+        templates.clear();
+
+      templates.insert(m_structureRevision, tpl);
+    }
+  }
+
+  // Skeleton does not match this frame, render the full document
+  if (tpl.datasetCount != datasetCount)
+    return QJsonDocument(serialize()).toJson(QJsonDocument::Compact);
+
+  // Stitch the skeleton together with the current dataset values
+  QByteArray out;
+  out.reserve(tpl.payloadHint + datasetCount * 8);
+  qsizetype slot = 0;
+  out += tpl.segments[slot];
+  for (const auto &group : m_groups)
+  {
+    for (const auto &dataset : group.datasets())
+    {
+      appendJsonString(out, dataset.value().simplified());
+      out += tpl.segments[++slot];
+    }
+  }
+
+  return out;
+}
+
 /**
  * Reads the frame information and all its asociated groups (and datatsets) from
  * the given JSON @c object.
@@ -139,12 +350,63 @@ bool JSON::Frame::read(const QJsonObject &object)
     m_frameEnd = SAFE_READ(object, "frameEnd", "").toString();
     m_frameStart = SAFE_READ(object, "frameStart", "").toString();
 
-    // Generate groups & datasets from data frame
-    for (auto i = 0; i < groups.count(); ++i)
+    // Generate groups & datasets from data frame. Large projects spread the
+    // group/dataset validation over the available cores; every group parses
+    // into its own slot, so the results are appended in document order. Small
+    // trees stay on the serial path, where thread startup would dominate.
+    const int groupCount = static_cast<int>(groups.count());
+    if (groupCount >= ParallelGroupThreshold)
+    {
+      // Parse each group into its own pre-allocated slot
+      QVector<Group> parsed(groupCount);
+      std::vector<char> valid(groupCount, 0);
+      auto parseRange = [&](const int begin, const int end) {
+        for (int i = begin; i < end; ++i)
+        {
+          parsed[i] = Group(i);
+          valid[i] = parsed[i].read(groups.at(i).toObject()) ? 1 : 0;
+        }
+      };
+
+      // Split the groups into one contiguous chunk per core
+      const int threads = qBound(1, QThread::idealThreadCount(), groupCount);
+      const int chunk = (groupCount + threads - 1) / threads;
+      QVector<QThread *> workers;
+      workers.reserve(threads);
+      for (int t = 0; t < threads; ++t)
+      {
+        const int begin = t * chunk;
+        const int end = qMin(groupCount, begin + chunk);
+        workers.append(QThread::create([&, begin, end] {
+          parseRange(begin, end);
+        }));
+        workers.last()->start();
+      }
+
+      // Wait for every chunk to finish & keep the valid groups in order
+      for (auto *worker : workers)
+      {
+        worker->wait();
+        delete worker;
+      }
+
+      m_groups.reserve(groupCount);
+      for (int i = 0; i < groupCount; ++i)
+      {
+        if (valid[i])
+          m_groups.append(parsed.at(i));
+      }
+    }
+
+    // Serial fallback for typical project sizes
+    else
     {
-      Group group(i);
-      if (group.read(groups.at(i).toObject()))
-        m_groups.append(group);
+      for (auto i = 0; i < groupCount; ++i)
+      {
+        Group group(i);
+        if (group.read(groups.at(i).toObject()))
+          m_groups.append(group);
+      }
     }
 
     // Generate actions from data frame
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <QSet>
 #include <QVector>
 #include <QObject>
 #include <QVariant>
@@ -64,11 +65,16 @@ public:
   [[nodiscard]] bool isValid() const;
 
   [[nodiscard]] QJsonObject serialize() const;
+  [[nodiscard]] QByteArray toJson() const;
   [[nodiscard]] bool read(const QJsonObject &object);
 
   [[nodiscard]] int groupCount() const;
   [[nodiscard]] bool containsCommercialFeatures() const;
 
+  [[nodiscard]] quint64 structureRevision() const;
+  [[nodiscard]] qint64 rxTimestamp() const;
+  [[nodiscard]] const QSet<int> &updatedIndexes() const;
+
   [[nodiscard]] const QString &title() const;
   [[nodiscard]] const QString &frameEnd() const;
   [[nodiscard]] const QString &frameStart() const;
@@ -76,6 +82,9 @@ public:
   [[nodiscard]] const QVector<Group> &groups() const;
   [[nodiscard]] const QVector<Action> &actions() const;
 
+private:
+  static constexpr int ParallelGroupThreshold = 8;
+
 private:
   QString m_title;
   QString m_frameEnd;
@@ -84,6 +93,10 @@ private:
   QVector<Group> m_groups;
   QVector<Action> m_actions;
 
+  quint64 m_structureRevision;
+  qint64 m_rxTimestamp;
+  QSet<int> m_updatedIndexes;
+
   bool m_containsCommercialFeatures;
 
   friend class UI::Dashboard;
@@ -1,424 +1,967 @@
-/*
- * Serial Studio - https://serial-studio.github.io/
- *
- * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program. If not, see <https://www.gnu.org/licenses/>.
- *
- * SPDX-License-Identifier: GPL-3.0-or-later
- */
-
-#include <QFileInfo>
-#include <QFileDialog>
-
-#include "IO/Manager.h"
-#include "Misc/Utilities.h"
-
-#include "CSV/Player.h"
-#include "JSON/ProjectModel.h"
-#include "JSON/FrameBuilder.h"
-
-#ifdef USE_QT_COMMERCIAL
-#  include "Licensing/LemonSqueezy.h"
-#endif
-
-/**
- * Initializes the JSON Parser class and connects appropiate SIGNALS/SLOTS
- */
-JSON::FrameBuilder::FrameBuilder()
-  : m_opMode(SerialStudio::ProjectFile)
-  , m_frameParser(nullptr)
-{
-  // Read JSON map location
-  auto path = m_settings.value("json_map_location", "").toString();
-  if (!path.isEmpty())
-    loadJsonMap(path);
-
-  // Obtain operation mode from settings
-  auto m = m_settings.value("operation_mode", SerialStudio::QuickPlot).toInt();
-  setOperationMode(static_cast<SerialStudio::OperationMode>(m));
-
-  // Reload JSON map file when license is activated
-#ifdef USE_QT_COMMERCIAL
-  connect(&Licensing::LemonSqueezy::instance(),
-          &Licensing::LemonSqueezy::activatedChanged, this, [=] {
-            if (!jsonMapFilepath().isEmpty())
-              loadJsonMap(jsonMapFilepath());
-          });
-#endif
-}
-
-/**
- * Returns the only instance of the class
- */
-JSON::FrameBuilder &JSON::FrameBuilder::instance()
-{
-  static FrameBuilder singleton;
-  return singleton;
-}
-
-/**
- * Returns the file path of the loaded JSON map file
- */
-QString JSON::FrameBuilder::jsonMapFilepath() const
-{
-  if (m_jsonMap.isOpen())
-  {
-    auto fileInfo = QFileInfo(m_jsonMap.fileName());
-    return fileInfo.filePath();
-  }
-
-  return "";
-}
-
-/**
- * Returns the file name of the loaded JSON map file
- */
-QString JSON::FrameBuilder::jsonMapFilename() const
-{
-  if (m_jsonMap.isOpen())
-  {
-    auto fileInfo = QFileInfo(m_jsonMap.fileName());
-    return fileInfo.fileName();
-  }
-
-  return "";
-}
-
-/**
- * Returns a pointer to the currently loaded frame parser editor.
- */
-JSON::FrameParser *JSON::FrameBuilder::frameParser() const
-{
-  return m_frameParser;
-}
-
-/**
- * Returns the operation mode
- */
-SerialStudio::OperationMode JSON::FrameBuilder::operationMode() const
-{
-  return m_opMode;
-}
-
-/**
- * Creates a file dialog & lets the user select the JSON file map
- */
-void JSON::FrameBuilder::loadJsonMap()
-{
-  const auto file = QFileDialog::getOpenFileName(
-      nullptr, tr("Select JSON map file"),
-      JSON::ProjectModel::instance().jsonProjectsPath(),
-      tr("JSON files") + QStringLiteral(" (*.json)"));
-
-  if (!file.isEmpty())
-    loadJsonMap(file);
-}
-
-/**
- * Configures the signal/slot connections with the rest of the modules of the
- * application.
- */
-void JSON::FrameBuilder::setupExternalConnections()
-{
-  connect(&IO::Manager::instance(), &IO::Manager::frameReceived, this,
-          &JSON::FrameBuilder::readData, Qt::QueuedConnection);
-}
-
-/**
- * Opens, validates & loads into memory the JSON file in the given @a path.
- */
-void JSON::FrameBuilder::loadJsonMap(const QString &path)
-{
-  // Validate path
-  if (path.isEmpty())
-    return;
-
-  // Close previous file (if open)
-  if (m_jsonMap.isOpen())
-  {
-    m_frame.clear();
-    m_jsonMap.close();
-    Q_EMIT jsonFileMapChanged();
-  }
-
-  // Try to open the file (read only mode)
-  m_jsonMap.setFileName(path);
-  if (m_jsonMap.open(QFile::ReadOnly))
-  {
-    // Read data & validate JSON from file
-    QJsonParseError error;
-    auto data = m_jsonMap.readAll();
-    auto document = QJsonDocument::fromJson(data, &error);
-    if (error.error != QJsonParseError::NoError)
-    {
-      m_frame.clear();
-      m_jsonMap.close();
-      setJsonPathSetting("");
-      Misc::Utilities::showMessageBox(
-          tr("JSON parse error"), error.errorString(), QMessageBox::Critical);
-    }
-
-    // JSON contains no errors, load compacted JSON document & save settings
-    else
-    {
-      // Save settings
-      setJsonPathSetting(path);
-
-      // Load frame from data
-      m_frame.clear();
-      const bool ok = m_frame.read(document.object());
-
-      // Update I/O manager settings
-      if (ok && m_frame.isValid())
-      {
-        if (operationMode() == SerialStudio::ProjectFile)
-        {
-          IO::Manager::instance().setFinishSequence(m_frame.frameEnd());
-          IO::Manager::instance().setStartSequence(m_frame.frameStart());
-        }
-      }
-
-      // Invalid frame data
-      else
-      {
-        m_frame.clear();
-        m_jsonMap.close();
-        setJsonPathSetting("");
-        Misc::Utilities::showMessageBox(tr("Invalid JSON project format"));
-      }
-    }
-
-    // Get rid of warnings
-    Q_UNUSED(document);
-  }
-
-  // Open error
-  else
-  {
-    setJsonPathSetting("");
-    Misc::Utilities::showMessageBox(
-        tr("Cannot read JSON file"),
-        tr("Please check file permissions & location"), QMessageBox::Critical);
-    m_jsonMap.close();
-  }
-
-  // Update UI
-  Q_EMIT jsonFileMapChanged();
-}
-
-/**
- * @brief Assigns an instance to the frame parser to be used to split frame
- *        data/elements into individual parts.
- */
-void JSON::FrameBuilder::setFrameParser(JSON::FrameParser *parser)
-{
-  m_frameParser = parser;
-}
-
-/**
- * Changes the operation mode of the JSON parser. There are two possible op.
- * modes:
- *
- * @c kManual serial data only contains the comma-separated values, and we need
- *            to use a JSON map file (given by the user) to know what each value
- *            means. This method is recommended when we need to transfer &
- *            display a large amount of information from the microcontroller
- *            unit to the computer.
- *
- * @c kAutomatic serial data contains the JSON data frame, good for simple
- *               applications or for prototyping.
- */
-void JSON::FrameBuilder::setOperationMode(
-    const SerialStudio::OperationMode mode)
-{
-  m_opMode = mode;
-
-  switch (mode)
-  {
-    case SerialStudio::DeviceSendsJSON:
-      IO::Manager::instance().setStartSequence("");
-      IO::Manager::instance().setFinishSequence("");
-      break;
-    case SerialStudio::ProjectFile:
-      IO::Manager::instance().setFinishSequence(m_frame.frameEnd());
-      IO::Manager::instance().setStartSequence(m_frame.frameStart());
-      break;
-    case SerialStudio::QuickPlot:
-      IO::Manager::instance().setStartSequence("");
-      IO::Manager::instance().setFinishSequence("");
-      break;
-    default:
-      qWarning() << "Invalid operation mode selected" << mode;
-      break;
-  }
-
-  m_settings.setValue("operation_mode", mode);
-  Q_EMIT operationModeChanged();
-}
-
-/**
- * Saves the location of the last valid JSON map file that was opened (if any)
- */
-void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
-{
-  m_settings.setValue(QStringLiteral("json_map_location"), path);
-}
-
-/**
- * Tries to parse the given data as a JSON document according to the selected
- * operation mode.
- *
- * Possible operation modes:
- * - Auto:   serial data contains the JSON data frame
- * - Manual: serial data only contains the comma-separated values, and we need
- *           to use a JSON map file (given by the user) to know what each value
- *           means
- *
- * If JSON parsing is successfull, then the class shall notify the rest of the
- * application in order to process packet data.
- */
-void JSON::FrameBuilder::readData(const QByteArray &data)
-{
-  // Data empty, abort
-  if (data.isEmpty())
-    return;
-
-  // Serial device sends JSON (auto mode)
-  if (operationMode() == SerialStudio::DeviceSendsJSON)
-  {
-    auto jsonData = QJsonDocument::fromJson(data).object();
-    if (m_frame.read(jsonData))
-      Q_EMIT frameChanged(m_frame);
-  }
-
-  // Data is separated and parsed by Serial Studio project
-  else if (operationMode() == SerialStudio::ProjectFile && m_frameParser)
-  {
-    // Obtain state of the app
-    const bool csvPlaying = CSV::Player::instance().isOpen();
-
-    // Real-time data, parse data & perform conversion
-    QStringList fields;
-    if (!csvPlaying)
-    {
-      // Convert binary frame data to a string
-      QString frameData;
-      switch (JSON::ProjectModel::instance().decoderMethod())
-      {
-        case SerialStudio::PlainText:
-          frameData = QString::fromUtf8(data);
-          break;
-        case SerialStudio::Hexadecimal:
-          frameData = QString::fromUtf8(data.toHex());
-          break;
-        case SerialStudio::Base64:
-          frameData = QString::fromUtf8(data.toBase64());
-          break;
-        default:
-          frameData = QString::fromUtf8(data);
-          break;
-      }
-
-      // Get fields from frame parser function
-      fields = m_frameParser->parse(frameData);
-    }
-
-    // CSV data, no need to perform conversions or use frame parser
-    else
-      fields = QString::fromUtf8(data.simplified()).split(',');
-
-    // Replace data in frame
-    for (int g = 0; g < m_frame.groupCount(); ++g)
-    {
-      auto &group = m_frame.m_groups[g];
-      for (int d = 0; d < group.datasetCount(); ++d)
-      {
-        auto &dataset = group.m_datasets[d];
-        const auto index = dataset.index();
-        if (index <= fields.count() && index > 0)
-          dataset.m_value = fields.at(index - 1);
-      }
-    }
-
-    // Update user interface
-    Q_EMIT frameChanged(m_frame);
-  }
-
-  // Data is separated by comma separated values
-  else if (operationMode() == SerialStudio::QuickPlot)
-  {
-    // Obtain fields from data frame
-    auto fields = data.split(',');
-
-    // Create datasets from the data
-    int channel = 1;
-    QVector<JSON::Dataset> datasets;
-    for (const auto &field : std::as_const(fields))
-    {
-      JSON::Dataset dataset;
-      dataset.m_groupId = 0;
-      dataset.m_index = channel;
-      dataset.m_title = tr("Channel %1").arg(channel);
-      dataset.m_value = QString::fromUtf8(field);
-      dataset.m_graph = false;
-      datasets.append(dataset);
-
-      ++channel;
-    }
-
-    // Create a project frame from the groups
-    JSON::Frame frame;
-    frame.m_title = tr("Quick Plot");
-
-    // Create a datagrid group from the dataset array
-    JSON::Group datagrid(0);
-    datagrid.m_datasets = datasets;
-    datagrid.m_title = tr("Quick Plot Data");
-    datagrid.m_widget = QStringLiteral("datagrid");
-
-    // Append datagrid to frame
-    frame.m_groups.append(datagrid);
-
-    // Create a multiplot group when multiple datasets are found
-    if (datasets.count() > 1)
-    {
-      JSON::Group multiplot(1);
-      multiplot.m_datasets = datasets;
-      multiplot.m_title = tr("Multiple Plots");
-      multiplot.m_widget = QStringLiteral("multiplot");
-      for (int i = 0; i < multiplot.m_datasets.count(); ++i)
-        multiplot.m_datasets[i].m_groupId = 1;
-
-      frame.m_groups.append(multiplot);
-    }
-
-    // Create a container group with plots
-    JSON::Group plots(2);
-    plots.m_datasets = datasets;
-    plots.m_widget = QLatin1String("");
-    plots.m_title = tr("Individual Plots");
-    for (int i = 0; i < plots.m_datasets.count(); ++i)
-    {
-      plots.m_datasets[i].m_groupId = 2;
-      plots.m_datasets[i].m_graph = true;
-      plots.m_datasets[i].m_displayInOverview = (plots.m_datasets.count() == 1);
-    }
-
-    // Register container group
-    frame.m_groups.append(plots);
-
-    Q_EMIT frameChanged(frame);
-  }
-}
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cmath>
+
+#include <QThread>
+#include <QFileInfo>
+#include <QFileDialog>
+#include <QJSEngine>
+
+#include "IO/Manager.h"
+#include "SIMD/SIMD.h"
+#include "Misc/Utilities.h"
+#include "Misc/Settings.h"
+
+#include "CSV/Player.h"
+#include "JSON/ProjectModel.h"
+#include "JSON/FrameBuilder.h"
+#include "JSON/ScriptHelpers.h"
+#include "JSON/DatasetHistory.h"
+#include "JSON/FrameParserPool.h"
+#include "Misc/AllocationTracker.h"
+
+#ifdef USE_QT_COMMERCIAL
+#  include "Licensing/LemonSqueezy.h"
+#endif
+
+/**
+ * Initializes the JSON Parser class and connects appropiate SIGNALS/SLOTS
+ */
+JSON::FrameBuilder::FrameBuilder()
+  : m_opMode(SerialStudio::ProjectFile)
+  , m_frameParser(nullptr)
+  , m_loadThread(nullptr)
+  , m_statsGroup(-1)
+  , m_framePoolIndex(0)
+  , m_quickPlotChannels(-1)
+  , m_rxTimestamp(0)
+  , m_frameRevision(0)
+{
+  // Pre-allocate the shared frame pool used to publish frames
+  m_framePool.resize(8);
+
+
+  // Read JSON map location
+  auto path = Misc::Settings::instance().value("json_map_location", "").toString();
+  if (!path.isEmpty())
+    loadJsonMap(path);
+
+  // Obtain operation mode from settings
+  auto m = Misc::Settings::instance().value("operation_mode", SerialStudio::QuickPlot).toInt();
+  setOperationMode(static_cast<SerialStudio::OperationMode>(m));
+
+  // Reload JSON map file when license is activated
+#ifdef USE_QT_COMMERCIAL
+  connect(&Licensing::LemonSqueezy::instance(),
+          &Licensing::LemonSqueezy::activatedChanged, this, [=] {
+            if (!jsonMapFilepath().isEmpty())
+              loadJsonMap(jsonMapFilepath());
+          });
+#endif
+}
+
+/**
+ * Returns the only instance of the class
+ */
+JSON::FrameBuilder &JSON::FrameBuilder::instance()
+{
+  static FrameBuilder singleton;
+  return singleton;
+}
+
+/**
+ * Returns the file path of the loaded JSON map file
+ */
+QString JSON::FrameBuilder::jsonMapFilepath() const
+{
+  if (m_jsonMap.isOpen())
+  {
+    auto fileInfo = QFileInfo(m_jsonMap.fileName());
+    return fileInfo.filePath();
+  }
+
+  return "";
+}
+
+/**
+ * Returns the file name of the loaded JSON map file
+ */
+QString JSON::FrameBuilder::jsonMapFilename() const
+{
+  if (m_jsonMap.isOpen())
+  {
+    auto fileInfo = QFileInfo(m_jsonMap.fileName());
+    return fileInfo.fileName();
+  }
+
+  return "";
+}
+
+/**
+ * Returns the project frame that drives parsing & dashboard generation.
+ */
+const JSON::Frame &JSON::FrameBuilder::frame() const
+{
+  return m_frame;
+}
+
+/**
+ * Returns a pointer to the currently loaded frame parser editor.
+ */
+JSON::FrameParser *JSON::FrameBuilder::frameParser() const
+{
+  return m_frameParser;
+}
+
+/**
+ * Returns the operation mode
+ */
+SerialStudio::OperationMode JSON::FrameBuilder::operationMode() const
+{
+  return m_opMode;
+}
+
+/**
+ * Creates a file dialog & lets the user select the JSON file map
+ */
+void JSON::FrameBuilder::loadJsonMap()
+{
+  const auto file = QFileDialog::getOpenFileName(
+      nullptr, tr("Select JSON map file"),
+      JSON::ProjectModel::instance().jsonProjectsPath(),
+      tr("JSON files") + QStringLiteral(" (*.json)"));
+
+  if (!file.isEmpty())
+    loadJsonMap(file);
+}
+
+/**
+ * Configures the signal/slot connections with the rest of the modules of the
+ * application.
+ */
+void JSON::FrameBuilder::setupExternalConnections()
+{
+  connect(&IO::Manager::instance(), &IO::Manager::frameReceived, this,
+          &JSON::FrameBuilder::readData, Qt::QueuedConnection);
+  connect(&IO::Manager::instance(), &IO::Manager::timedFramesReceived, this,
+          &JSON::FrameBuilder::readTimedFrames, Qt::QueuedConnection);
+}
+
+/**
+ * Opens, validates & loads into memory the JSON file in the given @a path.
+ *
+ * The file read, JSON parse and group/dataset validation all run on a
+ * background thread (large projects additionally spread the group validation
+ * across cores, see JSON::Frame::read), so the UI never stalls while a
+ * project loads or the editor re-applies its changes. The finished model is
+ * swapped in on this object's thread — between two readData() invocations —
+ * so live parsing either sees the previous project or the new one, never a
+ * half-initialized tree. Starting a new load while one is still in flight
+ * simply discards the older result.
+ */
+void JSON::FrameBuilder::loadJsonMap(const QString &path)
+{
+  // Validate path
+  if (path.isEmpty())
+    return;
+
+  // Shared state filled by the worker & consumed by the commit handler
+  struct LoadResult
+  {
+    bool fileOk = false;
+    bool frameOk = false;
+    JSON::Frame frame;
+    QString parseError;
+    QJsonArray binarySchema;
+  };
+  auto result = std::make_shared<LoadResult>();
+
+  // Read, parse & validate the project on a background thread
+  auto *thread = QThread::create([path, result] {
+    // Try to open the file (read only mode)
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly))
+      return;
+
+    // Read data & validate JSON from file
+    result->fileOk = true;
+    QJsonParseError error;
+    const auto document = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError)
+    {
+      result->parseError = error.errorString();
+      return;
+    }
+
+    // Build & validate the frame tree from the document
+    result->frameOk
+        = result->frame.read(document.object()) && result->frame.isValid();
+    result->binarySchema
+        = document.object().value(QStringLiteral("binarySchema")).toArray();
+  });
+
+  // Swap the finished model in on this thread
+  m_loadThread = thread;
+  connect(thread, &QThread::finished, this, [=] {
+    // A newer load superseded this one, discard the result
+    if (thread != m_loadThread)
+      return;
+
+    // Forget the worker & drop the previous project
+    m_loadThread = nullptr;
+    if (m_jsonMap.isOpen())
+    {
+      m_frame.clear();
+      m_jsonMap.close();
+      m_binaryParser.clear();
+      m_statsGroup = -1;
+      m_rollingStats.clear();
+    }
+
+    // Open error
+    if (!result->fileOk)
+    {
+      setJsonPathSetting("");
+      Misc::Utilities::showMessageBox(
+          tr("Cannot read JSON file"),
+          tr("Please check file permissions & location"),
+          QMessageBox::Critical);
+    }
+
+    // JSON syntax error
+    else if (!result->parseError.isEmpty())
+    {
+      setJsonPathSetting("");
+      Misc::Utilities::showMessageBox(
+          tr("JSON parse error"), result->parseError, QMessageBox::Critical);
+    }
+
+    // Invalid frame data
+    else if (!result->frameOk)
+    {
+      setJsonPathSetting("");
+      Misc::Utilities::showMessageBox(tr("Invalid JSON project format"));
+    }
+
+    // Commit the validated model atomically
+    else
+    {
+      // Save settings & keep the file handle for jsonMapFilepath()
+      setJsonPathSetting(path);
+      m_jsonMap.setFileName(path);
+      (void)m_jsonMap.open(QFile::ReadOnly);
+
+      // Swap in the parsed frame & compile the binary layout schema
+      m_frame = std::move(result->frame);
+      setupDerivedStatistics();
+      m_frame.m_structureRevision = ++m_frameRevision;
+      m_binaryParser.load(result->binarySchema);
+
+      // Update I/O manager settings
+      if (operationMode() == SerialStudio::ProjectFile)
+      {
+        IO::Manager::instance().setFinishSequence(m_frame.frameEnd());
+        IO::Manager::instance().setStartSequence(m_frame.frameStart());
+      }
+    }
+
+    // Update UI
+    Q_EMIT jsonFileMapChanged();
+  });
+
+  connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+  thread->start();
+}
+
+/**
+ * @brief Compiles & validates new parser code without touching the pipeline.
+ *
+ * The script is evaluated on a throwaway engine running on a side thread and
+ * trial-run against the most recently parsed frame, so syntax errors, missing
+ * 'parse' declarations and runtime exceptions are all caught while the
+ * current parser keeps processing live data. The verdict is reported through
+ * parserSwapFinished() on this object's thread — between two readData()
+ * invocations — so a successful swap committed from that handler takes
+ * effect atomically at a frame boundary, with zero ingest interruption.
+ *
+ * @param code JavaScript code of the candidate frame parser.
+ */
+void JSON::FrameBuilder::hotSwapParser(const QString &code)
+{
+  const auto sample = m_sampleFrame;
+  auto *thread = QThread::create([this, code, sample] {
+    // Build a private engine mirroring the editor's environment
+    QJSEngine engine;
+    engine.installExtensions(QJSEngine::AllExtensions);
+    ScriptHelpers::install(engine);
+    DatasetHistory::install(engine);
+
+    // Evaluate the candidate script & locate the parse function
+    QString error;
+    QStringList errors;
+    engine.evaluate(code, "", 1, &errors);
+    auto fun = engine.globalObject().property("parse");
+    bool ok = errors.isEmpty() && !fun.isNull() && fun.isCallable();
+    if (!ok)
+      error = !errors.isEmpty()
+                  ? errors.first()
+                  : tr("The 'parse' function is not declared or is not "
+                       "callable!");
+
+    // Trial-run the parser against the last frame seen by the pipeline
+    if (ok && !sample.isEmpty())
+    {
+      const auto result = fun.call({sample});
+      if (result.isError())
+      {
+        ok = false;
+        error = result.toString();
+      }
+    }
+
+    // Report the verdict back on the builder's thread
+    QMetaObject::invokeMethod(
+        this, [=] { Q_EMIT parserSwapFinished(ok, error); },
+        Qt::QueuedConnection);
+  });
+
+  connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+  thread->start();
+}
+
+/**
+ * @brief Assigns an instance to the frame parser to be used to split frame
+ *        data/elements into individual parts.
+ *
+ * Live edits to the registered parser should go through hotSwapParser(), so
+ * the running script keeps parsing frames while its replacement is compiled
+ * and validated off-thread.
+ */
+void JSON::FrameBuilder::setFrameParser(JSON::FrameParser *parser)
+{
+  m_frameParser = parser;
+}
+
+/**
+ * Changes the operation mode of the JSON parser. There are two possible op.
+ * modes:
+ *
+ * @c kManual serial data only contains the comma-separated values, and we need
+ *            to use a JSON map file (given by the user) to know what each value
+ *            means. This method is recommended when we need to transfer &
+ *            display a large amount of information from the microcontroller
+ *            unit to the computer.
+ *
+ * @c kAutomatic serial data contains the JSON data frame, good for simple
+ *               applications or for prototyping.
+ */
+void JSON::FrameBuilder::setOperationMode(
+    const SerialStudio::OperationMode mode)
+{
+  m_opMode = mode;
+
+  switch (mode)
+  {
+    case SerialStudio::DeviceSendsJSON:
+      IO::Manager::instance().setStartSequence("");
+      IO::Manager::instance().setFinishSequence("");
+      break;
+    case SerialStudio::ProjectFile:
+      IO::Manager::instance().setFinishSequence(m_frame.frameEnd());
+      IO::Manager::instance().setStartSequence(m_frame.frameStart());
+      break;
+    case SerialStudio::QuickPlot:
+      IO::Manager::instance().setStartSequence("");
+      IO::Manager::instance().setFinishSequence("");
+      break;
+    default:
+      qWarning() << "Invalid operation mode selected" << mode;
+      break;
+  }
+
+  Misc::Settings::instance().setValue("operation_mode", mode);
+  Q_EMIT operationModeChanged();
+}
+
+/**
+ * Saves the location of the last valid JSON map file that was opened (if any)
+ */
+void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
+{
+  Misc::Settings::instance().setValue(QStringLiteral("json_map_location"), path);
+}
+
+/**
+ * Tries to parse the given data as a JSON document according to the selected
+ * operation mode.
+ *
+ * Possible operation modes:
+ * - Auto:   serial data contains the JSON data frame
+ * - Manual: serial data only contains the comma-separated values, and we need
+ *           to use a JSON map file (given by the user) to know what each value
+ *           means
+ *
+ * If JSON parsing is successfull, then the class shall notify the rest of the
+ * application in order to process packet data.
+ */
+/**
+ * @brief Parses a batch of frames delivered by the I/O manager in one pass.
+ *
+ * Frames extracted from a single buffer scan arrive together, so they are
+ * processed in a tight loop instead of paying one queued signal/slot round
+ * trip per frame.
+ *
+ * In project mode with a JavaScript frame parser, batches are additionally
+ * scattered over the parser worker pool (one QJSEngine per core, see
+ * JSON::FrameParserPool), so script execution scales across cores while the
+ * results are still applied and published in arrival order.
+ */
+void JSON::FrameBuilder::readFrames(const QVector<QByteArray> &frames)
+{
+  // Project mode with a JS parser, parse the batch concurrently. Projects
+  // with a compiled binary schema skip the pool: the native extractor is
+  // cheap enough that scattering would cost more than it saves.
+  if (operationMode() == SerialStudio::ProjectFile && m_frameParser
+      && !m_binaryParser.isValid() && frames.count() > 1
+      && !CSV::Player::instance().isOpen()
+      && FrameParserPool::instance().scriptLoaded())
+  {
+    // Decode the raw frames into parser input strings
+    QVector<QString> inputs;
+    inputs.reserve(frames.count());
+    for (const auto &frame : frames)
+      inputs.append(decodeFrameData(frame));
+
+    // Keep a sample around so hotSwapParser() can trial-run candidate code
+    m_sampleFrame = inputs.constLast();
+
+    // Scatter over the pool, results come back in submission order
+    const auto results = FrameParserPool::instance().parse(inputs);
+    for (const auto &fields : results)
+    {
+      applyProjectFields(fields);
+      publishFrame(m_frame);
+    }
+
+    return;
+  }
+
+  // Serial fallback for every other mode
+  for (const auto &frame : frames)
+    readData(frame);
+}
+
+/**
+ * @brief Parses a batch of frames that carry a capture timestamp.
+ *
+ * The timestamp was recorded at the driver boundary when the raw bytes were
+ * handed over by the hardware, so frames published from this batch reflect
+ * wire timing instead of the pipeline's queue depths. The stamp is cleared
+ * afterwards so frames injected through other paths (plugins, MQTT) fall
+ * back to stamping at registration time.
+ *
+ * @param timestamp Capture time of the batch in msecs since the epoch.
+ * @param frames List of frames to parse.
+ */
+void JSON::FrameBuilder::readTimedFrames(const qint64 timestamp,
+                                         const QVector<QByteArray> &frames)
+{
+  m_rxTimestamp = timestamp;
+  readFrames(frames);
+  m_rxTimestamp = 0;
+}
+
+/**
+ * Tries to parse the given data as a JSON document according to the selected
+ * operation mode.
+ *
+ * Possible operation modes:
+ * - Auto:       serial data contains the JSON data frame
+ * - Manual:     serial data only contains the values, and we need to use a
+ *               JSON project file (given by the user) to know what each value
+ *               means
+ * - Quick plot: serial data contains comma-separated values, one channel is
+ *               created per column
+ *
+ * If JSON parsing is successfull, then the class shall notify the rest of the
+ * application in order to process packet data.
+ */
+void JSON::FrameBuilder::readData(const QByteArray &data)
+{
+  // Data empty, abort
+  if (data.isEmpty())
+    return;
+
+  // Attribute heap allocations to the parsing stage while diagnosing
+  Misc::AllocationTracker::Scope allocScope(Misc::AllocationTracker::Parsing);
+
+  // Serial device sends JSON (auto mode)
+  if (operationMode() == SerialStudio::DeviceSendsJSON)
+  {
+    auto jsonData = QJsonDocument::fromJson(data).object();
+    if (m_frame.read(jsonData))
+    {
+      // The tree shape may change with every JSON document, so each frame
+      // gets a new structure revision & a full dashboard pass
+      m_frame.m_updatedIndexes.clear();
+      m_frame.m_structureRevision = ++m_frameRevision;
+      publishFrame(m_frame);
+    }
+  }
+
+  // Data is separated and parsed by Serial Studio project
+  else if (operationMode() == SerialStudio::ProjectFile
+           && (m_frameParser || m_binaryParser.isValid()))
+  {
+    // Obtain state of the app
+    const bool csvPlaying = CSV::Player::instance().isOpen();
+
+    // Fixed-layout binary frame, extract fields with the compiled schema
+    QStringList fields;
+    if (!csvPlaying && m_binaryParser.matches(data.length()))
+      fields = m_binaryParser.parse(data);
+
+    // Real-time data, parse data & perform conversion. The decoded input is
+    // kept around so hotSwapParser() can trial-run candidate code against it
+    else if (!csvPlaying && m_frameParser)
+    {
+      m_sampleFrame = decodeFrameData(data);
+      fields = m_frameParser->parse(m_sampleFrame);
+    }
+
+    // CSV data, no need to perform conversions or use frame parser
+    else
+      fields = QString::fromUtf8(data.simplified()).split(',');
+
+    // Replace data in frame & update user interface
+    applyProjectFields(fields);
+    publishFrame(m_frame);
+  }
+
+  // Data is separated by comma separated values
+  else if (operationMode() == SerialStudio::QuickPlot)
+  {
+    // Count the channels without splitting the frame into sub-arrays
+    const int channels
+        = static_cast<int>(SIMD::countByte(data.constData(), data.length(), ','))
+          + 1;
+
+    // Rebuild the cached frame only when the channel count changes
+    if (m_quickPlotChannels != channels)
+    {
+      // Create one dataset per channel
+      QVector<JSON::Dataset> datasets;
+      for (int channel = 1; channel <= channels; ++channel)
+      {
+        JSON::Dataset dataset;
+        dataset.m_groupId = 0;
+        dataset.m_index = channel;
+        dataset.m_title = tr("Channel %1").arg(channel);
+        dataset.m_graph = false;
+        datasets.append(dataset);
+      }
+
+      // Create a project frame from the groups
+      JSON::Frame frame;
+      frame.m_title = tr("Quick Plot");
+
+      // Create a datagrid group from the dataset array
+      JSON::Group datagrid(0);
+      datagrid.m_datasets = datasets;
+      datagrid.m_title = tr("Quick Plot Data");
+      datagrid.m_widget = QStringLiteral("datagrid");
+
+      // Append datagrid to frame
+      frame.m_groups.append(datagrid);
+
+      // Create a multiplot group when multiple datasets are found
+      if (datasets.count() > 1)
+      {
+        JSON::Group multiplot(1);
+        multiplot.m_datasets = datasets;
+        multiplot.m_title = tr("Multiple Plots");
+        multiplot.m_widget = QStringLiteral("multiplot");
+        for (int i = 0; i < multiplot.m_datasets.count(); ++i)
+          multiplot.m_datasets[i].m_groupId = 1;
+
+        frame.m_groups.append(multiplot);
+      }
+
+      // Create a container group with plots
+      JSON::Group plots(2);
+      plots.m_datasets = datasets;
+      plots.m_widget = QLatin1String("");
+      plots.m_title = tr("Individual Plots");
+      for (int i = 0; i < plots.m_datasets.count(); ++i)
+      {
+        plots.m_datasets[i].m_groupId = 2;
+        plots.m_datasets[i].m_graph = true;
+        plots.m_datasets[i].m_displayInOverview
+            = (plots.m_datasets.count() == 1);
+      }
+
+      // Register container group
+      frame.m_groups.append(plots);
+
+      // Register the frame as the cached quick plot tree
+      m_quickPlotFrame = frame;
+      m_quickPlotChannels = channels;
+      m_quickPlotFrame.m_structureRevision = ++m_frameRevision;
+    }
+
+    // Tokenize the frame in place & move the values into the cached tree;
+    // empty tokens mean "no update" for their channel, whose datasets keep
+    // the previous value and whose plot series do not advance
+    int index = 0;
+    m_quickPlotFrame.m_updatedIndexes.clear();
+    SIMD::tokenize(data.constData(), data.length(), ',',
+                   [&](const char *token, size_t length) {
+                     if (length == 0)
+                     {
+                       ++index;
+                       return;
+                     }
+
+                     const auto numeric = SIMD::parseDouble(token, length);
+                     const auto text = QString::fromUtf8(
+                         token, static_cast<qsizetype>(length));
+
+                     for (auto &group : m_quickPlotFrame.m_groups)
+                     {
+                       if (index < group.m_datasets.count())
+                       {
+                         auto &dataset = group.m_datasets[index];
+                         if (dataset.value() != text)
+                           dataset.setValue(text, numeric);
+                       }
+                     }
+
+                     m_quickPlotFrame.m_updatedIndexes.insert(index + 1);
+                     ++index;
+                   });
+
+    publishFrame(m_quickPlotFrame);
+  }
+}
+
+/**
+ * @brief Converts binary frame data into the string fed to the frame parser.
+ *
+ * The conversion honors the decoder method selected in the project model
+ * (plain text, hexadecimal or base64).
+ *
+ * @param data Raw frame bytes.
+ * @return The decoded parser input string.
+ */
+QString JSON::FrameBuilder::decodeFrameData(const QByteArray &data) const
+{
+  switch (JSON::ProjectModel::instance().decoderMethod())
+  {
+    case SerialStudio::PlainText:
+      return QString::fromUtf8(data);
+    case SerialStudio::Hexadecimal:
+      return QString::fromUtf8(data.toHex());
+    case SerialStudio::Base64:
+      return QString::fromUtf8(data.toBase64());
+    default:
+      return QString::fromUtf8(data);
+  }
+}
+
+/**
+ * @brief Copies parsed field values into the datasets of the project frame.
+ *
+ * Frames may be sparse: empty fields (and fields beyond the end of the list)
+ * mean "no update" for the datasets they map to, which keep their previous
+ * value and are not marked as updated. This lets parser scripts for polled
+ * or bus-based sources (Modbus, CAN) emit only the channels that actually
+ * carried data, so a slow scan never stuffs stale samples into the plot
+ * series of a fast channel and each series advances at its native rate.
+ *
+ * @param fields Field list produced by the frame parser (or CSV split).
+ */
+void JSON::FrameBuilder::applyProjectFields(const QStringList &fields)
+{
+  m_frame.m_updatedIndexes.clear();
+  for (int g = 0; g < m_frame.groupCount(); ++g)
+  {
+    auto &group = m_frame.m_groups[g];
+    for (int d = 0; d < group.datasetCount(); ++d)
+    {
+      auto &dataset = group.m_datasets[d];
+      const auto index = dataset.index();
+      if (index <= fields.count() && index > 0)
+      {
+        // Empty field, the source did not refresh this dataset
+        const auto &value = fields.at(index - 1);
+        if (value.isEmpty())
+          continue;
+
+        // Mark the dataset as updated even when the value is unchanged, so
+        // its plot series keeps advancing for constant signals
+        if (dataset.value() != value)
+          dataset.setValue(value);
+
+        m_frame.m_updatedIndexes.insert(index);
+      }
+    }
+  }
+
+  // Refresh the derived statistics datasets fed by the updated channels
+  updateDerivedStatistics();
+}
+
+/**
+ * @brief Registers the derived statistics datasets of the loaded project.
+ *
+ * Called when a project is committed, before the frame receives its structure
+ * revision: datasets that declare a rolling-statistics window (the
+ * \c statsWindow project attribute) get four derived companions — mean,
+ * standard deviation, minimum & maximum — grouped into a synthetic
+ * "Statistics" datagrid appended to the frame tree. The derived datasets use
+ * indexes past the highest project index, so they behave like ordinary
+ * datasets everywhere downstream (dashboard registry, CSV export, plugin
+ * feeds) without colliding with parser output fields.
+ *
+ * The per-channel accumulators are recomputed incrementally by
+ * updateDerivedStatistics() on the worker pipeline, so enabling statistics
+ * on many channels at once stays cheap.
+ */
+void JSON::FrameBuilder::setupDerivedStatistics()
+{
+  // Drop the accumulators of the previous project
+  m_statsGroup = -1;
+  m_rollingStats.clear();
+
+  // Locate the source datasets & the highest index in use
+  int maxIndex = 0;
+  QVector<RollingStats> sources;
+  for (int g = 0; g < m_frame.groupCount(); ++g)
+  {
+    const auto &group = m_frame.m_groups[g];
+    for (int d = 0; d < group.datasetCount(); ++d)
+    {
+      const auto &dataset = group.m_datasets[d];
+      maxIndex = qMax(maxIndex, dataset.index());
+      if (dataset.statsWindow() > 0 && dataset.index() > 0)
+      {
+        RollingStats stats;
+        stats.window = dataset.statsWindow();
+        stats.sourceIndex = dataset.index();
+        stats.sourceGroup = g;
+        stats.sourceDataset = d;
+        stats.derivedDataset = sources.count() * 4;
+        stats.samples.resize(stats.window);
+        sources.append(std::move(stats));
+      }
+    }
+  }
+
+  // No dataset requested statistics
+  if (sources.isEmpty())
+    return;
+
+  // Create the synthetic group holding the derived datasets
+  JSON::Group group(m_frame.groupCount());
+  group.m_title = tr("Statistics");
+  group.m_widget = QStringLiteral("datagrid");
+
+  // Register four derived datasets per source channel
+  const char *suffixes[4] = {QT_TR_NOOP("mean"), QT_TR_NOOP("std. dev."),
+                             QT_TR_NOOP("min"), QT_TR_NOOP("max")};
+  for (const auto &stats : std::as_const(sources))
+  {
+    const auto &source
+        = m_frame.m_groups[stats.sourceGroup].m_datasets[stats.sourceDataset];
+    for (int i = 0; i < 4; ++i)
+    {
+      JSON::Dataset derived;
+      derived.m_groupId = group.groupId();
+      derived.m_datasetId = group.m_datasets.count();
+      derived.m_index = ++maxIndex;
+      derived.m_title = tr("%1 (%2)").arg(source.title(), tr(suffixes[i]));
+      derived.m_units = source.units();
+      group.m_datasets.append(std::move(derived));
+    }
+  }
+
+  // Append the group to the frame & activate the accumulators
+  m_statsGroup = m_frame.groupCount();
+  m_frame.m_groups.append(std::move(group));
+  m_rollingStats = std::move(sources);
+}
+
+/**
+ * @brief Folds the latest channel values into the derived statistics.
+ *
+ * Called at the end of every field application pass: each accumulator whose
+ * source dataset was updated by the current frame evicts the sample that
+ * left its window, folds the new one into the paired running sums (mean &
+ * standard deviation) and the monotonic deques (minimum & maximum), then
+ * writes the four derived values and marks them as updated so their series
+ * advance together with the source channel.
+ */
+void JSON::FrameBuilder::updateDerivedStatistics()
+{
+  if (m_statsGroup < 0)
+    return;
+
+  auto &derived = m_frame.m_groups[m_statsGroup].m_datasets;
+  for (auto &stats : m_rollingStats)
+  {
+    // Source channel not refreshed by this frame, statistics are unchanged
+    if (!m_frame.m_updatedIndexes.contains(stats.sourceIndex))
+      continue;
+
+    // Read the latest sample from the source dataset
+    const auto &source
+        = m_frame.m_groups[stats.sourceGroup].m_datasets[stats.sourceDataset];
+    const double sample = source.numericValue();
+
+    // Evict the sample that left the window from the running sums
+    if (stats.count == stats.window)
+    {
+      const double old = stats.samples[stats.head];
+      stats.sum -= old;
+      stats.sumSquares -= old * old;
+    }
+
+    else
+      ++stats.count;
+
+    // Fold the new sample into the ring & the running sums
+    stats.samples[stats.head] = sample;
+    stats.head = (stats.head + 1) % stats.window;
+    stats.sum += sample;
+    stats.sumSquares += sample * sample;
+    ++stats.sequence;
+
+    // Expire deque entries that left the window & fold the new sample
+    const quint64 expired = stats.sequence - qMin<quint64>(
+        stats.sequence, static_cast<quint64>(stats.window));
+    while (!stats.minDeque.empty() && stats.minDeque.front().first <= expired)
+      stats.minDeque.pop_front();
+    while (!stats.maxDeque.empty() && stats.maxDeque.front().first <= expired)
+      stats.maxDeque.pop_front();
+    while (!stats.minDeque.empty() && stats.minDeque.back().second >= sample)
+      stats.minDeque.pop_back();
+    while (!stats.maxDeque.empty() && stats.maxDeque.back().second <= sample)
+      stats.maxDeque.pop_back();
+    stats.minDeque.emplace_back(stats.sequence, sample);
+    stats.maxDeque.emplace_back(stats.sequence, sample);
+
+    // Derive the current window statistics
+    const double mean = stats.sum / stats.count;
+    const double variance
+        = qMax(0.0, stats.sumSquares / stats.count - mean * mean);
+    const double values[4] = {mean, std::sqrt(variance),
+                              stats.minDeque.front().second,
+                              stats.maxDeque.front().second};
+
+    // Publish the derived values as ordinary dataset updates
+    for (int i = 0; i < 4; ++i)
+    {
+      auto &dataset = derived[stats.derivedDataset + i];
+      dataset.setValue(QString::number(values[i]), values[i]);
+      m_frame.m_updatedIndexes.insert(dataset.index());
+    }
+  }
+}
+
+/**
+ * @brief Publishes a frame snapshot to the rest of the application.
+ *
+ * Snapshots are handed out as shared pointers drawn from a small rotating
+ * pool, so every queued consumer (dashboard, CSV export, plugin server)
+ * receives the same immutable object instead of its own deep copy of the
+ * group/dataset tree. A pooled frame is only re-used once every consumer has
+ * released its reference; otherwise a fresh frame backs the slot.
+ *
+ * When the pooled frame already carries the same structure revision, only
+ * the dataset values are synchronized into it: the static title, units and
+ * widget strings (and the group/dataset tree itself) are never touched, so
+ * in steady state publishing costs one shared-string check per dataset and
+ * a copy of the values that actually differ. The full assignment — which
+ * shares the tree and forces the working frame to deep-copy it on its next
+ * mutation — only happens when the structure changes or a slot has to be
+ * re-allocated because a consumer still references it.
+ *
+ * @param frame Working frame with the freshly parsed values.
+ */
+void JSON::FrameBuilder::publishFrame(const JSON::Frame &frame)
+{
+  auto &slot = m_framePool[m_framePoolIndex];
+  m_framePoolIndex = (m_framePoolIndex + 1) % m_framePool.count();
+
+  // Slot empty or still referenced by a consumer, back it with a new frame
+  if (!slot || slot.use_count() > 1)
+  {
+    slot = std::make_shared<JSON::Frame>();
+    *slot = frame;
+  }
+
+  // Same structure as the slot's last full copy: sync only the values, the
+  // slot keeps its own storage & the working frame never detaches from it
+  else if (slot->m_structureRevision != 0
+           && slot->m_structureRevision == frame.m_structureRevision
+           && slot->m_groups.count() == frame.m_groups.count())
+  {
+    for (int g = 0; g < frame.m_groups.count(); ++g)
+    {
+      auto &dst = slot->m_groups[g];
+      const auto &src = frame.m_groups.at(g);
+      if (dst.m_datasets.count() != src.m_datasets.count())
+      {
+        dst.m_datasets = src.m_datasets;
+        continue;
+      }
+
+      // Values unchanged since the slot's previous turn still share their
+      // string data, so most datasets cost a pointer compare & nothing else
+      for (int d = 0; d < src.m_datasets.count(); ++d)
+      {
+        const auto &source = src.m_datasets.at(d);
+        auto &target = dst.m_datasets[d];
+        if (!target.m_value.isSharedWith(source.m_value))
+        {
+          target.m_value = source.m_value;
+          target.m_numericValue = source.m_numericValue;
+        }
+      }
+    }
+
+    slot->m_updatedIndexes = frame.m_updatedIndexes;
+  }
+
+  // Structure changed, snapshot the whole working frame
+  else
+    *slot = frame;
+
+  // Carry the capture timestamp of the raw batch (0 when none is known);
+  // the value-sync branch above skips scalar metadata, so stamp explicitly
+  slot->m_rxTimestamp = m_rxTimestamp;
+
+  // Feed the rolling history exposed to the parser scripts
+  DatasetHistory::instance().registerFrame(frame);
+
+  Q_EMIT frameChanged(slot);
+}
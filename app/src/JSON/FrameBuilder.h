@@ -21,9 +21,12 @@
 
 #pragma once
 
+#include <deque>
+#include <memory>
+#include <utility>
+
 #include <QFile>
 #include <QObject>
-#include <QSettings>
 #include <QJsonArray>
 #include <QJsonValue>
 #include <QJsonObject>
@@ -33,6 +36,7 @@
 
 #include "JSON/Frame.h"
 #include "JSON/FrameParser.h"
+#include "JSON/BinaryParser.h"
 
 namespace JSON
 {
@@ -66,7 +70,8 @@ class FrameBuilder : public QObject
 signals:
   void jsonFileMapChanged();
   void operationModeChanged();
-  void frameChanged(const JSON::Frame &frame);
+  void frameChanged(const std::shared_ptr<JSON::Frame> &frame);
+  void parserSwapFinished(bool success, const QString &error);
 
 private:
   explicit FrameBuilder();
@@ -80,6 +85,7 @@ public:
 
   [[nodiscard]] QString jsonMapFilepath() const;
   [[nodiscard]] QString jsonMapFilename() const;
+  [[nodiscard]] const JSON::Frame &frame() const;
   [[nodiscard]] JSON::FrameParser *frameParser() const;
   [[nodiscard]] SerialStudio::OperationMode operationMode() const;
 
@@ -87,6 +93,7 @@ public slots:
   void loadJsonMap();
   void setupExternalConnections();
   void loadJsonMap(const QString &path);
+  void hotSwapParser(const QString &code);
   void setFrameParser(JSON::FrameParser *editor);
   void setOperationMode(const SerialStudio::OperationMode mode);
 
@@ -95,12 +102,62 @@ public slots:
 
 private slots:
   void readData(const QByteArray &data);
+  void readFrames(const QVector<QByteArray> &frames);
+  void readTimedFrames(const qint64 timestamp,
+                       const QVector<QByteArray> &frames);
+
+private:
+  QString decodeFrameData(const QByteArray &data) const;
+  void applyProjectFields(const QStringList &fields);
+  void setupDerivedStatistics();
+  void updateDerivedStatistics();
+  void publishFrame(const JSON::Frame &frame);
 
 private:
+  /**
+   * @brief Incremental rolling-window statistics for one source dataset.
+   *
+   * The window is a ring of the last @c window samples with paired running
+   * sums, so mean & standard deviation updates are O(1) per sample; minimum
+   * & maximum are tracked with monotonic deques whose entries expire by
+   * sample sequence number, giving amortized O(1) extrema updates as well.
+   * The source & derived datasets are addressed by their positions in the
+   * frame tree, which are fixed between structural passes.
+   */
+  struct RollingStats
+  {
+    int window;
+    int sourceIndex;
+    int sourceGroup;
+    int sourceDataset;
+    int derivedDataset;
+
+    qsizetype head = 0;
+    qsizetype count = 0;
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    quint64 sequence = 0;
+    QVector<double> samples;
+    std::deque<std::pair<quint64, double>> minDeque;
+    std::deque<std::pair<quint64, double>> maxDeque;
+  };
+
   QFile m_jsonMap;
   JSON::Frame m_frame;
-  QSettings m_settings;
+  JSON::Frame m_quickPlotFrame;
+  JSON::BinaryParser m_binaryParser;
   SerialStudio::OperationMode m_opMode;
   JSON::FrameParser *m_frameParser;
+  QThread *m_loadThread;
+
+  int m_statsGroup;
+  QVector<RollingStats> m_rollingStats;
+
+  int m_framePoolIndex;
+  int m_quickPlotChannels;
+  qint64 m_rxTimestamp;
+  quint64 m_frameRevision;
+  QString m_sampleFrame;
+  QVector<std::shared_ptr<JSON::Frame>> m_framePool;
 };
 } // namespace JSON
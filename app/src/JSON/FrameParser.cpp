@@ -25,14 +25,18 @@
 #include <QLineNumberArea>
 #include <QDesktopServices>
 #include <QRegularExpression>
+#include <QCryptographicHash>
 #include <QJavascriptHighlighter>
 
 #include "JSON/FrameParser.h"
+#include "JSON/FrameBuilder.h"
 #include "JSON/ProjectModel.h"
+#include "JSON/ScriptHelpers.h"
+#include "JSON/DatasetHistory.h"
+#include "JSON/FrameParserPool.h"
 
 #include "Misc/Utilities.h"
 #include "Misc/CommonFonts.h"
-#include "Misc/TimerEvents.h"
 #include "Misc/ThemeManager.h"
 
 /**
@@ -81,6 +85,8 @@ JSON::FrameParser::FrameParser(QQuickItem *parent)
   // Configure JavaScript engine
   m_engine.installExtensions(QJSEngine::ConsoleExtension
                              | QJSEngine::GarbageCollectionExtension);
+  ScriptHelpers::install(m_engine);
+  DatasetHistory::install(m_engine);
 
   // Load template code
   reload();
@@ -103,6 +109,12 @@ JSON::FrameParser::FrameParser(QQuickItem *parent)
           &ProjectModel::frameParserCodeChanged, this,
           &JSON::FrameParser::readCode);
 
+  // Commit (or reject) hot-swapped parser code once it has been validated
+  // off-thread against a captured sample frame
+  connect(&JSON::FrameBuilder::instance(),
+          &FrameBuilder::parserSwapFinished, this,
+          &JSON::FrameParser::onParserSwapFinished);
+
   // Bridge signals
   connect(&m_widget, &QCodeEditor::textChanged, this,
           &FrameParser::textChanged);
@@ -113,9 +125,18 @@ JSON::FrameParser::FrameParser(QQuickItem *parent)
   connect(this, &QQuickPaintedItem::heightChanged, this,
           &JSON::FrameParser::resizeWidget);
 
-  // Configure render loop
-  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout24Hz, this,
+  // Configure render loop, the editor owns its timer & only runs it while
+  // visible, so it stays responsive even when the adaptive refresh governor
+  // has suspended the shared UI timers (e.g. no device connected)
+  m_renderTimer.setInterval(1000 / 24);
+  connect(&m_renderTimer, &QTimer::timeout, this,
           &JSON::FrameParser::renderWidget);
+  connect(this, &QQuickItem::visibleChanged, this, [=] {
+    if (isVisible())
+      m_renderTimer.start();
+    else
+      m_renderTimer.stop();
+  });
 }
 
 /**
@@ -251,6 +272,18 @@ bool JSON::FrameParser::save(const bool silent)
  */
 bool JSON::FrameParser::loadScript(const QString &script)
 {
+  // Script already compiled by this engine, reuse the cached function and
+  // skip evaluation & validation entirely (both already happened once)
+  const auto hash = QCryptographicHash::hash(script.toUtf8(),
+                                             QCryptographicHash::Sha256);
+  const auto cached = m_functionCache.constFind(hash);
+  if (cached != m_functionCache.constEnd())
+  {
+    m_parseFunction = cached.value();
+    FrameParserPool::instance().setScript(script);
+    return true;
+  }
+
   // Ensure that engine is configured correctly
   m_engine.installExtensions(QJSEngine::AllExtensions);
 
@@ -313,8 +346,13 @@ bool JSON::FrameParser::loadScript(const QString &script)
     return false;
   }
 
-  // We have reached this point without any errors, set function caller
+  // We have reached this point without any errors, set function caller and
+  // mirror the accepted script into the parse worker pool. The compiled
+  // function is kept in a hash-keyed cache so switching back to a previously
+  // loaded project skips re-evaluation.
   m_parseFunction = fun;
+  m_functionCache.insert(hash, fun);
+  FrameParserPool::instance().setScript(script);
   return true;
 }
 
@@ -371,10 +409,40 @@ void JSON::FrameParser::paste()
 }
 
 /**
- * @brief Writes the current code into the project file.
+ * @brief Validates & applies the current code without stopping the pipeline.
+ *
+ * The candidate script is compiled on a side thread and trial-run against
+ * the last parsed frame (see JSON::FrameBuilder::hotSwapParser()), so the
+ * running parser keeps processing live data until the replacement is known
+ * to be good. The actual commit happens in onParserSwapFinished().
  */
 void JSON::FrameParser::apply()
 {
+  FrameBuilder::instance().hotSwapParser(text());
+}
+
+/**
+ * @brief Commits validated parser code into the project & running pipeline.
+ *
+ * Invoked on the GUI thread between two frame deliveries, so the swap is
+ * atomic from the pipeline's point of view: every frame is parsed either
+ * entirely by the old script or entirely by the new one.
+ *
+ * @param success Result of the off-thread compile & trial run.
+ * @param error Human-readable description of the failure, when any.
+ */
+void JSON::FrameParser::onParserSwapFinished(const bool success,
+                                             const QString &error)
+{
+  // Candidate code failed validation, keep the current parser running
+  if (!success)
+  {
+    Misc::Utilities::showMessageBox(tr("Frame parser error!"), error,
+                                    QMessageBox::Critical);
+    return;
+  }
+
+  // Swap the editor engine & worker pool over to the validated script
   if (save(false))
   {
     auto &model = JSON::ProjectModel::instance();
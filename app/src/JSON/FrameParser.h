@@ -21,7 +21,9 @@
 
 #pragma once
 
+#include <QHash>
 #include <QEvent>
+#include <QTimer>
 #include <QPainter>
 #include <QJSValue>
 #include <QJSEngine>
@@ -72,6 +74,7 @@ public slots:
 
 private slots:
   void onThemeChanged();
+  void onParserSwapFinished(const bool success, const QString &error);
 
 private slots:
   void renderWidget();
@@ -95,10 +98,13 @@ private:
   virtual void dropEvent(QDropEvent *event) override;
 
 private:
+  QTimer m_renderTimer;
+
   QPixmap m_pixmap;
   QJSEngine m_engine;
   QSyntaxStyle m_style;
   QCodeEditor m_widget;
   QJSValue m_parseFunction;
+  QHash<QByteArray, QJSValue> m_functionCache;
 };
 } // namespace JSON
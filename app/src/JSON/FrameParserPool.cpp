@@ -0,0 +1,214 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <QSemaphore>
+#include <QApplication>
+#include <QCryptographicHash>
+
+#include "JSON/FrameParserPool.h"
+#include "JSON/ScriptHelpers.h"
+#include "JSON/DatasetHistory.h"
+#include "Misc/ThreadAffinity.h"
+
+/**
+ * @brief Constructs a parser worker and configures its private engine.
+ */
+JSON::ParserWorker::ParserWorker(QObject *parent)
+  : QObject(parent)
+  , m_engine(this)
+{
+  m_engine.installExtensions(QJSEngine::AllExtensions);
+  ScriptHelpers::install(m_engine);
+  DatasetHistory::install(m_engine);
+}
+
+/**
+ * @brief Executes the worker's parse function over the input data.
+ *
+ * Must only be called from the worker's own thread; the pool guarantees this
+ * by dispatching work through queued invocations.
+ *
+ * @param frame current/latest frame data.
+ * @return An array of strings with the values returned by the JS parser, or
+ *         an empty list when no valid script is loaded.
+ */
+QStringList JSON::ParserWorker::parse(const QString &frame)
+{
+  if (!m_parseFunction.isCallable())
+    return QStringList();
+
+  QJSValueList args;
+  args << frame;
+
+  const auto out = m_parseFunction.call(args).toVariant().toStringList();
+
+  QStringList list;
+  for (auto i = 0; i < out.count(); ++i)
+    list.append(out.at(i));
+
+  return list;
+}
+
+/**
+ * @brief Evaluates the user script on the worker's private engine.
+ *
+ * Validation and user-facing error reporting already happened on the editor
+ * engine (see JSON::FrameParser::loadScript()), so this only mirrors the
+ * accepted script into the worker. Compiled parse functions are cached by
+ * content hash, so switching back to a script this worker has already seen
+ * skips re-evaluation.
+ *
+ * @param script JavaScript code containing the 'parse' function.
+ */
+void JSON::ParserWorker::setScript(const QString &script)
+{
+  // Reuse the compiled function when the script was already evaluated
+  const auto hash = QCryptographicHash::hash(script.toUtf8(),
+                                             QCryptographicHash::Sha256);
+  const auto cached = m_functionCache.constFind(hash);
+  if (cached != m_functionCache.constEnd())
+  {
+    m_parseFunction = cached.value();
+    return;
+  }
+
+  // Evaluate the script & register the compiled function in the cache
+  QStringList errors;
+  m_engine.evaluate(script, "", 1, &errors);
+  m_parseFunction = m_engine.globalObject().property("parse");
+  if (m_parseFunction.isCallable())
+    m_functionCache.insert(hash, m_parseFunction);
+}
+
+/**
+ * @brief Constructs the pool and spawns one engine thread per worker.
+ */
+JSON::FrameParserPool::FrameParserPool()
+  : m_scriptLoaded(false)
+{
+  const int count = qBound(1, QThread::idealThreadCount() - 2, 8);
+  for (int i = 0; i < count; ++i)
+  {
+    auto *thread = new QThread(this);
+    auto *worker = new ParserWorker();
+    worker->moveToThread(thread);
+    connect(thread, &QThread::finished, worker, &QObject::deleteLater);
+    thread->start();
+    Misc::ThreadAffinity::apply(thread, QStringLiteral("parser"));
+
+    m_threads.append(thread);
+    m_workers.append(worker);
+  }
+
+  // Stop the worker threads before the application quits
+  connect(qApp, &QApplication::aboutToQuit, this, [=] {
+    for (auto *thread : std::as_const(m_threads))
+    {
+      thread->quit();
+      if (!thread->wait(100))
+        thread->terminate();
+    }
+  });
+}
+
+/**
+ * @brief Retrieves the singleton instance of the pool.
+ */
+JSON::FrameParserPool &JSON::FrameParserPool::instance()
+{
+  static FrameParserPool singleton;
+  return singleton;
+}
+
+/**
+ * @brief Returns the number of parser workers in the pool.
+ */
+int JSON::FrameParserPool::workerCount() const
+{
+  return m_workers.count();
+}
+
+/**
+ * @brief Returns @c true once a user script has been broadcast to the pool.
+ */
+bool JSON::FrameParserPool::scriptLoaded() const
+{
+  return m_scriptLoaded.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Parses a batch of frames concurrently across the worker engines.
+ *
+ * Frames are assigned round-robin (worker k processes frames k, k + N, ...),
+ * each worker writes its results directly into the slots of the shared output
+ * vector that correspond to its input indices, and the call returns once
+ * every worker has drained its share. The output is therefore already in
+ * submission order and needs no further re-sequencing.
+ *
+ * @param frames Decoded frame strings to parse.
+ * @return One field list per input frame, in input order.
+ */
+QVector<QStringList> JSON::FrameParserPool::parse(const QVector<QString> &frames)
+{
+  QVector<QStringList> results(frames.count());
+  if (frames.isEmpty() || !scriptLoaded())
+    return results;
+
+  // Scatter the batch round-robin over the workers
+  QSemaphore done;
+  const int count = m_workers.count();
+  const int active = qMin<int>(count, frames.count());
+  for (int w = 0; w < active; ++w)
+  {
+    auto *worker = m_workers.at(w);
+    QMetaObject::invokeMethod(
+        worker,
+        [&, worker, w] {
+          for (qsizetype i = w; i < frames.count(); i += count)
+            results[i] = worker->parse(frames.at(i));
+
+          done.release();
+        },
+        Qt::QueuedConnection);
+  }
+
+  // Gather: wait until every worker drained its share
+  done.acquire(active);
+  return results;
+}
+
+/**
+ * @brief Broadcasts the user script to every worker engine.
+ *
+ * Each worker re-evaluates the script on its own thread; because per-worker
+ * invocations are queued in order, any parse batch dispatched afterwards is
+ * guaranteed to run against the new script.
+ *
+ * @param script JavaScript code containing the 'parse' function.
+ */
+void JSON::FrameParserPool::setScript(const QString &script)
+{
+  for (auto *worker : std::as_const(m_workers))
+    QMetaObject::invokeMethod(
+        worker, [=] { worker->setScript(script); }, Qt::QueuedConnection);
+
+  m_scriptLoaded.store(!script.isEmpty(), std::memory_order_release);
+}
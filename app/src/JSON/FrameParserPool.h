@@ -0,0 +1,98 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QHash>
+#include <QThread>
+#include <QObject>
+#include <QVector>
+#include <QJSValue>
+#include <QJSEngine>
+#include <QStringList>
+
+namespace JSON
+{
+/**
+ * @brief Worker that owns a private QJSEngine for frame parsing.
+ *
+ * Each worker lives on its own thread and evaluates the same user script as
+ * the editor engine, so parse calls dispatched to different workers run
+ * concurrently without sharing any JavaScript state.
+ */
+class ParserWorker : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit ParserWorker(QObject *parent = nullptr);
+
+  [[nodiscard]] QStringList parse(const QString &frame);
+
+public slots:
+  void setScript(const QString &script);
+
+private:
+  QJSEngine m_engine;
+  QJSValue m_parseFunction;
+  QHash<QByteArray, QJSValue> m_functionCache;
+};
+
+/**
+ * @brief Pool of frame parser workers with per-thread script engines.
+ *
+ * QJSEngine is single-threaded, so a lone engine caps frame parsing at what
+ * one core can evaluate. The pool keeps one engine per worker thread, all
+ * loaded with the same user script, and scatters frame batches over them
+ * round-robin. Results are written into an index-addressed output vector, so
+ * they come back re-sequenced in submission order regardless of which worker
+ * finished first.
+ */
+class FrameParserPool : public QObject
+{
+  Q_OBJECT
+
+private:
+  explicit FrameParserPool();
+  FrameParserPool(FrameParserPool &&) = delete;
+  FrameParserPool(const FrameParserPool &) = delete;
+  FrameParserPool &operator=(FrameParserPool &&) = delete;
+  FrameParserPool &operator=(const FrameParserPool &) = delete;
+
+public:
+  static FrameParserPool &instance();
+
+  [[nodiscard]] int workerCount() const;
+  [[nodiscard]] bool scriptLoaded() const;
+
+  [[nodiscard]] QVector<QStringList> parse(const QVector<QString> &frames);
+
+public slots:
+  void setScript(const QString &script);
+
+private:
+  std::atomic_bool m_scriptLoaded;
+  QVector<QThread *> m_threads;
+  QVector<ParserWorker *> m_workers;
+};
+} // namespace JSON
@@ -55,6 +55,7 @@ namespace JSON
  * - Widget
  * - A vector of datasets
  */
+class Frame;
 class FrameBuilder;
 class Group
 {
@@ -78,6 +79,7 @@ private:
   QString m_widget;
   QVector<JSON::Dataset> m_datasets;
 
+  friend class JSON::Frame;
   friend class UI::Dashboard;
   friend class JSON::ProjectModel;
   friend class JSON::FrameBuilder;
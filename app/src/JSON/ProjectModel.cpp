@@ -61,6 +61,8 @@ typedef enum
   kProjectView_FrameEndSequence,    /**< Represents the frame end sequence. */
   kProjectView_FrameDecoder,        /**< Represents the frame decoder item. */
   kProjectView_FrameDetection,      /**< Represents the frame detection item. */
+  kProjectView_FrameFilter,         /**< Represents the frame filter rules. */
+  kProjectView_FrameLength,         /**< Represents the fixed frame length. */
   kProjectView_ThunderforestApiKey, /**< Represents the Thunderforest API key. */
   kProjectView_MapTilerApiKey       /**< Represents the MapTiler API key. */
 } ProjectItem;
@@ -138,14 +140,19 @@ static quint16 TILE_SERVER_PORT = 2701;
  */
 JSON::ProjectModel::ProjectModel()
   : m_title("")
+  , m_frameFilter("")
   , m_frameParserCode("")
   , m_frameEndSequence("")
   , m_frameStartSequence("")
+  , m_frameLength(64)
   , m_currentView(ProjectView)
   , m_frameDecoder(SerialStudio::PlainText)
   , m_frameDetection(SerialStudio::EndDelimiterOnly)
   , m_modified(false)
+  , m_bulkEditDepth(0)
+  , m_bulkTreeRebuildPending(false)
   , m_filePath("")
+  , m_pendingMapRegistration("")
   , m_treeModel(nullptr)
   , m_selectionModel(nullptr)
   , m_groupModel(nullptr)
@@ -218,6 +225,26 @@ bool JSON::ProjectModel::modified() const
   return m_modified || parserModified;
 }
 
+/**
+ * @brief Checks if an undo snapshot is available.
+ *
+ * @return True if calling @c undo() would restore a previous project state.
+ */
+bool JSON::ProjectModel::canUndo() const
+{
+  return !m_undoStack.isEmpty();
+}
+
+/**
+ * @brief Checks if a redo snapshot is available.
+ *
+ * @return True if calling @c redo() would re-apply an undone change.
+ */
+bool JSON::ProjectModel::canRedo() const
+{
+  return !m_redoStack.isEmpty();
+}
+
 /**
  * @brief Retrieves the current view of the project.
  *
@@ -313,6 +340,33 @@ QString JSON::ProjectModel::osmAddress() const
   return QStringLiteral("http://localhost:%1").arg(m_server.serverPort());
 }
 
+/**
+ * @brief Retrieves the persistent disk cache path for OSM map tiles.
+ *
+ * Returns the directory where the map engine keeps its LRU tile cache,
+ * creating it if it does not exist. Keeping the cache in the application
+ * cache location (instead of the default shared QtLocation directory) makes
+ * downloaded tiles survive application restarts, so panning & zooming over
+ * previously visited areas works from local storage even without network
+ * connectivity.
+ *
+ * @return The directory used for the persistent tile cache.
+ */
+QString JSON::ProjectModel::osmCachePath() const
+{
+  // Get file name and path
+  static QString path = QString("%1/osm-tiles/")
+                            .arg(QStandardPaths::writableLocation(
+                                QStandardPaths::CacheLocation));
+
+  // Generate file path if required
+  QDir dir(path);
+  if (!dir.exists())
+    dir.mkpath(".");
+
+  return path;
+}
+
 /**
  * @brief Retrieves the currently selected item's text.
  *
@@ -396,6 +450,32 @@ const QString &JSON::ProjectModel::title() const
   return m_title;
 }
 
+/**
+ * @brief Retrieves the pre-parse frame filter rules.
+ *
+ * The rules are a comma-separated list of byte prefixes evaluated on raw
+ * frames before the parse stage, see IO::FrameReader::setFrameFilter().
+ *
+ * @return A reference to the frame filter rules.
+ */
+const QString &JSON::ProjectModel::frameFilter() const
+{
+  return m_frameFilter;
+}
+
+/**
+ * @brief Retrieves the frame length used in fixed-length detection mode.
+ *
+ * The length covers the frame payload only; an optional start sequence acts
+ * as the sync pattern and is not counted.
+ *
+ * @return The fixed frame length in bytes.
+ */
+int JSON::ProjectModel::frameLength() const
+{
+  return m_frameLength;
+}
+
 /**
  * @brief Retrieves the current icon of the selected action.
  */
@@ -807,6 +887,8 @@ bool JSON::ProjectModel::saveJsonFile(const bool askPath)
   json.insert("title", m_title);
   json.insert("decoder", m_frameDecoder);
   json.insert("frameEnd", m_frameEndSequence);
+  json.insert("frameFilter", m_frameFilter);
+  json.insert("frameLength", m_frameLength);
   json.insert("frameParser", m_frameParserCode);
   json.insert("frameDetection", m_frameDetection);
   json.insert("frameStart", m_frameStartSequence);
@@ -836,9 +918,17 @@ bool JSON::ProjectModel::saveJsonFile(const bool askPath)
   // Ask user to switch to project mode
   enableProjectMode();
 
-  // Load JSON file to Serial Studio
+  // Load JSON file to Serial Studio. When the file path did not change,
+  // openJsonFile() skips the frame builder registration, so reload the map
+  // explicitly to pick up the new file contents; the pending marker stops
+  // the resulting jsonFileMapChanged() from re-parsing the project again
   openJsonFile(file.fileName());
-  JSON::FrameBuilder::instance().loadJsonMap(file.fileName());
+  if (JSON::FrameBuilder::instance().jsonMapFilepath() == file.fileName())
+  {
+    m_pendingMapRegistration = file.fileName();
+    JSON::FrameBuilder::instance().loadJsonMap(file.fileName());
+  }
+
   return true;
 }
 
@@ -911,6 +1001,8 @@ void JSON::ProjectModel::newJsonFile()
   m_frameDecoder = SerialStudio::PlainText;
   m_frameDetection = SerialStudio::EndDelimiterOnly;
   m_frameEndSequence = "\\n";
+  m_frameFilter = "";
+  m_frameLength = 64;
   m_mapTilerApiKey = "";
   m_thunderforestApiKey = "";
   m_frameStartSequence = "$";
@@ -924,6 +1016,11 @@ void JSON::ProjectModel::newJsonFile()
   // Update file path
   m_filePath = "";
 
+  // Clear the undo history
+  m_undoStack.clear();
+  m_redoStack.clear();
+  Q_EMIT undoStateChanged();
+
   // Update the models
   buildTreeModel();
   buildProjectModel();
@@ -935,6 +1032,8 @@ void JSON::ProjectModel::newJsonFile()
   Q_EMIT titleChanged();
   Q_EMIT jsonFileChanged();
   Q_EMIT gpsApiKeysChanged();
+  Q_EMIT frameFilterChanged();
+  Q_EMIT frameLengthChanged();
   Q_EMIT frameDetectionChanged();
   Q_EMIT frameParserCodeChanged();
 
@@ -1000,7 +1099,8 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
   if (document.isEmpty())
     return;
 
-  // Reset C++ model
+  // Reset C++ model, deferring tree rebuilds until the project is loaded
+  beginBulkEdit();
   newJsonFile();
 
   // Update current JSON document
@@ -1010,6 +1110,8 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
   auto json = document.object();
   m_title = json.value("title").toString();
   m_frameEndSequence = json.value("frameEnd").toString();
+  m_frameFilter = json.value("frameFilter").toString();
+  m_frameLength = json.value("frameLength").toInt(64);
   m_frameParserCode = json.value("frameParser").toString();
   m_frameStartSequence = json.value("frameStart").toString();
   m_mapTilerApiKey = json.value("mapTilerApiKey").toString();
@@ -1041,9 +1143,10 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
       m_actions.append(action);
   }
 
-  // Regenerate the tree model
+  // Regenerate the tree model once for the whole load
   buildProjectModel();
   buildTreeModel();
+  commitBulkEdit();
 
   // Show project view
   setCurrentView(ProjectView);
@@ -1089,14 +1192,21 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
     }
   }
 
-  // Let the generator use the given JSON file
+  // Let the generator use the given JSON file. The project was already
+  // registered by this method, so mark the load to stop the resulting
+  // jsonFileMapChanged() signal from re-parsing the same file
   if (JSON::FrameBuilder::instance().jsonMapFilepath() != path)
+  {
+    m_pendingMapRegistration = path;
     JSON::FrameBuilder::instance().loadJsonMap(path);
+  }
 
   // Update UI
   Q_EMIT titleChanged();
   Q_EMIT jsonFileChanged();
   Q_EMIT gpsApiKeysChanged();
+  Q_EMIT frameFilterChanged();
+  Q_EMIT frameLengthChanged();
   Q_EMIT frameDetectionChanged();
   Q_EMIT frameParserCodeChanged();
 }
@@ -1150,6 +1260,9 @@ void JSON::ProjectModel::deleteCurrentGroup()
   if (ret != QMessageBox::Yes)
     return;
 
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Delete the group
   m_groups.removeAt(m_selectedGroup.groupId());
 
@@ -1191,6 +1304,9 @@ void JSON::ProjectModel::deleteCurrentAction()
   if (ret != QMessageBox::Yes)
     return;
 
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Delete the action
   m_actions.removeAt(m_selectedAction.actionId());
 
@@ -1230,6 +1346,9 @@ void JSON::ProjectModel::deleteCurrentDataset()
   if (ret != QMessageBox::Yes)
     return;
 
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Get group ID & dataset ID
   const auto groupId = m_selectedDataset.groupId();
   const auto datasetId = m_selectedDataset.datasetId();
@@ -1269,6 +1388,9 @@ void JSON::ProjectModel::deleteCurrentDataset()
  */
 void JSON::ProjectModel::duplicateCurrentGroup()
 {
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Initialize a new group
   auto group = JSON::Group(m_groups.count());
   group.m_widget = m_selectedGroup.widget();
@@ -1278,11 +1400,12 @@ void JSON::ProjectModel::duplicateCurrentGroup()
     auto dataset = m_selectedGroup.m_datasets.at(i);
     dataset.m_groupId = group.groupId();
     dataset.m_index = nextDatasetIndex() + i;
-    group.m_datasets.append(dataset);
+    group.m_datasets.append(std::move(dataset));
   }
 
   // Register the group
-  m_groups.append(group);
+  const auto groupId = group.groupId();
+  m_groups.append(std::move(group));
 
   // Build tree model & set modification flag
   buildTreeModel();
@@ -1291,7 +1414,7 @@ void JSON::ProjectModel::duplicateCurrentGroup()
   // Select the group
   for (auto i = m_groupItems.constBegin(); i != m_groupItems.constEnd(); ++i)
   {
-    if (i.value().groupId() == group.groupId())
+    if (i.value().groupId() == groupId)
     {
       m_selectionModel->setCurrentIndex(i.key()->index(),
                                         QItemSelectionModel::ClearAndSelect);
@@ -1309,6 +1432,9 @@ void JSON::ProjectModel::duplicateCurrentGroup()
  */
 void JSON::ProjectModel::duplicateCurrentAction()
 {
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Initialize a new group
   auto action = JSON::Action(m_actions.count());
   action.m_title = tr("%1 (Copy)").arg(m_selectedAction.title());
@@ -1317,7 +1443,8 @@ void JSON::ProjectModel::duplicateCurrentAction()
   action.m_icon = m_selectedAction.icon();
 
   // Register the group
-  m_actions.append(action);
+  const auto actionId = action.actionId();
+  m_actions.append(std::move(action));
 
   // Build tree model & set modification flag
   buildTreeModel();
@@ -1326,7 +1453,7 @@ void JSON::ProjectModel::duplicateCurrentAction()
   // Select the action
   for (auto i = m_actionItems.constBegin(); i != m_actionItems.constEnd(); ++i)
   {
-    if (i.value().actionId() == action.actionId())
+    if (i.value().actionId() == actionId)
     {
       m_selectionModel->setCurrentIndex(i.key()->index(),
                                         QItemSelectionModel::ClearAndSelect);
@@ -1345,6 +1472,9 @@ void JSON::ProjectModel::duplicateCurrentAction()
  */
 void JSON::ProjectModel::duplicateCurrentDataset()
 {
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Initialize a new dataset
   auto dataset = m_selectedDataset;
   dataset.m_title = tr("%1 (Copy)").arg(dataset.title());
@@ -1352,7 +1482,9 @@ void JSON::ProjectModel::duplicateCurrentDataset()
   dataset.m_datasetId = m_groups[dataset.groupId()].datasetCount();
 
   // Register the dataset to the group
-  m_groups[dataset.groupId()].m_datasets.append(dataset);
+  const auto groupId = dataset.groupId();
+  const auto datasetId = dataset.datasetId();
+  m_groups[groupId].m_datasets.append(std::move(dataset));
 
   // Build tree model & set modification flag
   buildTreeModel();
@@ -1361,8 +1493,7 @@ void JSON::ProjectModel::duplicateCurrentDataset()
   // Select dataset
   for (auto i = m_datasetItems.begin(); i != m_datasetItems.end(); ++i)
   {
-    if (i.value().groupId() == dataset.groupId()
-        && i.value().datasetId() == dataset.datasetId())
+    if (i.value().groupId() == groupId && i.value().datasetId() == datasetId)
     {
       m_selectionModel->setCurrentIndex(i.key()->index(),
                                         QItemSelectionModel::ClearAndSelect);
@@ -1384,6 +1515,9 @@ void JSON::ProjectModel::duplicateCurrentDataset()
  */
 void JSON::ProjectModel::addDataset(const SerialStudio::DatasetOption option)
 {
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Initialize a new dataset
   const auto groupId = m_selectedGroup.groupId();
   JSON::Dataset dataset(groupId);
@@ -1460,7 +1594,8 @@ void JSON::ProjectModel::addDataset(const SerialStudio::DatasetOption option)
   dataset.m_datasetId = m_groups[groupId].m_datasets.count();
 
   // Add dataset to group
-  m_groups[groupId].m_datasets.append(dataset);
+  const auto datasetId = dataset.m_datasetId;
+  m_groups[groupId].m_datasets.append(std::move(dataset));
 
   // Build tree model & set modification flag
   buildTreeModel();
@@ -1469,8 +1604,7 @@ void JSON::ProjectModel::addDataset(const SerialStudio::DatasetOption option)
   // Select newly added dataset item
   for (auto i = m_datasetItems.begin(); i != m_datasetItems.end(); ++i)
   {
-    if (i.value().datasetId() == dataset.datasetId()
-        && i.value().groupId() == dataset.groupId())
+    if (i.value().datasetId() == datasetId && i.value().groupId() == groupId)
     {
       m_selectionModel->setCurrentIndex(i.key()->index(),
                                         QItemSelectionModel::ClearAndSelect);
@@ -1494,6 +1628,9 @@ void JSON::ProjectModel::addDataset(const SerialStudio::DatasetOption option)
 void JSON::ProjectModel::changeDatasetOption(
     const SerialStudio::DatasetOption option, const bool checked)
 {
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Modify dataset options
   switch (option)
   {
@@ -1550,6 +1687,9 @@ void JSON::ProjectModel::changeDatasetOption(
  */
 void JSON::ProjectModel::addAction()
 {
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Check if any existing group has the same title
   int count = 1;
   QString title = tr("New Action");
@@ -1586,7 +1726,8 @@ void JSON::ProjectModel::addAction()
   action.m_title = title;
 
   // Register the action
-  m_actions.append(action);
+  const auto actionId = action.actionId();
+  m_actions.append(std::move(action));
 
   // Update the user interface
   buildTreeModel();
@@ -1595,7 +1736,7 @@ void JSON::ProjectModel::addAction()
   // Select action
   for (auto i = m_actionItems.constBegin(); i != m_actionItems.constEnd(); ++i)
   {
-    if (i.value().actionId() == action.actionId())
+    if (i.value().actionId() == actionId)
     {
       m_selectionModel->setCurrentIndex(i.key()->index(),
                                         QItemSelectionModel::ClearAndSelect);
@@ -1618,6 +1759,9 @@ void JSON::ProjectModel::addAction()
 void JSON::ProjectModel::addGroup(const QString &title,
                                   const SerialStudio::GroupWidget widget)
 {
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Check if any existing group has the same title
   int count = 1;
   QString newTitle = title;
@@ -1654,7 +1798,8 @@ void JSON::ProjectModel::addGroup(const QString &title,
   group.m_title = newTitle;
 
   // Register the group & add the widget
-  m_groups.append(group);
+  const auto groupId = group.groupId();
+  m_groups.append(std::move(group));
   setGroupWidget(m_groups.count() - 1, widget);
 
   // Update the user interface
@@ -1664,7 +1809,7 @@ void JSON::ProjectModel::addGroup(const QString &title,
   // Select group
   for (auto i = m_groupItems.constBegin(); i != m_groupItems.constEnd(); ++i)
   {
-    if (i.value().groupId() == group.groupId())
+    if (i.value().groupId() == groupId)
     {
       m_selectionModel->setCurrentIndex(i.key()->index(),
                                         QItemSelectionModel::ClearAndSelect);
@@ -1772,9 +1917,9 @@ bool JSON::ProjectModel::setGroupWidget(const int group,
     z.m_title = tr("Accelerometer %1").arg("Z");
 
     // Add datasets to group
-    grp.m_datasets.append(x);
-    grp.m_datasets.append(y);
-    grp.m_datasets.append(z);
+    grp.m_datasets.append(std::move(x));
+    grp.m_datasets.append(std::move(y));
+    grp.m_datasets.append(std::move(z));
   }
 
   // Gyroscope widget
@@ -1818,9 +1963,9 @@ bool JSON::ProjectModel::setGroupWidget(const int group,
     z.m_title = tr("Gyro %1").arg("Z");
 
     // Add datasets to group
-    grp.m_datasets.append(x);
-    grp.m_datasets.append(y);
-    grp.m_datasets.append(z);
+    grp.m_datasets.append(std::move(x));
+    grp.m_datasets.append(std::move(y));
+    grp.m_datasets.append(std::move(z));
   }
 
   // Map widget
@@ -1861,9 +2006,9 @@ bool JSON::ProjectModel::setGroupWidget(const int group,
     alt.m_title = tr("Altitude");
 
     // Add datasets to group
-    grp.m_datasets.append(lat);
-    grp.m_datasets.append(lon);
-    grp.m_datasets.append(alt);
+    grp.m_datasets.append(std::move(lat));
+    grp.m_datasets.append(std::move(lon));
+    grp.m_datasets.append(std::move(alt));
   }
 
   // 3D plot widget
@@ -1899,13 +2044,13 @@ bool JSON::ProjectModel::setGroupWidget(const int group,
     z.m_title = tr("Z");
 
     // Add datasets to group
-    grp.m_datasets.append(x);
-    grp.m_datasets.append(y);
-    grp.m_datasets.append(z);
+    grp.m_datasets.append(std::move(x));
+    grp.m_datasets.append(std::move(y));
+    grp.m_datasets.append(std::move(z));
   }
 
   // Replace previous group with new group
-  m_groups.replace(group, grp);
+  m_groups.replace(group, std::move(grp));
 
   // Update UI
   return true;
@@ -1928,6 +2073,9 @@ void JSON::ProjectModel::setFrameParserCode(const QString &code)
 {
   if (code != m_frameParserCode)
   {
+    // Record pre-edit state for undo
+    pushUndoSnapshot();
+
     m_frameParserCode = code;
     setModified(true);
 
@@ -1954,10 +2102,201 @@ void JSON::ProjectModel::displayFrameParserView()
   }
 }
 
+//------------------------------------------------------------------------------
+// Transactional batch edits
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Starts a transactional batch edit of the project.
+ *
+ * While a batch edit is active, calls to @c buildTreeModel() are deferred
+ * instead of rebuilding the tree immediately, so bulk mutations (loading a
+ * project, pasting many datasets, re-indexing groups) trigger a single model
+ * reset when the transaction is committed instead of one rebuild per item.
+ *
+ * Calls can be nested; only the outermost @c commitBulkEdit() performs the
+ * deferred rebuild.
+ */
+void JSON::ProjectModel::beginBulkEdit()
+{
+  ++m_bulkEditDepth;
+}
+
+/**
+ * @brief Commits a transactional batch edit of the project.
+ *
+ * Closes the transaction opened by @c beginBulkEdit(). When the outermost
+ * transaction is committed and a tree rebuild was requested during the batch,
+ * the tree model is rebuilt exactly once.
+ */
+void JSON::ProjectModel::commitBulkEdit()
+{
+  if (m_bulkEditDepth <= 0)
+    return;
+
+  --m_bulkEditDepth;
+  if (m_bulkEditDepth == 0 && m_bulkTreeRebuildPending)
+  {
+    m_bulkTreeRebuildPending = false;
+    buildTreeModel();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Undo/redo snapshots
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Captures the current editable project state.
+ *
+ * The returned snapshot shares its group, dataset & action data with the live
+ * project through Qt's implicit sharing, so capturing is a constant-time
+ * operation regardless of project size. The shared payload is only detached
+ * (and only along the edited path) when a subsequent edit mutates it.
+ *
+ * @return A snapshot of the current project state.
+ */
+JSON::ProjectModel::Snapshot JSON::ProjectModel::captureSnapshot() const
+{
+  Snapshot snapshot;
+  snapshot.title = m_title;
+  snapshot.frameFilter = m_frameFilter;
+  snapshot.frameParserCode = m_frameParserCode;
+  snapshot.frameEndSequence = m_frameEndSequence;
+  snapshot.frameStartSequence = m_frameStartSequence;
+  snapshot.mapTilerApiKey = m_mapTilerApiKey;
+  snapshot.thunderforestApiKey = m_thunderforestApiKey;
+  snapshot.frameLength = m_frameLength;
+  snapshot.frameDecoder = m_frameDecoder;
+  snapshot.frameDetection = m_frameDetection;
+  snapshot.groups = m_groups;
+  snapshot.actions = m_actions;
+  return snapshot;
+}
+
+/**
+ * @brief Records the current project state on the undo stack.
+ *
+ * This function is called at the start of every user-visible mutation. It
+ * clears the redo stack (the edit forks history), pushes a snapshot of the
+ * pre-edit state and caps the stack at a fixed depth.
+ */
+void JSON::ProjectModel::pushUndoSnapshot()
+{
+  constexpr int maxSnapshots = 100;
+
+  m_redoStack.clear();
+  m_undoStack.append(captureSnapshot());
+  while (m_undoStack.count() > maxSnapshots)
+    m_undoStack.removeFirst();
+
+  Q_EMIT undoStateChanged();
+}
+
+/**
+ * @brief Restores the project state from the given snapshot.
+ *
+ * Replaces the editable project members with the snapshot data, regenerates
+ * the project & tree models once, re-selects the project root item and
+ * notifies the UI about every property that may have changed.
+ *
+ * @param snapshot The snapshot to restore.
+ */
+void JSON::ProjectModel::restoreSnapshot(const Snapshot &snapshot)
+{
+  // Restore the editable project state
+  m_title = snapshot.title;
+  m_frameFilter = snapshot.frameFilter;
+  m_frameParserCode = snapshot.frameParserCode;
+  m_frameEndSequence = snapshot.frameEndSequence;
+  m_frameStartSequence = snapshot.frameStartSequence;
+  m_mapTilerApiKey = snapshot.mapTilerApiKey;
+  m_thunderforestApiKey = snapshot.thunderforestApiKey;
+  m_frameLength = snapshot.frameLength;
+  m_frameDecoder = snapshot.frameDecoder;
+  m_frameDetection = snapshot.frameDetection;
+  m_groups = snapshot.groups;
+  m_actions = snapshot.actions;
+
+  // Regenerate the models once
+  buildProjectModel();
+  buildTreeModel();
+
+  // Reload frame parser code into the code editor
+  if (JSON::FrameBuilder::instance().frameParser())
+    JSON::FrameBuilder::instance().frameParser()->readCode();
+
+  // Select project item
+  const auto index = m_treeModel->index(0, 0);
+  m_selectionModel->setCurrentIndex(index, QItemSelectionModel::ClearAndSelect);
+
+  // Update the user interface
+  setModified(true);
+  Q_EMIT titleChanged();
+  Q_EMIT gpsApiKeysChanged();
+  Q_EMIT frameFilterChanged();
+  Q_EMIT frameLengthChanged();
+  Q_EMIT frameDetectionChanged();
+  Q_EMIT frameParserCodeChanged();
+}
+
+/**
+ * @brief Restores the project state prior to the last edit.
+ *
+ * Pushes the current state onto the redo stack, pops the most recent undo
+ * snapshot and restores it. Does nothing when the undo stack is empty.
+ */
+void JSON::ProjectModel::undo()
+{
+  if (m_undoStack.isEmpty())
+    return;
+
+  m_redoStack.append(captureSnapshot());
+  restoreSnapshot(m_undoStack.takeLast());
+  Q_EMIT undoStateChanged();
+}
+
+/**
+ * @brief Re-applies the last undone edit.
+ *
+ * Pushes the current state onto the undo stack, pops the most recent redo
+ * snapshot and restores it. Does nothing when the redo stack is empty.
+ */
+void JSON::ProjectModel::redo()
+{
+  if (m_redoStack.isEmpty())
+    return;
+
+  m_undoStack.append(captureSnapshot());
+  restoreSnapshot(m_redoStack.takeLast());
+  Q_EMIT undoStateChanged();
+}
+
 //------------------------------------------------------------------------------
 // Model generation code
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Returns the tree view icon path for the given group widget.
+ */
+static QString groupTreeIcon(const JSON::Group &group)
+{
+  if (group.widget() == "map")
+    return "qrc:/rcc/icons/project-editor/treeview/gps.svg";
+  else if (group.widget() == "accelerometer")
+    return "qrc:/rcc/icons/project-editor/treeview/accelerometer.svg";
+  else if (group.widget() == "gyro")
+    return "qrc:/rcc/icons/project-editor/treeview/gyroscope.svg";
+  else if (group.widget() == "multiplot")
+    return "qrc:/rcc/icons/project-editor/treeview/multiplot.svg";
+  else if (group.widget() == "datagrid")
+    return "qrc:/rcc/icons/project-editor/treeview/datagrid.svg";
+  else if (group.widget() == "plot3d")
+    return "qrc:/rcc/icons/project-editor/treeview/plot3d.svg";
+  else
+    return "qrc:/rcc/icons/project-editor/treeview/group.svg";
+}
+
 /**
  * @brief Builds the tree model that represents the hierarchical structure of
  *        the project.
@@ -1975,6 +2314,13 @@ void JSON::ProjectModel::displayFrameParserView()
  */
 void JSON::ProjectModel::buildTreeModel()
 {
+  // Defer the rebuild until the active batch edit is committed
+  if (m_bulkEditDepth > 0)
+  {
+    m_bulkTreeRebuildPending = true;
+    return;
+  }
+
   // Clear model/pointer maps
   m_rootItems.clear();
   m_groupItems.clear();
@@ -2036,7 +2382,7 @@ void JSON::ProjectModel::buildTreeModel()
   for (int aIndex = 0; aIndex < m_actions.size(); ++aIndex)
   {
     // Create action item
-    const auto action = m_actions[aIndex];
+    const auto &action = m_actions[aIndex];
     auto *actionItem = new QStandardItem(action.title());
 
     // Configure action item
@@ -2054,25 +2400,11 @@ void JSON::ProjectModel::buildTreeModel()
   for (int gIndex = 0; gIndex < m_groups.size(); ++gIndex)
   {
     // Create group item
-    const auto group = m_groups[gIndex];
+    const auto &group = m_groups[gIndex];
     auto *groupItem = new QStandardItem(group.title());
 
     // Decide which icon to use for the group
-    QString icon;
-    if (group.widget() == "map")
-      icon = "qrc:/rcc/icons/project-editor/treeview/gps.svg";
-    else if (group.widget() == "accelerometer")
-      icon = "qrc:/rcc/icons/project-editor/treeview/accelerometer.svg";
-    else if (group.widget() == "gyro")
-      icon = "qrc:/rcc/icons/project-editor/treeview/gyroscope.svg";
-    else if (group.widget() == "multiplot")
-      icon = "qrc:/rcc/icons/project-editor/treeview/multiplot.svg";
-    else if (group.widget() == "datagrid")
-      icon = "qrc:/rcc/icons/project-editor/treeview/datagrid.svg";
-    else if (group.widget() == "plot3d")
-      icon = "qrc:/rcc/icons/project-editor/treeview/plot3d.svg";
-    else
-      icon = "qrc:/rcc/icons/project-editor/treeview/group.svg";
+    const QString icon = groupTreeIcon(group);
 
     // Set metadata for the group item
     groupItem->setData(icon, TreeViewIcon);
@@ -2083,7 +2415,7 @@ void JSON::ProjectModel::buildTreeModel()
     for (int dIndex = 0; dIndex < group.datasets().size(); ++dIndex)
     {
       // Create dataset item
-      const auto dataset = group.datasets()[dIndex];
+      const auto &dataset = group.datasets()[dIndex];
       auto *datasetItem = new QStandardItem(dataset.title());
       const auto dIcon = "qrc:/rcc/icons/project-editor/treeview/dataset.svg";
       datasetItem->setData(dIcon, TreeViewIcon);
@@ -2117,6 +2449,88 @@ void JSON::ProjectModel::buildTreeModel()
   Q_EMIT treeModelChanged();
 }
 
+/**
+ * @brief Patches the tree item of a single group in place.
+ *
+ * Updates the title and icon of the existing QStandardItem for the given
+ * group instead of rebuilding the whole tree, which keeps editing responsive
+ * on projects with hundreds of datasets. Only the item text & metadata are
+ * touched; the selection model and expanded states are left untouched.
+ *
+ * @param group The group with the updated properties.
+ * @return @c true when the group item was found and patched, @c false when
+ *         the caller must fall back to a full tree rebuild.
+ */
+bool JSON::ProjectModel::patchGroupTreeItem(const JSON::Group &group)
+{
+  for (auto it = m_groupItems.begin(); it != m_groupItems.end(); ++it)
+  {
+    if (it.value().groupId() == group.groupId())
+    {
+      auto *item = it.key();
+      item->setText(group.title());
+      item->setData(group.title(), TreeViewText);
+      item->setData(groupTreeIcon(group), TreeViewIcon);
+      it.value() = group;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Patches the tree item of a single action in place.
+ *
+ * Same contract as patchGroupTreeItem(), but for action items.
+ *
+ * @param action The action with the updated properties.
+ * @return @c true when the action item was found and patched.
+ */
+bool JSON::ProjectModel::patchActionTreeItem(const JSON::Action &action)
+{
+  for (auto it = m_actionItems.begin(); it != m_actionItems.end(); ++it)
+  {
+    if (it.value().actionId() == action.actionId())
+    {
+      auto *item = it.key();
+      item->setText(action.title());
+      item->setData(action.title(), TreeViewText);
+      it.value() = action;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Patches the tree item of a single dataset in place.
+ *
+ * Same contract as patchGroupTreeItem(), but for dataset items.
+ *
+ * @param dataset The dataset with the updated properties.
+ * @return @c true when the dataset item was found and patched.
+ */
+bool JSON::ProjectModel::patchDatasetTreeItem(const JSON::Dataset &dataset)
+{
+  for (auto it = m_datasetItems.begin(); it != m_datasetItems.end(); ++it)
+  {
+    if (it.value().groupId() == dataset.groupId()
+        && it.value().datasetId() == dataset.datasetId())
+    {
+      auto *item = it.key();
+      item->setText(dataset.title());
+      item->setData(dataset.title(), TreeViewText);
+      item->setData(dataset.index(), TreeViewFrameIndex);
+      it.value() = dataset;
+      return true;
+    }
+  }
+
+  return false;
+}
+
 /**
  * @brief Builds the project model that contains project configuration
  * settings.
@@ -2184,9 +2598,29 @@ void JSON::ProjectModel::buildProjectModel()
       "qrc:/rcc/icons/project-editor/model/frame-detection.svg", ParameterIcon);
   m_projectModel->appendRow(frameDetection);
 
-  // Add frame start sequence
+  // Add fixed frame length
+  if (m_frameDetection == SerialStudio::FixedLength)
+  {
+    auto frameLength = new QStandardItem();
+    frameLength->setEditable(true);
+    frameLength->setData(IntField, WidgetType);
+    frameLength->setData(m_frameLength, EditableValue);
+    frameLength->setData(tr("Frame Length"), ParameterName);
+    frameLength->setData(kProjectView_FrameLength, ParameterType);
+    frameLength->setData(QStringLiteral("64"), PlaceholderValue);
+    frameLength->setData(tr("Constant frame size in bytes"),
+                         ParameterDescription);
+    frameLength->setData(
+        "qrc:/rcc/icons/project-editor/model/frame-detection.svg",
+        ParameterIcon);
+    m_projectModel->appendRow(frameLength);
+  }
+
+  // Add frame start sequence (doubles as the sync pattern in fixed-length
+  // mode, where it may be left empty for free-running streams)
   if (m_frameDetection == SerialStudio::StartAndEndDelimiter
-      || m_frameDetection == SerialStudio::StartDelimiterOnly)
+      || m_frameDetection == SerialStudio::StartDelimiterOnly
+      || m_frameDetection == SerialStudio::FixedLength)
   {
     auto frameStart = new QStandardItem();
     frameStart->setEditable(true);
@@ -2221,6 +2655,22 @@ void JSON::ProjectModel::buildProjectModel()
     m_projectModel->appendRow(frameEnd);
   }
 
+  // Add pre-parse frame filter rules
+  auto frameFilter = new QStandardItem();
+  frameFilter->setEditable(true);
+  frameFilter->setData(TextField, WidgetType);
+  frameFilter->setData(m_frameFilter, EditableValue);
+  frameFilter->setData(tr("Frame Filter"), ParameterName);
+  frameFilter->setData(kProjectView_FrameFilter, ParameterType);
+  frameFilter->setData(tr("None"), PlaceholderValue);
+  frameFilter->setData(tr("Byte prefixes of frames to keep or drop "
+                          "(comma-separated, \"!\" drops, \"0x\" for hex)"),
+                       ParameterDescription);
+  frameFilter->setData(
+      "qrc:/rcc/icons/project-editor/model/frame-detection.svg",
+      ParameterIcon);
+  m_projectModel->appendRow(frameFilter);
+
   // Add Thunderforest API Key
   auto thunderforest = new QStandardItem();
   thunderforest->setEditable(true);
@@ -2490,7 +2940,8 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
 
   // Get which optional parameters should be displayed
   const bool showWidget = currentDatasetIsEditable();
-  const bool showFFTOptions = dataset.fft();
+  const bool showFFTOptions
+      = dataset.fft() || dataset.widget() == QStringLiteral("spectrogram");
   const bool showLedOptions = dataset.led();
   const bool showMinMax = dataset.graph() || dataset.widget() == "gauge"
                           || dataset.widget() == "bar"
@@ -2645,7 +3096,7 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
   m_datasetModel->appendRow(led);
 
   // Add X-axis selector
-  if (dataset.graph())
+  if (dataset.graph() || dataset.widget() == QStringLiteral("scatter"))
   {
     // Ensure X-axis ID is reset to "Samples" when an invalid index is set
     int xAxisIdx = 0;
@@ -2795,13 +3246,22 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
 /**
  * @brief Reloads the project model when a new JSON file is loaded.
  *
- * This function checks if the current JSON file path differs from the one
- * loaded by `JSON::FrameBuilder`. If they differ, it opens the new JSON file
- * and reloads the project model.
+ * Loads initiated by this model (opening or saving a project) register every
+ * group & dataset before handing the file to `JSON::FrameBuilder`, so the
+ * echoed jsonFileMapChanged() signal is ignored for them instead of parsing
+ * the same file a second time. Loads initiated elsewhere (e.g. the setup
+ * panel's file selector) still reload the project model here.
  */
 void JSON::ProjectModel::onJsonLoaded()
 {
-  openJsonFile(JSON::FrameBuilder::instance().jsonMapFilepath());
+  const auto path = JSON::FrameBuilder::instance().jsonMapFilepath();
+  if (path == m_pendingMapRegistration)
+  {
+    m_pendingMapRegistration.clear();
+    return;
+  }
+
+  openJsonFile(path);
 }
 
 /**
@@ -2857,10 +3317,12 @@ void JSON::ProjectModel::generateComboBoxModels()
   m_frameDetectionMethods.append(tr("Start Delimiter Only"));
   m_frameDetectionMethods.append(tr("Start + End Delimiter"));
   m_frameDetectionMethods.append(tr("No Delimiters"));
+  m_frameDetectionMethods.append(tr("Fixed Length"));
   m_frameDetectionMethodsValues.append(SerialStudio::EndDelimiterOnly);
   m_frameDetectionMethodsValues.append(SerialStudio::StartDelimiterOnly);
   m_frameDetectionMethodsValues.append(SerialStudio::StartAndEndDelimiter);
   m_frameDetectionMethodsValues.append(SerialStudio::NoDelimiters);
+  m_frameDetectionMethodsValues.append(SerialStudio::FixedLength);
 
   // Initialize group-level widgets
   m_groupWidgets.clear();
@@ -2878,6 +3340,10 @@ void JSON::ProjectModel::generateComboBoxModels()
   m_datasetWidgets.insert(QStringLiteral("bar"), tr("Bar"));
   m_datasetWidgets.insert(QStringLiteral("gauge"), tr("Gauge"));
   m_datasetWidgets.insert(QStringLiteral("compass"), tr("Compass"));
+  m_datasetWidgets.insert(QStringLiteral("histogram"), tr("Histogram"));
+  m_datasetWidgets.insert(QStringLiteral("scatter"), tr("Scatter Plot"));
+  m_datasetWidgets.insert(QStringLiteral("spectrogram"), tr("Spectrogram"));
+  m_datasetWidgets.insert(QStringLiteral("image"), tr("Image Feed"));
 
   // Initialize EOL options
   m_eolSequences.clear();
@@ -2980,6 +3446,9 @@ void JSON::ProjectModel::onGroupItemChanged(QStandardItem *item)
   if (!item)
     return;
 
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Construct lists with key values for QMap-based comboboxes
   static QStringList widgets;
   if (widgets.isEmpty())
@@ -3042,12 +3511,18 @@ void JSON::ProjectModel::onGroupItemChanged(QStandardItem *item)
         }
       }
 
+      // Drop the snapshot pushed for the canceled edit
+      m_undoStack.removeLast();
+      Q_EMIT undoStateChanged();
       return;
     }
   }
 
-  // Re-build tree model
-  buildTreeModel();
+  // Update the tree: titles are patched in place, while widget changes may
+  // add or remove datasets & therefore require a full rebuild
+  if (id != kGroupView_Title || !patchGroupTreeItem(m_selectedGroup))
+    buildTreeModel();
+
   if (modified)
     setModified(true);
 
@@ -3074,6 +3549,9 @@ void JSON::ProjectModel::onActionItemChanged(QStandardItem *item)
   if (!item)
     return;
 
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Construct lists with key values for QMap-based comboboxes
   static QStringList eolSequences;
   if (eolSequences.isEmpty())
@@ -3108,10 +3586,11 @@ void JSON::ProjectModel::onActionItemChanged(QStandardItem *item)
       break;
   }
 
-  // Replace action data
+  // Replace action data & patch its tree item in place
   const auto actionId = m_selectedAction.actionId();
   m_actions.replace(actionId, m_selectedAction);
-  buildTreeModel();
+  if (!patchActionTreeItem(m_selectedAction))
+    buildTreeModel();
 
   // Mark document as modified
   setModified(true);
@@ -3136,6 +3615,9 @@ void JSON::ProjectModel::onProjectItemChanged(QStandardItem *item)
   if (!item)
     return;
 
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Obtain which item was modified & its new value
   const auto id = item->data(ParameterType);
   const auto value = item->data(EditableValue);
@@ -3161,6 +3643,14 @@ void JSON::ProjectModel::onProjectItemChanged(QStandardItem *item)
       Q_EMIT frameDetectionChanged();
       buildProjectModel();
       break;
+    case kProjectView_FrameFilter:
+      m_frameFilter = value.toString();
+      Q_EMIT frameFilterChanged();
+      break;
+    case kProjectView_FrameLength:
+      m_frameLength = qMax(1, value.toInt());
+      Q_EMIT frameLengthChanged();
+      break;
     case kProjectView_ThunderforestApiKey:
       m_thunderforestApiKey = value.toString();
       Q_EMIT gpsApiKeysChanged();
@@ -3195,6 +3685,9 @@ void JSON::ProjectModel::onDatasetItemChanged(QStandardItem *item)
   if (!item)
     return;
 
+  // Record pre-edit state for undo
+  pushUndoSnapshot();
+
   // Construct lists with key values for QMap-based comboboxes
   static QStringList widgets;
   static QList<QPair<bool, bool>> plotOptions;
@@ -3270,13 +3763,14 @@ void JSON::ProjectModel::onDatasetItemChanged(QStandardItem *item)
       break;
   }
 
-  // Replace dataset in parent group
+  // Replace dataset in parent group & patch its tree item in place
   const auto groupId = m_selectedDataset.groupId();
   const auto datasetId = m_selectedDataset.datasetId();
   auto group = m_groups.at(groupId);
   group.m_datasets.replace(datasetId, m_selectedDataset);
   m_groups.replace(groupId, group);
-  buildTreeModel();
+  if (!patchDatasetTreeItem(m_selectedDataset))
+    buildTreeModel();
 
   // Mark document as modified
   setModified(true);
@@ -135,6 +135,15 @@ class ProjectModel : public QObject
   Q_PROPERTY(QString osmAddress
              READ osmAddress
              CONSTANT)
+  Q_PROPERTY(QString osmCachePath
+             READ osmCachePath
+             CONSTANT)
+  Q_PROPERTY(bool canUndo
+             READ canUndo
+             NOTIFY undoStateChanged)
+  Q_PROPERTY(bool canRedo
+             READ canRedo
+             NOTIFY undoStateChanged)
   // clang-format on
 
 signals:
@@ -148,10 +157,13 @@ signals:
   void actionModelChanged();
   void projectModelChanged();
   void datasetModelChanged();
+  void frameFilterChanged();
+  void frameLengthChanged();
   void datasetOptionsChanged();
   void frameDetectionChanged();
   void editableOptionsChanged();
   void frameParserCodeChanged();
+  void undoStateChanged();
 
 private:
   explicit ProjectModel();
@@ -225,6 +237,7 @@ public:
   [[nodiscard]] QString jsonProjectsPath() const;
 
   [[nodiscard]] QString osmAddress() const;
+  [[nodiscard]] QString osmCachePath() const;
   [[nodiscard]] QString selectedText() const;
   [[nodiscard]] QString selectedIcon() const;
 
@@ -234,6 +247,7 @@ public:
   [[nodiscard]] const QStringList &availableActionIcons() const;
 
   [[nodiscard]] const QString &title() const;
+  [[nodiscard]] const QString &frameFilter() const;
   [[nodiscard]] const QString &jsonFilePath() const;
   [[nodiscard]] const QString &frameParserCode() const;
   [[nodiscard]] const QString &mapTilerApiKey() const;
@@ -244,6 +258,7 @@ public:
   [[nodiscard]] bool containsCommercialFeatures() const;
 
   [[nodiscard]] int groupCount() const;
+  [[nodiscard]] int frameLength() const;
   [[nodiscard]] int datasetCount() const;
   [[nodiscard]] quint8 datasetOptions() const;
   [[nodiscard]] const QVector<JSON::Group> &groups() const;
@@ -256,6 +271,9 @@ public:
   [[nodiscard]] CustomModel *projectModel() const;
   [[nodiscard]] CustomModel *datasetModel() const;
 
+  [[nodiscard]] bool canUndo() const;
+  [[nodiscard]] bool canRedo() const;
+
   Q_INVOKABLE bool askSave();
   Q_INVOKABLE bool saveJsonFile(const bool askPath = false);
 
@@ -289,12 +307,22 @@ public slots:
 
   void displayFrameParserView();
 
+  void undo();
+  void redo();
+
+  void beginBulkEdit();
+  void commitBulkEdit();
+
   void buildTreeModel();
   void buildProjectModel();
   void buildGroupModel(const JSON::Group &group);
   void buildActionModel(const JSON::Action &action);
   void buildDatasetModel(const JSON::Dataset &dataset);
 
+  bool patchGroupTreeItem(const JSON::Group &group);
+  bool patchActionTreeItem(const JSON::Action &action);
+  bool patchDatasetTreeItem(const JSON::Dataset &dataset);
+
 private slots:
   void onJsonLoaded();
   void onGpsApiKeysChanged();
@@ -308,6 +336,34 @@ private slots:
                                  const QModelIndex &previous);
 
 private:
+  /**
+   * @brief Implicitly-shared snapshot of the editable project state.
+   *
+   * The group, dataset & action containers are copy-on-write, so capturing a
+   * snapshot only bumps reference counts; a later edit detaches just the
+   * containers along the modified path. Undo memory & latency are therefore
+   * proportional to the number of changed nodes, not to project size.
+   */
+  struct Snapshot
+  {
+    QString title;
+    QString frameFilter;
+    QString frameParserCode;
+    QString frameEndSequence;
+    QString frameStartSequence;
+    QString mapTilerApiKey;
+    QString thunderforestApiKey;
+    int frameLength;
+    SerialStudio::DecoderMethod frameDecoder;
+    SerialStudio::FrameDetection frameDetection;
+    QVector<JSON::Group> groups;
+    QVector<JSON::Action> actions;
+  };
+
+  [[nodiscard]] Snapshot captureSnapshot() const;
+  void pushUndoSnapshot();
+  void restoreSnapshot(const Snapshot &snapshot);
+
   int nextDatasetIndex();
   void saveExpandedStateMap(QStandardItem *item, QHash<QString, bool> &map,
                             const QString &title);
@@ -316,6 +372,7 @@ private:
 
 private:
   QString m_title;
+  QString m_frameFilter;
   QString m_frameParserCode;
   QString m_frameEndSequence;
   QString m_frameStartSequence;
@@ -323,12 +380,16 @@ private:
   QString m_mapTilerApiKey;
   QString m_thunderforestApiKey;
 
+  int m_frameLength;
   CurrentView m_currentView;
   SerialStudio::DecoderMethod m_frameDecoder;
   SerialStudio::FrameDetection m_frameDetection;
 
   bool m_modified;
+  int m_bulkEditDepth;
+  bool m_bulkTreeRebuildPending;
   QString m_filePath;
+  QString m_pendingMapRegistration;
 
   QMap<QStandardItem *, int> m_rootItems;
   QMap<QStandardItem *, JSON::Group> m_groupItems;
@@ -338,6 +399,9 @@ private:
   QVector<JSON::Group> m_groups;
   QVector<JSON::Action> m_actions;
 
+  QVector<Snapshot> m_undoStack;
+  QVector<Snapshot> m_redoStack;
+
   CustomModel *m_treeModel;
   QItemSelectionModel *m_selectionModel;
 
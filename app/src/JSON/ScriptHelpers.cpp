@@ -0,0 +1,140 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "JSON/ScriptHelpers.h"
+
+#include "SIMD/SIMD.h"
+
+/**
+ * @brief Removes the separators commonly found in encoded device payloads.
+ *
+ * Devices frequently pretty-print encoded blobs with spaces, colons, commas
+ * or line breaks between groups; the decode kernels are strict, so the
+ * separators are stripped once up front instead of being special-cased per
+ * character inside the hot loops.
+ */
+static QByteArray stripSeparators(const QString &text)
+{
+  QByteArray ascii = text.toLatin1();
+
+  qsizetype out = 0;
+  for (qsizetype i = 0; i < ascii.size(); ++i)
+  {
+    const char c = ascii.at(i);
+    if (c == ' ' || c == ':' || c == ',' || c == '\t' || c == '\r'
+        || c == '\n')
+      continue;
+
+    ascii[out++] = c;
+  }
+
+  ascii.truncate(out);
+  return ascii;
+}
+
+/**
+ * @brief Constructs the helper object.
+ *
+ * @param parent The parent QObject (optional).
+ */
+JSON::ScriptHelpers::ScriptHelpers(QObject *parent)
+  : QObject(parent)
+{
+}
+
+/**
+ * @brief Installs the helpers as the global @c Codec object of an engine.
+ *
+ * The helper instance is owned by the engine's garbage collector, so every
+ * engine (the editor's validation engine and each pool worker) gets its own
+ * instance on its own thread.
+ *
+ * @param engine The JavaScript engine to extend.
+ */
+void JSON::ScriptHelpers::install(QJSEngine &engine)
+{
+  engine.globalObject().setProperty(QStringLiteral("Codec"),
+                                    engine.newQObject(new ScriptHelpers()));
+}
+
+/**
+ * @brief Decodes hexadecimal text into raw bytes.
+ *
+ * Separators (spaces, colons, commas, line breaks) are ignored, letter case
+ * is not significant. The returned QByteArray surfaces in JavaScript as an
+ * ArrayBuffer.
+ *
+ * @param text The hexadecimal text to decode.
+ * @return The decoded bytes, or an empty buffer when the input is malformed.
+ */
+QByteArray JSON::ScriptHelpers::hexDecode(const QString &text) const
+{
+  const QByteArray ascii = stripSeparators(text);
+
+  QByteArray bytes;
+  bytes.resize(ascii.size() / 2);
+  const auto decoded
+      = SIMD::hexDecode(ascii.constData(), ascii.size(), bytes.data());
+  if (decoded < 0)
+    return QByteArray();
+
+  bytes.truncate(decoded);
+  return bytes;
+}
+
+/**
+ * @brief Decodes base64 text into raw bytes.
+ *
+ * Separators (spaces, line breaks) are ignored and standard '=' padding is
+ * accepted. The returned QByteArray surfaces in JavaScript as an
+ * ArrayBuffer.
+ *
+ * @param text The base64 text to decode.
+ * @return The decoded bytes, or an empty buffer when the input is malformed.
+ */
+QByteArray JSON::ScriptHelpers::base64Decode(const QString &text) const
+{
+  const QByteArray ascii = stripSeparators(text);
+
+  QByteArray bytes;
+  bytes.resize((ascii.size() / 4) * 3);
+  const auto decoded
+      = SIMD::base64Decode(ascii.constData(), ascii.size(), bytes.data());
+  if (decoded < 0)
+    return QByteArray();
+
+  bytes.truncate(decoded);
+  return bytes;
+}
+
+/**
+ * @brief Encodes raw bytes as lowercase hexadecimal text.
+ *
+ * @param data The bytes to encode (an ArrayBuffer on the JavaScript side).
+ * @return The hexadecimal representation of the input.
+ */
+QString JSON::ScriptHelpers::hexEncode(const QByteArray &data) const
+{
+  QByteArray ascii;
+  ascii.resize(data.size() * 2);
+  SIMD::hexEncode(data.constData(), data.size(), ascii.data());
+  return QString::fromLatin1(ascii);
+}
@@ -0,0 +1,59 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QJSEngine>
+#include <QByteArray>
+
+namespace JSON
+{
+/**
+ * @class JSON::ScriptHelpers
+ * @brief Native codec helpers exposed to the frame parser scripts.
+ *
+ * Many devices ship binary sensor blobs base64- or hex-encoded inside text
+ * frames; decoding those at interpreter speed inside the user's JavaScript
+ * dominates the parse time for payloads of a few kilobytes. This object is
+ * installed as the global @c Codec property of every parser engine and
+ * forwards to the vectorized kernels in SIMD/SIMD.h, so scripts can call
+ * e.g. @c Codec.base64Decode(text) and receive an ArrayBuffer at native
+ * decode speed.
+ *
+ * The helpers are stateless and therefore safe to instantiate once per
+ * engine, including the per-thread engines of the parser pool.
+ */
+class ScriptHelpers : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit ScriptHelpers(QObject *parent = nullptr);
+
+  static void install(QJSEngine &engine);
+
+  Q_INVOKABLE QByteArray hexDecode(const QString &text) const;
+  Q_INVOKABLE QByteArray base64Decode(const QString &text) const;
+  Q_INVOKABLE QString hexEncode(const QByteArray &data) const;
+};
+} // namespace JSON
@@ -19,6 +19,9 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <memory>
+
+#include <QThread>
 #include <QNetworkReply>
 #include <QDesktopServices>
 
@@ -384,8 +387,12 @@ void Licensing::LemonSqueezy::setLicense(const QString &license)
 /**
  * @brief Loads and decrypts cached licensing data from QSettings.
  *
- * If available, decrypts and parses the stored license key and metadata.
- * Automatically re-validates the data using readValidationResponse().
+ * The integrity-protected SimpleCrypt decryption of the cached grant is the
+ * expensive part of licensing startup, so it runs on a background thread and
+ * the decrypted grant is applied on this thread once ready — the constructor
+ * (and therefore first paint) never waits on it. When the offline grant is
+ * accepted, a server refresh is scheduled automatically, so no caller needs
+ * to poll for the cached state to become available.
  */
 void Licensing::LemonSqueezy::readSettings()
 {
@@ -400,24 +407,49 @@ void Licensing::LemonSqueezy::readSettings()
   if (data.isEmpty() || license.isEmpty())
     return;
 
-  // Descrypt data
-  m_license = m_simpleCrypt.decryptToString(license);
-  auto decryptedData = m_simpleCrypt.decryptToByteArray(data);
-
-  // Check if we can use application offline
-  m_gracePeriod = 0;
-  if (!dt.isEmpty())
+  // Decrypt the cached grant on a background thread
+  struct CachedGrant
   {
-    auto dateTime = m_simpleCrypt.decryptToString(dt);
-    auto currentDt = QDateTime::currentDateTime();
-    auto lastCheck = QDateTime::fromString(dateTime, Qt::RFC2822Date);
-    if (lastCheck.isValid() && lastCheck < currentDt)
-      m_gracePeriod = qMax(0, 30 - lastCheck.daysTo(currentDt));
-  }
+    QString license;
+    QByteArray data;
+    QString lastCheck;
+  };
+  auto grant = std::make_shared<CachedGrant>();
+  const auto crypt = m_simpleCrypt;
+  auto *thread = QThread::create([crypt, license, data, dt, grant]() mutable {
+    grant->license = crypt.decryptToString(license);
+    grant->data = crypt.decryptToByteArray(data);
+    if (!dt.isEmpty())
+      grant->lastCheck = crypt.decryptToString(dt);
+  });
 
-  // Parse data & validate it
-  readValidationResponse(decryptedData, true);
-  Q_EMIT licenseChanged();
+  // Apply the decrypted grant on this thread once the worker finishes
+  connect(thread, &QThread::finished, this, [=] {
+    // Apply the decrypted license key
+    m_license = grant->license;
+
+    // Check if we can use application offline
+    m_gracePeriod = 0;
+    if (!grant->lastCheck.isEmpty())
+    {
+      auto currentDt = QDateTime::currentDateTime();
+      auto lastCheck = QDateTime::fromString(grant->lastCheck, Qt::RFC2822Date);
+      if (lastCheck.isValid() && lastCheck < currentDt)
+        m_gracePeriod = qMax(0, 30 - lastCheck.daysTo(currentDt));
+    }
+
+    // Parse data & validate it offline
+    readValidationResponse(grant->data, true);
+    Q_EMIT licenseChanged();
+
+    // Offline grant accepted, refresh it against the server in background
+    if (!m_licensingData.isEmpty())
+      QMetaObject::invokeMethod(this, &LemonSqueezy::validate,
+                                Qt::QueuedConnection);
+  });
+
+  connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+  thread->start();
 }
 
 /**
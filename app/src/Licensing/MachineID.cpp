@@ -22,6 +22,8 @@
 #include "MachineID.h"
 
 #include <QProcess>
+#include <QSysInfo>
+#include <QSettings>
 #include <QApplication>
 #include <QtCore/qendian.h>
 #include <QCryptographicHash>
@@ -113,11 +115,36 @@ quint64 Licensing::MachineID::machineSpecificKey() const
  *   or decrypt locally cached sensitive data (e.g., license information),
  *   ensuring it cannot be reused across different machines.
  *
+ * The hardware probes (child processes, registry/WMI queries) dominate the
+ * cost of this method, so the finished hash is cached in the settings keyed
+ * by the boot session ID: every launch after the first one in a boot session
+ * restores the ID and key without spawning a single process. The key is the
+ * first 8 bytes of the hash, so caching the base64 hash string covers both
+ * derived values without storing anything that the probes would not reveal.
+ *
  * This method is called internally by the `MachineID` singleton and does not
  * need to be invoked directly.
  */
 void Licensing::MachineID::readInformation()
 {
+  // Restore the hash derived earlier in this boot session (if any)
+  const auto bootId = QString::fromUtf8(QSysInfo::bootUniqueId());
+  QSettings settings;
+  settings.beginGroup(QStringLiteral("machineId"));
+  const auto cachedBoot = settings.value("bootId", "").toString();
+  const auto cachedHash = settings.value("hash", "").toString();
+  settings.endGroup();
+  if (!bootId.isEmpty() && bootId == cachedBoot && !cachedHash.isEmpty())
+  {
+    const auto hash = QByteArray::fromBase64(cachedHash.toUtf8());
+    if (hash.size() == 16)
+    {
+      m_machineId = cachedHash;
+      m_machineSpecificKey = qFromBigEndian<quint64>(hash.left(8));
+      return;
+    }
+  }
+
   // Initialize common platform variables
   QString id;
   QString os;
@@ -212,4 +239,13 @@ void Licensing::MachineID::readInformation()
   // Obtain the machine ID and encryption key as a base64 string
   m_machineId = QString::fromUtf8(hash.toBase64());
   m_machineSpecificKey = qFromBigEndian<quint64>(hash.left(8));
+
+  // Cache the hash for the rest of this boot session
+  if (!bootId.isEmpty())
+  {
+    settings.beginGroup(QStringLiteral("machineId"));
+    settings.setValue("bootId", bootId);
+    settings.setValue("hash", m_machineId);
+    settings.endGroup();
+  }
 }
@@ -20,6 +20,8 @@
  */
 
 #include <QFile>
+#include <QDateTime>
+#include <QDataStream>
 #include <QFileDialog>
 #include <QInputDialog>
 
@@ -28,6 +30,76 @@
 #include "Misc/Utilities.h"
 #include "Licensing/LemonSqueezy.h"
 
+//------------------------------------------------------------------------------
+// Message decoder worker
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Decodes a batch of subscriber messages on the worker thread.
+ *
+ * Each message is decompressed when it carries the "SSCZ" magic prefix and
+ * split into individual frames when it carries the "SSMB" batch envelope;
+ * every resulting frame is handed to the I/O manager, which marshals it back
+ * to its own thread. Draining messages in batches keeps the per-message
+ * signal/slot overhead off the UI thread during retained-message floods.
+ *
+ * @param messages The raw messages to decode, in arrival order.
+ */
+void MQTT::MessageDecoder::decode(const QVector<QByteArray> &messages)
+{
+  for (const auto &message : messages)
+  {
+    // Transparently decompress payloads published with compression enabled
+    QByteArray payload = message;
+    if (payload.size() > int(sizeof(quint32))
+        && payload.startsWith(QByteArrayLiteral("SSCZ")))
+    {
+      QDataStream in(payload);
+      in.setVersion(QDataStream::Qt_6_0);
+
+      quint32 magic = 0;
+      QByteArray compressed;
+      in >> magic >> compressed;
+      if (magic == MQTT_COMPRESS_MAGIC && in.status() == QDataStream::Ok)
+      {
+        const auto inflated = qUncompress(compressed);
+        if (!inflated.isEmpty())
+          payload = inflated;
+      }
+    }
+
+    // Split batched messages back into individual frames
+    if (payload.size() > int(sizeof(quint32))
+        && payload.startsWith(QByteArrayLiteral("SSMB")))
+    {
+      QDataStream in(payload);
+      in.setVersion(QDataStream::Qt_6_0);
+
+      quint32 magic = 0;
+      quint32 count = 0;
+      in >> magic >> count;
+      if (magic == MQTT_BATCH_MAGIC)
+      {
+        for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i)
+        {
+          qint64 timestamp = 0;
+          QByteArray frame;
+          in >> timestamp >> frame;
+          if (in.status() == QDataStream::Ok && !frame.isEmpty())
+            IO::Manager::instance().processPayload(frame);
+        }
+
+        continue;
+      }
+    }
+
+    // Let IO manager process incoming data
+    IO::Manager::instance().processPayload(payload);
+  }
+
+  Q_EMIT finished();
+}
+
 //------------------------------------------------------------------------------
 // Constructor & singleton access functions
 //------------------------------------------------------------------------------
@@ -35,7 +107,31 @@
 MQTT::Client::Client()
   : m_publisher(false)
   , m_sslEnabled(false)
+  , m_compressionEnabled(false)
+  , m_flushInterval(0)
+  , m_scratchCursor(0)
+  , m_topicValid(false)
 {
+  // Flush batched frames when the publish window elapses
+  m_flushTimer.setSingleShot(true);
+  connect(&m_flushTimer, &QTimer::timeout, this,
+          &MQTT::Client::flushPublishQueue);
+
+  // Decode subscriber traffic on a pool of worker lanes; messages are routed
+  // to lanes by topic, so one busy device cannot delay the others
+  for (int i = 0; i < MQTT_DECODE_LANES; ++i)
+  {
+    DecodeLane lane;
+    lane.thread = new QThread();
+    lane.decoder = new MessageDecoder();
+    lane.decoder->moveToThread(lane.thread);
+    connect(
+        lane.decoder, &MQTT::MessageDecoder::finished, this,
+        [this, i] { onDecodeFinished(i); }, Qt::QueuedConnection);
+    lane.thread->start();
+    m_decodeLanes.append(lane);
+  }
+
   // Initialize MQTT versions model
   m_mqttVersions.insert(tr("MQTT 3.1"), QMqttClient::MQTT_3_1);
   m_mqttVersions.insert(tr("MQTT 3.1.1"), QMqttClient::MQTT_3_1_1);
@@ -89,6 +185,22 @@ MQTT::Client::Client()
   setHostname("127.0.0.1");
 }
 
+/**
+ * @brief Destructor, stops the decoder worker threads.
+ */
+MQTT::Client::~Client()
+{
+  for (auto &lane : m_decodeLanes)
+  {
+    lane.thread->quit();
+    lane.thread->wait();
+    delete lane.decoder;
+    delete lane.thread;
+  }
+
+  m_decodeLanes.clear();
+}
+
 /**
  * @brief Returns the singleton instance of the MQTT Client.
  * @return Reference to the shared MQTT::Client instance.
@@ -239,6 +351,36 @@ bool MQTT::Client::autoKeepAlive() const
   return m_client.autoKeepAlive();
 }
 
+/**
+ * @brief Returns the publisher batching window in milliseconds.
+ *
+ * A value of 0 disables batching, each frame is published as soon as it
+ * arrives (the classic wire format).
+ */
+quint16 MQTT::Client::flushInterval() const
+{
+  return m_flushInterval;
+}
+
+/**
+ * @brief Returns the number of frames waiting in the publish queue.
+ *
+ * A depth that keeps growing within the flush window indicates the broker
+ * connection cannot keep up with the incoming frame rate.
+ */
+int MQTT::Client::publishQueueDepth() const
+{
+  return m_publishQueue.count();
+}
+
+/**
+ * @brief Returns whether published payloads are compressed.
+ */
+bool MQTT::Client::compressionEnabled() const
+{
+  return m_compressionEnabled;
+}
+
 /**
  * @brief Returns the index of the selected MQTT protocol version.
  */
@@ -446,7 +588,8 @@ void MQTT::Client::openConnection()
   if (isPublisher())
   {
     m_topicName.setName(m_topicFilter);
-    if (!m_topicName.isValid())
+    m_topicValid = m_topicName.isValid();
+    if (!m_topicValid)
     {
       Misc::Utilities::showMessageBox(
           tr("Invalid MQTT Topic"),
@@ -475,6 +618,7 @@ void MQTT::Client::closeConnection()
   if (!isConnected())
     return;
 
+  flushPublishQueue();
   m_client.disconnectFromHost();
 }
 
@@ -508,6 +652,7 @@ void MQTT::Client::setTopic(const QString &topic)
 {
   m_topicFilter = topic;
   m_topicName.setName(topic);
+  m_topicValid = m_topicName.isValid();
   Q_EMIT mqttConfigurationChanged();
 }
 
@@ -619,6 +764,37 @@ void MQTT::Client::setAutoKeepAlive(const bool keepAlive)
   Q_EMIT mqttConfigurationChanged();
 }
 
+/**
+ * @brief Sets the publisher batching window in milliseconds.
+ *
+ * Frames that arrive within the window are aggregated into one batched
+ * message instead of one publish per frame. Setting the interval to 0
+ * disables batching and immediately flushes anything still queued.
+ */
+void MQTT::Client::setFlushInterval(const quint16 interval)
+{
+  m_flushInterval = interval;
+  if (m_flushInterval == 0)
+    flushPublishQueue();
+
+  Q_EMIT mqttConfigurationChanged();
+}
+
+/**
+ * @brief Enables or disables transparent payload compression.
+ *
+ * Compressed payloads are deflate streams prefixed with the "SSCZ" magic
+ * number. Subscribing Serial Studio instances decompress them automatically,
+ * other consumers must either strip the prefix and inflate the stream or ask
+ * the station to publish plain payloads. Typical JSON telemetry shrinks
+ * close to an order of magnitude, which is what the cellular bill tracks.
+ */
+void MQTT::Client::setCompressionEnabled(const bool enabled)
+{
+  m_compressionEnabled = enabled;
+  Q_EMIT mqttConfigurationChanged();
+}
+
 /**
  * @brief Sets the MQTT protocol version by index.
  */
@@ -713,15 +889,139 @@ void MQTT::Client::setPeerVerifyMode(const quint8 verifyMode)
 
 /**
  * @brief Publishes a message to the broker if connected and in publisher mode.
+ *
+ * When a flush window is configured, the frame is queued with its RX
+ * timestamp instead and published by flushPublishQueue() together with every
+ * other frame that arrives within the window. At kHz frame rates this trades
+ * a bounded amount of latency for an order-of-magnitude drop in per-message
+ * protocol overhead on the broker connection.
  */
 void MQTT::Client::publishMessage(const QByteArray &data)
 {
   if (!SerialStudio::activated())
     return;
 
-  if (isConnected() && isPublisher() && m_topicName.isValid()
-      && !data.isEmpty())
-    m_client.publish(m_topicName, data);
+  if (isConnected() && isPublisher() && m_topicValid && !data.isEmpty())
+  {
+    // Classic wire format, one publish per frame
+    if (m_flushInterval == 0)
+      m_client.publish(m_topicName, compressPayload(data));
+
+    // Queue the frame & schedule a flush at the end of the window
+    else
+    {
+      m_publishQueue.append(
+          qMakePair(QDateTime::currentMSecsSinceEpoch(), data));
+      Q_EMIT publishQueueDepthChanged();
+
+      if (!m_flushTimer.isActive())
+        m_flushTimer.start(m_flushInterval);
+    }
+  }
+}
+
+/**
+ * @brief Publishes all queued frames as a single batched message.
+ *
+ * The batch is framed with the "SSMB" magic number, the frame count and one
+ * timestamped payload per frame, so a subscribing Serial Studio instance can
+ * split it back into individual frames. Consumers that expect the classic
+ * one-message-per-frame format should leave the flush window at 0.
+ */
+void MQTT::Client::flushPublishQueue()
+{
+  // Nothing to publish
+  if (m_publishQueue.isEmpty())
+    return;
+
+  // Drop the queue if the connection went away while the window was open
+  if (!isConnected() || !isPublisher() || !m_topicValid)
+  {
+    m_publishQueue.clear();
+    m_publishQueue.squeeze();
+    Q_EMIT publishQueueDepthChanged();
+    return;
+  }
+
+  // Serialize the batch (magic, frame count & timestamped frames) into a
+  // recycled buffer so steady-state flushing never touches the heap
+  QByteArray &message = payloadScratch();
+  QDataStream out(&message, QIODevice::WriteOnly);
+  out.setVersion(QDataStream::Qt_6_0);
+  out << quint32(MQTT_BATCH_MAGIC);
+  out << quint32(m_publishQueue.count());
+  for (const auto &frame : m_publishQueue)
+    out << frame.first << frame.second;
+
+  // Publish the batch with a single message
+  m_client.publish(m_topicName, compressPayload(message));
+
+  // Clear the queue
+  m_publishQueue.clear();
+  m_publishQueue.squeeze();
+  Q_EMIT publishQueueDepthChanged();
+}
+
+/**
+ * @brief Hands out a reusable payload buffer for the publish path.
+ *
+ * Buffers are recycled round-robin once the MQTT stack has dropped its
+ * implicit-sharing reference from the previous publish, using the same
+ * isDetached() technique as IO::BufferPool. At steady publish rates every
+ * buffer is served from the ring and the heap is never touched; a slot is
+ * only replaced when every buffer is still in flight.
+ */
+QByteArray &MQTT::Client::payloadScratch()
+{
+  constexpr int count
+      = int(sizeof(m_payloadScratch) / sizeof(m_payloadScratch[0]));
+
+  // Reuse the next slot that is no longer referenced by the MQTT stack
+  for (int i = 0; i < count; ++i)
+  {
+    auto &slot = m_payloadScratch[(m_scratchCursor + i) % count];
+    if (slot.isNull() || slot.isDetached())
+    {
+      m_scratchCursor = (m_scratchCursor + i + 1) % count;
+      slot.resize(0);
+      return slot;
+    }
+  }
+
+  // Every slot is in flight, replace the oldest one (previous owners keep
+  // the old buffer alive through implicit sharing)
+  auto &slot = m_payloadScratch[m_scratchCursor];
+  m_scratchCursor = (m_scratchCursor + 1) % count;
+  slot = QByteArray();
+  return slot;
+}
+
+/**
+ * @brief Compresses the given payload when compression is enabled.
+ *
+ * Returns the payload unchanged when compression is disabled. Otherwise the
+ * deflate stream is framed with the "SSCZ" magic number so the receiving end
+ * can tell compressed payloads apart from plain ones on the same topic. The
+ * result is built inside a recycled scratch buffer.
+ *
+ * @param data The payload to compress.
+ * @return The compressed payload, or @a data when compression is disabled.
+ */
+QByteArray MQTT::Client::compressPayload(const QByteArray &data)
+{
+  if (!m_compressionEnabled || data.isEmpty())
+    return data;
+
+  // Keep a reference on the input so the scratch ring cannot hand its
+  // buffer back out while we are still reading from it
+  const QByteArray input = data;
+
+  QByteArray &message = payloadScratch();
+  QDataStream out(&message, QIODevice::WriteOnly);
+  out.setVersion(QDataStream::Qt_6_0);
+  out << quint32(MQTT_COMPRESS_MAGIC);
+  out << qCompress(input);
+  return message;
 }
 
 /**
@@ -910,10 +1210,13 @@ void MQTT::Client::onAuthenticationRequested(
  * It processes the message only if:
  * - The message payload is non-empty
  * - The client is in subscriber mode
- * - The topic matches the currently configured subscription topic
+ * - The topic matches the currently configured subscription filter
  *
- * If all conditions are met, the message payload is passed to IO::Manager
- * for processing via a queued Qt method invocation.
+ * Wildcard filters ('+'/'#') match every concrete topic they cover, so a
+ * single subscription can ingest a whole fleet of devices. Each topic is
+ * hashed onto one of the decode lanes: interleaved devices are decoded in
+ * parallel across the worker pool, while messages from the same topic stay
+ * on one lane and preserve their arrival order.
  *
  * @param message The received MQTT message payload.
  * @param topic The topic associated with the received message.
@@ -932,13 +1235,65 @@ void MQTT::Client::onMessageReceived(const QByteArray &message,
     if (!isSubscriber())
       return;
 
-    // Ignore if topic is not equal to current topic
-    if (m_topicName != topic)
+    // Ignore if topic is not covered by the configured filter
+    const QMqttTopicFilter filter(m_topicFilter);
+    if (!filter.match(topic))
       return;
 
-    // Let IO manager process incoming data
-    QMetaObject::invokeMethod(
-        this, [=] { IO::Manager::instance().processPayload(message); },
-        Qt::QueuedConnection);
+    // Route the message to its per-topic decode lane
+    const auto lane = int(qHash(topic.name()) % uint(m_decodeLanes.count()));
+    auto &pipeline = m_decodeLanes[lane];
+
+    // Bound the queue, a flood drops the oldest (stalest) messages first
+    while (pipeline.queue.count() >= MQTT_MAX_PENDING_MESSAGES)
+      pipeline.queue.removeFirst();
+
+    // Queue the message for the lane's decoder worker
+    pipeline.queue.append(message);
+
+    // Dispatch a batch unless the lane is already draining one; everything
+    // that arrives in the meantime is coalesced into the next batch
+    if (!pipeline.pending)
+      dispatchLane(lane);
   }
 }
+
+/**
+ * @brief Dispatches the next decode batch once a lane's worker finishes one.
+ *
+ * Messages that arrived while the worker was busy were coalesced into the
+ * lane's queue; they are handed over as a single batch so the worker makes
+ * one pass per drain instead of one pass per message.
+ *
+ * @param lane Index of the lane whose worker finished.
+ */
+void MQTT::Client::onDecodeFinished(const int lane)
+{
+  m_decodeLanes[lane].pending = false;
+  dispatchLane(lane);
+}
+
+/**
+ * @brief Hands the pending queue of the given lane to its decoder worker.
+ *
+ * Does nothing when the queue is empty. The batch is delivered with a queued
+ * invocation, so the copy handed to the worker is decoupled from the queue
+ * that keeps filling on the UI thread.
+ *
+ * @param lane Index of the lane to drain.
+ */
+void MQTT::Client::dispatchLane(const int lane)
+{
+  auto &pipeline = m_decodeLanes[lane];
+  if (pipeline.queue.isEmpty())
+    return;
+
+  pipeline.pending = true;
+  QVector<QByteArray> batch;
+  batch.swap(pipeline.queue);
+
+  auto *decoder = pipeline.decoder;
+  QMetaObject::invokeMethod(
+      decoder, [decoder, batch] { decoder->decode(batch); },
+      Qt::QueuedConnection);
+}
@@ -23,12 +23,65 @@
 
 // clang-format off
 #include <QtMqtt>
+#include <QTimer>
 #include <QObject>
+#include <QThread>
 #include <QSslConfiguration>
 // clang-format on
 
+/**
+ * Magic number that identifies a batched MQTT message, "SSMB" in ASCII.
+ * Batches aggregate several frames (with their RX timestamps) into a single
+ * publish so that high frame rates do not saturate the broker connection on
+ * per-message overhead.
+ */
+#define MQTT_BATCH_MAGIC 0x53534D42
+
+/**
+ * Magic number that identifies a compressed MQTT message, "SSCZ" in ASCII.
+ * Compressed payloads carry a deflate stream produced by qCompress();
+ * subscribers detect the prefix and decompress transparently, so compressed
+ * and plain publishers can share a topic.
+ */
+#define MQTT_COMPRESS_MAGIC 0x5353435A
+
+/**
+ * Maximum number of undecoded subscriber messages kept in memory. When a
+ * retained-message flood on reconnect outruns the decoder, the oldest queued
+ * messages are dropped first so the station converges on current data instead
+ * of replaying stale history.
+ */
+#define MQTT_MAX_PENDING_MESSAGES 4096
+
+/**
+ * Number of worker lanes used to decode subscriber traffic. Messages are
+ * routed to a lane by topic, so a wildcard subscription covering many devices
+ * decodes them in parallel while each individual topic preserves its arrival
+ * order.
+ */
+#define MQTT_DECODE_LANES 4
+
 namespace MQTT
 {
+/**
+ * @brief The MessageDecoder class
+ *
+ * Decodes subscriber traffic on a worker thread: payloads are decompressed,
+ * batched messages are split back into individual frames and everything is
+ * handed to the I/O manager for processing. Keeping the decode work off the
+ * UI thread prevents retained-message floods on reconnect from locking up
+ * the interface.
+ */
+class MessageDecoder : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void finished();
+
+public slots:
+  void decode(const QVector<QByteArray> &messages);
+};
 /**
  * @class MQTT::Client
  * @brief Singleton wrapper around QMqttClient for managing MQTT connections.
@@ -76,6 +129,13 @@ class Client : public QObject
   Q_PROPERTY(quint16 keepAlive READ keepAlive WRITE setKeepAlive NOTIFY mqttConfigurationChanged)
   Q_PROPERTY(bool autoKeepAlive READ autoKeepAlive WRITE setAutoKeepAlive NOTIFY mqttConfigurationChanged)
 
+  // Publisher batching
+  Q_PROPERTY(quint16 flushInterval READ flushInterval WRITE setFlushInterval NOTIFY mqttConfigurationChanged)
+  Q_PROPERTY(int publishQueueDepth READ publishQueueDepth NOTIFY publishQueueDepthChanged)
+
+  // Payload compression
+  Q_PROPERTY(bool compressionEnabled READ compressionEnabled WRITE setCompressionEnabled NOTIFY mqttConfigurationChanged)
+
   // Topic
   Q_PROPERTY(QString topicFilter READ topicFilter WRITE setTopic NOTIFY mqttConfigurationChanged)
 
@@ -97,6 +157,7 @@ signals:
   void sslConfigurationChanged();
   void mqttConfigurationChanged();
   void highlightMqttTopicControl();
+  void publishQueueDepthChanged();
   void messageReceived(const QByteArray &data);
 
 private:
@@ -106,6 +167,8 @@ private:
   Client &operator=(Client &&) = delete;
   Client &operator=(const Client &) = delete;
 
+  ~Client();
+
 public:
   static Client &instance();
 
@@ -130,6 +193,10 @@ public:
   [[nodiscard]] quint16 keepAlive() const;
   [[nodiscard]] bool autoKeepAlive() const;
 
+  [[nodiscard]] quint16 flushInterval() const;
+  [[nodiscard]] int publishQueueDepth() const;
+  [[nodiscard]] bool compressionEnabled() const;
+
   [[nodiscard]] quint8 mqttVersion() const;
   [[nodiscard]] const QStringList &mqttVersions() const;
 
@@ -165,6 +232,8 @@ public slots:
   void setPort(const quint16 port);
   void setKeepAlive(const quint16 keepAlive);
   void setAutoKeepAlive(const bool keepAlive);
+  void setFlushInterval(const quint16 interval);
+  void setCompressionEnabled(const bool enabled);
 
   void setMqttVersion(const quint8 version);
 
@@ -175,6 +244,8 @@ public slots:
   void setPeerVerifyMode(const quint8 verifyMode);
 
 private slots:
+  void onDecodeFinished(const int lane);
+  void flushPublishQueue();
   void publishMessage(const QByteArray &data);
   void onStateChanged(QMqttClient::ClientState state);
   void onErrorChanged(QMqttClient::ClientError error);
@@ -183,12 +254,45 @@ private slots:
   void onMessageReceived(const QByteArray &message,
                          const QMqttTopicName &topic = QMqttTopicName());
 
+private:
+  void dispatchLane(const int lane);
+  [[nodiscard]] QByteArray &payloadScratch();
+  [[nodiscard]] QByteArray compressPayload(const QByteArray &data);
+
+private:
+  /**
+   * @brief Represents one decode lane of the subscriber pipeline.
+   *
+   * Each lane owns a decoder worker, the thread it runs on and a queue of
+   * undecoded messages. Topics are hashed onto lanes, so the traffic of one
+   * busy device only ever queues behind itself.
+   */
+  struct DecodeLane
+  {
+    bool pending = false;
+    QThread *thread = nullptr;
+    MessageDecoder *decoder = nullptr;
+    QVector<QByteArray> queue;
+  };
+
 private:
   quint8 m_mode;
   bool m_publisher;
   bool m_sslEnabled;
+  bool m_compressionEnabled;
   QString m_topicFilter;
 
+  QTimer m_flushTimer;
+  quint16 m_flushInterval;
+  QVector<QPair<qint64, QByteArray>> m_publishQueue;
+
+  // Round-robin ring of reusable payload buffers for the publish path
+  int m_scratchCursor;
+  bool m_topicValid;
+  QByteArray m_payloadScratch[4];
+
+  QVector<DecodeLane> m_decodeLanes;
+
   QMqttClient m_client;
   QMqttTopicName m_topicName;
   QSslConfiguration m_sslConfiguration;
@@ -0,0 +1,276 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/AllocationTracker.h"
+
+#include <cstdlib>
+#include <new>
+
+#include <QVariantMap>
+
+#include "Misc/TimerEvents.h"
+
+//------------------------------------------------------------------------------
+// Global operator new/delete replacement
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Replaced global allocation function, attributes the allocation to
+ *        the pipeline stage running on the calling thread.
+ *
+ * The array, nothrow and sized-delete variants of the default library
+ * implementation all funnel into this pair, so replacing only these two
+ * functions keeps every pairing consistent. The aligned variants keep their
+ * default (internally consistent) implementations.
+ */
+void *operator new(std::size_t size)
+{
+  Misc::AllocationTracker::recordAllocation(size);
+
+  if (size == 0)
+    size = 1;
+
+  if (void *ptr = std::malloc(size))
+    return ptr;
+
+  throw std::bad_alloc();
+}
+
+/**
+ * @brief Replaced global deallocation function, pairs with the replaced
+ *        operator new above.
+ */
+void operator delete(void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+/**
+ * @brief Sized variant of the replaced global deallocation function.
+ */
+void operator delete(void *ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+//------------------------------------------------------------------------------
+// Static counter storage
+//------------------------------------------------------------------------------
+
+// clang-format off
+std::atomic<bool> Misc::AllocationTracker::s_enabled{false};
+std::atomic<quint64> Misc::AllocationTracker::s_bytes[StageCount]{};
+std::atomic<quint64> Misc::AllocationTracker::s_frames[StageCount]{};
+std::atomic<quint64> Misc::AllocationTracker::s_allocations[StageCount]{};
+thread_local Misc::AllocationTracker::Stage Misc::AllocationTracker::t_stage
+    = Misc::AllocationTracker::NoStage;
+// clang-format on
+
+/**
+ * @brief Returns the display title of the given pipeline stage.
+ */
+static QString stageTitle(const Misc::AllocationTracker::Stage stage)
+{
+  switch (stage)
+  {
+    case Misc::AllocationTracker::Extraction:
+      return QObject::tr("Frame Extraction");
+    case Misc::AllocationTracker::Parsing:
+      return QObject::tr("Frame Parsing");
+    case Misc::AllocationTracker::Rendering:
+      return QObject::tr("Dashboard Update");
+    default:
+      return QString();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Scope implementation
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Tags the calling thread's allocations with the given stage.
+ * @param stage The pipeline stage entered by the caller.
+ */
+Misc::AllocationTracker::Scope::Scope(const Stage stage)
+  : m_stage(stage)
+  , m_previous(t_stage)
+{
+  t_stage = stage;
+}
+
+/**
+ * @brief Restores the previous stage tag & accounts one processed frame.
+ */
+Misc::AllocationTracker::Scope::~Scope()
+{
+  t_stage = m_previous;
+  if (s_enabled.load(std::memory_order_relaxed) && m_stage < StageCount)
+    s_frames[m_stage].fetch_add(1, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+// AllocationTracker implementation
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs the allocation tracker.
+ */
+Misc::AllocationTracker::AllocationTracker()
+{
+  resetCounters();
+
+  // Refresh the derived per-frame figures once per second while enabled
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &Misc::AllocationTracker::updateStatistics);
+}
+
+/**
+ * @brief Returns the only instance of the class.
+ */
+Misc::AllocationTracker &Misc::AllocationTracker::instance()
+{
+  static AllocationTracker instance;
+  return instance;
+}
+
+/**
+ * @brief Accounts one allocation to the stage tag of the calling thread.
+ *
+ * Called from the replaced global operator new; reduces to one relaxed load
+ * while tracking is disabled or the thread is outside the pipeline.
+ *
+ * @param size The requested allocation size in bytes.
+ */
+void Misc::AllocationTracker::recordAllocation(const std::size_t size) noexcept
+{
+  if (!s_enabled.load(std::memory_order_relaxed))
+    return;
+
+  const auto stage = t_stage;
+  if (stage >= StageCount)
+    return;
+
+  s_allocations[stage].fetch_add(1, std::memory_order_relaxed);
+  s_bytes[stage].fetch_add(size, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns @c true while allocation tracking is active.
+ */
+bool Misc::AllocationTracker::enabled() const
+{
+  return s_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the per-stage allocation statistics for the diagnostics
+ *        pane.
+ *
+ * Each entry is a map with the stage title, the number of frames processed
+ * during the last sampling interval and the average allocations & kilobytes
+ * per frame over that interval.
+ */
+QVariantList Misc::AllocationTracker::statistics() const
+{
+  return m_statistics;
+}
+
+/**
+ * @brief Enables or disables allocation tracking.
+ *
+ * Counters are reset on every transition so a freshly opened diagnostics
+ * pane starts from zero.
+ *
+ * @param enabled @c true to count allocations, @c false to stop.
+ */
+void Misc::AllocationTracker::setEnabled(const bool enabled)
+{
+  if (s_enabled.load(std::memory_order_relaxed) != enabled)
+  {
+    resetCounters();
+    s_enabled.store(enabled, std::memory_order_relaxed);
+    Q_EMIT enabledChanged();
+  }
+}
+
+/**
+ * @brief Recomputes the per-frame figures from the raw counters.
+ *
+ * Runs at 1 Hz on the GUI thread while tracking is enabled; the per-frame
+ * averages cover only the last sampling interval, so a regression shows up
+ * within a second instead of being diluted by history.
+ */
+void Misc::AllocationTracker::updateStatistics()
+{
+  if (!enabled())
+    return;
+
+  m_statistics.clear();
+  for (int i = 0; i < StageCount; ++i)
+  {
+    const auto stage = static_cast<Stage>(i);
+    const auto bytes = s_bytes[i].load(std::memory_order_relaxed);
+    const auto frames = s_frames[i].load(std::memory_order_relaxed);
+    const auto allocations = s_allocations[i].load(std::memory_order_relaxed);
+
+    const auto frameDelta = frames - m_lastFrames[i];
+    const auto byteDelta = bytes - m_lastBytes[i];
+    const auto allocDelta = allocations - m_lastAllocations[i];
+
+    m_lastBytes[i] = bytes;
+    m_lastFrames[i] = frames;
+    m_lastAllocations[i] = allocations;
+
+    QVariantMap entry;
+    entry.insert(QStringLiteral("stage"), stageTitle(stage));
+    entry.insert(QStringLiteral("frames"), frameDelta);
+    entry.insert(QStringLiteral("allocsPerFrame"),
+                 frameDelta > 0
+                     ? static_cast<double>(allocDelta) / frameDelta
+                     : 0.0);
+    entry.insert(QStringLiteral("kbPerFrame"),
+                 frameDelta > 0
+                     ? static_cast<double>(byteDelta) / frameDelta / 1024.0
+                     : 0.0);
+    m_statistics.append(entry);
+  }
+
+  Q_EMIT statisticsChanged();
+}
+
+/**
+ * @brief Clears the raw counters and the derived statistics.
+ */
+void Misc::AllocationTracker::resetCounters()
+{
+  m_statistics.clear();
+  for (int i = 0; i < StageCount; ++i)
+  {
+    s_bytes[i].store(0, std::memory_order_relaxed);
+    s_frames[i].store(0, std::memory_order_relaxed);
+    s_allocations[i].store(0, std::memory_order_relaxed);
+
+    m_lastBytes[i] = 0;
+    m_lastFrames[i] = 0;
+    m_lastAllocations[i] = 0;
+  }
+}
@@ -0,0 +1,153 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QtCore>
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+namespace Misc
+{
+/**
+ * @brief Fixed-capacity handoff queue with an explicit overflow policy.
+ *
+ * Stage boundaries that rely on the event loop for backpressure grow without
+ * bound under overload: latency explodes long before anything is dropped.
+ * This queue makes the boundary explicit. When full, it either discards the
+ * oldest items (for display pipelines, where bounded latency matters more
+ * than lossless delivery) or blocks the producer (for lossless consumers
+ * such as file export, where the producer must slow down instead).
+ *
+ * Thread-safe for any number of producers and consumers. Dropped items are
+ * counted so the overflow behaviour can be inspected at runtime.
+ */
+template<typename T>
+class BoundedQueue
+{
+public:
+  enum class Policy
+  {
+    DropOldest,
+    Block
+  };
+
+  /**
+   * @brief Constructs a BoundedQueue object.
+   *
+   * @param capacity Maximum number of queued items.
+   * @param policy What to do with the producer when the queue is full.
+   */
+  explicit BoundedQueue(const int capacity, const Policy policy)
+    : m_policy(policy)
+    , m_capacity(qMax(1, capacity))
+    , m_dropped(0)
+  {
+  }
+
+  /**
+   * @brief Returns the number of items currently queued.
+   */
+  [[nodiscard]] int size() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_items.size();
+  }
+
+  /**
+   * @brief Returns the number of items discarded by the DropOldest policy.
+   */
+  [[nodiscard]] quint64 droppedItems() const
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Appends an item, applying the overflow policy when full.
+   *
+   * With @c DropOldest the oldest queued items are discarded (and counted)
+   * to make room; with @c Block the calling thread waits until a consumer
+   * drains the queue.
+   */
+  void push(T item)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_items.size() >= m_capacity)
+    {
+      if (m_policy == Policy::DropOldest)
+      {
+        while (m_items.size() >= m_capacity)
+        {
+          m_items.removeFirst();
+          m_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+
+      else
+        m_spaceAvailable.wait(lock,
+                              [this] { return m_items.size() < m_capacity; });
+    }
+
+    m_items.append(std::move(item));
+  }
+
+  /**
+   * @brief Removes and returns every queued item in arrival order.
+   *
+   * Wakes producers blocked by the @c Block policy.
+   */
+  [[nodiscard]] QVector<T> popAll()
+  {
+    QVector<T> items;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      items.swap(m_items);
+    }
+
+    m_spaceAvailable.notify_all();
+    return items;
+  }
+
+  /**
+   * @brief Discards every queued item, waking blocked producers.
+   */
+  void clear()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_items.clear();
+    }
+
+    m_spaceAvailable.notify_all();
+  }
+
+private:
+  Policy m_policy;
+  int m_capacity;
+  QVector<T> m_items;
+  std::atomic<quint64> m_dropped;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_spaceAvailable;
+};
+} // namespace Misc
@@ -0,0 +1,310 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/LatencyMonitor.h"
+
+#include <QVariantMap>
+
+#include "IO/Manager.h"
+#include "UI/Dashboard.h"
+#include "JSON/FrameBuilder.h"
+#include "Misc/TimerEvents.h"
+
+/**
+ * @brief Returns the display title of the given pipeline stage.
+ */
+static QString stageTitle(const Misc::LatencyMonitor::Stage stage)
+{
+  switch (stage)
+  {
+    case Misc::LatencyMonitor::Extraction:
+      return QObject::tr("Frame Extraction");
+    case Misc::LatencyMonitor::Parsing:
+      return QObject::tr("Frame Parsing");
+    case Misc::LatencyMonitor::Rendering:
+      return QObject::tr("Dashboard Update");
+    case Misc::LatencyMonitor::Total:
+      return QObject::tr("Wire to Pixel");
+    default:
+      return QString();
+  }
+}
+
+/**
+ * @brief Constructs the latency monitor.
+ *
+ * Hooks the stage markers into the pipeline signals using direct connections,
+ * so each marker executes inline in the emitting thread (IO worker, frame
+ * builder or GUI thread). The markers only touch atomics, so no
+ * synchronization with the monitor's own thread is needed, and a disabled
+ * monitor costs one relaxed load per signal emission.
+ */
+Misc::LatencyMonitor::LatencyMonitor()
+  : m_enabled(false)
+  , m_receiveNs(0)
+  , m_extractNs(0)
+  , m_parseNs(0)
+{
+  // Start the monotonic clock shared by every stage marker
+  m_clock.start();
+  resetHistograms();
+
+  // Capture driver receive & frame extraction timestamps
+  connect(&IO::Manager::instance(), &IO::Manager::dataReceived, this,
+          &Misc::LatencyMonitor::markDataReceived, Qt::DirectConnection);
+  connect(&IO::Manager::instance(), &IO::Manager::frameReceived, this,
+          &Misc::LatencyMonitor::markFrameExtracted, Qt::DirectConnection);
+
+  // Capture parse completion timestamps
+  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged,
+          this, &Misc::LatencyMonitor::markFrameParsed, Qt::DirectConnection);
+
+  // Capture dashboard update timestamps (GUI thread)
+  connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+          &Misc::LatencyMonitor::markDashboardUpdated, Qt::DirectConnection);
+
+  // Refresh the derived percentiles once per second while enabled
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &Misc::LatencyMonitor::updateStatistics);
+}
+
+/**
+ * @brief Returns the only instance of the class.
+ */
+Misc::LatencyMonitor &Misc::LatencyMonitor::instance()
+{
+  static LatencyMonitor instance;
+  return instance;
+}
+
+/**
+ * @brief Returns @c true while latency sampling is active.
+ */
+bool Misc::LatencyMonitor::enabled() const
+{
+  return m_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the per-stage latency statistics for the diagnostics pane.
+ *
+ * Each entry is a map with the stage title, sample count, p50/p90/p99
+ * percentiles and the maximum observed latency, all expressed in
+ * milliseconds.
+ */
+QVariantList Misc::LatencyMonitor::statistics() const
+{
+  return m_statistics;
+}
+
+/**
+ * @brief Enables or disables latency sampling.
+ *
+ * The diagnostics pane binds this to its visibility, so the stage markers
+ * only do work while someone is actually looking at the numbers. Enabling
+ * starts from fresh histograms.
+ *
+ * @param enabled True to start sampling, false to stop it.
+ */
+void Misc::LatencyMonitor::setEnabled(const bool enabled)
+{
+  if (m_enabled.load(std::memory_order_relaxed) == enabled)
+    return;
+
+  if (enabled)
+    resetHistograms();
+
+  m_enabled.store(enabled, std::memory_order_relaxed);
+  Q_EMIT enabledChanged();
+}
+
+/**
+ * @brief Rebuilds the derived statistics from the histogram buckets.
+ *
+ * Runs at 1 Hz while sampling is enabled; the scan over the fixed-size
+ * buckets is trivial compared to the signal traffic it summarizes.
+ */
+void Misc::LatencyMonitor::updateStatistics()
+{
+  if (!m_enabled.load(std::memory_order_relaxed))
+    return;
+
+  QVariantList statistics;
+  for (int i = 0; i < StageCount; ++i)
+  {
+    const auto stage = static_cast<Stage>(i);
+    const quint64 total = m_counts[i].load(std::memory_order_relaxed);
+
+    QVariantMap row;
+    row.insert(QStringLiteral("stage"), stageTitle(stage));
+    row.insert(QStringLiteral("samples"), total);
+    row.insert(QStringLiteral("p50"), percentile(stage, 0.50, total));
+    row.insert(QStringLiteral("p90"), percentile(stage, 0.90, total));
+    row.insert(QStringLiteral("p99"), percentile(stage, 0.99, total));
+    row.insert(QStringLiteral("max"),
+               static_cast<double>(m_maximums[i].load(std::memory_order_relaxed))
+                   / 1e6);
+    statistics.append(row);
+  }
+
+  m_statistics = statistics;
+  Q_EMIT statisticsChanged();
+}
+
+/**
+ * @brief Clears every histogram, counter and stage timestamp.
+ */
+void Misc::LatencyMonitor::resetHistograms()
+{
+  m_receiveNs.store(0, std::memory_order_relaxed);
+  m_extractNs.store(0, std::memory_order_relaxed);
+  m_parseNs.store(0, std::memory_order_relaxed);
+
+  for (int i = 0; i < StageCount; ++i)
+  {
+    m_counts[i].store(0, std::memory_order_relaxed);
+    m_maximums[i].store(0, std::memory_order_relaxed);
+    for (int j = 0; j < BucketCount; ++j)
+      m_histograms[i][j].store(0, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Timestamps the arrival of raw bytes from the active driver.
+ */
+void Misc::LatencyMonitor::markDataReceived()
+{
+  if (!m_enabled.load(std::memory_order_relaxed))
+    return;
+
+  m_receiveNs.store(m_clock.nsecsElapsed(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Records the driver-to-extraction latency of the newest frame.
+ */
+void Misc::LatencyMonitor::markFrameExtracted()
+{
+  if (!m_enabled.load(std::memory_order_relaxed))
+    return;
+
+  const qint64 now = m_clock.nsecsElapsed();
+  const qint64 received = m_receiveNs.load(std::memory_order_relaxed);
+  if (received > 0)
+    recordSample(Extraction, now - received);
+
+  m_extractNs.store(now, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Records the extraction-to-parse latency of the newest frame.
+ */
+void Misc::LatencyMonitor::markFrameParsed()
+{
+  if (!m_enabled.load(std::memory_order_relaxed))
+    return;
+
+  const qint64 now = m_clock.nsecsElapsed();
+  const qint64 extracted = m_extractNs.load(std::memory_order_relaxed);
+  if (extracted > 0)
+    recordSample(Parsing, now - extracted);
+
+  m_parseNs.store(now, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Records the parse-to-pixel and wire-to-pixel latencies.
+ */
+void Misc::LatencyMonitor::markDashboardUpdated()
+{
+  if (!m_enabled.load(std::memory_order_relaxed))
+    return;
+
+  const qint64 now = m_clock.nsecsElapsed();
+  const qint64 parsed = m_parseNs.load(std::memory_order_relaxed);
+  if (parsed > 0)
+    recordSample(Rendering, now - parsed);
+
+  const qint64 received = m_receiveNs.load(std::memory_order_relaxed);
+  if (received > 0)
+    recordSample(Total, now - received);
+}
+
+/**
+ * @brief Adds a latency sample to the histogram of the given stage.
+ *
+ * Buckets are logarithmic in microseconds: bucket @c i covers the range
+ * [2^i, 2^(i+1)) us, giving sub-microsecond resolution at the bottom and
+ * covering more than an hour at the top with 32 buckets.
+ */
+void Misc::LatencyMonitor::recordSample(const Stage stage,
+                                        const qint64 nanoseconds)
+{
+  if (nanoseconds < 0)
+    return;
+
+  // Find the logarithmic bucket for the latency in microseconds
+  int bucket = 0;
+  quint64 microseconds = static_cast<quint64>(nanoseconds) / 1000;
+  while (microseconds > 1 && bucket < BucketCount - 1)
+  {
+    microseconds >>= 1;
+    ++bucket;
+  }
+
+  // Update the histogram, sample count & observed maximum
+  m_histograms[stage][bucket].fetch_add(1, std::memory_order_relaxed);
+  m_counts[stage].fetch_add(1, std::memory_order_relaxed);
+
+  qint64 maximum = m_maximums[stage].load(std::memory_order_relaxed);
+  while (nanoseconds > maximum
+         && !m_maximums[stage].compare_exchange_weak(
+             maximum, nanoseconds, std::memory_order_relaxed))
+    ;
+}
+
+/**
+ * @brief Derives a percentile (in milliseconds) from a stage histogram.
+ *
+ * Walks the cumulative bucket counts until the requested fraction of the
+ * samples is covered and reports the upper bound of that bucket, which keeps
+ * the estimate conservative.
+ */
+double Misc::LatencyMonitor::percentile(const Stage stage,
+                                        const double fraction,
+                                        const quint64 total) const
+{
+  if (total == 0)
+    return 0;
+
+  const quint64 target
+      = static_cast<quint64>(static_cast<double>(total) * fraction);
+
+  quint64 cumulative = 0;
+  for (int i = 0; i < BucketCount; ++i)
+  {
+    cumulative += m_histograms[stage][i].load(std::memory_order_relaxed);
+    if (cumulative >= target)
+      return static_cast<double>(Q_UINT64_C(1) << (i + 1)) / 1000.0;
+  }
+
+  return static_cast<double>(Q_UINT64_C(1) << BucketCount) / 1000.0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QObject>
+#include <QVariantList>
+#include <QElapsedTimer>
+
+namespace Misc
+{
+/**
+ * @class Misc::LatencyMonitor
+ * @brief Wire-to-pixel latency instrumentation for the processing pipeline.
+ *
+ * Samples the time a data byte spends in each stage of the pipeline:
+ * - Extraction: driver receive to frame extraction (FrameReader).
+ * - Parsing:    frame extraction to parse completion (FrameBuilder).
+ * - Rendering:  parse completion to dashboard update (UI::Dashboard).
+ * - Total:      driver receive to dashboard update.
+ *
+ * Each stage feeds a lock-free, logarithmically-bucketed histogram from which
+ * p50/p90/p99 and the maximum are derived at a 1 Hz cadence for display in
+ * the diagnostics pane. The stage markers run inside the IO/parse hot paths
+ * (via direct connections), so when the pane is closed sampling is disabled
+ * and every marker reduces to a single relaxed atomic load and an early
+ * return.
+ *
+ * Stages are correlated through the most recent timestamp of the upstream
+ * stage rather than per-frame tags, which keeps the hot path allocation-free;
+ * the percentiles are therefore representative for steady streams (the rig
+ * tuning use case) rather than exact per-frame traces.
+ */
+class LatencyMonitor : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY(bool enabled
+             READ enabled
+             WRITE setEnabled
+             NOTIFY enabledChanged)
+  Q_PROPERTY(QVariantList statistics
+             READ statistics
+             NOTIFY statisticsChanged)
+
+signals:
+  void enabledChanged();
+  void statisticsChanged();
+
+private:
+  explicit LatencyMonitor();
+  LatencyMonitor(LatencyMonitor &&) = delete;
+  LatencyMonitor(const LatencyMonitor &) = delete;
+  LatencyMonitor &operator=(LatencyMonitor &&) = delete;
+  LatencyMonitor &operator=(const LatencyMonitor &) = delete;
+
+public:
+  enum Stage
+  {
+    Extraction,
+    Parsing,
+    Rendering,
+    Total,
+    StageCount
+  };
+
+  static LatencyMonitor &instance();
+
+  [[nodiscard]] bool enabled() const;
+  [[nodiscard]] QVariantList statistics() const;
+
+public slots:
+  void setEnabled(const bool enabled);
+
+private slots:
+  void updateStatistics();
+
+private:
+  void resetHistograms();
+  void markDataReceived();
+  void markFrameExtracted();
+  void markFrameParsed();
+  void markDashboardUpdated();
+  void recordSample(const Stage stage, const qint64 nanoseconds);
+  [[nodiscard]] double percentile(const Stage stage, const double fraction,
+                                  const quint64 total) const;
+
+private:
+  static constexpr int BucketCount = 32;
+
+  QElapsedTimer m_clock;
+  QVariantList m_statistics;
+  std::atomic<bool> m_enabled;
+
+  std::atomic<qint64> m_receiveNs;
+  std::atomic<qint64> m_extractNs;
+  std::atomic<qint64> m_parseNs;
+
+  std::atomic<quint64> m_counts[StageCount];
+  std::atomic<qint64> m_maximums[StageCount];
+  std::atomic<quint32> m_histograms[StageCount][BucketCount];
+};
+} // namespace Misc
@@ -0,0 +1,101 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/MemoryCompactor.h"
+
+#include <QDebug>
+
+#include "IO/Console.h"
+#include "IO/Manager.h"
+#include "CSV/Player.h"
+#include "UI/Dashboard.h"
+#include "Misc/TimerEvents.h"
+
+/**
+ * @brief Constructs the memory compactor and hooks it to the 1 Hz tick.
+ */
+Misc::MemoryCompactor::MemoryCompactor()
+  : m_compacted(false)
+  , m_quietSeconds(0)
+{
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &Misc::MemoryCompactor::onTimerTick);
+}
+
+/**
+ * @brief Returns a pointer to the only instance of the class.
+ */
+Misc::MemoryCompactor &Misc::MemoryCompactor::instance()
+{
+  static MemoryCompactor singleton;
+  return singleton;
+}
+
+/**
+ * @brief Tracks ingest activity and triggers the compaction pass.
+ *
+ * The pass runs once the link has been quiet for @c QuietSeconds consecutive
+ * seconds, and only once per idle period: any activity re-arms it. Replays
+ * drive the dashboard without any I/O traffic, so the pass is also held off
+ * while a recording is playing.
+ */
+void Misc::MemoryCompactor::onTimerTick()
+{
+  const bool busy = (IO::Manager::instance().isConnected()
+                     && IO::Manager::instance().dataRate() > QuietRateThreshold)
+                    || CSV::Player::instance().isPlaying();
+  if (busy)
+  {
+    m_quietSeconds = 0;
+    m_compacted = false;
+    return;
+  }
+
+  if (++m_quietSeconds >= QuietSeconds && !m_compacted)
+  {
+    m_compacted = true;
+    compact();
+  }
+}
+
+/**
+ * @brief Runs one compaction pass over the known slack holders.
+ *
+ * Trims the unreferenced blocks parked in the receive buffer pool, shrinks
+ * the console's scrollback bookkeeping and releases the dashboard's handoff
+ * queue slack, then logs the per-subsystem tally so the effect on the
+ * station's memory budget is visible in the application output.
+ */
+void Misc::MemoryCompactor::compact()
+{
+  const qsizetype pool = IO::Manager::instance().receiveBufferPool().trim();
+  const qsizetype console = IO::Console::instance().compactMemory();
+  const qsizetype dashboard = UI::Dashboard::instance().compactMemory();
+
+  const qsizetype total = pool + console + dashboard;
+  if (total <= 0)
+    return;
+
+  qInfo().nospace() << "Idle compaction: reclaimed " << (total / 1024)
+                    << " KiB (buffer pool " << (pool / 1024) << " KiB, "
+                    << "console " << (console / 1024) << " KiB, "
+                    << "dashboard " << (dashboard / 1024) << " KiB)";
+}
@@ -0,0 +1,75 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QObject>
+
+namespace Misc
+{
+/**
+ * @class Misc::MemoryCompactor
+ * @brief Idle-time memory reclamation for long-running sessions.
+ *
+ * Resident memory creeps up over multi-week runs: the receive buffer pool
+ * parks blocks sized for the worst burst, the console's line offset table
+ * keeps capacity for scrolled-out lines, and the dashboard's handoff queues
+ * grow to the largest batch ever seen. None of that slack returns on its
+ * own, because the owning containers are deliberately never shrunk on the
+ * hot path.
+ *
+ * This module watches the ingest activity at a 1 Hz cadence and, once the
+ * link has been quiet for a sustained stretch, runs a single compaction pass
+ * over the known slack holders. The reclaimed amounts are logged per
+ * subsystem so stations running against a memory budget can verify the
+ * effect. One pass runs per idle period; the buffers regrow to their working
+ * set as soon as traffic resumes, so compacting never costs anything while
+ * data is flowing.
+ */
+class MemoryCompactor : public QObject
+{
+  Q_OBJECT
+
+private:
+  explicit MemoryCompactor();
+  MemoryCompactor(MemoryCompactor &&) = delete;
+  MemoryCompactor(const MemoryCompactor &) = delete;
+  MemoryCompactor &operator=(MemoryCompactor &&) = delete;
+  MemoryCompactor &operator=(const MemoryCompactor &) = delete;
+
+public:
+  static MemoryCompactor &instance();
+
+private slots:
+  void onTimerTick();
+
+private:
+  void compact();
+
+private:
+  static constexpr int QuietSeconds = 30;
+  static constexpr double QuietRateThreshold = 256.0;
+
+private:
+  bool m_compacted;
+  int m_quietSeconds;
+};
+} // namespace Misc
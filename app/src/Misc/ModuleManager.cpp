@@ -20,7 +20,11 @@
  */
 
 #include <iostream>
+#include <QTimer>
+#include <QSettings>
+#include <QApplication>
 #include <QQuickWindow>
+#include <QElapsedTimer>
 #include <QSimpleUpdater.h>
 
 #include "AppInfo.h"
@@ -38,16 +42,26 @@
 #include "IO/Manager.h"
 #include "IO/Console.h"
 #include "IO/ConsoleExport.h"
+#include "IO/ConsoleLogger.h"
+#include "IO/CaptureRecorder.h"
+#include "IO/CommandSequencer.h"
+#include "IO/ControlLoop.h"
 #include "IO/FileTransmission.h"
 
 #include "IO/Drivers/UART.h"
 #include "IO/Drivers/Network.h"
 #include "IO/Drivers/BluetoothLE.h"
+#include "IO/Drivers/FileReplay.h"
 
 #include "Misc/Utilities.h"
 #include "Misc/Translator.h"
+#include "Misc/LatencyMonitor.h"
+#include "Misc/AllocationTracker.h"
+#include "Misc/Watchdog.h"
+#include "Misc/MemoryCompactor.h"
 #include "Misc/CommonFonts.h"
 #include "Misc/TimerEvents.h"
+#include "Misc/Settings.h"
 #include "Misc/ThemeManager.h"
 #include "Misc/ModuleManager.h"
 
@@ -57,6 +71,7 @@
 #include "UI/Dashboard.h"
 #include "UI/WindowManager.h"
 #include "UI/DashboardWidget.h"
+#include "UI/WidgetProfiler.h"
 
 #include "UI/Widgets/Bar.h"
 #include "UI/Widgets/GPS.h"
@@ -68,7 +83,11 @@
 #include "UI/Widgets/LEDPanel.h"
 #include "UI/Widgets/Terminal.h"
 #include "UI/Widgets/Gyroscope.h"
+#include "UI/Widgets/Histogram.h"
+#include "UI/Widgets/ImageFeed.h"
 #include "UI/Widgets/MultiPlot.h"
+#include "UI/Widgets/Scatter.h"
+#include "UI/Widgets/Spectrogram.h"
 #include "UI/Widgets/Accelerometer.h"
 
 #ifdef USE_QT_COMMERCIAL
@@ -190,8 +209,12 @@ void Misc::ModuleManager::onQuit()
 
   CSV::Export::instance().closeFile();
   CSV::Player::instance().closeFile();
+  IO::CaptureRecorder::instance().closeFile();
+  IO::ConsoleLogger::instance().closeFile();
   IO::Manager::instance().disconnectDevice();
   Plugins::Server::instance().removeConnection();
+
+  Misc::Settings::instance().sync();
 }
 
 /**
@@ -227,6 +250,11 @@ void Misc::ModuleManager::registerQmlTypes()
   qmlRegisterType<Widgets::Terminal>("SerialStudio", 1, 0, "TerminalWidget");
   qmlRegisterType<Widgets::MultiPlot>("SerialStudio", 1, 0, "MultiPlotModel");
   qmlRegisterType<Widgets::Gyroscope>("SerialStudio", 1, 0, "GyroscopeModel");
+  qmlRegisterType<Widgets::Histogram>("SerialStudio", 1, 0, "HistogramModel");
+  qmlRegisterType<Widgets::ImageFeed>("SerialStudio", 1, 0, "ImageFeedModel");
+  qmlRegisterType<Widgets::Scatter>("SerialStudio", 1, 0, "ScatterModel");
+  qmlRegisterType<Widgets::Spectrogram>("SerialStudio", 1, 0,
+                                        "SpectrogramModel");
   qmlRegisterType<Widgets::Accelerometer>("SerialStudio", 1, 0,
                                           "AccelerometerModel");
 
@@ -253,51 +281,200 @@ void Misc::ModuleManager::registerQmlTypes()
       });
 }
 
+/**
+ * Initializes the data-pipeline modules without loading the QML interface.
+ *
+ * Used for gateway deployments, where Serial Studio only parses frames and
+ * forwards them over MQTT, the plugin bridge or CSV/console logs: the Quick
+ * scene, the dashboard widget models and the window system are never created,
+ * which removes the GPU requirement and most of the memory footprint. The
+ * configured device is opened as soon as the event loop turns, and the
+ * process runs until it is terminated.
+ */
+void Misc::ModuleManager::initializeHeadless()
+{
+  // Measure the construction cost of every module
+  QElapsedTimer stopwatch;
+  stopwatch.start();
+  const auto construct = [&](const char *name, const auto &instance) {
+    const qint64 start = stopwatch.nsecsElapsed();
+    auto module = instance();
+    m_startupTimeline.append(qMakePair(QString::fromLatin1(name),
+                                       stopwatch.nsecsElapsed() - start));
+    return module;
+  };
+
+  // Initialize licensing module first
+#ifdef USE_QT_COMMERCIAL
+  construct("Licensing::LemonSqueezy", [] {
+    return &Licensing::LemonSqueezy::instance();
+  });
+#endif
+
+  // clang-format off
+
+  // Initialize the IO → frame parsing → forwarding modules; everything that
+  // only exists to feed the user interface (dashboard, widgets, themes,
+  // fonts, the memory compactor that trims the sample buffers it owns) is
+  // deliberately left unconstructed
+  construct("CSV::Export", [] { return &CSV::Export::instance(); });
+  auto ioManager = construct("IO::Manager", [] { return &IO::Manager::instance(); });
+  auto ioConsole = construct("IO::Console", [] { return &IO::Console::instance(); });
+  construct("IO::Drivers::UART", [] { return &IO::Drivers::UART::instance(); });
+  construct("Plugins::Server", [] { return &Plugins::Server::instance(); });
+  construct("IO::Drivers::Network", [] { return &IO::Drivers::Network::instance(); });
+  auto frameBuilder = construct("JSON::FrameBuilder", [] { return &JSON::FrameBuilder::instance(); });
+  construct("JSON::ProjectModel", [] { return &JSON::ProjectModel::instance(); });
+  auto miscTimerEvents = construct("Misc::TimerEvents", [] { return &Misc::TimerEvents::instance(); });
+  construct("IO::ConsoleExport", [] { return &IO::ConsoleExport::instance(); });
+  construct("IO::ConsoleLogger", [] { return &IO::ConsoleLogger::instance(); });
+  construct("IO::CaptureRecorder", [] { return &IO::CaptureRecorder::instance(); });
+  construct("IO::CommandSequencer", [] { return &IO::CommandSequencer::instance(); });
+  construct("IO::ControlLoop", [] { return &IO::ControlLoop::instance(); });
+  construct("IO::Drivers::BluetoothLE", [] { return &IO::Drivers::BluetoothLE::instance(); });
+  construct("IO::Drivers::FileReplay", [] { return &IO::Drivers::FileReplay::instance(); });
+  construct("Misc::Watchdog", [] { return &Misc::Watchdog::instance(); });
+
+  // Initialize commercial modules
+#ifdef USE_QT_COMMERCIAL
+  construct("MQTT::Client", [] { return &MQTT::Client::instance(); });
+#endif
+
+  // clang-format on
+
+  // Start common event timers
+  miscTimerEvents->startTimers();
+
+  // Drive the adaptive refresh governor with data activity, the low-rate
+  // timers still pace CSV flushing & the plugin bridge
+  connect(ioManager, &IO::Manager::dataReceived, miscTimerEvents,
+          &Misc::TimerEvents::registerActivity);
+  connect(ioConsole, &IO::Console::displayString, miscTimerEvents,
+          &Misc::TimerEvents::registerActivity);
+  connect(frameBuilder, &JSON::FrameBuilder::frameChanged, miscTimerEvents,
+          &Misc::TimerEvents::registerActivity);
+
+  // Stop modules when the application is about to quit; no QML engine is
+  // loaded in this mode, so the usual engine quit signal never fires
+  connect(qApp, &QApplication::aboutToQuit, this,
+          &Misc::ModuleManager::onQuit);
+
+  // Setup singleton module interconnections
+  IO::Drivers::UART::instance().setupExternalConnections();
+  CSV::Export::instance().setupExternalConnections();
+  IO::Console::instance().setupExternalConnections();
+  IO::Manager::instance().setupExternalConnections();
+  JSON::ProjectModel::instance().setupExternalConnections();
+  JSON::FrameBuilder::instance().setupExternalConnections();
+  IO::ConsoleExport::instance().setupExternalConnections();
+  IO::ConsoleLogger::instance().setupExternalConnections();
+  IO::CaptureRecorder::instance().setupExternalConnections();
+  IO::CommandSequencer::instance().setupExternalConnections();
+  IO::ControlLoop::instance().setupExternalConnections();
+
+  // License validation is event-driven: the licensing module decrypts its
+  // cached grant on a background thread and schedules the server refresh
+  // itself once the offline grant has been applied
+
+  // Connect to the configured device as soon as the event loop is running,
+  // a gateway box has no setup pane to press "Connect" on
+  QMetaObject::invokeMethod(&IO::Manager::instance(),
+                            &IO::Manager::connectDevice, Qt::QueuedConnection);
+
+  // Report per-module startup cost
+  reportStartupTimeline();
+}
+
 /**
  * Initializes all the application modules, registers them with the QML engine
  * and loads the "main.qml" file as the root QML file.
+ *
+ * Every singleton whose context property is read by main.qml at load time
+ * must exist before the engine loads the interface, so those modules are
+ * constructed here — but each construction is timed individually and the
+ * resulting startup timeline is printed once the interface is up, so cold
+ * start regressions can be attributed to a specific module. Work that the
+ * user cannot observe before the event loop turns (cross-module signal
+ * wiring, updater configuration, license validation) is deferred to
+ * @c finishStartup() so it never delays the first frame.
  */
 void Misc::ModuleManager::initializeQmlInterface()
 {
+  // Measure the construction cost of every module
+  QElapsedTimer stopwatch;
+  stopwatch.start();
+  const auto construct = [&](const char *name, const auto &instance) {
+    const qint64 start = stopwatch.nsecsElapsed();
+    auto module = instance();
+    m_startupTimeline.append(qMakePair(QString::fromLatin1(name),
+                                       stopwatch.nsecsElapsed() - start));
+    return module;
+  };
+
   // Initialize licensing module first
 #ifdef USE_QT_COMMERCIAL
-  auto lemonSqueezy = &Licensing::LemonSqueezy::instance();
+  auto lemonSqueezy = construct("Licensing::LemonSqueezy", [] {
+    return &Licensing::LemonSqueezy::instance();
+  });
 #endif
 
+  // clang-format off
+
   // Initialize modules
-  auto csvExport = &CSV::Export::instance();
-  auto csvPlayer = &CSV::Player::instance();
-  auto ioManager = &IO::Manager::instance();
-  auto ioConsole = &IO::Console::instance();
-  auto uiDashboard = &UI::Dashboard::instance();
-  auto ioSerial = &IO::Drivers::UART::instance();
-  auto pluginsBridge = &Plugins::Server::instance();
-  auto miscUtilities = &Misc::Utilities::instance();
-  auto ioNetwork = &IO::Drivers::Network::instance();
-  auto frameBuilder = &JSON::FrameBuilder::instance();
-  auto miscTranslator = &Misc::Translator::instance();
-  auto projectModel = &JSON::ProjectModel::instance();
-  auto miscTimerEvents = &Misc::TimerEvents::instance();
-  auto miscCommonFonts = &Misc::CommonFonts::instance();
-  auto ioConsoleExport = &IO::ConsoleExport::instance();
-  auto miscThemeManager = &Misc::ThemeManager::instance();
-  auto ioBluetoothLE = &IO::Drivers::BluetoothLE::instance();
-  auto ioFileTransmission = &IO::FileTransmission::instance();
+  auto csvExport = construct("CSV::Export", [] { return &CSV::Export::instance(); });
+  auto csvPlayer = construct("CSV::Player", [] { return &CSV::Player::instance(); });
+  auto ioManager = construct("IO::Manager", [] { return &IO::Manager::instance(); });
+  auto ioConsole = construct("IO::Console", [] { return &IO::Console::instance(); });
+  auto uiDashboard = construct("UI::Dashboard", [] { return &UI::Dashboard::instance(); });
+  auto uiWidgetProfiler = construct("UI::WidgetProfiler", [] { return &UI::WidgetProfiler::instance(); });
+  auto ioSerial = construct("IO::Drivers::UART", [] { return &IO::Drivers::UART::instance(); });
+  auto pluginsBridge = construct("Plugins::Server", [] { return &Plugins::Server::instance(); });
+  auto miscUtilities = construct("Misc::Utilities", [] { return &Misc::Utilities::instance(); });
+  auto ioNetwork = construct("IO::Drivers::Network", [] { return &IO::Drivers::Network::instance(); });
+  auto frameBuilder = construct("JSON::FrameBuilder", [] { return &JSON::FrameBuilder::instance(); });
+  auto miscTranslator = construct("Misc::Translator", [] { return &Misc::Translator::instance(); });
+  auto projectModel = construct("JSON::ProjectModel", [] { return &JSON::ProjectModel::instance(); });
+  auto miscTimerEvents = construct("Misc::TimerEvents", [] { return &Misc::TimerEvents::instance(); });
+  auto miscCommonFonts = construct("Misc::CommonFonts", [] { return &Misc::CommonFonts::instance(); });
+  auto ioConsoleExport = construct("IO::ConsoleExport", [] { return &IO::ConsoleExport::instance(); });
+  auto ioConsoleLogger = construct("IO::ConsoleLogger", [] { return &IO::ConsoleLogger::instance(); });
+  auto ioCaptureRecorder = construct("IO::CaptureRecorder", [] { return &IO::CaptureRecorder::instance(); });
+  auto ioCommandSequencer = construct("IO::CommandSequencer", [] { return &IO::CommandSequencer::instance(); });
+  auto ioControlLoop = construct("IO::ControlLoop", [] { return &IO::ControlLoop::instance(); });
+  auto miscThemeManager = construct("Misc::ThemeManager", [] { return &Misc::ThemeManager::instance(); });
+  auto ioBluetoothLE = construct("IO::Drivers::BluetoothLE", [] { return &IO::Drivers::BluetoothLE::instance(); });
+  auto ioFileReplay = construct("IO::Drivers::FileReplay", [] { return &IO::Drivers::FileReplay::instance(); });
+  auto ioFileTransmission = construct("IO::FileTransmission", [] { return &IO::FileTransmission::instance(); });
+  auto miscLatencyMonitor = construct("Misc::LatencyMonitor", [] { return &Misc::LatencyMonitor::instance(); });
+  auto miscAllocationTracker = construct("Misc::AllocationTracker", [] { return &Misc::AllocationTracker::instance(); });
+  auto miscWatchdog = construct("Misc::Watchdog", [] { return &Misc::Watchdog::instance(); });
+  auto miscMemoryCompactor = construct("Misc::MemoryCompactor", [] { return &Misc::MemoryCompactor::instance(); });
 
   // Initialize commercial modules
 #ifdef USE_QT_COMMERCIAL
   const bool qtCommercialAvailable = true;
-  auto mqttClient = &MQTT::Client::instance();
+  auto mqttClient = construct("MQTT::Client", [] { return &MQTT::Client::instance(); });
 #else
   const bool qtCommercialAvailable = false;
 #endif
 
   // Initialize third-party modules
-  auto updater = QSimpleUpdater::getInstance();
+  auto updater = construct("QSimpleUpdater", [] { return QSimpleUpdater::getInstance(); });
+
+  // clang-format on
 
   // Start common event timers
   miscTimerEvents->startTimers();
 
+  // Drive the adaptive refresh governor with data activity, so that the
+  // high-rate UI timers only run while data is actually flowing
+  connect(ioManager, &IO::Manager::dataReceived, miscTimerEvents,
+          &Misc::TimerEvents::registerActivity);
+  connect(ioConsole, &IO::Console::displayString, miscTimerEvents,
+          &Misc::TimerEvents::registerActivity);
+  connect(frameBuilder, &JSON::FrameBuilder::frameChanged, miscTimerEvents,
+          &Misc::TimerEvents::registerActivity);
+
   // Retranslate the QML interface automatically
   connect(miscTranslator, &Misc::Translator::languageChanged, &m_engine,
           &QQmlApplicationEngine::retranslate);
@@ -316,10 +493,12 @@ void Misc::ModuleManager::initializeQmlInterface()
   c->setContextProperty("Cpp_IO_Manager", ioManager);
   c->setContextProperty("Cpp_IO_Network", ioNetwork);
   c->setContextProperty("Cpp_UI_Dashboard", uiDashboard);
+  c->setContextProperty("Cpp_UI_WidgetProfiler", uiWidgetProfiler);
   c->setContextProperty("Cpp_NativeWindow", &m_nativeWindow);
   c->setContextProperty("Cpp_Plugins_Bridge", pluginsBridge);
   c->setContextProperty("Cpp_Misc_Utilities", miscUtilities);
   c->setContextProperty("Cpp_IO_Bluetooth_LE", ioBluetoothLE);
+  c->setContextProperty("Cpp_IO_FileReplay", ioFileReplay);
   c->setContextProperty("Cpp_ThemeManager", miscThemeManager);
   c->setContextProperty("Cpp_Misc_Translator", miscTranslator);
   c->setContextProperty("Cpp_JSON_ProjectModel", projectModel);
@@ -327,7 +506,15 @@ void Misc::ModuleManager::initializeQmlInterface()
   c->setContextProperty("Cpp_Misc_TimerEvents", miscTimerEvents);
   c->setContextProperty("Cpp_Misc_CommonFonts", miscCommonFonts);
   c->setContextProperty("Cpp_IO_ConsoleExport", ioConsoleExport);
+  c->setContextProperty("Cpp_IO_ConsoleLogger", ioConsoleLogger);
+  c->setContextProperty("Cpp_IO_CaptureRecorder", ioCaptureRecorder);
+  c->setContextProperty("Cpp_IO_CommandSequencer", ioCommandSequencer);
+  c->setContextProperty("Cpp_IO_ControlLoop", ioControlLoop);
   c->setContextProperty("Cpp_IO_FileTransmission", ioFileTransmission);
+  c->setContextProperty("Cpp_Misc_LatencyMonitor", miscLatencyMonitor);
+  c->setContextProperty("Cpp_Misc_AllocationTracker", miscAllocationTracker);
+  c->setContextProperty("Cpp_Misc_Watchdog", miscWatchdog);
+  c->setContextProperty("Cpp_Misc_MemoryCompactor", miscMemoryCompactor);
   c->setContextProperty("Cpp_QtCommercial_Available", qtCommercialAvailable);
 
   // Register commercial C++ modules with QML
@@ -347,25 +534,86 @@ void Misc::ModuleManager::initializeQmlInterface()
   c->setContextProperty("Cpp_PrimaryScreen", qApp->primaryScreen());
   c->setContextProperty("Cpp_AppOrganizationDomain", APP_SUPPORT_URL);
 
+  // Register the image feed provider (the engine takes ownership)
+  m_engine.addImageProvider(QStringLiteral("imagefeed"),
+                            Widgets::ImageFeedProvider::instance());
+
   // Load main.qml
+  const qint64 loadStart = stopwatch.nsecsElapsed();
   const auto url = QStringLiteral("qrc:/serial-studio.com/gui/qml/main.qml");
   m_engine.load(QUrl(url));
-
-  // Setup singleton module interconnections
-  ioSerial->setupExternalConnections();
-  csvExport->setupExternalConnections();
-  ioConsole->setupExternalConnections();
-  ioManager->setupExternalConnections();
-  projectModel->setupExternalConnections();
-  frameBuilder->setupExternalConnections();
-  ioConsoleExport->setupExternalConnections();
+  m_startupTimeline.append(qMakePair(QStringLiteral("QML engine load"),
+                                     stopwatch.nsecsElapsed() - loadStart));
 
   // Install custom message handler to redirect qDebug output to console
   qInstallMessageHandler(MessageHandler);
 
-  // Try to contact activation server to validate license
-#ifdef USE_QT_COMMERCIAL
-  if (!lemonSqueezy->licensingData().isEmpty())
-    QMetaObject::invokeMethod(lemonSqueezy, &Licensing::LemonSqueezy::validate);
-#endif
+  // Finish non-critical startup work once the event loop is running
+  QTimer::singleShot(0, this, &Misc::ModuleManager::finishStartup);
+}
+
+/**
+ * Completes the startup work that does not need to happen before the first
+ * frame is rendered: cross-module signal wiring, updater configuration and
+ * license validation. Runs on the first event-loop pass after the QML
+ * interface has been loaded, then prints the startup timeline.
+ */
+void Misc::ModuleManager::finishStartup()
+{
+  QElapsedTimer stopwatch;
+  stopwatch.start();
+
+  // Setup singleton module interconnections
+  IO::Drivers::UART::instance().setupExternalConnections();
+  CSV::Export::instance().setupExternalConnections();
+  IO::Console::instance().setupExternalConnections();
+  IO::Manager::instance().setupExternalConnections();
+  JSON::ProjectModel::instance().setupExternalConnections();
+  JSON::FrameBuilder::instance().setupExternalConnections();
+  IO::ConsoleExport::instance().setupExternalConnections();
+  IO::ConsoleLogger::instance().setupExternalConnections();
+  IO::CaptureRecorder::instance().setupExternalConnections();
+  IO::CommandSequencer::instance().setupExternalConnections();
+  IO::ControlLoop::instance().setupExternalConnections();
+  m_startupTimeline.append(qMakePair(
+      QStringLiteral("Module interconnections"), stopwatch.nsecsElapsed()));
+
+  // Configure the auto-updater
+  stopwatch.restart();
+  configureUpdater();
+  m_startupTimeline.append(qMakePair(QStringLiteral("Updater configuration"),
+                                     stopwatch.nsecsElapsed()));
+
+  // License validation is event-driven: the licensing module decrypts its
+  // cached grant on a background thread and schedules the server refresh
+  // itself once the offline grant has been applied
+
+  // Reconnect to the configured device when the previous session was live
+  // (ended while connected or terminated by a crash), so a field operator is
+  // back to streaming data without touching the setup pane
+  QSettings settings;
+  if (settings.value(QStringLiteral("session/liveConnection"), false).toBool())
+    QMetaObject::invokeMethod(&IO::Manager::instance(),
+                              &IO::Manager::connectDevice,
+                              Qt::QueuedConnection);
+
+  // Report per-module startup cost
+  reportStartupTimeline();
+}
+
+/**
+ * Prints the time spent constructing each module during startup, so that
+ * cold-start regressions can be traced back to the module that caused them.
+ */
+void Misc::ModuleManager::reportStartupTimeline() const
+{
+  qint64 total = 0;
+  for (const auto &entry : m_startupTimeline)
+    total += entry.second;
+
+  qInfo() << "Startup timeline:";
+  for (const auto &entry : m_startupTimeline)
+    qInfo().nospace() << "  " << qPrintable(entry.first) << ": "
+                      << double(entry.second) / 1e6 << " ms";
+  qInfo().nospace() << "  Total: " << double(total) / 1e6 << " ms";
 }
@@ -21,7 +21,9 @@
 
 #pragma once
 
+#include <QPair>
 #include <QObject>
+#include <QVector>
 #include <QQmlApplicationEngine>
 
 #include "Platform/NativeWindow.h"
@@ -49,10 +51,18 @@ public slots:
   void onQuit();
   void configureUpdater();
   void registerQmlTypes();
+  void initializeHeadless();
   void initializeQmlInterface();
 
+private slots:
+  void finishStartup();
+
+private:
+  void reportStartupTimeline() const;
+
 private:
   NativeWindow m_nativeWindow;
   QQmlApplicationEngine m_engine;
+  QVector<QPair<QString, qint64>> m_startupTimeline;
 };
 } // namespace Misc
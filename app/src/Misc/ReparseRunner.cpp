@@ -0,0 +1,279 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/ReparseRunner.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QCoreApplication>
+
+#include "CSV/Export.h"
+#include "IO/Manager.h"
+#include "IO/Drivers/FileReplay.h"
+#include "JSON/FrameBuilder.h"
+#include "Misc/TimerEvents.h"
+
+/**
+ * @brief Constructs the re-parse runner with empty counters.
+ */
+Misc::ReparseRunner::ReparseRunner(QObject *parent)
+  : QObject(parent)
+  , m_currentIndex(0)
+  , m_totalBytes(0)
+  , m_processedBytes(0)
+  , m_extractedFrames(0)
+  , m_parsedFrames(0)
+  , m_lastExtracted(0)
+  , m_lastParsed(0)
+  , m_lastBytes(0)
+{
+}
+
+/**
+ * @brief Collects the capture segments & options from the command line.
+ *
+ * The first positional argument after "--reparse" is the capture to process:
+ * a single segment file, or a directory whose "*.bin" segments are re-parsed
+ * in name order. An optional second argument selects a project file, which
+ * overrides the saved operation mode & parser script.
+ *
+ * @return @c true when the arguments name at least one capture segment.
+ */
+bool Misc::ReparseRunner::configure(const QStringList &arguments)
+{
+  const int base = arguments.indexOf(QStringLiteral("--reparse")) + 1;
+  const auto argAt = [&](const int offset) -> QString {
+    const int index = base + offset;
+    return index < arguments.count() ? arguments.at(index) : QString();
+  };
+
+  // Expand the capture argument into the ordered segment list
+  const QFileInfo capture(argAt(0));
+  if (capture.isFile() && capture.size() > 0)
+    m_captures.append(capture.absoluteFilePath());
+
+  else if (capture.isDir())
+  {
+    const QDir dir(capture.absoluteFilePath());
+    const auto segments = dir.entryList(QStringList{QStringLiteral("*.bin")},
+                                        QDir::Files, QDir::Name);
+    for (const auto &segment : segments)
+      m_captures.append(dir.absoluteFilePath(segment));
+  }
+
+  // Validate the optional project file
+  bool ok = !m_captures.isEmpty();
+  if (ok && !argAt(1).isEmpty())
+  {
+    const QFileInfo project(argAt(1));
+    ok = project.isFile();
+    if (ok)
+      m_projectPath = project.absoluteFilePath();
+  }
+
+  if (!ok)
+    qInfo() << "Usage: --reparse <capture file|directory> [project file]";
+
+  return ok;
+}
+
+/**
+ * @brief Wires up the processing chain and re-parses every segment.
+ *
+ * Brings up the pipeline exactly as the GUI would (minus the QML engine):
+ * the file replay driver feeds the frame reader worker with the throttle
+ * removed, extracted frames flow through the frame builder (scattering over
+ * the parser pool) and the resulting frames are recorded in the columnar
+ * binary format by the CSV export worker. Progress is reported once per
+ * second while segments are processed back to back.
+ *
+ * @return The application exit code.
+ */
+int Misc::ReparseRunner::exec()
+{
+  auto &manager = IO::Manager::instance();
+  auto &builder = JSON::FrameBuilder::instance();
+  auto &replay = IO::Drivers::FileReplay::instance();
+  auto &exporter = CSV::Export::instance();
+
+  // Override the saved parser & frame layout with the requested project; the
+  // project loads on a background thread, so the first segment is deferred
+  // until the validated model has been swapped in
+  bool waitForProject = false;
+  if (!m_projectPath.isEmpty())
+  {
+    waitForProject = true;
+    builder.setOperationMode(SerialStudio::ProjectFile);
+    builder.loadJsonMap(m_projectPath);
+  }
+
+  // Same module wiring the GUI performs during startup
+  manager.setupExternalConnections();
+  builder.setupExternalConnections();
+  exporter.setupExternalConnections();
+  Misc::TimerEvents::instance().startTimers();
+  connect(&manager, &IO::Manager::dataReceived,
+          &Misc::TimerEvents::instance(), &Misc::TimerEvents::registerActivity);
+
+  // Record parsed frames in the columnar binary format
+  exporter.setBinaryFormat(true);
+  exporter.setExportEnabled(true);
+
+  // Stream the captures at disk speed through the replay driver
+  replay.setSpeedMultiplier(0);
+  manager.setBusType(SerialStudio::BusType::FileReplay);
+
+  // Count frames as they pass through each stage
+  connect(&manager, &IO::Manager::framesReceived, this,
+          [this](const QVector<QByteArray> &frames) {
+            m_extractedFrames += frames.count();
+          });
+  connect(&builder, &JSON::FrameBuilder::frameChanged, this,
+          [this] { ++m_parsedFrames; });
+
+  // Advance to the next segment once a replay ends; the queued connection
+  // lets frame batches already in flight reach the builder & exporter first
+  connect(&replay, &IO::Drivers::FileReplay::replayFinished, this,
+          &ReparseRunner::nextSegment, Qt::QueuedConnection);
+
+  // Report throughput once per second
+  m_reportTimer.setInterval(1000);
+  connect(&m_reportTimer, &QTimer::timeout, this,
+          &ReparseRunner::reportProgress);
+
+  // Account the total workload for the final summary
+  for (const auto &path : std::as_const(m_captures))
+    m_totalBytes += quint64(QFileInfo(path).size());
+
+  qInfo().nospace() << "Reparse: " << m_captures.count() << " segment(s), "
+                    << double(m_totalBytes) / (1024.0 * 1024.0) << " MB";
+
+  // Open the first segment & enter the event loop; when a project override
+  // is still loading, replay starts once the model swap has been committed
+  m_elapsed.start();
+  m_reportTimer.start();
+  if (waitForProject)
+  {
+    connect(&builder, &JSON::FrameBuilder::jsonFileMapChanged, this,
+            [this] {
+              if (!startSegment())
+                qApp->exit(EXIT_FAILURE);
+            },
+            Qt::SingleShotConnection);
+  }
+
+  else if (!startSegment())
+    return EXIT_FAILURE;
+
+  return qApp->exec();
+}
+
+/**
+ * @brief Opens the current capture segment through the I/O manager.
+ *
+ * @return @c true when the segment was opened for replay.
+ */
+bool Misc::ReparseRunner::startSegment()
+{
+  auto &manager = IO::Manager::instance();
+  auto &replay = IO::Drivers::FileReplay::instance();
+
+  const auto &path = m_captures.at(m_currentIndex);
+  replay.setFilePath(path);
+  manager.connectDevice();
+  if (!manager.isConnected())
+  {
+    qInfo() << "Reparse: unable to open" << path;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Closes the finished segment & opens the next one, if any.
+ */
+void Misc::ReparseRunner::nextSegment()
+{
+  m_processedBytes += quint64(QFileInfo(m_captures.at(m_currentIndex)).size());
+
+  // Closing the connection also flushes & closes the segment's recording
+  IO::Manager::instance().disconnectDevice();
+
+  ++m_currentIndex;
+  if (m_currentIndex >= m_captures.count())
+    finish();
+
+  else if (!startSegment())
+    qApp->exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Prints the per-second throughput of the re-parse.
+ */
+void Misc::ReparseRunner::reportProgress()
+{
+  auto &replay = IO::Drivers::FileReplay::instance();
+
+  // Account the bytes already streamed out of the current segment
+  quint64 bytes = m_processedBytes;
+  if (m_currentIndex < m_captures.count())
+    bytes += quint64(replay.progress()
+                     * qreal(QFileInfo(m_captures.at(m_currentIndex)).size()));
+
+  qInfo().nospace() << "segment " << (m_currentIndex + 1) << "/"
+                    << m_captures.count() << " | "
+                    << double(bytes - m_lastBytes) / (1024.0 * 1024.0)
+                    << " MB/s | extracted "
+                    << (m_extractedFrames - m_lastExtracted) << "/s"
+                    << " | parsed " << (m_parsedFrames - m_lastParsed) << "/s";
+
+  m_lastBytes = bytes;
+  m_lastExtracted = m_extractedFrames;
+  m_lastParsed = m_parsedFrames;
+}
+
+/**
+ * @brief Prints the final summary and terminates the event loop.
+ */
+void Misc::ReparseRunner::finish()
+{
+  m_reportTimer.stop();
+
+  // Flush any frames still buffered for the recording
+  CSV::Export::instance().closeFile();
+
+  const double seconds = double(m_elapsed.elapsed()) / 1000.0;
+  auto &manager = IO::Manager::instance();
+
+  qInfo() << "Reparse finished:";
+  qInfo().nospace() << "  bytes processed  " << m_processedBytes;
+  qInfo().nospace() << "  frames extracted " << m_extractedFrames;
+  qInfo().nospace() << "  frames parsed    " << m_parsedFrames;
+  qInfo().nospace() << "  elapsed          " << seconds << " s";
+  qInfo().nospace() << "  throughput       "
+                    << double(m_processedBytes) / (1024.0 * 1024.0) / seconds
+                    << " MB/s";
+  qInfo().nospace() << "  dropped bytes    " << manager.droppedBytes();
+  qInfo().nospace() << "  crc rejects      " << manager.checksumErrors();
+
+  qApp->exit(EXIT_SUCCESS);
+}
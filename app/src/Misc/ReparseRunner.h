@@ -0,0 +1,86 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QTimer>
+#include <QObject>
+#include <QStringList>
+#include <QElapsedTimer>
+
+namespace Misc
+{
+/**
+ * @class Misc::ReparseRunner
+ * @brief Headless batch re-parse harness for raw capture archives.
+ *
+ * Streams recorded wire captures through the real processing chain — the
+ * file replay driver into IO::Manager -> FrameReader -> JSON::FrameBuilder —
+ * with the replay unthrottled, so an improved parser or project file can be
+ * re-run over an archived session at disk speed. Frame parsing scatters over
+ * the per-thread script engine pool exactly as it does live, and the parsed
+ * frames are written out as the columnar binary recording through the CSV
+ * export worker.
+ *
+ * The capture argument may be a single segment or a directory, in which case
+ * every "*.bin" segment is re-parsed in name order (capture sessions rotate
+ * into numbered segments, so name order is stream order). Each segment
+ * produces its own recording file, mirroring the segmentation of the input.
+ *
+ * Invoked with:
+ *   serial-studio --reparse <capture file|directory> [project file]
+ * where the optional project file overrides the saved parser & frame layout.
+ */
+class ReparseRunner : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit ReparseRunner(QObject *parent = nullptr);
+
+  bool configure(const QStringList &arguments);
+  int exec();
+
+private slots:
+  void nextSegment();
+  void reportProgress();
+
+private:
+  bool startSegment();
+  void finish();
+
+private:
+  int m_currentIndex;
+  QString m_projectPath;
+  QStringList m_captures;
+
+  quint64 m_totalBytes;
+  quint64 m_processedBytes;
+  quint64 m_extractedFrames;
+  quint64 m_parsedFrames;
+  quint64 m_lastExtracted;
+  quint64 m_lastParsed;
+  quint64 m_lastBytes;
+
+  QTimer m_reportTimer;
+  QElapsedTimer m_elapsed;
+};
+} // namespace Misc
@@ -0,0 +1,96 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/Settings.h"
+#include "Misc/TimerEvents.h"
+
+/**
+ * @brief Connects the deferred flush to the 1 Hz heartbeat.
+ */
+Misc::Settings::Settings()
+  : m_dirty(false)
+{
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &Misc::Settings::sync);
+}
+
+/**
+ * @brief Retrieves the singleton instance of the settings cache.
+ */
+Misc::Settings &Misc::Settings::instance()
+{
+  static Settings instance;
+  return instance;
+}
+
+/**
+ * @brief Returns the value stored for the given @a key.
+ *
+ * Served from the in-memory copy when available; the first access to a key
+ * reads it from storage and caches the result.
+ */
+QVariant Misc::Settings::value(const QString &key,
+                               const QVariant &defaultValue)
+{
+  const auto it = m_cache.constFind(key);
+  if (it != m_cache.cend())
+    return *it;
+
+  const auto stored = m_settings.value(key, defaultValue);
+  m_cache.insert(key, stored);
+  return stored;
+}
+
+/**
+ * @brief Writes every dirty key to storage.
+ *
+ * Called by the 1 Hz heartbeat and on application exit; a no-op when nothing
+ * changed since the previous flush.
+ */
+void Misc::Settings::sync()
+{
+  if (!m_dirty)
+    return;
+
+  for (const auto &key : m_dirtyKeys)
+    m_settings.setValue(key, m_cache.value(key));
+
+  m_dirtyKeys.clear();
+  m_dirty = false;
+  m_settings.sync();
+}
+
+/**
+ * @brief Updates the in-memory copy of the given @a key & marks it dirty.
+ *
+ * The storage write happens on the next flush; repeated writes of the same
+ * key between flushes cost a hash update each, never a disk access.
+ */
+void Misc::Settings::setValue(const QString &key, const QVariant &value)
+{
+  const auto it = m_cache.constFind(key);
+  if (it != m_cache.cend() && *it == value)
+    return;
+
+  m_cache.insert(key, value);
+  m_dirtyKeys.insert(key);
+  m_dirty = true;
+}
@@ -0,0 +1,72 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QSet>
+#include <QHash>
+#include <QObject>
+#include <QVariant>
+#include <QSettings>
+
+namespace Misc
+{
+/**
+ * @class Misc::Settings
+ * @brief Write-behind cache on top of QSettings.
+ *
+ * Keeps an in-memory authoritative copy of every setting touched through it
+ * and defers the actual storage writes to the 1 Hz heartbeat (and to
+ * application exit), so persisting an option during a live run never stalls
+ * the GUI thread on storage I/O. Reads are served from the cache after the
+ * first access to a key.
+ *
+ * @note This class is implemented as a singleton and is non-copyable and
+ *       non-movable.
+ */
+class Settings : public QObject
+{
+  Q_OBJECT
+
+private:
+  explicit Settings();
+  Settings(Settings &&) = delete;
+  Settings(const Settings &) = delete;
+  Settings &operator=(Settings &&) = delete;
+  Settings &operator=(const Settings &) = delete;
+
+public:
+  static Settings &instance();
+
+  [[nodiscard]] QVariant value(const QString &key,
+                               const QVariant &defaultValue = QVariant());
+
+public slots:
+  void sync();
+  void setValue(const QString &key, const QVariant &value);
+
+private:
+  bool m_dirty;
+  QSettings m_settings;
+  QSet<QString> m_dirtyKeys;
+  QHash<QString, QVariant> m_cache;
+};
+} // namespace Misc
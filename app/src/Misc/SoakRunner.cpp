@@ -0,0 +1,309 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/SoakRunner.h"
+
+#include <QCoreApplication>
+#include <QHostAddress>
+
+#include "IO/Manager.h"
+#include "IO/Drivers/Network.h"
+#include "UI/Dashboard.h"
+#include "JSON/FrameBuilder.h"
+#include "Misc/TimerEvents.h"
+
+/**
+ * @brief UDP port used for the loopback soak stream.
+ */
+static constexpr quint16 SoakUdpPort = 47563;
+
+/**
+ * @brief Constructs the soak runner with the default load profile.
+ */
+Misc::SoakRunner::SoakRunner(QObject *parent)
+  : QObject(parent)
+  , m_duration(30)
+  , m_frameRate(5000)
+  , m_payloadSize(64)
+  , m_corruption(0)
+  , m_jsonMode(false)
+  , m_rngState(0x12345678)
+  , m_sentFrames(0)
+  , m_extractedFrames(0)
+  , m_parsedFrames(0)
+  , m_dashboardUpdates(0)
+  , m_lastSent(0)
+  , m_lastExtracted(0)
+  , m_lastParsed(0)
+  , m_lastUpdates(0)
+{
+}
+
+/**
+ * @brief Parses the load profile from the command line arguments.
+ *
+ * Positional arguments after "--soak" are, in order: duration in seconds,
+ * target frame rate, payload size in bytes, stream mode ("quickplot" or
+ * "json") and per-frame corruption probability. Each one is optional.
+ *
+ * @return @c true when the arguments form a valid profile.
+ */
+bool Misc::SoakRunner::configure(const QStringList &arguments)
+{
+  const int base = arguments.indexOf(QStringLiteral("--soak")) + 1;
+  const auto argAt = [&](const int offset) -> QString {
+    const int index = base + offset;
+    return index < arguments.count() ? arguments.at(index) : QString();
+  };
+
+  bool ok = true;
+  if (!argAt(0).isEmpty())
+    m_duration = argAt(0).toInt(&ok);
+  if (ok && !argAt(1).isEmpty())
+    m_frameRate = argAt(1).toInt(&ok);
+  if (ok && !argAt(2).isEmpty())
+    m_payloadSize = argAt(2).toInt(&ok);
+  if (ok && !argAt(3).isEmpty())
+  {
+    const QString mode = argAt(3).toLower();
+    m_jsonMode = (mode == QStringLiteral("json"));
+    ok = m_jsonMode || mode == QStringLiteral("quickplot");
+  }
+  if (ok && !argAt(4).isEmpty())
+    m_corruption = argAt(4).toDouble(&ok);
+
+  ok = ok && m_duration > 0 && m_frameRate > 0 && m_payloadSize > 0
+       && m_corruption >= 0 && m_corruption <= 1;
+
+  if (!ok)
+    qInfo() << "Usage: --soak [seconds] [rate] [payload] "
+               "[quickplot|json] [corruption]";
+
+  return ok;
+}
+
+/**
+ * @brief Wires up the real processing chain and runs the soak.
+ *
+ * Brings up the pipeline exactly as the GUI would (minus the QML engine):
+ * the Network driver bound to a loopback UDP port feeds the frame reader
+ * worker, extracted frames flow through the frame builder into the
+ * dashboard. The runner then blasts synthetic frames at the configured rate
+ * and reports per-stage counters once per second.
+ *
+ * @return The application exit code.
+ */
+int Misc::SoakRunner::exec()
+{
+  auto &manager = IO::Manager::instance();
+  auto &builder = JSON::FrameBuilder::instance();
+  auto &dashboard = UI::Dashboard::instance();
+  auto &network = IO::Drivers::Network::instance();
+
+  // Configure the operation mode for the requested stream flavor
+  builder.setOperationMode(m_jsonMode ? SerialStudio::DeviceSendsJSON
+                                      : SerialStudio::QuickPlot);
+
+  // Same module wiring the GUI performs during startup
+  manager.setupExternalConnections();
+  builder.setupExternalConnections();
+  Misc::TimerEvents::instance().startTimers();
+  connect(&manager, &IO::Manager::dataReceived,
+          &Misc::TimerEvents::instance(), &Misc::TimerEvents::registerActivity);
+
+  // Count frames as they pass through each stage
+  connect(&manager, &IO::Manager::framesReceived, this,
+          [this](const QVector<QByteArray> &frames) {
+            m_extractedFrames += frames.count();
+          });
+  connect(&builder, &JSON::FrameBuilder::frameChanged, this,
+          [this] { ++m_parsedFrames; });
+  connect(&dashboard, &UI::Dashboard::updated, this,
+          [this] { ++m_dashboardUpdates; });
+
+  // Bring up the loopback UDP source
+  network.setUdpSocket();
+  network.setUdpLocalPort(SoakUdpPort);
+  network.setRemoteAddress(QStringLiteral("127.0.0.1"));
+  manager.setBusType(SerialStudio::BusType::Network);
+  manager.connectDevice();
+  if (!manager.isConnected())
+  {
+    qInfo() << "Soak: unable to open the loopback UDP source";
+    return EXIT_FAILURE;
+  }
+
+  // Pace the generator at 100 ticks per second
+  m_sendTimer.setInterval(10);
+  m_sendTimer.setTimerType(Qt::PreciseTimer);
+  connect(&m_sendTimer, &QTimer::timeout, this, &SoakRunner::sendBatch);
+
+  // Report per-stage counters once per second
+  m_reportTimer.setInterval(1000);
+  connect(&m_reportTimer, &QTimer::timeout, this, &SoakRunner::reportProgress);
+
+  // Stop after the configured duration
+  QTimer::singleShot(m_duration * 1000, this, &SoakRunner::finish);
+
+  qInfo().nospace() << "Soak: " << m_frameRate << " frames/s, "
+                    << m_payloadSize << " byte payload, "
+                    << (m_jsonMode ? "json" : "quickplot") << " mode, "
+                    << m_corruption << " corruption, " << m_duration << " s";
+
+  m_elapsed.start();
+  m_sendTimer.start();
+  m_reportTimer.start();
+  return qApp->exec();
+}
+
+/**
+ * @brief Sends one tick's worth of synthetic frames over the loopback.
+ */
+void Misc::SoakRunner::sendBatch()
+{
+  const int count = qMax(1, m_frameRate / 100);
+  for (int i = 0; i < count; ++i)
+  {
+    QByteArray frame = buildFrame();
+
+    // Corrupt one payload byte with the configured probability
+    if (m_corruption > 0
+        && (nextRandom() % 10000) < quint32(m_corruption * 10000))
+    {
+      const int offset = int(nextRandom() % quint32(frame.size()));
+      frame[offset] = char(frame.at(offset) ^ 0x20);
+    }
+
+    m_socket.writeDatagram(frame, QHostAddress::LocalHost, SoakUdpPort);
+    ++m_sentFrames;
+  }
+}
+
+/**
+ * @brief Prints the per-second counters for every pipeline stage.
+ */
+void Misc::SoakRunner::reportProgress()
+{
+  auto &manager = IO::Manager::instance();
+
+  qInfo().nospace() << "sent " << (m_sentFrames - m_lastSent) << "/s"
+                    << " | extracted "
+                    << (m_extractedFrames - m_lastExtracted) << "/s"
+                    << " | parsed " << (m_parsedFrames - m_lastParsed) << "/s"
+                    << " | ui updates "
+                    << (m_dashboardUpdates - m_lastUpdates) << "/s"
+                    << " | buffer " << manager.bufferUtilization() << "%"
+                    << " | dropped " << manager.droppedBytes()
+                    << " | crc rejects " << manager.checksumErrors()
+                    << " | pool hit rate "
+                    << manager.receiveBufferPool().hitRate();
+
+  m_lastSent = m_sentFrames;
+  m_lastExtracted = m_extractedFrames;
+  m_lastParsed = m_parsedFrames;
+  m_lastUpdates = m_dashboardUpdates;
+}
+
+/**
+ * @brief Prints the final summary and terminates the event loop.
+ */
+void Misc::SoakRunner::finish()
+{
+  m_sendTimer.stop();
+  m_reportTimer.stop();
+
+  const double seconds = double(m_elapsed.elapsed()) / 1000.0;
+  auto &manager = IO::Manager::instance();
+  manager.disconnectDevice();
+
+  qInfo() << "Soak finished:";
+  qInfo().nospace() << "  frames sent      " << m_sentFrames;
+  qInfo().nospace() << "  frames extracted " << m_extractedFrames;
+  qInfo().nospace() << "  frames parsed    " << m_parsedFrames;
+  qInfo().nospace() << "  sustained rate   "
+                    << double(m_parsedFrames) / seconds << " frames/s";
+  qInfo().nospace() << "  dropped bytes    " << manager.droppedBytes();
+  qInfo().nospace() << "  buffer overruns  " << manager.bufferOverruns();
+  qInfo().nospace() << "  crc rejects      " << manager.checksumErrors();
+  qInfo().nospace() << "  filtered frames  " << manager.filteredFrames();
+  qInfo().nospace() << "  pool hit rate    "
+                    << manager.receiveBufferPool().hitRate();
+
+  // Exit with an error when the pipeline failed to keep up
+  const bool sustained = m_parsedFrames >= (m_sentFrames * 95) / 100;
+  qApp->exit(sustained ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * @brief Builds the next synthetic frame of the configured flavor.
+ *
+ * Quick-plot frames are newline-terminated CSV lines padded to the requested
+ * payload size; JSON frames carry a minimal device-defined dashboard with a
+ * value per dataset, wrapped in the default start/end sequences.
+ */
+QByteArray Misc::SoakRunner::buildFrame()
+{
+  QByteArray frame;
+  frame.reserve(m_payloadSize + 8);
+
+  if (m_jsonMode)
+  {
+    frame.append("/*{\"title\":\"Soak\",\"groups\":[{\"title\":\"Load\","
+                 "\"datasets\":[");
+    int channel = 0;
+    while (frame.size() < m_payloadSize)
+    {
+      if (channel > 0)
+        frame.append(',');
+      frame.append("{\"title\":\"ch");
+      frame.append(QByteArray::number(channel));
+      frame.append("\",\"value\":");
+      frame.append(QByteArray::number(double(nextRandom() % 100000) / 100.0));
+      frame.append('}');
+      ++channel;
+    }
+
+    frame.append("]}]}*/");
+  }
+
+  else
+  {
+    while (frame.size() < m_payloadSize)
+    {
+      if (frame.size() > 0)
+        frame.append(',');
+      frame.append(QByteArray::number(double(nextRandom() % 100000) / 100.0));
+    }
+
+    frame.append('\n');
+  }
+
+  return frame;
+}
+
+/**
+ * @brief Returns the next value of the deterministic LCG stream.
+ */
+quint32 Misc::SoakRunner::nextRandom()
+{
+  m_rngState = m_rngState * 1664525 + 1013904223;
+  return m_rngState;
+}
@@ -46,6 +46,7 @@
 #include <QDir>
 #include <QPalette>
 #include <QStyleHints>
+#include <QJsonArray>
 #include <QJsonDocument>
 #include <QGuiApplication>
 
@@ -60,6 +61,7 @@
  */
 Misc::ThemeManager::ThemeManager()
   : m_theme(0)
+  , m_generation(0)
 {
   // Set theme files
   // clang-format off
@@ -152,17 +154,84 @@ const QStringList &Misc::ThemeManager::availableThemes() const
 
 /**
  * @brief Returns a @c QColor object for the given component @a name.
+ *
+ * Served from the palette compiled when the theme was loaded, so callers can
+ * query colors per paint without touching the theme JSON or re-parsing the
+ * color string each time.
+ *
  * @param name
  * @return QColor
  */
 QColor Misc::ThemeManager::getColor(const QString &name) const
 {
-  if (colors().contains(name))
-    return QColor(colors()[name].toString());
+  const auto it = m_colorCache.constFind(name);
+  if (it != m_colorCache.cend())
+    return *it;
 
   return QColor(qRgb(0xff, 0x00, 0xff));
 }
 
+/**
+ * @brief Returns the dataset color for the given zero-based @a index.
+ *
+ * Indexes beyond the palette wrap around, so every dataset always resolves
+ * to a valid color with a single array access.
+ */
+QColor Misc::ThemeManager::widgetColor(const int index) const
+{
+  if (m_widgetColors.isEmpty())
+    return QColor(qRgb(0xff, 0x00, 0xff));
+
+  return m_widgetColors[qMax(0, index) % m_widgetColors.count()];
+}
+
+/**
+ * @brief Returns the compiled dataset color palette of the current theme.
+ */
+const QVector<QColor> &Misc::ThemeManager::widgetColors() const
+{
+  return m_widgetColors;
+}
+
+/**
+ * @brief Returns the palette generation counter.
+ *
+ * Incremented every time the palette is recompiled (theme switch or system
+ * scheme change), so widgets caching resolved colors can compare a stored
+ * generation instead of re-reading every color to detect staleness.
+ */
+quint64 Misc::ThemeManager::generation() const
+{
+  return m_generation;
+}
+
+/**
+ * @brief Compiles the current theme's colors into flat lookup structures.
+ *
+ * Parses every color string exactly once per theme load: named colors go
+ * into a hash of ready-made QColor values and the dataset color array into
+ * an indexed vector. Widgets repainting during a theme switch therefore
+ * never cause JSON traversal or color parsing.
+ */
+void Misc::ThemeManager::compilePalette()
+{
+  m_colorCache.clear();
+  for (auto it = m_colors.constBegin(); it != m_colors.constEnd(); ++it)
+  {
+    if (it.value().isString())
+      m_colorCache.insert(it.key(), QColor(it.value().toString()));
+  }
+
+  m_widgetColors.clear();
+  const auto colors
+      = m_colors.value(QStringLiteral("widget_colors")).toArray();
+  m_widgetColors.reserve(colors.count());
+  for (const auto &color : colors)
+    m_widgetColors.append(QColor(color.toString()));
+
+  ++m_generation;
+}
+
 /**
  * @brief Sets the current theme to the theme at the specified index.
  *
@@ -190,9 +259,10 @@ void Misc::ThemeManager::setTheme(const int index)
     return;
   }
 
-  // Load actual theme data
+  // Load actual theme data & compile the flat color palette
   m_themeData = m_themes.value(m_themeName);
   m_colors = m_themeData.value("colors").toObject();
+  compilePalette();
 
   // Hint Qt about the effective color scheme
   const auto bg = getColor(QStringLiteral("base"));
@@ -247,6 +317,7 @@ void Misc::ThemeManager::loadSystemTheme()
   m_themeName = QStringLiteral("System");
   m_theme = availableThemes().indexOf(m_themeName);
   m_colors = themeData.value("colors").toObject();
+  compilePalette();
 
   // Update user interface
   Q_EMIT themeChanged();
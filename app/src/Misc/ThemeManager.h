@@ -21,8 +21,10 @@
 
 #pragma once
 
+#include <QHash>
 #include <QColor>
 #include <QObject>
+#include <QVector>
 #include <QSettings>
 #include <QJsonObject>
 
@@ -122,11 +124,14 @@ public:
   static ThemeManager &instance();
 
   [[nodiscard]] int theme() const;
+  [[nodiscard]] quint64 generation() const;
   [[nodiscard]] const QString &themeName() const;
   [[nodiscard]] const QJsonObject &colors() const;
   [[nodiscard]] const QJsonObject &themeData() const;
   [[nodiscard]] const QStringList &availableThemes() const;
   [[nodiscard]] QColor getColor(const QString &name) const;
+  [[nodiscard]] QColor widgetColor(const int index) const;
+  [[nodiscard]] const QVector<QColor> &widgetColors() const;
 
 public slots:
   void setTheme(int index);
@@ -134,15 +139,21 @@ public slots:
 private slots:
   void loadSystemTheme();
 
+private:
+  void compilePalette();
+
 protected:
   bool eventFilter(QObject *watched, QEvent *event) override;
 
 private:
   int m_theme;
+  quint64 m_generation;
   QString m_themeName;
   QSettings m_settings;
   QJsonObject m_colors;
   QJsonObject m_themeData;
+  QVector<QColor> m_widgetColors;
+  QHash<QString, QColor> m_colorCache;
 
   QStringList m_availableThemes;
   QMap<QString, QJsonObject> m_themes;
@@ -0,0 +1,150 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/ThreadAffinity.h"
+#include "Misc/Settings.h"
+
+#ifdef Q_OS_LINUX
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+#ifdef Q_OS_WIN
+#  include <qt_windows.h>
+#endif
+
+/**
+ * @brief Pins the given thread to the core list configured for a role.
+ *
+ * The pinning call must run on the target thread itself (both the POSIX and
+ * the Windows API pin the calling thread), so a throwaway QObject is moved
+ * onto the thread and the call is posted to its event loop. Threads without
+ * a configured core list are left to the OS scheduler.
+ *
+ * @param thread The thread to pin (must run an event loop).
+ * @param role The thread role, e.g. "io", "parser" or "ingest".
+ */
+void Misc::ThreadAffinity::apply(QThread *thread, const QString &role)
+{
+  const auto cores = coreList(role);
+  if (cores.isEmpty() || !thread)
+    return;
+
+  auto *task = new QObject();
+  task->moveToThread(thread);
+  QMetaObject::invokeMethod(
+      task,
+      [task, cores] {
+        pinCurrentThread(cores);
+        task->deleteLater();
+      },
+      Qt::QueuedConnection);
+}
+
+/**
+ * @brief Returns the configured core list for a thread role.
+ *
+ * Reads @c threadAffinity/<role> from the application settings; an empty or
+ * malformed value yields an empty list, which disables pinning for the role.
+ *
+ * @param role The thread role, e.g. "io", "parser" or "ingest".
+ */
+QVector<int> Misc::ThreadAffinity::coreList(const QString &role)
+{
+  const auto key = QStringLiteral("threadAffinity/%1").arg(role);
+  return parseCoreList(Settings::instance().value(key).toString());
+}
+
+/**
+ * @brief Parses a taskset-style core list such as "0-3,8" into core indexes.
+ *
+ * Out-of-range and malformed entries invalidate the whole list, so a typo in
+ * the settings never pins a thread to an unintended subset of cores.
+ *
+ * @param text The core list text.
+ * @return The parsed core indexes, or an empty list when parsing fails.
+ */
+QVector<int> Misc::ThreadAffinity::parseCoreList(const QString &text)
+{
+  QVector<int> cores;
+  const auto trimmed = text.trimmed();
+  if (trimmed.isEmpty())
+    return cores;
+
+  const int coreCount = QThread::idealThreadCount();
+  const auto groups = trimmed.split(QLatin1Char(','), Qt::SkipEmptyParts);
+  for (const auto &group : groups)
+  {
+    bool okA = false;
+    bool okB = false;
+
+    int first = 0;
+    int last = 0;
+    const auto range = group.split(QLatin1Char('-'));
+    if (range.count() == 1)
+    {
+      first = last = range[0].trimmed().toInt(&okA);
+      okB = okA;
+    }
+
+    else if (range.count() == 2)
+    {
+      first = range[0].trimmed().toInt(&okA);
+      last = range[1].trimmed().toInt(&okB);
+    }
+
+    if (!okA || !okB || first > last || first < 0 || last >= coreCount)
+      return QVector<int>();
+
+    for (int core = first; core <= last; ++core)
+      if (!cores.contains(core))
+        cores.append(core);
+  }
+
+  return cores;
+}
+
+/**
+ * @brief Pins the calling thread to the given core indexes.
+ *
+ * @param cores The core indexes to pin the thread to.
+ */
+void Misc::ThreadAffinity::pinCurrentThread(const QVector<int> &cores)
+{
+#if defined(Q_OS_LINUX)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const auto core : cores)
+    CPU_SET(core, &set);
+
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(Q_OS_WIN)
+  DWORD_PTR mask = 0;
+  for (const auto core : cores)
+    if (core < static_cast<int>(sizeof(mask) * 8))
+      mask |= (static_cast<DWORD_PTR>(1) << core);
+
+  if (mask != 0)
+    SetThreadAffinityMask(GetCurrentThread(), mask);
+#else
+  Q_UNUSED(cores);
+#endif
+}
@@ -0,0 +1,63 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QString>
+#include <QThread>
+#include <QVector>
+
+namespace Misc
+{
+/**
+ * @class Misc::ThreadAffinity
+ * @brief Optional CPU pinning for the application's worker thread roles.
+ *
+ * By default every worker thread is scheduled wherever the OS puts it. On
+ * multi-socket machines this lets the IO thread, the parser pool and the
+ * dashboard ingest thread drift across NUMA nodes, and the frame data they
+ * hand to each other bounces between socket caches. This helper reads an
+ * optional core list per thread role from the application settings and pins
+ * the matching threads to it, so all stages of the pipeline can be kept
+ * within one node.
+ *
+ * Settings keys (empty by default, which leaves scheduling to the OS):
+ *
+ *   - @c threadAffinity/io      The IO worker & driver source threads.
+ *   - @c threadAffinity/parser  The frame parser pool threads.
+ *   - @c threadAffinity/ingest  The dashboard ingest thread.
+ *
+ * Core lists use the familiar taskset syntax, e.g. "0-3,8". Pinning is
+ * supported on Linux and Windows; on other platforms the core lists are
+ * parsed but ignored, since the OS offers no hard affinity API.
+ */
+class ThreadAffinity
+{
+public:
+  static void apply(QThread *thread, const QString &role);
+
+  [[nodiscard]] static QVector<int> coreList(const QString &role);
+  [[nodiscard]] static QVector<int> parseCoreList(const QString &text);
+
+private:
+  static void pinCurrentThread(const QVector<int> &cores);
+};
+} // namespace Misc
@@ -36,10 +36,18 @@ Misc::TimerEvents &Misc::TimerEvents::instance()
  */
 void Misc::TimerEvents::stopTimers()
 {
+  const bool wasActive = m_highRateActive;
+
+  m_enabled = false;
+  m_highRateActive = false;
+
   m_timer1Hz.stop();
   m_timer10Hz.stop();
   m_timer20Hz.stop();
   m_timer24Hz.stop();
+
+  if (wasActive)
+    Q_EMIT highRateActiveChanged(false);
 }
 
 /**
@@ -48,8 +56,22 @@ void Misc::TimerEvents::stopTimers()
 void Misc::TimerEvents::timerEvent(QTimerEvent *event)
 {
   if (event->timerId() == m_timer1Hz.timerId())
+  {
     Q_EMIT timeout1Hz();
 
+    // Suspend the high-rate timers when no data activity has been reported
+    // for a while, the 1 Hz heartbeat keeps running so that clocks, export
+    // modules & connection indicators stay alive while the device is idle
+    if (m_highRateActive && m_activityTimer.elapsed() >= 2000)
+    {
+      m_highRateActive = false;
+      m_timer10Hz.stop();
+      m_timer20Hz.stop();
+      m_timer24Hz.stop();
+      Q_EMIT highRateActiveChanged(false);
+    }
+  }
+
   else if (event->timerId() == m_timer10Hz.timerId())
     Q_EMIT timeout10Hz();
 
@@ -65,8 +87,34 @@ void Misc::TimerEvents::timerEvent(QTimerEvent *event)
  */
 void Misc::TimerEvents::startTimers()
 {
+  m_enabled = true;
+  m_activityTimer.start();
   m_timer1Hz.start(1000, Qt::PreciseTimer, this);
+  startHighRateTimers();
+}
+
+/**
+ * Reports data activity to the refresh governor.
+ *
+ * Called whenever the I/O layer receives data or a frame is decoded. The call
+ * resets the idle countdown & restarts the high-rate UI timers if they were
+ * suspended, so the dashboard resumes repainting as soon as data flows again.
+ */
+void Misc::TimerEvents::registerActivity()
+{
+  m_activityTimer.restart();
+  if (m_enabled && !m_highRateActive)
+    startHighRateTimers();
+}
+
+/**
+ * Starts the 10/20/24 Hz timers used to repaint the user interface
+ */
+void Misc::TimerEvents::startHighRateTimers()
+{
+  m_highRateActive = true;
   m_timer20Hz.start(1000 / 20, Qt::PreciseTimer, this);
   m_timer24Hz.start(1000 / 24, Qt::PreciseTimer, this);
   m_timer10Hz.start(1000 / 10, Qt::PreciseTimer, this);
+  Q_EMIT highRateActiveChanged(true);
 }
@@ -23,6 +23,7 @@
 
 #include <QObject>
 #include <QBasicTimer>
+#include <QElapsedTimer>
 
 namespace Misc
 {
@@ -31,6 +32,15 @@ namespace Misc
  *
  * The @c TimerEvents class implements periodic timers that are used to update
  * the user interface elements at a specific frequency.
+ *
+ * The high-rate timers (10/20/24 Hz) are governed by data activity: they only
+ * run while @c registerActivity() has been called recently. Once no activity
+ * has been reported for a couple of seconds, the high-rate timers are stopped
+ * and only the 1 Hz heartbeat remains active, so an idle dashboard does not
+ * repaint (or wake the CPU) at display rate. The timers are restarted
+ * transparently as soon as new data arrives. Suspensions and resumptions
+ * are announced through @c highRateActiveChanged, so consumers that depend
+ * on the tick rate (e.g. the GUI watchdog) can adapt.
  */
 class TimerEvents : public QObject
 {
@@ -41,6 +51,7 @@ signals:
   void timeout10Hz();
   void timeout20Hz();
   void timeout24Hz();
+  void highRateActiveChanged(bool active);
 
 private:
   TimerEvents() {};
@@ -58,8 +69,16 @@ protected:
 public slots:
   void stopTimers();
   void startTimers();
+  void registerActivity();
+
+private:
+  void startHighRateTimers();
 
 private:
+  bool m_enabled = false;
+  bool m_highRateActive = false;
+  QElapsedTimer m_activityTimer;
+
   QBasicTimer m_timer1Hz;
   QBasicTimer m_timer10Hz;
   QBasicTimer m_timer20Hz;
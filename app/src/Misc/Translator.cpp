@@ -236,6 +236,13 @@ void Misc::Translator::setLanguage(const Language language)
  * Changes the language of the application and emits the signals neccesary to
  * reload every string that uses the Qt translator system.
  *
+ * The *.qm catalogs are stored uncompressed in the resource system, so the
+ * translator is pointed directly at the catalog bytes inside the executable
+ * image: nothing is copied to the heap at startup and the catalog pages
+ * fault in lazily as strings are first looked up. The QML engine is
+ * retranslated in place on @c languageChanged (see Misc::ModuleManager), so
+ * switching languages mid-session never rebuilds the dashboard.
+ *
  * @param locale    user-set locale
  * @param language  name of the *.qm file to load from the "translations"
  *                  directory inside the application's resources
@@ -244,8 +251,20 @@ void Misc::Translator::setLanguage(const QLocale &locale,
                                    const QString &language)
 {
   qApp->removeTranslator(&m_translator);
-  const auto qmPath = QStringLiteral(":/qm/%1.qm").arg(language);
-  if (m_translator.load(locale, qmPath))
+
+  // Zero-copy path: map the catalog straight from the resource section
+  bool loaded = false;
+  m_catalog.setFileName(QStringLiteral("/qm/%1.qm").arg(language));
+  if (m_catalog.isValid()
+      && m_catalog.compressionAlgorithm() == QResource::NoCompression)
+    loaded = m_translator.load(m_catalog.data(),
+                               static_cast<int>(m_catalog.size()));
+
+  // Fallback for catalogs that were bundled with compression enabled
+  if (!loaded)
+    loaded = m_translator.load(locale, QStringLiteral(":/qm/%1.qm").arg(language));
+
+  if (loaded)
   {
     qApp->installTranslator(&m_translator);
     Q_EMIT languageChanged();
@@ -23,6 +23,7 @@
 
 #include <QLocale>
 #include <QObject>
+#include <QResource>
 #include <QTranslator>
 
 #ifdef QT_QML_LIB
@@ -95,6 +96,7 @@ public slots:
 private:
   Language m_language;
   QSettings m_settings;
+  QResource m_catalog;
   QTranslator m_translator;
 };
 } // namespace Misc
@@ -19,6 +19,8 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <cmath>
+
 #include <QDir>
 #include <QUrl>
 #include <QPalette>
@@ -122,6 +124,65 @@ QString Misc::Utilities::hdpiImagePath(const QString &path)
   return filename;
 }
 
+/**
+ * @brief Formats a double in fixed notation with the given precision.
+ *
+ * Drop-in replacement for QString::number(value, 'f', precision) on the
+ * dashboard label paths, where thousands of values are formatted per second.
+ * Values that fit the 64-bit scaled-integer range are rendered with pure
+ * integer arithmetic into a stack buffer, skipping the locale-aware printf
+ * machinery; anything else (huge magnitudes, NaN, infinities) falls back to
+ * QString::number.
+ *
+ * @param value The value to format.
+ * @param precision Number of digits after the decimal point (0 to 12).
+ * @return The formatted string.
+ */
+QString Misc::Utilities::formatDouble(const double value, const int precision)
+{
+  // Scale the value so the fraction becomes part of the integer
+  static constexpr quint64 powersOf10[]
+      = {1ull,          10ull,          100ull,         1000ull,
+         10000ull,      100000ull,      1000000ull,     10000000ull,
+         100000000ull,  1000000000ull,  10000000000ull, 100000000000ull,
+         1000000000000ull};
+  const int digits = qBound(0, precision, 12);
+  const double scaled = value * double(powersOf10[digits]);
+
+  // Fall back for values the scaled-integer path cannot represent
+  if (!std::isfinite(scaled) || std::abs(scaled) >= 9.2e18)
+    return QString::number(value, 'f', precision);
+
+  // Round half away from zero, like printf's fixed notation
+  const auto units = qint64(scaled + (scaled >= 0 ? 0.5 : -0.5));
+  const bool negative = units < 0;
+  auto magnitude
+      = negative ? quint64(-(units + 1)) + 1 : quint64(units);
+
+  // Render the digits backwards into a stack buffer
+  char buffer[32];
+  char *p = buffer + sizeof(buffer);
+  for (int i = 0; i < digits; ++i)
+  {
+    *--p = char('0' + magnitude % 10);
+    magnitude /= 10;
+  }
+
+  if (digits > 0)
+    *--p = '.';
+
+  do
+  {
+    *--p = char('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude > 0);
+
+  if (negative)
+    *--p = '-';
+
+  return QString::fromLatin1(p, int(buffer + sizeof(buffer) - p));
+}
+
 /**
  * Shows a macOS-like message box with the given properties
  */
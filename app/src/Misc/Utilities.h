@@ -48,6 +48,8 @@ public:
   Q_INVOKABLE static bool askAutomaticUpdates();
   Q_INVOKABLE static QString hdpiImagePath(const QString &path);
 
+  static QString formatDouble(const double value, const int precision);
+
   // clang-format off
   static int showMessageBox(const QString& text,
                             const QString& informativeText = "",
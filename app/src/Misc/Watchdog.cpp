@@ -0,0 +1,298 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/Watchdog.h"
+
+#include <QDir>
+#include <QFile>
+#include <QTimer>
+#include <QDateTime>
+#include <QVariantMap>
+#include <QFileDialog>
+#include <QTextStream>
+#include <QStandardPaths>
+
+#include "Misc/Settings.h"
+#include "Misc/Utilities.h"
+#include "Misc/TimerEvents.h"
+
+/**
+ * @brief Starts timing a traced scope on the GUI thread.
+ * @param label A string literal naming the scope (the pointer is stored).
+ */
+Misc::Watchdog::Trace::Trace(const char *label)
+{
+  auto &watchdog = Watchdog::instance();
+  m_startNs = watchdog.m_clock.nsecsElapsed();
+  m_previous = watchdog.m_activeLabel.load(std::memory_order_relaxed);
+  watchdog.m_activeLabel.store(label, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Restores the enclosing scope & reports the trace when it ran long.
+ */
+Misc::Watchdog::Trace::~Trace()
+{
+  auto &watchdog = Watchdog::instance();
+  const auto label = watchdog.m_activeLabel.load(std::memory_order_relaxed);
+  const auto elapsed = watchdog.m_clock.nsecsElapsed() - m_startNs;
+  watchdog.m_activeLabel.store(m_previous, std::memory_order_relaxed);
+
+  if (elapsed > watchdog.m_slowScopeNs)
+    watchdog.recordReport(QObject::tr("Slow scope"),
+                          QString::fromLatin1(label), elapsed / 1e6);
+}
+
+/**
+ * @brief Constructs the watchdog & starts the heartbeat checker thread.
+ *
+ * The GUI thread refreshes the heartbeat from the shared 24 Hz timer, with
+ * the always-on 1 Hz heartbeat taking over while the refresh governor has
+ * the high-rate timers suspended; the checker compares it against the
+ * monotonic clock at 20 Hz from its own thread, so a blocked event loop is
+ * detected even though no GUI code runs.
+ */
+Misc::Watchdog::Watchdog()
+  : m_stallReported(false)
+  , m_highRateActive(true)
+  , m_heartbeatNs(0)
+  , m_activeLabel(nullptr)
+{
+  // Start the monotonic clock shared by the heartbeat & the trace scopes
+  m_clock.start();
+  m_heartbeatNs.store(m_clock.nsecsElapsed(), std::memory_order_relaxed);
+
+  // Read the thresholds from the application settings
+  auto &settings = Settings::instance();
+  const auto stallMs
+      = settings.value(QStringLiteral("watchdog/stallMs"), 150).toInt();
+  const auto slowMs
+      = settings.value(QStringLiteral("watchdog/slowScopeMs"), 25).toInt();
+  m_stallNs = qMax(stallMs, 50) * qint64(1000000);
+  m_slowScopeNs = qMax(slowMs, 1) * qint64(1000000);
+
+  // Refresh the heartbeat from the GUI thread. The 24 Hz timer is governed
+  // by data activity, so the always-on 1 Hz tick keeps the heartbeat alive
+  // (at a coarser rate) while the dashboard is idle
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout24Hz,
+          this, &Misc::Watchdog::beatHeartbeat, Qt::DirectConnection);
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz,
+          this, &Misc::Watchdog::beatHeartbeat, Qt::DirectConnection);
+
+  // Track the governor state so the stall threshold can follow the
+  // heartbeat rate; beat once on every transition so the slack starts fresh
+  connect(
+      &Misc::TimerEvents::instance(),
+      &Misc::TimerEvents::highRateActiveChanged, this,
+      [this](const bool active) {
+        m_highRateActive.store(active, std::memory_order_relaxed);
+        beatHeartbeat();
+      },
+      Qt::DirectConnection);
+
+  // Poll the heartbeat from the checker thread
+  auto *timer = new QTimer();
+  timer->setInterval(50);
+  timer->moveToThread(&m_checkerThread);
+  connect(&m_checkerThread, &QThread::started, timer,
+          qOverload<>(&QTimer::start));
+  connect(&m_checkerThread, &QThread::finished, timer, &QObject::deleteLater);
+  connect(timer, &QTimer::timeout, timer,
+          [this] { checkHeartbeat(); });
+  m_checkerThread.start();
+}
+
+/**
+ * @brief Stops the checker thread.
+ */
+Misc::Watchdog::~Watchdog()
+{
+  m_checkerThread.quit();
+  m_checkerThread.wait();
+}
+
+/**
+ * @brief Returns the only instance of the class.
+ */
+Misc::Watchdog &Misc::Watchdog::instance()
+{
+  static Watchdog instance;
+  return instance;
+}
+
+/**
+ * @brief Returns the ring of recent stall & slow-scope reports.
+ *
+ * Each entry is a map with the wall-clock time, the report type, the traced
+ * scope that was active and the measured duration in milliseconds. The most
+ * recent report comes first.
+ */
+QVariantList Misc::Watchdog::reports() const
+{
+  QMutexLocker locker(&m_reportsLock);
+  return m_reports;
+}
+
+/**
+ * @brief Discards all collected reports.
+ */
+void Misc::Watchdog::clearReports()
+{
+  QMutexLocker locker(&m_reportsLock);
+  if (!m_reports.isEmpty())
+  {
+    m_reports.clear();
+    locker.unlock();
+    Q_EMIT reportsChanged();
+  }
+}
+
+/**
+ * @brief Saves the collected reports as a plain-text log for bug filing.
+ */
+void Misc::Watchdog::exportReports()
+{
+  // Obtain a copy of the reports
+  QVariantList reports;
+  {
+    QMutexLocker locker(&m_reportsLock);
+    reports = m_reports;
+  }
+
+  // Nothing to export
+  if (reports.isEmpty())
+    return;
+
+  // Get file save path
+  const auto docs
+      = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+  const auto name = docs + QStringLiteral("/slow-frame-report.txt");
+  const auto path = QFileDialog::getSaveFileName(
+      nullptr, tr("Export slow frame reports"), name, "*.txt");
+  if (path.isEmpty())
+    return;
+
+  // Open file for writing
+  QFile file(path);
+  if (!file.open(QFile::WriteOnly | QFile::Text))
+  {
+    Misc::Utilities::showMessageBox(tr("File open error"), file.errorString(),
+                                    QMessageBox::Critical);
+    return;
+  }
+
+  // Write one line per report
+  QTextStream stream(&file);
+  for (const auto &entry : std::as_const(reports))
+  {
+    const auto map = entry.toMap();
+    stream << map.value(QStringLiteral("time")).toString() << "\t"
+           << map.value(QStringLiteral("type")).toString() << "\t"
+           << map.value(QStringLiteral("scope")).toString() << "\t"
+           << map.value(QStringLiteral("duration")).toDouble() << " ms\n";
+  }
+
+  // Close & reveal the log
+  file.close();
+  Misc::Utilities::revealFile(path);
+}
+
+/**
+ * @brief Detects stalled event loops from the checker thread.
+ *
+ * A report is recorded once per stall (re-armed when the heartbeat
+ * recovers), naming the innermost traced scope that was active when the
+ * event loop went silent, or the event loop itself when the stall happened
+ * outside the traced update paths.
+ */
+void Misc::Watchdog::checkHeartbeat()
+{
+  const auto now = m_clock.nsecsElapsed();
+  const auto beat = m_heartbeatNs.load(std::memory_order_relaxed);
+  const auto elapsed = now - beat;
+
+  // While the refresh governor has the high-rate timers suspended the
+  // heartbeat only arrives at 1 Hz, so pad the threshold with one beat
+  // period; real stalls are still reported, just with coarser latency
+  auto stallNs = m_stallNs;
+  if (!m_highRateActive.load(std::memory_order_relaxed))
+    stallNs += qint64(1000000000);
+
+  // Heartbeat is healthy, re-arm the stall report
+  if (elapsed < stallNs)
+  {
+    m_stallReported = false;
+    return;
+  }
+
+  // Report the stall once, naming the active scope (if any)
+  if (!m_stallReported)
+  {
+    m_stallReported = true;
+
+    QString scope = tr("Event loop (outside traced scopes)");
+    const auto label = m_activeLabel.load(std::memory_order_relaxed);
+    if (label)
+      scope = QString::fromLatin1(label);
+
+    recordReport(QObject::tr("GUI stall"), scope, elapsed / 1e6);
+  }
+}
+
+/**
+ * @brief Publishes a fresh heartbeat timestamp from the GUI thread.
+ */
+void Misc::Watchdog::beatHeartbeat()
+{
+  m_heartbeatNs.store(m_clock.nsecsElapsed(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Appends a report to the bounded ring.
+ *
+ * May be called from the GUI thread (slow scopes) or the checker thread
+ * (stalls); the ring is mutex-guarded and capped to the most recent
+ * entries.
+ *
+ * @param type The report type shown in the diagnostics pane.
+ * @param scope The traced scope the report refers to.
+ * @param milliseconds The measured duration.
+ */
+void Misc::Watchdog::recordReport(const QString &type, const QString &scope,
+                                  const qreal milliseconds)
+{
+  QVariantMap entry;
+  entry.insert(QStringLiteral("type"), type);
+  entry.insert(QStringLiteral("scope"), scope);
+  entry.insert(QStringLiteral("duration"), milliseconds);
+  entry.insert(QStringLiteral("time"),
+               QDateTime::currentDateTime().toString(
+                   QStringLiteral("yyyy-MM-dd hh:mm:ss.zzz")));
+
+  {
+    QMutexLocker locker(&m_reportsLock);
+    m_reports.prepend(entry);
+    while (m_reports.count() > MaxReports)
+      m_reports.removeLast();
+  }
+
+  Q_EMIT reportsChanged();
+}
@@ -0,0 +1,127 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QMutex>
+#include <QObject>
+#include <QThread>
+#include <QVariantList>
+#include <QElapsedTimer>
+
+namespace Misc
+{
+/**
+ * @class Misc::Watchdog
+ * @brief GUI-thread stall detector with lightweight scope tracing.
+ *
+ * The GUI thread publishes a heartbeat timestamp from the shared 24 Hz
+ * timer, falling back to the always-on 1 Hz heartbeat while the refresh
+ * governor has the high-rate timers suspended; a checker on a dedicated
+ * thread compares it against the monotonic clock and records a report
+ * whenever the event loop goes silent for longer than the stall threshold
+ * (padded by one beat period while the coarse heartbeat is in effect, so an
+ * idle dashboard does not drown the diagnostics in spurious reports). The hot update paths of the dashboard and the
+ * widget models declare Trace scopes, so a stall report names the scope
+ * that was running when the event loop hitched, and any traced scope that
+ * overruns the slow-scope threshold is reported on its own even when the
+ * heartbeat survives.
+ *
+ * Reports are kept in a bounded ring of the most recent entries, shown in
+ * the diagnostics pane and exportable as a plain-text log for bug filing.
+ * The watchdog is always armed: a trace scope costs two clock reads and a
+ * pair of relaxed atomic stores, and the checker wakes at 20 Hz on its own
+ * thread.
+ *
+ * Thresholds can be tuned through the settings keys @c watchdog/stallMs
+ * (default 150) and @c watchdog/slowScopeMs (default 25).
+ */
+class Watchdog : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY(QVariantList reports
+             READ reports
+             NOTIFY reportsChanged)
+
+signals:
+  void reportsChanged();
+
+private:
+  explicit Watchdog();
+  Watchdog(Watchdog &&) = delete;
+  Watchdog(const Watchdog &) = delete;
+  Watchdog &operator=(Watchdog &&) = delete;
+  Watchdog &operator=(const Watchdog &) = delete;
+
+public:
+  ~Watchdog();
+
+  /**
+   * @brief Marks the duration of a traced scope on the GUI thread.
+   *
+   * Declared on the stack at the top of an update function with a string
+   * literal label (the label pointer is stored, not copied). Scopes nest;
+   * the innermost active scope is the one named in stall reports.
+   */
+  class Trace
+  {
+  public:
+    explicit Trace(const char *label);
+    ~Trace();
+
+  private:
+    qint64 m_startNs;
+    const char *m_previous;
+  };
+
+  static Watchdog &instance();
+
+  [[nodiscard]] QVariantList reports() const;
+
+  Q_INVOKABLE void clearReports();
+  Q_INVOKABLE void exportReports();
+
+private:
+  void checkHeartbeat();
+  void beatHeartbeat();
+  void recordReport(const QString &type, const QString &scope,
+                    const qreal milliseconds);
+
+private:
+  static constexpr int MaxReports = 32;
+
+  qint64 m_stallNs;
+  qint64 m_slowScopeNs;
+  bool m_stallReported;
+
+  QElapsedTimer m_clock;
+  QThread m_checkerThread;
+
+  std::atomic<bool> m_highRateActive;
+  std::atomic<qint64> m_heartbeatNs;
+  std::atomic<const char *> m_activeLabel;
+
+  mutable QMutex m_reportsLock;
+  QVariantList m_reports;
+};
+} // namespace Misc
@@ -0,0 +1,439 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <limits>
+#include <cstring>
+#include <utility>
+
+#include <QHash>
+#include <QtEndian>
+
+#include "Plugins/ArrowWriter.h"
+
+//------------------------------------------------------------------------------
+// Flatbuffer constants of the Arrow IPC message schemas
+//------------------------------------------------------------------------------
+
+// MetadataVersion::V5
+static constexpr quint16 kMetadataVersion = 4;
+
+// MessageHeader union discriminants
+static constexpr quint8 kHeaderSchema = 1;
+static constexpr quint8 kHeaderRecordBatch = 3;
+
+// Type union discriminant & FloatingPoint precision for float64 columns
+static constexpr quint8 kTypeFloatingPoint = 3;
+static constexpr quint16 kPrecisionDouble = 2;
+
+namespace
+{
+/**
+ * @brief Append-only little-endian assembler for flatbuffer messages.
+ *
+ * Flatbuffer tables reference child objects through unsigned offsets that
+ * point towards higher addresses, so objects are laid out parents first
+ * and the reference fields are patched once the children's addresses are
+ * known. Tables locate their vtables through a *signed* offset, which lets
+ * every vtable live at the end of the message regardless of layout order.
+ *
+ * The assembler knows nothing about the Arrow schemas; the callers below
+ * hand-lay each table and emit a matching vtable, which is easy to keep
+ * correct because only two fixed message shapes are ever produced.
+ */
+class FlatAssembler
+{
+public:
+  [[nodiscard]] qsizetype size() const { return m_data.size(); }
+
+  void u8(const quint8 value) { m_data.append(char(value)); }
+
+  void u16(const quint16 value)
+  {
+    quint16 le;
+    qToLittleEndian(value, &le);
+    m_data.append(reinterpret_cast<const char *>(&le), sizeof(le));
+  }
+
+  void u32(const quint32 value)
+  {
+    quint32 le;
+    qToLittleEndian(value, &le);
+    m_data.append(reinterpret_cast<const char *>(&le), sizeof(le));
+  }
+
+  void i64(const qint64 value)
+  {
+    qint64 le;
+    qToLittleEndian(value, &le);
+    m_data.append(reinterpret_cast<const char *>(&le), sizeof(le));
+  }
+
+  void bytes(const QByteArray &data) { m_data.append(data); }
+
+  void pad(qsizetype count)
+  {
+    while (count-- > 0)
+      m_data.append('\0');
+  }
+
+  /**
+   * @brief Pads until the write position is a multiple of @a alignment.
+   */
+  void alignTo(const qsizetype alignment)
+  {
+    while (m_data.size() % alignment != 0)
+      m_data.append('\0');
+  }
+
+  /**
+   * @brief Pads so the *elements* of a vector written next are aligned.
+   *
+   * A vector starts with its 32-bit element count; the element data only
+   * lands on @a alignment when the count field ends on that boundary.
+   */
+  void alignVector(const qsizetype alignment)
+  {
+    while ((m_data.size() + 4) % alignment != 0)
+      m_data.append('\0');
+  }
+
+  /**
+   * @brief Writes a forward reference to the object identified by @a id.
+   */
+  void ref(const int id)
+  {
+    m_refs.append({m_data.size(), id});
+    u32(0);
+  }
+
+  /**
+   * @brief Opens a table by writing its (patched later) vtable offset.
+   */
+  void vtableRef(const int id)
+  {
+    m_vtableRefs.append({m_data.size(), id});
+    u32(0);
+  }
+
+  /**
+   * @brief Records the current write position as the address of @a id.
+   */
+  void define(const int id) { m_targets.insert(id, m_data.size()); }
+
+  /**
+   * @brief Patches every recorded reference & returns the message bytes.
+   */
+  QByteArray finish()
+  {
+    // Unsigned offsets point from the reference field to the child
+    for (const auto &reference : std::as_const(m_refs))
+      patch(reference.at, quint32(m_targets.value(reference.id)
+                                  - reference.at));
+
+    // Signed vtable offsets: vtable address = table address - offset
+    for (const auto &reference : std::as_const(m_vtableRefs))
+      patch(reference.at, quint32(qint32(reference.at
+                                         - m_targets.value(reference.id))));
+
+    return m_data;
+  }
+
+private:
+  void patch(const qsizetype at, const quint32 value)
+  {
+    quint32 le;
+    qToLittleEndian(value, &le);
+    std::memcpy(m_data.data() + at, &le, sizeof(le));
+  }
+
+  struct Reference
+  {
+    qsizetype at;
+    int id;
+  };
+
+  QByteArray m_data;
+  QVector<Reference> m_refs;
+  QVector<Reference> m_vtableRefs;
+  QHash<int, qsizetype> m_targets;
+};
+
+// Object identifiers used while assembling a message; per-column objects
+// add the column index to their base value
+enum ObjectId
+{
+  MessageTable,
+  PayloadTable,
+  NodesVector,
+  BuffersVector,
+  MessageVtable,
+  PayloadVtable,
+  FieldVtable,
+  FloatVtable,
+  FieldTableBase = 0x10000,
+  FieldNameBase = 0x20000,
+  FieldTypeBase = 0x30000,
+};
+
+/**
+ * @brief Assembles the flatbuffer of the schema message.
+ *
+ * Describes one non-nullable float64 field per column. Field tables share
+ * a single vtable, so the metadata cost per column is the table, the name
+ * string and the FloatingPoint type table.
+ */
+QByteArray buildSchemaMessage(
+    const QVector<Plugins::ArrowWriter::Column> &columns)
+{
+  FlatAssembler fb;
+
+  // Root offset to the Message table
+  fb.ref(MessageTable);
+
+  // Message table: version, header type & the Schema header
+  fb.define(MessageTable);
+  fb.vtableRef(MessageVtable);
+  fb.u16(kMetadataVersion); // at table offset 4
+  fb.u8(kHeaderSchema);     // at table offset 6
+  fb.pad(1);
+  fb.ref(PayloadTable);     // at table offset 8
+
+  // Schema table: only the field vector (little-endian is the default)
+  fb.define(PayloadTable);
+  fb.vtableRef(PayloadVtable);
+  fb.ref(NodesVector);      // at table offset 4
+
+  // Vector of offsets to the Field tables
+  fb.define(NodesVector);
+  fb.u32(quint32(columns.count()));
+  for (int i = 0; i < columns.count(); ++i)
+    fb.ref(FieldTableBase + i);
+
+  // Field tables: name, float64 type & union discriminant
+  for (int i = 0; i < columns.count(); ++i)
+  {
+    fb.alignTo(4);
+    fb.define(FieldTableBase + i);
+    fb.vtableRef(FieldVtable);
+    fb.ref(FieldNameBase + i);   // at table offset 4
+    fb.ref(FieldTypeBase + i);   // at table offset 8
+    fb.u8(kTypeFloatingPoint);   // at table offset 12
+    fb.pad(3);
+  }
+
+  // FloatingPoint tables (one per field, the type union needs a table)
+  for (int i = 0; i < columns.count(); ++i)
+  {
+    fb.alignTo(4);
+    fb.define(FieldTypeBase + i);
+    fb.vtableRef(FloatVtable);
+    fb.u16(kPrecisionDouble);    // at table offset 4
+    fb.pad(2);
+  }
+
+  // Name strings (length-prefixed, nul-terminated)
+  for (int i = 0; i < columns.count(); ++i)
+  {
+    const QByteArray name = columns.at(i).first.toUtf8();
+    fb.alignTo(4);
+    fb.define(FieldNameBase + i);
+    fb.u32(quint32(name.size()));
+    fb.bytes(name);
+    fb.u8(0);
+  }
+
+  // Vtables, matching the table layouts written above
+  fb.alignTo(2);
+  fb.define(MessageVtable);
+  fb.u16(10); // vtable bytes
+  fb.u16(12); // table bytes
+  fb.u16(4);  // version
+  fb.u16(6);  // header type
+  fb.u16(8);  // header
+
+  fb.define(PayloadVtable);
+  fb.u16(8);  // vtable bytes
+  fb.u16(8);  // table bytes
+  fb.u16(0);  // endianness (default)
+  fb.u16(4);  // fields
+
+  fb.define(FieldVtable);
+  fb.u16(12); // vtable bytes
+  fb.u16(16); // table bytes
+  fb.u16(4);  // name
+  fb.u16(0);  // nullable (default)
+  fb.u16(12); // type discriminant
+  fb.u16(8);  // type
+
+  fb.define(FloatVtable);
+  fb.u16(6);  // vtable bytes
+  fb.u16(8);  // table bytes
+  fb.u16(4);  // precision
+
+  return fb.finish();
+}
+
+/**
+ * @brief Assembles the flatbuffer of the record batch message.
+ *
+ * The batch carries one field node and two buffers per column: an empty
+ * validity buffer (the columns are null-free) followed by the float64 data
+ * buffer, whose body offsets are accumulated in column order.
+ *
+ * @param columns Number of exported columns.
+ * @param rows Number of rows shared by every column.
+ * @param bodyLength Total size of the message body in bytes.
+ */
+QByteArray buildBatchMessage(const int columns, const qsizetype rows,
+                             const qint64 bodyLength)
+{
+  FlatAssembler fb;
+
+  // Root offset to the Message table
+  fb.ref(MessageTable);
+
+  // Message table; the 64-bit body length forces 8-byte table alignment
+  fb.alignTo(8);
+  fb.define(MessageTable);
+  fb.vtableRef(MessageVtable);
+  fb.ref(PayloadTable);      // at table offset 4
+  fb.i64(bodyLength);        // at table offset 8
+  fb.u16(kMetadataVersion);  // at table offset 16
+  fb.u8(kHeaderRecordBatch); // at table offset 18
+  fb.pad(1);
+
+  // RecordBatch table: row count, field nodes & buffers
+  fb.alignTo(8);
+  fb.define(PayloadTable);
+  fb.vtableRef(PayloadVtable);
+  fb.ref(NodesVector);   // at table offset 4
+  fb.i64(rows);          // at table offset 8
+  fb.ref(BuffersVector); // at table offset 16
+
+  // Field nodes: row count & null count per column
+  fb.alignVector(8);
+  fb.define(NodesVector);
+  fb.u32(quint32(columns));
+  for (int i = 0; i < columns; ++i)
+  {
+    fb.i64(rows);
+    fb.i64(0);
+  }
+
+  // Buffers: per column, an empty validity buffer & the sample data
+  fb.alignVector(8);
+  fb.define(BuffersVector);
+  fb.u32(quint32(columns) * 2);
+  qint64 offset = 0;
+  for (int i = 0; i < columns; ++i)
+  {
+    fb.i64(offset); // validity (empty, shares the next buffer's offset)
+    fb.i64(0);
+    fb.i64(offset); // float64 samples
+    fb.i64(qint64(rows) * 8);
+    offset += qint64(rows) * 8;
+  }
+
+  // Vtables, matching the table layouts written above
+  fb.alignTo(2);
+  fb.define(MessageVtable);
+  fb.u16(12); // vtable bytes
+  fb.u16(20); // table bytes
+  fb.u16(16); // version
+  fb.u16(18); // header type
+  fb.u16(4);  // header
+  fb.u16(8);  // body length
+
+  fb.define(PayloadVtable);
+  fb.u16(10); // vtable bytes
+  fb.u16(20); // table bytes
+  fb.u16(8);  // length
+  fb.u16(4);  // nodes
+  fb.u16(16); // buffers
+
+  return fb.finish();
+}
+
+/**
+ * @brief Appends one encapsulated message to the output stream.
+ *
+ * Arrow IPC framing: the 0xFFFFFFFF continuation marker, the padded
+ * flatbuffer size, the flatbuffer itself & zero padding to the next
+ * 8-byte boundary.
+ */
+void appendMessage(QByteArray &out, const QByteArray &flatbuffer)
+{
+  const qsizetype padded = (flatbuffer.size() + 7) & ~qsizetype(7);
+
+  quint32 le;
+  qToLittleEndian(quint32(0xFFFFFFFFu), &le);
+  out.append(reinterpret_cast<const char *>(&le), sizeof(le));
+  qToLittleEndian(quint32(padded), &le);
+  out.append(reinterpret_cast<const char *>(&le), sizeof(le));
+  out.append(flatbuffer);
+  out.append(padded - flatbuffer.size(), '\0');
+}
+} // namespace
+
+/**
+ * @brief Encodes the given columns as a complete Arrow IPC stream.
+ *
+ * The stream holds the schema, a single record batch with every column &
+ * the end-of-stream marker, ready for @c pyarrow.ipc.open_stream() (and
+ * everything built on it) to consume in one read. The rows of a record
+ * batch must line up, so columns are truncated to the shortest column's
+ * row count, keeping the newest samples; in practice the dashboard's
+ * rings share one capacity and nothing is lost.
+ *
+ * @param columns Named sample columns, oldest sample first.
+ * @return The serialized stream, empty when there is nothing to export.
+ */
+QByteArray Plugins::ArrowWriter::encode(const QVector<Column> &columns)
+{
+  if (columns.isEmpty())
+    return QByteArray();
+
+  // Rows shared by every column of the record batch
+  qsizetype rows = std::numeric_limits<qsizetype>::max();
+  for (const auto &column : columns)
+    rows = qMin(rows, column.second.count());
+
+  // Serialize the schema message
+  QByteArray out;
+  appendMessage(out, buildSchemaMessage(columns));
+
+  // Serialize the record batch message & its body
+  const qint64 bodyLength = qint64(rows) * 8 * columns.count();
+  appendMessage(out, buildBatchMessage(columns.count(), rows, bodyLength));
+  for (const auto &column : columns)
+    out.append(reinterpret_cast<const char *>(column.second.constData()
+                                              + (column.second.count()
+                                                 - rows)),
+               rows * qsizetype(sizeof(qreal)));
+
+  // End-of-stream marker
+  quint32 le;
+  qToLittleEndian(quint32(0xFFFFFFFFu), &le);
+  out.append(reinterpret_cast<const char *>(&le), sizeof(le));
+  out.append(4, '\0');
+
+  return out;
+}
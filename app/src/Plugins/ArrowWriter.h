@@ -0,0 +1,62 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include <QByteArray>
+
+namespace Plugins
+{
+/**
+ * @class Plugins::ArrowWriter
+ * @brief Serializes sample columns as an Arrow IPC stream.
+ *
+ * Analysis tools (pandas, polars, anything speaking Arrow) bulk-read
+ * columnar float64 data orders of magnitude faster than they parse CSV, so
+ * the plugin server hands out the dashboard's sample store in the Arrow
+ * IPC streaming format: one schema message, one record batch whose body is
+ * the raw column buffers, and the end-of-stream marker. On the consumer
+ * side the column buffers are mapped zero-copy — minutes of telemetry
+ * arrive as a ready-to-use table instead of a parsing job.
+ *
+ * The writer emits the two flatbuffer metadata messages by hand: the
+ * schemas involved are tiny and fixed (every column is a non-nullable
+ * float64), which keeps the export free of a dependency on the Arrow
+ * libraries. Multi-byte values are written little-endian, matching the
+ * Arrow default schema endianness.
+ */
+class ArrowWriter
+{
+public:
+  /**
+   * @brief One exported column: a display name and its samples.
+   */
+  typedef QPair<QString, QVector<qreal>> Column;
+
+  static QByteArray encode(const QVector<Column> &columns);
+
+private:
+  ArrowWriter() = delete;
+};
+} // namespace Plugins
@@ -19,12 +19,18 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <algorithm>
+
+#include <QDateTime>
 #include <QJsonArray>
 #include <QJsonObject>
+#include <QDataStream>
 #include <QJsonDocument>
 
 #include "IO/Manager.h"
+#include "UI/Dashboard.h"
 #include "Plugins/Server.h"
+#include "Plugins/ArrowWriter.h"
 #include "JSON/FrameBuilder.h"
 
 #include "Misc/Utilities.h"
@@ -35,6 +41,9 @@
  */
 Plugins::Server::Server()
   : m_enabled(false)
+  , m_wsServer(QStringLiteral("Serial Studio Plugins"),
+               QWebSocketServer::NonSecureMode)
+  , m_publishedRevision(0)
 {
 
   // Send processed data at 1 Hz
@@ -43,7 +52,11 @@ Plugins::Server::Server()
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
           &Plugins::Server::sendProcessedData);
 
-  // Send I/O "raw" data directly
+  // Coalesce I/O "raw" data chunks & flush them with a bounded latency
+  m_rawFlushTimer.setSingleShot(true);
+  m_rawFlushTimer.setInterval(PLUGINS_RAW_FLUSH_INTERVAL);
+  connect(&m_rawFlushTimer, &QTimer::timeout, this,
+          &Plugins::Server::flushRawData);
   connect(&IO::Manager::instance(), &IO::Manager::dataReceived, this,
           &Plugins::Server::sendRawData, Qt::QueuedConnection);
 
@@ -51,6 +64,10 @@ Plugins::Server::Server()
   connect(&m_server, &QTcpServer::newConnection, this,
           &Plugins::Server::acceptConnection);
 
+  // Configure WebSocket server
+  connect(&m_wsServer, &QWebSocketServer::newConnection, this,
+          &Plugins::Server::acceptWsConnection);
+
   // Begin listening on TCP port
   if (!m_server.listen(QHostAddress::Any, PLUGINS_TCP_PORT))
   {
@@ -59,6 +76,15 @@ Plugins::Server::Server()
                                     QMessageBox::Warning);
     m_server.close();
   }
+
+  // Begin listening on WebSocket port
+  if (!m_wsServer.listen(QHostAddress::Any, PLUGINS_WS_PORT))
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Unable to start plugin WebSocket server"),
+        m_wsServer.errorString(), QMessageBox::Warning);
+    m_wsServer.close();
+  }
 }
 
 /**
@@ -67,6 +93,7 @@ Plugins::Server::Server()
 Plugins::Server::~Server()
 {
   m_server.close();
+  m_wsServer.close();
 }
 
 /**
@@ -120,9 +147,15 @@ void Plugins::Server::setEnabled(const bool enabled)
   m_enabled = enabled;
   Q_EMIT enabledChanged();
 
+  // Publish frames through shared memory while the subsystem is enabled
+  if (enabled)
+    m_sharedMemory.attach();
+
   // If not enabled, remove all connections
   if (!enabled)
   {
+    m_sharedMemory.detach();
+
     for (int i = 0; i < m_sockets.count(); ++i)
     {
       auto socket = m_sockets.at(i);
@@ -135,11 +168,34 @@ void Plugins::Server::setEnabled(const bool enabled)
     }
 
     m_sockets.clear();
+
+    Q_FOREACH (auto socket, m_wsSockets)
+    {
+      if (socket)
+      {
+        socket->abort();
+        socket->deleteLater();
+      }
+    }
+
+    m_wsSockets.clear();
+    m_binaryClients.clear();
+    m_deltaClients.clear();
+    m_subscriptions.clear();
+
+    m_rawFlushTimer.stop();
+    m_pendingRawData.clear();
+    m_pendingRawData.squeeze();
   }
 
   // Clear frames array to avoid memory leaks
   m_frames.clear();
   m_frames.squeeze();
+  m_frameTimes.clear();
+  m_frameTimes.squeeze();
+  m_lastFrame.clear();
+  m_publishedRevision = 0;
+  m_publishedValues.clear();
 }
 
 /**
@@ -201,6 +257,163 @@ void Plugins::Server::acceptConnection()
   m_sockets.append(socket);
 }
 
+/**
+ * Configures incoming WebSocket connection requests
+ */
+void Plugins::Server::acceptWsConnection()
+{
+  // Get & validate socket
+  auto socket = m_wsServer.nextPendingConnection();
+  if (!socket)
+    return;
+
+  // Close connection if system is not enabled
+  if (!enabled())
+  {
+    socket->close();
+    socket->deleteLater();
+    return;
+  }
+
+  // Connect socket signals/slots
+  connect(socket, &QWebSocket::textMessageReceived, this,
+          &Plugins::Server::onWsTextMessageReceived);
+  connect(socket, &QWebSocket::disconnected, this,
+          &Plugins::Server::removeWsConnection);
+
+  // Add socket to sockets list
+  m_wsSockets.append(socket);
+}
+
+/**
+ * Disconnects the WebSocket used for communicating with plugins.
+ */
+void Plugins::Server::removeWsConnection()
+{
+  // Get caller socket
+  auto socket = qobject_cast<QWebSocket *>(QObject::sender());
+
+  // Remove socket from registered sockets
+  if (socket)
+  {
+    m_wsSockets.removeAll(socket);
+    m_binaryClients.remove(socket);
+    m_deltaClients.remove(socket);
+    m_subscriptions.remove(socket);
+    socket->deleteLater();
+  }
+}
+
+/**
+ * @brief Processes a text message from a WebSocket plugin.
+ *
+ * A message consisting of a JSON object with a boolean "binary" or "delta"
+ * member is a transport negotiation: "binary" switches the calling client
+ * between the default JSON text encoding and the compact binary frame
+ * encoding, while "delta" enables the schema-once/values-only protocol. A
+ * "subscribe" member holding a list of dataset indexes replaces the
+ * full-frame push with filtered value updates for the calling client (an
+ * empty list unsubscribes). A true "arrow" member is a one-shot bulk pull:
+ * the server replies with a single binary message holding the dashboard's
+ * sample store as an Arrow IPC stream (see Plugins::ArrowWriter). Any
+ * other message is treated like incoming TCP data and written to the
+ * connected I/O device.
+ *
+ * @param message The text message received from the client.
+ */
+void Plugins::Server::onWsTextMessageReceived(const QString &message)
+{
+  // Get caller socket
+  auto socket = qobject_cast<QWebSocket *>(QObject::sender());
+  if (!enabled() || !socket)
+    return;
+
+  // Handle transport negotiation messages
+  const auto document = QJsonDocument::fromJson(message.toUtf8());
+  if (document.isObject())
+  {
+    const auto object = document.object();
+    if (object.contains("binary"))
+    {
+      if (object.value("binary").toBool())
+        m_binaryClients.insert(socket);
+      else
+        m_binaryClients.remove(socket);
+
+      return;
+    }
+
+    if (object.contains("delta"))
+    {
+      if (object.value("delta").toBool())
+      {
+        // Send the current schema so the client can decode value-only
+        // updates without waiting for the next project layout change
+        m_deltaClients.insert(socket);
+        if (m_lastFrame.isValid())
+          socket->sendTextMessage(QString::fromUtf8(encodeSchema(m_lastFrame)));
+      }
+
+      else
+        m_deltaClients.remove(socket);
+
+      return;
+    }
+
+    if (object.contains("subscribe"))
+    {
+      // Collect the requested dataset indexes
+      QSet<int> datasets;
+      const auto array = object.value("subscribe").toArray();
+      for (const auto &index : array)
+        datasets.insert(index.toInt());
+
+      // An empty (or invalid) list restores the full-frame push
+      if (datasets.isEmpty())
+        m_subscriptions.remove(socket);
+
+      // Register the subscription & send a snapshot of the current values,
+      // so the client starts from a known state instead of waiting for its
+      // datasets to change
+      else
+      {
+        m_subscriptions.insert(socket, datasets);
+        if (m_lastFrame.isValid())
+        {
+          const auto updates = subscribedUpdates(m_lastFrame, datasets, false);
+          if (!updates.isEmpty())
+          {
+            QJsonObject snapshot;
+            snapshot.insert(QStringLiteral("updates"), updates);
+            const QJsonDocument document(snapshot);
+            socket->sendTextMessage(
+                QString::fromUtf8(document.toJson(QJsonDocument::Compact)));
+          }
+        }
+      }
+
+      return;
+    }
+
+    if (object.contains("arrow"))
+    {
+      // Bulk history pull: the reply is built from the dashboard's sample
+      // rings on demand, the per-frame broadcast paths are never touched
+      if (object.value("arrow").toBool())
+      {
+        const auto stream
+            = ArrowWriter::encode(UI::Dashboard::instance().sampleColumns());
+        socket->sendBinaryMessage(stream);
+      }
+
+      return;
+    }
+  }
+
+  // Forward everything else to the I/O device
+  IO::Manager::instance().writeData(message.toUtf8());
+}
+
 /**
  * Sends an array of frames with the following information:
  * - Frame ID number
@@ -218,47 +431,72 @@ void Plugins::Server::sendProcessedData()
     return;
 
   // Stop if no sockets are available
-  if (m_sockets.count() < 1)
+  if (m_sockets.count() < 1 && m_wsSockets.count() < 1)
+  {
+    m_frames.clear();
+    m_frames.squeeze();
+    m_frameTimes.clear();
+    m_frameTimes.squeeze();
     return;
+  }
 
-  // Create JSON array with frame data
-  QJsonArray array;
+  // Stitch the frame batch together from cached per-structure skeletons,
+  // so the full QJsonDocument tree is not rebuilt once per frame
+  QByteArray payload;
+  payload += "{\"frames\":[";
   for (int i = 0; i < m_frames.count(); ++i)
   {
-    QJsonObject object;
-    auto frame = m_frames.at(i);
-    object.insert(QStringLiteral("data"), frame.serialize());
-    array.append(object);
+    if (i > 0)
+      payload += ',';
+
+    payload += "{\"data\":";
+    payload += m_frames.at(i).toJson();
+    payload += '}';
   }
 
-  // Create JSON document with frame arrays
-  if (array.count() > 0)
+  payload += "]}\n";
+
+  // Broadcast the shared buffers
+  if (m_frames.count() > 0)
   {
-    // Construct QByteArray with data
-    QJsonObject object;
-    object.insert(QStringLiteral("frames"), array);
-    const QJsonDocument document(object);
-    auto json = document.toJson(QJsonDocument::Compact) + "\n";
+    // Only pay the columnar encoding cost if a binary client is connected
+    QByteArray binary;
+    if (!m_binaryClients.isEmpty())
+      binary = encodeBinaryFrames();
 
-    // Send data to each plugin
-    Q_FOREACH (auto socket, m_sockets)
-    {
-      if (!socket)
-        continue;
+    // Only pay the delta encoding cost if a delta client is connected
+    QByteArray delta;
+    if (!m_deltaClients.isEmpty())
+      delta = encodeDeltaFrames();
 
-      if (socket->isWritable())
-        socket->write(json);
-    }
+    broadcast(payload, binary, delta);
+
+    // Serve filtered value updates to subscribed clients
+    if (!m_subscriptions.isEmpty())
+      sendSubscribedData();
   }
 
+  // Keep the latest frame around so delta clients that subscribe later can
+  // receive the current schema immediately
+  m_lastFrame = m_frames.last();
+
   // Clear frame list
   m_frames.clear();
   m_frames.squeeze();
+  m_frameTimes.clear();
+  m_frameTimes.squeeze();
 }
 
 /**
- * Encodes the given @a data in Base64 and sends it through the TCP socket
- * connected to the localhost.
+ * Queues the given @a data for broadcast to the connected plugins.
+ *
+ * Chunks are not written out one by one: devices at high baud rates deliver
+ * thousands of small reads per second, and paying one serialization and one
+ * socket write per chunk per client turns the plugin system into a syscall
+ * treadmill. Incoming chunks are appended to a coalescing buffer instead,
+ * and a single-shot timer flushes the stitched batch after at most
+ * @c PLUGINS_RAW_FLUSH_INTERVAL milliseconds, so the per-client write rate
+ * is bounded by the flush interval while the added latency stays capped.
  */
 void Plugins::Server::sendRawData(const QByteArray &data)
 {
@@ -267,36 +505,477 @@ void Plugins::Server::sendRawData(const QByteArray &data)
     return;
 
   // Stop if no sockets are available
-  if (m_sockets.count() < 1)
+  if (m_sockets.count() < 1 && m_wsSockets.count() < 1)
+  {
+    m_pendingRawData.clear();
+    return;
+  }
+
+  // Drop the chunk when the coalescing buffer is saturated; a consumer this
+  // far behind loses data instead of growing the buffer without bound
+  if (m_pendingRawData.size() + data.size() > PLUGINS_MAX_BACKLOG)
+    return;
+
+  // Append the chunk & arm the latency-bounded flush
+  m_pendingRawData.append(data);
+  if (!m_rawFlushTimer.isActive())
+    m_rawFlushTimer.start();
+}
+
+/**
+ * Encodes the coalesced raw data in Base64 and sends it through the TCP
+ * sockets connected to the localhost. WebSocket clients that negotiated the
+ * binary transport receive the raw bytes instead, prefixed with the "SSRD"
+ * magic number so they can tell raw captures apart from columnar frame
+ * batches.
+ */
+void Plugins::Server::flushRawData()
+{
+  // Nothing queued since the timer was armed
+  if (m_pendingRawData.isEmpty())
+    return;
+
+  // Take ownership of the batch before serializing
+  const QByteArray data = m_pendingRawData;
+  m_pendingRawData.clear();
+
+  // Stop if system is not enabled
+  if (!enabled())
+    return;
+
+  // Stop if no sockets are available
+  if (m_sockets.count() < 1 && m_wsSockets.count() < 1)
     return;
 
   // Create JSON structure with incoming data encoded in Base-64
   QJsonObject object;
   object.insert(QStringLiteral("data"), QString::fromUtf8(data.toBase64()));
 
-  // Get JSON string in compact format & send it over the TCP socket
+  // Binary clients get the raw bytes without the Base-64 detour
+  QByteArray binary;
+  if (!m_binaryClients.isEmpty())
+  {
+    QDataStream out(&binary, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_6_0);
+    out << quint32(0x53535244);
+    out << data;
+  }
+
+  // Serialize the payload once & broadcast the shared buffer
   QJsonDocument document(object);
-  const auto json = document.toJson(QJsonDocument::Compact) + "\n";
+  broadcast(document.toJson(QJsonDocument::Compact) + "\n", binary);
+}
 
-  // Send data to each plugin
+/**
+ * @brief Sends the given payload to every connected plugin.
+ *
+ * The payload is serialized exactly once by the caller; QByteArray is
+ * implicitly shared, so handing the same buffer to every socket queues it by
+ * reference instead of duplicating it per client. Each socket keeps its own
+ * send queue, and clients whose queue has grown past @c PLUGINS_MAX_BACKLOG
+ * skip the broadcast: a slow or stalled consumer drops frames instead of
+ * accumulating unbounded memory or delaying the other connections.
+ *
+ * TCP clients always receive the JSON payload. WebSocket clients receive it
+ * as a text message, unless they negotiated the delta or binary transport and
+ * the corresponding payload is available, in which case they get that
+ * encoding instead. Clients with a dataset subscription are skipped entirely:
+ * they receive their filtered updates from sendSubscribedData().
+ *
+ * @param json The serialized JSON payload to send.
+ * @param binary The binary payload for negotiated clients (may be empty).
+ * @param delta The delta payload for negotiated clients (may be empty).
+ */
+void Plugins::Server::broadcast(const QByteArray &json,
+                                const QByteArray &binary,
+                                const QByteArray &delta)
+{
   Q_FOREACH (auto socket, m_sockets)
   {
-    if (!socket)
+    if (!socket || !socket->isWritable())
+      continue;
+
+    // Drop the payload for saturated clients
+    if (socket->bytesToWrite() >= PLUGINS_MAX_BACKLOG)
+      continue;
+
+    socket->write(json);
+  }
+
+  // Convert the JSON payload to UTF-16 only once for all text-mode clients
+  QString text;
+  Q_FOREACH (auto socket, m_wsSockets)
+  {
+    if (!socket || !socket->isValid())
+      continue;
+
+    // Subscribed clients only receive their filtered dataset updates
+    if (m_subscriptions.contains(socket))
+      continue;
+
+    // Drop the payload for saturated clients
+    if (socket->bytesToWrite() >= PLUGINS_MAX_BACKLOG)
+      continue;
+
+    if (!delta.isEmpty() && m_deltaClients.contains(socket))
+      socket->sendTextMessage(QString::fromUtf8(delta));
+
+    else if (!binary.isEmpty() && m_binaryClients.contains(socket))
+      socket->sendBinaryMessage(binary);
+
+    else
+    {
+      if (text.isEmpty())
+        text = QString::fromUtf8(json);
+
+      socket->sendTextMessage(text);
+    }
+  }
+}
+
+/**
+ * @brief Sends filtered value updates to clients with dataset subscriptions.
+ *
+ * Each frame of the pending batch is reduced to the [index, value] pairs of
+ * the subscribed datasets that actually changed, as tracked by the frame
+ * builder's dirty-dataset diff; frames that touched none of the subscribed
+ * datasets are omitted, so an idle telemetry stream costs a narrow consumer
+ * nothing at all. Clients that requested the same dataset set share one
+ * serialization, and saturated clients skip the batch just like in
+ * broadcast().
+ */
+void Plugins::Server::sendSubscribedData()
+{
+  QHash<QByteArray, QString> cache;
+  for (auto it = m_subscriptions.constBegin(); it != m_subscriptions.constEnd();
+       ++it)
+  {
+    auto *socket = it.key();
+    if (!socket || !socket->isValid())
+      continue;
+
+    // Drop the payload for saturated clients
+    if (socket->bytesToWrite() >= PLUGINS_MAX_BACKLOG)
+      continue;
+
+    // Build a cache key from the sorted dataset indexes, so clients with
+    // identical subscriptions reuse the same serialization
+    auto indexes = it.value().values();
+    std::sort(indexes.begin(), indexes.end());
+    QByteArray key;
+    for (const auto index : indexes)
+      key += QByteArray::number(index) + ',';
+
+    // Reduce the batch to the subscribed dirty datasets
+    QString message;
+    if (cache.contains(key))
+      message = cache.value(key);
+
+    else
+    {
+      QJsonArray frames;
+      for (const auto &frame : std::as_const(m_frames))
+      {
+        const auto updates = subscribedUpdates(frame, it.value(), true);
+        if (updates.isEmpty())
+          continue;
+
+        QJsonObject object;
+        object.insert(QStringLiteral("updates"), updates);
+        frames.append(object);
+      }
+
+      if (!frames.isEmpty())
+      {
+        QJsonObject object;
+        object.insert(QStringLiteral("frames"), frames);
+        const QJsonDocument document(object);
+        message = QString::fromUtf8(document.toJson(QJsonDocument::Compact));
+      }
+
+      cache.insert(key, message);
+    }
+
+    // Skip the broadcast entirely when nothing changed
+    if (!message.isEmpty())
+      socket->sendTextMessage(message);
+  }
+}
+
+/**
+ * @brief Collects the [index, value] pairs of the subscribed datasets.
+ *
+ * With @a onlyChanged set, datasets outside the frame's dirty-index diff are
+ * skipped; frames without diff tracking conservatively count as fully dirty.
+ * Datasets that share an index only contribute one update.
+ *
+ * @param frame The frame to read values from.
+ * @param datasets The subscribed dataset indexes.
+ * @param onlyChanged Restrict the result to datasets that changed.
+ * @return The update array for the subscription protocol.
+ */
+QJsonArray Plugins::Server::subscribedUpdates(const JSON::Frame &frame,
+                                              const QSet<int> &datasets,
+                                              const bool onlyChanged) const
+{
+  const auto &changed = frame.updatedIndexes();
+  const bool filterChanged = onlyChanged && !changed.isEmpty();
+
+  QJsonArray updates;
+  QSet<int> pending = datasets;
+  const auto &groups = frame.groups();
+  for (auto g = groups.constBegin();
+       g != groups.constEnd() && !pending.isEmpty(); ++g)
+  {
+    const auto &sets = g->datasets();
+    for (auto d = sets.constBegin(); d != sets.constEnd(); ++d)
+    {
+      if (!pending.contains(d->index()))
+        continue;
+
+      if (filterChanged && !changed.contains(d->index()))
+        continue;
+
+      pending.remove(d->index());
+      QJsonArray update;
+      update.append(d->index());
+      update.append(d->value());
+      updates.append(update);
+    }
+  }
+
+  return updates;
+}
+
+/**
+ * @brief Serializes the schema message for the delta protocol.
+ *
+ * The message carries the full group/dataset structure of the given frame
+ * along with its structure revision. Delta clients cache it and use it to
+ * reconstruct complete frames from the value-only updates that follow.
+ *
+ * @param frame The frame whose structure should be serialized.
+ * @return The serialized schema message.
+ */
+QByteArray Plugins::Server::encodeSchema(const JSON::Frame &frame) const
+{
+  QJsonObject object;
+  object.insert(QStringLiteral("schema"), frame.serialize());
+  object.insert(QStringLiteral("revision"),
+                qint64(frame.structureRevision()));
+
+  const QJsonDocument document(object);
+  return document.toJson(QJsonDocument::Compact) + "\n";
+}
+
+/**
+ * @brief Serializes the pending frame batch with the delta encoding.
+ *
+ * Frames whose structure revision matches the last published schema are
+ * reduced to the indexes & values of the datasets that differ from what the
+ * clients already hold: the frame builder's updated-index set narrows the
+ * scan to the datasets the frame refreshed, and a value cache drops updates
+ * that repeat the last published value (sparse sources re-send constant
+ * readings on every arrival). A layout change (or a frame without revision
+ * tracking) re-publishes the full schema instead, so clients never apply
+ * updates against a stale structure. Frames without any changed values are
+ * omitted entirely, which is what makes the encoding pay off on metered
+ * links: idle telemetry costs almost nothing.
+ *
+ * @return The serialized delta message, or an empty buffer if the batch
+ * contains no schema changes and no value updates.
+ */
+QByteArray Plugins::Server::encodeDeltaFrames()
+{
+  QJsonArray array;
+  for (int i = 0; i < m_frames.count(); ++i)
+  {
+    const auto &frame = m_frames.at(i);
+
+    // Re-publish the schema on layout changes & untracked frames
+    if (frame.structureRevision() == 0
+        || frame.structureRevision() != m_publishedRevision)
+    {
+      m_publishedRevision = frame.structureRevision();
+      m_publishedValues.clear();
+
+      QJsonObject object;
+      object.insert(QStringLiteral("schema"), frame.serialize());
+      object.insert(QStringLiteral("revision"),
+                    qint64(frame.structureRevision()));
+      array.append(object);
       continue;
+    }
+
+    // Reduce the frame to the datasets it refreshed
+    const auto &updated = frame.updatedIndexes();
+    if (updated.isEmpty())
+      continue;
+
+    // Collect [index, value] pairs for the refreshed datasets, skipping the
+    // ones whose value matches what the clients already hold; datasets that
+    // share an index only contribute one update
+    QJsonArray updates;
+    QSet<int> pending = updated;
+    const auto &groups = frame.groups();
+    for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
+    {
+      const auto &datasets = g->datasets();
+      for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+      {
+        if (pending.remove(d->index()))
+        {
+          const auto value = m_publishedValues.constFind(d->index());
+          if (value != m_publishedValues.cend() && *value == d->value())
+            continue;
+
+          m_publishedValues.insert(d->index(), d->value());
+          QJsonArray update;
+          update.append(d->index());
+          update.append(d->value());
+          updates.append(update);
+        }
+      }
+    }
 
-    if (socket->isWritable())
-      socket->write(json);
+    // Every refreshed value matched the published state, omit the frame
+    if (updates.isEmpty())
+      continue;
+
+    // Append the value-only update to the batch
+    QJsonObject object;
+    object.insert(QStringLiteral("updates"), updates);
+    object.insert(QStringLiteral("revision"),
+                  qint64(frame.structureRevision()));
+    array.append(object);
   }
+
+  // Skip the broadcast entirely when nothing changed
+  if (array.isEmpty())
+    return QByteArray();
+
+  QJsonObject object;
+  object.insert(QStringLiteral("frames"), array);
+  const QJsonDocument document(object);
+  return document.toJson(QJsonDocument::Compact) + "\n";
+}
+
+/**
+ * @brief Serializes the pending frame batch with the columnar binary layout.
+ *
+ * The message mirrors the on-disk ".ssb" recording format: a header with the
+ * magic number, frame title and sorted dataset indexes & column headers,
+ * followed by a single compressed chunk holding the RX timestamps and one
+ * value array per dataset. Numeric columns are stored as typed double arrays,
+ * so a batch of telemetry costs roughly a fifth of the equivalent JSON text.
+ *
+ * @return The serialized binary message for WebSocket clients.
+ */
+QByteArray Plugins::Server::encodeBinaryFrames() const
+{
+  // Obtain the sorted dataset indexes & headers from the first frame
+  QMap<int, QString> headers;
+  const auto &groups = m_frames.first().groups();
+  for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
+  {
+    const auto &datasets = g->datasets();
+    for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+    {
+      if (!headers.contains(d->index()))
+        headers[d->index()]
+            = QString("%1/%2").arg(g->title(), d->title()).simplified();
+    }
+  }
+
+  // Validate column layout
+  if (headers.isEmpty())
+    return QByteArray();
+
+  // Transpose the batch into timestamps & per-dataset columns
+  const int rows = m_frames.count();
+  QVector<QStringList> columns(headers.count());
+  for (auto &column : columns)
+    column.reserve(rows);
+
+  // Collect field values for each frame
+  for (int i = 0; i < rows; ++i)
+  {
+    QMap<int, QString> fieldValues;
+    const auto &frameGroups = m_frames.at(i).groups();
+    for (auto g = frameGroups.constBegin(); g != frameGroups.constEnd(); ++g)
+    {
+      const auto &datasets = g->datasets();
+      for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+        fieldValues[d->index()] = d->value().simplified();
+    }
+
+    // Store values according to the sorted field order
+    int j = 0;
+    for (auto h = headers.constBegin(); h != headers.constEnd(); ++h, ++j)
+      columns[j].append(fieldValues.value(h.key(), QString()));
+  }
+
+  // Serialize the chunk in columnar order
+  QByteArray chunk;
+  QDataStream data(&chunk, QIODevice::WriteOnly);
+  data.setVersion(QDataStream::Qt_6_0);
+  data << m_frameTimes;
+  for (const auto &column : columns)
+  {
+    // Store the column as a typed double array when every value is numeric
+    bool numeric = !column.isEmpty();
+    QVector<double> values;
+    values.reserve(column.count());
+    for (const auto &value : column)
+    {
+      bool ok;
+      values.append(value.toDouble(&ok));
+      if (!ok)
+      {
+        numeric = false;
+        break;
+      }
+    }
+
+    // Write column type tag & data
+    if (numeric)
+      data << quint8(0) << values;
+    else
+      data << quint8(1) << column;
+  }
+
+  // Assemble the message (header, row count & compressed chunk)
+  QByteArray message;
+  QDataStream out(&message, QIODevice::WriteOnly);
+  out.setVersion(QDataStream::Qt_6_0);
+  out << quint32(0x53534231);
+  out << m_frames.first().title();
+  out << quint32(headers.count());
+  for (auto h = headers.constBegin(); h != headers.constEnd(); ++h)
+    out << qint32(h.key()) << h.value();
+  out << quint32(rows) << qCompress(chunk);
+
+  return message;
 }
 
 /**
  * Obtains the latest JSON dataframe & appends it to the JSON list, which is
  * later read and sent by the @c sendProcessedData() function.
+ *
+ * The frame is also published to the shared memory ring immediately, so
+ * co-located consumers receive it with microsecond-scale latency instead of
+ * waiting for the batched socket broadcast.
  */
-void Plugins::Server::registerFrame(const JSON::Frame &frame)
+void Plugins::Server::registerFrame(const std::shared_ptr<JSON::Frame> &frame)
 {
-  if (enabled())
-    m_frames.append(frame);
+  if (enabled() && frame)
+  {
+    m_frames.append(*frame);
+    m_frameTimes.append(QDateTime::currentMSecsSinceEpoch());
+
+    if (m_sharedMemory.isAttached())
+      m_sharedMemory.write(frame->toJson());
+  }
 }
 
 /**
@@ -21,13 +21,22 @@
 
 #pragma once
 
+#include <memory>
+
+#include <QSet>
+#include <QHash>
+#include <QTimer>
 #include <QObject>
+#include <QJsonArray>
 #include <QTcpSocket>
 #include <QTcpServer>
 #include <QByteArray>
+#include <QWebSocket>
 #include <QHostAddress>
+#include <QWebSocketServer>
 
 #include "JSON/Frame.h"
+#include "Plugins/SharedMemoryBus.h"
 
 /**
  * Default TCP port to use for incoming connections, I choose 7777 because 7 is
@@ -35,6 +44,28 @@
  */
 #define PLUGINS_TCP_PORT 7777
 
+/**
+ * Default port for the WebSocket listener, one above the TCP port so both can
+ * be remembered together. Browser dashboards connect here directly instead of
+ * going through a TCP-to-WebSocket bridge process.
+ */
+#define PLUGINS_WS_PORT 7778
+
+/**
+ * Maximum number of bytes that may sit unsent in a client's send queue before
+ * new broadcasts are dropped for that client. Bounds the memory cost of a slow
+ * or stalled consumer without affecting the other connected plugins.
+ */
+#define PLUGINS_MAX_BACKLOG (4 * 1024 * 1024)
+
+/**
+ * Maximum time (in milliseconds) a raw data chunk may wait in the coalescing
+ * buffer before it is broadcast to the connected plugins. Chunks that arrive
+ * within one window are stitched into a single message, so the per-client
+ * write rate is bounded by this interval instead of the device's chunk rate.
+ */
+#define PLUGINS_RAW_FLUSH_INTERVAL 10
+
 namespace Plugins
 {
 /**
@@ -51,6 +82,37 @@ namespace Plugins
  * A benefit of implementing plugins in this manner is that you can write your
  * Serial Studio companion application in any language and framework that you
  * desire, you do not have to force yourself to use Qt or C/C++.
+ *
+ * A WebSocket listener on port 7778 serves the same data to browser-based
+ * consumers. WebSocket clients receive frames as JSON text messages by
+ * default, and may send {"binary": true} to switch to a compact binary
+ * encoding that reuses the columnar chunk layout of the ".ssb" recording
+ * format, cutting payload sizes roughly five-fold for numeric telemetry.
+ *
+ * WebSocket clients may also send {"delta": true} to switch to a delta
+ * encoding: the full group/dataset structure is sent once (and again whenever
+ * the project layout changes), subsequent frames carry only the indexes and
+ * values of the datasets that actually changed. Metered links pay for the
+ * schema once instead of re-transmitting the JSON keys with every frame.
+ *
+ * Narrow consumers may send {"subscribe": [1, 4, 7]} with a list of dataset
+ * indexes to replace the full-frame push entirely: the server then delivers
+ * only the subscribed values that changed, as {"frames": [{"updates":
+ * [[index, value], ...]}]} messages built from the dirty-dataset diff. A
+ * snapshot of the current values is sent when the subscription is made, and
+ * an empty list restores the regular broadcasts.
+ *
+ * Analysis clients may send {"arrow": true} to bulk-read history instead of
+ * tailing the live push: the server replies with one binary message holding
+ * the dashboard's sample store as an Arrow IPC stream (every plotted series
+ * plus its capture-time column, float64 throughout), which pandas/polars
+ * map into a table without parsing. See Plugins::ArrowWriter.
+ *
+ * Consumers co-located with Serial Studio can skip the sockets entirely: the
+ * serialized frames are also published through a shared memory ring (see
+ * SharedMemoryBus), written per frame as it arrives rather than at the
+ * batched socket cadence, for microsecond-scale handoff to local IPC
+ * consumers.
  */
 class Server : public QObject
 {
@@ -81,14 +143,41 @@ private slots:
   void onDataReceived();
   void acceptConnection();
   void sendProcessedData();
+  void acceptWsConnection();
+  void removeWsConnection();
+  void flushRawData();
   void sendRawData(const QByteArray &data);
-  void registerFrame(const JSON::Frame &frame);
+  void onWsTextMessageReceived(const QString &message);
+  void registerFrame(const std::shared_ptr<JSON::Frame> &frame);
   void onErrorOccurred(const QAbstractSocket::SocketError socketError);
 
+private:
+  void broadcast(const QByteArray &json, const QByteArray &binary,
+                 const QByteArray &delta = QByteArray());
+  void sendSubscribedData();
+  [[nodiscard]] QJsonArray subscribedUpdates(const JSON::Frame &frame,
+                                             const QSet<int> &datasets,
+                                             const bool onlyChanged) const;
+  QByteArray encodeDeltaFrames();
+  [[nodiscard]] QByteArray encodeBinaryFrames() const;
+  [[nodiscard]] QByteArray encodeSchema(const JSON::Frame &frame) const;
+
 private:
   bool m_enabled;
   QTcpServer m_server;
+  QWebSocketServer m_wsServer;
+  SharedMemoryBus m_sharedMemory;
+  JSON::Frame m_lastFrame;
+  quint64 m_publishedRevision;
+  QHash<int, QString> m_publishedValues;
   QVector<JSON::Frame> m_frames;
+  QVector<qint64> m_frameTimes;
+  QTimer m_rawFlushTimer;
+  QByteArray m_pendingRawData;
   QVector<QTcpSocket *> m_sockets;
+  QVector<QWebSocket *> m_wsSockets;
+  QSet<QWebSocket *> m_binaryClients;
+  QSet<QWebSocket *> m_deltaClients;
+  QHash<QWebSocket *, QSet<int>> m_subscriptions;
 };
 } // namespace Plugins
@@ -0,0 +1,178 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstring>
+
+#include <QDateTime>
+
+#include "Plugins/SharedMemoryBus.h"
+
+/**
+ * Constructor function
+ */
+Plugins::SharedMemoryBus::SharedMemoryBus()
+{
+  m_memory.setKey(QStringLiteral(PLUGINS_SHM_KEY));
+}
+
+/**
+ * Destructor function, releases the shared memory segment
+ */
+Plugins::SharedMemoryBus::~SharedMemoryBus()
+{
+  detach();
+}
+
+/**
+ * Returns @c true if the shared memory segment is attached & initialized
+ */
+bool Plugins::SharedMemoryBus::isAttached() const
+{
+  return m_memory.isAttached();
+}
+
+/**
+ * @brief Creates & initializes the shared memory segment.
+ *
+ * If a segment with the well-known key already exists (for example after a
+ * crash on platforms where segments outlive their creator), it is attached
+ * and its header is re-initialized so consumers start from a clean ring.
+ *
+ * @return @c true on success, @c false if the segment could not be created.
+ */
+bool Plugins::SharedMemoryBus::attach()
+{
+  // Nothing to do if the segment is already up
+  if (m_memory.isAttached())
+    return true;
+
+  // Create the segment, recycling a stale one when it already exists
+  const auto size = int(sizeof(Header)) + PLUGINS_SHM_RING_SIZE;
+  if (!m_memory.create(size))
+  {
+    if (m_memory.error() != QSharedMemory::AlreadyExists)
+      return false;
+
+    if (!m_memory.attach())
+      return false;
+  }
+
+  // Validate the mapping size, an existing segment may be too small
+  if (m_memory.size() < size)
+  {
+    m_memory.detach();
+    return false;
+  }
+
+  // Initialize the segment header
+  auto *hdr = header();
+  hdr->magic = 0x5353484D;
+  hdr->version = 1;
+  hdr->capacity = PLUGINS_SHM_RING_SIZE;
+  hdr->writeOffset.store(0, std::memory_order_relaxed);
+  hdr->frameSequence.store(0, std::memory_order_release);
+  return true;
+}
+
+/**
+ * Detaches from the shared memory segment. The operating system removes the
+ * segment once the last consumer detaches as well.
+ */
+void Plugins::SharedMemoryBus::detach()
+{
+  if (m_memory.isAttached())
+    m_memory.detach();
+}
+
+/**
+ * @brief Appends a serialized frame to the shared memory ring.
+ *
+ * The record is written at the current write offset and published with a
+ * single release store, so consumers either see the complete record or none
+ * of it. The ring overwrites its oldest contents when full: slow consumers
+ * detect the overrun through the monotonic write offset and resynchronize,
+ * the producer never blocks.
+ *
+ * @param payload The serialized frame to publish.
+ * @return @c true if the record was written.
+ */
+bool Plugins::SharedMemoryBus::write(const QByteArray &payload)
+{
+  // Validate arguments & segment state
+  if (!m_memory.isAttached() || payload.isEmpty())
+    return false;
+
+  // Compute the padded record size (length, timestamp & payload)
+  auto *hdr = header();
+  const quint64 capacity = hdr->capacity;
+  constexpr quint64 recordHeader = sizeof(quint32) + sizeof(quint64);
+  const quint64 recordSize
+      = (recordHeader + quint64(payload.size()) + 7) & ~quint64(7);
+
+  // Drop frames that cannot fit in the ring at all
+  if (recordSize > capacity)
+    return false;
+
+  // Records never wrap: skip the tail of the ring when the record does not
+  // fit before the end, leaving a marker so consumers can follow
+  quint64 offset = hdr->writeOffset.load(std::memory_order_relaxed);
+  quint64 position = offset % capacity;
+  if (position + recordSize > capacity)
+  {
+    if (capacity - position >= sizeof(quint32))
+    {
+      const quint32 marker = 0xFFFFFFFF;
+      std::memcpy(ring() + position, &marker, sizeof(marker));
+    }
+
+    offset += capacity - position;
+    position = 0;
+  }
+
+  // Copy the record into the ring
+  const quint32 length = quint32(payload.size());
+  const quint64 timestamp = quint64(QDateTime::currentMSecsSinceEpoch());
+  auto *record = ring() + position;
+  std::memcpy(record, &length, sizeof(length));
+  std::memcpy(record + sizeof(length), &timestamp, sizeof(timestamp));
+  std::memcpy(record + recordHeader, payload.constData(), size_t(length));
+
+  // Publish the record & bump the frame sequence number
+  hdr->writeOffset.store(offset + recordSize, std::memory_order_release);
+  hdr->frameSequence.fetch_add(1, std::memory_order_release);
+  return true;
+}
+
+/**
+ * Returns a pointer to the segment header
+ */
+Plugins::SharedMemoryBus::Header *Plugins::SharedMemoryBus::header() const
+{
+  return static_cast<Header *>(const_cast<void *>(m_memory.constData()));
+}
+
+/**
+ * Returns a pointer to the first byte of the ring data
+ */
+char *Plugins::SharedMemoryBus::ring() const
+{
+  return reinterpret_cast<char *>(header() + 1);
+}
@@ -0,0 +1,107 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QByteArray>
+#include <QSharedMemory>
+
+/**
+ * Well-known key of the shared memory segment, consumers on the same machine
+ * attach to it by name.
+ */
+#define PLUGINS_SHM_KEY "SerialStudio.Plugins"
+
+/**
+ * Size of the frame ring inside the segment. Four megabytes hold several
+ * seconds of telemetry at typical frame sizes; a consumer that falls further
+ * behind than that resynchronizes instead of blocking the producer.
+ */
+#define PLUGINS_SHM_RING_SIZE (4 * 1024 * 1024)
+
+namespace Plugins
+{
+/**
+ * @brief The SharedMemoryBus class
+ *
+ * Publishes the serialized frames of the plugin subsystem through a shared
+ * memory ring, so consumers running on the same machine can receive them
+ * without paying the per-frame copies and syscalls of the TCP loopback.
+ *
+ * The segment starts with a small header (all fields little-endian, native
+ * alignment):
+ *
+ *   offset 0   quint32             magic number 0x5353484D ("SSHM")
+ *   offset 4   quint32             layout version (currently 1)
+ *   offset 8   quint64             ring capacity in bytes
+ *   offset 16  atomic quint64      write offset (monotonic byte counter)
+ *   offset 24  atomic quint64      frame sequence number
+ *
+ * The ring data follows the header. Each record is a quint32 payload length,
+ * a quint64 reception timestamp (milliseconds since the epoch) and the
+ * payload bytes, padded to an eight byte boundary. Records never wrap: when
+ * one does not fit before the end of the ring, a quint32 0xFFFFFFFF marker is
+ * written instead (when at least four bytes remain) and the record starts at
+ * the beginning of the ring.
+ *
+ * Consumers keep a private cursor, initialized from the write offset. After
+ * copying the records between the cursor and an acquire-load of the write
+ * offset, they must re-check that the write offset did not advance past
+ * cursor + capacity during the copy: if it did, the copied bytes may be torn
+ * and the cursor is simply reset to the current write offset. The producer
+ * never waits for consumers, so a stalled reader costs the telemetry stream
+ * nothing.
+ */
+class SharedMemoryBus
+{
+public:
+  SharedMemoryBus();
+  ~SharedMemoryBus();
+
+  // Disable copying
+  SharedMemoryBus(const SharedMemoryBus &) = delete;
+  SharedMemoryBus &operator=(const SharedMemoryBus &) = delete;
+
+  [[nodiscard]] bool isAttached() const;
+
+  bool attach();
+  void detach();
+  bool write(const QByteArray &payload);
+
+private:
+  struct Header
+  {
+    quint32 magic;
+    quint32 version;
+    quint64 capacity;
+    std::atomic<quint64> writeOffset;
+    std::atomic<quint64> frameSequence;
+  };
+
+  [[nodiscard]] Header *header() const;
+  [[nodiscard]] char *ring() const;
+
+private:
+  QSharedMemory m_memory;
+};
+} // namespace Plugins
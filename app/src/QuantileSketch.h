@@ -0,0 +1,292 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @class QuantileSketch
+ * @brief Streaming quantile sketch with bounded memory and relative accuracy.
+ *
+ * Samples are folded into logarithmically-spaced buckets (the DDSketch
+ * scheme): every value is mapped to the bucket whose bounds are consecutive
+ * powers of gamma = (1 + alpha) / (1 - alpha), which guarantees that any
+ * quantile estimate is within a relative error of alpha of the true sample.
+ * Positive and negative values use separate bucket stores and exact zeros
+ * are counted separately, so distributions of any sign work.
+ *
+ * Each store holds a fixed number of buckets; when the dynamic range of the
+ * samples outgrows the store, the lowest buckets are collapsed into the
+ * first one, trading accuracy at the far low end for bounded memory. Memory
+ * use is therefore constant regardless of how many samples are inserted,
+ * and both insertion and memory stay O(1) with respect to the run length.
+ *
+ * Queries walk the bucket stores in value order: quantile() returns the
+ * value estimate at a given rank fraction and rank() returns the number of
+ * samples at or below a given value, which lets a consumer rebuild a linear
+ * histogram of any resolution by differencing cumulative counts.
+ */
+class QuantileSketch
+{
+public:
+  /**
+   * @brief Number of buckets in each of the two sign stores.
+   */
+  static constexpr int BinCount = 1024;
+
+  /**
+   * @brief Magnitudes below this threshold are counted as zero.
+   */
+  static constexpr double MinMagnitude = 1e-9;
+
+  /**
+   * @brief Constructs an empty sketch.
+   * @param relativeAccuracy Relative error bound of quantile estimates.
+   */
+  explicit QuantileSketch(const double relativeAccuracy = 0.01)
+    : m_gamma((1.0 + relativeAccuracy) / (1.0 - relativeAccuracy))
+    , m_logGamma(std::log(m_gamma))
+  {
+    clear();
+  }
+
+  /**
+   * @brief Discards every accumulated sample.
+   */
+  void clear()
+  {
+    m_count = 0;
+    m_zeroCount = 0;
+    m_negTotal = 0;
+    m_posOffset = 0;
+    m_negOffset = 0;
+    m_min = 0;
+    m_max = 0;
+    m_posBins.clear();
+    m_negBins.clear();
+  }
+
+  /**
+   * @brief Returns the total number of inserted samples.
+   */
+  [[nodiscard]] quint64 count() const { return m_count; }
+
+  /**
+   * @brief Returns the smallest inserted sample (0 when empty).
+   */
+  [[nodiscard]] double minValue() const { return m_min; }
+
+  /**
+   * @brief Returns the largest inserted sample (0 when empty).
+   */
+  [[nodiscard]] double maxValue() const { return m_max; }
+
+  /**
+   * @brief Folds one sample into the sketch.
+   * @param value The sample to record.
+   */
+  void insert(const double value)
+  {
+    if (std::isnan(value) || std::isinf(value))
+      return;
+
+    if (m_count == 0)
+    {
+      m_min = value;
+      m_max = value;
+    }
+
+    else
+    {
+      m_min = std::min(m_min, value);
+      m_max = std::max(m_max, value);
+    }
+
+    ++m_count;
+    if (std::abs(value) < MinMagnitude)
+      ++m_zeroCount;
+
+    else if (value > 0)
+      insertKey(m_posBins, m_posOffset, key(value));
+
+    else
+    {
+      ++m_negTotal;
+      insertKey(m_negBins, m_negOffset, key(-value));
+    }
+  }
+
+  /**
+   * @brief Estimates the value at the given quantile.
+   * @param q Rank fraction in the [0, 1] range.
+   * @return The value estimate, or 0 when the sketch is empty.
+   */
+  [[nodiscard]] double quantile(const double q) const
+  {
+    if (m_count == 0)
+      return 0;
+
+    // Clamp the requested rank to the accumulated sample count
+    const auto target = static_cast<quint64>(
+        std::clamp(q, 0.0, 1.0) * static_cast<double>(m_count - 1));
+
+    // Walk the negative store from the most negative value upwards
+    quint64 rank = 0;
+    for (int i = m_negBins.count() - 1; i >= 0; --i)
+    {
+      rank += m_negBins[i];
+      if (rank > target && m_negBins[i] > 0)
+        return std::clamp(-bucketValue(m_negOffset + i), m_min, m_max);
+    }
+
+    // Zeros sit between the negative and positive stores
+    rank += m_zeroCount;
+    if (rank > target && m_zeroCount > 0)
+      return std::clamp(0.0, m_min, m_max);
+
+    // Walk the positive store from the smallest value upwards
+    for (int i = 0; i < m_posBins.count(); ++i)
+    {
+      rank += m_posBins[i];
+      if (rank > target && m_posBins[i] > 0)
+        return std::clamp(bucketValue(m_posOffset + i), m_min, m_max);
+    }
+
+    return m_max;
+  }
+
+  /**
+   * @brief Estimates the number of samples at or below the given value.
+   * @param value Threshold value.
+   * @return The cumulative sample count estimate.
+   */
+  [[nodiscard]] quint64 rank(const double value) const
+  {
+    // Negative threshold: count the negatives with a larger magnitude
+    if (value < 0)
+    {
+      quint64 rank = 0;
+      const int k = key(-std::min(value, -MinMagnitude));
+      for (int i = std::max(k - m_negOffset, 0); i < m_negBins.count(); ++i)
+        rank += m_negBins[i];
+
+      return rank;
+    }
+
+    // Every negative sample & every zero sits at or below the threshold
+    quint64 rank = m_negTotal + m_zeroCount;
+    if (value >= MinMagnitude)
+    {
+      const int k = key(value);
+      const int last = std::min(k - m_posOffset, m_posBins.count() - 1);
+      for (int i = 0; i <= last; ++i)
+        rank += m_posBins[i];
+    }
+
+    return rank;
+  }
+
+private:
+  /**
+   * @brief Maps a positive magnitude to its bucket key.
+   */
+  [[nodiscard]] int key(const double magnitude) const
+  {
+    return static_cast<int>(
+        std::ceil(std::log(std::max(magnitude, MinMagnitude)) / m_logGamma));
+  }
+
+  /**
+   * @brief Returns the value estimate for a bucket key (bucket midpoint).
+   */
+  [[nodiscard]] double bucketValue(const int key) const
+  {
+    return 2.0 * std::pow(m_gamma, key) / (m_gamma + 1.0);
+  }
+
+  /**
+   * @brief Increments the bucket for the given key, collapsing the lowest
+   *        buckets when the key range outgrows the store.
+   */
+  void insertKey(QVector<quint64> &bins, int &offset, const int key)
+  {
+    // Allocate the store lazily on the first sample of this sign
+    if (bins.isEmpty())
+    {
+      bins.resize(BinCount);
+      offset = key;
+    }
+
+    // Collapse the lowest buckets to make room for the new key
+    if (key >= offset + BinCount)
+    {
+      const int shift = key - (offset + BinCount) + 1;
+      if (shift >= BinCount)
+      {
+        quint64 total = 0;
+        for (const auto count : bins)
+          total += count;
+
+        bins.fill(0);
+        bins[0] = total;
+        offset = key - BinCount + 1;
+      }
+
+      else
+      {
+        quint64 collapsed = 0;
+        for (int i = 0; i <= shift; ++i)
+          collapsed += bins[i];
+
+        std::memmove(bins.data(), bins.data() + shift,
+                     static_cast<size_t>(BinCount - shift) * sizeof(quint64));
+        std::fill(bins.end() - shift, bins.end(), quint64(0));
+        bins[0] = collapsed;
+        offset += shift;
+      }
+    }
+
+    // Keys below the store collapse into the first bucket
+    ++bins[std::max(key - offset, 0)];
+  }
+
+private:
+  double m_gamma;
+  double m_logGamma;
+
+  quint64 m_count;
+  quint64 m_zeroCount;
+  quint64 m_negTotal;
+
+  double m_min;
+  double m_max;
+
+  int m_posOffset;
+  int m_negOffset;
+  QVector<quint64> m_posBins;
+  QVector<quint64> m_negBins;
+};
@@ -0,0 +1,185 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <QtGlobal>
+
+#include "AlignedBuffer.h"
+
+/**
+ * @class RingBuffer
+ * @brief Fixed-capacity circular buffer used as backing storage for plots.
+ *
+ * The buffer is always "full": resizing allocates the requested capacity and
+ * every append overwrites the oldest element in place, so pushing a sample is
+ * an O(1) index update instead of an O(capacity) shift of the whole series.
+ * Elements are addressed in chronological order (index 0 is the oldest
+ * sample), and readers that want to avoid per-element index arithmetic can
+ * fetch the storage as two contiguous spans via firstSpan()/secondSpan().
+ *
+ * @note data() exposes the raw (non-rotated) storage and is only meant for
+ *       bulk initialization right after resize(), while the head is still at
+ *       position zero (e.g. with SIMD::fill or SIMD::fill_range).
+ *
+ * Storage lives in a 64-byte-aligned, pool-backed AlignedBuffer, so the SIMD
+ * kernels operate on cache-line-aligned data and reconfiguring the series
+ * capacity recycles blocks instead of reallocating every buffer.
+ */
+template<typename T>
+class RingBuffer
+{
+public:
+  RingBuffer()
+    : m_head(0)
+    , m_written(0)
+  {
+  }
+
+  /**
+   * @brief Clears the buffer and resets the write position.
+   */
+  void clear()
+  {
+    m_head = 0;
+    m_written = 0;
+    m_buffer.clear();
+  }
+
+  /**
+   * @brief Releases any memory not required to store the current capacity.
+   */
+  void squeeze() { m_buffer.squeeze(); }
+
+  /**
+   * @brief Re-allocates the buffer to the given capacity and resets the write
+   *        position, leaving the elements value-initialized.
+   */
+  void resize(const qsizetype capacity)
+  {
+    m_head = 0;
+    m_written = 0;
+    m_buffer.resize(capacity);
+  }
+
+  /**
+   * @brief Returns the capacity (and logical size) of the buffer.
+   */
+  [[nodiscard]] qsizetype count() const { return m_buffer.count(); }
+
+  /**
+   * @brief Returns the total number of samples ever appended to the buffer.
+   *
+   * The counter is monotonic until the buffer is cleared or resized, so
+   * readers can diff it against a previously observed value to learn how many
+   * samples arrived in between (and skip work entirely when none did).
+   */
+  [[nodiscard]] quint64 written() const { return m_written; }
+
+  /**
+   * @brief Provides raw access to the underlying (non-rotated) storage.
+   */
+  [[nodiscard]] T *data() { return m_buffer.data(); }
+
+  /**
+   * @brief Returns the element at the given chronological index, where index
+   *        zero corresponds to the oldest sample in the buffer.
+   */
+  [[nodiscard]] const T &at(const qsizetype index) const
+  {
+    qsizetype i = m_head + index;
+    if (i >= m_buffer.count())
+      i -= m_buffer.count();
+
+    return m_buffer[i];
+  }
+
+  /**
+   * @brief Overwrites the oldest element with the given value.
+   */
+  void append(const T &value)
+  {
+    if (m_buffer.isEmpty())
+      return;
+
+    m_buffer[m_head] = value;
+    if (++m_head >= m_buffer.count())
+      m_head = 0;
+
+    ++m_written;
+  }
+
+  /**
+   * @brief Appends a batch of samples, overwriting the oldest elements.
+   *
+   * Only the newest @a count samples that fit within the capacity are kept,
+   * and the copy is performed with at most two contiguous block writes.
+   */
+  void append(const T *samples, qsizetype count)
+  {
+    const qsizetype capacity = m_buffer.count();
+    if (capacity <= 0 || count <= 0)
+      return;
+
+    m_written += count;
+    if (count > capacity)
+    {
+      samples += count - capacity;
+      count = capacity;
+    }
+
+    const qsizetype first = std::min(count, capacity - m_head);
+    std::copy(samples, samples + first, m_buffer.data() + m_head);
+    if (count > first)
+      std::copy(samples + first, samples + count, m_buffer.data());
+
+    m_head += count;
+    if (m_head >= capacity)
+      m_head -= capacity;
+  }
+
+  /**
+   * @brief Returns the oldest contiguous span of samples.
+   * @param length Set to the number of elements in the span.
+   */
+  [[nodiscard]] const T *firstSpan(qsizetype &length) const
+  {
+    length = m_buffer.count() - m_head;
+    return m_buffer.constData() + m_head;
+  }
+
+  /**
+   * @brief Returns the newest contiguous span of samples.
+   * @param length Set to the number of elements in the span.
+   */
+  [[nodiscard]] const T *secondSpan(qsizetype &length) const
+  {
+    length = m_head;
+    return m_buffer.constData();
+  }
+
+private:
+  qsizetype m_head;
+  quint64 m_written;
+  AlignedBuffer<T> m_buffer;
+};
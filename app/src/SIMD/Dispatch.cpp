@@ -0,0 +1,209 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "SIMD/Dispatch.h"
+
+#include <algorithm>
+
+#include <x86/sse2.h>
+
+#if defined(_MSC_VER) \
+    && (defined(SIMD_HAS_AVX2_KERNELS) || defined(SIMD_HAS_AVX512_KERNELS))
+#  include <intrin.h>
+#  include <immintrin.h>
+#endif
+
+//------------------------------------------------------------------------------
+// Baseline 128-bit kernels (always available, simde emulates where needed)
+//------------------------------------------------------------------------------
+
+namespace SIMD::Dispatch::baseline
+{
+static void fill(double *data, size_t count, double value)
+{
+  size_t i = 0;
+  const auto fillValue = simde_mm_set1_pd(value);
+  for (; i + 2 <= count; i += 2)
+    simde_mm_storeu_pd(data + i, fillValue);
+
+  for (; i < count; ++i)
+    data[i] = value;
+}
+
+static void shift(double *data, size_t count, double newValue)
+{
+  size_t i = 0;
+  for (; i + 2 < count; i += 2)
+    simde_mm_storeu_pd(data + i, simde_mm_loadu_pd(data + i + 1));
+
+  for (; i < count - 1; ++i)
+    data[i] = data[i + 1];
+
+  data[count - 1] = newValue;
+}
+
+static double findMin(const double *data, size_t count)
+{
+  size_t i = 0;
+  auto minVec = simde_mm_set1_pd(data[0]);
+  for (; i + 2 <= count; i += 2)
+    minVec = simde_mm_min_pd(minVec, simde_mm_loadu_pd(data + i));
+
+  alignas(16) double buffer[2];
+  simde_mm_store_pd(buffer, minVec);
+  double minVal = std::min(buffer[0], buffer[1]);
+  for (; i < count; ++i)
+    minVal = std::min(minVal, data[i]);
+
+  return minVal;
+}
+
+static double findMax(const double *data, size_t count)
+{
+  size_t i = 0;
+  auto maxVec = simde_mm_set1_pd(data[0]);
+  for (; i + 2 <= count; i += 2)
+    maxVec = simde_mm_max_pd(maxVec, simde_mm_loadu_pd(data + i));
+
+  alignas(16) double buffer[2];
+  simde_mm_store_pd(buffer, maxVec);
+  double maxVal = std::max(buffer[0], buffer[1]);
+  for (; i < count; ++i)
+    maxVal = std::max(maxVal, data[i]);
+
+  return maxVal;
+}
+} // namespace SIMD::Dispatch::baseline
+
+//------------------------------------------------------------------------------
+// Widened kernels (defined in KernelsAVX2.cpp / KernelsAVX512.cpp, which are
+// compiled with the matching target flags only on x86-64 hosts)
+//------------------------------------------------------------------------------
+
+#ifdef SIMD_HAS_AVX2_KERNELS
+namespace SIMD::Dispatch::avx2
+{
+void fill(double *data, size_t count, double value);
+void shift(double *data, size_t count, double newValue);
+double findMin(const double *data, size_t count);
+double findMax(const double *data, size_t count);
+} // namespace SIMD::Dispatch::avx2
+#endif
+
+#ifdef SIMD_HAS_AVX512_KERNELS
+namespace SIMD::Dispatch::avx512
+{
+void fill(double *data, size_t count, double value);
+void shift(double *data, size_t count, double newValue);
+double findMin(const double *data, size_t count);
+double findMax(const double *data, size_t count);
+} // namespace SIMD::Dispatch::avx512
+#endif
+
+//------------------------------------------------------------------------------
+// Runtime CPU feature detection
+//------------------------------------------------------------------------------
+
+#if defined(SIMD_HAS_AVX2_KERNELS) || defined(SIMD_HAS_AVX512_KERNELS)
+/**
+ * @brief Returns true when the running CPU (and the OS) support AVX2.
+ */
+static bool cpuSupportsAvx2()
+{
+#  if defined(__GNUC__) || defined(__clang__)
+  return __builtin_cpu_supports("avx2");
+#  elif defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 1);
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  if (!osxsave)
+    return false;
+
+  __cpuidex(info, 7, 0);
+  const bool avx2 = (info[1] & (1 << 5)) != 0;
+
+  // Verify that the OS preserves the YMM state across context switches
+  const auto xcr0 = _xgetbv(0);
+  return avx2 && (xcr0 & 0x6) == 0x6;
+#  else
+  return false;
+#  endif
+}
+#endif
+
+#ifdef SIMD_HAS_AVX512_KERNELS
+/**
+ * @brief Returns true when the running CPU (and the OS) support AVX-512F.
+ */
+static bool cpuSupportsAvx512()
+{
+#  if defined(__GNUC__) || defined(__clang__)
+  return __builtin_cpu_supports("avx512f");
+#  elif defined(_MSC_VER)
+  if (!cpuSupportsAvx2())
+    return false;
+
+  int info[4];
+  __cpuidex(info, 7, 0);
+  const bool avx512f = (info[1] & (1 << 16)) != 0;
+
+  // Verify that the OS preserves the ZMM & mask register state
+  const auto xcr0 = _xgetbv(0);
+  return avx512f && (xcr0 & 0xE6) == 0xE6;
+#  else
+  return false;
+#  endif
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Kernel table resolution
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Resolves the kernel table to the widest supported variant.
+ *
+ * The table starts out pointing at the portable 128-bit kernels and is
+ * upgraded to the AVX2 and AVX-512 variants when both the build and the
+ * running CPU provide them. Resolution happens once, on first use, via
+ * thread-safe static initialization.
+ */
+const SIMD::Dispatch::DoubleKernels &SIMD::Dispatch::doubleKernels()
+{
+  static const DoubleKernels kernels = [] {
+    DoubleKernels table{baseline::fill, baseline::shift, baseline::findMin,
+                        baseline::findMax};
+
+#ifdef SIMD_HAS_AVX2_KERNELS
+    if (cpuSupportsAvx2())
+      table = {avx2::fill, avx2::shift, avx2::findMin, avx2::findMax};
+#endif
+
+#ifdef SIMD_HAS_AVX512_KERNELS
+    if (cpuSupportsAvx512())
+      table = {avx512::fill, avx512::shift, avx512::findMin, avx512::findMax};
+#endif
+
+    return table;
+  }();
+
+  return kernels;
+}
@@ -0,0 +1,58 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace SIMD
+{
+namespace Dispatch
+{
+/**
+ * @brief Function-pointer table for the double-array kernels.
+ *
+ * The portable kernels in SIMD.h are written against 128-bit registers and
+ * process two doubles per operation. On x86-64 hosts the build also compiles
+ * 256-bit (AVX2) and 512-bit (AVX-512) variants of the hottest kernels into
+ * separate translation units; this table is resolved once at startup to the
+ * widest variant the running CPU supports, so a single binary doubles or
+ * quadruples the per-frame plot math throughput on modern Xeons without
+ * recompiling per target.
+ */
+struct DoubleKernels
+{
+  void (*fill)(double *data, size_t count, double value);
+  void (*shift)(double *data, size_t count, double newValue);
+  double (*findMin)(const double *data, size_t count);
+  double (*findMax)(const double *data, size_t count);
+};
+
+/**
+ * @brief Returns the kernel table for the widest instruction set supported
+ *        by the running CPU.
+ *
+ * Resolved exactly once (thread-safe static initialization); every call
+ * after the first is a plain reference return.
+ */
+const DoubleKernels &doubleKernels();
+} // namespace Dispatch
+} // namespace SIMD
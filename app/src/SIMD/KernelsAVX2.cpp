@@ -0,0 +1,97 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstddef>
+#include <algorithm>
+
+#include <immintrin.h>
+
+/**
+ * 256-bit variants of the double-array kernels, four doubles per operation.
+ *
+ * This translation unit is compiled with AVX2 codegen enabled, so it must
+ * only be entered through the dispatch table in Dispatch.cpp after the
+ * runtime CPU check has passed; calling these on a pre-AVX2 machine raises
+ * an illegal-instruction fault.
+ */
+namespace SIMD::Dispatch::avx2
+{
+void fill(double *data, size_t count, double value)
+{
+  size_t i = 0;
+  const __m256d fillValue = _mm256_set1_pd(value);
+  for (; i + 4 <= count; i += 4)
+    _mm256_storeu_pd(data + i, fillValue);
+
+  for (; i < count; ++i)
+    data[i] = value;
+}
+
+void shift(double *data, size_t count, double newValue)
+{
+  size_t i = 0;
+  for (; i + 4 < count; i += 4)
+    _mm256_storeu_pd(data + i, _mm256_loadu_pd(data + i + 1));
+
+  for (; i < count - 1; ++i)
+    data[i] = data[i + 1];
+
+  data[count - 1] = newValue;
+}
+
+double findMin(const double *data, size_t count)
+{
+  size_t i = 0;
+  __m256d minVec = _mm256_set1_pd(data[0]);
+  for (; i + 4 <= count; i += 4)
+    minVec = _mm256_min_pd(minVec, _mm256_loadu_pd(data + i));
+
+  // Reduce the 256-bit register to a scalar
+  __m128d pair = _mm_min_pd(_mm256_castpd256_pd128(minVec),
+                            _mm256_extractf128_pd(minVec, 1));
+  pair = _mm_min_sd(pair, _mm_unpackhi_pd(pair, pair));
+  double minVal = _mm_cvtsd_f64(pair);
+
+  for (; i < count; ++i)
+    minVal = std::min(minVal, data[i]);
+
+  return minVal;
+}
+
+double findMax(const double *data, size_t count)
+{
+  size_t i = 0;
+  __m256d maxVec = _mm256_set1_pd(data[0]);
+  for (; i + 4 <= count; i += 4)
+    maxVec = _mm256_max_pd(maxVec, _mm256_loadu_pd(data + i));
+
+  // Reduce the 256-bit register to a scalar
+  __m128d pair = _mm_max_pd(_mm256_castpd256_pd128(maxVec),
+                            _mm256_extractf128_pd(maxVec, 1));
+  pair = _mm_max_sd(pair, _mm_unpackhi_pd(pair, pair));
+  double maxVal = _mm_cvtsd_f64(pair);
+
+  for (; i < count; ++i)
+    maxVal = std::max(maxVal, data[i]);
+
+  return maxVal;
+}
+} // namespace SIMD::Dispatch::avx2
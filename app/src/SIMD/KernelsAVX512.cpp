@@ -0,0 +1,87 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstddef>
+#include <algorithm>
+
+#include <immintrin.h>
+
+/**
+ * 512-bit variants of the double-array kernels, eight doubles per operation.
+ *
+ * This translation unit is compiled with AVX-512F codegen enabled, so it must
+ * only be entered through the dispatch table in Dispatch.cpp after the
+ * runtime CPU check has passed; calling these on an unsupported machine
+ * raises an illegal-instruction fault.
+ */
+namespace SIMD::Dispatch::avx512
+{
+void fill(double *data, size_t count, double value)
+{
+  size_t i = 0;
+  const __m512d fillValue = _mm512_set1_pd(value);
+  for (; i + 8 <= count; i += 8)
+    _mm512_storeu_pd(data + i, fillValue);
+
+  for (; i < count; ++i)
+    data[i] = value;
+}
+
+void shift(double *data, size_t count, double newValue)
+{
+  size_t i = 0;
+  for (; i + 8 < count; i += 8)
+    _mm512_storeu_pd(data + i, _mm512_loadu_pd(data + i + 1));
+
+  for (; i < count - 1; ++i)
+    data[i] = data[i + 1];
+
+  data[count - 1] = newValue;
+}
+
+double findMin(const double *data, size_t count)
+{
+  size_t i = 0;
+  __m512d minVec = _mm512_set1_pd(data[0]);
+  for (; i + 8 <= count; i += 8)
+    minVec = _mm512_min_pd(minVec, _mm512_loadu_pd(data + i));
+
+  double minVal = _mm512_reduce_min_pd(minVec);
+  for (; i < count; ++i)
+    minVal = std::min(minVal, data[i]);
+
+  return minVal;
+}
+
+double findMax(const double *data, size_t count)
+{
+  size_t i = 0;
+  __m512d maxVec = _mm512_set1_pd(data[0]);
+  for (; i + 8 <= count; i += 8)
+    maxVec = _mm512_max_pd(maxVec, _mm512_loadu_pd(data + i));
+
+  double maxVal = _mm512_reduce_max_pd(maxVec);
+  for (; i < count; ++i)
+    maxVal = std::max(maxVal, data[i]);
+
+  return maxVal;
+}
+} // namespace SIMD::Dispatch::avx512
@@ -21,20 +21,659 @@
 
 #pragma once
 
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstring>
+#include <limits>
+#include <utility>
 #include <algorithm>
+#include <type_traits>
 
 #include <QVector>
 #include <QPointF>
-
-#ifdef _WIN32
-#  include <cmath>
-#endif
+#include <QByteArray>
 
 #include <x86/sse2.h>
 
+#include "SIMD/Dispatch.h"
+
 namespace SIMD
 {
+/**
+ * @brief Finds the first occurrence of a byte pattern using SIMD comparisons.
+ *
+ * Implements a vectorized memmem-style search: the first byte of the needle
+ * is broadcast into a SIMD register and compared against 16-byte blocks of
+ * the haystack, and each candidate position is then verified with a scalar
+ * memcmp. This avoids walking the haystack byte-by-byte for the common case
+ * where the first delimiter byte is rare in the stream.
+ *
+ * Remaining bytes that do not fit in the SIMD width are processed using a
+ * scalar fallback loop.
+ *
+ * @param haystack Pointer to the data to search.
+ * @param haystackLen The number of bytes in the haystack.
+ * @param needle Pointer to the pattern to search for.
+ * @param needleLen The number of bytes in the pattern.
+ * @return The index of the first occurrence of the pattern, or -1 if the
+ *         pattern is not found.
+ */
+inline qsizetype findPattern(const char *haystack, size_t haystackLen,
+                             const char *needle, size_t needleLen)
+{
+  // Validate search pattern
+  if (needleLen == 0 || haystackLen < needleLen)
+    return -1;
+
+  // Broadcast the first needle byte & compute valid match start positions
+  const auto first = simde_mm_set1_epi8(needle[0]);
+  const size_t scanLen = haystackLen - needleLen + 1;
+
+  // SIMD comparisons over 16-byte blocks
+  size_t i = 0;
+  for (; i + 16 <= scanLen; i += 16)
+  {
+    auto block = simde_mm_loadu_si128(
+        reinterpret_cast<const simde__m128i *>(haystack + i));
+    auto eq = simde_mm_cmpeq_epi8(block, first);
+    auto mask = static_cast<quint32>(simde_mm_movemask_epi8(eq));
+
+    // Verify each candidate position with a scalar compare
+    while (mask)
+    {
+      const size_t pos = i + qCountTrailingZeroBits(mask);
+      if (std::memcmp(haystack + pos, needle, needleLen) == 0)
+        return static_cast<qsizetype>(pos);
+
+      mask &= mask - 1;
+    }
+  }
+
+  // Scalar fallback for remaining positions
+  for (; i < scanLen; ++i)
+  {
+    if (haystack[i] == needle[0]
+        && std::memcmp(haystack + i, needle, needleLen) == 0)
+      return static_cast<qsizetype>(i);
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Encodes bytes as lowercase hexadecimal ASCII pairs using SIMD.
+ *
+ * Processes 16 input bytes at a time: the high and low nibbles are isolated
+ * with shifts and masks, converted to ASCII with a compare/add sequence
+ * (0-9 -> '0'-'9', 10-15 -> 'a'-'f') and interleaved back into byte order
+ * with unpack operations, producing 32 output characters per iteration
+ * without any per-byte formatting calls.
+ *
+ * Remaining bytes that do not fit in the SIMD width are processed using a
+ * scalar fallback loop.
+ *
+ * @param src Pointer to the bytes to encode.
+ * @param len The number of bytes to encode.
+ * @param dst Destination buffer, must have room for 2 * len characters.
+ */
+inline void hexEncode(const char *src, size_t len, char *dst)
+{
+  // Constants for the nibble-to-ASCII conversion
+  const auto nine = simde_mm_set1_epi8(9);
+  const auto zero = simde_mm_set1_epi8('0');
+  const auto low4 = simde_mm_set1_epi8(0x0F);
+  const auto gap = simde_mm_set1_epi8('a' - '0' - 10);
+
+  // Convert a register of nibble values (0-15) into ASCII characters
+  const auto toAscii = [&](simde__m128i v) {
+    const auto alpha = simde_mm_cmpgt_epi8(v, nine);
+    return simde_mm_add_epi8(simde_mm_add_epi8(v, zero),
+                             simde_mm_and_si128(alpha, gap));
+  };
+
+  // Encode 16 input bytes into 32 output characters per iteration
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16)
+  {
+    auto block = simde_mm_loadu_si128(
+        reinterpret_cast<const simde__m128i *>(src + i));
+    auto hi = toAscii(
+        simde_mm_and_si128(simde_mm_srli_epi16(block, 4), low4));
+    auto lo = toAscii(simde_mm_and_si128(block, low4));
+
+    // Interleave high/low characters back into source byte order
+    simde_mm_storeu_si128(reinterpret_cast<simde__m128i *>(dst + 2 * i),
+                          simde_mm_unpacklo_epi8(hi, lo));
+    simde_mm_storeu_si128(reinterpret_cast<simde__m128i *>(dst + 2 * i + 16),
+                          simde_mm_unpackhi_epi8(hi, lo));
+  }
+
+  // Scalar fallback for the remaining bytes
+  static constexpr char digits[] = "0123456789abcdef";
+  for (; i < len; ++i)
+  {
+    const auto byte = static_cast<unsigned char>(src[i]);
+    dst[2 * i] = digits[byte >> 4];
+    dst[2 * i + 1] = digits[byte & 0x0F];
+  }
+}
+
+/**
+ * @brief Decodes hexadecimal ASCII pairs back into bytes using SIMD.
+ *
+ * Processes 16 input characters (8 output bytes) at a time: digits and
+ * letters are classified with ranged compares, converted to nibble values
+ * with masked subtractions (case-insensitively for 'a'-'f'/'A'-'F') and the
+ * high/low nibbles of each pair are merged with 16-bit shifts and packed
+ * back into bytes. Validation rides on the same compares, so malformed
+ * input is rejected without a second pass.
+ *
+ * Remaining characters that do not fit in the SIMD width are processed
+ * using a scalar fallback loop.
+ *
+ * @param src Pointer to the hexadecimal characters to decode.
+ * @param len The number of characters to decode, must be even.
+ * @param dst Destination buffer, must have room for len / 2 bytes.
+ * @return The number of bytes written, or -1 when the input length is odd
+ *         or a non-hexadecimal character is found.
+ */
+inline qsizetype hexDecode(const char *src, size_t len, char *dst)
+{
+  // Hex pairs are two characters per byte, reject odd-length input
+  if (len % 2 != 0)
+    return -1;
+
+  // Constants for classification & nibble conversion
+  const auto case20 = simde_mm_set1_epi8(0x20);
+  const auto zeroLo = simde_mm_set1_epi8('0' - 1);
+  const auto nineHi = simde_mm_set1_epi8('9' + 1);
+  const auto aLo = simde_mm_set1_epi8('a' - 1);
+  const auto fHi = simde_mm_set1_epi8('f' + 1);
+  const auto zeroChar = simde_mm_set1_epi8('0');
+  const auto alphaOff = simde_mm_set1_epi8('a' - 10);
+  const auto loByte = simde_mm_set1_epi16(0x00FF);
+
+  // Decode 16 input characters into 8 output bytes per iteration
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16)
+  {
+    auto block = simde_mm_loadu_si128(
+        reinterpret_cast<const simde__m128i *>(src + i));
+
+    // Classify each character as decimal digit or hex letter (any case)
+    const auto lower = simde_mm_or_si128(block, case20);
+    const auto digit = simde_mm_and_si128(simde_mm_cmpgt_epi8(block, zeroLo),
+                                          simde_mm_cmpgt_epi8(nineHi, block));
+    const auto alpha = simde_mm_and_si128(simde_mm_cmpgt_epi8(lower, aLo),
+                                          simde_mm_cmpgt_epi8(fHi, lower));
+
+    // Bail out on the first block with a non-hexadecimal character
+    const auto valid = simde_mm_or_si128(digit, alpha);
+    if (static_cast<quint32>(simde_mm_movemask_epi8(valid)) != 0xFFFF)
+      return -1;
+
+    // Convert characters into nibble values (0-15)
+    const auto nibbles = simde_mm_or_si128(
+        simde_mm_and_si128(digit, simde_mm_sub_epi8(block, zeroChar)),
+        simde_mm_and_si128(alpha, simde_mm_sub_epi8(lower, alphaOff)));
+
+    // Merge nibble pairs into bytes & pack down to the low 8 lanes
+    const auto hi = simde_mm_slli_epi16(simde_mm_and_si128(nibbles, loByte), 4);
+    const auto lo = simde_mm_srli_epi16(nibbles, 8);
+    const auto bytes = simde_mm_packus_epi16(
+        simde_mm_and_si128(simde_mm_or_si128(hi, lo), loByte),
+        simde_mm_setzero_si128());
+    simde_mm_storel_epi64(reinterpret_cast<simde__m128i *>(dst + i / 2),
+                          bytes);
+  }
+
+  // Scalar fallback for the remaining characters
+  const auto nibble = [](char c) -> int {
+    if (c >= '0' && c <= '9')
+      return c - '0';
+
+    const char l = c | 0x20;
+    if (l >= 'a' && l <= 'f')
+      return l - 'a' + 10;
+
+    return -1;
+  };
+  for (; i < len; i += 2)
+  {
+    const int hi = nibble(src[i]);
+    const int lo = nibble(src[i + 1]);
+    if (hi < 0 || lo < 0)
+      return -1;
+
+    dst[i / 2] = static_cast<char>((hi << 4) | lo);
+  }
+
+  return static_cast<qsizetype>(len / 2);
+}
+
+/**
+ * @brief Decodes base64-encoded ASCII back into bytes.
+ *
+ * Table-driven decoder that folds four input characters into three output
+ * bytes through a single 32-bit accumulator, with one load-and-or per
+ * character and no per-quad branching. A wide lookup-table shuffle variant
+ * would need SSSE3-class instructions, which the portable kernel baseline
+ * does not assume; the scalar quad loop is memory-bound on typical frame
+ * payloads and already removes the interpreter overhead this helper is
+ * meant to avoid.
+ *
+ * Standard '=' padding is accepted on the final quad only, and any
+ * character outside the base64 alphabet rejects the input.
+ *
+ * @param src Pointer to the base64 characters to decode.
+ * @param len The number of characters to decode, must be a multiple of 4.
+ * @param dst Destination buffer, must have room for (len / 4) * 3 bytes.
+ * @return The number of bytes written, or -1 when the input is malformed.
+ */
+inline qsizetype base64Decode(const char *src, size_t len, char *dst)
+{
+  // Base64 quads are four characters per three bytes
+  if (len % 4 != 0)
+    return -1;
+  if (len == 0)
+    return 0;
+
+  // Build the character-to-sextet table once (0xFF marks invalid input)
+  static const auto table = [] {
+    std::array<quint8, 256> t{};
+    t.fill(0xFF);
+    static constexpr char alphabet[]
+        = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (int i = 0; i < 64; ++i)
+      t[static_cast<quint8>(alphabet[i])] = static_cast<quint8>(i);
+    return t;
+  }();
+
+  // Measure the '=' padding on the final quad
+  size_t padding = 0;
+  while (padding < 2 && src[len - 1 - padding] == '=')
+    ++padding;
+
+  // Decode full quads, accumulating validity instead of branching per quad
+  char *out = dst;
+  quint8 invalid = 0;
+  const size_t fullQuads = (len - (padding > 0 ? 4 : 0)) / 4;
+  for (size_t q = 0; q < fullQuads; ++q)
+  {
+    const auto *p = reinterpret_cast<const quint8 *>(src + q * 4);
+    const quint8 a = table[p[0]];
+    const quint8 b = table[p[1]];
+    const quint8 c = table[p[2]];
+    const quint8 d = table[p[3]];
+    invalid |= a | b | c | d;
+
+    const quint32 bits = (static_cast<quint32>(a) << 18)
+                         | (static_cast<quint32>(b) << 12)
+                         | (static_cast<quint32>(c) << 6) | d;
+    *out++ = static_cast<char>(bits >> 16);
+    *out++ = static_cast<char>(bits >> 8);
+    *out++ = static_cast<char>(bits);
+  }
+
+  // Any table lookup that produced 0xFF poisons the accumulated mask
+  if ((invalid & 0x80) != 0)
+    return -1;
+
+  // Decode the final padded quad (two or one output bytes)
+  if (padding > 0)
+  {
+    const auto *p = reinterpret_cast<const quint8 *>(src + len - 4);
+    const quint8 a = table[p[0]];
+    const quint8 b = table[p[1]];
+    const quint8 c = padding == 1 ? table[p[2]] : 0;
+    if (((a | b | c) & 0x80) != 0)
+      return -1;
+
+    const quint32 bits = (static_cast<quint32>(a) << 18)
+                         | (static_cast<quint32>(b) << 12)
+                         | (static_cast<quint32>(c) << 6);
+    *out++ = static_cast<char>(bits >> 16);
+    if (padding == 1)
+      *out++ = static_cast<char>(bits >> 8);
+  }
+
+  return static_cast<qsizetype>(out - dst);
+}
+
+/**
+ * @brief Counts the occurrences of a byte using SIMD comparisons.
+ *
+ * The byte is broadcast into a SIMD register and compared against 16-byte
+ * blocks of the input, accumulating the population count of each comparison
+ * mask. Remaining bytes that do not fit in the SIMD width are processed using
+ * a scalar fallback loop.
+ *
+ * @param data Pointer to the data to scan.
+ * @param len The number of bytes to scan.
+ * @param byte The byte value to count.
+ * @return The number of occurrences of the byte.
+ */
+inline qsizetype countByte(const char *data, size_t len, char byte)
+{
+  const auto needle = simde_mm_set1_epi8(byte);
+
+  // SIMD comparisons over 16-byte blocks
+  size_t i = 0;
+  qsizetype count = 0;
+  for (; i + 16 <= len; i += 16)
+  {
+    auto block = simde_mm_loadu_si128(
+        reinterpret_cast<const simde__m128i *>(data + i));
+    auto eq = simde_mm_cmpeq_epi8(block, needle);
+    count += qPopulationCount(
+        static_cast<quint32>(simde_mm_movemask_epi8(eq)));
+  }
+
+  // Scalar fallback for remaining bytes
+  for (; i < len; ++i)
+    count += (data[i] == byte) ? 1 : 0;
+
+  return count;
+}
+
+/**
+ * @brief Splits data on a delimiter byte using SIMD comparisons.
+ *
+ * The delimiter is broadcast into a SIMD register and compared against
+ * 16-byte blocks of the input; each set bit in the comparison mask marks the
+ * end of a token. The callback is invoked once per token with a pointer into
+ * the original data and the token length, so no sub-arrays are allocated.
+ *
+ * Matching the semantics of QByteArray::split(), a trailing delimiter
+ * produces a final empty token and empty input produces one empty token.
+ *
+ * @param data Pointer to the data to split.
+ * @param len The number of bytes to split.
+ * @param delimiter The byte that separates tokens.
+ * @param callback Callable invoked as callback(const char *token, size_t n).
+ */
+template<typename Callback>
+inline void tokenize(const char *data, size_t len, char delimiter,
+                     Callback &&callback)
+{
+  const auto needle = simde_mm_set1_epi8(delimiter);
+
+  // SIMD comparisons over 16-byte blocks
+  size_t i = 0;
+  size_t start = 0;
+  for (; i + 16 <= len; i += 16)
+  {
+    auto block = simde_mm_loadu_si128(
+        reinterpret_cast<const simde__m128i *>(data + i));
+    auto eq = simde_mm_cmpeq_epi8(block, needle);
+    auto mask = static_cast<quint32>(simde_mm_movemask_epi8(eq));
+
+    // Report one token per delimiter found in the block
+    while (mask)
+    {
+      const size_t pos = i + qCountTrailingZeroBits(mask);
+      callback(data + start, pos - start);
+      start = pos + 1;
+      mask &= mask - 1;
+    }
+  }
+
+  // Scalar fallback for remaining bytes
+  for (; i < len; ++i)
+  {
+    if (data[i] == delimiter)
+    {
+      callback(data + start, i - start);
+      start = i + 1;
+    }
+  }
+
+  // Report the final token (empty when the data ends with a delimiter)
+  callback(data + start, len - start);
+}
+
+/**
+ * @brief Measures the leading run of printable ASCII UTF-16 code units.
+ *
+ * Compares 8 code units at a time against the printable ASCII range
+ * [0x20, 0x7E]; the first unit outside that range (control characters such
+ * as ESC, CR/LF and backspace, DEL, or anything non-ASCII) terminates the
+ * run. This lets text consumers copy whole spans of plain characters in one
+ * operation and only drop into per-character processing at the boundaries.
+ *
+ * Remaining units that do not fit in the SIMD width are processed using a
+ * scalar fallback loop.
+ *
+ * @param data Pointer to the UTF-16 code units to scan.
+ * @param len The number of code units to scan.
+ * @return The number of leading units inside the printable ASCII range.
+ */
+inline qsizetype printableAsciiPrefix(const char16_t *data, size_t len)
+{
+  const auto lower = simde_mm_set1_epi16(0x20);
+  const auto upper = simde_mm_set1_epi16(0x7E);
+
+  // SIMD comparisons over blocks of 8 code units
+  size_t i = 0;
+  for (; i + 8 <= len; i += 8)
+  {
+    auto block = simde_mm_loadu_si128(
+        reinterpret_cast<const simde__m128i *>(data + i));
+
+    // Code units >= 0x8000 are negative in signed lanes, so the lower-bound
+    // compare also catches them, which is correct: they are non-ASCII and
+    // must end the run either way
+    auto below = simde_mm_cmplt_epi16(block, lower);
+    auto above = simde_mm_cmpgt_epi16(block, upper);
+    auto mask = static_cast<quint32>(
+        simde_mm_movemask_epi8(simde_mm_or_si128(below, above)));
+    if (mask)
+      return static_cast<qsizetype>(i + qCountTrailingZeroBits(mask) / 2);
+  }
+
+  // Scalar fallback for remaining code units
+  for (; i < len; ++i)
+  {
+    if (data[i] < 0x20 || data[i] > 0x7E)
+      return static_cast<qsizetype>(i);
+  }
+
+  return static_cast<qsizetype>(len);
+}
+
+/**
+ * @brief Measures the leading run of printable ASCII bytes.
+ *
+ * Byte-domain counterpart of printableAsciiPrefix(): compares 16 bytes at a
+ * time against the printable ASCII range [0x20, 0x7E]. Bytes outside that
+ * range — control characters, DEL, and UTF-8 lead or continuation bytes
+ * (which are negative in signed lanes and therefore caught by the lower-bound
+ * compare) — terminate the run. This lets byte-stream consumers bulk-copy
+ * whole spans of plain text and only drop into per-byte processing at line
+ * endings, escape sequences and multi-byte characters.
+ *
+ * Remaining bytes that do not fit in the SIMD width are processed using a
+ * scalar fallback loop.
+ *
+ * @param data Pointer to the bytes to scan.
+ * @param len The number of bytes to scan.
+ * @return The number of leading bytes inside the printable ASCII range.
+ */
+inline qsizetype printableAsciiRun(const char *data, size_t len)
+{
+  const auto lower = simde_mm_set1_epi8(0x20);
+  const auto upper = simde_mm_set1_epi8(0x7E);
+
+  // SIMD comparisons over 16-byte blocks
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16)
+  {
+    auto block = simde_mm_loadu_si128(
+        reinterpret_cast<const simde__m128i *>(data + i));
+    auto below = simde_mm_cmplt_epi8(block, lower);
+    auto above = simde_mm_cmpgt_epi8(block, upper);
+    auto mask = static_cast<quint32>(
+        simde_mm_movemask_epi8(simde_mm_or_si128(below, above)));
+    if (mask)
+      return static_cast<qsizetype>(i + qCountTrailingZeroBits(mask));
+  }
+
+  // Scalar fallback for remaining bytes
+  for (; i < len; ++i)
+  {
+    const auto byte = static_cast<unsigned char>(data[i]);
+    if (byte < 0x20 || byte > 0x7E)
+      return static_cast<qsizetype>(i);
+  }
+
+  return static_cast<qsizetype>(len);
+}
+
+/**
+ * @brief Parses a decimal number from an in-place character span.
+ *
+ * Fast path for the plain sign/integer/fraction layout produced by most
+ * telemetry firmware, consuming the digits in a single scan without creating
+ * an intermediate string. Inputs that use scientific notation or contain
+ * unexpected characters fall back to QByteArray::toDouble(), which also
+ * preserves its convention of returning 0 for non-numeric data.
+ *
+ * @param str Pointer to the characters to parse (no terminator required).
+ * @param len The number of characters to parse.
+ * @return The parsed value, or 0 when the input is not a number.
+ */
+inline double parseDouble(const char *str, size_t len)
+{
+  // Skip leading whitespace
+  size_t i = 0;
+  while (i < len && (str[i] == ' ' || str[i] == '\t' || str[i] == '\r'
+                     || str[i] == '\n'))
+    ++i;
+
+  // Consume the optional sign
+  bool negative = false;
+  if (i < len && (str[i] == '+' || str[i] == '-'))
+    negative = (str[i++] == '-');
+
+  // Consume the integer part
+  bool any = false;
+  double value = 0;
+  while (i < len && str[i] >= '0' && str[i] <= '9')
+  {
+    value = value * 10 + (str[i] - '0');
+    any = true;
+    ++i;
+  }
+
+  // Consume the fractional part
+  if (i < len && str[i] == '.')
+  {
+    ++i;
+    double scale = 0.1;
+    while (i < len && str[i] >= '0' && str[i] <= '9')
+    {
+      value += (str[i] - '0') * scale;
+      scale *= 0.1;
+      any = true;
+      ++i;
+    }
+  }
+
+  // Skip trailing whitespace
+  while (i < len && (str[i] == ' ' || str[i] == '\t' || str[i] == '\r'
+                     || str[i] == '\n'))
+    ++i;
+
+  // Exponents & unexpected characters use the slow path
+  if (i < len || !any)
+    return QByteArray(str, static_cast<qsizetype>(len)).toDouble();
+
+  return negative ? -value : value;
+}
+
+/**
+ * @brief Converts double samples to floats and applies a window function in a
+ *        single SIMD pass.
+ *
+ * Fuses the double-to-float conversion of the sample buffer with the
+ * element-wise multiplication by a precomputed window table, processing four
+ * output floats per iteration. This replaces the two scalar passes (convert,
+ * then window) that FFT widgets would otherwise perform on every update.
+ *
+ * Remaining elements that do not fit in the SIMD width are processed using a
+ * scalar fallback loop.
+ *
+ * @param samples Pointer to the input samples (doubles).
+ * @param window Pointer to the precomputed window coefficients (floats).
+ * @param dst Pointer to the output buffer (floats).
+ * @param count The total number of samples to process.
+ */
+inline void applyWindow(const qreal *samples, const float *window, float *dst,
+                        size_t count)
+{
+  // Convert two pairs of doubles per iteration and multiply by the window
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    auto lo = simde_mm_cvtpd_ps(simde_mm_loadu_pd(samples + i));
+    auto hi = simde_mm_cvtpd_ps(simde_mm_loadu_pd(samples + i + 2));
+    auto values = simde_mm_movelh_ps(lo, hi);
+    auto coeffs = simde_mm_loadu_ps(window + i);
+    simde_mm_storeu_ps(dst + i, simde_mm_mul_ps(values, coeffs));
+  }
+
+  // Scalar fallback for remaining elements
+  for (; i < count; ++i)
+    dst[i] = static_cast<float>(samples[i]) * window[i];
+}
+
+/**
+ * @brief Projects a batch of 3D points to 2D screen space in one pass.
+ *
+ * Performs the matrix-vector product, perspective divide and viewport
+ * mapping for every point of a capture with the four matrix columns held in
+ * SIMD registers, so each point costs four fused column multiplies instead
+ * of the sixteen scalar multiply-adds of QMatrix4x4::operator*. 3D plot
+ * widgets re-project their whole capture whenever the camera moves, which
+ * makes this the hot loop of orbit interaction on dense clouds.
+ *
+ * @param matrix Column-major 4x4 transform (e.g. QMatrix4x4::constData()).
+ * @param points Pointer to tightly packed xyz float triplets.
+ * @param count The number of points to project.
+ * @param halfWidth Half of the viewport width, in logical pixels.
+ * @param halfHeight Half of the viewport height, in logical pixels.
+ * @param dst Pointer to the output buffer (one QPointF per input point).
+ */
+inline void projectPoints3D(const float *matrix, const float *points,
+                            size_t count, float halfWidth, float halfHeight,
+                            QPointF *dst)
+{
+  // Keep the matrix columns resident in registers across the batch
+  const auto c0 = simde_mm_loadu_ps(matrix + 0);
+  const auto c1 = simde_mm_loadu_ps(matrix + 4);
+  const auto c2 = simde_mm_loadu_ps(matrix + 8);
+  const auto c3 = simde_mm_loadu_ps(matrix + 12);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    // Transformed vector = c0*x + c1*y + c2*z + c3
+    const auto x = simde_mm_set1_ps(points[i * 3 + 0]);
+    const auto y = simde_mm_set1_ps(points[i * 3 + 1]);
+    const auto z = simde_mm_set1_ps(points[i * 3 + 2]);
+    const auto t = simde_mm_add_ps(
+        simde_mm_add_ps(simde_mm_mul_ps(c0, x), simde_mm_mul_ps(c1, y)),
+        simde_mm_add_ps(simde_mm_mul_ps(c2, z), c3));
+
+    // Perspective divide & viewport mapping
+    float v[4];
+    simde_mm_storeu_ps(v, t);
+    const float invW = 1.0f / v[3];
+    dst[i] = QPointF(halfWidth + v[0] * invW * halfWidth,
+                     halfHeight - v[1] * invW * halfHeight);
+  }
+}
+
 /**
  * @brief Initializes an array with a specific value using SIMD for bulk
  *        operations.
@@ -54,6 +693,14 @@ namespace SIMD
 template<typename T>
 inline void fill(T *data, size_t count, T value)
 {
+  // Double arrays go through the runtime-dispatched kernel table, which
+  // resolves to the widest instruction set the CPU supports
+  if constexpr (std::is_same_v<T, double>)
+  {
+    Dispatch::doubleKernels().fill(data, count, value);
+    return;
+  }
+
   // Obtain register width for SIMD operations
   constexpr auto simdWidth = sizeof(simde__m128d) / sizeof(T);
 
@@ -123,6 +770,13 @@ inline void fill_range(T *data, size_t count, T begin)
 template<typename T>
 inline void shift(T *data, size_t count, T newValue)
 {
+  // Double arrays go through the runtime-dispatched kernel table
+  if constexpr (std::is_same_v<T, double>)
+  {
+    Dispatch::doubleKernels().shift(data, count, newValue);
+    return;
+  }
+
   // Obtain register width for SIMD operations
   constexpr auto simdWidth = sizeof(simde__m128d) / sizeof(T);
 
@@ -158,6 +812,10 @@ inline void shift(T *data, size_t count, T newValue)
 template<typename T>
 inline T findMin(const T *data, size_t count)
 {
+  // Double arrays go through the runtime-dispatched kernel table
+  if constexpr (std::is_same_v<T, double>)
+    return Dispatch::doubleKernels().findMin(data, count);
+
   // Obtain register width for SIMD operations
   constexpr auto simdWidth = sizeof(simde__m128d) / sizeof(T);
 
@@ -199,6 +857,10 @@ inline T findMin(const T *data, size_t count)
 template<typename T>
 inline T findMax(const T *data, size_t count)
 {
+  // Double arrays go through the runtime-dispatched kernel table
+  if constexpr (std::is_same_v<T, double>)
+    return Dispatch::doubleKernels().findMax(data, count);
+
   // Obtain register width for SIMD operations
   constexpr auto simdWidth = sizeof(simde__m128d) / sizeof(T);
 
@@ -225,6 +887,142 @@ inline T findMax(const T *data, size_t count)
   return maxVal;
 }
 
+/**
+ * @brief Single-pass statistics over an array of doubles.
+ *
+ * Carries everything the auto-ranging widgets need from one scan of the
+ * series: extrema for axis limits, the mean for trend displays and the RMS
+ * for magnitude-style readouts (vibration, AC signals).
+ */
+struct Stats
+{
+  double min;
+  double max;
+  double mean;
+  double rms;
+};
+
+/**
+ * @brief Computes min, max, mean and RMS of an array in a single SIMD pass.
+ *
+ * Fuses the four reductions into one scan of the buffer: each 128-bit block
+ * is loaded once and feeds the min/max comparisons, the sum and the sum of
+ * squares simultaneously. Compared to calling findMin() and findMax() (two
+ * full passes) plus scalar mean/RMS loops, this halves or quarters the
+ * memory traffic of the hottest per-frame reduction.
+ *
+ * Remaining elements that do not fit in the SIMD width are processed using a
+ * scalar fallback loop.
+ *
+ * @param data Pointer to the array of values.
+ * @param count The total number of elements in the array.
+ * @return The statistics of the array, all zeros when @a count is 0.
+ */
+inline Stats computeStats(const double *data, size_t count)
+{
+  Stats stats{0, 0, 0, 0};
+  if (count == 0)
+    return stats;
+
+  // Accumulate extrema, sum & sum of squares in one pass
+  size_t i = 0;
+  auto minVec = simde_mm_set1_pd(data[0]);
+  auto maxVec = minVec;
+  auto sumVec = simde_mm_setzero_pd();
+  auto sqVec = simde_mm_setzero_pd();
+  for (; i + 2 <= count; i += 2)
+  {
+    auto values = simde_mm_loadu_pd(data + i);
+    minVec = simde_mm_min_pd(minVec, values);
+    maxVec = simde_mm_max_pd(maxVec, values);
+    sumVec = simde_mm_add_pd(sumVec, values);
+    sqVec = simde_mm_add_pd(sqVec, simde_mm_mul_pd(values, values));
+  }
+
+  // Reduce SIMD registers to scalars
+  alignas(16) double buffer[2];
+  simde_mm_store_pd(buffer, minVec);
+  stats.min = std::min(buffer[0], buffer[1]);
+  simde_mm_store_pd(buffer, maxVec);
+  stats.max = std::max(buffer[0], buffer[1]);
+  simde_mm_store_pd(buffer, sumVec);
+  double sum = buffer[0] + buffer[1];
+  simde_mm_store_pd(buffer, sqVec);
+  double sumSq = buffer[0] + buffer[1];
+
+  // Scalar fallback for remaining elements
+  for (; i < count; ++i)
+  {
+    stats.min = std::min(stats.min, data[i]);
+    stats.max = std::max(stats.max, data[i]);
+    sum += data[i];
+    sumSq += data[i] * data[i];
+  }
+
+  stats.mean = sum / static_cast<double>(count);
+  stats.rms = std::sqrt(sumSq / static_cast<double>(count));
+  return stats;
+}
+
+/**
+ * @brief Finds the minimum & maximum in a QVector<QPointF> in a single pass.
+ *
+ * Fuses the two reductions that findMin() and findMax() would perform
+ * separately: each point is extracted once and feeds both comparisons, so
+ * the series is walked once per frame instead of twice. The value to compare
+ * is determined by the provided extractor function, exactly as in the
+ * single-reduction overloads.
+ *
+ * @tparam Extractor A callable object (e.g., lambda, function pointer) that
+ *                   extracts the value to compare from a QPointF.
+ *
+ * @param data The QVector<QPointF> containing the points to search.
+ * @param extractor A callable that extracts the desired value from a QPointF
+ *                  (e.g., `[](const QPointF& p) { return p.y(); }`).
+ *
+ * @return A pair holding the minimum and maximum extracted values.
+ */
+template<typename Extractor>
+inline std::pair<qreal, qreal> findMinMax(const QVector<QPointF> &data,
+                                          Extractor extractor)
+{
+  // Do nothing if there is no data to compare
+  size_t i = 0;
+  size_t count = data.size();
+  if (count == 0)
+    return std::make_pair(0, 0);
+
+  // Obtain register width for SIMD operations
+  constexpr auto simdWith = sizeof(simde__m128d) / sizeof(qreal);
+  auto minVec = simde_mm_set1_pd(extractor(data[0]));
+  auto maxVec = minVec;
+
+  // SIMD comparisons, each extracted pair feeds both reductions
+  for (; i + simdWith <= count; i += simdWith)
+  {
+    auto values = simde_mm_set_pd(extractor(data[i + 1]), extractor(data[i]));
+    minVec = simde_mm_min_pd(minVec, values);
+    maxVec = simde_mm_max_pd(maxVec, values);
+  }
+
+  // Reduce SIMD registers to scalars
+  alignas(16) qreal buffer[simdWith];
+  simde_mm_storeu_pd(buffer, minVec);
+  qreal minVal = std::min(buffer[0], buffer[1]);
+  simde_mm_storeu_pd(buffer, maxVec);
+  qreal maxVal = std::max(buffer[0], buffer[1]);
+
+  // Scalar fallback for remaining elements
+  for (; i < count; ++i)
+  {
+    const qreal value = extractor(data[i]);
+    minVal = std::min<qreal>(minVal, value);
+    maxVal = std::max<qreal>(maxVal, value);
+  }
+
+  return std::make_pair(minVal, maxVal);
+}
+
 /**
  * @brief Finds the minimum value in a QVector<QPointF> using SIMD operations.
  *
@@ -328,4 +1126,217 @@ inline qreal findMax(const QVector<QPointF> &data, Extractor extractor)
 
   return maxVal;
 }
+
+/**
+ * @brief Downsamples a series of points using Largest-Triangle-Three-Buckets.
+ *
+ * Implements the LTTB decimation algorithm: the series is split into
+ * @a threshold buckets and each bucket contributes the point that forms the
+ * largest triangle with the previously selected point and the average of the
+ * next bucket. This preserves the visual shape of the curve (peaks, edges and
+ * trends) far better than naive striding while reducing the number of points
+ * handed to the renderer by one or two orders of magnitude.
+ *
+ * Bucket averages are accumulated with SIMD pair additions, exploiting the
+ * fact that QPointF stores its x/y coordinates as two contiguous doubles that
+ * map directly onto a 128-bit register.
+ *
+ * The first and last points of the input are always preserved. When the input
+ * already fits within the requested threshold the output is a shallow
+ * (copy-on-write) copy of the input and no work is performed.
+ *
+ * @param source The full-resolution series of points.
+ * @param dest The vector that receives the decimated series.
+ * @param threshold The maximum number of points to keep (must be >= 3 for
+ *                  decimation to take place).
+ */
+inline void lttbDecimate(const QVector<QPointF> &source, QVector<QPointF> &dest,
+                         qsizetype threshold)
+{
+  // Input already fits, return a shallow copy of the source data
+  const qsizetype count = source.count();
+  if (threshold <= 2 || count <= threshold)
+  {
+    dest = source;
+    return;
+  }
+
+  // Obtain direct pointers to the point data
+  dest.resize(threshold);
+  QPointF *dst = dest.data();
+  const QPointF *src = source.constData();
+
+  // Always keep the first point of the series
+  dst[0] = src[0];
+
+  // Split the interior points into evenly sized buckets
+  const double bucketSize
+      = static_cast<double>(count - 2) / static_cast<double>(threshold - 2);
+
+  // Select one representative point per bucket
+  qsizetype a = 0;
+  for (qsizetype i = 0; i < threshold - 2; ++i)
+  {
+    // Compute the range of the current bucket
+    const qsizetype start = static_cast<qsizetype>(i * bucketSize) + 1;
+    qsizetype end = static_cast<qsizetype>((i + 1) * bucketSize) + 1;
+    end = std::min(end, count - 1);
+
+    // Compute the range of the next bucket
+    const qsizetype nextStart = end;
+    qsizetype nextEnd = static_cast<qsizetype>((i + 2) * bucketSize) + 1;
+    nextEnd = std::min(nextEnd, count);
+
+    // Average the next bucket with SIMD pair additions (x lane 0, y lane 1)
+    auto sum = simde_mm_setzero_pd();
+    for (qsizetype j = nextStart; j < nextEnd; ++j)
+    {
+      auto point = simde_mm_loadu_pd(reinterpret_cast<const double *>(src + j));
+      sum = simde_mm_add_pd(sum, point);
+    }
+
+    // Reduce SIMD register to the bucket average
+    alignas(16) double buffer[2];
+    simde_mm_store_pd(buffer, sum);
+    const auto n = static_cast<double>(std::max<qsizetype>(nextEnd - nextStart, 1));
+    const double avgX = buffer[0] / n;
+    const double avgY = buffer[1] / n;
+
+    // Keep the point that forms the largest triangle with the anchor point
+    double maxArea = -1.0;
+    qsizetype maxIndex = start;
+    const double ax = src[a].x();
+    const double ay = src[a].y();
+    for (qsizetype j = start; j < end; ++j)
+    {
+      const double area = qAbs((ax - avgX) * (src[j].y() - ay)
+                               - (ax - src[j].x()) * (avgY - ay));
+      if (area > maxArea)
+      {
+        maxArea = area;
+        maxIndex = j;
+      }
+    }
+
+    // Store the selected point and use it as the next anchor
+    dst[i + 1] = src[maxIndex];
+    a = maxIndex;
+  }
+
+  // Always keep the last point of the series
+  dst[threshold - 1] = src[count - 1];
+}
+
+/**
+ * @brief Downsamples a series of points into a min/max-preserving envelope.
+ *
+ * The series is split into evenly sized buckets and each bucket contributes
+ * its minimum and maximum sample (at their original x positions, in order of
+ * occurrence), so the rendered polyline sweeps the full vertical extent of
+ * every bucket. Unlike LTTB - which keeps the point that best preserves the
+ * overall curve shape - this guarantees that no single-sample spike is ever
+ * dropped, regardless of how many samples a bucket covers.
+ *
+ * Bucket extremes are computed with SIMD pair comparisons, processing the y
+ * lanes of two consecutive points per iteration; a short scalar scan then
+ * recovers the position of each extreme within the bucket.
+ *
+ * When the input already fits within the requested threshold the output is a
+ * shallow (copy-on-write) copy of the input and no work is performed.
+ *
+ * @param source The full-resolution series of points.
+ * @param dest The vector that receives the envelope series.
+ * @param threshold The maximum number of points to keep (two per bucket).
+ */
+inline void minMaxDecimate(const QVector<QPointF> &source,
+                           QVector<QPointF> &dest, qsizetype threshold)
+{
+  // Input already fits, return a shallow copy of the source data
+  const qsizetype count = source.count();
+  if (threshold <= 2 || count <= threshold)
+  {
+    dest = source;
+    return;
+  }
+
+  // Two output points per bucket
+  const qsizetype buckets = std::max<qsizetype>(threshold / 2, 1);
+  const double bucketSize
+      = static_cast<double>(count) / static_cast<double>(buckets);
+
+  // Obtain direct pointers to the point data
+  dest.resize(buckets * 2);
+  QPointF *dst = dest.data();
+  const QPointF *src = source.constData();
+
+  // Emit the extremes of every bucket
+  for (qsizetype b = 0; b < buckets; ++b)
+  {
+    // Compute the range of the current bucket
+    const qsizetype start = static_cast<qsizetype>(b * bucketSize);
+    qsizetype end = static_cast<qsizetype>((b + 1) * bucketSize);
+    end = std::max(std::min(end, count), start + 1);
+
+    // Vector min/max over the y lanes of two consecutive points
+    auto minVec = simde_mm_set1_pd(std::numeric_limits<double>::max());
+    auto maxVec = simde_mm_set1_pd(std::numeric_limits<double>::lowest());
+    qsizetype j = start;
+    for (; j + 1 < end; j += 2)
+    {
+      const auto p0
+          = simde_mm_loadu_pd(reinterpret_cast<const double *>(src + j));
+      const auto p1
+          = simde_mm_loadu_pd(reinterpret_cast<const double *>(src + j + 1));
+      const auto y = simde_mm_unpackhi_pd(p0, p1);
+      minVec = simde_mm_min_pd(minVec, y);
+      maxVec = simde_mm_max_pd(maxVec, y);
+    }
+
+    // Reduce SIMD registers to scalars & mop up the odd trailing point
+    alignas(16) double lo[2];
+    alignas(16) double hi[2];
+    simde_mm_store_pd(lo, minVec);
+    simde_mm_store_pd(hi, maxVec);
+    double yMin = std::min(lo[0], lo[1]);
+    double yMax = std::max(hi[0], hi[1]);
+    for (; j < end; ++j)
+    {
+      yMin = std::min(yMin, src[j].y());
+      yMax = std::max(yMax, src[j].y());
+    }
+
+    // Recover the position of each extreme within the bucket
+    qsizetype minIndex = start;
+    qsizetype maxIndex = start;
+    for (j = start; j < end; ++j)
+    {
+      if (src[j].y() <= yMin)
+      {
+        minIndex = j;
+        break;
+      }
+    }
+    for (j = start; j < end; ++j)
+    {
+      if (src[j].y() >= yMax)
+      {
+        maxIndex = j;
+        break;
+      }
+    }
+
+    // Emit the extremes in order of occurrence
+    if (minIndex <= maxIndex)
+    {
+      dst[b * 2] = src[minIndex];
+      dst[b * 2 + 1] = src[maxIndex];
+    }
+
+    else
+    {
+      dst[b * 2] = src[maxIndex];
+      dst[b * 2 + 1] = src[minIndex];
+    }
+  }
+}
 }; // namespace SIMD
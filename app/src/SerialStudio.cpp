@@ -28,6 +28,8 @@
 
 #include <QJsonArray>
 
+#include <algorithm>
+
 //------------------------------------------------------------------------------
 // Commercial feature detection, appreciate your respect for this project
 //------------------------------------------------------------------------------
@@ -121,7 +123,11 @@ bool SerialStudio::isDatasetWidget(const DashboardWidget widget)
   switch (widget)
   {
     case DashboardFFT:
+    case DashboardSpectrogram:
     case DashboardPlot:
+    case DashboardScatter:
+    case DashboardHistogram:
+    case DashboardImage:
     case DashboardBar:
     case DashboardGauge:
     case DashboardCompass:
@@ -164,12 +170,24 @@ QString SerialStudio::dashboardWidgetIcon(const DashboardWidget w,
     case DashboardFFT:
       return iconPath + "fft.svg";
       break;
+    case DashboardSpectrogram:
+      return iconPath + "spectrogram.svg";
+      break;
     case DashboardLED:
       return iconPath + "led.svg";
       break;
     case DashboardPlot:
       return iconPath + "plot.svg";
       break;
+    case DashboardScatter:
+      return iconPath + "scatter.svg";
+      break;
+    case DashboardHistogram:
+      return iconPath + "histogram.svg";
+      break;
+    case DashboardImage:
+      return iconPath + "image.svg";
+      break;
     case DashboardBar:
       return iconPath + "bar.svg";
       break;
@@ -221,12 +239,24 @@ QString SerialStudio::dashboardWidgetTitle(const DashboardWidget w)
     case DashboardFFT:
       return tr("FFT Plots");
       break;
+    case DashboardSpectrogram:
+      return tr("Spectrograms");
+      break;
     case DashboardLED:
       return tr("LED Panels");
       break;
     case DashboardPlot:
       return tr("Data Plots");
       break;
+    case DashboardScatter:
+      return tr("Scatter Plots");
+      break;
+    case DashboardHistogram:
+      return tr("Histograms");
+      break;
+    case DashboardImage:
+      return tr("Image Feeds");
+      break;
     case DashboardBar:
       return tr("Bars");
       break;
@@ -308,6 +338,18 @@ SerialStudio::getDashboardWidgets(const JSON::Dataset &dataset)
   else if (widget == "gauge")
     list.append(DashboardGauge);
 
+  else if (widget == "histogram")
+    list.append(DashboardHistogram);
+
+  else if (widget == "image")
+    list.append(DashboardImage);
+
+  else if (widget == "scatter")
+    list.append(DashboardScatter);
+
+  else if (widget == "spectrogram")
+    list.append(DashboardSpectrogram);
+
   if (dataset.graph())
     list.append(DashboardPlot);
 
@@ -407,6 +449,12 @@ QString SerialStudio::datasetWidgetId(const DatasetWidget widget)
     case Compass:
       return "compass";
       break;
+    case Histogram:
+      return "histogram";
+      break;
+    case Image:
+      return "image";
+      break;
     case NoDatasetWidget:
       return "";
       break;
@@ -433,6 +481,12 @@ SerialStudio::DatasetWidget SerialStudio::datasetWidgetFromId(const QString &id)
   else if (id == "compass")
     return Compass;
 
+  else if (id == "histogram")
+    return Histogram;
+
+  else if (id == "image")
+    return Image;
+
   return NoDatasetWidget;
 }
 
@@ -452,10 +506,89 @@ SerialStudio::DatasetWidget SerialStudio::datasetWidgetFromId(const QString &id)
 QString SerialStudio::getDatasetColor(const int index)
 {
   static const auto *theme = &Misc::ThemeManager::instance();
-  const auto idx = index - 1;
-  const auto colors = theme->colors()["widget_colors"].toArray();
-  const auto color = colors.count() > idx
-                         ? colors.at(idx).toString()
-                         : colors.at(idx % colors.count()).toString();
-  return color;
+  return theme->widgetColor(index - 1).name();
+}
+
+//------------------------------------------------------------------------------
+// Recording schema logic
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes a stable fingerprint of the dataset layout of a frame.
+ *
+ * The fingerprint is a 64-bit FNV-1a hash over the sorted field/header pairs
+ * returned by fieldHeaderPairs(), so two frames with the same dataset
+ * indexes and group/dataset titles produce the same value regardless of how
+ * the project file is formatted. Recordings embed it so replays can tell at
+ * open time whether the capture matches the loaded project, or whether a
+ * column remap is required.
+ *
+ * @param groups The group/dataset tree to fingerprint.
+ * @return A 64-bit fingerprint of the dataset layout.
+ */
+quint64 SerialStudio::schemaFingerprint(const QVector<JSON::Group> &groups)
+{
+  quint64 hash = 0xcbf29ce484222325ULL;
+  const auto fnv1a = [&hash](const char *data, const qsizetype length) {
+    for (qsizetype i = 0; i < length; ++i)
+    {
+      hash ^= static_cast<quint8>(data[i]);
+      hash *= 0x100000001b3ULL;
+    }
+  };
+
+  const auto pairs = fieldHeaderPairs(groups);
+  for (const auto &pair : pairs)
+  {
+    const qint32 index = pair.first;
+    const QByteArray header = pair.second.toUtf8();
+    fnv1a(reinterpret_cast<const char *>(&index), sizeof(index));
+    fnv1a(header.constData(), header.size());
+  }
+
+  return hash;
+}
+
+/**
+ * @brief Returns the sorted field/header pairs of a frame's dataset layout.
+ *
+ * Collects one ("index", "group title/dataset title") pair per unique dataset
+ * index and sorts them by index — the field order in which project frames
+ * serialize their values. Both the binary recording writer and the replay
+ * remap layer derive their column layout from this function, so the two
+ * always agree on what a column is called and where it belongs.
+ *
+ * @param groups The group/dataset tree to describe.
+ * @return The field/header pairs, sorted by dataset index.
+ */
+QVector<QPair<int, QString>>
+SerialStudio::fieldHeaderPairs(const QVector<JSON::Group> &groups)
+{
+  QVector<QString> headers;
+  QVector<int> datasetIndexes;
+  for (auto g = groups.constBegin(); g != groups.constEnd(); ++g)
+  {
+    const auto &datasets = g->datasets();
+    for (auto d = datasets.constBegin(); d != datasets.constEnd(); ++d)
+    {
+      if (!datasetIndexes.contains(d->index()))
+      {
+        auto header = QString("%1/%2").arg(g->title(), d->title()).simplified();
+        datasetIndexes.append(d->index());
+        headers.append(header);
+      }
+    }
+  }
+
+  QVector<QPair<int, QString>> pairs;
+  pairs.reserve(datasetIndexes.count());
+  for (int i = 0; i < datasetIndexes.count(); ++i)
+    pairs.append(qMakePair(datasetIndexes[i], headers[i]));
+
+  std::sort(pairs.begin(), pairs.end(),
+            [](const QPair<int, QString> &a, const QPair<int, QString> &b) {
+              return a.first < b.first;
+            });
+
+  return pairs;
 }
@@ -25,6 +25,9 @@
 #include <QObject>
 #include <QVector>
 
+#include "RingBuffer.h"
+#include "AlignedBuffer.h"
+#include "TieredBuffer.h"
 #include "JSON/Group.h"
 #include "JSON/Dataset.h"
 
@@ -40,6 +43,16 @@ typedef QVector<qreal> PlotDataX;
  */
 typedef QVector<qreal> PlotDataY;
 
+/**
+ * @typedef AlignedSeriesY
+ * @brief 64-byte-aligned, pool-backed Y-axis samples for SIMD consumers.
+ *
+ * Used for fixed-size series that stay linear in memory (e.g. FFT input
+ * windows), where the kernels benefit from cache-line alignment and series
+ * reconfiguration should recycle blocks instead of reallocating.
+ */
+typedef AlignedBuffer<qreal> AlignedSeriesY;
+
 #ifdef USE_QT_COMMERCIAL
 /**
  * @typedef PlotData3D
@@ -58,21 +71,45 @@ typedef QVector<QVector3D> PlotData3D;
  */
 typedef QVector<PlotDataY> MultiPlotDataY;
 
+/**
+ * @typedef PlotRingX
+ * @brief Circular buffer with the unique X-axis data points for a plot.
+ */
+typedef RingBuffer<qreal> PlotRingX;
+
+/**
+ * @typedef PlotRingY
+ * @brief Circular buffer with the Y-axis data points for a single curve.
+ */
+typedef RingBuffer<qreal> PlotRingY;
+
+/**
+ * @typedef TieredSeriesX
+ * @brief Tiered rolling history for the X-axis data points of a plot.
+ */
+typedef TieredBuffer<qreal> TieredSeriesX;
+
+/**
+ * @typedef TieredSeriesY
+ * @brief Tiered rolling history for the Y-axis data points of a curve.
+ */
+typedef TieredBuffer<qreal> TieredSeriesY;
+
 /**
  * @typedef LineSeries
  * @brief Represents a paired series of X-axis and Y-axis data for a plot.
  *
- * The `LineSeries` type is defined as a `QPair` containing:
- * - A pointer to `PlotDataX`, which holds the unique X-axis values.
- * - A pointer to `PlotDataY`, which holds the Y-axis values.
+ * The `LineSeries` type is defined as a structure containing:
+ * - A pointer to `PlotRingX`, which holds the unique X-axis values.
+ * - A pointer to `PlotRingY`, which holds the Y-axis values.
  *
  * This type simplifies data processing by tightly coupling the related X and Y
  * data for a plot, ensuring that they are always accessed and managed together.
  */
 typedef struct
 {
-  PlotDataX *x;
-  PlotDataY *y;
+  PlotRingX *x;
+  PlotRingY *y;
 } LineSeries;
 
 /**
@@ -80,8 +117,8 @@ typedef struct
  */
 typedef struct
 {
-  PlotDataX *x;
-  QList<PlotDataY> y;
+  PlotRingX *x;
+  QList<PlotRingY> y;
 } MultiLineSeries;
 
 /**
@@ -163,7 +200,8 @@ public:
     EndDelimiterOnly     = 0x00, /**< Detects frames based only on an end delimiter. */
     StartAndEndDelimiter = 0x01, /**< Detects frames based on both start and end delimiters. */
     NoDelimiters         = 0x02, /**< Disables frame detection and processes incoming data directly */
-    StartDelimiterOnly   = 0x03  /**< Detects frames with only a header */
+    StartDelimiterOnly   = 0x03, /**< Detects frames with only a header */
+    FixedLength          = 0x04  /**< Slices frames of a constant byte length, with optional sync pattern */
     /* IMPORTANT: When adding other modes, please don't modify the order of the
      *            enums to ensure backward compatiblity with previous project
      *            files!! */
@@ -203,6 +241,7 @@ public:
     UART,        /**< Serial port communication. */
     Network,     /**< Network socket communication. */
     BluetoothLE, /**< Bluetooth Low Energy communication. */
+    FileReplay,  /**< Raw capture file replay. */
 #ifdef USE_QT_COMMERCIAL
     ModBus, /**< MODBUS communication */
     CanBus, /**< CANBUS communication */
@@ -233,6 +272,8 @@ public:
     Bar,
     Gauge,
     Compass,
+    Histogram,
+    Image,
     NoDatasetWidget
   };
   Q_ENUM(DatasetWidget)
@@ -251,10 +292,14 @@ public:
     DashboardAccelerometer,
     DashboardGyroscope,
     DashboardGPS,
+    DashboardImage,
     DashboardPlot3D,
     DashboardFFT,
+    DashboardSpectrogram,
     DashboardLED,
     DashboardPlot,
+    DashboardScatter,
+    DashboardHistogram,
     DashboardBar,
     DashboardGauge,
     DashboardCompass,
@@ -337,4 +382,12 @@ public:
   // Utility functions
   //
   [[nodiscard]] static QString getDatasetColor(const int index);
+
+  //
+  // Recording schema logic
+  //
+  // clang-format off
+  [[nodiscard]] static quint64 schemaFingerprint(const QVector<JSON::Group> &groups);
+  [[nodiscard]] static QVector<QPair<int, QString>> fieldHeaderPairs(const QVector<JSON::Group> &groups);
+  // clang-format on
 };
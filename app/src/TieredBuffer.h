@@ -0,0 +1,240 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "RingBuffer.h"
+
+/**
+ * @class TieredBuffer
+ * @brief Rolling series storage with progressively downsampled history tiers.
+ *
+ * Tier zero is an ordinary RingBuffer holding the most recent samples at full
+ * rate; every coarser tier holds the same number of elements, but each element
+ * summarizes a bucket of @c Decimation elements of the tier below as a
+ * min/max pair. With the default factor of 16 and three coarse tiers, a
+ * series configured for 10k points keeps a min/max-preserving record of the
+ * last ~40 million samples in seven ring buffers of 10k elements each —
+ * bounded memory regardless of how long the session runs.
+ *
+ * Appending cascades through per-tier accumulators: a bucket's running
+ * min/max is folded on every sample and pushed into the coarser tier once the
+ * bucket completes, so the amortized cost per sample is O(1) and the peaks of
+ * any transient are preserved at every resolution.
+ *
+ * The full-rate tier is exposed through samples() so existing consumers
+ * (LineSeries pointers, SIMD kernels, the plot renderer) keep operating on a
+ * plain RingBuffer; the coarse tiers are read through tierMin()/tierMax()
+ * when a viewer needs to resolve a window wider than the recent tier.
+ */
+template<typename T>
+class TieredBuffer
+{
+public:
+  static constexpr int TierCount = 4;
+  static constexpr qsizetype Decimation = 16;
+
+  TieredBuffer() { resetAccumulators(); }
+
+  /**
+   * @brief Clears every tier and resets the bucket accumulators.
+   */
+  void clear()
+  {
+    m_samples.clear();
+    for (int i = 0; i < TierCount - 1; ++i)
+    {
+      m_tierMin[i].clear();
+      m_tierMax[i].clear();
+    }
+
+    resetAccumulators();
+  }
+
+  /**
+   * @brief Releases any memory not required by the current capacity.
+   */
+  void squeeze()
+  {
+    m_samples.squeeze();
+    for (int i = 0; i < TierCount - 1; ++i)
+    {
+      m_tierMin[i].squeeze();
+      m_tierMax[i].squeeze();
+    }
+  }
+
+  /**
+   * @brief Re-allocates every tier to the given capacity and resets the
+   *        write position, leaving the elements value-initialized.
+   */
+  void resize(const qsizetype capacity)
+  {
+    m_samples.resize(capacity);
+    for (int i = 0; i < TierCount - 1; ++i)
+    {
+      m_tierMin[i].resize(capacity);
+      m_tierMax[i].resize(capacity);
+    }
+
+    resetAccumulators();
+  }
+
+  /**
+   * @brief Returns the capacity of each individual tier.
+   */
+  [[nodiscard]] qsizetype count() const { return m_samples.count(); }
+
+  /**
+   * @brief Provides raw access to the full-rate tier's (non-rotated) storage.
+   */
+  [[nodiscard]] T *data() { return m_samples.data(); }
+
+  /**
+   * @brief Returns the full-rate recent-samples tier.
+   */
+  [[nodiscard]] RingBuffer<T> &samples() { return m_samples; }
+  [[nodiscard]] const RingBuffer<T> &samples() const { return m_samples; }
+
+  /**
+   * @brief Returns the bucket minima of the given coarse tier (1-based).
+   */
+  [[nodiscard]] const RingBuffer<T> &tierMin(const int tier) const
+  {
+    return m_tierMin[tier - 1];
+  }
+
+  /**
+   * @brief Returns the bucket maxima of the given coarse tier (1-based).
+   */
+  [[nodiscard]] const RingBuffer<T> &tierMax(const int tier) const
+  {
+    return m_tierMax[tier - 1];
+  }
+
+  /**
+   * @brief Returns the number of full-rate samples one element of the given
+   *        tier represents (1 for tier zero, Decimation^tier otherwise).
+   */
+  [[nodiscard]] static quint64 tierStride(const int tier)
+  {
+    quint64 stride = 1;
+    for (int i = 0; i < tier; ++i)
+      stride *= Decimation;
+
+    return stride;
+  }
+
+  /**
+   * @brief Returns the finest tier whose history covers the given number of
+   *        full-rate samples, so viewers can re-resolve a zoomed region from
+   *        the highest resolution that still spans it.
+   */
+  [[nodiscard]] int tierForSpan(const quint64 samples) const
+  {
+    for (int tier = 0; tier < TierCount; ++tier)
+    {
+      if (samples <= quint64(count()) * tierStride(tier))
+        return tier;
+    }
+
+    return TierCount - 1;
+  }
+
+  /**
+   * @brief Appends one sample and cascades it through the coarse tiers.
+   */
+  void append(const T &value)
+  {
+    m_samples.append(value);
+    accumulate(value, value);
+  }
+
+  /**
+   * @brief Appends a batch of samples, overwriting the oldest elements of
+   *        the full-rate tier and folding every sample into the coarse-tier
+   *        accumulators.
+   */
+  void append(const T *samples, const qsizetype count)
+  {
+    m_samples.append(samples, count);
+    for (qsizetype i = 0; i < count; ++i)
+      accumulate(samples[i], samples[i]);
+  }
+
+private:
+  /**
+   * @brief Folds a min/max pair into the first coarse tier's accumulator and
+   *        cascades completed buckets into coarser tiers.
+   */
+  void accumulate(const T &min, const T &max)
+  {
+    T bucketMin = min;
+    T bucketMax = max;
+    for (int i = 0; i < TierCount - 1; ++i)
+    {
+      if (m_accCount[i] == 0)
+      {
+        m_accMin[i] = bucketMin;
+        m_accMax[i] = bucketMax;
+      }
+
+      else
+      {
+        if (bucketMin < m_accMin[i])
+          m_accMin[i] = bucketMin;
+        if (bucketMax > m_accMax[i])
+          m_accMax[i] = bucketMax;
+      }
+
+      if (++m_accCount[i] < Decimation)
+        break;
+
+      bucketMin = m_accMin[i];
+      bucketMax = m_accMax[i];
+      m_tierMin[i].append(bucketMin);
+      m_tierMax[i].append(bucketMax);
+      m_accCount[i] = 0;
+    }
+  }
+
+  /**
+   * @brief Resets the per-tier bucket accumulators.
+   */
+  void resetAccumulators()
+  {
+    for (int i = 0; i < TierCount - 1; ++i)
+    {
+      m_accMin[i] = T();
+      m_accMax[i] = T();
+      m_accCount[i] = 0;
+    }
+  }
+
+private:
+  RingBuffer<T> m_samples;
+  RingBuffer<T> m_tierMin[TierCount - 1];
+  RingBuffer<T> m_tierMax[TierCount - 1];
+
+  T m_accMin[TierCount - 1];
+  T m_accMax[TierCount - 1];
+  qsizetype m_accCount[TierCount - 1];
+};
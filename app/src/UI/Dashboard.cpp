@@ -21,11 +21,22 @@
 
 #include "UI/Dashboard.h"
 
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <type_traits>
+
+#include <QtMath>
+#include <QThread>
+
 #include "SIMD/SIMD.h"
 #include "IO/Manager.h"
-#include "IO/Console.h"
+#include "IO/MacroRunner.h"
 #include "CSV/Player.h"
 #include "Misc/TimerEvents.h"
+#include "Misc/ThreadAffinity.h"
+#include "Misc/AllocationTracker.h"
+#include "Misc/Watchdog.h"
 #include "JSON/FrameBuilder.h"
 
 #ifdef USE_QT_COMMERCIAL
@@ -45,14 +56,30 @@ UI::Dashboard::Dashboard()
   : m_points(10e3)
   , m_precision(2)
   , m_widgetCount(0)
+  , m_frameRevision(0)
   , m_updateRequired(false)
+  , m_valueUpdateRequired(false)
+  , m_widgetValuesStale(false)
   , m_terminalEnabled(false)
+  , m_latestRxTime(0)
 {
+  // Start the gyroscope integration clock
+  m_gyroIntegrationTimer.start();
+
+  // Move the per-frame ingest stage to its dedicated thread
+  m_ingest = new DashboardIngest();
+  m_ingest->moveToThread(&m_ingestThread);
+  connect(&m_ingestThread, &QThread::finished, m_ingest,
+          &QObject::deleteLater);
+  m_ingestThread.start();
+  Misc::ThreadAffinity::apply(&m_ingestThread, QStringLiteral("ingest"));
+
   // clang-format off
   connect(&CSV::Player::instance(), &CSV::Player::openChanged, this, [=] { resetData(true); }, Qt::QueuedConnection);
   connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this, [=] { resetData(true); }, Qt::QueuedConnection);
   connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::jsonFileMapChanged, this, [=] { resetData(); }, Qt::QueuedConnection);
-  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged, this, &UI::Dashboard::processFrame, Qt::QueuedConnection);
+  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged, m_ingest, [this](const std::shared_ptr<JSON::Frame> &frame) { m_ingest->enqueue(frame); }, Qt::DirectConnection);
+  connect(m_ingest, &UI::DashboardIngest::structuralFrame, this, &UI::Dashboard::processFrame, Qt::QueuedConnection);
   // clang-format on
 
   // Reset dashboard data if MQTT client is subscribed
@@ -70,17 +97,56 @@ UI::Dashboard::Dashboard()
       Qt::QueuedConnection);
 #endif
 
-  // Update the dashboard widgets at 24 Hz
+  // Update the plot widgets at 24 Hz, fanning the latest coalesced values
+  // into the widget-model copies exactly once per tick
   connect(
       &Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout24Hz, this,
       [=] {
+        if (consumeIngestSnapshot())
+        {
+          m_updateRequired = true;
+          m_valueUpdateRequired = true;
+        }
+
         if (m_updateRequired)
         {
           m_updateRequired = false;
+          syncWidgetModelValues();
+          updateInertialSnapshots();
+          updatePlots();
           Q_EMIT updated();
         }
       },
       Qt::QueuedConnection);
+
+  // Update the value widgets (gauges, bars, LEDs, etc.) at a reduced 10 Hz,
+  // they display a single reading & gain nothing from display-rate repaints
+  connect(
+      &Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout10Hz, this,
+      [=] {
+        if (consumeIngestSnapshot())
+        {
+          m_updateRequired = true;
+          m_valueUpdateRequired = true;
+        }
+
+        if (m_valueUpdateRequired)
+        {
+          m_valueUpdateRequired = false;
+          syncWidgetModelValues();
+          Q_EMIT valuesUpdated();
+        }
+      },
+      Qt::QueuedConnection);
+}
+
+/**
+ * @brief Stops the ingest thread before the dashboard is destroyed.
+ */
+UI::Dashboard::~Dashboard()
+{
+  m_ingestThread.quit();
+  m_ingestThread.wait();
 }
 
 /**
@@ -272,6 +338,15 @@ int UI::Dashboard::totalWidgetCount() const
   return m_widgetCount;
 }
 
+/**
+ * @brief Gets the number of frames shed by the bounded ingest mailbox.
+ * @return Total dropped frame count since application start.
+ */
+quint64 UI::Dashboard::droppedFrames() const
+{
+  return m_ingest->droppedFrames();
+}
+
 /**
  * @brief Checks if the current frame is valid for processing.
  * @return True if the current frame is valid; false otherwise.
@@ -330,6 +405,235 @@ int UI::Dashboard::widgetCount(const SerialStudio::DashboardWidget widget) const
   return 0;
 }
 
+/**
+ * @brief Maps a capture timestamp to a fractional sample position.
+ *
+ * Runs a binary search over the per-series capture-timestamp ring filled in
+ * lockstep with the Y-axis samples, so placing a cursor on a million-point
+ * window costs O(log n) no matter how deep the plot is configured. The
+ * returned position is fractional: timestamps falling between two samples
+ * interpolate linearly, and timestamps outside the stored window clamp to
+ * its edges.
+ *
+ * @param datasetIndex Index of the dataset feeding the plot series.
+ * @param timestamp    Capture timestamp in milliseconds since the epoch, as
+ *                     stamped by the I/O drivers when the frame arrived.
+ * @return Fractional chronological sample position for cursorMeasurement(),
+ *         or -1 when the series does not exist or holds no samples yet.
+ */
+qreal UI::Dashboard::samplePositionForTime(const int datasetIndex,
+                                           const qreal timestamp) const
+{
+  const auto it = m_sampleTimes.constFind(datasetIndex);
+  if (it == m_sampleTimes.cend())
+    return -1;
+
+  // Only the tail of the ring written so far holds real samples
+  const auto &times = *it;
+  const qsizetype capacity = times.count();
+  const auto valid = qMin<qsizetype>(times.written(), capacity);
+  if (valid <= 0)
+    return -1;
+
+  // Clamp timestamps outside the stored window to its edges
+  const qsizetype first = capacity - valid;
+  const qsizetype last = capacity - 1;
+  if (timestamp <= times.at(first))
+    return first;
+  if (timestamp >= times.at(last))
+    return last;
+
+  // Binary search for the last sample captured at or before the timestamp
+  qsizetype lo = first;
+  qsizetype hi = last;
+  while (lo + 1 < hi)
+  {
+    const qsizetype mid = lo + (hi - lo) / 2;
+    if (times.at(mid) <= timestamp)
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  // Interpolate between the bracketing capture timestamps
+  const qreal t0 = times.at(lo);
+  const qreal t1 = times.at(hi);
+  if (t1 <= t0)
+    return lo;
+
+  return lo + (timestamp - t0) / (t1 - t0);
+}
+
+/**
+ * @brief Reads the value & capture timestamp under a plot cursor.
+ *
+ * Queries the full-rate sample ring that backs the series — not the
+ * decimated min/max tiers used to render wide windows — so the readout is
+ * sample-accurate regardless of how coarse the tier on screen is.
+ * Fractional positions interpolate linearly between the two neighbouring
+ * samples, for both the value and the capture timestamp.
+ *
+ * @param datasetIndex Index of the dataset feeding the plot series.
+ * @param position     Fractional chronological sample position, e.g. as
+ *                     returned by samplePositionForTime().
+ * @return Map with @c valid, the clamped @c position, the interpolated
+ *         @c value and the interpolated @c timestamp in milliseconds.
+ */
+QVariantMap UI::Dashboard::cursorMeasurement(const int datasetIndex,
+                                             const qreal position) const
+{
+  QVariantMap measurement;
+  measurement.insert(QStringLiteral("valid"), false);
+
+  const auto y = m_yAxisData.constFind(datasetIndex);
+  const auto t = m_sampleTimes.constFind(datasetIndex);
+  if (y == m_yAxisData.cend() || t == m_sampleTimes.cend())
+    return measurement;
+
+  const auto &series = y->samples();
+  const qsizetype capacity = series.count();
+  const auto valid = qMin<qsizetype>(t->written(), capacity);
+  if (valid <= 0)
+    return measurement;
+
+  // Clamp the cursor to the stored window & split into sample + fraction
+  const qsizetype first = capacity - valid;
+  const qreal clamped = qBound(qreal(first), position, qreal(capacity - 1));
+  const auto i0 = qsizetype(std::floor(clamped));
+  const auto i1 = qMin(i0 + 1, capacity - 1);
+  const qreal fraction = clamped - qreal(i0);
+
+  measurement.insert(QStringLiteral("valid"), true);
+  measurement.insert(QStringLiteral("position"), clamped);
+  measurement.insert(QStringLiteral("value"),
+                     series.at(i0)
+                         + (series.at(i1) - series.at(i0)) * fraction);
+  measurement.insert(QStringLiteral("timestamp"),
+                     t->at(i0) + (t->at(i1) - t->at(i0)) * fraction);
+  return measurement;
+}
+
+/**
+ * @brief Measures the span between two plot cursors.
+ *
+ * Both endpoints resolve through cursorMeasurement(), so the deltas come
+ * from the full-rate samples rather than the decimated render buffer. The
+ * span statistics (minimum, maximum & mean) fold over every stored sample
+ * between the cursors; the cursor order does not matter.
+ *
+ * @param datasetIndex Index of the dataset feeding the plot series.
+ * @param positionA    Fractional sample position of the first cursor.
+ * @param positionB    Fractional sample position of the second cursor.
+ * @return Map with @c valid, @c samples, @c deltaTime (milliseconds),
+ *         @c deltaValue, @c slope (value units per second), @c minimum,
+ *         @c maximum and @c mean.
+ */
+QVariantMap UI::Dashboard::cursorDelta(const int datasetIndex,
+                                       const qreal positionA,
+                                       const qreal positionB) const
+{
+  QVariantMap delta;
+  delta.insert(QStringLiteral("valid"), false);
+
+  // Resolve both endpoints against the full-rate samples
+  const auto a = cursorMeasurement(datasetIndex, qMin(positionA, positionB));
+  const auto b = cursorMeasurement(datasetIndex, qMax(positionA, positionB));
+  if (!a.value(QStringLiteral("valid")).toBool()
+      || !b.value(QStringLiteral("valid")).toBool())
+    return delta;
+
+  const qreal posA = a.value(QStringLiteral("position")).toReal();
+  const qreal posB = b.value(QStringLiteral("position")).toReal();
+  const qreal timeA = a.value(QStringLiteral("timestamp")).toReal();
+  const qreal timeB = b.value(QStringLiteral("timestamp")).toReal();
+  const qreal valueA = a.value(QStringLiteral("value")).toReal();
+  const qreal valueB = b.value(QStringLiteral("value")).toReal();
+
+  // Fold minimum/maximum/mean over the stored samples inside the span
+  const auto &series = m_yAxisData.constFind(datasetIndex)->samples();
+  const auto begin = qsizetype(std::ceil(posA));
+  const auto end = qsizetype(std::floor(posB));
+  qreal minimum = qMin(valueA, valueB);
+  qreal maximum = qMax(valueA, valueB);
+  qreal sum = 0;
+  qsizetype count = 0;
+  for (qsizetype i = begin; i <= end; ++i)
+  {
+    const qreal sample = series.at(i);
+    minimum = qMin(minimum, sample);
+    maximum = qMax(maximum, sample);
+    sum += sample;
+    ++count;
+  }
+
+  delta.insert(QStringLiteral("valid"), true);
+  delta.insert(QStringLiteral("samples"), posB - posA);
+  delta.insert(QStringLiteral("deltaTime"), timeB - timeA);
+  delta.insert(QStringLiteral("deltaValue"), valueB - valueA);
+  delta.insert(QStringLiteral("slope"),
+               timeB > timeA ? (valueB - valueA) / ((timeB - timeA) / 1000.0)
+                             : 0.0);
+  delta.insert(QStringLiteral("minimum"), minimum);
+  delta.insert(QStringLiteral("maximum"), maximum);
+  delta.insert(QStringLiteral("mean"), count > 0 ? sum / count : valueA);
+  return delta;
+}
+
+/**
+ * @brief Linearizes the sample store for bulk columnar exporters.
+ *
+ * Each plotted dataset contributes its value series plus the matching
+ * capture-time series (suffixed "(time)", milliseconds since the epoch),
+ * both read from the full-rate tier that backs the plots — per-dataset
+ * contiguous typed arrays, the same layout the SIMD kernels consume. Only
+ * the tail of each ring written so far is exported, so a freshly started
+ * session does not pad the table with value-initialized zeros. Samples
+ * are ordered oldest first.
+ *
+ * @return Named float64 columns, empty when no project is streaming.
+ */
+QVector<QPair<QString, QVector<qreal>>> UI::Dashboard::sampleColumns() const
+{
+  QVector<QPair<QString, QVector<qreal>>> columns;
+  columns.reserve(m_yAxisData.count() * 2);
+
+  // Copies the valid tail of a sample ring into a contiguous vector
+  const auto linearize = [](const PlotRingY &ring) {
+    const qsizetype capacity = ring.count();
+    const auto valid = qMin<qsizetype>(ring.written(), capacity);
+
+    QVector<qreal> samples;
+    samples.resize(valid);
+    for (qsizetype i = 0; i < valid; ++i)
+      samples[i] = ring.at(capacity - valid + i);
+
+    return samples;
+  };
+
+  for (auto it = m_yAxisData.constBegin(); it != m_yAxisData.constEnd(); ++it)
+  {
+    // Skip series that never received a sample
+    const int index = it.key();
+    const auto &series = it.value().samples();
+    if (series.written() == 0)
+      continue;
+
+    // Resolve the dataset title that names the column
+    QString title = QStringLiteral("Dataset %1").arg(index);
+    if (m_datasets.contains(index))
+      title = m_datasets.value(index).title();
+
+    // Export the value series & its capture-time companion
+    columns.append(qMakePair(title, linearize(series)));
+    const auto times = m_sampleTimes.constFind(index);
+    if (times != m_sampleTimes.cend())
+      columns.append(qMakePair(QStringLiteral("%1 (time)").arg(title),
+                               linearize(*times)));
+  }
+
+  return columns;
+}
+
 /**
  * @brief Retrieves the title of the current frame in the dashboard.
  * @return A reference to a QString containing the current frame title.
@@ -435,6 +739,49 @@ UI::Dashboard::getDatasetWidget(const SerialStudio::DashboardWidget widget,
   return m_widgetDatasets[widget].at(index);
 }
 
+/**
+ * @brief Provides the published heading angle for a compass widget.
+ * @param index The relative index of the compass widget.
+ * @return The heading angle, clamped between 0 and 360 degrees.
+ */
+qreal UI::Dashboard::compassSnapshot(const int index) const
+{
+  return m_compassSnapshots.value(index, 0);
+}
+
+/**
+ * @brief Provides the published orientation state for a gyroscope widget.
+ * @param index The relative index of the gyroscope widget.
+ * @return A reference to the integrated yaw/roll/pitch angles.
+ */
+const UI::GyroscopeSnapshot &
+UI::Dashboard::gyroscopeSnapshot(const int index) const
+{
+  static const GyroscopeSnapshot fallback;
+  const auto it = m_gyroscopeSnapshots.constFind(index);
+  if (it == m_gyroscopeSnapshots.cend())
+    return fallback;
+
+  return it.value();
+}
+
+/**
+ * @brief Provides the published acceleration state for an accelerometer
+ *        widget.
+ * @param index The relative index of the accelerometer widget.
+ * @return A reference to the computed angle & magnitude values.
+ */
+const UI::AccelerometerSnapshot &
+UI::Dashboard::accelerometerSnapshot(const int index) const
+{
+  static const AccelerometerSnapshot fallback;
+  const auto it = m_accelerometerSnapshots.constFind(index);
+  if (it == m_accelerometerSnapshots.cend())
+    return fallback;
+
+  return it.value();
+}
+
 /**
  * @brief Retrieves the current JSON frame for the dashboard.
  * @return A reference to the current JSON::Frame.
@@ -446,13 +793,40 @@ const JSON::Frame &UI::Dashboard::currentFrame()
 
 /**
  * @brief Provides the FFT plot values currently displayed on the dashboard.
- * @return A reference to a QVector containing the FFT PlotDataY data.
+ * @return A reference to the aligned FFT sample buffer.
  */
-const PlotDataY &UI::Dashboard::fftData(const int index) const
+const AlignedSeriesY &UI::Dashboard::fftData(const int index) const
 {
   return m_fftValues[index];
 }
 
+/**
+ * @brief Provides the aligned sample buffer feeding a spectrogram widget.
+ * @return A reference to the aligned sample buffer.
+ */
+const AlignedSeriesY &UI::Dashboard::spectrogramData(const int index) const
+{
+  return m_spectrogramValues[index];
+}
+
+/**
+ * @brief Provides the quantile sketch backing a histogram widget.
+ * @return A reference to the sketch accumulated on the ingest thread.
+ */
+const QuantileSketch &UI::Dashboard::histogramData(const int index) const
+{
+  return m_histogramData[index];
+}
+
+/**
+ * @brief Provides the density grid backing a scatter widget.
+ * @return A reference to the grid accumulated on the ingest thread.
+ */
+const DensityGrid &UI::Dashboard::scatterData(const int index) const
+{
+  return m_scatterData[index];
+}
+
 /**
  * @brief Provides the linear plot values currently displayed on the dashboard.
  * @return A reference to a QVector containing the linear PlotDataY data.
@@ -480,6 +854,23 @@ const PlotData3D &UI::Dashboard::plotData3D(const int index) const
 {
   return m_plotData3D[index];
 }
+
+/**
+ * @brief Returns the total number of points ever captured by a 3D plot.
+ *
+ * Unlike plotData3D().count(), this counter keeps growing once the capture
+ * reaches capacity and old points start being recycled, which lets the
+ * widget distinguish a pure tail append from a shifted window.
+ *
+ * @param index Index of the 3D plot widget.
+ */
+quint64 UI::Dashboard::plotData3DTotalPoints(const int index) const
+{
+  if (index < 0 || index >= m_plotData3DTotal.count())
+    return 0;
+
+  return m_plotData3DTotal[index];
+}
 #endif
 
 /**
@@ -509,6 +900,13 @@ void UI::Dashboard::setPoints(const int points)
 
 /**
  * @brief Activates an action by sending its associated data via the IO Manager.
+ *
+ * The transmission payload was compiled into ready-to-send bytes when the
+ * project was loaded, so activation costs a single write. When the action
+ * carries a macro, the referenced payloads are handed to the macro runner,
+ * which replays them with the configured inter-send delays on its own
+ * thread.
+ *
  * @param index The index of the action to activate.
  * @throws An assertion failure if the index is out of bounds.
  */
@@ -517,14 +915,30 @@ void UI::Dashboard::activateAction(const int index)
   if (index >= 0 && index < m_actions.count())
   {
     const auto &action = m_actions[index];
+    IO::Manager::instance().writeData(action.txBin());
 
-    QByteArray bin;
-    if (action.binaryData())
-      bin = IO::Console::hexToBytes(action.txData());
-    else
-      bin = QString(action.txData() + action.eolSequence()).toUtf8();
+    // Resolve the macro steps into precompiled payload/delay pairs. Only the
+    // payload of a referenced action is taken, never its own macro, so
+    // chains cannot recurse.
+    if (!action.macroSteps().isEmpty())
+    {
+      QVector<IO::MacroRunner::Step> steps;
+      steps.reserve(action.macroSteps().count());
+      for (const auto &step : action.macroSteps())
+      {
+        for (const auto &candidate : m_actions)
+        {
+          if (candidate.actionId() == step.actionId)
+          {
+            steps.append({candidate.txBin(), step.delayMs});
+            break;
+          }
+        }
+      }
 
-    IO::Manager::instance().writeData(bin);
+      if (!steps.isEmpty())
+        IO::MacroRunner::instance().run(steps);
+    }
   }
 }
 
@@ -548,24 +962,80 @@ void UI::Dashboard::setPrecision(const int precision)
  *        widget structures, and actions. Emits relevant signals to notify the
  *        UI about the reset state.
  */
+/**
+ * @brief Releases container slack held by the sample handoff queues.
+ *
+ * Bursty ingest grows the pending sample queues to the largest batch seen
+ * and the capacity never returns on its own, since clearing a QVector keeps
+ * its allocation. The queues are drained every plot tick, so shrinking them
+ * while ingest is quiet costs nothing; they simply regrow to the working set
+ * once traffic resumes. The series buffers themselves are fixed-capacity by
+ * design and are not touched. Called from the idle-time compaction pass.
+ *
+ * @return An estimate of the number of bytes returned to the heap.
+ */
+qsizetype UI::Dashboard::compactMemory()
+{
+  qsizetype freed = 0;
+  const auto shrink = [&freed](auto &queue) {
+    using Element = typename std::decay_t<decltype(queue)>::value_type;
+    freed += (queue.capacity() - queue.count())
+             * static_cast<qsizetype>(sizeof(Element));
+    queue.squeeze();
+  };
+
+  shrink(m_pendingFftData);
+  shrink(m_pendingMultiplotData);
+  shrink(m_pendingSpectrogramData);
+
+  return freed;
+}
+
 void UI::Dashboard::resetData(const bool notify)
 {
   // Clear plotting data
   m_fftValues.clear();
   m_pltValues.clear();
+  m_scatterData.clear();
+  m_histogramData.clear();
   m_multipltValues.clear();
+  m_spectrogramValues.clear();
 
   // Free memory associated with the containers of the plotting data
   m_fftValues.squeeze();
   m_pltValues.squeeze();
+  m_scatterData.squeeze();
+  m_histogramData.squeeze();
   m_multipltValues.squeeze();
+  m_spectrogramValues.squeeze();
+
+  // Clear pending sample queues
+  m_pendingFftData.clear();
+  m_pendingTimeData.clear();
+  m_pendingXAxisData.clear();
+  m_pendingYAxisData.clear();
+  m_pendingMultiplotData.clear();
+  m_pendingSpectrogramData.clear();
 
   // Clear X/Y axis arrays
   m_xAxisData.clear();
   m_yAxisData.clear();
+  m_sampleTimes.clear();
+
+  // Forget the series layouts, the next structural pass starts fresh
+  m_fftLayout.clear();
+  m_multiplotLayout.clear();
+  m_spectrogramLayout.clear();
+
+  // Clear inertial widget snapshots
+  m_compassSnapshots.clear();
+  m_gyroscopeSnapshots.clear();
+  m_accelerometerSnapshots.clear();
+  m_gyroIntegrationTimer.restart();
 
   // Clear widget & action structures
   m_widgetCount = 0;
+  m_frameRevision = 0;
   m_actions.clear();
   m_actions.squeeze();
   m_widgetMap.clear();
@@ -575,13 +1045,21 @@ void UI::Dashboard::resetData(const bool notify)
   // Reset frame data
   m_currentFrame = JSON::Frame();
 
+  // Reset the ingest stage & discard any snapshot published before the reset
+  QMetaObject::invokeMethod(m_ingest, &DashboardIngest::reset,
+                            Qt::QueuedConnection);
+  if (auto *snapshot = m_ingest->takeSnapshot())
+    m_ingest->releaseSnapshot(snapshot);
+
   // Notify user interface
   if (notify)
   {
     m_updateRequired = true;
+    m_valueUpdateRequired = true;
 
     Q_EMIT updated();
     Q_EMIT dataReset();
+    Q_EMIT valuesUpdated();
     Q_EMIT actionCountChanged();
     Q_EMIT widgetCountChanged();
     Q_EMIT containsCommercialFeaturesChanged();
@@ -596,126 +1074,212 @@ void UI::Dashboard::setTerminalEnabled(const bool enabled)
   if (m_terminalEnabled != enabled)
   {
     m_updateRequired = true;
+    m_valueUpdateRequired = true;
     m_terminalEnabled = enabled;
 
+    // Force a full rebuild on the next frame (terminal group is prepended)
+    m_frameRevision = 0;
+    QMetaObject::invokeMethod(m_ingest, &DashboardIngest::reset,
+                              Qt::QueuedConnection);
+
     Q_EMIT updated();
+    Q_EMIT valuesUpdated();
     Q_EMIT widgetCountChanged();
     Q_EMIT terminalEnabledChanged();
   }
 }
 
 /**
- * @brief Updates the plot data for all dashboard widgets.
+ * @brief Shifts a fixed-size series left and appends the pending samples.
  *
- * This function ensures that the data structures for FFT plots, linear plots,
- * and multiplots are correctly initialized and updated with the latest values
- * from the datasets. It handles reinitialization if the widget count changes
- * and shifts data to accommodate new samples.
+ * Applies every queued sample in one pass: existing points are moved with a
+ * single memmove and the new samples are copied into the tail, instead of
+ * shifting the whole series once per received frame.
  *
- * @note This function is typically called in real-time to keep plots
- *       synchronized with incoming data.
+ * @note Only used for FFT series, which must remain linear in memory for the
+ *       transform input. Line and multiplot series use circular buffers with
+ *       O(1) appends instead (see RingBuffer).
  */
-void UI::Dashboard::updatePlots()
+static void shiftSamples(AlignedSeriesY &data, const PlotDataY &samples)
 {
-  // Check if we need to re-initialize FFT plots data
-  if (m_fftValues.count() != widgetCount(SerialStudio::DashboardFFT))
-    configureFftSeries();
+  const qsizetype count = data.count();
+  const qsizetype n = qMin(samples.count(), count);
+  if (n <= 0 || count <= 0)
+    return;
 
-  // Check if we need to re-initialize linear plots data
-  if (m_pltValues.count() != widgetCount(SerialStudio::DashboardPlot))
-    configureLineSeries();
+  if (n < count)
+    std::memmove(data.data(), data.data() + n,
+                 static_cast<size_t>(count - n) * sizeof(qreal));
 
-  // Check if we need to re-initialize multiplot data
-  if (m_multipltValues.count() != widgetCount(SerialStudio::DashboardMultiPlot))
-    configureMultiLineSeries();
+  std::memcpy(data.data() + count - n,
+              samples.constData() + samples.count() - n,
+              static_cast<size_t>(n) * sizeof(qreal));
+}
 
-  // Check if we need to re-initialize 3D plot data
-#ifdef USE_QT_COMMERCIAL
-  if (m_plotData3D.count() != widgetCount(SerialStudio::DashboardPlot3D))
+/**
+ * @brief Queues the latest dataset values into the pending sample buffers.
+ *
+ * Called once per received frame: the current value of every plotted dataset
+ * the frame refreshed is appended to a per-series pending queue, which is a
+ * handful of scalar appends regardless of the configured plot depth. The
+ * expensive work of moving the queued samples into the fixed-size plot
+ * series happens at display rate in updatePlots(), so ingest throughput
+ * stays decoupled from render cost.
+ *
+ * @param updatedIndexes Dataset indexes the frame carries fresh values for;
+ *                       series fed by other datasets do not advance, so
+ *                       sparse sources plot each channel at its native rate.
+ *                       An empty set queues a sample for every series.
+ */
+void UI::Dashboard::queuePlotSamples(const QSet<int> &updatedIndexes)
+{
+  // Reports whether the current frame refreshed the given dataset
+  const auto isUpdated = [&updatedIndexes](const int index) {
+    return updatedIndexes.isEmpty() || updatedIndexes.contains(index);
+  };
+
+  // Reads the freshest value of a dataset: the registry is updated on every
+  // received frame, while the widget-model copies it falls back to are only
+  // refreshed at display rate by syncWidgetModelValues()
+  auto liveValue = [this](const JSON::Dataset &dataset) -> qreal {
+    const auto it = m_datasets.constFind(dataset.index());
+    if (it != m_datasets.cend())
+      return it->numericValue();
+
+    return dataset.numericValue();
+  };
+
+  // Queue latest values for FFT plots
+  const int fftCount = widgetCount(SerialStudio::DashboardFFT);
+  if (m_pendingFftData.count() != fftCount)
   {
-    m_plotData3D.clear();
-    m_plotData3D.squeeze();
-    m_plotData3D.resize(widgetCount(SerialStudio::DashboardPlot3D));
-    for (int i = 0; i < m_plotData3D.count(); ++i)
-    {
-      m_plotData3D[i].clear();
-      m_plotData3D[i].squeeze();
-    }
+    m_pendingFftData.clear();
+    m_pendingFftData.resize(fftCount);
   }
-#endif
 
-  // Append latest values to FFT plots data
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
+  for (int i = 0; i < fftCount; ++i)
   {
     const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    auto *data = m_fftValues[i].data();
-    auto count = m_fftValues[i].count();
-    SIMD::shift<qreal>(data, count, dataset.value().toDouble());
+    if (isUpdated(dataset.index()))
+      m_pendingFftData[i].append(liveValue(dataset));
+  }
+
+  // Queue latest values for spectrograms
+  const int spectrogramCount
+      = widgetCount(SerialStudio::DashboardSpectrogram);
+  if (m_pendingSpectrogramData.count() != spectrogramCount)
+  {
+    m_pendingSpectrogramData.clear();
+    m_pendingSpectrogramData.resize(spectrogramCount);
+  }
+
+  for (int i = 0; i < spectrogramCount; ++i)
+  {
+    const auto &dataset
+        = getDatasetWidget(SerialStudio::DashboardSpectrogram, i);
+    if (isUpdated(dataset.index()))
+      m_pendingSpectrogramData[i].append(liveValue(dataset));
   }
 
-  // Append latest values to linear plots data
-  QSet<int> xAxesMoved;
-  QSet<int> yAxesMoved;
+  // Queue latest values for linear plots. A plot fires when either of its
+  // datasets was refreshed, and then queues points for both of its axes (the
+  // stale axis repeats its last-known value), so the X & Y series of a plot
+  // always stay the same length
+  QSet<int> xAxesQueued;
+  QSet<int> yAxesQueued;
   for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
   {
-    // Shift Y-axis points
     const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
-    if (!yAxesMoved.contains(yDataset.index()))
+    const auto xAxisId = SerialStudio::activated() ? yDataset.xAxisId() : 0;
+    const bool hasXAxis = m_datasets.contains(xAxisId);
+    if (!isUpdated(yDataset.index()) && !(hasXAxis && isUpdated(xAxisId)))
+      continue;
+
+    // Queue Y-axis point
+    if (!yAxesQueued.contains(yDataset.index()))
     {
-      yAxesMoved.insert(yDataset.index());
-      auto *yData = m_yAxisData[yDataset.index()].data();
-      auto yCount = m_yAxisData[yDataset.index()].count();
-      SIMD::shift<qreal>(yData, yCount, yDataset.value().toDouble());
+      yAxesQueued.insert(yDataset.index());
+      m_pendingYAxisData[yDataset.index()].append(liveValue(yDataset));
+      m_pendingTimeData[yDataset.index()].append(m_latestRxTime);
     }
 
-    // Shift X-axis points
-    auto xAxisId = SerialStudio::activated() ? yDataset.xAxisId() : 0;
-    if (m_datasets.contains(xAxisId) && !xAxesMoved.contains(xAxisId))
+    // Queue X-axis point
+    if (hasXAxis && !xAxesQueued.contains(xAxisId))
     {
-      xAxesMoved.insert(xAxisId);
-      const auto &xDataset = m_datasets[xAxisId];
-      auto *xData = m_xAxisData[xAxisId].data();
-      auto xCount = m_xAxisData[xAxisId].count();
-      SIMD::shift<qreal>(xData, xCount, xDataset.value().toDouble());
+      xAxesQueued.insert(xAxisId);
+      m_pendingXAxisData[xAxisId].append(m_datasets[xAxisId].numericValue());
     }
   }
 
-  // Append latest values to multiplots data
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
+  // Queue latest values for multiplots
+  const int multiplotCount = widgetCount(SerialStudio::DashboardMultiPlot);
+  if (m_pendingMultiplotData.count() != multiplotCount)
+  {
+    m_pendingMultiplotData.clear();
+    m_pendingMultiplotData.resize(multiplotCount);
+  }
+
+  for (int i = 0; i < multiplotCount; ++i)
   {
     const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+    if (m_pendingMultiplotData[i].count() != group.datasetCount())
+    {
+      m_pendingMultiplotData[i].clear();
+      m_pendingMultiplotData[i].resize(group.datasetCount());
+    }
+
     for (int j = 0; j < group.datasetCount(); ++j)
     {
       const auto &dataset = group.datasets()[j];
-      auto *data = m_multipltValues[i].y[j].data();
-      auto count = m_multipltValues[i].y[j].count();
-      SIMD::shift<qreal>(data, count, dataset.value().toDouble());
+      if (isUpdated(dataset.index()))
+        m_pendingMultiplotData[i][j].append(liveValue(dataset));
     }
   }
 
-// Append latest values to 3D plots
+// Append latest values to 3D plots (already append-based, no shifting)
 #ifdef USE_QT_COMMERCIAL
+  if (m_plotData3D.count() != widgetCount(SerialStudio::DashboardPlot3D))
+  {
+    m_plotData3D.clear();
+    m_plotData3D.squeeze();
+    m_plotData3D.resize(widgetCount(SerialStudio::DashboardPlot3D));
+    for (int i = 0; i < m_plotData3D.count(); ++i)
+    {
+      m_plotData3D[i].clear();
+      m_plotData3D[i].squeeze();
+    }
+
+    m_plotData3DTotal.clear();
+    m_plotData3DTotal.resize(m_plotData3D.count());
+  }
+
   for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot3D); ++i)
   {
     // Get pointer to vector with 3D points for current widget
     auto &plotData = m_plotData3D[i];
 
-    // Initialize new point
+    // Initialize new point, skipping widgets whose axes were not refreshed
     QVector3D point;
+    bool refreshed = false;
     const auto &group = getGroupWidget(SerialStudio::DashboardPlot3D, i);
     for (int j = 0; j < group.datasetCount(); ++j)
     {
       const auto &dataset = group.datasets()[j];
+      refreshed |= isUpdated(dataset.index());
       if (dataset.widget().toLower() == "x")
-        point.setX(dataset.value().toDouble());
+        point.setX(liveValue(dataset));
       else if (dataset.widget().toLower() == "y")
-        point.setY(dataset.value().toDouble());
+        point.setY(liveValue(dataset));
       else if (dataset.widget().toLower() == "z")
-        point.setZ(dataset.value().toDouble());
+        point.setZ(liveValue(dataset));
     }
 
+    if (!refreshed)
+      continue;
+
     // Add point to data
     plotData.append(point);
+    ++m_plotData3DTotal[i];
     if (plotData.count() > points())
       plotData.remove(0, plotData.count() - points());
   }
@@ -723,162 +1287,572 @@ void UI::Dashboard::updatePlots()
 }
 
 /**
- * @brief Configures the FFT series data structure for the dashboard.
- *
- * This function clears existing FFT values and initializes the data structure
- * for each FFT plot widget with a predefined number of samples, filling it with
- * zeros.
- *
- * @note Typically called during dashboard setup or reset to prepare FFT plot
- *       widgets for rendering.
- */
-void UI::Dashboard::configureFftSeries()
-{
-  // Clear memory
-  m_fftValues.clear();
-  m_fftValues.squeeze();
-
-  // Construct FFT plot data structure
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
-  {
-    const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    m_fftValues.append(PlotDataY());
-    m_fftValues.last().resize(dataset.fftSamples());
-    SIMD::fill<qreal>(m_fftValues.last().data(), dataset.fftSamples(), 0);
-  }
-}
-
-/**
- * @brief Configures the line series data structure for the dashboard.
- *
- * This function clears and reinitializes the X-axis and Y-axis data arrays,
- * as well as the plot values structure (`m_pltValues`). It associates each
- * dataset with its respective X and Y data, creating `LineSeries` objects
- * for plotting.
- *
- * - If a dataset specifies an X-axis source, the corresponding data is used.
- * - Otherwise, the default X-axis (based on sample points) is used.
+ * @brief Recomputes the shared sample store used by the inertial widgets.
  *
- * @note Typically called during dashboard setup or reset to prepare plot
- *       widgets for rendering.
+ * Called once per processed frame: gyroscope integration, accelerometer
+ * vector math & compass clamping are performed here at ingest time and
+ * published as plain snapshots. The gyroscope, accelerometer & compass
+ * widgets only read the published values when they repaint, so a single IMU
+ * group feeding several widgets no longer repeats the same math (or dataset
+ * copies) once per widget per update.
  */
-void UI::Dashboard::configureLineSeries()
+void UI::Dashboard::updateInertialSnapshots()
 {
-  // Clear memory
-  m_xAxisData.clear();
-  m_yAxisData.clear();
-  m_pltValues.clear();
-  m_pltValues.squeeze();
-
-  // Reset default X-axis data
-  m_pltXAxis.clear();
-  m_pltXAxis.squeeze();
-  m_pltXAxis.resize(points() + 1);
-  SIMD::fill_range<qreal>(m_pltXAxis.data(), m_pltXAxis.count(), 0);
-
-  // Construct X/Y axis data arrays
-  for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
+  // Obtain delta-T for gyroscope integration
+  const qreal deltaT
+      = qMax(qint64(1), m_gyroIntegrationTimer.elapsed()) / 1000.0;
+  m_gyroIntegrationTimer.restart();
+
+  // Integrate angular rates for each gyroscope group
+  const int gyroCount = widgetCount(SerialStudio::DashboardGyroscope);
+  for (int index = 0; index < gyroCount; ++index)
   {
-    // Obtain list of datasets for a widget type
-    const auto &datasets = i.value();
+    const auto &group = getGroupWidget(SerialStudio::DashboardGyroscope, index);
+    if (group.datasetCount() != 3)
+      continue;
 
-    // Iterate over all the datasets
-    for (auto d = datasets.begin(); d != datasets.end(); ++d)
+    auto &snapshot = m_gyroscopeSnapshots[index];
+    for (int i = 0; i < 3; ++i)
     {
-      if (d->graph())
-      {
-        // Register X-axis
-        PlotDataY yAxis;
-        m_yAxisData.insert(d->index(), yAxis);
-
-        // Register X-axis
-        if (SerialStudio::activated())
-        {
-          int xSource = d->xAxisId();
-          if (!m_xAxisData.contains(xSource))
-          {
-            PlotDataX xAxis;
-            if (m_datasets.contains(xSource))
-              m_xAxisData.insert(xSource, xAxis);
-          }
-        }
-      }
+      // Obtain dataset
+      const auto &dataset = group.getDataset(i);
+
+      // clang-format off
+      const qreal angle = dataset.numericValue();
+      const bool isYaw = (dataset.widget() == QStringLiteral("z")) ||
+                         (dataset.widget() == QStringLiteral("yaw"));
+      const bool isRoll = (dataset.widget() == QStringLiteral("y")) ||
+                          (dataset.widget() == QStringLiteral("roll"));
+      const bool isPitch = (dataset.widget() == QStringLiteral("x")) ||
+                           (dataset.widget() == QStringLiteral("pitch"));
+      // clang-format on
+
+      // Update orientation angles
+      if (isYaw)
+        snapshot.yaw += angle * deltaT;
+      else if (isRoll)
+        snapshot.roll += angle * deltaT;
+      else if (isPitch)
+        snapshot.pitch += angle * deltaT;
     }
+
+    // Normalize all angles from -180 to 180
+    auto normalize = [](qreal angle) {
+      angle = std::fmod(angle + 180.0, 360.0);
+      if (angle < 0)
+        angle += 360.0;
+
+      return angle - 180.0;
+    };
+    snapshot.yaw = normalize(snapshot.yaw);
+    snapshot.roll = normalize(snapshot.roll);
+    snapshot.pitch = normalize(snapshot.pitch);
   }
 
-  // Construct plot values structure
-  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
+  // Compute angle & magnitude for each accelerometer group
+  const int accCount = widgetCount(SerialStudio::DashboardAccelerometer);
+  for (int index = 0; index < accCount; ++index)
   {
-    // Obtain Y-axis data
-    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
-
-    // Add X-axis data & generate a line series with X/Y data
-    if (m_datasets.contains(yDataset.xAxisId()) && SerialStudio::activated())
+    const auto &group
+        = getGroupWidget(SerialStudio::DashboardAccelerometer, index);
+    if (group.datasetCount() != 3)
+      continue;
+
+    // Obtain the X & Y acceleration values
+    qreal x = 0, y = 0;
+    for (int i = 0; i < group.datasetCount(); ++i)
     {
-      const auto &xDataset = m_datasets[yDataset.xAxisId()];
-      m_xAxisData[xDataset.index()].resize(points() + 1);
-      m_yAxisData[yDataset.index()].resize(points() + 1);
-      SIMD::fill<qreal>(m_xAxisData[xDataset.index()].data(), points() + 1, 0);
-      SIMD::fill<qreal>(m_yAxisData[yDataset.index()].data(), points() + 1, 0);
-
-      LineSeries series;
-      series.x = &m_xAxisData[xDataset.index()];
-      series.y = &m_yAxisData[yDataset.index()];
-      m_pltValues.append(series);
+      const auto &dataset = group.getDataset(i);
+      if (dataset.widget() == QStringLiteral("x"))
+        x = dataset.numericValue();
+      else if (dataset.widget() == QStringLiteral("y"))
+        y = dataset.numericValue();
     }
 
-    // Only use Y-axis data, use samples/points as X-axis
-    else
-    {
-      m_yAxisData[yDataset.index()].resize(points() + 1);
-      SIMD::fill<qreal>(m_yAxisData[yDataset.index()].data(), points() + 1, 0);
+    // Calculate the magnitude & angle on the X-Y plane
+    auto &snapshot = m_accelerometerSnapshots[index];
+    snapshot.magnitude = qSqrt(qPow(x / 9.81, 2) + qPow(y / 9.81, 2));
+    snapshot.theta = qAtan2(y, x) * (180.0 / M_PI);
+  }
 
-      LineSeries series;
-      series.x = &m_pltXAxis;
-      series.y = &m_yAxisData[yDataset.index()];
-      m_pltValues.append(series);
-    }
+  // Clamp the heading angle for each compass dataset
+  const int compassCount = widgetCount(SerialStudio::DashboardCompass);
+  for (int index = 0; index < compassCount; ++index)
+  {
+    const auto &dataset
+        = getDatasetWidget(SerialStudio::DashboardCompass, index);
+    m_compassSnapshots[index]
+        = qMin(360.0, qMax(0.0, dataset.numericValue()));
   }
 }
 
 /**
- * @brief Configures the multi-line series data structure for the dashboard.
+ * @brief Updates the plot data for all dashboard widgets.
  *
- * This function initializes the data structure used for multi-plot widgets.
- * It assigns the default X-axis to all multi-line series and creates a
- * `PlotDataY` vector for each dataset in the group, initializing it with zeros.
+ * This function ensures that the data structures for FFT plots, linear plots,
+ * and multiplots are correctly initialized, then drains the pending sample
+ * queues filled by queuePlotSamples() into the fixed-size plot series. It
+ * runs at display rate (see the 24 Hz timer in the constructor). Line and
+ * multiplot series are circular buffers, so draining is at most two block
+ * copies per series no matter how many frames arrived in between.
+ */
+void UI::Dashboard::updatePlots()
+{
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("UI::Dashboard::updatePlots");
+
+  // Check if we need to re-initialize FFT plots data
+  if (m_fftValues.count() != widgetCount(SerialStudio::DashboardFFT))
+    configureFftSeries();
+
+  // Check if we need to re-initialize spectrogram data
+  if (m_spectrogramValues.count()
+      != widgetCount(SerialStudio::DashboardSpectrogram))
+    configureSpectrogramSeries();
+
+  // Check if we need to re-initialize histogram sketches
+  if (m_histogramData.count() != widgetCount(SerialStudio::DashboardHistogram))
+  {
+    m_histogramData.clear();
+    m_histogramData.resize(widgetCount(SerialStudio::DashboardHistogram));
+  }
+
+  // Check if we need to re-initialize scatter density grids
+  if (m_scatterData.count() != widgetCount(SerialStudio::DashboardScatter))
+  {
+    m_scatterData.clear();
+    m_scatterData.resize(widgetCount(SerialStudio::DashboardScatter));
+  }
+
+  // Check if we need to re-initialize linear plots data
+  if (m_pltValues.count() != widgetCount(SerialStudio::DashboardPlot))
+    configureLineSeries();
+
+  // Check if we need to re-initialize multiplot data
+  if (m_multipltValues.count() != widgetCount(SerialStudio::DashboardMultiPlot))
+    configureMultiLineSeries();
+
+  // Drain queued samples into FFT plots data
+  const int fftCount = qMin(m_fftValues.count(), m_pendingFftData.count());
+  for (int i = 0; i < fftCount; ++i)
+  {
+    shiftSamples(m_fftValues[i], m_pendingFftData[i]);
+    m_pendingFftData[i].clear();
+  }
+
+  // Drain queued samples into spectrogram data
+  const int spectrogramCount
+      = qMin(m_spectrogramValues.count(), m_pendingSpectrogramData.count());
+  for (int i = 0; i < spectrogramCount; ++i)
+  {
+    shiftSamples(m_spectrogramValues[i], m_pendingSpectrogramData[i]);
+    m_pendingSpectrogramData[i].clear();
+  }
+
+  // Drain queued samples into Y-axis data
+  for (auto it = m_pendingYAxisData.begin(); it != m_pendingYAxisData.end();
+       ++it)
+  {
+    if (m_yAxisData.contains(it.key()))
+      m_yAxisData[it.key()].append(it.value().constData(), it.value().count());
+
+    it.value().clear();
+  }
+
+  // Drain queued samples into X-axis data
+  for (auto it = m_pendingXAxisData.begin(); it != m_pendingXAxisData.end();
+       ++it)
+  {
+    if (m_xAxisData.contains(it.key()))
+      m_xAxisData[it.key()].append(it.value().constData(), it.value().count());
+
+    it.value().clear();
+  }
+
+  // Drain queued capture timestamps in lockstep with the Y-axis samples,
+  // keeping each timestamp ring aligned with the series it annotates
+  for (auto it = m_pendingTimeData.begin(); it != m_pendingTimeData.end(); ++it)
+  {
+    if (m_sampleTimes.contains(it.key()))
+      m_sampleTimes[it.key()].append(it.value().constData(),
+                                     it.value().count());
+
+    it.value().clear();
+  }
+
+  // Drain queued samples into multiplots data
+  const int multiplotCount
+      = qMin(m_multipltValues.count(), m_pendingMultiplotData.count());
+  for (int i = 0; i < multiplotCount; ++i)
+  {
+    auto &pending = m_pendingMultiplotData[i];
+    const int curves = qMin(m_multipltValues[i].y.count(), pending.count());
+    for (int j = 0; j < curves; ++j)
+    {
+      m_multipltValues[i].y[j].append(pending[j].constData(),
+                                      pending[j].count());
+      pending[j].clear();
+    }
+  }
+}
+
+/**
+ * @brief Pre-warms every plot series structure after a structural change.
+ *
+ * updatePlots() sizes the series containers lazily on the first display tick
+ * that finds them missing, which used to place the whole allocation burst —
+ * line, FFT, spectrogram & multiplot buffers for every widget — on the first
+ * frame after connecting, right when data starts flowing. This routine does
+ * the same work eagerly at the end of the structural pass, while the project
+ * loads, and spreads the independent series families over a small thread
+ * pool so a 300-channel project warms up across cores. The lazy checks in
+ * updatePlots() then find every container already sized and the first frame
+ * renders at steady-state cost.
+ *
+ * The shared X-axis ramp is filled up front on this thread: two of the
+ * tasks reference it, and with the ramp already in place each task only
+ * touches the containers of its own series family.
+ */
+void UI::Dashboard::prewarmPlotSeries()
+{
+  // Fill the shared X-axis before the tasks run
+  configureSharedXAxis();
+
+  // Independent series families, one task each
+  const std::function<void()> tasks[] = {
+      [this] { configureFftSeries(); },
+      [this] { configureSpectrogramSeries(); },
+      [this] { configureLineSeries(); },
+      [this] { configureMultiLineSeries(); },
+      [this] {
+        m_histogramData.resize(widgetCount(SerialStudio::DashboardHistogram));
+        m_scatterData.resize(widgetCount(SerialStudio::DashboardScatter));
+      },
+  };
+
+  // Distribute the tasks over a claim cursor, this thread participates
+  constexpr int taskCount = sizeof(tasks) / sizeof(tasks[0]);
+  const int threads = qMin(taskCount, QThread::idealThreadCount());
+  std::atomic<int> cursor(0);
+  auto work = [&] {
+    while (true)
+    {
+      const int i = cursor.fetch_add(1, std::memory_order_relaxed);
+      if (i >= taskCount)
+        break;
+
+      tasks[i]();
+    }
+  };
+
+  // Run serially when the pool would not help
+  if (threads < 2)
+    work();
+
+  // Spawn the helper threads & contribute to the work loop
+  else
+  {
+    QVector<QThread *> pool;
+    pool.reserve(threads - 1);
+    for (int i = 0; i < threads - 1; ++i)
+    {
+      auto *thread = QThread::create(work);
+      thread->start();
+      pool.append(thread);
+    }
+
+    work();
+    for (auto *thread : pool)
+    {
+      thread->wait();
+      delete thread;
+    }
+  }
+}
+
+/**
+ * @brief Rebuilds a transform series family, preserving unchanged widgets.
+ *
+ * Shared by the FFT & spectrogram configuration: the new layout describes
+ * each widget by its feeding dataset index & transform window, and widgets
+ * whose description also appears in the previous layout take over the old
+ * buffer — with its accumulated waveform — instead of starting from a
+ * zero-filled window. Only genuinely new (or re-sized) widgets allocate.
+ */
+static void diffTransformSeries(QVector<AlignedSeriesY> &values,
+                                QVector<QPair<int, int>> &previousLayout,
+                                const QVector<QPair<int, int>> &layout)
+{
+  QVector<AlignedSeriesY> updated;
+  updated.reserve(layout.count());
+  for (int i = 0; i < layout.count(); ++i)
+  {
+    const int previous = previousLayout.indexOf(layout[i]);
+    if (previous >= 0 && previous < values.count())
+      updated.append(values[previous]);
+
+    else
+    {
+      updated.append(AlignedSeriesY());
+      updated.last().resize(layout[i].second);
+      SIMD::fill<qreal>(updated.last().data(), layout[i].second, 0);
+    }
+  }
+
+  values = updated;
+  previousLayout = layout;
+}
+
+/**
+ * @brief Configures the FFT series data structure for the dashboard.
+ *
+ * Diffs the new widget layout against the previous one: FFT widgets whose
+ * feeding dataset & transform window are unchanged keep their accumulated
+ * sample window, so applying a project tweak that does not touch them never
+ * blanks their display. New or re-sized widgets start from zeros.
+ */
+void UI::Dashboard::configureFftSeries()
+{
+  // Describe the new layout: feeding dataset & window size per widget
+  QVector<QPair<int, int>> layout;
+  layout.reserve(widgetCount(SerialStudio::DashboardFFT));
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
+  {
+    const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
+    layout.append(qMakePair(dataset.index(), dataset.fftSamples()));
+  }
+
+  // Carry over the buffers of unchanged widgets, allocate the rest
+  diffTransformSeries(m_fftValues, m_fftLayout, layout);
+}
+
+/**
+ * @brief Configures the spectrogram series data structure for the dashboard.
+ *
+ * Same layout & diffing as the FFT series: one aligned buffer per
+ * spectrogram widget, sized to the transform window of its dataset and
+ * preserved across structural passes while its description is unchanged.
+ */
+void UI::Dashboard::configureSpectrogramSeries()
+{
+  // Describe the new layout: feeding dataset & window size per widget
+  QVector<QPair<int, int>> layout;
+  layout.reserve(widgetCount(SerialStudio::DashboardSpectrogram));
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardSpectrogram); ++i)
+  {
+    const auto &dataset
+        = getDatasetWidget(SerialStudio::DashboardSpectrogram, i);
+    layout.append(qMakePair(dataset.index(), dataset.fftSamples()));
+  }
+
+  // Carry over the buffers of unchanged widgets, allocate the rest
+  diffTransformSeries(m_spectrogramValues, m_spectrogramLayout, layout);
+}
+
+/**
+ * @brief Ensures the shared sample-index X-axis matches the point count.
+ *
+ * All line & multi-line series without an explicit X-axis source reference
+ * this single buffer, so the 0..N ramp is stored and filled exactly once no
+ * matter how many series the dashboard contains. The fill is skipped
+ * entirely when the buffer already has the right size, which makes series
+ * reconfiguration (e.g. widget count changes at a fixed point count) free
+ * of redundant X-axis work.
+ */
+void UI::Dashboard::configureSharedXAxis()
+{
+  if (m_sharedXAxis.count() == points() + 1)
+    return;
+
+  m_sharedXAxis.clear();
+  m_sharedXAxis.squeeze();
+  m_sharedXAxis.resize(points() + 1);
+  SIMD::fill_range<qreal>(m_sharedXAxis.data(), m_sharedXAxis.count(), 0);
+}
+
+/**
+ * @brief Configures the line series data structure for the dashboard.
+ *
+ * Rebuilds the plot pointer table (`m_pltValues`) and diffs the X/Y sample
+ * buffers against the new structure: series are keyed by dataset index, so
+ * a dataset that is still plotted after a project apply keeps its rolling
+ * buffer (and its capture-timestamp ring) intact, only series for removed
+ * datasets are dropped and only genuinely new ones are allocated.
+ *
+ * - If a dataset specifies an X-axis source, the corresponding data is used.
+ * - Otherwise, the default X-axis (based on sample points) is used.
  *
- * @note Typically called during dashboard setup or reset to prepare multi-plot
+ * @note Typically called during dashboard setup or reset to prepare plot
  *       widgets for rendering.
  */
-void UI::Dashboard::configureMultiLineSeries()
+void UI::Dashboard::configureLineSeries()
 {
-  // Clear data
-  m_multipltValues.clear();
-  m_multipltValues.squeeze();
+  // Rebuild the pointer table from scratch, the sample buffers are diffed
+  m_pltValues.clear();
+  m_pltValues.squeeze();
 
-  // Reset default X-axis data
-  m_multipltXAxis.clear();
-  m_multipltXAxis.squeeze();
-  m_multipltXAxis.resize(points() + 1);
-  SIMD::fill_range<qreal>(m_multipltXAxis.data(), m_multipltXAxis.count(), 0);
+  // Ensure the shared X-axis data is available
+  configureSharedXAxis();
 
-  // Construct multi-plot values structure
+  // Collect the datasets plotted by the new structure
+  QSet<int> yIndexes;
+  QSet<int> xIndexes;
+  for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
+  {
+    const auto &datasets = i.value();
+    for (auto d = datasets.begin(); d != datasets.end(); ++d)
+    {
+      if (d->graph())
+      {
+        yIndexes.insert(d->index());
+        if (SerialStudio::activated() && m_datasets.contains(d->xAxisId()))
+          xIndexes.insert(d->xAxisId());
+      }
+    }
+  }
+
+  // Drop the series of datasets that are no longer plotted; surviving keys
+  // keep their buffers, so the plots of untouched datasets do not blank
+  // when a tweaked project is applied
+  for (auto it = m_yAxisData.begin(); it != m_yAxisData.end();)
+  {
+    if (yIndexes.contains(it.key()))
+      ++it;
+    else
+      it = m_yAxisData.erase(it);
+  }
+  for (auto it = m_xAxisData.begin(); it != m_xAxisData.end();)
+  {
+    if (xIndexes.contains(it.key()))
+      ++it;
+    else
+      it = m_xAxisData.erase(it);
+  }
+  for (auto it = m_sampleTimes.begin(); it != m_sampleTimes.end();)
+  {
+    if (yIndexes.contains(it.key()))
+      ++it;
+    else
+      it = m_sampleTimes.erase(it);
+  }
+
+  // Sizes the Y-axis series & capture-timestamp ring of a dataset, leaving
+  // buffers that already have the right capacity (and their samples) alone
+  auto ensureY = [this](const int index) {
+    auto &series = m_yAxisData[index];
+    if (series.samples().count() != points() + 1)
+    {
+      series.resize(points() + 1);
+      SIMD::fill<qreal>(series.data(), points() + 1, 0);
+
+      auto &times = m_sampleTimes[index];
+      times.resize(points() + 1);
+      SIMD::fill<qreal>(times.data(), points() + 1, 0);
+    }
+  };
+
+  // Same for the X-axis series of a dataset used as an X source
+  auto ensureX = [this](const int index) {
+    auto &series = m_xAxisData[index];
+    if (series.samples().count() != points() + 1)
+    {
+      series.resize(points() + 1);
+      SIMD::fill<qreal>(series.data(), points() + 1, 0);
+    }
+  };
+
+  // Construct plot values structure
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
+  {
+    // Obtain Y-axis data
+    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
+
+    // Add X-axis data & generate a line series with X/Y data
+    if (m_datasets.contains(yDataset.xAxisId()) && SerialStudio::activated())
+    {
+      const auto &xDataset = m_datasets[yDataset.xAxisId()];
+      ensureX(xDataset.index());
+      ensureY(yDataset.index());
+
+      LineSeries series;
+      series.x = &m_xAxisData[xDataset.index()].samples();
+      series.y = &m_yAxisData[yDataset.index()].samples();
+      m_pltValues.append(series);
+    }
+
+    // Only use Y-axis data, use samples/points as X-axis
+    else
+    {
+      ensureY(yDataset.index());
+
+      LineSeries series;
+      series.x = &m_sharedXAxis;
+      series.y = &m_yAxisData[yDataset.index()].samples();
+      m_pltValues.append(series);
+    }
+  }
+}
+
+/**
+ * @brief Configures the multi-line series data structure for the dashboard.
+ *
+ * Diffs the new widget layout against the previous one: a multiplot group
+ * whose list of feeding datasets is unchanged takes over its previous
+ * rolling buffers, so applying a project tweak that does not touch it keeps
+ * its curves on screen. New or reshaped groups start from zero-filled
+ * `PlotRingY` buffers sized to the configured point count.
+ */
+void UI::Dashboard::configureMultiLineSeries()
+{
+  // Ensure the shared X-axis data is available
+  configureSharedXAxis();
+
+  // Describe the new layout: the datasets feeding each multiplot group
+  QVector<QVector<int>> layout;
+  layout.reserve(widgetCount(SerialStudio::DashboardMultiPlot));
   for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
   {
     const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+    QVector<int> indexes;
+    indexes.reserve(group.datasetCount());
+    for (int j = 0; j < group.datasetCount(); ++j)
+      indexes.append(group.datasets()[j].index());
+
+    layout.append(indexes);
+  }
+
+  // Construct multi-plot values structure, carrying over the buffers of
+  // groups whose dataset layout (and the point count) is unchanged
+  QVector<MultiLineSeries> values;
+  values.reserve(layout.count());
+  for (int i = 0; i < layout.count(); ++i)
+  {
+    const int previous = m_multiplotLayout.indexOf(layout[i]);
+    const bool sameDepth
+        = previous >= 0 && previous < m_multipltValues.count()
+          && (m_multipltValues[previous].y.isEmpty()
+              || m_multipltValues[previous].y.first().count() == points() + 1);
+    if (sameDepth)
+    {
+      values.append(m_multipltValues[previous]);
+      values.last().x = &m_sharedXAxis;
+      continue;
+    }
 
     MultiLineSeries series;
-    series.x = &m_multipltXAxis;
-    for (int j = 0; j < group.datasetCount(); ++j)
+    series.x = &m_sharedXAxis;
+    for (int j = 0; j < layout[i].count(); ++j)
     {
-      series.y.append(PlotDataY());
+      series.y.append(PlotRingY());
       series.y.last().resize(points() + 1);
       SIMD::fill<qreal>(series.y.last().data(), points() + 1, 0);
     }
 
-    m_multipltValues.append(series);
+    values.append(series);
   }
+
+  m_multipltValues = values;
+  m_multiplotLayout = layout;
 }
 
 /**
@@ -902,14 +1876,49 @@ void UI::Dashboard::configureMultiLineSeries()
  * - Calls `updatePlots()` to ensure plotting data aligns with the new frame.
  * - Notifies the application about the updated frame.
  *
- * @param frame The new JSON::Frame to process for the dashboard.
+ * @param framePtr Shared pointer to the new JSON::Frame to process.
  */
-void UI::Dashboard::processFrame(const JSON::Frame &frame)
+void UI::Dashboard::processFrame(const std::shared_ptr<JSON::Frame> &framePtr)
 {
   // Validate frame
+  if (!framePtr)
+    return;
+
+  // Obtain a reference to the shared frame
+  const JSON::Frame &frame = *framePtr;
   if (!frame.isValid() || !streamAvailable())
     return;
 
+  // Attribute heap allocations to the rendering stage while diagnosing
+  Misc::AllocationTracker::Scope allocScope(
+      Misc::AllocationTracker::Rendering);
+
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("UI::Dashboard::processFrame");
+
+  // Remember when the frame feeding this pass was captured; every plot
+  // sample queued below is stamped with it so the cursor engine can map
+  // positions back to capture time
+  m_latestRxTime = qreal(frame.rxTimestamp());
+
+  // Values-only fast path: the group/dataset tree shape is unchanged since
+  // the previous frame, so skip the widget map rebuild entirely. Per frame,
+  // only the dataset registry is refreshed and the plot samples appended —
+  // fan-out of the latest values into the widget-model copies is coalesced
+  // into the display tick, so that cost scales with display Hz, not input Hz
+  if (frame.structureRevision() != 0
+      && frame.structureRevision() == m_frameRevision)
+  {
+    updateDatasetRegistry(frame);
+    m_updateRequired = true;
+    m_valueUpdateRequired = true;
+    queuePlotSamples(frame.updatedIndexes());
+    return;
+  }
+
+  // Remember the structure revision processed by the full pass below
+  m_frameRevision = frame.structureRevision();
+
   // Check if we can use commercial features
   bool usedCommercialFeatures = m_currentFrame.containsCommercialFeatures();
 #ifdef USE_QT_COMMERCIAL
@@ -930,6 +1939,7 @@ void UI::Dashboard::processFrame(const JSON::Frame &frame)
   // Copy frame data & set update required flag to true
   m_currentFrame = frame;
   m_updateRequired = true;
+  m_valueUpdateRequired = true;
 
   // Add terminal group
   if (terminalEnabled())
@@ -1080,16 +2090,691 @@ void UI::Dashboard::processFrame(const JSON::Frame &frame)
       }
     }
 
-    // Clear plot data setup
-    m_fftValues.clear();
-    m_pltValues.clear();
+    // Drop the 3D series, they are keyed by widget order only; every other
+    // series family is diffed against the previous layout by the configure
+    // routines in prewarmPlotSeries(), so widgets that survive the
+    // structural change keep their accumulated samples on screen
     m_plotData3D.clear();
-    m_multipltValues.clear();
+    m_plotData3DTotal.clear();
+
+    // Discard the order-keyed sample queues filled against the previous
+    // structure; the X/Y/timestamp queues are keyed by dataset index and
+    // remain valid across the rebuild
+    m_pendingFftData.clear();
+    m_pendingMultiplotData.clear();
+    m_pendingSpectrogramData.clear();
 
     // Update user interface
     Q_EMIT widgetCountChanged();
+
+    // Rebuild every series structure now, while the project is loading,
+    // instead of lazily on the first display tick that carries data
+    prewarmPlotSeries();
+  }
+
+  // Queue plot samples, drained at display rate by updatePlots()
+  queuePlotSamples();
+
+  // Publish the shared samples consumed by the inertial widgets
+  updateInertialSnapshots();
+
+  // Hand the ingest thread a routing table matching the new structure
+  pushSampleRouting();
+}
+
+/**
+ * @brief Builds the sample routing table & hands it to the ingest thread.
+ *
+ * Called at the end of every full structural pass: the table maps each
+ * plotted series to the dataset index that feeds it, plus the current
+ * numeric value of every dataset so the ingest thread can route samples for
+ * datasets that do not change on every frame. Once the table arrives on the
+ * ingest thread, frames carrying the matching structure revision are
+ * processed there without ever touching the GUI thread.
+ */
+void UI::Dashboard::pushSampleRouting()
+{
+  SampleRouting routing;
+  routing.revision = m_frameRevision;
+
+  // Map each FFT widget to its dataset
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
+    routing.fft.append(getDatasetWidget(SerialStudio::DashboardFFT, i).index());
+
+  // Map each spectrogram widget to its dataset
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardSpectrogram); ++i)
+    routing.spectrogram.append(
+        getDatasetWidget(SerialStudio::DashboardSpectrogram, i).index());
+
+  // Map each histogram widget to its dataset
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardHistogram); ++i)
+    routing.histogram.append(
+        getDatasetWidget(SerialStudio::DashboardHistogram, i).index());
+
+  // Map each scatter widget to its X-axis source & Y-axis dataset; widgets
+  // without a valid X-axis source stay parked until one is configured
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardScatter); ++i)
+  {
+    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardScatter, i);
+    const auto xAxisId = SerialStudio::activated() ? yDataset.xAxisId() : 0;
+    std::array<int, 2> axes
+        = {m_datasets.contains(xAxisId) ? xAxisId : -1, yDataset.index()};
+    routing.scatter.append(axes);
+  }
+
+  // Map each plot to its Y-axis dataset & optional X-axis source; pairs are
+  // routed together so a sparse update appends the X & Y samples of a series
+  // in lockstep (or neither), keeping the rolling buffers aligned
+  QSet<int> yAxes;
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
+  {
+    const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
+    if (yAxes.contains(yDataset.index()))
+      continue;
+
+    yAxes.insert(yDataset.index());
+    const auto xAxisId = SerialStudio::activated() ? yDataset.xAxisId() : 0;
+    std::array<int, 2> axes
+        = {m_datasets.contains(xAxisId) ? xAxisId : -1, yDataset.index()};
+    routing.plots.append(axes);
+  }
+
+  // Map each multiplot curve to its dataset
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
+  {
+    const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+    QVector<int> indexes;
+    indexes.reserve(group.datasetCount());
+    for (int j = 0; j < group.datasetCount(); ++j)
+      indexes.append(group.datasets()[j].index());
+
+    routing.multiplot.append(indexes);
+  }
+
+// Map each 3D plot to its X/Y/Z datasets
+#ifdef USE_QT_COMMERCIAL
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot3D); ++i)
+  {
+    const auto &group = getGroupWidget(SerialStudio::DashboardPlot3D, i);
+    std::array<int, 3> axes = {-1, -1, -1};
+    for (int j = 0; j < group.datasetCount(); ++j)
+    {
+      const auto &dataset = group.datasets()[j];
+      if (dataset.widget().toLower() == "x")
+        axes[0] = dataset.index();
+      else if (dataset.widget().toLower() == "y")
+        axes[1] = dataset.index();
+      else if (dataset.widget().toLower() == "z")
+        axes[2] = dataset.index();
+    }
+
+    routing.plot3d.append(axes);
+  }
+#endif
+
+  // Seed the ingest registry with the current value of every dataset
+  for (auto it = m_datasets.cbegin(); it != m_datasets.cend(); ++it)
+    routing.initialValues.insert(it.key(), it->numericValue());
+
+  // Deliver the table on the ingest thread
+  auto *ingest = m_ingest;
+  QMetaObject::invokeMethod(
+      ingest, [ingest, routing] { ingest->configureRouting(routing); },
+      Qt::QueuedConnection);
+}
+
+/**
+ * @brief Merges the published ingest snapshot into the GUI-side structures.
+ *
+ * Called from the display-rate timers: takes the snapshot published by the
+ * ingest thread (if any), folds its coalesced values into the dataset
+ * registry and appends its sample queues to the pending buffers drained by
+ * updatePlots(). Returns @c true when a snapshot was consumed.
+ */
+bool UI::Dashboard::consumeIngestSnapshot()
+{
+  auto *snapshot = m_ingest->takeSnapshot();
+  if (!snapshot)
+    return false;
+
+  // Fold the coalesced values into the dataset registry
+  for (auto it = snapshot->values.cbegin(); it != snapshot->values.cend();
+       ++it)
+  {
+    const auto dataset = m_datasets.find(it.key());
+    if (dataset != m_datasets.end())
+      dataset->setValue(it->first, it->second);
+  }
+
+  // Widget-model copies must be refreshed before the update signals fire
+  if (!snapshot->values.isEmpty())
+    m_widgetValuesStale = true;
+
+  // Append the queued FFT samples
+  if (m_pendingFftData.count() != snapshot->fft.count())
+  {
+    m_pendingFftData.clear();
+    m_pendingFftData.resize(snapshot->fft.count());
+  }
+
+  for (int i = 0; i < snapshot->fft.count(); ++i)
+    m_pendingFftData[i].append(snapshot->fft[i]);
+
+  // Append the queued spectrogram samples
+  if (m_pendingSpectrogramData.count() != snapshot->spectrogram.count())
+  {
+    m_pendingSpectrogramData.clear();
+    m_pendingSpectrogramData.resize(snapshot->spectrogram.count());
+  }
+
+  for (int i = 0; i < snapshot->spectrogram.count(); ++i)
+    m_pendingSpectrogramData[i].append(snapshot->spectrogram[i]);
+
+  // Replace the histogram sketches (cumulative state, the latest copy wins);
+  // snapshots published against a stale structure are ignored
+  if (snapshot->histogram.count()
+      == widgetCount(SerialStudio::DashboardHistogram))
+    m_histogramData = snapshot->histogram;
+
+  // Replace the scatter density grids (cumulative state, the latest copy
+  // wins); snapshots published against a stale structure are ignored
+  if (snapshot->scatter.count() == widgetCount(SerialStudio::DashboardScatter))
+    m_scatterData = snapshot->scatter;
+
+  // Append the queued X/Y axis samples
+  for (auto it = snapshot->yAxis.cbegin(); it != snapshot->yAxis.cend(); ++it)
+    m_pendingYAxisData[it.key()].append(it.value());
+  for (auto it = snapshot->xAxis.cbegin(); it != snapshot->xAxis.cend(); ++it)
+    m_pendingXAxisData[it.key()].append(it.value());
+
+  // Append the queued capture timestamps
+  for (auto it = snapshot->sampleTimes.cbegin();
+       it != snapshot->sampleTimes.cend(); ++it)
+    m_pendingTimeData[it.key()].append(it.value());
+
+  // Append the queued multiplot samples
+  if (m_pendingMultiplotData.count() != snapshot->multiplot.count())
+  {
+    m_pendingMultiplotData.clear();
+    m_pendingMultiplotData.resize(snapshot->multiplot.count());
+  }
+
+  for (int i = 0; i < snapshot->multiplot.count(); ++i)
+  {
+    auto &pending = m_pendingMultiplotData[i];
+    const auto &curves = snapshot->multiplot[i];
+    if (pending.count() != curves.count())
+    {
+      pending.clear();
+      pending.resize(curves.count());
+    }
+
+    for (int j = 0; j < curves.count(); ++j)
+      pending[j].append(curves[j]);
+  }
+
+// Append the queued 3D points & trim the series to the configured depth
+#ifdef USE_QT_COMMERCIAL
+  if (m_plotData3D.count() != snapshot->points3d.count())
+  {
+    m_plotData3D.clear();
+    m_plotData3D.squeeze();
+    m_plotData3D.resize(snapshot->points3d.count());
+
+    m_plotData3DTotal.clear();
+    m_plotData3DTotal.resize(m_plotData3D.count());
+  }
+
+  for (int i = 0; i < snapshot->points3d.count(); ++i)
+  {
+    auto &plotData = m_plotData3D[i];
+    plotData.append(snapshot->points3d[i]);
+    m_plotData3DTotal[i] += quint64(snapshot->points3d[i].count());
+    if (plotData.count() > points())
+      plotData.remove(0, plotData.count() - points());
+  }
+#endif
+
+  // Return the buffer to the ingest thread
+  m_ingest->releaseSnapshot(snapshot);
+  return true;
+}
+
+/**
+ * @brief Propagates new dataset values into the dashboard's value registry.
+ *
+ * Used by the values-only fast path of processFrame(): the widget maps built
+ * during the last full pass are kept as-is and only the values of the
+ * datasets reported as updated by the frame builder are copied into the
+ * dataset registry. This is the only per-frame copy; the per-widget
+ * group/dataset copies are refreshed from the registry at display rate by
+ * syncWidgetModelValues(), so receiving frames faster than the screen
+ * refreshes does not multiply the model update cost.
+ *
+ * @param frame The new frame, structurally identical to the current one.
+ */
+void UI::Dashboard::updateDatasetRegistry(const JSON::Frame &frame)
+{
+  // Collect the new values, filtered to the indexes the frame refreshed
+  // (an empty updated set means every dataset must be refreshed)
+  const auto &updated = frame.updatedIndexes();
+  QHash<int, const JSON::Dataset *> values;
+  for (const auto &group : frame.groups())
+  {
+    for (const auto &dataset : group.datasets())
+    {
+      if (updated.isEmpty() || updated.contains(dataset.index()))
+        values.insert(dataset.index(), &dataset);
+    }
+  }
+
+  // No dataset changed, nothing to propagate
+  if (values.isEmpty())
+    return;
+
+  // Update the dataset registry
+  for (auto it = m_datasets.begin(); it != m_datasets.end(); ++it)
+  {
+    const auto value = values.constFind(it.key());
+    if (value != values.constEnd())
+      it->setValue((*value)->value(), (*value)->numericValue());
+  }
+
+  // Mark the widget-model copies as stale for the next display tick
+  m_widgetValuesStale = true;
+}
+
+/**
+ * @brief Fans the latest registry values out to the widget-model copies.
+ *
+ * Called from the display-rate timers right before the dashboard emits its
+ * update signals: the current frame copy and the per-widget group/dataset
+ * copies are refreshed from the dataset registry, regardless of how many
+ * frames were coalesced into the registry since the previous tick. Widgets
+ * whose datasets did not change keep their previous values and skip
+ * repainting.
+ *
+ * Each group copy is a task writing to its own disjoint store, so on large
+ * projects the fan-out is split across one worker per core: the workers claim
+ * tasks from a shared atomic cursor (idle cores drain the queue of whichever
+ * tasks remain) and are joined before the update signals fire. Small models
+ * run serially, where the loop is cheaper than starting threads.
+ */
+void UI::Dashboard::syncWidgetModelValues()
+{
+  // Registry unchanged since the last fan-out, nothing to do
+  if (!m_widgetValuesStale)
+    return;
+
+  // Copies the registry value into a dataset tracked by a widget model
+  const auto update = [this](JSON::Dataset &dataset) {
+    const auto it = m_datasets.constFind(dataset.index());
+    if (it != m_datasets.cend())
+      dataset.setValue(it->value(), it->numericValue());
+  };
+
+  // Build one task per group-sized unit, each writing to a disjoint store
+  QVector<std::function<void()>> tasks;
+  tasks.reserve(m_currentFrame.groupCount() * 2 + m_widgetDatasets.count());
+  for (auto &group : m_currentFrame.m_groups)
+  {
+    tasks.append([&group, &update] {
+      for (auto &dataset : group.m_datasets)
+        update(dataset);
+    });
+  }
+
+  // One task per group copy held by the group widgets (LED panel included)
+  for (auto &groups : m_widgetGroups)
+  {
+    for (auto &group : groups)
+    {
+      tasks.append([&group, &update] {
+        for (auto &dataset : group.m_datasets)
+          update(dataset);
+      });
+    }
+  }
+
+  // One task per widget type for the per-widget dataset copies
+  for (auto &datasets : m_widgetDatasets)
+  {
+    tasks.append([&datasets, &update] {
+      for (auto &dataset : datasets)
+        update(dataset);
+    });
+  }
+
+  // Workers claim tasks from a shared cursor until the queue is drained
+  std::atomic<int> cursor(0);
+  const auto work = [&cursor, &tasks] {
+    int i;
+    while ((i = cursor.fetch_add(1, std::memory_order_relaxed))
+           < tasks.count())
+      tasks[i]();
+  };
+
+  // Run serially when the model is small or only one core is available
+  const int threads = qBound(1, QThread::idealThreadCount(), tasks.count());
+  if (threads < 2 || m_datasets.count() < 128)
+    work();
+
+  // Split the fan-out across the cores, this thread claims tasks too
+  else
+  {
+    QVector<QThread *> workers;
+    workers.reserve(threads - 1);
+    for (int t = 0; t < threads - 1; ++t)
+    {
+      workers.append(QThread::create(work));
+      workers.last()->start();
+    }
+
+    work();
+
+    // Join every worker before the update signals fire
+    for (auto *worker : workers)
+    {
+      worker->wait();
+      delete worker;
+    }
+  }
+
+  // Copies are in sync with the registry again
+  m_widgetValuesStale = false;
+}
+
+//------------------------------------------------------------------------------
+// UI::DashboardIngest implementation
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes the snapshot hand-off slots.
+ *
+ * One buffer starts as the ingest-side back buffer, the other waits in the
+ * spare slot; the exchange slot starts empty. The invariant maintained by
+ * publish(), takeSnapshot() and releaseSnapshot() is that exactly one buffer
+ * is always writable by the ingest thread, while the other is either
+ * published, being merged by the GUI thread, or parked in the spare slot.
+ */
+UI::DashboardIngest::DashboardIngest()
+  : m_back(&m_buffers[0])
+  , m_middle(nullptr)
+  , m_spare(&m_buffers[1])
+  , m_wake(false)
+  , m_mailbox(256, Misc::BoundedQueue<std::shared_ptr<JSON::Frame>>::
+                       Policy::DropOldest)
+{
+}
+
+/**
+ * @brief Accepts a published frame from the publisher's thread.
+ *
+ * The frame lands in a bounded drop-oldest mailbox instead of one queued
+ * slot invocation per frame, so a publisher that outruns the ingest thread
+ * sheds the stalest frames (counted by droppedFrames()) instead of growing
+ * the event queue without bound. The ingest thread is only woken when no
+ * wake-up is already in flight, mirroring the coalescing scheme used by
+ * IO::FrameReader::ingestData().
+ */
+void UI::DashboardIngest::enqueue(const std::shared_ptr<JSON::Frame> &frame)
+{
+  m_mailbox.push(frame);
+  if (!m_wake.exchange(true, std::memory_order_acq_rel))
+    QMetaObject::invokeMethod(this, &DashboardIngest::drainMailbox,
+                              Qt::QueuedConnection);
+}
+
+/**
+ * @brief Returns the number of frames shed by the ingest mailbox.
+ */
+quint64 UI::DashboardIngest::droppedFrames() const
+{
+  return m_mailbox.droppedItems();
+}
+
+/**
+ * @brief Processes every frame queued by enqueue() since the previous wake.
+ */
+void UI::DashboardIngest::drainMailbox()
+{
+  m_wake.store(false, std::memory_order_release);
+  const auto frames = m_mailbox.popAll();
+  for (const auto &frame : frames)
+    ingest(frame);
+}
+
+/**
+ * @brief Takes the published snapshot, or returns @c nullptr when the ingest
+ *        thread has not published since the last take.
+ *
+ * Called from the GUI thread; the returned buffer must be handed back with
+ * releaseSnapshot() once merged.
+ */
+UI::DashboardSnapshot *UI::DashboardIngest::takeSnapshot()
+{
+  return m_middle.exchange(nullptr, std::memory_order_acquire);
+}
+
+/**
+ * @brief Returns a consumed snapshot to the ingest thread.
+ */
+void UI::DashboardIngest::releaseSnapshot(DashboardSnapshot *snapshot)
+{
+  snapshot->clear();
+  m_spare.store(snapshot, std::memory_order_release);
+}
+
+/**
+ * @brief Drops the routing table & accumulated state.
+ *
+ * Runs on the ingest thread; with a zeroed routing revision every subsequent
+ * frame is forwarded to the GUI thread until a fresh table arrives from the
+ * next structural pass.
+ */
+void UI::DashboardIngest::reset()
+{
+  m_routing = SampleRouting();
+  m_values.clear();
+  m_histograms.clear();
+  m_scatterGrids.clear();
+  m_back->clear();
+}
+
+/**
+ * @brief Installs the routing table built by the dashboard & seeds the
+ *        numeric registry with the current value of every dataset.
+ */
+void UI::DashboardIngest::configureRouting(const UI::SampleRouting &routing)
+{
+  m_routing = routing;
+  m_values = routing.initialValues;
+
+  // Histogram sketches accumulate across frames, only restart them when the
+  // set of histogram widgets changed
+  if (m_histograms.count() != routing.histogram.count())
+  {
+    m_histograms.clear();
+    m_histograms.resize(routing.histogram.count());
+  }
+
+  // Same for the scatter density grids
+  if (m_scatterGrids.count() != routing.scatter.count())
+  {
+    m_scatterGrids.clear();
+    m_scatterGrids.resize(routing.scatter.count());
   }
+}
+
+/**
+ * @brief Processes one published frame on the ingest thread.
+ *
+ * Frames whose structure does not match the routing table are forwarded to
+ * the GUI thread for a full widget rebuild. Matching frames are folded into
+ * the back buffer: updated values coalesce into the value hash and one
+ * sample is appended per routed series whose dataset the frame refreshed,
+ * then the buffer is offered to the GUI thread through publish().
+ */
+void UI::DashboardIngest::ingest(const std::shared_ptr<JSON::Frame> &frame)
+{
+  // Structural change (or no routing yet): rebuild on the GUI thread, which
+  // pushes a fresh routing table back to this thread once done
+  if (!frame || m_routing.revision == 0
+      || frame->structureRevision() != m_routing.revision)
+  {
+    Q_EMIT structuralFrame(frame);
+    return;
+  }
+
+  // Fold the values the frame carries a fresh reading for into the registry
+  // & the back buffer. Sparse frames only refresh a subset of the datasets;
+  // the rest keep their last-known value and their series do not advance,
+  // so every series runs at the native rate of its source
+  const auto &updated = frame->updatedIndexes();
+  const auto isUpdated = [&updated](const int index) {
+    return updated.isEmpty() || updated.contains(index);
+  };
+  for (const auto &group : frame->groups())
+  {
+    for (const auto &dataset : group.datasets())
+    {
+      if (isUpdated(dataset.index()))
+      {
+        m_values[dataset.index()] = dataset.numericValue();
+        m_back->values[dataset.index()]
+            = qMakePair(dataset.value(), dataset.numericValue());
+      }
+    }
+  }
+
+  // Append one sample per updated FFT widget
+  if (m_back->fft.count() != m_routing.fft.count())
+    m_back->fft.resize(m_routing.fft.count());
+  for (int i = 0; i < m_routing.fft.count(); ++i)
+  {
+    if (isUpdated(m_routing.fft[i]))
+      m_back->fft[i].append(m_values.value(m_routing.fft[i]));
+  }
+
+  // Append one sample per updated spectrogram widget
+  if (m_back->spectrogram.count() != m_routing.spectrogram.count())
+    m_back->spectrogram.resize(m_routing.spectrogram.count());
+  for (int i = 0; i < m_routing.spectrogram.count(); ++i)
+  {
+    if (isUpdated(m_routing.spectrogram[i]))
+      m_back->spectrogram[i].append(m_values.value(m_routing.spectrogram[i]));
+  }
+
+  // Fold one sample per updated histogram widget into its quantile sketch &
+  // hand a copy of the accumulated sketches to the GUI thread
+  for (int i = 0; i < m_routing.histogram.count(); ++i)
+  {
+    if (isUpdated(m_routing.histogram[i]))
+      m_histograms[i].insert(m_values.value(m_routing.histogram[i]));
+  }
+  m_back->histogram = m_histograms;
+
+  // Fold one sample pair per scatter widget into its density grid when either
+  // axis was refreshed; grids are only attached to the snapshot in publish(),
+  // because detaching the bin counters on every frame would copy the full
+  // grid at the frame rate
+  for (int i = 0; i < m_routing.scatter.count(); ++i)
+  {
+    const auto &axes = m_routing.scatter[i];
+    if (axes[0] >= 0 && (isUpdated(axes[0]) || isUpdated(axes[1])))
+      m_scatterGrids[i].insert(m_values.value(axes[0]),
+                               m_values.value(axes[1]));
+  }
+
+  // Append one sample pair per updated plot. A pair fires when either of
+  // its datasets was refreshed, and then appends to both of its rolling
+  // buffers (the stale axis repeats its last-known value), so the X & Y
+  // series of a plot always stay the same length
+  QSet<int> xQueued;
+  QSet<int> yQueued;
+  const qreal rxTime = qreal(frame->rxTimestamp());
+  for (const auto &axes : std::as_const(m_routing.plots))
+  {
+    const bool fire = isUpdated(axes[1]) || (axes[0] >= 0 && isUpdated(axes[0]));
+    if (!fire)
+      continue;
+
+    if (!yQueued.contains(axes[1]))
+    {
+      yQueued.insert(axes[1]);
+      m_back->yAxis[axes[1]].append(m_values.value(axes[1]));
+      m_back->sampleTimes[axes[1]].append(rxTime);
+    }
+
+    if (axes[0] >= 0 && !xQueued.contains(axes[0]))
+    {
+      xQueued.insert(axes[0]);
+      m_back->xAxis[axes[0]].append(m_values.value(axes[0]));
+    }
+  }
+
+  // Append one sample per updated multiplot curve
+  if (m_back->multiplot.count() != m_routing.multiplot.count())
+    m_back->multiplot.resize(m_routing.multiplot.count());
+  for (int i = 0; i < m_routing.multiplot.count(); ++i)
+  {
+    const auto &indexes = m_routing.multiplot[i];
+    auto &curves = m_back->multiplot[i];
+    if (curves.count() != indexes.count())
+      curves.resize(indexes.count());
+
+    for (int j = 0; j < indexes.count(); ++j)
+    {
+      if (isUpdated(indexes[j]))
+        curves[j].append(m_values.value(indexes[j]));
+    }
+  }
+
+// Append one point per 3D plot when any of its axes was refreshed
+#ifdef USE_QT_COMMERCIAL
+  if (m_back->points3d.count() != m_routing.plot3d.count())
+    m_back->points3d.resize(m_routing.plot3d.count());
+  for (int i = 0; i < m_routing.plot3d.count(); ++i)
+  {
+    const auto &axes = m_routing.plot3d[i];
+    if (!isUpdated(axes[0]) && !isUpdated(axes[1]) && !isUpdated(axes[2]))
+      continue;
+
+    QVector3D point;
+    point.setX(m_values.value(axes[0]));
+    point.setY(m_values.value(axes[1]));
+    point.setZ(m_values.value(axes[2]));
+    m_back->points3d[i].append(point);
+  }
+#endif
+
+  // Offer the accumulated state to the GUI thread
+  publish();
+}
+
+/**
+ * @brief Publishes the back buffer through the atomic exchange slot.
+ *
+ * When the GUI thread has not yet consumed the previously published
+ * snapshot, or is merging one right now, the back buffer simply keeps
+ * accumulating (values coalesce, samples append) and the publish is retried
+ * after the next frame — neither thread ever blocks and no sample is lost.
+ */
+void UI::DashboardIngest::publish()
+{
+  // Previous snapshot not consumed yet, keep accumulating
+  if (m_middle.load(std::memory_order_relaxed) != nullptr)
+    return;
+
+  // The spare slot is empty while the GUI thread merges a snapshot
+  auto *replacement = m_spare.exchange(nullptr, std::memory_order_acquire);
+  if (!replacement)
+    return;
+
+  // The handoff is going through, attach a copy of the accumulated scatter
+  // grids; doing this lazily bounds the copy rate by the display rate
+  m_back->scatter = m_scatterGrids;
 
-  // Update plot data
-  updatePlots();
+  m_middle.store(m_back, std::memory_order_release);
+  m_back = replacement;
 }
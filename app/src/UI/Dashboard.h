@@ -1,174 +1,386 @@
-/*
- * Serial Studio - https://serial-studio.github.io/
- *
- * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program. If not, see <https://www.gnu.org/licenses/>.
- *
- * SPDX-License-Identifier: GPL-3.0-or-later
- */
-
-#pragma once
-
-#include <QFont>
-#include <QObject>
-
-#include "JSON/Frame.h"
-#include "SerialStudio.h"
-
-// clang-format off
-#define GET_GROUP(type, index) UI::Dashboard::instance().getGroupWidget(type, index)
-#define GET_DATASET(type, index) UI::Dashboard::instance().getDatasetWidget(type, index)
-#define VALIDATE_WIDGET(type, index) (index >= 0 && index < UI::Dashboard::instance().widgetCount(type))
-// clang-format on
-
-namespace UI
-{
-
-/**
- * @class UI::Dashboard
- * @brief Real-time dashboard manager for displaying data-driven widgets.
- *
- * The `Dashboard` class creates and maintains the model used for generating a
- * dashboard user interface, updating various widgets such as plots, multiplots,
- * and status indicators based on JSON frame data.
- *
- * Updates occur at a maximum rate of 20 Hz for optimal performance. It manages
- * real-time data for different plot types (linear, FFT, multiplot) and supports
- * actions that can be triggered from the UI.
- *
- * Properties notify changes to dynamically adjust UI elements like widget
- * visibility and count.
- *
- * @note This class is implemented as a singleton and is non-copyable and
- *       non-movable.
- */
-class Dashboard : public QObject
-{
-  // clang-format off
-  Q_OBJECT
-  Q_PROPERTY(QString title READ title NOTIFY widgetCountChanged)
-  Q_PROPERTY(bool available READ available NOTIFY widgetCountChanged)
-  Q_PROPERTY(int actionCount READ actionCount NOTIFY actionCountChanged)
-  Q_PROPERTY(QVariantList actions READ actions NOTIFY actionCountChanged)
-  Q_PROPERTY(int points READ points WRITE setPoints NOTIFY pointsChanged)
-  Q_PROPERTY(int totalWidgetCount READ totalWidgetCount NOTIFY widgetCountChanged)
-  Q_PROPERTY(int precision READ precision WRITE setPrecision NOTIFY precisionChanged)
-  Q_PROPERTY(bool pointsWidgetVisible READ pointsWidgetVisible NOTIFY widgetCountChanged)
-  Q_PROPERTY(bool precisionWidgetVisible READ precisionWidgetVisible NOTIFY widgetCountChanged)
-  Q_PROPERTY(bool terminalEnabled READ terminalEnabled WRITE setTerminalEnabled NOTIFY terminalEnabledChanged)
-  Q_PROPERTY(bool containsCommercialFeatures READ containsCommercialFeatures NOTIFY containsCommercialFeaturesChanged)
-  // clang-format on
-
-signals:
-  void updated();
-  void dataReset();
-  void pointsChanged();
-  void precisionChanged();
-  void actionCountChanged();
-  void widgetCountChanged();
-  void terminalEnabledChanged();
-  void containsCommercialFeaturesChanged();
-
-private:
-  explicit Dashboard();
-  Dashboard(Dashboard &&) = delete;
-  Dashboard(const Dashboard &) = delete;
-  Dashboard &operator=(Dashboard &&) = delete;
-  Dashboard &operator=(const Dashboard &) = delete;
-
-public:
-  static Dashboard &instance();
-  static qreal smartInterval(const qreal min, const qreal max,
-                             const qreal multiplier = 0.2);
-
-  [[nodiscard]] bool available() const;
-  [[nodiscard]] bool streamAvailable() const;
-  [[nodiscard]] bool terminalEnabled() const;
-  [[nodiscard]] bool pointsWidgetVisible() const;
-  [[nodiscard]] bool precisionWidgetVisible() const;
-  [[nodiscard]] bool containsCommercialFeatures() const;
-
-  [[nodiscard]] int points() const;
-  [[nodiscard]] int precision() const;
-  [[nodiscard]] int actionCount() const;
-  [[nodiscard]] int totalWidgetCount() const;
-
-  Q_INVOKABLE bool frameValid() const;
-  Q_INVOKABLE int relativeIndex(const int widgetIndex);
-  Q_INVOKABLE SerialStudio::DashboardWidget widgetType(const int widgetIndex);
-  Q_INVOKABLE int widgetCount(const SerialStudio::DashboardWidget widget) const;
-
-  [[nodiscard]] const QString &title() const;
-  [[nodiscard]] QVariantList actions() const;
-  [[nodiscard]] const SerialStudio::WidgetMap &widgetMap() const;
-
-  // clang-format off
-  [[nodiscard]] const QMap<int, JSON::Dataset> &datasets() const;
-  [[nodiscard]] const JSON::Group &getGroupWidget(const SerialStudio::DashboardWidget widget, const int index) const;
-  [[nodiscard]] const JSON::Dataset &getDatasetWidget(const SerialStudio::DashboardWidget widget, const int index) const;
-  // clang-format on
-
-  [[nodiscard]] const JSON::Frame &currentFrame();
-  [[nodiscard]] const PlotDataY &fftData(const int index) const;
-  [[nodiscard]] const LineSeries &plotData(const int index) const;
-  [[nodiscard]] const MultiLineSeries &multiplotData(const int index) const;
-
-#ifdef USE_QT_COMMERCIAL
-  [[nodiscard]] const PlotData3D &plotData3D(const int index) const;
-#endif
-
-public slots:
-  void setPoints(const int points);
-  void activateAction(const int index);
-  void setPrecision(const int precision);
-  void resetData(const bool notify = true);
-  void setTerminalEnabled(const bool enabled);
-
-private slots:
-  void updatePlots();
-  void configureFftSeries();
-  void configureLineSeries();
-  void configureMultiLineSeries();
-  void processFrame(const JSON::Frame &frame);
-
-private:
-  int m_points;
-  int m_precision;
-  int m_widgetCount;
-  bool m_updateRequired;
-  bool m_terminalEnabled;
-
-  PlotDataX m_pltXAxis;
-  PlotDataX m_multipltXAxis;
-  QMap<int, PlotDataX> m_xAxisData;
-  QMap<int, PlotDataY> m_yAxisData;
-
-  QVector<PlotDataY> m_fftValues;
-  QVector<LineSeries> m_pltValues;
-  QVector<MultiLineSeries> m_multipltValues;
-
-#ifdef USE_QT_COMMERCIAL
-  QVector<PlotData3D> m_plotData3D;
-#endif
-
-  QVector<JSON::Action> m_actions;
-  QMap<int, JSON::Dataset> m_datasets;
-  SerialStudio::WidgetMap m_widgetMap;
-  QMap<SerialStudio::DashboardWidget, QVector<JSON::Group>> m_widgetGroups;
-  QMap<SerialStudio::DashboardWidget, QVector<JSON::Dataset>> m_widgetDatasets;
-
-  JSON::Frame m_currentFrame;
-};
-} // namespace UI
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include <QFont>
+#include <QObject>
+#include <QThread>
+#include <QElapsedTimer>
+
+#include "JSON/Frame.h"
+#include "SerialStudio.h"
+#include "DensityGrid.h"
+#include "QuantileSketch.h"
+#include "Misc/BoundedQueue.h"
+
+// clang-format off
+#define GET_GROUP(type, index) UI::Dashboard::instance().getGroupWidget(type, index)
+#define GET_DATASET(type, index) UI::Dashboard::instance().getDatasetWidget(type, index)
+#define VALIDATE_WIDGET(type, index) (index >= 0 && index < UI::Dashboard::instance().widgetCount(type))
+// clang-format on
+
+namespace UI
+{
+
+/**
+ * @brief Orientation state shared by the inertial widgets.
+ *
+ * Published by the dashboard once per processed frame, so that every
+ * gyroscope widget fed by the same IMU group reads the same integrated
+ * angles instead of repeating the integration on its own.
+ */
+struct GyroscopeSnapshot
+{
+  qreal yaw = 0;
+  qreal roll = 0;
+  qreal pitch = 0;
+};
+
+/**
+ * @brief Acceleration state shared by the inertial widgets.
+ */
+struct AccelerometerSnapshot
+{
+  qreal theta = 0;
+  qreal magnitude = 0;
+};
+
+/**
+ * @brief Describes which dataset feeds each plotted sample queue.
+ *
+ * Built by the dashboard on the GUI thread after every structural pass and
+ * handed to the ingest thread, so that samples can be routed to the right
+ * series without touching the widget models. The revision mirrors the frame
+ * structure revision the table was built from; frames carrying a different
+ * revision are forwarded back to the GUI thread for a full rebuild.
+ */
+struct SampleRouting
+{
+  quint64 revision = 0;
+  QVector<int> fft;
+  QVector<int> spectrogram;
+  QVector<std::array<int, 2>> plots;
+  QVector<int> histogram;
+  QVector<std::array<int, 2>> scatter;
+  QVector<QVector<int>> multiplot;
+#ifdef USE_QT_COMMERCIAL
+  QVector<std::array<int, 3>> plot3d;
+#endif
+  QHash<int, qreal> initialValues;
+};
+
+/**
+ * @brief Coalesced ingest state handed from the ingest thread to the GUI.
+ *
+ * Values are keyed by dataset index and coalesce (only the latest survives),
+ * while the per-series sample queues append, so a snapshot spanning several
+ * frames still delivers every plotted point.
+ */
+struct DashboardSnapshot
+{
+  QHash<int, QPair<QString, qreal>> values;
+  QVector<PlotDataY> fft;
+  QVector<PlotDataY> spectrogram;
+  QVector<QuantileSketch> histogram;
+  QVector<DensityGrid> scatter;
+  QMap<int, PlotDataY> xAxis;
+  QMap<int, PlotDataY> yAxis;
+  QMap<int, PlotDataY> sampleTimes;
+  QVector<MultiPlotDataY> multiplot;
+#ifdef USE_QT_COMMERCIAL
+  QVector<PlotData3D> points3d;
+#endif
+
+  void clear()
+  {
+    values.clear();
+    fft.clear();
+    spectrogram.clear();
+    histogram.clear();
+    scatter.clear();
+    xAxis.clear();
+    yAxis.clear();
+    sampleTimes.clear();
+    multiplot.clear();
+#ifdef USE_QT_COMMERCIAL
+    points3d.clear();
+#endif
+  }
+};
+
+/**
+ * @brief Background ingest stage for the dashboard.
+ *
+ * Lives in a dedicated thread: it receives every published frame, refreshes
+ * its own numeric registry and appends plot samples according to the routing
+ * table built by the dashboard after each structural pass, so per-frame work
+ * no longer lands on the GUI thread at all. The accumulated state is handed
+ * over through an atomic pointer swap: the ingest thread writes into a back
+ * buffer and publishes it when the exchange slot is free, the GUI thread
+ * takes the published snapshot at display rate and returns it once merged.
+ * Neither side ever blocks; when the GUI falls behind, the ingest thread
+ * simply keeps accumulating into its back buffer.
+ */
+class DashboardIngest : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void structuralFrame(const std::shared_ptr<JSON::Frame> &frame);
+
+public:
+  DashboardIngest();
+
+  [[nodiscard]] DashboardSnapshot *takeSnapshot();
+  void releaseSnapshot(DashboardSnapshot *snapshot);
+
+  void enqueue(const std::shared_ptr<JSON::Frame> &frame);
+  [[nodiscard]] quint64 droppedFrames() const;
+
+public slots:
+  void reset();
+  void ingest(const std::shared_ptr<JSON::Frame> &frame);
+  void configureRouting(const UI::SampleRouting &routing);
+
+private:
+  void publish();
+  void drainMailbox();
+
+private:
+  SampleRouting m_routing;
+  QHash<int, qreal> m_values;
+  QVector<QuantileSketch> m_histograms;
+  QVector<DensityGrid> m_scatterGrids;
+
+  DashboardSnapshot m_buffers[2];
+  DashboardSnapshot *m_back;
+  std::atomic<DashboardSnapshot *> m_middle;
+  std::atomic<DashboardSnapshot *> m_spare;
+
+  // Bounded frame mailbox filled by the publisher thread, see enqueue()
+  std::atomic<bool> m_wake;
+  Misc::BoundedQueue<std::shared_ptr<JSON::Frame>> m_mailbox;
+};
+
+/**
+ * @class UI::Dashboard
+ * @brief Real-time dashboard manager for displaying data-driven widgets.
+ *
+ * The `Dashboard` class creates and maintains the model used for generating a
+ * dashboard user interface, updating various widgets such as plots, multiplots,
+ * and status indicators based on JSON frame data.
+ *
+ * Updates occur at a maximum rate of 20 Hz for optimal performance. It manages
+ * real-time data for different plot types (linear, FFT, multiplot) and supports
+ * actions that can be triggered from the UI.
+ *
+ * Properties notify changes to dynamically adjust UI elements like widget
+ * visibility and count.
+ *
+ * @note This class is implemented as a singleton and is non-copyable and
+ *       non-movable.
+ */
+class Dashboard : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(QString title READ title NOTIFY widgetCountChanged)
+  Q_PROPERTY(bool available READ available NOTIFY widgetCountChanged)
+  Q_PROPERTY(int actionCount READ actionCount NOTIFY actionCountChanged)
+  Q_PROPERTY(QVariantList actions READ actions NOTIFY actionCountChanged)
+  Q_PROPERTY(int points READ points WRITE setPoints NOTIFY pointsChanged)
+  Q_PROPERTY(int totalWidgetCount READ totalWidgetCount NOTIFY widgetCountChanged)
+  Q_PROPERTY(int precision READ precision WRITE setPrecision NOTIFY precisionChanged)
+  Q_PROPERTY(bool pointsWidgetVisible READ pointsWidgetVisible NOTIFY widgetCountChanged)
+  Q_PROPERTY(bool precisionWidgetVisible READ precisionWidgetVisible NOTIFY widgetCountChanged)
+  Q_PROPERTY(bool terminalEnabled READ terminalEnabled WRITE setTerminalEnabled NOTIFY terminalEnabledChanged)
+  Q_PROPERTY(bool containsCommercialFeatures READ containsCommercialFeatures NOTIFY containsCommercialFeaturesChanged)
+  // clang-format on
+
+signals:
+  void updated();
+  void valuesUpdated();
+  void dataReset();
+  void pointsChanged();
+  void precisionChanged();
+  void actionCountChanged();
+  void widgetCountChanged();
+  void terminalEnabledChanged();
+  void containsCommercialFeaturesChanged();
+
+private:
+  explicit Dashboard();
+  ~Dashboard() override;
+  Dashboard(Dashboard &&) = delete;
+  Dashboard(const Dashboard &) = delete;
+  Dashboard &operator=(Dashboard &&) = delete;
+  Dashboard &operator=(const Dashboard &) = delete;
+
+public:
+  static Dashboard &instance();
+  static qreal smartInterval(const qreal min, const qreal max,
+                             const qreal multiplier = 0.2);
+
+  [[nodiscard]] bool available() const;
+  [[nodiscard]] bool streamAvailable() const;
+  [[nodiscard]] bool terminalEnabled() const;
+  [[nodiscard]] bool pointsWidgetVisible() const;
+  [[nodiscard]] bool precisionWidgetVisible() const;
+  [[nodiscard]] bool containsCommercialFeatures() const;
+
+  [[nodiscard]] int points() const;
+  [[nodiscard]] int precision() const;
+  [[nodiscard]] int actionCount() const;
+  [[nodiscard]] int totalWidgetCount() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+
+  Q_INVOKABLE bool frameValid() const;
+  Q_INVOKABLE int relativeIndex(const int widgetIndex);
+  Q_INVOKABLE SerialStudio::DashboardWidget widgetType(const int widgetIndex);
+  Q_INVOKABLE int widgetCount(const SerialStudio::DashboardWidget widget) const;
+
+  // clang-format off
+  Q_INVOKABLE qreal samplePositionForTime(const int datasetIndex, const qreal timestamp) const;
+  Q_INVOKABLE QVariantMap cursorMeasurement(const int datasetIndex, const qreal position) const;
+  Q_INVOKABLE QVariantMap cursorDelta(const int datasetIndex, const qreal positionA, const qreal positionB) const;
+  // clang-format on
+
+  [[nodiscard]] QVector<QPair<QString, QVector<qreal>>> sampleColumns() const;
+
+  [[nodiscard]] const QString &title() const;
+  [[nodiscard]] QVariantList actions() const;
+  [[nodiscard]] const SerialStudio::WidgetMap &widgetMap() const;
+
+  // clang-format off
+  [[nodiscard]] const QMap<int, JSON::Dataset> &datasets() const;
+  [[nodiscard]] const JSON::Group &getGroupWidget(const SerialStudio::DashboardWidget widget, const int index) const;
+  [[nodiscard]] const JSON::Dataset &getDatasetWidget(const SerialStudio::DashboardWidget widget, const int index) const;
+  // clang-format on
+
+  [[nodiscard]] qreal compassSnapshot(const int index) const;
+  [[nodiscard]] const GyroscopeSnapshot &gyroscopeSnapshot(const int index) const;
+  [[nodiscard]] const AccelerometerSnapshot &
+  accelerometerSnapshot(const int index) const;
+
+  [[nodiscard]] const JSON::Frame &currentFrame();
+  [[nodiscard]] const AlignedSeriesY &fftData(const int index) const;
+  [[nodiscard]] const AlignedSeriesY &spectrogramData(const int index) const;
+  [[nodiscard]] const QuantileSketch &histogramData(const int index) const;
+  [[nodiscard]] const DensityGrid &scatterData(const int index) const;
+  [[nodiscard]] const LineSeries &plotData(const int index) const;
+  [[nodiscard]] const MultiLineSeries &multiplotData(const int index) const;
+
+#ifdef USE_QT_COMMERCIAL
+  [[nodiscard]] const PlotData3D &plotData3D(const int index) const;
+  [[nodiscard]] quint64 plotData3DTotalPoints(const int index) const;
+#endif
+
+public slots:
+  void setPoints(const int points);
+  void activateAction(const int index);
+  void setPrecision(const int precision);
+  void resetData(const bool notify = true);
+  void setTerminalEnabled(const bool enabled);
+
+public:
+  qsizetype compactMemory();
+
+private slots:
+  void updatePlots();
+  void prewarmPlotSeries();
+  void configureFftSeries();
+  void configureSpectrogramSeries();
+  void configureLineSeries();
+  void configureSharedXAxis();
+  void configureMultiLineSeries();
+  void processFrame(const std::shared_ptr<JSON::Frame> &frame);
+
+private:
+  void queuePlotSamples(const QSet<int> &updatedIndexes = QSet<int>());
+  void pushSampleRouting();
+  bool consumeIngestSnapshot();
+  void syncWidgetModelValues();
+  void updateInertialSnapshots();
+  void updateDatasetRegistry(const JSON::Frame &frame);
+
+private:
+  int m_points;
+  int m_precision;
+  int m_widgetCount;
+  quint64 m_frameRevision;
+  bool m_updateRequired;
+  bool m_valueUpdateRequired;
+  bool m_widgetValuesStale;
+  bool m_terminalEnabled;
+  qreal m_latestRxTime;
+
+  PlotRingX m_sharedXAxis;
+  QMap<int, TieredSeriesX> m_xAxisData;
+  QMap<int, TieredSeriesY> m_yAxisData;
+  QMap<int, PlotRingY> m_sampleTimes;
+
+  QVector<AlignedSeriesY> m_fftValues;
+  QVector<AlignedSeriesY> m_spectrogramValues;
+  QVector<QuantileSketch> m_histogramData;
+  QVector<DensityGrid> m_scatterData;
+  QVector<LineSeries> m_pltValues;
+  QVector<MultiLineSeries> m_multipltValues;
+
+  // Layout fingerprints of the series families above, used to diff a new
+  // project structure against the previous one & keep surviving buffers
+  QVector<QPair<int, int>> m_fftLayout;
+  QVector<QPair<int, int>> m_spectrogramLayout;
+  QVector<QVector<int>> m_multiplotLayout;
+
+  QVector<PlotDataY> m_pendingFftData;
+  QVector<PlotDataY> m_pendingSpectrogramData;
+  QMap<int, PlotDataY> m_pendingXAxisData;
+  QMap<int, PlotDataY> m_pendingYAxisData;
+  QMap<int, PlotDataY> m_pendingTimeData;
+  QVector<MultiPlotDataY> m_pendingMultiplotData;
+
+#ifdef USE_QT_COMMERCIAL
+  QVector<PlotData3D> m_plotData3D;
+  QVector<quint64> m_plotData3DTotal;
+#endif
+
+  QElapsedTimer m_gyroIntegrationTimer;
+  QMap<int, qreal> m_compassSnapshots;
+  QMap<int, GyroscopeSnapshot> m_gyroscopeSnapshots;
+  QMap<int, AccelerometerSnapshot> m_accelerometerSnapshots;
+
+  QVector<JSON::Action> m_actions;
+  QMap<int, JSON::Dataset> m_datasets;
+  SerialStudio::WidgetMap m_widgetMap;
+  QMap<SerialStudio::DashboardWidget, QVector<JSON::Group>> m_widgetGroups;
+  QMap<SerialStudio::DashboardWidget, QVector<JSON::Dataset>> m_widgetDatasets;
+
+  JSON::Frame m_currentFrame;
+
+  QThread m_ingestThread;
+  DashboardIngest *m_ingest;
+};
+} // namespace UI
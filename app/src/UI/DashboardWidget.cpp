@@ -22,6 +22,7 @@
 #include "UI/DashboardWidget.h"
 
 #include "UI/Dashboard.h"
+#include "UI/WidgetProfiler.h"
 #include "UI/Widgets/Bar.h"
 #include "UI/Widgets/GPS.h"
 #include "UI/Widgets/Plot.h"
@@ -31,7 +32,11 @@
 #include "UI/Widgets/LEDPanel.h"
 #include "UI/Widgets/DataGrid.h"
 #include "UI/Widgets/Gyroscope.h"
+#include "UI/Widgets/Histogram.h"
+#include "UI/Widgets/ImageFeed.h"
 #include "UI/Widgets/MultiPlot.h"
+#include "UI/Widgets/Scatter.h"
+#include "UI/Widgets/Spectrogram.h"
 #include "UI/Widgets/Accelerometer.h"
 
 #include "Misc/ThemeManager.h"
@@ -189,6 +194,26 @@ void UI::DashboardWidget::setWidgetIndex(const int index)
         m_dbWidget = new Widgets::Plot(relativeIndex(), this);
         m_qmlPath = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/Plot.qml";
         break;
+      case SerialStudio::DashboardScatter:
+        m_dbWidget = new Widgets::Scatter(relativeIndex(), this);
+        m_qmlPath
+            = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/Scatter.qml";
+        break;
+      case SerialStudio::DashboardSpectrogram:
+        m_dbWidget = new Widgets::Spectrogram(relativeIndex(), this);
+        m_qmlPath = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/"
+                    "Spectrogram.qml";
+        break;
+      case SerialStudio::DashboardHistogram:
+        m_dbWidget = new Widgets::Histogram(relativeIndex(), this);
+        m_qmlPath
+            = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/Histogram.qml";
+        break;
+      case SerialStudio::DashboardImage:
+        m_dbWidget = new Widgets::ImageFeed(relativeIndex(), this);
+        m_qmlPath
+            = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/ImageFeed.qml";
+        break;
       case SerialStudio::DashboardBar:
         m_dbWidget = new Widgets::Bar(relativeIndex(), this);
         m_qmlPath = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/Bar.qml";
@@ -243,7 +268,32 @@ void UI::DashboardWidget::setWidgetIndex(const int index)
     if (m_dbWidget)
     {
       m_dbWidget->setParentItem(this);
+      m_dbWidget->setEnabled(isVisible());
+      WidgetProfiler::instance().registerWidget(m_dbWidget, widgetTitle());
       Q_EMIT widgetIndexChanged();
     }
   }
 }
+
+/**
+ * @brief Suspends the widget model while its container is not visible.
+ *
+ * Every dashboard model guards its update slot with isEnabled(), so the model
+ * is disabled while this container is scrolled out of view, in a hidden tab
+ * or in a background window. Series data keeps accumulating inside
+ * UI::Dashboard while the model is suspended; once the widget is exposed
+ * again a catch-up refresh is queued so the model immediately reflects the
+ * latest values.
+ */
+void UI::DashboardWidget::itemChange(ItemChange change,
+                                     const ItemChangeData &value)
+{
+  if (change == ItemVisibleHasChanged && m_dbWidget)
+  {
+    m_dbWidget->setEnabled(value.boolValue);
+    if (value.boolValue)
+      QMetaObject::invokeMethod(m_dbWidget, "updateData", Qt::QueuedConnection);
+  }
+
+  QQuickItem::itemChange(change, value);
+}
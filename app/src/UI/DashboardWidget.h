@@ -91,6 +91,9 @@ public:
 public slots:
   void setWidgetIndex(const int index);
 
+protected:
+  void itemChange(ItemChange change, const ItemChangeData &value) override;
+
 private:
   int m_index;
   int m_relativeIndex;
@@ -23,6 +23,7 @@
 
 #include "UI/Dashboard.h"
 #include "UI/WindowManager.h"
+#include "Misc/Settings.h"
 
 //------------------------------------------------------------------------------
 // Taskbar model implementation
@@ -383,6 +384,10 @@ void UI::Taskbar::setActiveGroupId(int groupId)
   Q_EMIT activeGroupIdChanged();
   Q_EMIT windowStatesChanged();
   Q_EMIT taskbarButtonsChanged();
+
+  // Persist the session snapshot for this dashboard
+  if (!m_restoringState)
+    saveSessionState();
 }
 
 //------------------------------------------------------------------------------
@@ -522,9 +527,14 @@ void UI::Taskbar::registerWindow(const int id, QQuickItem *window)
   m_windowManager->registerWindow(id, window);
   Q_EMIT registeredWindowsChanged();
 
-  // Trigger a layout update when the QML code created all the windows
+  // Trigger a layout update when the QML code created all the windows, and
+  // re-publish the window states so delegates created after the session
+  // snapshot was restored pick up their stored state
   if (m_windowIDs.count() >= m_taskbarButtons->rowCount() && m_windowManager)
+  {
     m_windowManager->loadLayout();
+    Q_EMIT windowStatesChanged();
+  }
 }
 
 /**
@@ -548,6 +558,10 @@ void UI::Taskbar::setWindowState(const int id,
   item->setData(state, UI::TaskbarModel::WindowStateRole);
   Q_EMIT windowStatesChanged();
 
+  // Persist the session snapshot for this dashboard
+  if (!m_restoringState)
+    saveSessionState();
+
   // Trigger a layout update
   if (m_windowIDs.count() >= m_taskbarButtons->rowCount() && m_windowManager)
     m_windowManager->triggerLayoutUpdate();
@@ -584,6 +598,9 @@ void UI::Taskbar::setWindowState(const int id,
  */
 void UI::Taskbar::rebuildModel()
 {
+  // Suppress session snapshot writes while the model is rebuilt & restored
+  m_restoringState = true;
+
   // Clear the model
   m_windowIDs.clear();
   m_fullModel->clear();
@@ -604,6 +621,7 @@ void UI::Taskbar::rebuildModel()
     Q_EMIT fullModelChanged();
     Q_EMIT windowStatesChanged();
     Q_EMIT registeredWindowsChanged();
+    m_restoringState = false;
     return;
   }
 
@@ -748,6 +766,10 @@ void UI::Taskbar::rebuildModel()
   Q_EMIT fullModelChanged();
   Q_EMIT windowStatesChanged();
   Q_EMIT registeredWindowsChanged();
+
+  // Re-apply the stored session snapshot for this dashboard
+  restoreSessionState();
+  m_restoringState = false;
 }
 
 //------------------------------------------------------------------------------
@@ -794,3 +816,89 @@ QStandardItem *UI::Taskbar::findItemByWindowId(int windowId,
 
   return nullptr;
 }
+
+//------------------------------------------------------------------------------
+// Session snapshot functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the settings key that identifies the current dashboard.
+ *
+ * The key is derived from the frame title and the total widget count, so a
+ * stored snapshot is only re-applied to the project layout it was saved for.
+ */
+QString UI::Taskbar::sessionStateKey() const
+{
+  auto *db = &UI::Dashboard::instance();
+  auto title = db->currentFrame().title();
+  title.replace(QLatin1Char('/'), QLatin1Char('_'));
+  return QStringLiteral("sessionState/%1_%2")
+      .arg(title)
+      .arg(db->totalWidgetCount());
+}
+
+/**
+ * @brief Persists the window states & active group of the current dashboard.
+ *
+ * Called whenever the user shows, minimizes or closes a widget window or
+ * switches the active group. The snapshot is read back by
+ * restoreSessionState() when the same project is loaded again, so a
+ * restarted session comes up with the exact window arrangement it had
+ * before instead of replaying the default layout.
+ */
+void UI::Taskbar::saveSessionState()
+{
+  // Only snapshot valid dashboards
+  auto *db = &UI::Dashboard::instance();
+  if (!db->currentFrame().isValid())
+    return;
+
+  // Store the state of every registered window
+  QVariantMap states;
+  const auto &widgetMap = db->widgetMap();
+  for (auto it = widgetMap.begin(); it != widgetMap.end(); ++it)
+  {
+    const auto *item = findItemByWindowId(it.key());
+    if (item)
+      states.insert(QString::number(it.key()),
+                    item->data(TaskbarModel::WindowStateRole).toInt());
+  }
+
+  // Write the snapshot
+  const auto key = sessionStateKey();
+  Misc::Settings::instance().setValue(key + QStringLiteral("/windowStates"), states);
+  Misc::Settings::instance().setValue(key + QStringLiteral("/activeGroup"), m_activeGroupId);
+}
+
+/**
+ * @brief Re-applies the stored window states & active group after a rebuild.
+ *
+ * Only runs when a snapshot exists for the current dashboard; the caller is
+ * responsible for guarding against recursive snapshot writes via
+ * @c m_restoringState.
+ */
+void UI::Taskbar::restoreSessionState()
+{
+  // Only restore valid dashboards
+  auto *db = &UI::Dashboard::instance();
+  if (!db->currentFrame().isValid())
+    return;
+
+  // Obtain the stored snapshot (if any)
+  const auto key = sessionStateKey();
+  const auto states
+      = Misc::Settings::instance().value(key + QStringLiteral("/windowStates")).toMap();
+  if (states.isEmpty())
+    return;
+
+  // Re-apply the state of every window
+  for (auto it = states.begin(); it != states.end(); ++it)
+    setWindowState(it.key().toInt(),
+                   static_cast<TaskbarModel::WindowState>(it.value().toInt()));
+
+  // Re-apply the active group
+  const auto group
+      = Misc::Settings::instance().value(key + QStringLiteral("/activeGroup"), -1).toInt();
+  if (group != m_activeGroupId)
+    setActiveGroupId(group);
+}
@@ -169,10 +169,14 @@ public slots:
 
 private:
   void rebuildModel();
+  void saveSessionState();
+  void restoreSessionState();
+  [[nodiscard]] QString sessionStateKey() const;
   QStandardItem *findItemByWindowId(int windowId,
                                     QStandardItem *parentItem = nullptr) const;
 
   int m_activeGroupId = -1;
+  bool m_restoringState = false;
 
   QQuickItem *m_activeWindow;
   UI::WindowManager *m_windowManager;
@@ -180,6 +184,7 @@ private:
 
   TaskbarModel *m_fullModel;
   TaskbarModel *m_taskbarButtons;
+
 };
 
 } // namespace UI
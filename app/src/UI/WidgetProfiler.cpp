@@ -0,0 +1,186 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "UI/WidgetProfiler.h"
+
+#include <algorithm>
+
+#include <QVariantMap>
+
+#include "Misc/TimerEvents.h"
+
+/**
+ * @brief Constructs the profiler and hooks the 1 Hz publication tick.
+ */
+UI::WidgetProfiler::WidgetProfiler()
+  : m_enabled(false)
+  , m_maxCost(0.0)
+{
+  m_clock.start();
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &UI::WidgetProfiler::publish);
+}
+
+/**
+ * @brief Returns a pointer to the only instance of the class.
+ */
+UI::WidgetProfiler &UI::WidgetProfiler::instance()
+{
+  static WidgetProfiler singleton;
+  return singleton;
+}
+
+/**
+ * @brief Returns @c true while cost attribution is active.
+ */
+bool UI::WidgetProfiler::enabled() const
+{
+  return m_enabled;
+}
+
+/**
+ * @brief Returns the widgets ranked by attributed cost, most expensive first.
+ *
+ * Each entry is a map with the widget @c title, its @c cost in milliseconds
+ * of GUI-thread time per second, and the number of @c updates performed
+ * during the last publication interval.
+ */
+QVariantList UI::WidgetProfiler::rankedCosts() const
+{
+  return m_rankedCosts;
+}
+
+/**
+ * @brief Returns the heat factor of @a widget, from 0 to 1.
+ *
+ * The factor is the widget's cost relative to the most expensive widget in
+ * the last publication interval, so the offender reads 1 and idle widgets
+ * read 0 regardless of the dashboard's absolute load.
+ */
+double UI::WidgetProfiler::heatOf(QQuickItem *widget) const
+{
+  if (m_maxCost <= 0.0)
+    return 0.0;
+
+  const auto it = m_costs.constFind(widget);
+  if (it == m_costs.constEnd())
+    return 0.0;
+
+  return qMin(1.0, it->msPerSecond / m_maxCost);
+}
+
+/**
+ * @brief Associates a widget model with its dashboard title.
+ *
+ * Called by UI::DashboardWidget when it constructs a model, so the ranked
+ * list can show the same titles as the dashboard windows. Entries are
+ * dropped automatically when the model is destroyed.
+ */
+void UI::WidgetProfiler::registerWidget(QQuickItem *widget,
+                                        const QString &title)
+{
+  if (!widget)
+    return;
+
+  m_costs[widget].title = title;
+  connect(widget, &QObject::destroyed, this,
+          &UI::WidgetProfiler::onWidgetDestroyed, Qt::UniqueConnection);
+}
+
+/**
+ * @brief Starts or stops cost attribution.
+ *
+ * Switching in either direction discards the partial interval, so the first
+ * published ranking only contains data gathered while profiling was active.
+ */
+void UI::WidgetProfiler::setEnabled(const bool enabled)
+{
+  if (m_enabled == enabled)
+    return;
+
+  m_enabled = enabled;
+  m_maxCost = 0.0;
+  m_rankedCosts.clear();
+  for (auto it = m_costs.begin(); it != m_costs.end(); ++it)
+  {
+    it->updates = 0;
+    it->accumulatedNs = 0;
+    it->msPerSecond = 0.0;
+  }
+
+  Q_EMIT enabledChanged();
+  Q_EMIT costsChanged();
+}
+
+/**
+ * @brief Publishes the ranking for the last second and resets accumulators.
+ */
+void UI::WidgetProfiler::publish()
+{
+  if (!m_enabled)
+    return;
+
+  m_maxCost = 0.0;
+  m_rankedCosts.clear();
+  for (auto it = m_costs.begin(); it != m_costs.end(); ++it)
+  {
+    it->msPerSecond = static_cast<double>(it->accumulatedNs) / 1e6;
+    m_maxCost = qMax(m_maxCost, it->msPerSecond);
+
+    QVariantMap entry;
+    entry.insert(QStringLiteral("title"), it->title);
+    entry.insert(QStringLiteral("cost"), it->msPerSecond);
+    entry.insert(QStringLiteral("updates"), it->updates);
+    m_rankedCosts.append(entry);
+
+    it->updates = 0;
+    it->accumulatedNs = 0;
+  }
+
+  std::sort(m_rankedCosts.begin(), m_rankedCosts.end(),
+            [](const QVariant &a, const QVariant &b) {
+              return a.toMap().value(QStringLiteral("cost")).toDouble()
+                     > b.toMap().value(QStringLiteral("cost")).toDouble();
+            });
+
+  Q_EMIT costsChanged();
+}
+
+/**
+ * @brief Forgets a widget model once it has been destroyed.
+ */
+void UI::WidgetProfiler::onWidgetDestroyed(QObject *widget)
+{
+  m_costs.remove(widget);
+}
+
+/**
+ * @brief Credits @a elapsedNs of GUI-thread time to @a widget.
+ */
+void UI::WidgetProfiler::record(QQuickItem *widget, const qint64 elapsedNs)
+{
+  const auto it = m_costs.find(widget);
+  if (it != m_costs.end())
+  {
+    ++it->updates;
+    it->accumulatedNs += elapsedNs;
+  }
+}
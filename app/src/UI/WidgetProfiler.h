@@ -0,0 +1,141 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QQuickItem>
+#include <QVariantList>
+#include <QElapsedTimer>
+
+namespace UI
+{
+/**
+ * @class UI::WidgetProfiler
+ * @brief Per-widget cost attribution for slow dashboards.
+ *
+ * Finding the one expensive widget among a hundred used to mean deleting
+ * widgets by bisection. This module attributes GUI-thread time to individual
+ * widget models instead: every model wraps its update slot in a @c Scope
+ * timer, the accumulated time is published once per second as a ranked list,
+ * and each dashboard window can tint itself with its share of the most
+ * expensive widget's cost.
+ *
+ * Only the model update (data shuffling, range tracking, series assembly) is
+ * attributed; Qt renders the scene graph in a batch, so per-item GPU time is
+ * not observable from here. In practice the model update dominates the
+ * per-widget cost and is enough to single out the offender.
+ *
+ * Profiling is off by default. When disabled, each scope costs a single
+ * branch, so shipping the instrumentation in release builds is free.
+ */
+class WidgetProfiler : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool enabled
+             READ enabled
+             WRITE setEnabled
+             NOTIFY enabledChanged)
+  Q_PROPERTY(QVariantList rankedCosts
+             READ rankedCosts
+             NOTIFY costsChanged)
+  // clang-format on
+
+signals:
+  void enabledChanged();
+  void costsChanged();
+
+private:
+  explicit WidgetProfiler();
+  WidgetProfiler(WidgetProfiler &&) = delete;
+  WidgetProfiler(const WidgetProfiler &) = delete;
+  WidgetProfiler &operator=(WidgetProfiler &&) = delete;
+  WidgetProfiler &operator=(const WidgetProfiler &) = delete;
+
+public:
+  static WidgetProfiler &instance();
+
+  /**
+   * @class UI::WidgetProfiler::Scope
+   * @brief Scoped timer that attributes elapsed time to a widget model.
+   *
+   * Construct one on the stack at the top of a model's update slot; the
+   * elapsed time is credited to the widget when the scope closes. Costs
+   * nothing beyond an enabled check while profiling is off.
+   */
+  class Scope
+  {
+  public:
+    explicit Scope(QQuickItem *widget)
+      : m_widget(widget)
+      , m_startNs(-1)
+    {
+      if (instance().m_enabled)
+        m_startNs = instance().m_clock.nsecsElapsed();
+    }
+
+    ~Scope()
+    {
+      if (m_startNs >= 0)
+        instance().record(m_widget,
+                          instance().m_clock.nsecsElapsed() - m_startNs);
+    }
+
+  private:
+    QQuickItem *m_widget;
+    qint64 m_startNs;
+  };
+
+  [[nodiscard]] bool enabled() const;
+  [[nodiscard]] QVariantList rankedCosts() const;
+
+  Q_INVOKABLE double heatOf(QQuickItem *widget) const;
+
+  void registerWidget(QQuickItem *widget, const QString &title);
+
+public slots:
+  void setEnabled(const bool enabled);
+
+private slots:
+  void publish();
+  void onWidgetDestroyed(QObject *widget);
+
+private:
+  void record(QQuickItem *widget, const qint64 elapsedNs);
+
+private:
+  struct Cost
+  {
+    QString title;
+    int updates = 0;
+    qint64 accumulatedNs = 0;
+    double msPerSecond = 0.0;
+  };
+
+  bool m_enabled;
+  double m_maxCost;
+  QElapsedTimer m_clock;
+  QVariantList m_rankedCosts;
+  QHash<QObject *, Cost> m_costs;
+};
+} // namespace UI
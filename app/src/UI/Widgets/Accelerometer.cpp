@@ -21,6 +21,8 @@
 
 #include "UI/Dashboard.h"
 #include "UI/Widgets/Accelerometer.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
 
 /**
  * @brief Constructs an Accelerometer widget.
@@ -34,7 +36,7 @@ Widgets::Accelerometer::Accelerometer(const int index, QQuickItem *parent)
   , m_magnitude(0)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardAccelerometer, m_index))
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::valuesUpdated, this,
             &Accelerometer::updateData);
 }
 
@@ -58,46 +60,34 @@ qreal Widgets::Accelerometer::theta() const
 /**
  * @brief Updates the accelerometer data from the Dashboard.
  *
- * This method retrieves the latest data for this accelerometer from the
- * Dashboard and updates the G-force value and display accordingly.
+ * This method reads the angle & magnitude published by the shared sample
+ * store of the Dashboard (computed once per received frame) and requests a
+ * repaint when the values changed.
  */
 void Widgets::Accelerometer::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::Accelerometer::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   // Widget not enabled, do nothing
   if (!isEnabled())
     return;
 
   // Get the dashboard instance and check if the index is valid
-  if (VALIDATE_WIDGET(SerialStudio::DashboardAccelerometer, m_index))
-    return;
-
-  // Get the accelerometer data and validate the dataset count
-  const auto &acc = GET_GROUP(SerialStudio::DashboardAccelerometer, m_index);
-  if (acc.datasetCount() != 3)
+  if (!VALIDATE_WIDGET(SerialStudio::DashboardAccelerometer, m_index))
     return;
 
-  // Obtain the X, Y, and Z acceleration values
-  qreal x = 0, y = 0;
-  for (int i = 0; i < 3; ++i)
-  {
-    auto dataset = acc.getDataset(i);
-    if (dataset.widget() == QStringLiteral("x"))
-      x = dataset.value().toDouble();
-    else if (dataset.widget() == QStringLiteral("y"))
-      y = dataset.value().toDouble();
-  }
-
-  // Calculate the radius (magnitude) using only X and Y
-  const qreal r = qSqrt(qPow(x / 9.81, 2) + qPow(y / 9.81, 2));
-
-  // Calculate the angle using atan2 for the X-Y plane
-  const qreal theta = qAtan2(y, x) * (180.0 / M_PI);
+  // Read the values published by the dashboard sample store
+  const auto &snapshot
+      = UI::Dashboard::instance().accelerometerSnapshot(m_index);
 
   // Redraw item if required
-  if (!qFuzzyCompare(r, m_magnitude) || !qFuzzyCompare(theta, m_theta))
+  if (!qFuzzyCompare(snapshot.magnitude, m_magnitude)
+      || !qFuzzyCompare(snapshot.theta, m_theta))
   {
-    m_theta = theta;
-    m_magnitude = r;
+    m_theta = snapshot.theta;
+    m_magnitude = snapshot.magnitude;
     Q_EMIT updated();
   }
 }
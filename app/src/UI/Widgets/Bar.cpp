@@ -21,6 +21,8 @@
 
 #include "UI/Dashboard.h"
 #include "UI/Widgets/Bar.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
 
 /**
  * @brief Constructs a Bar widget.
@@ -34,6 +36,7 @@ Widgets::Bar::Bar(const int index, QQuickItem *parent)
   , m_minValue(0)
   , m_maxValue(100)
   , m_alarmValue(0)
+  , m_autoRange(false)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardBar, m_index))
   {
@@ -44,7 +47,10 @@ Widgets::Bar::Bar(const int index, QQuickItem *parent)
     m_minValue = qMin(dataset.min(), dataset.max());
     m_maxValue = qMax(dataset.min(), dataset.max());
 
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+    // No range declared in the project, derive one from the recent samples
+    m_autoRange = qFuzzyCompare(dataset.min(), dataset.max());
+
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::valuesUpdated, this,
             &Bar::updateData);
   }
 }
@@ -138,17 +144,43 @@ qreal Widgets::Bar::alarmFractionalValue() const
  */
 void Widgets::Bar::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::Bar::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   if (!isEnabled())
     return;
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardBar, m_index))
   {
     const auto &dataset = GET_DATASET(SerialStudio::DashboardBar, m_index);
-    auto value = qMax(m_minValue, qMin(m_maxValue, dataset.value().toDouble()));
-    if (!qFuzzyCompare(value, m_value))
+
+    // Track the window extrema & grow/shrink the scale with them
+    bool rangeMoved = false;
+    if (m_autoRange)
     {
-      m_value = value;
-      Q_EMIT updated();
+      m_range.append(dataset.numericValue());
+      if (!qFuzzyCompare(m_minValue, m_range.min())
+          || !qFuzzyCompare(m_maxValue, m_range.max()))
+      {
+        m_minValue = m_range.min();
+        m_maxValue = m_range.max();
+        rangeMoved = true;
+      }
     }
+
+    // Clamp the displayed value to the (possibly moved) scale
+    const auto value = qMax(m_minValue, qMin(m_maxValue,
+                                             dataset.numericValue()));
+    const bool valueMoved = !qFuzzyCompare(value, m_value);
+    m_value = value;
+
+    // All state is final, fire each binding wave at most once per tick. A
+    // moved scale re-positions the fill level too, so it implies a value
+    // wave even when the sample itself stood still.
+    if (rangeMoved)
+      Q_EMIT rangeChanged();
+    if (valueMoved || rangeMoved)
+      Q_EMIT updated();
   }
 }
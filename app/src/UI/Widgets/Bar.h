@@ -23,24 +23,31 @@
 
 #include <QtQuick>
 
+#include "UI/Widgets/WindowedMinMax.h"
+
 namespace Widgets
 {
 /**
  * @brief A widget that displays a bar/level indicator.
+ *
+ * When the project does not declare a dataset range (min equals max), the
+ * scale auto-ranges over the extrema of the most recent samples, tracked
+ * incrementally through WindowedMinMax.
  */
 class Bar : public QQuickItem
 {
   Q_OBJECT
   Q_PROPERTY(QString units READ units CONSTANT)
   Q_PROPERTY(qreal value READ value NOTIFY updated)
-  Q_PROPERTY(qreal minValue READ minValue CONSTANT)
-  Q_PROPERTY(qreal maxValue READ maxValue CONSTANT)
+  Q_PROPERTY(qreal minValue READ minValue NOTIFY rangeChanged)
+  Q_PROPERTY(qreal maxValue READ maxValue NOTIFY rangeChanged)
   Q_PROPERTY(qreal alarmValue READ alarmValue CONSTANT)
   Q_PROPERTY(qreal fractionalValue READ fractionalValue NOTIFY updated)
-  Q_PROPERTY(qreal alarmFractionalValue READ alarmFractionalValue CONSTANT)
+  Q_PROPERTY(qreal alarmFractionalValue READ alarmFractionalValue NOTIFY rangeChanged)
 
 signals:
   void updated();
+  void rangeChanged();
 
 public:
   explicit Bar(const int index = -1, QQuickItem *parent = nullptr);
@@ -64,5 +71,8 @@ private:
   qreal m_minValue;
   qreal m_maxValue;
   qreal m_alarmValue;
+
+  bool m_autoRange;
+  WindowedMinMax m_range;
 };
 } // namespace Widgets
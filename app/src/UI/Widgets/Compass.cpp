@@ -19,8 +19,13 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <cmath>
+
 #include "UI/Dashboard.h"
 #include "UI/Widgets/Compass.h"
+#include "Misc/Utilities.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
 
 /**
  * @brief Constructs a Compass widget.
@@ -31,9 +36,10 @@ Widgets::Compass::Compass(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
   , m_value(0)
+  , m_rounded(0)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardCompass, m_index))
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::valuesUpdated, this,
             &Compass::updateData);
 }
 
@@ -63,19 +69,28 @@ QString Widgets::Compass::text() const
  */
 void Widgets::Compass::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::Compass::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   if (!isEnabled())
     return;
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardCompass, m_index))
   {
-    const auto &dataset = GET_DATASET(SerialStudio::DashboardCompass, m_index);
-    const auto value = dataset.value().toDouble();
-    if (!qFuzzyCompare(value, m_value))
+    // Read the heading published by the dashboard sample store
+    const auto value = UI::Dashboard::instance().compassSnapshot(m_index);
+    const auto precision = UI::Dashboard::instance().precision();
+
+    // Skip all label work when the rounded value is unchanged, changes below
+    // the display precision are invisible anyway
+    const auto rounded = qRound64(value * std::pow(10.0, precision));
+    if (rounded != m_rounded)
     {
       // Update values
-      m_value = qMin(360.0, qMax(0.0, value));
-      m_text = QString::number(m_value, 'f',
-                               UI::Dashboard::instance().precision());
+      m_value = value;
+      m_rounded = rounded;
+      m_text = Misc::Utilities::formatDouble(m_value, precision);
 
       // Ensure that angle always has 3 characters to avoid jiggling
       const int deg = qCeil(m_value);
@@ -49,6 +49,7 @@ private slots:
 private:
   int m_index;
   qreal m_value;
+  qint64 m_rounded;
   QString m_text;
 };
 } // namespace Widgets
@@ -22,6 +22,90 @@
 #include "UI/Dashboard.h"
 #include "Misc/ThemeManager.h"
 #include "UI/Widgets/DataGrid.h"
+#include "Misc/Utilities.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
+
+/**
+ * @brief Constructs a row model for the given DataGrid widget.
+ * @param parent The DataGrid widget that owns the displayed data.
+ */
+Widgets::DataGridRowModel::DataGridRowModel(DataGrid *parent)
+  : QAbstractListModel(parent)
+  , m_dataGrid(parent)
+{
+}
+
+/**
+ * @brief Returns the number of datasets in the data grid group.
+ */
+int Widgets::DataGridRowModel::rowCount(const QModelIndex &parent) const
+{
+  if (parent.isValid())
+    return 0;
+
+  return m_dataGrid->count();
+}
+
+/**
+ * @brief Returns the data stored for the given row & role.
+ */
+QVariant Widgets::DataGridRowModel::data(const QModelIndex &index,
+                                         int role) const
+{
+  const int row = index.row();
+  if (row < 0 || row >= m_dataGrid->count())
+    return QVariant();
+
+  switch (role)
+  {
+    case TitleRole:
+      return m_dataGrid->titles().at(row);
+    case UnitsRole:
+      return m_dataGrid->units().at(row);
+    case ValueRole:
+      return m_dataGrid->values().at(row);
+    case AlarmRole:
+      return m_dataGrid->alarms().at(row);
+    case ColorRole:
+      return m_dataGrid->colors().at(row);
+    default:
+      return QVariant();
+  }
+}
+
+/**
+ * @brief Returns the role names used by the QML delegates.
+ */
+QHash<int, QByteArray> Widgets::DataGridRowModel::roleNames() const
+{
+  static const QHash<int, QByteArray> roles = {{TitleRole, "title"},
+                                               {UnitsRole, "units"},
+                                               {ValueRole, "value"},
+                                               {AlarmRole, "alarm"},
+                                               {ColorRole, "datasetColor"}};
+  return roles;
+}
+
+/**
+ * @brief Emits a per-row @c dataChanged notification for the given roles.
+ */
+void Widgets::DataGridRowModel::notifyRowChanged(int row,
+                                                 const QList<int> &roles)
+{
+  const auto idx = index(row);
+  Q_EMIT dataChanged(idx, idx, roles);
+}
+
+/**
+ * @brief Refreshes the color role of every row after a theme change.
+ */
+void Widgets::DataGridRowModel::notifyColorsChanged()
+{
+  const int count = m_dataGrid->count();
+  if (count > 0)
+    Q_EMIT dataChanged(index(0), index(count - 1), {ColorRole});
+}
 
 /**
  * @brief Constructs a DataGrid widget.
@@ -31,6 +115,7 @@
 Widgets::DataGrid::DataGrid(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
+  , m_rowModel(this)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardDataGrid, m_index))
   {
@@ -40,22 +125,34 @@ Widgets::DataGrid::DataGrid(const int index, QQuickItem *parent)
     m_titles.resize(group.datasetCount());
     m_values.resize(group.datasetCount());
     m_alarms.resize(group.datasetCount());
+    m_rawValues.resize(group.datasetCount());
+    m_alarmLevels.resize(group.datasetCount());
 
+    // Compile the alarm rules once: thresholds live in a flat table, so the
+    // per-frame loop only performs numeric comparisons
     for (int i = 0; i < group.datasetCount(); ++i)
     {
-      auto dataset = group.getDataset(i);
+      const auto &dataset = group.getDataset(i);
 
       m_values[i] = "";
       m_alarms[i] = false;
       m_titles[i] = dataset.title();
+      m_alarmLevels[i] = dataset.alarm();
       m_units[i] = dataset.units().isEmpty()
                        ? ""
                        : QString("[%1]").arg(dataset.units());
     }
 
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::valuesUpdated, this,
             &DataGrid::updateData);
 
+    // Re-format every value when the display precision changes
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::precisionChanged, this,
+            [=] {
+              m_rawValues.fill(QString());
+              updateData();
+            });
+
     onThemeChanged();
     connect(&Misc::ThemeManager::instance(), &Misc::ThemeManager::themeChanged,
             this, &Widgets::DataGrid::onThemeChanged);
@@ -71,6 +168,15 @@ int Widgets::DataGrid::count() const
   return m_titles.count();
 }
 
+/**
+ * @brief Returns the virtualized row model used by the QML view.
+ * @return A pointer to the incremental row model of the widget.
+ */
+QAbstractListModel *Widgets::DataGrid::rows()
+{
+  return &m_rowModel;
+}
+
 /**
  * @brief Returns the alarm states of the datasets in the panel.
  * @return A vector of booleans representing the alarm states of the datasets.
@@ -124,14 +230,15 @@ const QStringList &Widgets::DataGrid::values() const
  */
 void Widgets::DataGrid::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::DataGrid::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   if (!isEnabled())
     return;
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardDataGrid, m_index))
   {
-    // Regular expression to check if the value is a number
-    static const QRegularExpression regex("^[+-]?(\\d*\\.)?\\d+$");
-
     // Get the datagrid group and update the value readings
     bool changed = false;
     const auto &group = GET_GROUP(SerialStudio::DashboardDataGrid, m_index);
@@ -139,33 +246,48 @@ void Widgets::DataGrid::updateData()
     {
       // Get the dataset and its values
       const auto &dataset = group.getDataset(i);
-      const auto alarmValue = dataset.alarm();
       auto value = dataset.value();
 
+      // Skip datasets whose raw value did not change, the parsed/formatted
+      // result (and alarm state) would be identical to the displayed one
+      if (m_rawValues.at(i) == value)
+        continue;
+      m_rawValues[i] = value;
+
       // Check if dataset is a number
       bool isNumber;
       const double n = value.toDouble(&isNumber);
 
-      // Process dataset numerical value
+      // Evaluate the precompiled alarm rule for the parsed value
       bool alarm = false;
       if (isNumber)
       {
-        value = QString::number(n, 'f', UI::Dashboard::instance().precision());
+        value = Misc::Utilities::formatDouble(
+            n, UI::Dashboard::instance().precision());
+        const auto alarmValue = m_alarmLevels.at(i);
         alarm = (alarmValue != 0 && n >= alarmValue);
       }
 
       // Update the alarm state
+      QList<int> roles;
       if (m_alarms[i] != alarm)
       {
-        changed = true;
         m_alarms[i] = alarm;
+        roles.append(DataGridRowModel::AlarmRole);
       }
 
       // Update value text
       if (m_values[i] != value)
       {
-        changed = true;
         m_values[i] = value;
+        roles.append(DataGridRowModel::ValueRole);
+      }
+
+      // Notify the view about the modified cells only
+      if (!roles.isEmpty())
+      {
+        changed = true;
+        m_rowModel.notifyRowChanged(i, roles);
       }
     }
 
@@ -181,9 +303,7 @@ void Widgets::DataGrid::updateData()
  */
 void Widgets::DataGrid::onThemeChanged()
 {
-  // clang-format off
-  const auto colors = Misc::ThemeManager::instance().colors()["widget_colors"].toArray();
-  // clang-format on
+  const auto &theme = Misc::ThemeManager::instance();
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardDataGrid, m_index))
   {
@@ -194,13 +314,11 @@ void Widgets::DataGrid::onThemeChanged()
     for (int i = 0; i < group.datasetCount(); ++i)
     {
       const auto &dataset = group.getDataset(i);
-      const auto index = dataset.index() - 1;
-      const auto color = colors.count() > index
-                             ? colors.at(index).toString()
-                             : colors.at(index % colors.count()).toString();
+      const auto color = theme.widgetColor(dataset.index() - 1).name();
       m_colors[i] = color;
     }
 
+    m_rowModel.notifyColorsChanged();
     Q_EMIT themeChanged();
   }
 }
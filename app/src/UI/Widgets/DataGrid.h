@@ -22,15 +22,62 @@
 #pragma once
 
 #include <QtQuick>
+#include <QAbstractListModel>
 
 namespace Widgets
 {
+class DataGrid;
+
+/**
+ * @brief Incremental row model for the DataGrid widget.
+ *
+ * Exposes the datasets of a data grid group as a flat item model so that the
+ * QML view can virtualize its rows (only visible delegates are materialized)
+ * and receive per-cell @c dataChanged notifications instead of re-reading the
+ * full value list on every dashboard update.
+ *
+ * The model does not own any data, it only provides a view over the string
+ * lists maintained by the parent DataGrid widget.
+ */
+class DataGridRowModel : public QAbstractListModel
+{
+  Q_OBJECT
+
+public:
+  enum DataGridRoles
+  {
+    TitleRole = Qt::UserRole + 1,
+    UnitsRole,
+    ValueRole,
+    AlarmRole,
+    ColorRole
+  };
+
+  explicit DataGridRowModel(DataGrid *parent);
+
+  [[nodiscard]] int
+  rowCount(const QModelIndex &parent = QModelIndex()) const override;
+  [[nodiscard]] QVariant data(const QModelIndex &index,
+                              int role) const override;
+  [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+private:
+  void notifyRowChanged(int row, const QList<int> &roles);
+  void notifyColorsChanged();
+
+private:
+  DataGrid *m_dataGrid;
+
+  friend class DataGrid;
+};
+
 class DataGrid : public QQuickItem
 {
   Q_OBJECT
   Q_PROPERTY(int count READ count CONSTANT)
   Q_PROPERTY(QStringList units READ units CONSTANT)
   Q_PROPERTY(QStringList titles READ titles CONSTANT)
+  Q_PROPERTY(QAbstractListModel* rows READ rows CONSTANT)
   Q_PROPERTY(QStringList values READ values NOTIFY updated)
   Q_PROPERTY(QList<bool> alarms READ alarms NOTIFY updated)
   Q_PROPERTY(QStringList colors READ colors NOTIFY themeChanged)
@@ -43,6 +90,7 @@ public:
   explicit DataGrid(const int index = -1, QQuickItem *parent = nullptr);
 
   [[nodiscard]] int count() const;
+  [[nodiscard]] QAbstractListModel *rows();
   [[nodiscard]] const QList<bool> &alarms() const;
 
   [[nodiscard]] const QStringList &units() const;
@@ -62,5 +110,10 @@ private:
   QStringList m_titles;
   QStringList m_values;
   QStringList m_colors;
+
+  QStringList m_rawValues;
+  QList<double> m_alarmLevels;
+
+  DataGridRowModel m_rowModel;
 };
 } // namespace Widgets
@@ -19,11 +19,109 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <QtMath>
+
+#include "SIMD/SIMD.h"
 #include "UI/Dashboard.h"
 #include "UI/Widgets/FFTPlot.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
+
+/**
+ * @brief Constructs a worker that owns the FFT plan for one widget.
+ *
+ * The transformer (a fixed-size real-input calculator from QRealFourier) and
+ * the scratch buffers are created once here, so per-transform work is limited
+ * to the FFT itself and the magnitude conversion.
+ *
+ * @param samples The requested number of FFT samples (clamped to the nearest
+ *                supported fixed size).
+ * @param samplingRate The sampling rate reported by the dataset.
+ * @param parent The parent QObject.
+ */
+Widgets::FFTWorker::FFTWorker(const int samples, const int samplingRate,
+                              QObject *parent)
+  : QObject(parent)
+  , m_size(0)
+  , m_samplingRate(samplingRate)
+  , m_transformer(0, QStringLiteral("None"))
+{
+  // Initialize FFT size
+  int size = qMax(8, samples);
+  while (m_transformer.setSize(size) != QFourierTransformer::FixedSize)
+    --size;
+
+  // Set the size
+  m_size = size;
+
+  // Allocate FFT and sample arrays
+  m_fft.reset(new float[m_size]);
+  m_samples.reset(new float[m_size]);
+}
+
+/**
+ * @brief Returns the effective (fixed) FFT size used by the transformer.
+ */
+int Widgets::FFTWorker::size() const
+{
+  return m_size;
+}
+
+/**
+ * @brief Computes the spectrum for the given windowed samples.
+ *
+ * Runs on the worker thread: performs the forward transform, converts the
+ * result into (frequency, dB) points and emits spectrumReady() so the widget
+ * can swap the finished spectrum in on the GUI thread.
+ *
+ * @param samples The windowed sample buffer produced by the widget.
+ */
+void Widgets::FFTWorker::transform(const QVector<float> &samples)
+{
+  // Copy samples into scratch storage, the transform mutates its input
+  const int count = qMin(m_size, static_cast<int>(samples.count()));
+  std::memcpy(m_samples.data(), samples.constData(), count * sizeof(float));
+
+  // Obtain FFT transformation
+  m_transformer.forwardTransform(m_samples.data(), m_fft.data());
+  m_transformer.rescale(m_fft.data());
+
+  // Create a final array with the magnitudes for each point
+  qreal maxMagnitude = 0;
+  QList<QPointF> spectrum;
+  spectrum.resize(m_size / 2);
+  for (int i = 0; i < m_size / 2; ++i)
+  {
+    const qreal re = m_fft[i];
+    const qreal im = m_fft[m_size / 2 + i];
+    const qreal m = sqrt(re * re + im * im);
+    const qreal f
+        = static_cast<qreal>(i) * m_samplingRate / static_cast<qreal>(m_size);
+    spectrum[i] = QPointF(f, m);
+    if (m > maxMagnitude)
+      maxMagnitude = m;
+  }
+
+  // Convert to decibels
+  for (int i = 0; i < m_size / 2; ++i)
+  {
+    const qreal m = spectrum[i].y() / maxMagnitude;
+    const qreal dB = (m > 0) ? 20 * log10(m) : -100;
+    spectrum[i].setY(dB);
+  }
+
+  // Deliver the finished spectrum to the widget
+  Q_EMIT spectrumReady(spectrum);
+}
 
 /**
  * @brief Constructs a new FFTPlot widget.
+ *
+ * The FFT plan lives in an FFTWorker on a dedicated worker thread, so the
+ * transforms of all FFT widgets run concurrently instead of stacking on the
+ * GUI thread. The Hann window table is precomputed once here and applied with
+ * SIMD before each dispatch.
+ *
  * @param index The index of the FFT plot in the Dashboard.
  * @param parent The parent QQuickItem.
  */
@@ -32,31 +130,44 @@ Widgets::FFTPlot::FFTPlot(const int index, QQuickItem *parent)
   , m_size(0)
   , m_index(index)
   , m_samplingRate(0)
+  , m_transformPending(false)
   , m_minX(0)
   , m_maxX(0)
   , m_minY(0)
   , m_maxY(0)
-  , m_transformer(0, QStringLiteral("Hann"))
+  , m_worker(nullptr)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardFFT, m_index))
   {
     // Get FFT dataset
     const auto &dataset = GET_DATASET(SerialStudio::DashboardFFT, m_index);
 
-    // Initialize FFT size
-    int size = qMax(8, dataset.fftSamples());
-    while (m_transformer.setSize(size) != QFourierTransformer::FixedSize)
-      --size;
-
-    // Set the size
-    m_size = size;
-
     // Obtain sampling rate from dataset
     m_samplingRate = dataset.fftSamplingRate();
 
-    // Allocate FFT and sample arrays
-    m_fft.reset(new float[m_size]);
-    m_samples.reset(new float[m_size]);
+    // Create the FFT worker and move it to its own thread
+    m_worker = new FFTWorker(dataset.fftSamples(), m_samplingRate);
+    m_size = m_worker->size();
+    m_worker->moveToThread(&m_workerThread);
+    m_workerThread.start();
+
+    // Dispatch windowed samples & receive finished spectra asynchronously
+    connect(this, &FFTPlot::samplesReady, m_worker, &FFTWorker::transform,
+            Qt::QueuedConnection);
+    connect(m_worker, &FFTWorker::spectrumReady, this,
+            &FFTPlot::onSpectrumReady, Qt::QueuedConnection);
+
+    // Allocate the sample buffer
+    m_samples.resize(m_size);
+
+    // Precompute the Hann window table, applied with SIMD in updateData()
+    // instead of the scalar per-pass windowing done by the transformer
+    m_window.reset(new float[m_size]);
+    for (int i = 0; i < m_size; ++i)
+      m_window[i] = 0.5f
+                    - 0.5f
+                          * static_cast<float>(
+                              qCos((2.0 * M_PI * i) / (m_size - 1)));
 
     // Set axis ranges
     m_minX = 0;
@@ -122,6 +233,10 @@ qreal Widgets::FFTPlot::yTickInterval() const
 
 /**
  * @brief Draws the FFT data on the given QLineSeries.
+ *
+ * Renders the latest spectrum completed by the worker and schedules a new
+ * transform if none is in flight.
+ *
  * @param series The QLineSeries to draw the data on.
  */
 void Widgets::FFTPlot::draw(QLineSeries *series)
@@ -135,11 +250,20 @@ void Widgets::FFTPlot::draw(QLineSeries *series)
 }
 
 /**
- * @brief Updates the FFT data.
+ * @brief Dispatches the current samples to the FFT worker.
+ *
+ * Converts the sample buffer to floats and applies the cached window in one
+ * SIMD pass, then hands the windowed samples to the worker thread. At most
+ * one transform per widget is in flight at a time; refreshes that arrive
+ * while the worker is busy simply redraw the previous spectrum.
  */
 void Widgets::FFTPlot::updateData()
 {
-  if (!isEnabled())
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::FFTPlot::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
+  if (!isEnabled() || !m_worker || m_transformPending)
     return;
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardFFT, m_index))
@@ -147,35 +271,22 @@ void Widgets::FFTPlot::updateData()
     // Get the plot data
     const auto &data = UI::Dashboard::instance().fftData(m_index);
 
-    // Obtain samples from data
-    for (int i = 0; i < m_size; ++i)
-      m_samples[i] = static_cast<float>(data[i]);
-
-    // Obtain FFT transformation
-    m_transformer.forwardTransform(m_samples.data(), m_fft.data());
-    m_transformer.rescale(m_fft.data());
-
-    // Create a final array with the magnitudes for each point
-    qreal maxMagnitude = 0;
-    m_data.resize(m_size / 2);
-    for (int i = 0; i < m_size / 2; ++i)
-    {
-      const qreal re = m_fft[i];
-      const qreal im = m_fft[m_size / 2 + i];
-      const qreal m = sqrt(re * re + im * im);
-      const qreal f
-          = static_cast<qreal>(i) * m_samplingRate / static_cast<qreal>(m_size);
-      m_data[i] = QPointF(f, m);
-      if (m > maxMagnitude)
-        maxMagnitude = m;
-    }
-
-    // Convert to decibels
-    for (int i = 0; i < m_size / 2; ++i)
-    {
-      const qreal m = m_data[i].y() / maxMagnitude;
-      const qreal dB = (m > 0) ? 20 * log10(m) : -100;
-      m_data[i].setY(dB);
-    }
+    // Convert samples to floats and apply the cached window in one SIMD pass
+    SIMD::applyWindow(data.constData(), m_window.data(), m_samples.data(),
+                      m_size);
+
+    // Hand the windowed samples to the worker thread
+    m_transformPending = true;
+    Q_EMIT samplesReady(m_samples);
   }
 }
+
+/**
+ * @brief Swaps in a spectrum finished by the worker thread.
+ * @param spectrum The (frequency, dB) points to display.
+ */
+void Widgets::FFTPlot::onSpectrumReady(const QList<QPointF> &spectrum)
+{
+  m_data = spectrum;
+  m_transformPending = false;
+}
@@ -22,12 +22,46 @@
 #pragma once
 
 #include <QtQuick>
+#include <QThread>
 #include <QVector>
 #include <QLineSeries>
 #include <qfouriertransformer.h>
 
 namespace Widgets
 {
+/**
+ * @brief Computes FFT spectra for an FFTPlot widget off the GUI thread.
+ *
+ * The worker owns the transformer plan and its scratch buffers and lives on a
+ * dedicated worker thread, so the transform and the magnitude/decibel
+ * conversion run concurrently for every FFT widget instead of stacking on the
+ * render thread. Finished spectra are delivered back to the widget through a
+ * queued signal and swapped in on the GUI thread.
+ */
+class FFTWorker : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit FFTWorker(const int samples, const int samplingRate,
+                     QObject *parent = nullptr);
+
+  [[nodiscard]] int size() const;
+
+signals:
+  void spectrumReady(const QList<QPointF> &spectrum);
+
+public slots:
+  void transform(const QVector<float> &samples);
+
+private:
+  int m_size;
+  int m_samplingRate;
+  QFourierTransformer m_transformer;
+  QScopedArrayPointer<float> m_fft;
+  QScopedArrayPointer<float> m_samples;
+};
+
 /**
  * @brief A widget that plots the FFT of a dataset.
  */
@@ -45,6 +79,10 @@ public:
   explicit FFTPlot(const int index = -1, QQuickItem *parent = nullptr);
   ~FFTPlot()
   {
+    m_workerThread.quit();
+    m_workerThread.wait();
+    delete m_worker;
+
     m_data.clear();
     m_data.squeeze();
   }
@@ -56,26 +94,32 @@ public:
   [[nodiscard]] qreal xTickInterval() const;
   [[nodiscard]] qreal yTickInterval() const;
 
+signals:
+  void samplesReady(const QVector<float> &samples);
+
 public slots:
   void draw(QLineSeries *series);
 
 private slots:
   void updateData();
+  void onSpectrumReady(const QList<QPointF> &spectrum);
 
 private:
   int m_size;
   int m_index;
   int m_samplingRate;
+  bool m_transformPending;
 
   qreal m_minX;
   qreal m_maxX;
   qreal m_minY;
   qreal m_maxY;
 
-  QFourierTransformer m_transformer;
+  QThread m_workerThread;
+  FFTWorker *m_worker;
 
   QList<QPointF> m_data;
-  QScopedArrayPointer<float> m_fft;
-  QScopedArrayPointer<float> m_samples;
+  QVector<float> m_samples;
+  QScopedArrayPointer<float> m_window;
 };
 } // namespace Widgets
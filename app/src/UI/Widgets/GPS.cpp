@@ -19,8 +19,12 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <QtMath>
+
 #include "UI/Dashboard.h"
 #include "UI/Widgets/GPS.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
 
 /**
  * @brief Constructs a GPS widget.
@@ -33,9 +37,15 @@ Widgets::GPS::GPS(const int index, QQuickItem *parent)
   , m_altitude(0)
   , m_latitude(0)
   , m_longitude(0)
+  , m_trailCount(0)
+  , m_trailTipLat(0)
+  , m_trailTipLon(0)
+  , m_trailAnchorLat(0)
+  , m_trailAnchorLon(0)
+  , m_trailTolerance(2.5)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardGPS, m_index))
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::valuesUpdated, this,
             &Widgets::GPS::updateData);
 }
 
@@ -63,6 +73,31 @@ qreal Widgets::GPS::longitude() const
   return m_longitude;
 }
 
+/**
+ * Returns the corridor width (in meters) used to simplify the breadcrumb
+ * trail as fixes arrive.
+ */
+qreal Widgets::GPS::trailTolerance() const
+{
+  return m_trailTolerance;
+}
+
+/**
+ * Changes the corridor width (in meters) used to simplify the breadcrumb
+ * trail. Larger values drop more detail and store fewer points; a value of
+ * zero keeps every fix that moves the marker. Only affects points recorded
+ * after the change, the already-committed trail is left as-is.
+ */
+void Widgets::GPS::setTrailTolerance(const qreal tolerance)
+{
+  const auto t = qMax(0.0, tolerance);
+  if (!qFuzzyCompare(t, m_trailTolerance))
+  {
+    m_trailTolerance = t;
+    Q_EMIT trailToleranceChanged();
+  }
+}
+
 /**
  * Checks if the widget is enabled, if so, the widget shall be updated
  * to process the latest data frame.
@@ -72,6 +107,10 @@ qreal Widgets::GPS::longitude() const
  */
 void Widgets::GPS::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::GPS::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   if (!isEnabled())
     return;
 
@@ -84,20 +123,99 @@ void Widgets::GPS::updateData()
     {
       const auto &dataset = group.getDataset(i);
       if (dataset.widget() == QStringLiteral("lat"))
-        lat = dataset.value().toDouble();
+        lat = dataset.numericValue();
       else if (dataset.widget() == QStringLiteral("lon"))
-        lon = dataset.value().toDouble();
+        lon = dataset.numericValue();
       else if (dataset.widget() == QStringLiteral("alt"))
-        alt = dataset.value().toDouble();
+        alt = dataset.numericValue();
     }
 
-    if (!qFuzzyCompare(lat, m_latitude) || !qFuzzyCompare(lon, m_longitude)
-        || !qFuzzyCompare(alt, m_altitude))
+    // Mutate every property first, including the trail simplifier state
+    const bool moved
+        = !qFuzzyCompare(lat, m_latitude) || !qFuzzyCompare(lon, m_longitude);
+    const bool climbed = !qFuzzyCompare(alt, m_altitude);
+    m_latitude = lat;
+    m_longitude = lon;
+    m_altitude = alt;
+    if (moved)
+      recordTrailPoint(lat, lon);
+
+    // Only notify the layers whose inputs actually changed, at most once
+    if (moved)
+      Q_EMIT positionChanged();
+    if (climbed)
+      Q_EMIT altitudeChanged();
+  }
+}
+
+/**
+ * @brief Feeds a fix through the online trail simplifier.
+ *
+ * Keeps the last committed trail vertex (the anchor) and the current trail
+ * tip. While the tip stays within @c trailTolerance meters of the straight
+ * line from the anchor to the new fix, the track is effectively straight,
+ * so the tip is slid forward in place (@c trailPointReplaced). When the tip
+ * falls outside the corridor the track bent, so the tip is committed as the
+ * new anchor and the fix becomes the new tip (@c trailPointAdded).
+ *
+ * Distances use a flat-earth approximation around the anchor, which is more
+ * than accurate enough at trail-segment scale.
+ */
+void Widgets::GPS::recordTrailPoint(const qreal latitude, const qreal longitude)
+{
+  // First two fixes seed the anchor and the tip
+  if (m_trailCount < 2)
+  {
+    if (m_trailCount == 0)
     {
-      m_latitude = lat;
-      m_altitude = alt;
-      m_longitude = lon;
-      Q_EMIT updated();
+      m_trailAnchorLat = latitude;
+      m_trailAnchorLon = longitude;
     }
+
+    else
+    {
+      m_trailTipLat = latitude;
+      m_trailTipLon = longitude;
+    }
+
+    ++m_trailCount;
+    Q_EMIT trailPointAdded(latitude, longitude);
+    return;
+  }
+
+  // Project the coordinates into local meters around the anchor
+  constexpr qreal metersPerDegLat = 111320.0;
+  const qreal metersPerDegLon
+      = metersPerDegLat * qCos(qDegreesToRadians(m_trailAnchorLat));
+  const qreal ax = 0, ay = 0;
+  const qreal bx = (longitude - m_trailAnchorLon) * metersPerDegLon;
+  const qreal by = (latitude - m_trailAnchorLat) * metersPerDegLat;
+  const qreal px = (m_trailTipLon - m_trailAnchorLon) * metersPerDegLon;
+  const qreal py = (m_trailTipLat - m_trailAnchorLat) * metersPerDegLat;
+
+  // Perpendicular distance of the current tip from the anchor->fix line
+  const qreal dx = bx - ax;
+  const qreal dy = by - ay;
+  const qreal length = qSqrt(dx * dx + dy * dy);
+  const qreal deviation
+      = length > 0 ? qAbs(dx * (ay - py) - dy * (ax - px)) / length : 0;
+
+  // Track is still straight, slide the tip forward in place
+  if (deviation < m_trailTolerance)
+  {
+    m_trailTipLat = latitude;
+    m_trailTipLon = longitude;
+    Q_EMIT trailPointReplaced(latitude, longitude);
+  }
+
+  // Track bent, commit the tip and start a new segment
+  else
+  {
+    m_trailAnchorLat = m_trailTipLat;
+    m_trailAnchorLon = m_trailTipLon;
+    m_trailTipLat = latitude;
+    m_trailTipLon = longitude;
+    ++m_trailCount;
+    Q_EMIT trailPointAdded(latitude, longitude);
   }
 }
@@ -27,16 +27,34 @@ namespace Widgets
 {
 /**
  * @brief A widget that displays the GPS data on a map.
+ *
+ * Position and altitude carry separate change notifications, so an
+ * altitude-only update never touches the marker/trail layer of the map and
+ * a stationary fix never invalidates anything at all.
+ *
+ * The widget also feeds the breadcrumb trail through an online corridor
+ * simplifier: while consecutive fixes stay within @c trailTolerance meters
+ * of the straight line from the last committed trail vertex, the trail tip
+ * is moved in place instead of growing the polyline. Only when the track
+ * actually bends does a new vertex get committed, so a 12-hour mission
+ * flying straight legs stores a handful of points instead of hundreds of
+ * thousands while the rendered shape stays within the tolerance.
  */
 class GPS : public QQuickItem
 {
   Q_OBJECT
-  Q_PROPERTY(qreal altitude READ altitude NOTIFY updated)
-  Q_PROPERTY(qreal latitude READ latitude NOTIFY updated)
-  Q_PROPERTY(qreal longitude READ longitude NOTIFY updated)
+  Q_PROPERTY(qreal altitude READ altitude NOTIFY altitudeChanged)
+  Q_PROPERTY(qreal latitude READ latitude NOTIFY positionChanged)
+  Q_PROPERTY(qreal longitude READ longitude NOTIFY positionChanged)
+  Q_PROPERTY(qreal trailTolerance READ trailTolerance WRITE setTrailTolerance
+                 NOTIFY trailToleranceChanged)
 
 signals:
-  void updated();
+  void altitudeChanged();
+  void positionChanged();
+  void trailToleranceChanged();
+  void trailPointAdded(const qreal latitude, const qreal longitude);
+  void trailPointReplaced(const qreal latitude, const qreal longitude);
 
 public:
   GPS(const int index = -1, QQuickItem *parent = nullptr);
@@ -44,14 +62,28 @@ public:
   [[nodiscard]] qreal altitude() const;
   [[nodiscard]] qreal latitude() const;
   [[nodiscard]] qreal longitude() const;
+  [[nodiscard]] qreal trailTolerance() const;
+
+public slots:
+  void setTrailTolerance(const qreal tolerance);
 
 private slots:
   void updateData();
 
+private:
+  void recordTrailPoint(const qreal latitude, const qreal longitude);
+
 private:
   int m_index;
   qreal m_altitude;
   qreal m_latitude;
   qreal m_longitude;
+
+  int m_trailCount;
+  qreal m_trailTipLat;
+  qreal m_trailTipLon;
+  qreal m_trailAnchorLat;
+  qreal m_trailAnchorLon;
+  qreal m_trailTolerance;
 };
 } // namespace Widgets
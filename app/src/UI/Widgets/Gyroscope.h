@@ -53,7 +53,6 @@ private:
   qreal m_yaw;
   qreal m_roll;
   qreal m_pitch;
-  QElapsedTimer m_timer;
 };
 
 } // namespace Widgets
@@ -0,0 +1,266 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "UI/Dashboard.h"
+#include "UI/Widgets/Histogram.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
+
+/**
+ * @brief Constructs a Histogram widget.
+ * @param index The index of the histogram in the Dashboard.
+ * @param parent The parent QQuickItem (optional).
+ */
+Widgets::Histogram::Histogram(const int index, QQuickItem *parent)
+  : QQuickItem(parent)
+  , m_index(index)
+  , m_drawnSamples(0)
+  , m_drawnBins(0)
+  , m_minX(0)
+  , m_maxX(1)
+  , m_minY(0)
+  , m_maxY(1)
+  , m_p50(0)
+  , m_p90(0)
+  , m_p99(0)
+  , m_count(0)
+{
+  if (VALIDATE_WIDGET(SerialStudio::DashboardHistogram, m_index))
+  {
+    const auto &dataset
+        = GET_DATASET(SerialStudio::DashboardHistogram, m_index);
+
+    m_xLabel = dataset.title();
+    if (!dataset.units().isEmpty())
+      m_xLabel += " (" + dataset.units() + ")";
+  }
+}
+
+/**
+ * @brief Returns the minimum X-axis value.
+ */
+qreal Widgets::Histogram::minX() const
+{
+  return m_minX;
+}
+
+/**
+ * @brief Returns the maximum X-axis value.
+ */
+qreal Widgets::Histogram::maxX() const
+{
+  return m_maxX;
+}
+
+/**
+ * @brief Returns the minimum Y-axis value.
+ */
+qreal Widgets::Histogram::minY() const
+{
+  return m_minY;
+}
+
+/**
+ * @brief Returns the maximum Y-axis value.
+ */
+qreal Widgets::Histogram::maxY() const
+{
+  return m_maxY;
+}
+
+/**
+ * @brief Returns the X-axis tick interval.
+ */
+qreal Widgets::Histogram::xTickInterval() const
+{
+  return UI::Dashboard::smartInterval(m_minX, m_maxX);
+}
+
+/**
+ * @brief Returns the Y-axis tick interval.
+ */
+qreal Widgets::Histogram::yTickInterval() const
+{
+  return UI::Dashboard::smartInterval(m_minY, m_maxY);
+}
+
+/**
+ * @brief Returns the X-axis label.
+ */
+const QString &Widgets::Histogram::xLabel() const
+{
+  return m_xLabel;
+}
+
+/**
+ * @brief Returns the estimated median of the recorded samples.
+ */
+qreal Widgets::Histogram::p50() const
+{
+  return m_p50;
+}
+
+/**
+ * @brief Returns the estimated 90th percentile of the recorded samples.
+ */
+qreal Widgets::Histogram::p90() const
+{
+  return m_p90;
+}
+
+/**
+ * @brief Returns the estimated 99th percentile of the recorded samples.
+ */
+qreal Widgets::Histogram::p99() const
+{
+  return m_p99;
+}
+
+/**
+ * @brief Returns the total number of recorded samples.
+ */
+quint64 Widgets::Histogram::sampleCount() const
+{
+  return m_count;
+}
+
+/**
+ * @brief Draws the distribution outline on the given series.
+ *
+ * The sketch is re-binned into a linear staircase covering the observed
+ * value range, with the bin count derived from the widget width. Refreshes
+ * with no new samples (and an unchanged bin count) are skipped entirely.
+ *
+ * @param series The QXYSeries to draw the distribution on.
+ */
+void Widgets::Histogram::draw(QXYSeries *series)
+{
+  if (!series)
+    return;
+
+  // Nothing changed since the last refresh, keep the uploaded geometry
+  const auto w = static_cast<qsizetype>(std::ceil(width()));
+  const auto bins = std::clamp<qsizetype>(w / 8, 16, 128);
+  const bool valid
+      = VALIDATE_WIDGET(SerialStudio::DashboardHistogram, m_index);
+  const quint64 written
+      = valid ? UI::Dashboard::instance().histogramData(m_index).count() : 0;
+  if (written == m_drawnSamples && bins == m_drawnBins)
+    return;
+
+  // Re-bin the sketch & upload the staircase geometry
+  m_drawnSamples = written;
+  m_drawnBins = bins;
+  updateData();
+  series->replace(m_data);
+  Q_EMIT series->update();
+}
+
+/**
+ * @brief Rebuilds the bin summaries & percentiles from the quantile sketch.
+ *
+ * Only cumulative-count queries against the fixed-size sketch are issued
+ * here, so the cost is proportional to the displayed bin count and
+ * independent of the number of recorded samples.
+ */
+void Widgets::Histogram::updateData()
+{
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::Histogram::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
+  if (!isEnabled())
+    return;
+
+  if (VALIDATE_WIDGET(SerialStudio::DashboardHistogram, m_index))
+  {
+    const auto &sketch = UI::Dashboard::instance().histogramData(m_index);
+    if (sketch.count() == 0)
+    {
+      m_data.clear();
+      return;
+    }
+
+    // Spread the observed value range over the displayed bins
+    qreal lo = sketch.minValue();
+    qreal hi = sketch.maxValue();
+    if (qFuzzyCompare(lo, hi))
+    {
+      lo -= 1;
+      hi += 1;
+    }
+
+    // Build a staircase outline, one step per bin
+    const qsizetype bins = std::max<qsizetype>(m_drawnBins, 1);
+    m_data.resize(bins * 2 + 2);
+    quint64 previous = 0;
+    quint64 maxCount = 0;
+    for (qsizetype i = 0; i < bins; ++i)
+    {
+      const qreal x0 = lo + (hi - lo) * i / bins;
+      const qreal x1 = lo + (hi - lo) * (i + 1) / bins;
+      const quint64 cumulative
+          = (i == bins - 1) ? sketch.count() : sketch.rank(x1);
+      const quint64 count = cumulative - qMin(previous, cumulative);
+      previous = cumulative;
+
+      m_data[i * 2 + 1] = QPointF(x0, count);
+      m_data[i * 2 + 2] = QPointF(x1, count);
+      maxCount = qMax(maxCount, count);
+    }
+
+    m_data[0] = QPointF(lo, 0);
+    m_data[bins * 2 + 1] = QPointF(hi, 0);
+
+    // Update the axis ranges
+    const qreal minX = std::floor(lo);
+    const qreal maxX = std::ceil(hi);
+    const qreal maxY = std::ceil(static_cast<qreal>(maxCount) * 1.1);
+    bool rangeMoved = false;
+    if (m_minX != minX || m_maxX != maxX || m_maxY != maxY)
+    {
+      m_minX = minX;
+      m_maxX = maxX;
+      m_minY = 0;
+      m_maxY = qMax(maxY, 1.0);
+      rangeMoved = true;
+    }
+
+    // Update the percentile estimates
+    const qreal p50 = sketch.quantile(0.50);
+    const qreal p90 = sketch.quantile(0.90);
+    const qreal p99 = sketch.quantile(0.99);
+    const bool percentilesMoved
+        = m_count != sketch.count() || !qFuzzyCompare(p50, m_p50)
+          || !qFuzzyCompare(p90, m_p90) || !qFuzzyCompare(p99, m_p99);
+    m_p50 = p50;
+    m_p90 = p90;
+    m_p99 = p99;
+    m_count = sketch.count();
+
+    // All state is final, fire each binding wave at most once per tick and
+    // skip it entirely when the readout did not change
+    if (rangeMoved)
+      Q_EMIT rangeChanged();
+    if (percentilesMoved)
+      Q_EMIT percentilesChanged();
+  }
+}
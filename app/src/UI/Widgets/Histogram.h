@@ -0,0 +1,102 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QVector>
+#include <QXYSeries>
+#include <QQuickItem>
+
+namespace Widgets
+{
+/**
+ * @brief A widget that displays the value distribution of a dataset.
+ *
+ * Backed by the streaming quantile sketch accumulated on the dashboard
+ * ingest thread: the model only reads bin summaries and percentile
+ * estimates from the sketch at display rate, so rendering cost stays
+ * constant regardless of how many samples were recorded.
+ */
+class Histogram : public QQuickItem
+{
+  Q_OBJECT
+  Q_PROPERTY(QString xLabel READ xLabel CONSTANT)
+  Q_PROPERTY(qreal minX READ minX NOTIFY rangeChanged)
+  Q_PROPERTY(qreal maxX READ maxX NOTIFY rangeChanged)
+  Q_PROPERTY(qreal minY READ minY NOTIFY rangeChanged)
+  Q_PROPERTY(qreal maxY READ maxY NOTIFY rangeChanged)
+  Q_PROPERTY(qreal xTickInterval READ xTickInterval NOTIFY rangeChanged)
+  Q_PROPERTY(qreal yTickInterval READ yTickInterval NOTIFY rangeChanged)
+  Q_PROPERTY(qreal p50 READ p50 NOTIFY percentilesChanged)
+  Q_PROPERTY(qreal p90 READ p90 NOTIFY percentilesChanged)
+  Q_PROPERTY(qreal p99 READ p99 NOTIFY percentilesChanged)
+  Q_PROPERTY(quint64 sampleCount READ sampleCount NOTIFY percentilesChanged)
+
+signals:
+  void rangeChanged();
+  void percentilesChanged();
+
+public:
+  explicit Histogram(const int index = -1, QQuickItem *parent = nullptr);
+  ~Histogram()
+  {
+    m_data.clear();
+    m_data.squeeze();
+  }
+
+  [[nodiscard]] qreal minX() const;
+  [[nodiscard]] qreal maxX() const;
+  [[nodiscard]] qreal minY() const;
+  [[nodiscard]] qreal maxY() const;
+  [[nodiscard]] qreal xTickInterval() const;
+  [[nodiscard]] qreal yTickInterval() const;
+  [[nodiscard]] const QString &xLabel() const;
+
+  [[nodiscard]] qreal p50() const;
+  [[nodiscard]] qreal p90() const;
+  [[nodiscard]] qreal p99() const;
+  [[nodiscard]] quint64 sampleCount() const;
+
+public slots:
+  void draw(QXYSeries *series);
+
+private slots:
+  void updateData();
+
+private:
+  int m_index;
+  quint64 m_drawnSamples;
+  qsizetype m_drawnBins;
+
+  qreal m_minX;
+  qreal m_maxX;
+  qreal m_minY;
+  qreal m_maxY;
+
+  qreal m_p50;
+  qreal m_p90;
+  qreal m_p99;
+  quint64 m_count;
+
+  QString m_xLabel;
+  QVector<QPointF> m_data;
+};
+} // namespace Widgets
@@ -0,0 +1,289 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "UI/Dashboard.h"
+#include "UI/Widgets/ImageFeed.h"
+
+#include "SIMD/SIMD.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
+
+/**
+ * @brief Decodes one base64 frame into a QImage.
+ *
+ * Runs on the worker thread: the base64 payload is expanded into raw bytes
+ * with the SIMD decoder (falling back to Qt's tolerant decoder when the
+ * payload carries separators or is unpadded) and handed to the Qt image
+ * readers. A malformed payload yields a null image, which the widget simply
+ * discards.
+ *
+ * @param payload The base64 text of the frame.
+ */
+void Widgets::ImageDecoder::decode(const QByteArray &payload)
+{
+  QByteArray raw;
+  raw.resize((payload.size() / 4) * 3);
+  const auto decoded
+      = SIMD::base64Decode(payload.constData(), payload.size(), raw.data());
+  if (decoded >= 0)
+    raw.truncate(decoded);
+  else
+    raw = QByteArray::fromBase64(payload);
+
+  Q_EMIT imageReady(QImage::fromData(raw));
+}
+
+/**
+ * @brief Returns the only instance of the class.
+ *
+ * The provider is handed to the QML engine with addImageProvider(), which
+ * takes ownership and deletes it together with the engine, so the instance
+ * is heap-allocated instead of using static storage.
+ */
+Widgets::ImageFeedProvider *Widgets::ImageFeedProvider::instance()
+{
+  static auto *provider = new ImageFeedProvider();
+  return provider;
+}
+
+/**
+ * @brief Constructs the image feed provider.
+ */
+Widgets::ImageFeedProvider::ImageFeedProvider()
+  : QQuickImageProvider(QQuickImageProvider::Image)
+{
+}
+
+/**
+ * @brief Returns the latest published frame for the given URL.
+ *
+ * The URL id has the form "<index>?<revision>"; the revision only exists to
+ * defeat the QML image cache and is ignored here.
+ *
+ * @param id The image id requested by QML.
+ * @param size Receives the size of the returned image.
+ * @param requestedSize The size requested by QML (unused, the Image element
+ *                      scales the frame itself).
+ */
+QImage Widgets::ImageFeedProvider::requestImage(const QString &id, QSize *size,
+                                                const QSize &requestedSize)
+{
+  Q_UNUSED(requestedSize);
+
+  const int index = id.section(QLatin1Char('?'), 0, 0).toInt();
+
+  QMutexLocker locker(&m_lock);
+  const QImage image = m_frames.value(index);
+  if (size)
+    *size = image.size();
+
+  return image;
+}
+
+/**
+ * @brief Publishes a decoded frame for the given widget index.
+ *
+ * @param index The relative index of the image feed widget.
+ * @param image The decoded frame.
+ */
+void Widgets::ImageFeedProvider::publish(const int index, const QImage &image)
+{
+  QMutexLocker locker(&m_lock);
+  m_frames.insert(index, image);
+}
+
+/**
+ * @brief Drops the stored frame for the given widget index.
+ *
+ * Called when an image feed widget is destroyed so stale frames do not
+ * outlive the dashboard layout that produced them.
+ *
+ * @param index The relative index of the image feed widget.
+ */
+void Widgets::ImageFeedProvider::remove(const int index)
+{
+  QMutexLocker locker(&m_lock);
+  m_frames.remove(index);
+}
+
+/**
+ * @brief Constructs an ImageFeed widget.
+ *
+ * The decoder lives on a dedicated worker thread, so base64 expansion and
+ * JPEG/PNG decompression of all image feeds run concurrently with the GUI
+ * instead of inside the QML Image element.
+ *
+ * @param index The index of the image feed in the Dashboard.
+ * @param parent The parent QQuickItem (optional).
+ */
+Widgets::ImageFeed::ImageFeed(const int index, QQuickItem *parent)
+  : QQuickItem(parent)
+  , m_index(index)
+  , m_hasFrame(false)
+  , m_decodePending(false)
+  , m_frameCount(0)
+  , m_droppedFrames(0)
+  , m_decoder(nullptr)
+{
+  if (VALIDATE_WIDGET(SerialStudio::DashboardImage, m_index))
+  {
+    // Create the decoder and move it to its own thread
+    m_decoder = new ImageDecoder();
+    m_decoder->moveToThread(&m_workerThread);
+    m_workerThread.start();
+
+    // Dispatch payloads & receive finished frames asynchronously
+    connect(this, &ImageFeed::payloadReady, m_decoder, &ImageDecoder::decode,
+            Qt::QueuedConnection);
+    connect(m_decoder, &ImageDecoder::imageReady, this,
+            &ImageFeed::onImageReady, Qt::QueuedConnection);
+
+    // React to dataset updates
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::valuesUpdated, this,
+            &ImageFeed::updateData);
+  }
+}
+
+/**
+ * @brief Stops the decoder thread & drops the published frame.
+ */
+Widgets::ImageFeed::~ImageFeed()
+{
+  m_workerThread.quit();
+  m_workerThread.wait();
+  delete m_decoder;
+
+  ImageFeedProvider::instance()->remove(m_index);
+}
+
+/**
+ * @brief Returns the provider URL of the latest decoded frame.
+ *
+ * The frame count suffix changes with every decoded frame, so a QML Image
+ * element bound to this property refetches from the provider instead of
+ * serving the previous frame from its cache. An empty string is returned
+ * until the first frame arrives.
+ */
+QString Widgets::ImageFeed::source() const
+{
+  if (!m_hasFrame)
+    return QString();
+
+  return QStringLiteral("image://imagefeed/%1?%2")
+      .arg(m_index)
+      .arg(m_frameCount);
+}
+
+/**
+ * @brief Returns @c true once at least one frame was decoded successfully.
+ */
+bool Widgets::ImageFeed::hasFrame() const
+{
+  return m_hasFrame;
+}
+
+/**
+ * @brief Returns the number of frames decoded & displayed so far.
+ */
+quint64 Widgets::ImageFeed::frameCount() const
+{
+  return m_frameCount;
+}
+
+/**
+ * @brief Returns the number of frames dropped because the decoder was busy.
+ */
+quint64 Widgets::ImageFeed::droppedFrames() const
+{
+  return m_droppedFrames;
+}
+
+/**
+ * @brief Dispatches newly arrived frames to the decoder thread.
+ *
+ * Only one decode is in flight per feed at any time; while the decoder is
+ * busy a newer payload replaces the queued one, so under pressure the feed
+ * drops intermediate frames and always decodes the most recent frame next.
+ */
+void Widgets::ImageFeed::updateData()
+{
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::ImageFeed::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
+  if (!isEnabled())
+    return;
+
+  if (VALIDATE_WIDGET(SerialStudio::DashboardImage, m_index))
+  {
+    const auto &dataset = GET_DATASET(SerialStudio::DashboardImage, m_index);
+    const auto &value = dataset.value();
+    if (value.isEmpty() || value == m_lastPayload)
+      return;
+
+    // Remember the payload so repeated samples of the same frame are skipped
+    m_lastPayload = value;
+
+    // Decoder busy, replace the queued payload & account the dropped frame
+    if (m_decodePending)
+    {
+      if (!m_queuedPayload.isEmpty())
+        ++m_droppedFrames;
+
+      m_queuedPayload = value;
+      return;
+    }
+
+    // Dispatch the payload to the decoder thread
+    m_decodePending = true;
+    Q_EMIT payloadReady(value.toLatin1());
+  }
+}
+
+/**
+ * @brief Publishes a finished frame & schedules the next queued decode.
+ *
+ * Runs on the GUI thread via a queued connection. The decoded frame is
+ * handed to the image provider and the QML side is notified; if a newer
+ * payload arrived while the decoder was busy it is dispatched immediately.
+ *
+ * @param image The decoded frame (null when the payload was malformed).
+ */
+void Widgets::ImageFeed::onImageReady(const QImage &image)
+{
+  m_decodePending = false;
+
+  if (!image.isNull())
+  {
+    ++m_frameCount;
+    m_hasFrame = true;
+    ImageFeedProvider::instance()->publish(m_index, image);
+    Q_EMIT frameChanged();
+  }
+
+  // Decode the frame that arrived while the decoder was busy
+  if (!m_queuedPayload.isEmpty())
+  {
+    m_decodePending = true;
+    Q_EMIT payloadReady(m_queuedPayload.toLatin1());
+    m_queuedPayload.clear();
+  }
+}
@@ -0,0 +1,127 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QtQuick>
+#include <QThread>
+#include <QQuickImageProvider>
+
+namespace Widgets
+{
+/**
+ * @brief Decodes base64 camera frames into images off the GUI thread.
+ *
+ * The worker lives on a dedicated thread owned by its ImageFeed widget, so
+ * the base64 decode and the JPEG/PNG decompression never run on the render
+ * thread. Finished images are delivered back to the widget through a queued
+ * signal and published to the image provider on the GUI thread.
+ */
+class ImageDecoder : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void imageReady(const QImage &image);
+
+public slots:
+  void decode(const QByteArray &payload);
+};
+
+/**
+ * @brief Serves the latest decoded frame of every image feed to QML.
+ *
+ * Widgets publish decoded frames keyed by their relative widget index; the
+ * QML Image element fetches them through "image://imagefeed/<index>?<rev>"
+ * URLs, where the revision suffix forces a refetch without going through the
+ * QML image cache. Access is mutex-guarded because the QML engine may call
+ * requestImage() from its own threads.
+ */
+class ImageFeedProvider : public QQuickImageProvider
+{
+public:
+  static ImageFeedProvider *instance();
+
+  QImage requestImage(const QString &id, QSize *size,
+                      const QSize &requestedSize) override;
+
+  void publish(const int index, const QImage &image);
+  void remove(const int index);
+
+private:
+  ImageFeedProvider();
+
+private:
+  QMutex m_lock;
+  QHash<int, QImage> m_frames;
+};
+
+/**
+ * @brief A widget that displays a camera-style image feed from a dataset.
+ *
+ * The dataset value is expected to carry one base64-encoded JPEG or PNG
+ * frame per sample. Decoding happens on a per-feed worker thread; while a
+ * decode is in flight newly arrived frames only overwrite the pending
+ * payload, so under pressure intermediate frames are dropped and the stream
+ * degrades to a lower frame rate instead of queueing work behind the GUI.
+ */
+class ImageFeed : public QQuickItem
+{
+  Q_OBJECT
+  Q_PROPERTY(QString source READ source NOTIFY frameChanged)
+  Q_PROPERTY(bool hasFrame READ hasFrame NOTIFY frameChanged)
+  Q_PROPERTY(quint64 frameCount READ frameCount NOTIFY frameChanged)
+  Q_PROPERTY(quint64 droppedFrames READ droppedFrames NOTIFY frameChanged)
+
+signals:
+  void frameChanged();
+  void payloadReady(const QByteArray &payload);
+
+public:
+  explicit ImageFeed(const int index = -1, QQuickItem *parent = nullptr);
+  ~ImageFeed();
+
+  [[nodiscard]] QString source() const;
+  [[nodiscard]] bool hasFrame() const;
+  [[nodiscard]] quint64 frameCount() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+
+private slots:
+  void updateData();
+  void onImageReady(const QImage &image);
+
+private:
+  int m_index;
+  bool m_hasFrame;
+  bool m_decodePending;
+  quint64 m_frameCount;
+  quint64 m_droppedFrames;
+
+  QString m_lastPayload;
+  QString m_queuedPayload;
+
+  QThread m_workerThread;
+  ImageDecoder *m_decoder;
+};
+} // namespace Widgets
@@ -19,9 +19,91 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <QtAlgorithms>
+
 #include "UI/Dashboard.h"
 #include "Misc/ThemeManager.h"
 #include "UI/Widgets/LEDPanel.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
+
+/**
+ * @brief Constructs a row model for the given LEDPanel widget.
+ * @param parent The LEDPanel widget that owns the displayed data.
+ */
+Widgets::LEDPanelRowModel::LEDPanelRowModel(LEDPanel *parent)
+  : QAbstractListModel(parent)
+  , m_panel(parent)
+{
+}
+
+/**
+ * @brief Returns the number of LEDs in the panel group.
+ */
+int Widgets::LEDPanelRowModel::rowCount(const QModelIndex &parent) const
+{
+  if (parent.isValid())
+    return 0;
+
+  return m_panel->count();
+}
+
+/**
+ * @brief Returns the data stored for the given row & role.
+ */
+QVariant Widgets::LEDPanelRowModel::data(const QModelIndex &index,
+                                         int role) const
+{
+  const int row = index.row();
+  if (row < 0 || row >= m_panel->count())
+    return QVariant();
+
+  switch (role)
+  {
+    case TitleRole:
+      return m_panel->titles().at(row);
+    case StateRole:
+      return m_panel->states().at(row);
+    case AlarmRole:
+      return m_panel->alarms().at(row);
+    case ColorRole:
+      return m_panel->colors().at(row);
+    default:
+      return QVariant();
+  }
+}
+
+/**
+ * @brief Returns the role names used by the QML delegates.
+ */
+QHash<int, QByteArray> Widgets::LEDPanelRowModel::roleNames() const
+{
+  static const QHash<int, QByteArray> roles = {{TitleRole, "title"},
+                                               {StateRole, "state"},
+                                               {AlarmRole, "alarm"},
+                                               {ColorRole, "ledColor"}};
+  return roles;
+}
+
+/**
+ * @brief Emits a per-row @c dataChanged notification for the given roles.
+ */
+void Widgets::LEDPanelRowModel::notifyRowChanged(int row,
+                                                 const QList<int> &roles)
+{
+  const auto idx = index(row);
+  Q_EMIT dataChanged(idx, idx, roles);
+}
+
+/**
+ * @brief Refreshes the color role of every row after a theme change.
+ */
+void Widgets::LEDPanelRowModel::notifyColorsChanged()
+{
+  const int count = m_panel->count();
+  if (count > 0)
+    Q_EMIT dataChanged(index(0), index(count - 1), {ColorRole});
+}
 
 /**
  * @brief Constructs an LEDPanel widget.
@@ -31,6 +113,7 @@
 Widgets::LEDPanel::LEDPanel(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
+  , m_rowModel(this)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardLED, m_index))
   {
@@ -39,15 +122,24 @@ Widgets::LEDPanel::LEDPanel(const int index, QQuickItem *parent)
     m_titles.resize(group.datasetCount());
     m_colors.resize(group.datasetCount());
     m_alarms.resize(group.datasetCount());
+    m_alarmBits.resize((group.datasetCount() + 63) / 64);
+    m_stateBits.resize((group.datasetCount() + 63) / 64);
+    m_highLevels.resize(group.datasetCount());
+    m_alarmLevels.resize(group.datasetCount());
 
+    // Compile the match rules once: thresholds live in flat tables, so the
+    // per-frame loop is straight-line numeric comparisons
     for (int i = 0; i < group.datasetCount(); ++i)
     {
+      const auto &dataset = group.getDataset(i);
       m_states[i] = false;
       m_alarms[i] = false;
-      m_titles[i] = group.getDataset(i).title();
+      m_titles[i] = dataset.title();
+      m_highLevels[i] = dataset.ledHigh();
+      m_alarmLevels[i] = dataset.alarm();
     }
 
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::valuesUpdated, this,
             &LEDPanel::updateData);
 
     m_alarmTimer.setInterval(250);
@@ -71,6 +163,15 @@ int Widgets::LEDPanel::count() const
   return m_titles.count();
 }
 
+/**
+ * @brief Returns the virtualized row model used by the QML view.
+ * @return A pointer to the incremental row model of the widget.
+ */
+QAbstractListModel *Widgets::LEDPanel::rows()
+{
+  return &m_rowModel;
+}
+
 /**
  * @brief Returns the alarm states of the LEDs in the panel.
  * @return A vector of boolean values representing the alarm states of the LEDs.
@@ -115,37 +216,73 @@ const QStringList &Widgets::LEDPanel::titles() const
  */
 void Widgets::LEDPanel::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::LEDPanel::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   if (!isEnabled())
     return;
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardLED, m_index))
   {
-    // Get the LED group and update the LED states
-    bool changed = false;
+    // Pack the new LED & alarm states into bit words
     const auto &group = GET_GROUP(SerialStudio::DashboardLED, m_index);
+    const int words = m_stateBits.count();
+    QVarLengthArray<quint64, 8> alarmBits(words);
+    QVarLengthArray<quint64, 8> stateBits(words);
+    std::fill(alarmBits.begin(), alarmBits.end(), 0);
+    std::fill(stateBits.begin(), stateBits.end(), 0);
     for (int i = 0; i < group.datasetCount(); ++i)
     {
-      // Get the dataset and its values
-      const auto &dataset = group.getDataset(i);
-      const auto value = dataset.value().toDouble();
-      const auto alarmValue = dataset.alarm();
+      // Evaluate the precompiled threshold rules for the dataset value
+      const auto value = group.getDataset(i).numericValue();
+      const auto alarmValue = m_alarmLevels.at(i);
 
-      // Obtain the LED state
-      const bool enabled = (value >= dataset.ledHigh());
+      // Obtain the LED state, alarmed LEDs keep their current (blinking)
+      // state until the alarm clears
       const bool alarm = (alarmValue != 0 && value >= alarmValue);
+      const bool enabled = alarm ? m_states[i] : (value >= m_highLevels.at(i));
 
-      // Update the alarm state
-      if (m_alarms[i] != alarm)
-      {
-        changed = true;
-        m_alarms[i] = alarm;
-      }
+      // Pack the LED state into the bitmask words
+      if (alarm)
+        alarmBits[i / 64] |= (quint64(1) << (i % 64));
+      if (enabled)
+        stateBits[i / 64] |= (quint64(1) << (i % 64));
+    }
+
+    // XOR-delta against the previous bitmasks, a frame that flips a single
+    // LED only touches that row of the model
+    bool changed = false;
+    for (int w = 0; w < words; ++w)
+    {
+      const quint64 alarmDelta = alarmBits[w] ^ m_alarmBits[w];
+      const quint64 stateDelta = stateBits[w] ^ m_stateBits[w];
+      m_alarmBits[w] = alarmBits[w];
+      m_stateBits[w] = stateBits[w];
 
-      // Update the LED state
-      if (!alarm && m_states[i] != enabled)
+      quint64 delta = alarmDelta | stateDelta;
+      while (delta != 0)
       {
+        const int bit = qCountTrailingZeroBits(delta);
+        const quint64 mask = quint64(1) << bit;
+        const int i = w * 64 + bit;
+        delta &= delta - 1;
+
+        QList<int> roles;
+        if (alarmDelta & mask)
+        {
+          m_alarms[i] = (alarmBits[w] & mask) != 0;
+          roles.append(LEDPanelRowModel::AlarmRole);
+        }
+
+        if (stateDelta & mask)
+        {
+          m_states[i] = (stateBits[w] & mask) != 0;
+          roles.append(LEDPanelRowModel::StateRole);
+        }
+
         changed = true;
-        m_states[i] = enabled;
+        m_rowModel.notifyRowChanged(i, roles);
       }
     }
 
@@ -161,12 +298,22 @@ void Widgets::LEDPanel::updateData()
 void Widgets::LEDPanel::onAlarmTimeout()
 {
   bool changed = false;
-  for (int i = 0; i < m_alarms.count(); ++i)
+  for (int w = 0; w < m_alarmBits.count(); ++w)
   {
-    if (m_alarms[i])
+    // Toggle the state of every alarmed LED with a single XOR
+    quint64 blink = m_alarmBits[w];
+    if (blink == 0)
+      continue;
+
+    m_stateBits[w] ^= blink;
+    while (blink != 0)
     {
+      const int i = w * 64 + qCountTrailingZeroBits(blink);
+      blink &= blink - 1;
+
       changed = true;
       m_states[i] = !m_states[i];
+      m_rowModel.notifyRowChanged(i, {LEDPanelRowModel::StateRole});
     }
   }
 
@@ -180,9 +327,7 @@ void Widgets::LEDPanel::onAlarmTimeout()
  */
 void Widgets::LEDPanel::onThemeChanged()
 {
-  // clang-format off
-  const auto colors = Misc::ThemeManager::instance().colors()["widget_colors"].toArray();
-  // clang-format on
+  const auto &theme = Misc::ThemeManager::instance();
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardLED, m_index))
   {
@@ -193,13 +338,11 @@ void Widgets::LEDPanel::onThemeChanged()
     for (int i = 0; i < group.datasetCount(); ++i)
     {
       const auto &dataset = group.getDataset(i);
-      const auto index = dataset.index() - 1;
-      const auto color = colors.count() > index
-                             ? colors.at(index).toString()
-                             : colors.at(index % colors.count()).toString();
+      const auto color = theme.widgetColor(dataset.index() - 1).name();
       m_colors[i] = color;
     }
 
+    m_rowModel.notifyColorsChanged();
     Q_EMIT themeChanged();
   }
 }
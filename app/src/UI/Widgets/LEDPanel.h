@@ -24,9 +24,51 @@
 #include <QList>
 #include <QTimer>
 #include <QtQuick>
+#include <QAbstractListModel>
 
 namespace Widgets
 {
+class LEDPanel;
+
+/**
+ * @brief Incremental row model for the LEDPanel widget.
+ *
+ * Exposes the LEDs of a panel as a flat item model so that the QML view can
+ * virtualize its rows and receive per-LED @c dataChanged notifications for
+ * the indicators that actually flipped, instead of re-reading the full state
+ * list on every dashboard update.
+ */
+class LEDPanelRowModel : public QAbstractListModel
+{
+  Q_OBJECT
+
+public:
+  enum LEDPanelRoles
+  {
+    TitleRole = Qt::UserRole + 1,
+    StateRole,
+    AlarmRole,
+    ColorRole
+  };
+
+  explicit LEDPanelRowModel(LEDPanel *parent);
+
+  [[nodiscard]] int
+  rowCount(const QModelIndex &parent = QModelIndex()) const override;
+  [[nodiscard]] QVariant data(const QModelIndex &index,
+                              int role) const override;
+  [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+private:
+  void notifyRowChanged(int row, const QList<int> &roles);
+  void notifyColorsChanged();
+
+private:
+  LEDPanel *m_panel;
+
+  friend class LEDPanel;
+};
+
 /**
  * @brief A widget that displays a panel of LEDs.
  */
@@ -35,6 +77,7 @@ class LEDPanel : public QQuickItem
   Q_OBJECT
   Q_PROPERTY(int count READ count CONSTANT)
   Q_PROPERTY(QStringList titles READ titles CONSTANT)
+  Q_PROPERTY(QAbstractListModel* rows READ rows CONSTANT)
   Q_PROPERTY(QList<bool> states READ states NOTIFY updated)
   Q_PROPERTY(QList<bool> alarms READ alarms NOTIFY updated)
   Q_PROPERTY(QStringList colors READ colors NOTIFY themeChanged)
@@ -47,6 +90,7 @@ public:
   explicit LEDPanel(const int index = -1, QQuickItem *parent = nullptr);
 
   [[nodiscard]] int count() const;
+  [[nodiscard]] QAbstractListModel *rows();
   [[nodiscard]] const QList<bool> &alarms() const;
   [[nodiscard]] const QList<bool> &states() const;
   [[nodiscard]] const QStringList &colors() const;
@@ -64,6 +108,13 @@ private:
   QList<bool> m_states;
   QStringList m_titles;
   QStringList m_colors;
+
+  QList<quint64> m_alarmBits;
+  QList<quint64> m_stateBits;
+
+  QList<double> m_highLevels;
+  QList<double> m_alarmLevels;
+  LEDPanelRowModel m_rowModel;
 };
 
 } // namespace Widgets
@@ -23,6 +23,8 @@
 #include "UI/Dashboard.h"
 #include "Misc/ThemeManager.h"
 #include "UI/Widgets/MultiPlot.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
 
 /**
  * @brief Constructs a MultiPlot widget.
@@ -32,6 +34,11 @@
 Widgets::MultiPlot::MultiPlot(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
+  , m_redraw(true)
+  , m_rawDirty(true)
+  , m_rawWritten(0)
+  , m_drawnSamples(0)
+  , m_drawnThreshold(0)
   , m_minX(0)
   , m_maxX(0)
   , m_minY(0)
@@ -54,10 +61,11 @@ Widgets::MultiPlot::MultiPlot(const int index, QQuickItem *parent)
     // Obtain group title
     m_yLabel = group.title();
 
-    // Resize data container to fit curves
+    // Resize data containers to fit curves
     m_data.resize(group.datasetCount());
+    m_rawData.resize(group.datasetCount());
     for (auto i = 0; i < group.datasetCount(); ++i)
-      m_data[i].resize(UI::Dashboard::instance().points());
+      m_rawData[i].resize(UI::Dashboard::instance().points());
 
     // Connect to the dashboard signals
     connect(&UI::Dashboard::instance(), &UI::Dashboard::pointsChanged, this,
@@ -166,6 +174,12 @@ const QStringList &Widgets::MultiPlot::labels() const
 
 /**
  * @brief Draws the data on the given QLineSeries.
+ *
+ * Each curve is decimated with LTTB down to roughly two points per pixel of
+ * widget width before being handed to the renderer, so the geometry uploaded
+ * per frame stays bounded by the display resolution instead of the sample
+ * count.
+ *
  * @param series The QLineSeries to draw the data on.
  * @param index The index of the dataset to draw.
  */
@@ -173,12 +187,31 @@ void Widgets::MultiPlot::draw(QLineSeries *series, const int index)
 {
   if (series && index >= 0 && index < count())
   {
+    // Decide once per refresh (at curve 0) whether anything changed
     if (index == 0)
     {
-      updateData();
-      calculateAutoScaleRange();
+      const auto w = static_cast<qsizetype>(std::ceil(width()));
+      const auto threshold = std::max<qsizetype>(w * 2, 128);
+      const auto &data = UI::Dashboard::instance().multiplotData(m_index);
+      const quint64 written = data.y.isEmpty() ? 0 : data.y[0].written();
+
+      m_redraw = m_rawDirty || written != m_drawnSamples
+                 || threshold != m_drawnThreshold;
+      if (m_redraw)
+      {
+        m_drawnSamples = written;
+        m_drawnThreshold = threshold;
+        updateData();
+        calculateAutoScaleRange();
+      }
     }
 
+    // Nothing changed since the last refresh, keep the uploaded geometry
+    if (!m_redraw)
+      return;
+
+    SIMD::lttbDecimate(m_rawData[index], m_data[index], m_drawnThreshold);
+
     series->replace(m_data[index]);
     Q_EMIT series->update();
   }
@@ -186,24 +219,59 @@ void Widgets::MultiPlot::draw(QLineSeries *series, const int index)
 
 /**
  * @brief Updates the data of the multiplot.
+ *
+ * In the common case only the samples appended since the previous refresh
+ * are converted: the multiplot X-axis is the fixed sample index, so the
+ * existing Y-values are shifted in place and the new tail is read from the
+ * ring buffers. A full conversion pass only happens when the series was
+ * reconfigured or more samples arrived than the window holds.
  */
 void Widgets::MultiPlot::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::MultiPlot::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   if (!isEnabled())
     return;
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardMultiPlot, m_index))
   {
+    // Obtain number of appended samples since the last conversion
     const auto &data = UI::Dashboard::instance().multiplotData(m_index);
+    const quint64 written = data.y.isEmpty() ? 0 : data.y[0].written();
+    const quint64 appended = written - m_rawWritten;
+    m_rawWritten = written;
+
     for (int i = 0; i < data.y.count(); ++i)
     {
       const auto &series = data.y[i];
-      if (m_data[i].count() != series.count())
-        m_data[i].resize(series.count());
+      const qsizetype count = qMin(data.x->count(), series.count());
 
-      for (int j = 0; j < series.count(); ++j)
-        m_data[i][j] = QPointF(data.x->at(j), series[j]);
+      // Full conversion pass (reconfigured series or wrapped window)
+      if (m_rawDirty || m_rawData[i].count() != count
+          || appended >= static_cast<quint64>(count))
+      {
+        if (m_rawData[i].count() != count)
+          m_rawData[i].resize(count);
+
+        for (qsizetype j = 0; j < count; ++j)
+          m_rawData[i][j] = QPointF(data.x->at(j), series.at(j));
+      }
+
+      // Shift the Y-values in place and convert only the appended tail
+      else if (appended > 0)
+      {
+        const auto n = static_cast<qsizetype>(appended);
+        for (qsizetype j = 0; j < count - n; ++j)
+          m_rawData[i][j].ry() = m_rawData[i][j + n].y();
+
+        for (qsizetype j = count - n; j < count; ++j)
+          m_rawData[i][j] = QPointF(data.x->at(j), series.at(j));
+      }
     }
+
+    m_rawDirty = false;
   }
 }
 
@@ -217,7 +285,7 @@ void Widgets::MultiPlot::updateRange()
     return;
 
   // Clear dataset curves
-  for (auto &dataset : m_data)
+  for (auto &dataset : m_rawData)
   {
     dataset.clear();
     dataset.squeeze();
@@ -226,15 +294,21 @@ void Widgets::MultiPlot::updateRange()
   // Clear the data
   m_data.clear();
   m_data.squeeze();
+  m_rawData.clear();
+  m_rawData.squeeze();
 
   // Get the multiplot group and loop through each dataset
   const auto &group = GET_GROUP(SerialStudio::DashboardMultiPlot, m_index);
   for (int i = 0; i < group.datasetCount(); ++i)
   {
     m_data.append(QVector<QPointF>());
-    m_data.last().resize(UI::Dashboard::instance().points() + 1);
+    m_rawData.append(QVector<QPointF>());
+    m_rawData.last().resize(UI::Dashboard::instance().points() + 1);
   }
 
+  // Force a full conversion pass on the next refresh
+  m_rawDirty = true;
+
   // Update X-axis range
   m_minX = 0;
   m_maxX = UI::Dashboard::instance().points();
@@ -248,9 +322,7 @@ void Widgets::MultiPlot::updateRange()
  */
 void Widgets::MultiPlot::onThemeChanged()
 {
-  // clang-format off
-  const auto colors = Misc::ThemeManager::instance().colors()["widget_colors"].toArray();
-  // clang-format on
+  const auto &theme = Misc::ThemeManager::instance();
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardMultiPlot, m_index))
   {
@@ -261,10 +333,7 @@ void Widgets::MultiPlot::onThemeChanged()
     for (int i = 0; i < group.datasetCount(); ++i)
     {
       const auto &dataset = group.getDataset(i);
-      const auto index = dataset.index() - 1;
-      const auto color = colors.count() > index
-                             ? colors.at(index).toString()
-                             : colors.at(index % colors.count()).toString();
+      const auto color = theme.widgetColor(dataset.index() - 1).name();
 
       m_colors[i] = color;
     }
@@ -284,7 +353,7 @@ void Widgets::MultiPlot::calculateAutoScaleRange()
   const auto prevMaxY = m_maxY;
 
   // If the data is empty, set the range to 0-1
-  if (m_data.isEmpty())
+  if (m_rawData.isEmpty())
   {
     m_minY = 0;
     m_maxY = 1;
@@ -319,16 +388,14 @@ void Widgets::MultiPlot::calculateAutoScaleRange()
     m_minY = std::numeric_limits<qreal>::max();
     m_maxY = std::numeric_limits<qreal>::lowest();
 
-    // Loop through each dataset and find the min and max values
-    for (const auto &dataset : m_data)
+    // Loop through each dataset and find the min and max values, obtaining
+    // both extrema from a single pass over each series
+    for (const auto &dataset : m_rawData)
     {
-      m_minY = qMin(m_minY, SIMD::findMin(dataset, [](const QPointF &p) {
-                      return p.y();
-                    }));
-
-      m_maxY = qMax(m_maxY, SIMD::findMax(dataset, [](const QPointF &p) {
-                      return p.y();
-                    }));
+      const auto range
+          = SIMD::findMinMax(dataset, [](const QPointF &p) { return p.y(); });
+      m_minY = qMin(m_minY, range.first);
+      m_maxY = qMax(m_maxY, range.second);
     }
 
     // If the min and max are the same, set the range to 0-1
@@ -60,6 +60,8 @@ public:
 
     m_data.clear();
     m_data.squeeze();
+    m_rawData.clear();
+    m_rawData.squeeze();
   }
 
   [[nodiscard]] int count() const;
@@ -84,6 +86,12 @@ private slots:
 
 private:
   int m_index;
+  bool m_redraw;
+  bool m_rawDirty;
+  quint64 m_rawWritten;
+  quint64 m_drawnSamples;
+  qsizetype m_drawnThreshold;
+
   qreal m_minX;
   qreal m_maxX;
   qreal m_minY;
@@ -92,5 +100,6 @@ private:
   QStringList m_colors;
   QStringList m_labels;
   QVector<QVector<QPointF>> m_data;
+  QVector<QVector<QPointF>> m_rawData;
 };
 } // namespace Widgets
@@ -19,9 +19,13 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <tuple>
+
 #include "SIMD/SIMD.h"
 #include "UI/Dashboard.h"
 #include "UI/Widgets/Plot.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
 
 /**
  * @brief Constructs a Plot widget.
@@ -31,6 +35,15 @@
 Widgets::Plot::Plot(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
+  , m_envelope(false)
+  , m_rawDirty(true)
+  , m_viewDirty(false)
+  , m_rawSorted(true)
+  , m_rawWritten(0)
+  , m_drawnSamples(0)
+  , m_drawnThreshold(0)
+  , m_viewZoom(1)
+  , m_viewPan(0)
   , m_minX(0)
   , m_maxX(0)
   , m_minY(0)
@@ -139,26 +152,150 @@ const QString &Widgets::Plot::xLabel() const
   return m_xLabel;
 }
 
+/**
+ * @brief Returns @c true while min/max envelope rendering is enabled.
+ */
+bool Widgets::Plot::envelope() const
+{
+  return m_envelope;
+}
+
 /**
  * @brief Draws the data on the given QLineSeries.
+ *
+ * The full-resolution buffer is decimated down to roughly two points per
+ * pixel of widget width before being handed to the renderer, so the geometry
+ * uploaded per frame stays bounded by the display resolution instead of the
+ * sample count. By default LTTB is used to preserve the overall curve shape;
+ * in envelope mode a min/max decimation is used instead, which guarantees
+ * that single-sample spikes stay visible at any zoom level.
+ *
+ * When the user zooms into the plot, only the samples that fall within the
+ * visible X-range (plus one sample of margin on each side) are decimated, so
+ * the zoomed view is re-resolved from the full-resolution buffer at full
+ * pixel density instead of magnifying the decimated geometry.
+ *
+ * Refreshes with no new samples (and an unchanged widget width and view
+ * window) are skipped entirely: the renderer keeps displaying the previously
+ * uploaded geometry and no CPU-side conversion takes place.
+ *
  * @param series The QLineSeries to draw the data on.
  */
 void Widgets::Plot::draw(QXYSeries *series)
 {
-  if (series)
+  if (!series)
+    return;
+
+  // Nothing changed since the last refresh, keep the uploaded geometry
+  const auto w = static_cast<qsizetype>(std::ceil(width()));
+  const auto threshold = std::max<qsizetype>(w * 2, 128);
+  const bool valid = VALIDATE_WIDGET(SerialStudio::DashboardPlot, m_index);
+  const quint64 written
+      = valid ? UI::Dashboard::instance().plotData(m_index).y->written() : 0;
+  if (!m_rawDirty && !m_viewDirty && written == m_drawnSamples
+      && threshold == m_drawnThreshold)
+    return;
+
+  // Update the series
+  m_viewDirty = false;
+  m_drawnSamples = written;
+  m_drawnThreshold = threshold;
+  updateData();
+
+  // Zoomed in, re-resolve only the visible X-range at full pixel density
+  QVector<QPointF> visible;
+  const QVector<QPointF> *source = &m_rawData;
+  if (m_viewZoom > 1.0 && m_rawSorted && m_rawData.count() > threshold)
   {
-    updateData();
-    series->replace(m_data);
-    calculateAutoScaleRange();
-    Q_EMIT series->update();
+    // Obtain the world coordinates of the view window
+    const qreal fullRange = m_maxX - m_minX;
+    const qreal range = fullRange / m_viewZoom;
+    const qreal center = m_minX + fullRange / 2 + m_viewPan;
+
+    // Locate the visible slice of the sample window
+    const auto cmp = [](const QPointF &p, const qreal x) { return p.x() < x; };
+    auto begin = std::lower_bound(m_rawData.constBegin(), m_rawData.constEnd(),
+                                  center - range / 2, cmp);
+    auto end = std::lower_bound(begin, m_rawData.constEnd(), center + range / 2,
+                                cmp);
+
+    // Keep one sample beyond each edge so lines extend past the viewport
+    if (begin != m_rawData.constBegin())
+      --begin;
+    if (end != m_rawData.constEnd())
+      ++end;
+
+    // Hand the visible slice to the decimator
+    if (begin != end)
+    {
+      visible = m_rawData.mid(std::distance(m_rawData.constBegin(), begin),
+                              std::distance(begin, end));
+      source = &visible;
+    }
+  }
+
+  // Re-upload the decimated geometry
+  if (m_envelope)
+    SIMD::minMaxDecimate(*source, m_data, threshold);
+  else
+    SIMD::lttbDecimate(*source, m_data, threshold);
+  series->replace(m_data);
+  calculateAutoScaleRange();
+  Q_EMIT series->update();
+}
+
+/**
+ * @brief Enables or disables min/max envelope rendering.
+ *
+ * Forces a full conversion pass on the next refresh so the displayed series
+ * is rebuilt with the newly selected decimation strategy.
+ *
+ * @param enabled @c true to render the min/max envelope of each bucket.
+ */
+void Widgets::Plot::setEnvelope(const bool enabled)
+{
+  if (m_envelope != enabled)
+  {
+    m_envelope = enabled;
+    m_rawDirty = true;
+    Q_EMIT envelopeChanged();
+  }
+}
+
+/**
+ * @brief Registers the current pan/zoom state of the X-axis.
+ *
+ * Called by the QML view whenever the user pans or zooms, so the next
+ * refresh re-resolves the visible X-range from the full-resolution buffer
+ * instead of magnifying the previously decimated geometry.
+ *
+ * @param zoom Zoom factor of the X-axis (1 displays the full range).
+ * @param pan Pan offset of the X-axis, in world units.
+ */
+void Widgets::Plot::setViewWindow(const qreal zoom, const qreal pan)
+{
+  if (m_viewZoom != zoom || m_viewPan != pan)
+  {
+    m_viewZoom = qMax(zoom, 1.0);
+    m_viewPan = pan;
+    m_viewDirty = true;
   }
 }
 
 /**
  * @brief Updates the plot data from the Dashboard.
+ *
+ * In the common case only the samples appended since the previous refresh
+ * are converted: the existing window is shifted in place and the new tail is
+ * read from the ring buffers. A full conversion pass only happens when the
+ * series was reconfigured or more samples arrived than the window holds.
  */
 void Widgets::Plot::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::Plot::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   if (!isEnabled())
     return;
 
@@ -166,25 +303,56 @@ void Widgets::Plot::updateData()
   {
     // Get plotting data
     const auto &plotData = UI::Dashboard::instance().plotData(m_index);
-    const auto X = plotData.x;
-    const auto Y = plotData.y;
+    const auto *X = plotData.x;
+    const auto *Y = plotData.y;
+
+    // Obtain number of appended samples since the last conversion
+    const qsizetype count = qMin(X->count(), Y->count());
+    const quint64 written = Y->written();
+    const quint64 appended = written - m_rawWritten;
+    m_rawWritten = written;
+
+    // Full conversion pass (reconfigured series or wrapped window)
+    if (m_rawDirty || m_rawData.count() != count
+        || appended >= static_cast<quint64>(count))
+    {
+      if (m_rawData.count() != count)
+        m_rawData.resize(count);
+
+      for (qsizetype i = 0; i < count; ++i)
+        m_rawData[i] = QPointF(X->at(i), Y->at(i));
 
-    // Resize series array if required
-    if (m_data.count() != X->count())
-      m_data.resize(X->count());
+      m_rawDirty = false;
+      m_rawSorted = std::is_sorted(
+          m_rawData.constBegin(), m_rawData.constEnd(),
+          [](const QPointF &a, const QPointF &b) { return a.x() < b.x(); });
+    }
 
-    // Convert data to a list of points
-    int i = 0;
-    for (auto x = X->begin(); x != X->end(); ++x)
+    // Convert only the appended tail of the window
+    else if (appended > 0)
     {
-      if (Y->count() > i)
+      const auto n = static_cast<qsizetype>(appended);
+
+      // X-axis scrolls together with the samples, shift whole points
+      if (X->written() == written)
+        std::memmove(m_rawData.data(), m_rawData.data() + n,
+                     static_cast<size_t>(count - n) * sizeof(QPointF));
+
+      // Fixed sample-index X-axis, shift the Y-values only
+      else
       {
-        m_data[i] = QPointF(*x, Y->at(i));
-        ++i;
+        for (qsizetype i = 0; i < count - n; ++i)
+          m_rawData[i].ry() = m_rawData[i + n].y();
       }
 
-      else
-        break;
+      // Read the new samples from the ring buffers
+      for (qsizetype i = count - n; i < count; ++i)
+        m_rawData[i] = QPointF(X->at(i), Y->at(i));
+
+      // Shifting preserves order, only the appended tail can break it
+      const auto tail = qMax<qsizetype>(count - n - 1, 0);
+      for (qsizetype i = tail; m_rawSorted && i < count - 1; ++i)
+        m_rawSorted = m_rawData[i].x() <= m_rawData[i + 1].x();
     }
   }
 }
@@ -197,7 +365,12 @@ void Widgets::Plot::updateRange()
   // Clear memory
   m_data.clear();
   m_data.squeeze();
-  m_data.resize(UI::Dashboard::instance().points() + 1);
+  m_rawData.clear();
+  m_rawData.squeeze();
+  m_rawData.resize(UI::Dashboard::instance().points() + 1);
+
+  // Force a full conversion pass on the next refresh
+  m_rawDirty = true;
 
   // Obtain dataset information
   if (VALIDATE_WIDGET(SerialStudio::DashboardPlot, m_index))
@@ -312,7 +485,7 @@ bool Widgets::Plot::computeMinMaxValues(qreal &min, qreal &max,
   const auto prevMaxY = max;
 
   // If the data is empty, set the range to 0-1
-  if (m_data.isEmpty())
+  if (m_rawData.isEmpty())
   {
     min = 0;
     max = 1;
@@ -336,9 +509,8 @@ bool Widgets::Plot::computeMinMaxValues(qreal &min, qreal &max,
     min = std::numeric_limits<qreal>::max();
     max = std::numeric_limits<qreal>::lowest();
 
-    // Loop through the plot data and update the min and max
-    min = SIMD::findMin(m_data, extractor);
-    max = SIMD::findMax(m_data, extractor);
+    // Obtain the min and max of the full-resolution data in a single pass
+    std::tie(min, max) = SIMD::findMinMax(m_rawData, extractor);
 
     // If min and max are the same, adjust the range
     if (qFuzzyCompare(min, max))
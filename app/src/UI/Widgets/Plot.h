@@ -43,9 +43,11 @@ class Plot : public QQuickItem
   Q_PROPERTY(qreal maxY READ maxY NOTIFY rangeChanged)
   Q_PROPERTY(qreal xTickInterval READ xTickInterval NOTIFY rangeChanged)
   Q_PROPERTY(qreal yTickInterval READ yTickInterval NOTIFY rangeChanged)
+  Q_PROPERTY(bool envelope READ envelope WRITE setEnvelope NOTIFY envelopeChanged)
 
 signals:
   void rangeChanged();
+  void envelopeChanged();
 
 public:
   explicit Plot(const int index = -1, QQuickItem *parent = nullptr);
@@ -53,6 +55,8 @@ public:
   {
     m_data.clear();
     m_data.squeeze();
+    m_rawData.clear();
+    m_rawData.squeeze();
   }
 
   [[nodiscard]] qreal minX() const;
@@ -63,9 +67,12 @@ public:
   [[nodiscard]] qreal yTickInterval() const;
   [[nodiscard]] const QString &yLabel() const;
   [[nodiscard]] const QString &xLabel() const;
+  [[nodiscard]] bool envelope() const;
 
 public slots:
   void draw(QXYSeries *series);
+  void setEnvelope(const bool enabled);
+  void setViewWindow(const qreal zoom, const qreal pan);
 
 private slots:
   void updateData();
@@ -79,6 +86,16 @@ private:
 
 private:
   int m_index;
+  bool m_envelope;
+  bool m_rawDirty;
+  bool m_viewDirty;
+  bool m_rawSorted;
+  quint64 m_rawWritten;
+  quint64 m_drawnSamples;
+  qsizetype m_drawnThreshold;
+
+  qreal m_viewZoom;
+  qreal m_viewPan;
   qreal m_minX;
   qreal m_maxX;
   qreal m_minY;
@@ -86,5 +103,6 @@ private:
   QString m_yLabel;
   QString m_xLabel;
   QVector<QPointF> m_data;
+  QVector<QPointF> m_rawData;
 };
 } // namespace Widgets
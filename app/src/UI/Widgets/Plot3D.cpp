@@ -21,6 +21,7 @@
 
 #include <QCursor>
 
+#include "SIMD/SIMD.h"
 #include "UI/Dashboard.h"
 
 #include "Misc/TimerEvents.h"
@@ -28,6 +29,8 @@
 #include "Misc/ThemeManager.h"
 
 #include "UI/Widgets/Plot3D.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
 
 /**
  * @brief Constructs a Plot3D widget.
@@ -58,6 +61,11 @@ Widgets::Plot3D::Plot3D(const int index, QQuickItem *parent)
   , m_dirtyData(true)
   , m_dirtyGrid(true)
   , m_dirtyCameraIndicator(true)
+  , m_cameraMatrixDirty(true)
+  , m_renderedTotal(0)
+  , m_renderedCount(0)
+  , m_appendsSinceRefresh(0)
+  , m_renderedInterpolate(true)
 {
   // Configure QML item behavior
   setMipmap(true);
@@ -589,6 +597,10 @@ void Widgets::Plot3D::setInterpolationEnabled(const bool enabled)
  */
 void Widgets::Plot3D::updateData()
 {
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::Plot3D::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
   // Validate that the widget exists
   if (!VALIDATE_WIDGET(SerialStudio::DashboardPlot3D, m_index))
     return;
@@ -606,11 +618,7 @@ void Widgets::Plot3D::updateData()
 void Widgets::Plot3D::onThemeChanged()
 {
   // Obtain color for latest line data
-  auto c = Misc::ThemeManager::instance().colors()["widget_colors"].toArray();
-  if (c.count() > m_index)
-    m_lineHeadColor = c.at(m_index).toString();
-  else
-    m_lineHeadColor = c.at(m_index % c.count()).toString();
+  m_lineHeadColor = Misc::ThemeManager::instance().widgetColor(m_index);
 
   // Create gradient based on widget index
   QColor midCurve(m_lineHeadColor);
@@ -629,6 +637,9 @@ void Widgets::Plot3D::onThemeChanged()
   m_outerBackgroundColor = Misc::ThemeManager::instance().getColor("widget_window");
   // clang-format on
 
+  // Cached foreground was painted with the old colors, drop it
+  m_renderedCount = 0;
+
   // Mark all widget as dirty to force re-rendering
   markDirty();
 }
@@ -650,9 +661,36 @@ void Widgets::Plot3D::markDirty()
   m_dirtyData = true;
   m_dirtyBackground = true;
   m_dirtyCameraIndicator = true;
+  m_cameraMatrixDirty = true;
   update();
 }
 
+/**
+ * @brief Returns the composed camera matrix for the current view.
+ *
+ * The perspective/translate/rotate/scale composition is shared by the data
+ * and grid layers and only depends on the camera parameters and widget
+ * size, so it is rebuilt lazily when one of them changes (markDirty())
+ * instead of once per layer per repaint.
+ */
+const QMatrix4x4 &Widgets::Plot3D::cameraMatrix()
+{
+  if (m_cameraMatrixDirty)
+  {
+    m_cameraMatrix.setToIdentity();
+    m_cameraMatrix.perspective(45, float(width()) / height(), 0.1, 100);
+    m_cameraMatrix.translate(m_cameraOffsetX, m_cameraOffsetY,
+                             m_cameraOffsetZ);
+    m_cameraMatrix.rotate(m_cameraAngleX, 1, 0, 0);
+    m_cameraMatrix.rotate(m_cameraAngleY, 0, 1, 0);
+    m_cameraMatrix.rotate(m_cameraAngleZ, 0, 0, 1);
+    m_cameraMatrix.scale(m_zoom);
+    m_cameraMatrixDirty = false;
+  }
+
+  return m_cameraMatrix;
+}
+
 /**
  * @brief Renders the 3D plot foreground.
  *
@@ -665,16 +703,21 @@ void Widgets::Plot3D::drawData()
   // Obtain data from dashboard
   const auto &data = UI::Dashboard::instance().plotData3D(m_index);
   if (data.isEmpty())
+  {
+    m_renderedTotal = 0;
+    m_renderedCount = 0;
     return;
+  }
 
-  // Initialize camera matrix
-  QMatrix4x4 matrix;
-  matrix.perspective(45, float(width()) / height(), 0.1, 100);
-  matrix.translate(m_cameraOffsetX, m_cameraOffsetY, m_cameraOffsetZ);
-  matrix.rotate(m_cameraAngleX, 1, 0, 0);
-  matrix.rotate(m_cameraAngleY, 0, 1, 0);
-  matrix.rotate(m_cameraAngleZ, 0, 0, 1);
-  matrix.scale(m_zoom);
+  // Obtain the cached camera matrix
+  const QMatrix4x4 &matrix = cameraMatrix();
+
+  // Try the incremental tail path before re-rendering the whole capture
+  if (!anaglyphEnabled() && appendDataTail(matrix, data))
+  {
+    m_dirtyData = false;
+    return;
+  }
 
   // Render 3D pixmaps
   if (anaglyphEnabled())
@@ -688,6 +731,14 @@ void Widgets::Plot3D::drawData()
   else
     m_plotPixmap[0] = renderData(matrix, data);
 
+  // Remember what the cached pixmap contains so later frames can append
+  m_renderedMatrix = matrix;
+  m_appendsSinceRefresh = 0;
+  m_renderedCount = data.count();
+  m_renderedSize = m_plotPixmap[0].size();
+  m_renderedInterpolate = m_interpolate;
+  m_renderedTotal = UI::Dashboard::instance().plotData3DTotalPoints(m_index);
+
   // Mark dirty flag as false to avoid needless rendering
   m_dirtyData = false;
 }
@@ -700,14 +751,8 @@ void Widgets::Plot3D::drawData()
  */
 void Widgets::Plot3D::drawGrid()
 {
-  // Initialize camera matrix
-  QMatrix4x4 matrix;
-  matrix.perspective(45, float(width()) / height(), 0.1, 100);
-  matrix.translate(m_cameraOffsetX, m_cameraOffsetY, m_cameraOffsetZ);
-  matrix.rotate(m_cameraAngleX, 1, 0, 0);
-  matrix.rotate(m_cameraAngleY, 0, 1, 0);
-  matrix.rotate(m_cameraAngleZ, 0, 0, 1);
-  matrix.scale(m_zoom);
+  // Obtain the cached camera matrix
+  const QMatrix4x4 &matrix = cameraMatrix();
 
   // Render 3D pixmaps
   if (anaglyphEnabled())
@@ -1088,6 +1133,11 @@ QPixmap Widgets::Plot3D::renderCameraIndicator(const QMatrix4x4 &matrix)
  * Projects 3D plot points to 2D using the given matrix and draws a
  * gradient line from head to tail.
  *
+ * Long captures are rendered at a reduced level of detail: the capture is
+ * strided down so the painter processes a bounded number of points, and the
+ * head/tail gradient is quantized into color bands drawn as polylines, so
+ * render cost stays constant regardless of capture length.
+ *
  * @param matrix Transform matrix for projection.
  * @param data 3D plot points.
  * @return Rendered foreground pixmap.
@@ -1107,36 +1157,71 @@ QPixmap Widgets::Plot3D::renderData(const QMatrix4x4 &matrix,
   QPainter painter(&pixmap);
   painter.setRenderHint(QPainter::Antialiasing, true);
 
-  // Project 3D points to 2D screen space
+  // Select a level of detail that bounds the number of rendered points
+  constexpr qsizetype maxPoints = 4096;
+  qsizetype stride = 1;
+  if (data.count() > maxPoints)
+    stride = (data.count() + maxPoints - 1) / maxPoints;
+
+  // QVector<QVector3D> is tightly packed xyz triplets, which lets the
+  // projection kernel read the capture as a flat float array
+  static_assert(sizeof(QVector3D) == 3 * sizeof(float),
+                "QVector3D must be tightly packed");
+
+  // Project 3D points to 2D screen space (at the selected stride)
   QVector<QPointF> points;
   const float halfWidth = width() * 0.5;
   const float halfHeight = height() * 0.5;
-  for (const QVector3D &p : data)
+  if (stride == 1)
   {
-    QVector3D rearranged(p.x(), p.y(), p.z());
-    QVector4D transformed = matrix * QVector4D(rearranged, 1);
+    points.resize(data.count());
+    SIMD::projectPoints3D(matrix.constData(),
+                          reinterpret_cast<const float *>(data.constData()),
+                          data.count(), halfWidth, halfHeight, points.data());
+  }
+
+  // Striding active, compact the selected points & project the batch
+  else
+  {
+    QVector<QVector3D> selected;
+    selected.reserve(data.count() / stride + 2);
+    for (qsizetype i = 0; i < data.count(); i += stride)
+    {
+      // Always include the newest point so the head never lags behind
+      if (i + stride >= data.count())
+        i = data.count() - 1;
 
-    float x = halfWidth + (transformed.x() / transformed.w()) * halfWidth;
-    float y = halfHeight - (transformed.y() / transformed.w()) * halfHeight;
+      selected.append(data[i]);
+    }
 
-    points.append(QPointF(x, y));
+    points.resize(selected.count());
+    SIMD::projectPoints3D(
+        matrix.constData(), reinterpret_cast<const float *>(selected.constData()),
+        selected.count(), halfWidth, halfHeight, points.data());
   }
 
-  // Interpolate points by generated a gradient line
+  // Interpolate points by drawing a banded gradient line, each band shares
+  // one pen and is drawn as a single polyline instead of per-segment lines
   if (m_interpolate)
   {
+    constexpr qsizetype bands = 64;
     const auto &endColor = m_lineTailColor;
     const auto &startColor = m_lineHeadColor;
-    for (int i = 1; i < points.size(); ++i)
+    const qsizetype segments = points.size() - 1;
+    const qsizetype perBand = qMax<qsizetype>(1, segments / bands);
+    for (qsizetype start = 0; start < segments; start += perBand)
     {
+      const qsizetype end = qMin(start + perBand, segments);
+      const qreal tVal = qreal(start + end) / (2 * points.size());
+
       QColor c;
-      qreal tVal = qreal(i) / points.size();
       c.setRedF(startColor.redF() * (1 - tVal) + endColor.redF() * tVal);
       c.setGreenF(startColor.greenF() * (1 - tVal) + endColor.greenF() * tVal);
       c.setBlueF(startColor.blueF() * (1 - tVal) + endColor.blueF() * tVal);
 
       painter.setPen(QPen(c, 2));
-      painter.drawLine(points[i - 1], points[i]);
+      painter.drawPolyline(points.constData() + start,
+                           static_cast<int>(end - start + 1));
     }
   }
 
@@ -1153,6 +1238,97 @@ QPixmap Widgets::Plot3D::renderData(const QMatrix4x4 &matrix,
   return pixmap;
 }
 
+/**
+ * @brief Appends freshly captured points onto the cached foreground pixmap.
+ *
+ * Live captures append a handful of points per frame while the camera sits
+ * still, yet the foreground used to be re-projected and re-drawn in full on
+ * every update. When the camera, widget size and rendering mode are
+ * unchanged — and the capture only grew at its tail since the last full
+ * render — this method projects just the new points and paints them over
+ * the cached pixmap, so live trajectory plotting costs O(new points) per
+ * frame.
+ *
+ * The interpolated head/tail gradient is a function of the whole capture,
+ * so appended segments are drawn in the head color and a full re-render is
+ * forced periodically to re-spread the gradient. The fast path also bows
+ * out when the dashboard starts recycling old points (capture at capacity)
+ * or once the capture is long enough to be rendered at a reduced level of
+ * detail, both of which invalidate the cached projection.
+ *
+ * @param matrix Current camera matrix.
+ * @param data 3D plot points.
+ * @return @c true when the cached pixmap is up to date, @c false when the
+ *         caller must perform a full render.
+ */
+bool Widgets::Plot3D::appendDataTail(const QMatrix4x4 &matrix,
+                                     const PlotData3D &data)
+{
+  // Must match the level-of-detail cap in renderData()
+  constexpr qsizetype maxPoints = 4096;
+
+  // Full gradient refresh cadence, in appended frames
+  constexpr int refreshInterval = 24;
+
+  // Nothing cached yet, or camera/size/mode changed since the last render
+  if (m_renderedCount < 1 || m_plotPixmap[0].isNull())
+    return false;
+  if (m_renderedInterpolate != m_interpolate || matrix != m_renderedMatrix
+      || m_plotPixmap[0].size() != m_renderedSize)
+    return false;
+
+  // Gradient refresh due, or the capture renders with LOD striding
+  if (m_interpolate && m_appendsSinceRefresh >= refreshInterval)
+    return false;
+  if (data.count() > maxPoints)
+    return false;
+
+  // The capture must have grown purely at its tail; a mismatch between the
+  // appended total and the count delta means old points were recycled
+  const auto total = UI::Dashboard::instance().plotData3DTotalPoints(m_index);
+  if (total < m_renderedTotal)
+    return false;
+  const auto appended = total - m_renderedTotal;
+  if (appended != quint64(data.count() - m_renderedCount))
+    return false;
+
+  // Nothing new, the cached pixmap is current
+  if (appended == 0)
+    return true;
+
+  // Project the new points (plus the previous head to connect the line)
+  QVector<QPointF> points;
+  const qsizetype from = m_interpolate ? m_renderedCount - 1 : m_renderedCount;
+  points.resize(data.count() - from);
+  const float halfWidth = width() * 0.5;
+  const float halfHeight = height() * 0.5;
+  SIMD::projectPoints3D(
+      matrix.constData(), reinterpret_cast<const float *>(data.constData() + from),
+      points.count(), halfWidth, halfHeight, points.data());
+
+  // Paint the tail over the cached pixmap
+  QPainter painter(&m_plotPixmap[0]);
+  painter.setRenderHint(QPainter::Antialiasing, true);
+  if (m_interpolate)
+  {
+    painter.setPen(QPen(m_lineHeadColor, 2));
+    painter.drawPolyline(points.constData(), static_cast<int>(points.size()));
+    ++m_appendsSinceRefresh;
+  }
+  else
+  {
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(m_lineHeadColor);
+    for (const QPointF &pt : std::as_const(points))
+      painter.drawEllipse(pt, 1, 1);
+  }
+
+  // The cached pixmap now covers the whole capture
+  m_renderedTotal = total;
+  m_renderedCount = data.count();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 // Stereoscopic rendering eye position calculations
 //------------------------------------------------------------------------------
@@ -146,6 +146,7 @@ private slots:
 
 private:
   void markDirty();
+  const QMatrix4x4 &cameraMatrix();
 
   void drawData();
   void drawGrid();
@@ -156,6 +157,7 @@ private:
   QPixmap renderGrid(const QMatrix4x4 &matrix);
   QPixmap renderCameraIndicator(const QMatrix4x4 &matrix);
   QPixmap renderData(const QMatrix4x4 &matrix, const PlotData3D &data);
+  bool appendDataTail(const QMatrix4x4 &matrix, const PlotData3D &data);
 
   QPair<QMatrix4x4, QMatrix4x4> eyeTransformations(const QMatrix4x4 &matrix,
                                                    bool staticView = false);
@@ -215,5 +217,17 @@ private:
   qreal m_orbitOffsetX;
   qreal m_orbitOffsetY;
   QPointF m_lastMousePos;
+
+  // Composed camera matrix, rebuilt only when the camera or size changes
+  bool m_cameraMatrixDirty;
+  QMatrix4x4 m_cameraMatrix;
+
+  // State of the cached foreground pixmap, used by the tail-append path
+  QSize m_renderedSize;
+  quint64 m_renderedTotal;
+  qsizetype m_renderedCount;
+  int m_appendsSinceRefresh;
+  bool m_renderedInterpolate;
+  QMatrix4x4 m_renderedMatrix;
 };
 } // namespace Widgets
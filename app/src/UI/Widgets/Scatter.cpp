@@ -0,0 +1,273 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "UI/Dashboard.h"
+#include "UI/Widgets/Scatter.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
+#include "Misc/ThemeManager.h"
+
+/**
+ * @brief Constructs a Scatter widget.
+ * @param index The index of the scatter plot in the Dashboard.
+ * @param parent The parent QQuickItem (optional).
+ */
+Widgets::Scatter::Scatter(const int index, QQuickItem *parent)
+  : QQuickPaintedItem(parent)
+  , m_index(index)
+  , m_drawnSamples(0)
+  , m_minX(0)
+  , m_maxX(0)
+  , m_minY(0)
+  , m_maxY(0)
+{
+  if (VALIDATE_WIDGET(SerialStudio::DashboardScatter, m_index))
+  {
+    const auto &yDataset = GET_DATASET(SerialStudio::DashboardScatter, m_index);
+
+    const auto xAxisId = SerialStudio::activated() ? yDataset.xAxisId() : 0;
+    if (UI::Dashboard::instance().datasets().contains(xAxisId))
+    {
+      const auto &xDataset = UI::Dashboard::instance().datasets()[xAxisId];
+      m_xLabel = xDataset.title();
+      if (!xDataset.units().isEmpty())
+        m_xLabel += " (" + xDataset.units() + ")";
+    }
+
+    else
+      m_xLabel = tr("No X-Axis Source");
+
+    m_yLabel = yDataset.title();
+    if (!yDataset.units().isEmpty())
+      m_yLabel += " (" + yDataset.units() + ")";
+
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+            &Widgets::Scatter::updateData);
+  }
+
+  // Connect to the theme manager to update the density color ramp
+  onThemeChanged();
+  connect(&Misc::ThemeManager::instance(), &Misc::ThemeManager::themeChanged,
+          this, &Widgets::Scatter::onThemeChanged);
+}
+
+/**
+ * @brief Paints the density image scaled to the widget area.
+ * @param painter The painter provided by the scene graph.
+ */
+void Widgets::Scatter::paint(QPainter *painter)
+{
+  if (!painter)
+    return;
+
+  if (!m_image.isNull())
+  {
+    painter->setRenderHint(QPainter::SmoothPixmapTransform, true);
+    painter->drawImage(boundingRect(), m_image);
+  }
+}
+
+/**
+ * @brief Returns the minimum X-axis value.
+ */
+qreal Widgets::Scatter::minX() const
+{
+  return m_minX;
+}
+
+/**
+ * @brief Returns the maximum X-axis value.
+ */
+qreal Widgets::Scatter::maxX() const
+{
+  return m_maxX;
+}
+
+/**
+ * @brief Returns the minimum Y-axis value.
+ */
+qreal Widgets::Scatter::minY() const
+{
+  return m_minY;
+}
+
+/**
+ * @brief Returns the maximum Y-axis value.
+ */
+qreal Widgets::Scatter::maxY() const
+{
+  return m_maxY;
+}
+
+/**
+ * @brief Returns the X-axis tick interval.
+ */
+qreal Widgets::Scatter::xTickInterval() const
+{
+  return UI::Dashboard::smartInterval(m_minX, m_maxX);
+}
+
+/**
+ * @brief Returns the Y-axis tick interval.
+ */
+qreal Widgets::Scatter::yTickInterval() const
+{
+  return UI::Dashboard::smartInterval(m_minY, m_maxY);
+}
+
+/**
+ * @brief Returns the X-axis label.
+ */
+const QString &Widgets::Scatter::xLabel() const
+{
+  return m_xLabel;
+}
+
+/**
+ * @brief Returns the Y-axis label.
+ */
+const QString &Widgets::Scatter::yLabel() const
+{
+  return m_yLabel;
+}
+
+/**
+ * @brief Returns the total number of recorded sample pairs.
+ */
+quint64 Widgets::Scatter::sampleCount() const
+{
+  return m_drawnSamples;
+}
+
+/**
+ * @brief Re-renders the density grid into the heat map image.
+ *
+ * Every populated bin becomes one pixel whose color is looked up from the
+ * logarithmic ramp, so the cost of a refresh is fixed by the grid
+ * resolution and refreshes with no new samples are skipped entirely.
+ */
+void Widgets::Scatter::updateData()
+{
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::Scatter::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
+  if (!isEnabled())
+    return;
+
+  if (!VALIDATE_WIDGET(SerialStudio::DashboardScatter, m_index))
+    return;
+
+  // Nothing changed since the last refresh, keep the rendered image
+  const auto &grid = UI::Dashboard::instance().scatterData(m_index);
+  if (grid.count() == m_drawnSamples)
+    return;
+
+  // Map every bin counter through the logarithmic color ramp; the grid rows
+  // hold the lowest Y values first, while image rows grow downwards
+  constexpr int size = DensityGrid::GridSize;
+  if (m_image.isNull())
+    m_image = QImage(size, size, QImage::Format_ARGB32_Premultiplied);
+
+  const auto &bins = grid.bins();
+  const double logMax = std::log1p(static_cast<double>(grid.maxBinCount()));
+  for (int row = 0; row < size; ++row)
+  {
+    auto *line = reinterpret_cast<QRgb *>(m_image.scanLine(size - row - 1));
+    const auto *counts = bins.isEmpty() ? nullptr : &bins[row * size];
+    for (int col = 0; col < size; ++col)
+    {
+      const auto count = counts ? counts[col] : 0;
+      if (count == 0 || logMax <= 0)
+        line[col] = m_colorRamp.first();
+
+      else
+      {
+        const double t = std::log1p(static_cast<double>(count)) / logMax;
+        const int level = std::clamp(
+            static_cast<int>(t * (m_colorRamp.count() - 1)), 0,
+            static_cast<int>(m_colorRamp.count() - 1));
+        line[col] = m_colorRamp[level];
+      }
+    }
+  }
+
+  // Refresh the axis ranges when the grid grew past the displayed bounds
+  bool rangeMoved = false;
+  if (!qFuzzyCompare(m_minX, grid.minX()) || !qFuzzyCompare(m_maxX, grid.maxX())
+      || !qFuzzyCompare(m_minY, grid.minY())
+      || !qFuzzyCompare(m_maxY, grid.maxY()))
+  {
+    m_minX = grid.minX();
+    m_maxX = grid.maxX();
+    m_minY = grid.minY();
+    m_maxY = grid.maxY();
+    rangeMoved = true;
+  }
+
+  // Update the sample counter
+  m_drawnSamples = grid.count();
+
+  // All state is final, fire each binding wave at most once & repaint
+  if (rangeMoved)
+    Q_EMIT rangeChanged();
+  Q_EMIT sampleCountChanged();
+  update();
+}
+
+/**
+ * @brief Rebuilds the density color ramp from the current theme.
+ *
+ * Empty bins stay transparent so the plot grid shows through; populated
+ * bins fade in with the widget color and ramp up to a near-white highlight,
+ * so the hottest clusters stay readable on top of the mid-density areas.
+ */
+void Widgets::Scatter::onThemeChanged()
+{
+  const auto color = Misc::ThemeManager::instance().widgetColor(m_index);
+  const QColor hot = color.lighter(170);
+
+  m_colorRamp.resize(256);
+  m_colorRamp[0] = qRgba(0, 0, 0, 0);
+  for (int i = 1; i < m_colorRamp.count(); ++i)
+  {
+    // Low densities fade in the widget color, high densities shift towards
+    // the highlight at full opacity
+    const double t = static_cast<double>(i) / (m_colorRamp.count() - 1);
+    QColor level = color;
+    if (t >= 0.5)
+    {
+      const double u = t * 2 - 1;
+      level = QColor::fromRgbF(
+          color.redF() + (hot.redF() - color.redF()) * u,
+          color.greenF() + (hot.greenF() - color.greenF()) * u,
+          color.blueF() + (hot.blueF() - color.blueF()) * u);
+    }
+
+    level.setAlphaF((t < 0.5) ? (0.35 + 0.65 * t * 2) : 1.0);
+    m_colorRamp[i] = qPremultiply(level.rgba());
+  }
+
+  // Rendered image used the old ramp, force a rebuild on the next refresh
+  m_drawnSamples = 0;
+  updateData();
+  update();
+}
@@ -0,0 +1,90 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QImage>
+#include <QPainter>
+#include <QQuickPaintedItem>
+
+namespace Widgets
+{
+/**
+ * @brief A widget that displays the correlation between two datasets.
+ *
+ * Renders the density grid accumulated on the dashboard ingest thread as a
+ * heat map: each bin becomes one pixel of a fixed-resolution image that is
+ * scaled to the widget size, so a correlation view spanning millions of
+ * sample pairs refreshes at the same cost as one spanning a handful. Bin
+ * counts are mapped through a logarithmic color ramp derived from the
+ * widget color, which keeps sparse outliers visible next to dense clusters.
+ */
+class Scatter : public QQuickPaintedItem
+{
+  Q_OBJECT
+  Q_PROPERTY(QString xLabel READ xLabel CONSTANT)
+  Q_PROPERTY(QString yLabel READ yLabel CONSTANT)
+  Q_PROPERTY(qreal minX READ minX NOTIFY rangeChanged)
+  Q_PROPERTY(qreal maxX READ maxX NOTIFY rangeChanged)
+  Q_PROPERTY(qreal minY READ minY NOTIFY rangeChanged)
+  Q_PROPERTY(qreal maxY READ maxY NOTIFY rangeChanged)
+  Q_PROPERTY(qreal xTickInterval READ xTickInterval NOTIFY rangeChanged)
+  Q_PROPERTY(qreal yTickInterval READ yTickInterval NOTIFY rangeChanged)
+  Q_PROPERTY(quint64 sampleCount READ sampleCount NOTIFY sampleCountChanged)
+
+signals:
+  void rangeChanged();
+  void sampleCountChanged();
+
+public:
+  explicit Scatter(const int index = -1, QQuickItem *parent = nullptr);
+  void paint(QPainter *painter) override;
+
+  [[nodiscard]] qreal minX() const;
+  [[nodiscard]] qreal maxX() const;
+  [[nodiscard]] qreal minY() const;
+  [[nodiscard]] qreal maxY() const;
+  [[nodiscard]] qreal xTickInterval() const;
+  [[nodiscard]] qreal yTickInterval() const;
+  [[nodiscard]] const QString &xLabel() const;
+  [[nodiscard]] const QString &yLabel() const;
+  [[nodiscard]] quint64 sampleCount() const;
+
+private slots:
+  void updateData();
+  void onThemeChanged();
+
+private:
+  int m_index;
+  quint64 m_drawnSamples;
+
+  qreal m_minX;
+  qreal m_maxX;
+  qreal m_minY;
+  qreal m_maxY;
+
+  QString m_xLabel;
+  QString m_yLabel;
+
+  QImage m_image;
+  QVector<QRgb> m_colorRamp;
+};
+} // namespace Widgets
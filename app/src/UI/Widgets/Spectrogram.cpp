@@ -0,0 +1,290 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <QtMath>
+
+#include "SIMD/SIMD.h"
+#include "UI/Dashboard.h"
+#include "UI/Widgets/Spectrogram.h"
+#include "Misc/Watchdog.h"
+#include "UI/WidgetProfiler.h"
+#include "Misc/ThemeManager.h"
+
+/**
+ * @brief Constructs a new Spectrogram widget.
+ *
+ * Mirrors the FFT plot setup: the transform plan lives in an FFTWorker on a
+ * dedicated worker thread and the Hann window table is precomputed once and
+ * applied with SIMD before each dispatch. The widget additionally owns the
+ * rolling column buffer the finished spectra are written into.
+ *
+ * @param index The index of the spectrogram in the Dashboard.
+ * @param parent The parent QQuickItem.
+ */
+Widgets::Spectrogram::Spectrogram(const int index, QQuickItem *parent)
+  : QQuickPaintedItem(parent)
+  , m_size(0)
+  , m_index(index)
+  , m_cursor(0)
+  , m_samplingRate(0)
+  , m_transformPending(false)
+  , m_worker(nullptr)
+{
+  if (VALIDATE_WIDGET(SerialStudio::DashboardSpectrogram, m_index))
+  {
+    // Get spectrogram dataset
+    const auto &dataset
+        = GET_DATASET(SerialStudio::DashboardSpectrogram, m_index);
+
+    // Obtain sampling rate from dataset
+    m_samplingRate = dataset.fftSamplingRate();
+
+    // Create the FFT worker and move it to its own thread
+    m_worker = new FFTWorker(dataset.fftSamples(), m_samplingRate);
+    m_size = m_worker->size();
+    m_worker->moveToThread(&m_workerThread);
+    m_workerThread.start();
+
+    // Dispatch windowed samples & receive finished spectra asynchronously
+    connect(this, &Spectrogram::samplesReady, m_worker, &FFTWorker::transform,
+            Qt::QueuedConnection);
+    connect(m_worker, &FFTWorker::spectrumReady, this,
+            &Spectrogram::onSpectrumReady, Qt::QueuedConnection);
+
+    // Allocate the sample buffer & the rolling column buffer
+    m_samples.resize(m_size);
+    m_history = QImage(HistoryColumns, m_size / 2,
+                       QImage::Format_ARGB32_Premultiplied);
+    m_history.fill(Qt::transparent);
+
+    // Precompute the Hann window table, applied with SIMD in updateData()
+    m_window.reset(new float[m_size]);
+    for (int i = 0; i < m_size; ++i)
+      m_window[i] = 0.5f
+                    - 0.5f
+                          * static_cast<float>(
+                              qCos((2.0 * M_PI * i) / (m_size - 1)));
+
+    // Set axis labels
+    m_xLabel = tr("Time");
+    m_yLabel = tr("Frequency (Hz)");
+
+    // Update the spectrogram at display rate
+    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
+            &Widgets::Spectrogram::updateData);
+  }
+
+  // Connect to the theme manager to update the decibel color ramp
+  onThemeChanged();
+  connect(&Misc::ThemeManager::instance(), &Misc::ThemeManager::themeChanged,
+          this, &Widgets::Spectrogram::onThemeChanged);
+}
+
+/**
+ * @brief Paints the rolling history, newest column on the right.
+ *
+ * The circular column buffer is painted as two stretched segments (the
+ * columns after the cursor, then the columns before it), so appending a
+ * column never moves any of the already-written pixels.
+ *
+ * @param painter The painter provided by the scene graph.
+ */
+void Widgets::Spectrogram::paint(QPainter *painter)
+{
+  if (!painter || m_history.isNull())
+    return;
+
+  painter->setRenderHint(QPainter::SmoothPixmapTransform, true);
+
+  // Oldest columns (cursor..end) map to the left side of the widget
+  const qreal w = width();
+  const qreal h = height();
+  const int tail = HistoryColumns - m_cursor;
+  const qreal split = w * tail / HistoryColumns;
+  painter->drawImage(QRectF(0, 0, split, h), m_history,
+                     QRectF(m_cursor, 0, tail, m_history.height()));
+
+  // Newest columns (0..cursor) map to the right side of the widget
+  if (m_cursor > 0)
+    painter->drawImage(QRectF(split, 0, w - split, h), m_history,
+                       QRectF(0, 0, m_cursor, m_history.height()));
+}
+
+/**
+ * @brief Returns the minimum X-axis value.
+ */
+qreal Widgets::Spectrogram::minX() const
+{
+  return 0;
+}
+
+/**
+ * @brief Returns the maximum X-axis value (history length in updates).
+ */
+qreal Widgets::Spectrogram::maxX() const
+{
+  return HistoryColumns;
+}
+
+/**
+ * @brief Returns the minimum Y-axis value.
+ */
+qreal Widgets::Spectrogram::minY() const
+{
+  return 0;
+}
+
+/**
+ * @brief Returns the maximum Y-axis value (the Nyquist frequency).
+ */
+qreal Widgets::Spectrogram::maxY() const
+{
+  return m_samplingRate / 2;
+}
+
+/**
+ * @brief Returns the X-axis tick interval.
+ */
+qreal Widgets::Spectrogram::xTickInterval() const
+{
+  return UI::Dashboard::smartInterval(minX(), maxX());
+}
+
+/**
+ * @brief Returns the Y-axis tick interval.
+ */
+qreal Widgets::Spectrogram::yTickInterval() const
+{
+  return UI::Dashboard::smartInterval(minY(), maxY());
+}
+
+/**
+ * @brief Returns the X-axis label.
+ */
+const QString &Widgets::Spectrogram::xLabel() const
+{
+  return m_xLabel;
+}
+
+/**
+ * @brief Returns the Y-axis label.
+ */
+const QString &Widgets::Spectrogram::yLabel() const
+{
+  return m_yLabel;
+}
+
+/**
+ * @brief Dispatches the current samples to the FFT worker.
+ *
+ * Same dispatch policy as the FFT plot: at most one transform per widget is
+ * in flight at a time, refreshes that arrive while the worker is busy keep
+ * displaying the history written so far.
+ */
+void Widgets::Spectrogram::updateData()
+{
+  // Trace the scope for the GUI-thread watchdog
+  Misc::Watchdog::Trace trace("Widgets::Spectrogram::updateData");
+  UI::WidgetProfiler::Scope profile(this);
+
+  if (!isEnabled() || !m_worker || m_transformPending)
+    return;
+
+  if (VALIDATE_WIDGET(SerialStudio::DashboardSpectrogram, m_index))
+  {
+    // Get the sample feed
+    const auto &data = UI::Dashboard::instance().spectrogramData(m_index);
+
+    // Convert samples to floats and apply the cached window in one SIMD pass
+    SIMD::applyWindow(data.constData(), m_window.data(), m_samples.data(),
+                      m_size);
+
+    // Hand the windowed samples to the worker thread
+    m_transformPending = true;
+    Q_EMIT samplesReady(m_samples);
+  }
+}
+
+/**
+ * @brief Writes a spectrum finished by the worker thread into the history.
+ *
+ * Each decibel magnitude is looked up in the color ramp and stored as one
+ * pixel of the column under the ring cursor, with the lowest frequency at
+ * the bottom row.
+ *
+ * @param spectrum The (frequency, dB) points computed by the worker.
+ */
+void Widgets::Spectrogram::onSpectrumReady(const QList<QPointF> &spectrum)
+{
+  m_transformPending = false;
+
+  const int bins = qMin(static_cast<int>(spectrum.count()),
+                        m_history.height());
+  for (int i = 0; i < bins; ++i)
+  {
+    const qreal dB = qBound(MinDecibels, spectrum[i].y(), qreal(0));
+    const int level = static_cast<int>((dB - MinDecibels) / (-MinDecibels)
+                                       * (m_colorRamp.count() - 1));
+    auto *line
+        = reinterpret_cast<QRgb *>(m_history.scanLine(bins - i - 1));
+    line[m_cursor] = m_colorRamp[level];
+  }
+
+  m_cursor = (m_cursor + 1) % HistoryColumns;
+  update();
+}
+
+/**
+ * @brief Rebuilds the decibel color ramp from the current theme.
+ *
+ * Quiet bins stay transparent so the plot grid shows through; louder bins
+ * fade in with the widget color and ramp up to a near-white highlight. The
+ * accumulated history was painted with the old ramp and is dropped.
+ */
+void Widgets::Spectrogram::onThemeChanged()
+{
+  const auto color = Misc::ThemeManager::instance().widgetColor(m_index);
+  const QColor hot = color.lighter(170);
+
+  m_colorRamp.resize(256);
+  m_colorRamp[0] = qRgba(0, 0, 0, 0);
+  for (int i = 1; i < m_colorRamp.count(); ++i)
+  {
+    const double t = static_cast<double>(i) / (m_colorRamp.count() - 1);
+    QColor level = color;
+    if (t >= 0.5)
+    {
+      const double u = t * 2 - 1;
+      level = QColor::fromRgbF(
+          color.redF() + (hot.redF() - color.redF()) * u,
+          color.greenF() + (hot.greenF() - color.greenF()) * u,
+          color.blueF() + (hot.blueF() - color.blueF()) * u);
+    }
+
+    level.setAlphaF((t < 0.5) ? (t * 2) : 1.0);
+    m_colorRamp[i] = qPremultiply(level.rgba());
+  }
+
+  if (!m_history.isNull())
+    m_history.fill(Qt::transparent);
+
+  update();
+}
@@ -0,0 +1,112 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QImage>
+#include <QThread>
+#include <QPainter>
+#include <QQuickPaintedItem>
+
+#include "UI/Widgets/FFTPlot.h"
+
+namespace Widgets
+{
+/**
+ * @brief A widget that displays the spectral evolution of a dataset.
+ *
+ * Shares the FFT sample feed and the FFTWorker used by the FFT plot: each
+ * finished spectrum becomes one column of a circular column buffer, written
+ * at a fixed cursor instead of scrolling the whole image, so the per-update
+ * cost is one column regardless of the history length. Magnitudes are
+ * mapped through a decibel color ramp derived from the widget color and the
+ * ring is painted as two stretched segments, newest column on the right.
+ */
+class Spectrogram : public QQuickPaintedItem
+{
+  Q_OBJECT
+  Q_PROPERTY(QString xLabel READ xLabel CONSTANT)
+  Q_PROPERTY(QString yLabel READ yLabel CONSTANT)
+  Q_PROPERTY(qreal minX READ minX CONSTANT)
+  Q_PROPERTY(qreal maxX READ maxX CONSTANT)
+  Q_PROPERTY(qreal minY READ minY CONSTANT)
+  Q_PROPERTY(qreal maxY READ maxY CONSTANT)
+  Q_PROPERTY(qreal xTickInterval READ xTickInterval CONSTANT)
+  Q_PROPERTY(qreal yTickInterval READ yTickInterval CONSTANT)
+
+signals:
+  void samplesReady(const QVector<float> &samples);
+
+public:
+  explicit Spectrogram(const int index = -1, QQuickItem *parent = nullptr);
+  ~Spectrogram()
+  {
+    m_workerThread.quit();
+    m_workerThread.wait();
+    delete m_worker;
+  }
+
+  void paint(QPainter *painter) override;
+
+  [[nodiscard]] qreal minX() const;
+  [[nodiscard]] qreal maxX() const;
+  [[nodiscard]] qreal minY() const;
+  [[nodiscard]] qreal maxY() const;
+  [[nodiscard]] qreal xTickInterval() const;
+  [[nodiscard]] qreal yTickInterval() const;
+  [[nodiscard]] const QString &xLabel() const;
+  [[nodiscard]] const QString &yLabel() const;
+
+private slots:
+  void updateData();
+  void onThemeChanged();
+  void onSpectrumReady(const QList<QPointF> &spectrum);
+
+private:
+  /**
+   * @brief Number of spectrum columns kept in the rolling history.
+   */
+  static constexpr int HistoryColumns = 256;
+
+  /**
+   * @brief Magnitude floor of the color ramp, in decibels.
+   */
+  static constexpr qreal MinDecibels = -100;
+
+private:
+  int m_size;
+  int m_index;
+  int m_cursor;
+  int m_samplingRate;
+  bool m_transformPending;
+
+  QString m_xLabel;
+  QString m_yLabel;
+
+  QThread m_workerThread;
+  FFTWorker *m_worker;
+
+  QImage m_history;
+  QVector<float> m_samples;
+  QVector<QRgb> m_colorRamp;
+  QScopedArrayPointer<float> m_window;
+};
+} // namespace Widgets
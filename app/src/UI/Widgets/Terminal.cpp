@@ -23,15 +23,343 @@
 #include <QClipboard>
 #include <QFontMetrics>
 #include <QApplication>
+#include <QQuickWindow>
 
 #include "IO/Console.h"
 #include "IO/Manager.h"
+#include "SIMD/SIMD.h"
 #include "Misc/Translator.h"
 #include "Misc/TimerEvents.h"
 #include "Misc/CommonFonts.h"
 #include "Misc/ThemeManager.h"
 #include "UI/Widgets/Terminal.h"
 
+//------------------------------------------------------------------------------
+// Widgets::TerminalRenderer implementation
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the number of display rows occupied by the given line.
+ */
+int Widgets::TerminalRenderer::lineSpan(const TerminalFrame &frame, int line)
+{
+  const int length = frame.lines[line].length();
+  if (length <= 0 || frame.maxCharsPerLine <= 0)
+    return 1;
+
+  return (length + frame.maxCharsPerLine - 1) / frame.maxCharsPerLine;
+}
+
+/**
+ * @brief Returns @c true when the frame shows the scrollback scrollbar.
+ */
+bool Widgets::TerminalRenderer::scrollbarVisible(const TerminalFrame &frame)
+{
+  return !frame.autoscroll && frame.lineCount > frame.linesPerPage;
+}
+
+/**
+ * @brief Decides whether the whole buffer must be re-rasterized.
+ *
+ * Anything that shifts the row layout or affects every row at once (resize,
+ * font or palette change, scrolling, selection changes and the scrollbar
+ * overlay) invalidates the previous image; otherwise only the damaged rows
+ * are repainted.
+ */
+bool Widgets::TerminalRenderer::requiresFullRender(
+    const TerminalFrame &frame) const
+{
+  return frame.size != m_lastFrame.size || frame.dpr != m_lastFrame.dpr
+         || frame.font != m_lastFrame.font
+         || frame.palette != m_lastFrame.palette
+         || frame.scrollOffsetY != m_lastFrame.scrollOffsetY
+         || frame.maxCharsPerLine != m_lastFrame.maxCharsPerLine
+         || frame.selectionEnd != m_lastFrame.selectionEnd
+         || frame.selectionStart != m_lastFrame.selectionStart
+         || frame.lines.count() < m_lastFrame.lines.count()
+         || scrollbarVisible(frame) || scrollbarVisible(m_lastFrame);
+}
+
+/**
+ * @brief Rasterizes one logical line (including wrapped rows) at offset @a y.
+ *
+ * Replicates the selection & variable-width text passes of the previous
+ * synchronous paint routine for a single line: the affected band is cleared
+ * with the base color, selection rectangles are filled and the characters are
+ * drawn one by one.
+ */
+void Widgets::TerminalRenderer::renderLine(QPainter &painter,
+                                           const TerminalFrame &frame,
+                                           int line, int y)
+{
+  const int maxY = frame.size.height() - frame.borderY;
+  const int lineHeight = frame.charHeight;
+  const int index = frame.scrollOffsetY + line;
+  const QString &text = frame.lines[line];
+
+  // Clear the band occupied by this line
+  const int span = lineSpan(frame, line);
+  painter.fillRect(
+      QRect(0, y, frame.size.width(), qMin(span * lineHeight, maxY - y)),
+      frame.palette.color(QPalette::Base));
+
+  // Check if this line is within the selection range
+  const bool lineFullySelected = !frame.selectionEnd.isNull()
+                                 && index >= frame.selectionStart.y()
+                                 && index < frame.selectionEnd.y();
+
+  // Handle empty lines
+  if (text.isEmpty())
+  {
+    if (lineFullySelected)
+    {
+      QRect selectionRect(frame.borderX, y,
+                          frame.size.width() - 2 * frame.borderX,
+                          frame.charHeight);
+      painter.fillRect(selectionRect,
+                       frame.palette.color(QPalette::Highlight));
+    }
+
+    return;
+  }
+
+  // If the line is fully selected, draw a single rectangle
+  if (lineFullySelected)
+  {
+    QRect selectionRect(frame.borderX, y,
+                        frame.size.width() - 2 * frame.borderX,
+                        frame.charHeight);
+    painter.fillRect(selectionRect, frame.palette.color(QPalette::Highlight));
+  }
+
+  // Render selection for line with word-wrapping and variable-width chars
+  else
+  {
+    int sy = y;
+    int start = 0;
+    while (start < text.length() && sy < maxY)
+    {
+      const int lineEnd = qMin<int>(start + frame.maxCharsPerLine,
+                                    text.length());
+
+      if (!frame.selectionEnd.isNull() && index >= frame.selectionStart.y()
+          && index <= frame.selectionEnd.y())
+      {
+        int selectionStartX, selectionEndX;
+
+        // Specific case for the first line of the selection
+        if (index == frame.selectionStart.y())
+        {
+          selectionStartX = qMax(frame.selectionStart.x(), start);
+          selectionEndX = (index == frame.selectionEnd.y())
+                              ? qMin(frame.selectionEnd.x(), lineEnd)
+                              : lineEnd;
+        }
+
+        // Specific case for the last line of the selection
+        else if (index == frame.selectionEnd.y())
+        {
+          selectionStartX = start;
+          selectionEndX = qMin(frame.selectionEnd.x(), lineEnd);
+        }
+
+        // Entire line selected within the bounds of start and end
+        else
+        {
+          selectionStartX = start;
+          selectionEndX = lineEnd;
+        }
+
+        if (selectionStartX < selectionEndX)
+        {
+          int startX = frame.borderX;
+          int selectionWidth = 0;
+
+          // Cap for selection width
+          int maxSelectionWidth = frame.size.width() - 2 * frame.borderX;
+
+          for (int j = start; j < selectionEndX; ++j)
+          {
+            int charWidth = painter.fontMetrics().horizontalAdvance(text[j]);
+
+            if (j < selectionStartX)
+              startX += charWidth;
+            else
+              selectionWidth += charWidth;
+          }
+
+          // Cap the selection width to fit within the allowed area
+          selectionWidth = qMin(selectionWidth,
+                                maxSelectionWidth - (startX - frame.borderX));
+
+          // Draw the selection rectangle
+          QRect selectionRect(startX, sy, selectionWidth, frame.charHeight);
+          painter.fillRect(selectionRect,
+                           frame.palette.color(QPalette::Highlight));
+        }
+      }
+
+      sy += lineHeight;
+      start = lineEnd;
+    }
+  }
+
+  // Draw characters one by one with variable width handling
+  int start = 0;
+  while (start < text.length() && y < maxY)
+  {
+    const int end = qMin<int>(start + frame.maxCharsPerLine, text.length());
+    const QString segment = text.mid(start, end - start);
+    int x = frame.borderX;
+
+    for (int j = 0; j < segment.length(); ++j)
+    {
+      // Get character to render
+      const QString character = segment.mid(j, 1);
+
+      // Measure the character width dynamically
+      int charWidth = painter.fontMetrics().horizontalAdvance(character);
+
+      // Draw the character at the centered position within its cell
+      painter.setPen(frame.palette.color(QPalette::Text));
+      painter.drawText(x, y, charWidth, frame.charHeight, Qt::AlignCenter,
+                       character);
+
+      // Move to the next character position
+      x += charWidth;
+    }
+
+    y += lineHeight;
+    start = end;
+  }
+}
+
+/**
+ * @brief Rasterizes the given frame & publishes the finished image.
+ *
+ * Runs in the render thread. The frame is diffed against the previously
+ * rendered one: when the row layout is stable only the damaged rows (changed
+ * lines & the cursor rows) are repainted, otherwise the whole visible buffer
+ * is re-rasterized. The published image is implicitly shared, painting the
+ * next frame detaches it from the copy held by the GUI thread, which gives
+ * the buffer swap without explicit locking.
+ */
+void Widgets::TerminalRenderer::render(const Widgets::TerminalFrame &frame)
+{
+  // Re-create the target image when the item size changes
+  const QSize pixelSize = frame.size * frame.dpr;
+  if (m_image.size() != pixelSize)
+  {
+    m_image = QImage(pixelSize, QImage::Format_ARGB32_Premultiplied);
+    m_image.setDevicePixelRatio(frame.dpr);
+  }
+
+  // Validate image
+  if (m_image.isNull())
+    return;
+
+  // Decide between a full pass & repainting only the damaged rows
+  const bool full = requiresFullRender(frame);
+  const bool cursorMoved = frame.cursor != m_lastFrame.cursor
+                           || frame.cursorVisible
+                                  != m_lastFrame.cursorVisible;
+
+  // Configure the painter
+  QPainter painter(&m_image);
+  painter.setFont(frame.font);
+
+  // Clear the whole image on full passes
+  if (full)
+    painter.fillRect(QRect(QPoint(0, 0), frame.size),
+                     frame.palette.color(QPalette::Base));
+
+  // Draw the visible lines, skipping undamaged rows on partial passes
+  int y = frame.borderY;
+  const int maxY = frame.size.height() - frame.borderY;
+  bool layoutStable = !full;
+  for (int i = 0; i < frame.lines.count() && y < maxY; ++i)
+  {
+    // Detect rows shifted by a change in the wrapping of a previous line
+    const int index = frame.scrollOffsetY + i;
+    if (layoutStable && i < m_lastFrame.lines.count()
+        && lineSpan(frame, i) != lineSpan(m_lastFrame, i))
+      layoutStable = false;
+
+    // Repaint damaged rows only
+    const bool damaged = full || !layoutStable
+                         || i >= m_lastFrame.lines.count()
+                         || frame.lines[i] != m_lastFrame.lines[i]
+                         || (cursorMoved
+                             && (index == frame.cursor.y()
+                                 || index == m_lastFrame.cursor.y()));
+    if (damaged)
+      renderLine(painter, frame, i, y);
+
+    y += lineSpan(frame, i) * frame.charHeight;
+  }
+
+  // Clear the area below the last line when the layout shifted
+  if (!layoutStable && y < maxY)
+    painter.fillRect(QRect(0, y, frame.size.width(), maxY - y),
+                     frame.palette.color(QPalette::Base));
+
+  // Draw cursor if visible
+  const int firstLine = frame.scrollOffsetY;
+  const int lastVLine = firstLine + frame.lines.count() - 1;
+  if (frame.cursorVisible && frame.cursor.y() >= firstLine
+      && frame.cursor.y() <= lastVLine)
+  {
+    // clang-format off
+    const int cursorX = frame.cursor.x() * frame.charWidth + frame.borderX;
+    const int cursorY = (frame.cursor.y() - firstLine + 1) * frame.charHeight + frame.borderY;
+    // clang-format on
+
+    // Draw the cursor as a filled block character
+    painter.setPen(frame.palette.color(QPalette::Text));
+    painter.drawText(cursorX, cursorY, QStringLiteral("█"));
+  }
+
+  // Draw scrollbar if required
+  if (scrollbarVisible(frame))
+  {
+    // Get available height
+    const int availableHeight = frame.size.height() - 2 * frame.borderY;
+
+    // Set dimensions
+    const int scrollbarWidth = 6;
+    int scrollbarHeight
+        = qMax(20.0, qPow(availableHeight, 2) / frame.lineCount);
+    if (scrollbarHeight > availableHeight / 2)
+      scrollbarHeight = availableHeight / 2;
+
+    // Set scrollbar position
+    int x = frame.size.width() - scrollbarWidth - frame.borderX;
+    int sy = (frame.scrollOffsetY
+              / static_cast<float>(frame.lineCount - frame.linesPerPage))
+                 * (availableHeight - scrollbarHeight)
+             - frame.borderY;
+    sy = qMax(frame.borderY, sy);
+
+    // Draw the scrollbar
+    QRect scrollbarRect(x, sy, scrollbarWidth, scrollbarHeight);
+    QBrush scrollbarBrush(frame.palette.color(QPalette::Window));
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setBrush(scrollbarBrush);
+    painter.setPen(Qt::NoPen);
+    painter.drawRoundedRect(scrollbarRect, scrollbarWidth / 2,
+                            scrollbarWidth / 2);
+  }
+
+  // Publish the finished frame & remember it for the next diff
+  painter.end();
+  m_lastFrame = frame;
+  Q_EMIT frameReady(m_image);
+}
+
+//------------------------------------------------------------------------------
+// Widgets::Terminal implementation
+//------------------------------------------------------------------------------
+
 /**
  * @brief Constructs a Terminal object with the given parent item.
  *
@@ -74,6 +402,11 @@ Widgets::Terminal::Terminal(QQuickItem *parent)
   , m_formatValue(0)
   , m_formatValueY(0)
   , m_useFormatValueY(false)
+  , m_searchStale(false)
+  , m_searchCursor(-1)
+  , m_searchDirtyLine(0)
+  , m_renderPending(false)
+  , m_renderer(nullptr)
 {
   // Initialize data buffer
   initBuffer();
@@ -112,7 +445,20 @@ Widgets::Terminal::Terminal(QQuickItem *parent)
   // Redraw widget as soon as it is visible
   connect(this, &Widgets::Terminal::visibleChanged, this, [=] {
     if (isVisible())
-      update();
+    {
+      m_stateChanged = true;
+      requestRender();
+    }
+  });
+
+  // Re-rasterize the buffer when the item is resized
+  connect(this, &QQuickItem::widthChanged, this, [=] {
+    m_stateChanged = true;
+    requestRender();
+  });
+  connect(this, &QQuickItem::heightChanged, this, [=] {
+    m_stateChanged = true;
+    requestRender();
   });
 
   // Change character widths when changing language
@@ -125,38 +471,49 @@ Widgets::Terminal::Terminal(QQuickItem *parent)
   connect(&m_cursorTimer, &QTimer::timeout, this,
           &Widgets::Terminal::toggleCursor);
 
+  // Rasterize the terminal on a dedicated render thread
+  qRegisterMetaType<Widgets::TerminalFrame>();
+  m_renderer = new TerminalRenderer();
+  m_renderer->moveToThread(&m_renderThread);
+  m_renderThread.start();
+  connect(this, &Widgets::Terminal::renderRequested, m_renderer,
+          &Widgets::TerminalRenderer::render, Qt::QueuedConnection);
+  connect(m_renderer, &Widgets::TerminalRenderer::frameReady, this,
+          &Widgets::Terminal::onFrameReady, Qt::QueuedConnection);
+
   // Redraw the widget only when necessary
   m_stateChanged = true;
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout24Hz, this,
           [=] {
             if (isVisible() && m_stateChanged)
-            {
-              m_stateChanged = false;
-              update();
-            }
+              requestRender();
           });
 }
 
+/**
+ * @brief Shuts down the render thread before destroying the widget.
+ */
+Widgets::Terminal::~Terminal()
+{
+  m_renderThread.quit();
+  m_renderThread.wait();
+
+  delete m_renderer;
+  m_renderer = nullptr;
+}
+
 /**
  * @brief Paints the terminal widget content.
  *
- * This method overrides the QQuickPaintedItem::paint() to render the terminal's
- * content, including the text, cursor, and optional scrollbar.
+ * This method overrides the QQuickPaintedItem::paint() to display the
+ * terminal's content. The actual rasterization (text, selection, cursor and
+ * scrollbar) happens on the render thread, so this function only blits the
+ * most recent image published by the TerminalRenderer.
  *
  * @param painter A QPainter object used to draw the terminal's content.
  *
- * The paint method performs the following key tasks:
- * - Skips rendering if the terminal is not visible.
- * - Prepares the painter by setting the current font and fills the terminal
- *   background.
- * - Draws each visible line of terminal data, using the current palette.
- * - Draws the cursor if it is currently visible and within the visible range of
- *   lines.
- * - Draws a vertical scrollbar if autoscroll is disabled and not all lines are
- *   visible.
- *
- * @note This function handles rendering for different terminal states,
- * including cursor visibility and scrolling requirements.
+ * @note The image carries the device pixel ratio of the window, so the blit
+ *       stays crisp on high-DPI displays.
  */
 void Widgets::Terminal::paint(QPainter *painter)
 {
@@ -164,204 +521,9 @@ void Widgets::Terminal::paint(QPainter *painter)
   if (!isVisible() || !painter)
     return;
 
-  // Set font and prepare painter
-  painter->setFont(m_font);
-  int lineHeight = m_cHeight;
-
-  // Calculate the range of lines to be painted
-  const int firstLine = m_scrollOffsetY;
-  const int lastVLine = qMin(firstLine + linesPerPage(), lineCount() - 1);
-
-  // Draw selection rectangles
-  int y = m_borderY;
-  for (int i = firstLine; i <= lastVLine && y < height() - m_borderY; ++i)
-  {
-    // Obtain the line data
-    const QString &line = m_data[i];
-
-    // Check if this line is within the selection range
-    bool lineFullySelected = !m_selectionEnd.isNull()
-                             && i >= m_selectionStart.y()
-                             && i < m_selectionEnd.y();
-
-    // Handle empty lines
-    if (line.isEmpty())
-    {
-      // Draw selection rectangle if required for this line
-      if (lineFullySelected)
-      {
-        QRect selectionRect(m_borderX, y, width() - 2 * m_borderX, m_cHeight);
-        painter->fillRect(selectionRect, m_palette.color(QPalette::Highlight));
-      }
-
-      // Go to next line
-      y += lineHeight;
-      continue;
-    }
-
-    // If the line is fully selected, draw a single rectangle
-    if (lineFullySelected)
-    {
-      QRect selectionRect(m_borderX, y, width() - 2 * m_borderX, m_cHeight);
-      painter->fillRect(selectionRect, m_palette.color(QPalette::Highlight));
-      y += lineHeight;
-      continue;
-    }
-
-    // Render selection for line with word-wrapping and variable-width chars
-    int start = 0;
-    while (start < line.length())
-    {
-      const int lineEnd = qMin<int>(start + maxCharsPerLine(), line.length());
-
-      if (!m_selectionEnd.isNull() && i >= m_selectionStart.y()
-          && i <= m_selectionEnd.y())
-      {
-        int selectionStartX, selectionEndX;
-
-        // Specific case for the first line of the selection
-        if (i == m_selectionStart.y())
-        {
-          selectionStartX = qMax(m_selectionStart.x(), start);
-          selectionEndX = (i == m_selectionEnd.y())
-                              ? qMin(m_selectionEnd.x(), lineEnd)
-                              : lineEnd;
-        }
-
-        // Specific case for the last line of the selection
-        else if (i == m_selectionEnd.y())
-        {
-          selectionStartX = start;
-          selectionEndX = qMin(m_selectionEnd.x(), lineEnd);
-        }
-
-        // Entire line selected within the bounds of start and end
-        else
-        {
-          selectionStartX = start;
-          selectionEndX = lineEnd;
-        }
-
-        if (selectionStartX < selectionEndX)
-        {
-          int startX = m_borderX;
-          int selectionWidth = 0;
-
-          // Cap for selection width
-          int maxSelectionWidth = width() - 2 * m_borderX;
-
-          for (int j = start; j < selectionEndX; ++j)
-          {
-            int charWidth = painter->fontMetrics().horizontalAdvance(line[j]);
-
-            if (j < selectionStartX)
-              startX += charWidth;
-            else
-              selectionWidth += charWidth;
-          }
-
-          // Cap the selection width to fit within the allowed area
-          selectionWidth
-              = qMin(selectionWidth, maxSelectionWidth - (startX - m_borderX));
-
-          // Draw the selection rectangle
-          QRect selectionRect(startX, y, selectionWidth, m_cHeight);
-          painter->fillRect(selectionRect,
-                            m_palette.color(QPalette::Highlight));
-        }
-      }
-
-      y += lineHeight;
-      start = lineEnd;
-    }
-  }
-
-  // Draw characters one by one with variable width handling
-  y = m_borderY;
-  for (int i = firstLine; i <= lastVLine && y < height() - m_borderY; ++i)
-  {
-    // Obtain line data
-    const QString &line = m_data[i];
-
-    // Skip empty lines, but draw line break
-    if (line.isEmpty())
-    {
-      y += lineHeight;
-      continue;
-    }
-
-    // Render line with word-wrapping
-    int start = 0;
-    while (start < line.length())
-    {
-      const int end = qMin<int>(start + maxCharsPerLine(), line.length());
-      const QString segment = line.mid(start, end - start);
-      int x = m_borderX;
-
-      for (int j = 0; j < segment.length(); ++j)
-      {
-        // Get character to render
-        const QString character = segment.mid(j, 1);
-
-        // Measure the character width dynamically
-        int charWidth = painter->fontMetrics().horizontalAdvance(character);
-
-        // Draw the character at the centered position within its cell
-        painter->setPen(m_palette.color(QPalette::Text));
-        painter->drawText(x, y, charWidth, m_cHeight, Qt::AlignCenter,
-                          character);
-
-        // Move to the next character position
-        x += charWidth;
-      }
-
-      y += lineHeight;
-      start = end;
-    }
-  }
-
-  // Draw cursor if visible
-  if (m_cursorVisible && m_cursorPosition.y() >= firstLine
-      && m_cursorPosition.y() <= lastVLine)
-  {
-    // clang-format off
-    const int cursorX = m_cursorPosition.x() * m_cWidth + m_borderX;
-    const int cursorY = (m_cursorPosition.y() - firstLine + 1) * lineHeight + m_borderY;
-    // clang-format on
-
-    // Draw the cursor as a filled block character
-    painter->setPen(m_palette.color(QPalette::Text));
-    painter->drawText(cursorX, cursorY, QStringLiteral("█"));
-  }
-
-  // Draw scrollbar if required
-  if (!autoscroll() && lineCount() > linesPerPage())
-  {
-    // Get available height
-    const int availableHeight = height() - 2 * m_borderY;
-
-    // Set dimensions
-    const int scrollbarWidth = 6;
-    int scrollbarHeight = qMax(20.0, qPow(availableHeight, 2) / lineCount());
-    if (scrollbarHeight > availableHeight / 2)
-      scrollbarHeight = availableHeight / 2;
-
-    // Set scrollbar position
-    int x = width() - scrollbarWidth - m_borderX;
-    y = (m_scrollOffsetY / static_cast<float>(lineCount() - linesPerPage()))
-            * (availableHeight - scrollbarHeight)
-        - m_borderY;
-    y = qMax(m_borderY, y);
-
-    // Draw the scrollbar
-    QRect scrollbarRect(x, y, scrollbarWidth, scrollbarHeight);
-    QBrush scrollbarBrush(m_palette.color(QPalette::Window));
-    painter->setRenderHint(QPainter::Antialiasing);
-    painter->setBrush(scrollbarBrush);
-    painter->setPen(Qt::NoPen);
-    painter->drawRoundedRect(scrollbarRect, scrollbarWidth / 2,
-                             scrollbarWidth / 2);
-  }
+  // Blit the latest frame produced by the render thread
+  if (!m_frontBuffer.isNull())
+    painter->drawImage(QRectF(0, 0, width(), height()), m_frontBuffer);
 }
 
 /**
@@ -571,6 +733,97 @@ QPoint Widgets::Terminal::positionToCursor(const QPoint &pos) const
   return QPoint(qMax(0, actualX), qMax(0, actualY));
 }
 
+/**
+ * @brief Returns the current scrollback search query.
+ */
+QString Widgets::Terminal::searchText() const
+{
+  return m_searchText;
+}
+
+/**
+ * @brief Returns the number of matches of the current search query.
+ */
+int Widgets::Terminal::searchResultCount() const
+{
+  return m_searchResults.count();
+}
+
+/**
+ * @brief Returns the index of the currently highlighted match (0-based), or
+ *        -1 when no match is selected.
+ */
+int Widgets::Terminal::currentSearchResult() const
+{
+  return m_searchCursor;
+}
+
+/**
+ * @brief Sets the scrollback search query & jumps to the first match.
+ *
+ * An empty query clears the search state. Matching is case-insensitive.
+ *
+ * @param text The text to search the scrollback for.
+ */
+void Widgets::Terminal::setSearchText(const QString &text)
+{
+  if (m_searchText == text)
+    return;
+
+  m_searchText = text;
+  m_searchCursor = -1;
+  runSearch();
+
+  if (!m_searchResults.isEmpty())
+    findNext();
+  else
+    Q_EMIT searchResultsChanged();
+}
+
+/**
+ * @brief Highlights & scrolls to the next search match, wrapping around at
+ *        the end of the scrollback.
+ */
+void Widgets::Terminal::findNext()
+{
+  if (m_searchStale)
+    runSearch();
+
+  if (m_searchResults.isEmpty())
+  {
+    m_searchCursor = -1;
+    Q_EMIT searchResultsChanged();
+    return;
+  }
+
+  m_searchCursor = (m_searchCursor + 1) % m_searchResults.count();
+  showSearchResult(m_searchCursor);
+}
+
+/**
+ * @brief Highlights & scrolls to the previous search match, wrapping around
+ *        at the start of the scrollback.
+ */
+void Widgets::Terminal::findPrevious()
+{
+  if (m_searchStale)
+    runSearch();
+
+  if (m_searchResults.isEmpty())
+  {
+    m_searchCursor = -1;
+    Q_EMIT searchResultsChanged();
+    return;
+  }
+
+  if (m_searchCursor <= 0)
+    m_searchCursor = m_searchResults.count() - 1;
+  else
+    --m_searchCursor;
+
+  showSearchResult(m_searchCursor);
+}
+
 /**
  * @brief Copies the currently selected text to the system clipboard.
  *
@@ -741,7 +994,8 @@ void Widgets::Terminal::setScrollOffsetY(const int offset)
     m_scrollOffsetY = offset;
     Q_EMIT scrollOffsetYChanged();
 
-    update();
+    m_stateChanged = true;
+    requestRender();
   }
 }
 
@@ -787,6 +1041,41 @@ void Widgets::Terminal::toggleCursor()
   m_cursorVisible = !m_cursorVisible;
 }
 
+/**
+ * @brief Hands a snapshot of the terminal state to the render thread.
+ *
+ * Only one frame is in flight at a time: while the renderer is busy, newer
+ * state is coalesced into the next snapshot, which keeps the GUI thread from
+ * queueing frames faster than they can be rasterized during console bursts.
+ */
+void Widgets::Terminal::requestRender()
+{
+  if (!isVisible() || m_renderPending)
+    return;
+
+  m_stateChanged = false;
+  m_renderPending = true;
+  Q_EMIT renderRequested(captureFrame());
+}
+
+/**
+ * @brief Stores the image produced by the render thread & repaints the item.
+ *
+ * If more state changes arrived while the frame was being rasterized, the
+ * next snapshot is dispatched immediately so the display catches up.
+ *
+ * @param image Finished terminal image, implicitly shared with the renderer.
+ */
+void Widgets::Terminal::onFrameReady(const QImage &image)
+{
+  m_frontBuffer = image;
+  m_renderPending = false;
+  update();
+
+  if (m_stateChanged)
+    requestRender();
+}
+
 /**
  * @brief Updates the terminal's color palette when the theme changes.
  *
@@ -807,7 +1096,7 @@ void Widgets::Terminal::onThemeChanged()
   m_palette.setColor(QPalette::Window, theme->getColor("console_border"));
   m_palette.setColor(QPalette::Highlight, theme->getColor("console_highlight"));
   setFillColor(m_palette.color(QPalette::Base));
-  update();
+  requestRender();
   // clang-format on
 }
 
@@ -818,7 +1107,18 @@ void Widgets::Terminal::onScrollbackChanged()
 {
   auto lines = IO::Console::instance().scrollback();
   while (m_data.length() > lines - 1)
+  {
     m_data.removeFirst();
+
+    // Keep the digest index aligned with the trimmed buffer
+    if (!m_lineDigests.isEmpty())
+      m_lineDigests.removeFirst();
+    m_searchDirtyLine = qMax(0, m_searchDirtyLine - 1);
+  }
+
+  // Line numbers of cached results shifted with the trim
+  if (!m_searchResults.isEmpty())
+    m_searchStale = true;
 }
 
 /**
@@ -827,9 +1127,14 @@ void Widgets::Terminal::onScrollbackChanged()
  *
  * @param data The string of data to be appended to the terminal.
  *
- * This method processes each character in the provided data string,
- * interpreting escape sequences, formatting commands, and resetting font styles
- * based on the terminal's current state (Text, Escape, Format, ResetFont).
+ * This method processes the provided data string, interpreting escape
+ * sequences, formatting commands, and resetting font styles based on the
+ * terminal's current state (Text, Escape, Format, ResetFont).
+ *
+ * While in the Text state, runs of printable ASCII are located with a SIMD
+ * scan and copied into the accumulator in a single operation, so the
+ * per-character state machine only runs at escape sequences, control
+ * characters and non-ASCII text.
  *
  * The processed text is accumulated and then appended to the terminal's buffer.
  *
@@ -839,11 +1144,26 @@ void Widgets::Terminal::onScrollbackChanged()
 void Widgets::Terminal::append(const QString &data)
 {
   QString text;
-  auto it = data.constBegin();
+  const qsizetype len = data.length();
+  const auto *units = reinterpret_cast<const char16_t *>(data.constData());
 
-  while (it != data.constEnd())
+  qsizetype i = 0;
+  while (i < len)
   {
-    auto byte = *it;
+    // Bulk-copy runs of plain printable characters in the Text state
+    if (m_state == Text)
+    {
+      const auto run = SIMD::printableAsciiPrefix(units + i, len - i);
+      if (run > 0)
+      {
+        text.append(QStringView(data).mid(i, run));
+        i += run;
+        continue;
+      }
+    }
+
+    // Process escape sequences & control characters one at a time
+    const QChar byte = data.at(i);
     switch (m_state)
     {
       case Text:
@@ -860,7 +1180,7 @@ void Widgets::Terminal::append(const QString &data)
         break;
     }
 
-    ++it;
+    ++i;
   }
 
   appendString(text);
@@ -1007,6 +1327,166 @@ void Widgets::Terminal::initBuffer()
   m_data.squeeze();
   m_scrollOffsetY = 0;
   m_data.reserve(IO::Console::instance().scrollback());
+
+  // Reset the search index state
+  m_searchCursor = -1;
+  m_searchDirtyLine = 0;
+  m_lineDigests.clear();
+  if (!m_searchResults.isEmpty())
+  {
+    m_searchResults.clear();
+    Q_EMIT searchResultsChanged();
+  }
+}
+
+/**
+ * @brief Computes the search digest of a scrollback line.
+ *
+ * The digest is a 64-bit bitmask with one bit set per (case-folded)
+ * character class present in the line. A line can only contain the query if
+ * its digest is a superset of the query's digest, so the search loop skips
+ * the vast majority of lines without touching their text.
+ *
+ * @param line The line to digest.
+ * @return The digest bitmask.
+ */
+quint64 Widgets::Terminal::lineDigest(const QString &line)
+{
+  quint64 digest = 0;
+  for (const auto &ch : line)
+    digest |= quint64(1) << (ch.toLower().unicode() % 64);
+
+  return digest;
+}
+
+/**
+ * @brief Brings the per-line digest index up to date.
+ *
+ * Digests are maintained incrementally: every buffer edit only lowers a
+ * dirty-line watermark, and this function re-digests the lines from the
+ * watermark (writes cluster at the cursor, so this is almost always just the
+ * tail of the buffer) instead of rescanning the whole scrollback.
+ */
+void Widgets::Terminal::updateSearchIndex()
+{
+  const int oldCount = m_lineDigests.count();
+  m_lineDigests.resize(m_data.count());
+
+  const int start = qMin(m_searchDirtyLine, oldCount);
+  for (int i = start; i < m_data.count(); ++i)
+    m_lineDigests[i] = lineDigest(m_data.at(i));
+
+  m_searchDirtyLine = m_data.count();
+}
+
+/**
+ * @brief Rebuilds the search result list for the current query.
+ *
+ * Candidate lines are pre-filtered through the digest index; only lines
+ * whose digest covers every character of the query are scanned for actual
+ * (case-insensitive) occurrences.
+ */
+void Widgets::Terminal::runSearch()
+{
+  m_searchStale = false;
+  m_searchResults.clear();
+
+  if (m_searchText.isEmpty())
+    return;
+
+  updateSearchIndex();
+
+  const auto digest = lineDigest(m_searchText);
+  for (int y = 0; y < m_data.count(); ++y)
+  {
+    // Skip lines that cannot contain every character of the query
+    if ((m_lineDigests.at(y) & digest) != digest)
+      continue;
+
+    // Collect every occurrence within the candidate line
+    const auto &line = m_data.at(y);
+    auto x = line.indexOf(m_searchText, 0, Qt::CaseInsensitive);
+    while (x >= 0)
+    {
+      m_searchResults.append(QPoint(int(x), y));
+      x = line.indexOf(m_searchText, x + 1, Qt::CaseInsensitive);
+    }
+  }
+}
+
+/**
+ * @brief Highlights the given search match & scrolls it into view.
+ *
+ * The match becomes the active selection (so the renderer highlights it and
+ * copy() picks it up) and autoscroll is disabled so the view stays put.
+ *
+ * @param index Index of the match within the search result list.
+ */
+void Widgets::Terminal::showSearchResult(const int index)
+{
+  if (index < 0 || index >= m_searchResults.count())
+    return;
+
+  // Select the matched text
+  const auto match = m_searchResults.at(index);
+  m_selectionStart = match;
+  m_selectionEnd = QPoint(match.x() + int(m_searchText.length()), match.y());
+  m_selectionStartCursor = m_selectionStart;
+
+  // Center the match vertically within the viewport
+  setAutoscroll(false);
+  setScrollOffsetY(qMax(0, match.y() - linesPerPage() / 2));
+
+  // Update the UI
+  m_stateChanged = true;
+  Q_EMIT selectionChanged();
+  Q_EMIT searchResultsChanged();
+  requestRender();
+}
+
+/**
+ * @brief Builds a snapshot of the visible terminal state for the renderer.
+ *
+ * Copies the geometry, palette, cursor and selection state along with the
+ * currently visible lines. The line list relies on Qt's implicit sharing, so
+ * the copy itself is shallow and the GUI thread is never blocked on the size
+ * of the scrollback.
+ *
+ * @return A TerminalFrame describing everything the renderer needs.
+ */
+Widgets::TerminalFrame Widgets::Terminal::captureFrame() const
+{
+  TerminalFrame frame;
+  frame.font = m_font;
+  frame.size = QSize(qCeil(width()), qCeil(height()));
+  frame.dpr = window() ? window()->devicePixelRatio() : 1.0;
+  frame.palette = m_palette;
+
+  frame.lineCount = lineCount();
+  frame.linesPerPage = linesPerPage();
+  frame.scrollOffsetY = m_scrollOffsetY;
+  frame.maxCharsPerLine = maxCharsPerLine();
+
+  frame.charWidth = m_cWidth;
+  frame.charHeight = m_cHeight;
+  frame.borderX = m_borderX;
+  frame.borderY = m_borderY;
+
+  frame.cursor = m_cursorPosition;
+  frame.autoscroll = m_autoscroll;
+  frame.cursorVisible = m_cursorVisible;
+
+  frame.selectionEnd = m_selectionEnd;
+  frame.selectionStart = m_selectionStart;
+
+  // Only copy the lines that can appear on screen
+  const int firstLine = m_scrollOffsetY;
+  const int lastVLine = qMin(firstLine + linesPerPage(), lineCount() - 1);
+  frame.lines.reserve(qMax(0, lastVLine - firstLine + 1));
+  for (int i = firstLine; i <= lastVLine; ++i)
+    frame.lines.append(m_data[i]);
+
+  return frame;
 }
 
 /**
@@ -1343,6 +1823,10 @@ void Widgets::Terminal::replaceData(qsizetype x, qsizetype y, QChar byte)
     currentLine[x] = byte;
   else if (x >= 0)
     currentLine.append(byte);
+
+  // Lower the search index watermark to the modified line
+  m_searchStale = true;
+  m_searchDirtyLine = qMin(m_searchDirtyLine, int(y));
 }
 
 /**
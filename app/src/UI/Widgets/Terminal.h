@@ -21,12 +21,80 @@
 
 #pragma once
 
+#include <QFont>
+#include <QImage>
 #include <QTimer>
+#include <QThread>
 #include <QPalette>
 #include <QQuickPaintedItem>
 
 namespace Widgets
 {
+/**
+ * @brief Snapshot of the visible terminal state consumed by the renderer.
+ *
+ * Captured on the GUI thread and handed to the background renderer through a
+ * queued connection. The line list only contains the visible lines and relies
+ * on implicit sharing, so building a frame is a handful of shallow copies.
+ */
+struct TerminalFrame
+{
+  QFont font;
+  QSize size;
+  qreal dpr = 1.0;
+  QPalette palette;
+
+  QStringList lines;
+  int lineCount = 0;
+  int linesPerPage = 0;
+  int scrollOffsetY = 0;
+  int maxCharsPerLine = 0;
+
+  int charWidth = 0;
+  int charHeight = 0;
+  int borderX = 0;
+  int borderY = 0;
+
+  QPoint cursor;
+  bool autoscroll = true;
+  bool cursorVisible = false;
+
+  QPoint selectionEnd;
+  QPoint selectionStart;
+};
+
+/**
+ * @brief Background rasterizer for the Terminal widget.
+ *
+ * Lives in a dedicated render thread: it receives TerminalFrame snapshots,
+ * paints them into a persistent image and publishes the result back to the
+ * GUI thread, where Terminal::paint() only blits the finished buffer. The
+ * renderer diffs each frame against the previous one and only re-rasterizes
+ * the damaged rows (changed lines, cursor movement), so a full-rate console
+ * dump costs a handful of text rows per pass instead of the whole grid.
+ */
+class TerminalRenderer : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void frameReady(const QImage &image);
+
+public slots:
+  void render(const Widgets::TerminalFrame &frame);
+
+private:
+  [[nodiscard]] bool requiresFullRender(const TerminalFrame &frame) const;
+  [[nodiscard]] static int lineSpan(const TerminalFrame &frame, int line);
+  [[nodiscard]] static bool scrollbarVisible(const TerminalFrame &frame);
+  void renderLine(QPainter &painter, const TerminalFrame &frame, int line,
+                  int y);
+
+private:
+  QImage m_image;
+  TerminalFrame m_lastFrame;
+};
+
 /**
  * @class Terminal
  * @brief A QML terminal widget with optional VT-100 emulation.
@@ -73,20 +141,33 @@ class Terminal : public QQuickPaintedItem
              READ scrollOffsetY
              WRITE setScrollOffsetY
              NOTIFY scrollOffsetYChanged)
+  Q_PROPERTY(QString searchText
+             READ searchText
+             WRITE setSearchText
+             NOTIFY searchResultsChanged)
+  Q_PROPERTY(int searchResultCount
+             READ searchResultCount
+             NOTIFY searchResultsChanged)
+  Q_PROPERTY(int currentSearchResult
+             READ currentSearchResult
+             NOTIFY searchResultsChanged)
   // clang-format on
 
 signals:
   void fontChanged();
   void cursorMoved();
+  void renderRequested(const Widgets::TerminalFrame &frame);
   void selectionChanged();
   void autoscrollChanged();
   void colorPaletteChanged();
   void copyAvailableChanged();
   void scrollOffsetYChanged();
   void vt100EmulationChanged();
+  void searchResultsChanged();
 
 public:
   Terminal(QQuickItem *parent = 0);
+  ~Terminal();
   void paint(QPainter *painter) override;
 
   enum Direction
@@ -123,10 +204,17 @@ public:
   [[nodiscard]] QPoint cursorPosition() const;
   [[nodiscard]] QPoint positionToCursor(const QPoint &pos) const;
 
+  [[nodiscard]] QString searchText() const;
+  [[nodiscard]] int searchResultCount() const;
+  [[nodiscard]] int currentSearchResult() const;
+
 public slots:
   void copy();
   void clear();
+  void findNext();
   void selectAll();
+  void findPrevious();
+  void setSearchText(const QString &text);
   void setFont(const QFont &font);
   void setAutoscroll(const bool enabled);
   void setScrollOffsetY(const int offset);
@@ -135,7 +223,9 @@ public slots:
 
 private slots:
   void toggleCursor();
+  void requestRender();
   void onThemeChanged();
+  void onFrameReady(const QImage &image);
   void onScrollbackChanged();
   void append(const QString &data);
   void appendString(const QString &string);
@@ -144,6 +234,7 @@ private slots:
 
 private:
   void initBuffer();
+  [[nodiscard]] TerminalFrame captureFrame() const;
   void processText(const QChar &byte, QString &text);
   void processEscape(const QChar &byte, QString &text);
   void processFormat(const QChar &byte, QString &text);
@@ -153,6 +244,11 @@ private:
   void setCursorPosition(const int x, const int y);
   void replaceData(qsizetype x, qsizetype y, QChar byte);
 
+  void runSearch();
+  void updateSearchIndex();
+  void showSearchResult(const int index);
+  [[nodiscard]] static quint64 lineDigest(const QString &line);
+
 protected:
   bool shouldEndSelection(const QChar c);
   void wheelEvent(QWheelEvent *event) override;
@@ -191,5 +287,19 @@ private:
   bool m_useFormatValueY;
 
   bool m_stateChanged;
+
+  bool m_searchStale;
+  int m_searchCursor;
+  int m_searchDirtyLine;
+  QString m_searchText;
+  QVector<QPoint> m_searchResults;
+  QVector<quint64> m_lineDigests;
+
+  bool m_renderPending;
+  QImage m_frontBuffer;
+  QThread m_renderThread;
+  TerminalRenderer *m_renderer;
 };
 } // namespace Widgets
+
+Q_DECLARE_METATYPE(Widgets::TerminalFrame)
@@ -0,0 +1,123 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <deque>
+
+#include <QtGlobal>
+
+namespace Widgets
+{
+/**
+ * @brief Incremental min/max tracker over a sliding sample window.
+ *
+ * Auto-ranging widgets need the extrema of the last N samples every frame.
+ * Rescanning the window is O(N) per widget per frame, which multiplies
+ * across a dashboard full of gauges; this tracker keeps two monotonic
+ * deques instead, so appending a sample is O(1) amortized and the current
+ * extrema are simple front lookups.
+ *
+ * The classic invariant applies: the min deque is non-decreasing and the
+ * max deque non-increasing, entries older than the window are retired from
+ * the front as new samples arrive.
+ */
+class WindowedMinMax
+{
+public:
+  /**
+   * @brief Constructs a tracker over the given window size.
+   * @param window Number of most recent samples considered (at least 1).
+   */
+  explicit WindowedMinMax(const int window = 512)
+    : m_count(0)
+    , m_window(quint64(qMax(1, window)))
+  {
+  }
+
+  /**
+   * @brief Returns @c true once at least one sample was recorded.
+   */
+  [[nodiscard]] bool isValid() const { return m_count > 0; }
+
+  /**
+   * @brief Returns the smallest sample inside the window.
+   */
+  [[nodiscard]] double min() const { return m_minDeque.front().value; }
+
+  /**
+   * @brief Returns the largest sample inside the window.
+   */
+  [[nodiscard]] double max() const { return m_maxDeque.front().value; }
+
+  /**
+   * @brief Records one sample & retires entries that left the window.
+   * @param value The new sample.
+   */
+  void append(const double value)
+  {
+    // Samples dominated by the new one can never become an extremum again
+    while (!m_minDeque.empty() && m_minDeque.back().value >= value)
+      m_minDeque.pop_back();
+    while (!m_maxDeque.empty() && m_maxDeque.back().value <= value)
+      m_maxDeque.pop_back();
+
+    m_minDeque.push_back({m_count, value});
+    m_maxDeque.push_back({m_count, value});
+    ++m_count;
+
+    // Retire the extrema that slid out of the window
+    if (m_count > m_window)
+    {
+      const auto oldest = m_count - m_window;
+      if (m_minDeque.front().index < oldest)
+        m_minDeque.pop_front();
+      if (m_maxDeque.front().index < oldest)
+        m_maxDeque.pop_front();
+    }
+  }
+
+  /**
+   * @brief Discards all recorded samples.
+   */
+  void clear()
+  {
+    m_count = 0;
+    m_minDeque.clear();
+    m_maxDeque.clear();
+  }
+
+private:
+  /**
+   * @brief One candidate extremum & the sample index it was recorded at.
+   */
+  struct Entry
+  {
+    quint64 index;
+    double value;
+  };
+
+  quint64 m_count;
+  quint64 m_window;
+  std::deque<Entry> m_minDeque;
+  std::deque<Entry> m_maxDeque;
+};
+} // namespace Widgets
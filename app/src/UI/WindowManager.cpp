@@ -21,6 +21,8 @@
 
 #include "WindowManager.h"
 #include "UI/Taskbar.h"
+#include "UI/Dashboard.h"
+#include "Misc/Settings.h"
 
 #include <QUrl>
 #include <QFile>
@@ -117,6 +119,7 @@ void UI::WindowManager::clear()
   m_zCounter = 1;
   m_windowZ.clear();
   m_windows.clear();
+  m_layoutCache.clear();
   m_windowGeometry.clear();
 
   Q_EMIT zCounterChanged();
@@ -136,7 +139,7 @@ void UI::WindowManager::loadLayout()
 {
   if (autoLayoutEnabled())
     autoLayout();
-  else
+  else if (!restoreWindowGeometry())
     cascadeLayout();
 }
 
@@ -147,8 +150,13 @@ void UI::WindowManager::loadLayout()
  * layout. The layout alternates between vertical and horizontal splits based
  * on the area shape.
  *
- * Each window is resized and positioned to fit cleanly with spacing and
- * margins. Emits geometryChanged() for each updated window.
+ * The solution depends only on the container size and the ordered set of
+ * visible windows, so computed layouts are cached on that key and re-applied
+ * directly when the same configuration recurs (e.g. toggling a widget closed
+ * and open again, or dragging the window back through a size it already
+ * passed). Geometry writes are skipped for windows whose tile did not move,
+ * so a resize on a large dashboard only touches the windows that actually
+ * changed instead of re-pushing every geometry through the scene graph.
  *
  * Call this after adding, removing, or changing window visibility or size.
  */
@@ -170,42 +178,47 @@ void UI::WindowManager::autoLayout()
   if (visibleWindows.isEmpty())
     return;
 
+  // Re-apply the cached solution for this (container size, widget set) pair
+  const quint64 key = layoutCacheKey(visibleWindows);
+  const auto cached = m_layoutCache.constFind(key);
+  if (cached != m_layoutCache.constEnd())
+  {
+    for (int i = 0; i < visibleWindows.count(); ++i)
+      applyWindowGeometry(visibleWindows.at(i), cached->at(i));
+
+    return;
+  }
+
   // Define the initial available space (dashboard area minus margin)
   QRect rootArea(margin, margin, width() - 2 * margin, height() - 2 * margin);
 
-  // Recursive lambda to tile the given list of windows into the given area
-  auto tileRecursive = [&](auto &&self, const QRect &area,
-                           const QList<QQuickItem *> &windows) -> void {
+  // Recursive lambda to tile a window range into the given area; the result
+  // is stored into the solution vector instead of written to the windows, so
+  // the full solution can be cached & re-applied without re-tiling
+  QVector<QRect> solution(visibleWindows.count());
+  auto tileRecursive = [&](auto &&self, const QRect &area, const int first,
+                           const int count) -> void {
     // No available windows, nothing to do
-    if (windows.isEmpty())
+    if (count <= 0)
       return;
 
     // Single window, fill the entire area
-    if (windows.size() == 1)
+    if (count == 1)
     {
-      QQuickItem *win = windows.first();
-      QRect windowArea;
+      QQuickItem *win = visibleWindows.at(first);
       if (win->state() == "normal")
-        windowArea = area;
+        solution[first] = area;
       else
-        windowArea = QRect(x(), y(), width(), height());
-
-      win->setX(windowArea.x());
-      win->setY(windowArea.y());
-      win->setWidth(windowArea.width());
-      win->setHeight(windowArea.height());
-      m_windowGeometry[win] = windowArea;
-      Q_EMIT geometryChanged(win);
+        solution[first] = QRect(x(), y(), width(), height());
+
       return;
     }
 
     // Decide split direction based on current area's aspect ratio
     bool splitVertically = area.width() > area.height();
 
-    // Split the window list into two halves
-    int mid = windows.size() / 2;
-    QList<QQuickItem *> firstHalf = windows.mid(0, mid);
-    QList<QQuickItem *> secondHalf = windows.mid(mid);
+    // Split the window range into two halves
+    int mid = count / 2;
     QRect firstArea, secondArea;
 
     // Vertical split, divide the area into left/right panels
@@ -228,13 +241,21 @@ void UI::WindowManager::autoLayout()
                          area.height() / 2.0 - spacing / 2.0);
     }
 
-    // Recursively lay out each half of the window list in the sub-area
-    self(self, firstArea, firstHalf);
-    self(self, secondArea, secondHalf);
+    // Recursively lay out each half of the window range in the sub-area
+    self(self, firstArea, first, mid);
+    self(self, secondArea, first + mid, count - mid);
   };
 
   // Kick off the recursive tiling process
-  tileRecursive(tileRecursive, rootArea, visibleWindows);
+  tileRecursive(tileRecursive, rootArea, 0, int(visibleWindows.count()));
+
+  // Retain the solution & push it to the scene
+  if (m_layoutCache.count() >= LayoutCacheLimit)
+    m_layoutCache.clear();
+
+  m_layoutCache.insert(key, solution);
+  for (int i = 0; i < visibleWindows.count(); ++i)
+    applyWindowGeometry(visibleWindows.at(i), solution.at(i));
 }
 
 /**
@@ -813,6 +834,10 @@ void UI::WindowManager::mouseReleaseEvent(QMouseEvent *event)
   ungrabMouse();
   unsetCursor();
 
+  // Persist the manual layout once a drag or resize operation finishes
+  if (m_dragWindow || m_resizeWindow)
+    saveWindowGeometry();
+
   // Reset window tracking parameters
   m_dragWindow = nullptr;
   m_resizeWindow = nullptr;
@@ -823,3 +848,123 @@ void UI::WindowManager::mouseReleaseEvent(QMouseEvent *event)
   // Pass the event through
   QQuickItem::mouseReleaseEvent(event);
 }
+
+/**
+ * @brief Returns the settings key that identifies the current dashboard.
+ *
+ * Derived from the frame title and the widget count, so a stored manual
+ * layout is only re-applied to the project it was saved for.
+ */
+QString UI::WindowManager::layoutSettingsKey() const
+{
+  auto *db = &UI::Dashboard::instance();
+  auto title = db->currentFrame().title();
+  title.replace(QLatin1Char('/'), QLatin1Char('_'));
+  return QStringLiteral("windowLayout/%1_%2")
+      .arg(title)
+      .arg(db->totalWidgetCount());
+}
+
+/**
+ * @brief Writes a computed geometry to a window, skipping redundant updates.
+ *
+ * Compares the target rectangle against both the tracked geometry and the
+ * item's actual position/size, and only touches the item (and notifies QML)
+ * when something actually changed. During an interactive resize most tiles
+ * keep their rectangle between layout passes, so this avoids waking the
+ * scene graph for windows that did not move.
+ */
+void UI::WindowManager::applyWindowGeometry(QQuickItem *item, const QRect &rect)
+{
+  if (m_windowGeometry.value(item) == rect && item->x() == rect.x()
+      && item->y() == rect.y() && item->width() == rect.width()
+      && item->height() == rect.height())
+    return;
+
+  item->setX(rect.x());
+  item->setY(rect.y());
+  item->setWidth(rect.width());
+  item->setHeight(rect.height());
+  m_windowGeometry[item] = rect;
+  Q_EMIT geometryChanged(item);
+}
+
+/**
+ * @brief Computes the cache key for an auto-layout solution.
+ *
+ * Hashes the container dimensions together with the identity and state of
+ * every visible window, in layout order. The tiling algorithm depends on
+ * nothing else, so two identical keys always produce identical solutions.
+ */
+quint64
+UI::WindowManager::layoutCacheKey(const QList<QQuickItem *> &windows) const
+{
+  quint64 key = qHashMulti(0, qRound(width()), qRound(height()));
+  for (auto *win : windows)
+    key = qHashMulti(key, quintptr(win), win->state());
+
+  return key;
+}
+
+/**
+ * @brief Persists the manually arranged window geometries for this dashboard.
+ *
+ * Called when the user finishes dragging or resizing a window while
+ * auto-layout is disabled, so the arrangement survives application restarts.
+ */
+void UI::WindowManager::saveWindowGeometry()
+{
+  // Manual layouts only exist while auto-layout is disabled
+  if (autoLayoutEnabled())
+    return;
+
+  // Store the geometry of every registered window, keyed by window ID
+  QVariantMap geometries;
+  for (auto it = m_windows.begin(); it != m_windows.end(); ++it)
+  {
+    auto *win = it.value();
+    if (win)
+      geometries.insert(QString::number(it.key()), extractGeometry(win));
+  }
+
+  // Write the snapshot
+  Misc::Settings::instance().setValue(layoutSettingsKey(), geometries);
+}
+
+/**
+ * @brief Re-applies the stored manual window layout for this dashboard.
+ *
+ * @return @c true when a stored layout existed and was applied, @c false
+ *         when the caller should fall back to the cascade layout.
+ */
+bool UI::WindowManager::restoreWindowGeometry()
+{
+  // Obtain the stored layout (if any)
+  const auto geometries = Misc::Settings::instance().value(layoutSettingsKey()).toMap();
+  if (geometries.isEmpty())
+    return false;
+
+  // Re-apply the geometry of every registered window
+  bool restored = false;
+  for (auto it = m_windows.begin(); it != m_windows.end(); ++it)
+  {
+    const auto key = QString::number(it.key());
+    auto *win = it.value();
+    if (!win || !geometries.contains(key))
+      continue;
+
+    const auto rect = geometries.value(key).toRect();
+    if (!rect.isValid())
+      continue;
+
+    win->setX(rect.x());
+    win->setY(rect.y());
+    win->setWidth(rect.width());
+    win->setHeight(rect.height());
+    m_windowGeometry[win] = rect;
+    Q_EMIT geometryChanged(win);
+    restored = true;
+  }
+
+  return restored;
+}
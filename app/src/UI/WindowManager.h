@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <QHash>
 #include <QObject>
 #include <QQuickItem>
 
@@ -102,6 +103,13 @@ public slots:
   void updateGeometry(QQuickItem *item, const QRect &rect);
 
 private:
+  void saveWindowGeometry();
+  bool restoreWindowGeometry();
+  [[nodiscard]] QString layoutSettingsKey() const;
+  void applyWindowGeometry(QQuickItem *item, const QRect &rect);
+  [[nodiscard]] quint64
+  layoutCacheKey(const QList<QQuickItem *> &windows) const;
+
   QRect extractGeometry(QQuickItem *item) const;
   ResizeEdge detectResizeEdge(QQuickItem *target) const;
   QQuickItem *getWindow(const int x, const int y) const;
@@ -111,6 +119,9 @@ protected:
   void mousePressEvent(QMouseEvent *event) override;
   void mouseReleaseEvent(QMouseEvent *event) override;
 
+private:
+  static constexpr int LayoutCacheLimit = 64;
+
 private:
   int m_zCounter;
   bool m_autoLayoutEnabled;
@@ -119,6 +130,7 @@ private:
   QMap<int, QQuickItem *> m_windows;
   QMap<QQuickItem *, int> m_windowZ;
   QMap<QQuickItem *, QRect> m_windowGeometry;
+  QHash<quint64, QVector<QRect>> m_layoutCache;
 
   ResizeEdge m_resizeEdge;
   QRect m_initialGeometry;
@@ -128,5 +140,6 @@ private:
   QQuickItem *m_dragWindow;
   QQuickItem *m_resizeWindow;
   QQuickItem *m_focusedWindow;
+
 };
 } // namespace UI
@@ -0,0 +1,236 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <QtTest>
+
+#include "IO/CircularBuffer.h"
+
+/**
+ * @class BenchmarkCircularBuffer
+ * @brief Benchmarks for the ring buffer powering frame extraction.
+ *
+ * Covers the pattern-search primitives (SIMD fast path and the KMP fallback)
+ * and replayed frame-extraction loops matching what FrameReader::processData()
+ * performs for each detection mode: scan for the delimiter(s), peek the frame
+ * and consume the processed bytes. Changing SIMD::findPattern, the ring
+ * read/append paths or the extraction loops should move these numbers, and
+ * nothing else should.
+ *
+ * Run with "-o results.csv,csv" to record a baseline (see the README in this
+ * directory).
+ */
+class BenchmarkCircularBuffer : public QObject
+{
+  Q_OBJECT
+
+private:
+  /**
+   * @brief Builds a stream of @a count frames of @a payload bytes each,
+   *        wrapped with the given start/end sequences.
+   */
+  static QByteArray buildStream(const int count, const int payload,
+                                const QByteArray &start, const QByteArray &end)
+  {
+    QByteArray stream;
+    stream.reserve(count * (payload + start.size() + end.size()));
+    for (int i = 0; i < count; ++i)
+    {
+      stream.append(start);
+      stream.append(QByteArray(payload, 'x'));
+      stream.append(end);
+    }
+
+    return stream;
+  }
+
+private slots:
+  /**
+   * @brief Scans a full ring for a one-byte delimiter (quick-plot case).
+   */
+  void findPatternOneByte()
+  {
+    IO::SPSCCircularBuffer<QByteArray, char> buffer(2 * 1024 * 1024);
+    QByteArray data(1024 * 1024 - 1, 'x');
+    data.append('\n');
+    (void)buffer.append(data);
+
+    const QByteArray pattern("\n");
+    QBENCHMARK
+    {
+      volatile int index = buffer.findPattern(pattern);
+      Q_UNUSED(index);
+    }
+  }
+
+  /**
+   * @brief Scans a full ring for the default two-byte finish sequence.
+   */
+  void findPatternTwoBytes()
+  {
+    IO::SPSCCircularBuffer<QByteArray, char> buffer(2 * 1024 * 1024);
+    QByteArray data(1024 * 1024 - 2, 'x');
+    data.append("*/");
+    (void)buffer.append(data);
+
+    const QByteArray pattern("*/");
+    QBENCHMARK
+    {
+      volatile int index = buffer.findPattern(pattern);
+      Q_UNUSED(index);
+    }
+  }
+
+  /**
+   * @brief Scans a full ring with the KMP fallback and a long pattern.
+   */
+  void findPatternKMPLong()
+  {
+    IO::SPSCCircularBuffer<QByteArray, char> buffer(2 * 1024 * 1024);
+    const QByteArray pattern("$FRAME-DELIMITER");
+    QByteArray data(1024 * 1024 - pattern.size(), 'x');
+    data.append(pattern);
+    (void)buffer.append(data);
+
+    QBENCHMARK
+    {
+      volatile int index = buffer.findPatternKMP(pattern);
+      Q_UNUSED(index);
+    }
+  }
+
+  /**
+   * @brief Replays end-delimited frame extraction (EndDelimiterOnly mode).
+   */
+  void extractEndDelimitedFrames()
+  {
+    const QByteArray end("\n");
+    const QByteArray stream = buildStream(1000, 64, QByteArray(), end);
+    IO::SPSCCircularBuffer<QByteArray, char> buffer(2 * stream.size());
+
+    QBENCHMARK
+    {
+      (void)buffer.append(stream);
+      while (true)
+      {
+        const int endIndex = buffer.findPattern(end);
+        if (endIndex == -1)
+          break;
+
+        IO::ByteView frame = buffer.peekView(endIndex);
+        Q_UNUSED(frame);
+        (void)buffer.read(endIndex + end.size());
+      }
+
+      buffer.clear();
+    }
+  }
+
+  /**
+   * @brief Replays start/end-delimited extraction (StartAndEndDelimiter).
+   */
+  void extractStartEndDelimitedFrames()
+  {
+    const QByteArray start("/*");
+    const QByteArray end("*/");
+    const QByteArray stream = buildStream(1000, 64, start, end);
+    IO::SPSCCircularBuffer<QByteArray, char> buffer(2 * stream.size());
+
+    QBENCHMARK
+    {
+      (void)buffer.append(stream);
+      while (true)
+      {
+        const int finishIndex = buffer.findPattern(end);
+        if (finishIndex == -1)
+          break;
+
+        const int startIndex = buffer.findPattern(start);
+        if (startIndex == -1 || startIndex >= finishIndex)
+        {
+          (void)buffer.read(finishIndex + end.size());
+          continue;
+        }
+
+        const qsizetype frameStart = startIndex + start.size();
+        const qsizetype frameLength = finishIndex - frameStart;
+        IO::ByteView frame = buffer.peekView(frameStart + frameLength)
+                                 .mid(frameStart, frameLength);
+        Q_UNUSED(frame);
+        (void)buffer.read(finishIndex + end.size());
+      }
+
+      buffer.clear();
+    }
+  }
+
+  /**
+   * @brief Replays start-delimited extraction (StartDelimiterOnly mode).
+   */
+  void extractStartDelimitedFrames()
+  {
+    const QByteArray start("$");
+    const QByteArray stream = buildStream(1000, 64, start, QByteArray());
+    IO::SPSCCircularBuffer<QByteArray, char> buffer(2 * stream.size());
+
+    QBENCHMARK
+    {
+      (void)buffer.append(stream);
+      while (true)
+      {
+        const int startIndex = buffer.findPattern(start);
+        if (startIndex == -1)
+          break;
+
+        const int nextIndex
+            = buffer.findPattern(start, startIndex + start.size());
+        if (nextIndex == -1)
+          break;
+
+        const qsizetype frameStart = startIndex + start.size();
+        const qsizetype frameLength = nextIndex - frameStart;
+        IO::ByteView frame = buffer.peekView(frameStart + frameLength)
+                                 .mid(frameStart, frameLength);
+        Q_UNUSED(frame);
+        (void)buffer.read(frameStart + frameLength);
+      }
+
+      buffer.clear();
+    }
+  }
+
+  /**
+   * @brief Measures raw append/read throughput of the SPSC ring.
+   */
+  void appendReadThroughput()
+  {
+    const QByteArray chunk(4096, 'x');
+    IO::SPSCCircularBuffer<QByteArray, char> buffer(1024 * 1024);
+
+    QBENCHMARK
+    {
+      (void)buffer.append(chunk);
+      (void)buffer.read(chunk.size());
+    }
+  }
+};
+
+QTEST_APPLESS_MAIN(BenchmarkCircularBuffer)
+#include "BenchmarkCircularBuffer.moc"
@@ -0,0 +1,216 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <QtTest>
+
+#include "SIMD/SIMD.h"
+
+/**
+ * @class BenchmarkSIMDKernels
+ * @brief Benchmarks for the SIMD kernels behind parsing & plotting.
+ *
+ * Exercises the double kernels through the same runtime-dispatch table the
+ * application uses (so the numbers reflect the AVX2/AVX-512 variants on hosts
+ * that have them), the byte/tokenize kernels that dominate quick-plot frame
+ * parsing, and the LTTB decimator that feeds the plot renderer.
+ *
+ * Run with "-o results.csv,csv" to record a baseline (see the README in this
+ * directory).
+ */
+class BenchmarkSIMDKernels : public QObject
+{
+  Q_OBJECT
+
+private:
+  static constexpr size_t SampleCount = 100000;
+
+  /**
+   * @brief Builds a pseudo-random sample buffer (deterministic seed).
+   */
+  static QVector<double> buildSamples(const size_t count)
+  {
+    QVector<double> samples;
+    samples.resize(count);
+
+    quint32 state = 0x12345678;
+    for (size_t i = 0; i < count; ++i)
+    {
+      state = state * 1664525 + 1013904223;
+      samples[i] = static_cast<double>(state) / 1e6;
+    }
+
+    return samples;
+  }
+
+private slots:
+  /**
+   * @brief Measures the dispatched fill kernel over a plot-sized series.
+   */
+  void fillDouble()
+  {
+    QVector<double> samples = buildSamples(SampleCount);
+    QBENCHMARK { SIMD::fill(samples.data(), SampleCount, 42.0); }
+  }
+
+  /**
+   * @brief Measures the dispatched shift kernel (sample scroll).
+   */
+  void shiftDouble()
+  {
+    QVector<double> samples = buildSamples(SampleCount);
+    QBENCHMARK { SIMD::shift(samples.data(), SampleCount, 42.0); }
+  }
+
+  /**
+   * @brief Measures the dispatched minimum reduction.
+   */
+  void findMinDouble()
+  {
+    const QVector<double> samples = buildSamples(SampleCount);
+    QBENCHMARK
+    {
+      volatile double min = SIMD::findMin(samples.data(), SampleCount);
+      Q_UNUSED(min);
+    }
+  }
+
+  /**
+   * @brief Measures the dispatched maximum reduction.
+   */
+  void findMaxDouble()
+  {
+    const QVector<double> samples = buildSamples(SampleCount);
+    QBENCHMARK
+    {
+      volatile double max = SIMD::findMax(samples.data(), SampleCount);
+      Q_UNUSED(max);
+    }
+  }
+
+  /**
+   * @brief Measures the fused min/max/mean/RMS single-pass kernel.
+   */
+  void computeStats()
+  {
+    const QVector<double> samples = buildSamples(SampleCount);
+    QBENCHMARK
+    {
+      const SIMD::Stats stats
+          = SIMD::computeStats(samples.data(), SampleCount);
+      Q_UNUSED(stats);
+    }
+  }
+
+  /**
+   * @brief Measures the fused point-extractor min/max used for autoscaling.
+   */
+  void findMinMaxPoints()
+  {
+    const QVector<double> samples = buildSamples(SampleCount);
+    QVector<QPointF> points;
+    points.resize(SampleCount);
+    for (size_t i = 0; i < SampleCount; ++i)
+      points[i] = QPointF(static_cast<qreal>(i), samples[i]);
+
+    QBENCHMARK
+    {
+      const auto range
+          = SIMD::findMinMax(points, [](const QPointF &p) { return p.y(); });
+      Q_UNUSED(range);
+    }
+  }
+
+  /**
+   * @brief Measures LTTB decimation from 100k points down to 1k.
+   */
+  void lttbDecimate()
+  {
+    const QVector<double> samples = buildSamples(SampleCount);
+    QVector<QPointF> source;
+    source.resize(SampleCount);
+    for (size_t i = 0; i < SampleCount; ++i)
+      source[i] = QPointF(static_cast<qreal>(i), samples[i]);
+
+    QVector<QPointF> dest;
+    QBENCHMARK { SIMD::lttbDecimate(source, dest, 1000); }
+  }
+
+  /**
+   * @brief Measures tokenize + parseDouble over a quick-plot style line.
+   *
+   * This is the per-frame hot loop of FrameBuilder in quick-plot mode:
+   * split the comma-separated frame and convert every field to a double.
+   */
+  void quickPlotParse()
+  {
+    QByteArray line;
+    for (int i = 0; i < 64; ++i)
+    {
+      if (i > 0)
+        line.append(',');
+      line.append(QByteArray::number(i * 3.14159, 'f', 6));
+    }
+
+    QBENCHMARK
+    {
+      double sum = 0;
+      SIMD::tokenize(line.constData(), line.size(), ',',
+                     [&sum](const char *token, size_t n) {
+                       sum += SIMD::parseDouble(token, n);
+                     });
+      volatile double sink = sum;
+      Q_UNUSED(sink);
+    }
+  }
+
+  /**
+   * @brief Measures hex encoding of a console-sized chunk.
+   */
+  void hexEncode()
+  {
+    const QByteArray data(4096, '\x5a');
+    QByteArray output(data.size() * 2, '\0');
+    QBENCHMARK
+    {
+      SIMD::hexEncode(data.constData(), data.size(), output.data());
+    }
+  }
+
+  /**
+   * @brief Measures delimiter counting over a console-sized chunk.
+   */
+  void countByte()
+  {
+    QByteArray data(65536, 'x');
+    for (int i = 63; i < data.size(); i += 64)
+      data[i] = '\n';
+
+    QBENCHMARK
+    {
+      volatile qsizetype count
+          = SIMD::countByte(data.constData(), data.size(), '\n');
+      Q_UNUSED(count);
+    }
+  }
+};
+
+QTEST_APPLESS_MAIN(BenchmarkSIMDKernels)
+#include "BenchmarkSIMDKernels.moc"
@@ -3,6 +3,7 @@
 // Qt
 #include <QTextEdit> // Required for inheritance
 
+class QTimer;
 class QCompleter;
 class QLineNumberArea;
 class QSyntaxStyle;
@@ -263,6 +264,20 @@ private:
    */
   int getIndentationSpaces();
 
+  /**
+   * @brief Method, that schedules a full document
+   * rehighlight. Visible blocks are rehighlighted
+   * immediately, the rest is processed in chunks
+   * whenever the event loop is idle.
+   */
+  void scheduleRehighlight();
+
+  /**
+   * @brief Method, that rehighlights the next chunk
+   * of blocks scheduled by scheduleRehighlight().
+   */
+  void proceedRehighlightChunk();
+
   QStyleSyntaxHighlighter *m_highlighter;
   QSyntaxStyle *m_syntaxStyle;
   QLineNumberArea *m_lineNumberArea;
@@ -274,4 +289,9 @@ private:
   bool m_autoParentheses;
   bool m_replaceTab;
   QString m_tabReplace;
+
+  QTimer *m_rehighlightTimer;
+  int m_rehighlightBlock;
+  int m_rehighlightFirstVisible;
+  int m_rehighlightLastVisible;
 };
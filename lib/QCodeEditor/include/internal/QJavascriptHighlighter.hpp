@@ -6,6 +6,7 @@
 
 // Qt
 #include <QRegularExpression>
+#include <QTextCharFormat>
 #include <QVector>
 
 class QSyntaxStyle;
@@ -25,6 +26,7 @@ public:
 
 protected:
   void highlightBlock(const QString &text) override;
+  void onSyntaxStyleChanged() override;
 
 private:
   QVector<QHighlightRule> m_highlightRules;
@@ -35,4 +37,11 @@ private:
 
   QRegularExpression m_commentStartPattern;
   QRegularExpression m_commentEndPattern;
+
+  QVector<QTextCharFormat> m_ruleFormats;
+  QTextCharFormat m_typeFormat;
+  QTextCharFormat m_stringFormat;
+  QTextCharFormat m_commentFormat;
+  QTextCharFormat m_functionFormat;
+  QTextCharFormat m_preprocessorFormat;
 };
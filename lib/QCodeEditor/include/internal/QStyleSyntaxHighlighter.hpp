@@ -34,6 +34,15 @@ public:
    */
   QSyntaxStyle *syntaxStyle() const;
 
+protected:
+  /**
+   * @brief Hook, that's called whenever the syntax style
+   * changes. Derived highlighters may use it to cache
+   * per-style data (for example resolved text formats)
+   * instead of querying the style on every match.
+   */
+  virtual void onSyntaxStyleChanged();
+
 private:
   QSyntaxStyle *m_syntaxStyle;
 };
@@ -18,6 +18,7 @@
 #include <QAbstractItemView>
 #include <QShortcut>
 #include <QMimeData>
+#include <QTimer>
 
 static QVector<QPair<QString, QString>> parentheses
     = {{"(", ")"}, {"{", "}"}, {"[", "]"}, {"\"", "\""}, {"'", "'"}};
@@ -33,6 +34,10 @@ QCodeEditor::QCodeEditor(QWidget *widget)
   , m_autoParentheses(true)
   , m_replaceTab(true)
   , m_tabReplace(QString(4, ' '))
+  , m_rehighlightTimer(nullptr)
+  , m_rehighlightBlock(-1)
+  , m_rehighlightFirstVisible(-1)
+  , m_rehighlightLastVisible(-1)
 {
   initDocumentLayoutHandlers();
   initFont();
@@ -106,7 +111,7 @@ void QCodeEditor::updateStyle()
 {
   if (m_highlighter)
   {
-    m_highlighter->rehighlight();
+    scheduleRehighlight();
   }
 
   if (m_syntaxStyle)
@@ -133,6 +138,73 @@ void QCodeEditor::updateStyle()
   updateExtraSelection();
 }
 
+void QCodeEditor::scheduleRehighlight()
+{
+  if (!m_highlighter)
+  {
+    return;
+  }
+
+  // Rehighlight the visible part of the document right away, so that a
+  // style change is reflected on screen without waiting for the idle pass
+  const auto firstVisible = getFirstVisibleBlock();
+  const auto lastVisible = cursorForPosition(QPoint(0, viewport()->height()))
+                               .block()
+                               .blockNumber();
+
+  for (auto block = document()->findBlockByNumber(firstVisible);
+       block.isValid() && block.blockNumber() <= lastVisible;
+       block = block.next())
+  {
+    m_highlighter->rehighlightBlock(block);
+  }
+
+  if (!m_rehighlightTimer)
+  {
+    m_rehighlightTimer = new QTimer(this);
+    m_rehighlightTimer->setInterval(0);
+    connect(m_rehighlightTimer, &QTimer::timeout, this,
+            &QCodeEditor::proceedRehighlightChunk);
+  }
+
+  m_rehighlightBlock = 0;
+  m_rehighlightFirstVisible = firstVisible;
+  m_rehighlightLastVisible = lastVisible;
+  m_rehighlightTimer->start();
+}
+
+void QCodeEditor::proceedRehighlightChunk()
+{
+  if (!m_highlighter)
+  {
+    m_rehighlightTimer->stop();
+    return;
+  }
+
+  constexpr int chunkSize = 128;
+  for (int i = 0; i < chunkSize; ++i)
+  {
+    // Skip the range that was already rehighlighted synchronously
+    if (m_rehighlightBlock >= m_rehighlightFirstVisible
+        && m_rehighlightBlock <= m_rehighlightLastVisible)
+    {
+      m_rehighlightBlock = m_rehighlightLastVisible + 1;
+    }
+
+    // Blocks are looked up by number on every step, so the pass stays
+    // valid even if the document is edited while it's in progress
+    auto block = document()->findBlockByNumber(m_rehighlightBlock);
+    if (!block.isValid())
+    {
+      m_rehighlightTimer->stop();
+      return;
+    }
+
+    m_highlighter->rehighlightBlock(block);
+    ++m_rehighlightBlock;
+  }
+}
+
 void QCodeEditor::onSelectionChanged()
 {
   auto selected = textCursor().selectedText();
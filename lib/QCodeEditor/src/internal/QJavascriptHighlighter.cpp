@@ -71,8 +71,43 @@ QJavascriptHighlighter::QJavascriptHighlighter(QTextDocument *document)
   m_highlightRules.append({QRegularExpression(R"(/\*.*?\*/)"), "Comment"});
 }
 
+void QJavascriptHighlighter::onSyntaxStyleChanged()
+{
+  m_ruleFormats.clear();
+
+  if (syntaxStyle() == nullptr)
+  {
+    return;
+  }
+
+  // Resolve the format of every rule once per style change, so that
+  // highlightBlock() doesn't perform a style lookup for every match
+  m_ruleFormats.reserve(m_highlightRules.size());
+  for (auto &rule : m_highlightRules)
+  {
+    m_ruleFormats.append(syntaxStyle()->getFormat(rule.formatName));
+  }
+
+  m_typeFormat = syntaxStyle()->getFormat("Type");
+  m_stringFormat = syntaxStyle()->getFormat("String");
+  m_commentFormat = syntaxStyle()->getFormat("Comment");
+  m_functionFormat = syntaxStyle()->getFormat("Function");
+  m_preprocessorFormat = syntaxStyle()->getFormat("Preprocessor");
+}
+
 void QJavascriptHighlighter::highlightBlock(const QString &text)
 {
+  // Rebuild the format cache if the style changed behind our back
+  if (m_ruleFormats.size() != m_highlightRules.size())
+  {
+    onSyntaxStyleChanged();
+
+    if (syntaxStyle() == nullptr)
+    {
+      return;
+    }
+  }
+
   // Checking for include
   {
     auto matchIterator = m_includePattern.globalMatch(text);
@@ -82,10 +117,10 @@ void QJavascriptHighlighter::highlightBlock(const QString &text)
       auto match = matchIterator.next();
 
       setFormat(match.capturedStart(), match.capturedLength(),
-                syntaxStyle()->getFormat("Preprocessor"));
+                m_preprocessorFormat);
 
       setFormat(match.capturedStart(1), match.capturedLength(1),
-                syntaxStyle()->getFormat("String"));
+                m_stringFormat);
     }
   }
   // Checking for function
@@ -96,11 +131,10 @@ void QJavascriptHighlighter::highlightBlock(const QString &text)
     {
       auto match = matchIterator.next();
 
-      setFormat(match.capturedStart(), match.capturedLength(),
-                syntaxStyle()->getFormat("Type"));
+      setFormat(match.capturedStart(), match.capturedLength(), m_typeFormat);
 
       setFormat(match.capturedStart(2), match.capturedLength(2),
-                syntaxStyle()->getFormat("Function"));
+                m_functionFormat);
     }
   }
   {
@@ -110,21 +144,20 @@ void QJavascriptHighlighter::highlightBlock(const QString &text)
     {
       auto match = matchIterator.next();
 
-      setFormat(match.capturedStart(1), match.capturedLength(1),
-                syntaxStyle()->getFormat("Type"));
+      setFormat(match.capturedStart(1), match.capturedLength(1), m_typeFormat);
     }
   }
 
-  for (auto &rule : m_highlightRules)
+  for (int i = 0; i < m_highlightRules.size(); ++i)
   {
-    auto matchIterator = rule.pattern.globalMatch(text);
+    auto matchIterator = m_highlightRules.at(i).pattern.globalMatch(text);
 
     while (matchIterator.hasNext())
     {
       auto match = matchIterator.next();
 
       setFormat(match.capturedStart(), match.capturedLength(),
-                syntaxStyle()->getFormat(rule.formatName));
+                m_ruleFormats.at(i));
     }
   }
 
@@ -153,7 +186,7 @@ void QJavascriptHighlighter::highlightBlock(const QString &text)
       commentLength = endIndex - startIndex + match.capturedLength();
     }
 
-    setFormat(startIndex, commentLength, syntaxStyle()->getFormat("Comment"));
+    setFormat(startIndex, commentLength, m_commentFormat);
     startIndex
         = text.indexOf(m_commentStartPattern, startIndex + commentLength);
   }
@@ -10,8 +10,11 @@ QStyleSyntaxHighlighter::QStyleSyntaxHighlighter(QTextDocument *document)
 void QStyleSyntaxHighlighter::setSyntaxStyle(QSyntaxStyle *style)
 {
   m_syntaxStyle = style;
+  onSyntaxStyleChanged();
 }
 
+void QStyleSyntaxHighlighter::onSyntaxStyleChanged() {}
+
 QSyntaxStyle *QStyleSyntaxHighlighter::syntaxStyle() const
 {
   return m_syntaxStyle;
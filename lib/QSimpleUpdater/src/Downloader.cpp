@@ -22,6 +22,7 @@
 
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
 #include <QProcess>
 #include <QDateTime>
 #include <QMessageBox>
@@ -51,6 +52,8 @@ Downloader::Downloader(QWidget *parent)
   m_startTime = 0;
   m_useCustomProcedures = false;
   m_mandatoryUpdate = false;
+  m_resumeOffset = 0;
+  m_responseChecked = false;
 
   /* Set download directory */
   m_downloadDir.setPath(
@@ -101,6 +104,13 @@ void Downloader::setUrlId(const QString &url)
 
 /**
  * Begins downloading the file at the given \a url
+ *
+ * If a partial download from a previous (interrupted) session exists, the
+ * transfer resumes where it left off using an HTTP range request. The entity
+ * validator (ETag or Last-Modified) recorded when the partial file was
+ * started is sent in an \c If-Range header, so a file that changed on the
+ * server is re-downloaded from scratch instead of being stitched together
+ * from two different releases.
  */
 void Downloader::startDownload(const QUrl &url)
 {
@@ -110,6 +120,13 @@ void Downloader::startDownload(const QUrl &url)
   m_ui->downloadLabel->setText(tr("Downloading updates"));
   m_ui->timeLabel->setText(tr("Time remaining") + ": " + tr("unknown"));
 
+  /* Ensure that downloads directory exists */
+  if (!m_downloadDir.exists())
+    m_downloadDir.mkpath(".");
+
+  /* Remove stale complete downloads */
+  QFile::remove(m_downloadDir.filePath(m_fileName));
+
   /* Configure the network request */
   QNetworkRequest request(url);
 
@@ -119,18 +136,30 @@ void Downloader::startDownload(const QUrl &url)
   if (!m_userAgentString.isEmpty())
     request.setRawHeader("User-Agent", m_userAgentString.toUtf8());
 
+  /* Resume a previous partial download when a validator is available */
+  m_resumeOffset = 0;
+  m_responseChecked = false;
+  const QFileInfo partial(m_downloadDir.filePath(m_fileName + PARTIAL_DOWN));
+  const QString validator = readValidator();
+  if (partial.exists() && partial.size() > 0 && !validator.isEmpty())
+  {
+    m_resumeOffset = partial.size();
+    request.setRawHeader("Range",
+                         "bytes=" + QByteArray::number(m_resumeOffset) + "-");
+    request.setRawHeader("If-Range", validator.toLatin1());
+  }
+
+  /* No resumable data, start from a clean slate */
+  else
+  {
+    QFile::remove(partial.absoluteFilePath());
+    QFile::remove(validatorPath());
+  }
+
   /* Start download */
   m_reply = m_manager->get(request);
   m_startTime = QDateTime::currentDateTime().toSecsSinceEpoch();
 
-  /* Ensure that downloads directory exists */
-  if (!m_downloadDir.exists())
-    m_downloadDir.mkpath(".");
-
-  /* Remove old downloads */
-  QFile::remove(m_downloadDir.filePath(m_fileName));
-  QFile::remove(m_downloadDir.filePath(m_fileName + PARTIAL_DOWN));
-
   /* Update UI when download progress changes or download finishes */
   connect(m_reply, SIGNAL(downloadProgress(qint64, qint64)), this,
           SLOT(updateProgress(qint64, qint64)));
@@ -160,7 +189,15 @@ void Downloader::setUserAgentString(const QString &agent)
 
 void Downloader::finished()
 {
+  /* Transfer was interrupted, keep the partial file so it can be resumed */
+  if (m_reply->error() != QNetworkReply::NoError)
+  {
+    m_reply->close();
+    return;
+  }
+
   /* Rename file */
+  QFile::remove(validatorPath());
   QFile::rename(m_downloadDir.filePath(m_fileName + PARTIAL_DOWN),
                 m_downloadDir.filePath(m_fileName));
 
@@ -304,6 +341,30 @@ void Downloader::saveFile(qint64 received, qint64 total)
     return;
   }
 
+  /* Inspect the response status once, on the first chunk of data */
+  if (!m_responseChecked)
+  {
+    m_responseChecked = true;
+    const int status
+        = m_reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+
+    /* Requested a range but got the full entity, restart from scratch */
+    if (m_resumeOffset > 0 && status != 206)
+    {
+      m_resumeOffset = 0;
+      QFile::remove(m_downloadDir.filePath(m_fileName + PARTIAL_DOWN));
+    }
+
+    /* Record the entity validator so the partial file can be resumed */
+    if (m_resumeOffset == 0)
+    {
+      QString validator = QString::fromLatin1(m_reply->rawHeader("ETag"));
+      if (validator.isEmpty())
+        validator = QString::fromLatin1(m_reply->rawHeader("Last-Modified"));
+      writeValidator(validator);
+    }
+  }
+
   /* Save downloaded data to disk */
   QFile file(m_downloadDir.filePath(m_fileName + PARTIAL_DOWN));
   if (file.open(QIODevice::WriteOnly | QIODevice::Append))
@@ -353,6 +414,10 @@ void Downloader::updateProgress(qint64 received, qint64 total)
 {
   if (total > 0)
   {
+    /* Account for the bytes already on disk when resuming */
+    received += m_resumeOffset;
+    total += m_resumeOffset;
+
     m_ui->progressBar->setMinimum(0);
     m_ui->progressBar->setMaximum(100);
     m_ui->progressBar->setValue((received * 100) / total);
@@ -435,6 +500,48 @@ qreal Downloader::round(const qreal &input)
   return static_cast<qreal>(roundf(static_cast<float>(input) * 100) / 100);
 }
 
+/**
+ * Returns the path of the sidecar file that stores the entity validator of
+ * the current partial download
+ */
+QString Downloader::validatorPath() const
+{
+  return m_downloadDir.filePath(m_fileName + PARTIAL_DOWN + ".etag");
+}
+
+/**
+ * Reads the entity validator recorded when the partial download was started,
+ * or an empty string when no resumable state exists
+ */
+QString Downloader::readValidator() const
+{
+  QFile file(validatorPath());
+  if (file.open(QIODevice::ReadOnly))
+    return QString::fromLatin1(file.readAll()).trimmed();
+
+  return "";
+}
+
+/**
+ * Records the entity validator of the file being downloaded, so a later
+ * session can safely resume the partial download with an \c If-Range request
+ */
+void Downloader::writeValidator(const QString &validator)
+{
+  if (validator.isEmpty())
+  {
+    QFile::remove(validatorPath());
+    return;
+  }
+
+  QFile file(validatorPath());
+  if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    file.write(validator.toLatin1());
+    file.close();
+  }
+}
+
 QString Downloader::downloadDir() const
 {
   return m_downloadDir.absolutePath();
@@ -74,6 +74,9 @@ private slots:
 
 private:
   qreal round(const qreal &input);
+  QString validatorPath() const;
+  QString readValidator() const;
+  void writeValidator(const QString &validator);
 
 private:
   QString m_url;
@@ -84,6 +87,9 @@ private:
   QNetworkReply *m_reply;
   QString m_userAgentString;
 
+  qint64 m_resumeOffset;
+  bool m_responseChecked;
+
   bool m_useCustomProcedures;
   bool m_mandatoryUpdate;
 
@@ -0,0 +1,57 @@
+#!/bin/bash
+#
+# Serial Studio - https://github.com/alex-spataru/serial-studio
+#
+# Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <https://www.gnu.org/licenses/>.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+set -e
+
+#------------------------------------------------------------------------------
+# Config
+#------------------------------------------------------------------------------
+
+BUILD_TYPE="${BUILD_TYPE:-Release}"
+BUILD_DIR="${BUILD_DIR:-build-pgo}"
+PROFILE_DIR="${PROFILE_DIR:-$(pwd)/${BUILD_DIR}/pgo-profiles}"
+TRAIN_WORKLOAD="${TRAIN_WORKLOAD:---soak 120 5000 64}"
+JOBS="${JOBS:-$(nproc 2>/dev/null || sysctl -n hw.ncpu)}"
+
+#------------------------------------------------------------------------------
+# Stage 1: instrumented build, trained with the frame-pipeline soak workload
+#------------------------------------------------------------------------------
+
+cmake -S . -B "${BUILD_DIR}/generate" \
+   -DCMAKE_BUILD_TYPE="${BUILD_TYPE}" \
+   -DPGO_MODE=generate \
+   -DPGO_PROFILE_DIR="${PROFILE_DIR}" \
+   -DPGO_TRAIN_WORKLOAD="${TRAIN_WORKLOAD}"
+cmake --build "${BUILD_DIR}/generate" -j"${JOBS}"
+cmake --build "${BUILD_DIR}/generate" --target pgo-train
+
+#------------------------------------------------------------------------------
+# Stage 2: optimized build consuming the training profiles (LTO + PGO)
+#------------------------------------------------------------------------------
+
+cmake -S . -B "${BUILD_DIR}/use" \
+   -DCMAKE_BUILD_TYPE="${BUILD_TYPE}" \
+   -DPGO_MODE=use \
+   -DPGO_PROFILE_DIR="${PROFILE_DIR}"
+cmake --build "${BUILD_DIR}/use" -j"${JOBS}"
+
+echo "PGO build ready in ${BUILD_DIR}/use"
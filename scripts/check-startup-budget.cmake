@@ -0,0 +1,85 @@
+#
+# Serial Studio - https://github.com/alex-spataru/serial-studio
+#
+# Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <https://www.gnu.org/licenses/>.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+#
+# Startup-cost budget check, run after linking via `cmake -P`.
+#
+# Kiosk deployments boot the application on every power cycle, so binary
+# size (dynamic-linker relocation work) and the number of static
+# initializers (code that runs before main) are treated as budgeted
+# resources. The check fails the build when either figure exceeds its
+# budget, which makes regressions visible in CI at the commit that
+# introduced them instead of in field boot-time measurements.
+#
+# Expected definitions:
+#   BINARY    Path of the linked executable.
+#   MAX_MB    Binary size budget in megabytes.
+#   MAX_INITS Static-initializer budget (0 disables the symbol check).
+#   NM        Path of an nm-compatible tool (empty skips the symbol check).
+#
+
+if(NOT EXISTS "${BINARY}")
+  message(FATAL_ERROR "Startup budget: binary not found: ${BINARY}")
+endif()
+
+# Check the binary size budget
+file(SIZE "${BINARY}" binary_size)
+math(EXPR binary_mb "${binary_size} / 1048576")
+if(binary_mb GREATER ${MAX_MB})
+  message(FATAL_ERROR
+    "Startup budget: binary is ${binary_mb} MB, budget is ${MAX_MB} MB. "
+    "Either trim the new dependency/resources or raise "
+    "STARTUP_BUDGET_MAX_BINARY_MB deliberately.")
+endif()
+
+message(STATUS
+  "Startup budget: binary size ${binary_mb} MB (budget ${MAX_MB} MB)")
+
+# Check the static-initializer budget (best effort, needs an nm tool)
+if(NM AND MAX_INITS GREATER 0)
+  execute_process(
+    COMMAND "${NM}" --demangle "${BINARY}"
+    OUTPUT_VARIABLE symbols
+    ERROR_VARIABLE nm_error
+    RESULT_VARIABLE nm_result
+  )
+
+  if(nm_result EQUAL 0)
+    string(REGEX MATCHALL
+      "_GLOBAL__sub_I|__cxx_global_var_init|_GLOBAL__I_" inits "${symbols}")
+    list(LENGTH inits init_count)
+
+    if(init_count GREATER ${MAX_INITS})
+      message(FATAL_ERROR
+        "Startup budget: ${init_count} static initializers, budget is "
+        "${MAX_INITS}. Prefer lazy construction (function-local statics) "
+        "over namespace-scope objects, or raise "
+        "STARTUP_BUDGET_MAX_STATIC_INITS deliberately.")
+    endif()
+
+    message(STATUS
+      "Startup budget: ${init_count} static initializers "
+      "(budget ${MAX_INITS})")
+  else()
+    message(STATUS
+      "Startup budget: skipping static-initializer check (${nm_error})")
+  endif()
+endif()